@@ -0,0 +1,370 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#define _GNU_SOURCE           /* memmem, memrchr */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <regex.h>
+
+#include "osd-cat.h"
+
+#define MAX_SPANS 64
+
+static const char *color_names[] = {
+  "black", "red", "green", "yellow", "blue", "magenta", "cyan", "white"
+};
+
+/* Escape characters in the input are shown, unless --ansi is given */
+static const char escape_picture[] = "\xe2\x90\x9b";
+
+/* parse_color -- a color name, bright-<name> or palette index {{{ */
+static int
+parse_color(const char *name)
+{
+  int i, bright = 0;
+  char *end;
+
+  if (!strncmp(name, "bright-", 7)) {
+    name += 7;
+    bright = 8;
+  }
+  for (i = 0; i < 8; i++)
+    if (!strcmp(name, color_names[i]))
+      return i + bright;
+  i = strtol(name, &end, 10);
+  if (*name != '\0' && *end == '\0' && i >= 0 && i < 16 && !bright)
+    return i;
+  return -1;
+}
+
+/* }}} */
+
+/* pattern_compile -- compile a pattern, plain strings are searched with memmem {{{ */
+static int
+pattern_compile(struct pattern *p, const char *re)
+{
+  int err;
+
+  memset(p, 0, sizeof(*p));
+  if (strpbrk(re, "\\^$.[]|()*+?{}") == NULL) {
+    p->literal = strdup(re);
+    p->literal_len = strlen(re);
+    return p->literal == NULL ? -1 : 0;
+  }
+  if ((err = regcomp(&p->re, re, REG_EXTENDED)) != 0) {
+    char msg[256];
+    regerror(err, &p->re, msg, sizeof(msg));
+    fprintf(stderr, "Invalid pattern %s: %s\n", re, msg);
+    return -1;
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* pattern_find -- first match in line[from..len) {{{
+ *
+ * The line is not NUL terminated, REG_STARTEND bounds the search.
+ */
+static int
+pattern_find(struct pattern *p, const char *line, size_t from, size_t len,
+             size_t *start, size_t *end)
+{
+  regmatch_t m;
+
+  if (p->literal != NULL) {
+    const char *s;
+    if (p->literal_len == 0 ||
+        (s = memmem(line + from, len - from, p->literal, p->literal_len)) == NULL)
+      return 0;
+    *start = s - line;
+    *end = *start + p->literal_len;
+    return 1;
+  }
+  m.rm_so = from;
+  m.rm_eo = len;
+  if (regexec(&p->re, line, 1, &m, REG_STARTEND | (from > 0 ? REG_NOTBOL : 0)) != 0)
+    return 0;
+  *start = m.rm_so;
+  *end = m.rm_eo;
+  return 1;
+}
+
+/* }}} */
+
+/* filter_add -- add a --match, --exclude or --highlight pattern {{{
+ *
+ * A highlight pattern can end with :color (default red).
+ */
+int
+filter_add(struct filter *f, int kind, const char *arg)
+{
+  struct pattern *p;
+  char *re = strdup(arg);
+  int color = 1;
+
+  if (re == NULL)
+    return -1;
+  if (kind == FILTER_HIGHLIGHT) {
+    /* A suffix that is not a color is part of the pattern */
+    char *c = strrchr(re, ':');
+    if (c != NULL && (color = parse_color(c + 1)) != -1)
+      *c = '\0';
+    else
+      color = 1;
+  }
+  p = realloc(f->patterns[kind], (f->npatterns[kind] + 1) * sizeof(struct pattern));
+  if (p == NULL) {
+    free(re);
+    return -1;
+  }
+  f->patterns[kind] = p;
+  p += f->npatterns[kind];
+  if (pattern_compile(p, re) == -1) {
+    free(re);
+    return -1;
+  }
+  p->color = color;
+  f->npatterns[kind]++;
+  free(re);
+  return 0;
+}
+
+/* }}} */
+
+/* filter_free -- free the compiled patterns {{{ */
+void
+filter_free(struct filter *f)
+{
+  int k, i;
+  for (k = 0; k < FILTER_KINDS; k++) {
+    for (i = 0; i < f->npatterns[k]; i++) {
+      if (f->patterns[k][i].literal != NULL)
+        free(f->patterns[k][i].literal);
+      else
+        regfree(&f->patterns[k][i].re);
+    }
+    free(f->patterns[k]);
+  }
+  free(f->buf);
+  memset(f, 0, sizeof(*f));
+}
+
+/* }}} */
+
+/* filter_accept -- does a line pass --match and --exclude {{{ */
+int
+filter_accept(struct filter *f, const char *line, size_t len)
+{
+  size_t start, end;
+  int i;
+
+  for (i = 0; i < f->npatterns[FILTER_EXCLUDE]; i++)
+    if (pattern_find(&f->patterns[FILTER_EXCLUDE][i], line, 0, len, &start, &end))
+      return 0;
+  if (f->npatterns[FILTER_MATCH] == 0)
+    return 1;
+  for (i = 0; i < f->npatterns[FILTER_MATCH]; i++)
+    if (pattern_find(&f->patterns[FILTER_MATCH][i], line, 0, len, &start, &end))
+      return 1;
+  return 0;
+}
+
+/* }}} */
+
+/* append -- append to the filter buffer {{{ */
+static int
+append(struct filter *f, size_t *n, const char *s, size_t len)
+{
+  if (*n + len > f->size) {
+    size_t size = f->size ? f->size : 256;
+    char *buf;
+    while (size < *n + len)
+      size *= 2;
+    if ((buf = realloc(f->buf, size)) == NULL)
+      return -1;
+    f->buf = buf;
+    f->size = size;
+  }
+  memcpy(f->buf + *n, s, len);
+  *n += len;
+  return 0;
+}
+
+/* }}} */
+
+/* append_text -- append input text, showing escape characters {{{ */
+static int
+append_text(struct filter *f, size_t *n, const char *s, size_t len)
+{
+  const char *end = s + len, *esc;
+
+  if (f->ansi)
+    return append(f, n, s, len);
+  while ((esc = memchr(s, '\033', end - s)) != NULL) {
+    if (append(f, n, s, esc - s) == -1 ||
+        append(f, n, escape_picture, sizeof(escape_picture) - 1) == -1)
+      return -1;
+    s = esc + 1;
+  }
+  return append(f, n, s, end - s);
+}
+
+/* }}} */
+
+/* inside_escape -- is pos within an escape sequence of the line {{{ */
+static int
+inside_escape(const char *line, size_t len, size_t pos)
+{
+  const char *esc = memrchr(line, '\033', pos), *p, *end = line + len;
+
+  if (esc == NULL)
+    return 0;
+  p = esc + 1;
+  if (p < end && *p == '[') {
+    for (p++; p < end && *p >= 0x20 && *p <= 0x3f; p++)
+      ;
+    p++;
+  }
+  return line + pos > esc && line + pos < p;
+}
+
+/* }}} */
+
+/* track_foreground -- follow the foreground set by the SGR escapes of text {{{
+ *
+ * fg holds the SGR parameters that set the color in effect ("39" for the
+ * default), to set it again after a highlight.
+ */
+static void
+track_foreground(const char *s, const char *end, char *fg, size_t size)
+{
+  while ((s = memchr(s, '\033', end - s)) != NULL) {
+    const char *p = s + 1, *params[32];
+    int nparams = 0, i;
+    if (p >= end || *p != '[')
+      break;
+    for (p++; p < end && *p >= 0x20 && *p <= 0x3f; p++)
+      ;
+    if (p >= end)
+      break;
+    if (*p == 'm') {
+      const char *q = s + 2;
+      /* Each parameter ends at ; or m */
+      while (nparams < 32) {
+        params[nparams++] = q;
+        if ((q = memchr(q, ';', p - q)) == NULL)
+          break;
+        q++;
+      }
+      for (i = 0; i < nparams; i++) {
+        long code = strtol(params[i], NULL, 10);
+        int n = 1;
+        if (code == 38 || code == 48)
+          n += i + 1 < nparams && strtol(params[i + 1], NULL, 10) == 5 ? 2 :
+               i + 1 < nparams && strtol(params[i + 1], NULL, 10) == 2 ? 4 : 0;
+        if (i + n > nparams)
+          n = nparams - i;
+        if (code == 0 || code == 39)
+          snprintf(fg, size, "39");
+        else if ((code >= 30 && code <= 38) || (code >= 90 && code <= 97))
+          snprintf(fg, size, "%.*s", (int)((i + n < nparams ? params[i + n] - 1 : p) - params[i]), params[i]);
+        i += n - 1;
+      }
+    }
+    s = p + 1;
+  }
+}
+
+/* }}} */
+
+/* filter_highlight -- wrap the --highlight matches in SGR color escapes {{{
+ *
+ * Escape characters in the line are replaced so that only the highlight
+ * escapes are interpreted, unless the filter keeps them (--ansi); then
+ * matches that cut an escape sequence are skipped. Returns 0 and leaves line alone when there is
+ * nothing to change, 1 when line points to the highlighted copy (valid
+ * till the next call) and -1 when out of memory. Overlapping matches go to
+ * the pattern given first. With --ansi the color the input set is set
+ * again after each match.
+ */
+int
+filter_highlight(struct filter *f, char **line, size_t *len)
+{
+  struct { size_t start, end; int color; } spans[MAX_SPANS];
+  int nspans = 0, i, j;
+  size_t n = 0, at = 0;
+  char fg[32] = "39";
+
+  for (i = 0; i < f->npatterns[FILTER_HIGHLIGHT]; i++) {
+    struct pattern *p = &f->patterns[FILTER_HIGHLIGHT][i];
+    size_t from = 0, start, end;
+    while (nspans < MAX_SPANS && from < *len &&
+           pattern_find(p, *line, from, *len, &start, &end)) {
+      int overlaps = 0;
+      if (end == start) {
+        from = start + 1;
+        continue;
+      }
+      for (j = 0; j < nspans && !overlaps; j++)
+        overlaps = start < spans[j].end && spans[j].start < end;
+      if (f->ansi)
+        overlaps |= inside_escape(*line, *len, start) || inside_escape(*line, *len, end);
+      if (!overlaps) {
+        /* Keep the spans sorted */
+        for (j = nspans; j > 0 && spans[j - 1].start > start; j--)
+          spans[j] = spans[j - 1];
+        spans[j].start = start;
+        spans[j].end = end;
+        spans[j].color = p->color;
+        nspans++;
+      }
+      from = end;
+    }
+  }
+  if (nspans == 0 && (f->ansi || memchr(*line, '\033', *len) == NULL))
+    return 0;
+
+  for (i = 0; i < nspans; i++) {
+    char sgr[16], reset[40];
+    int l = snprintf(sgr, sizeof(sgr), "\033[%dm",
+                     spans[i].color < 8 ? 30 + spans[i].color : 90 + spans[i].color - 8);
+    int rl;
+    if (f->ansi)
+      track_foreground(*line + at, *line + spans[i].end, fg, sizeof(fg));
+    rl = snprintf(reset, sizeof(reset), "\033[%sm", fg);
+    if (append_text(f, &n, *line + at, spans[i].start - at) == -1 ||
+        append(f, &n, sgr, l) == -1 ||
+        append_text(f, &n, *line + spans[i].start, spans[i].end - spans[i].start) == -1 ||
+        append(f, &n, reset, rl) == -1)
+      return -1;
+    at = spans[i].end;
+  }
+  if (append_text(f, &n, *line + at, *len - at) == -1)
+    return -1;
+  *line = f->buf;
+  *len = n;
+  return 1;
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
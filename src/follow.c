@@ -0,0 +1,202 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#define _GNU_SOURCE           /* memrchr */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef HAVE_SYS_INOTIFY_H
+#include <sys/inotify.h>
+#endif
+
+#include "osd-cat.h"
+
+/* Size of the window mapped while looking for the tail */
+#define TAIL_WINDOW (1024 * 1024)
+
+/* tail_offset -- offset of the last nlines lines of a regular file {{{
+ *
+ * The file is mapped a window at a time from the end and scanned backwards
+ * for newlines, so only the pages holding the tail are ever read. Returns
+ * -1 if fd is not a regular file or can't be mapped.
+ */
+off_t
+tail_offset(int fd, size_t nlines)
+{
+  struct stat st;
+  long page = sysconf(_SC_PAGESIZE);
+  off_t end, pos;
+  size_t count = 0;
+
+  if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode))
+    return -1;
+  end = pos = st.st_size;
+  while (pos > 0) {
+    off_t start = pos > TAIL_WINDOW ? (pos - TAIL_WINDOW) & ~(off_t)(page - 1) : 0;
+    size_t len = pos - start;
+    char *map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, start);
+    char *p;
+
+    if (map == MAP_FAILED)
+      return -1;
+    p = map + len;
+    /* A newline at the end of the file ends the last line */
+    if (pos == end && p[-1] == '\n')
+      p--;
+    while ((p = memrchr(map, '\n', p - map)) != NULL) {
+      if (++count == nlines) {
+        off_t offset = start + (p - map) + 1;
+        munmap(map, len);
+        return offset;
+      }
+    }
+    munmap(map, len);
+    pos = start;
+  }
+  return 0;
+}
+
+/* }}} */
+
+#ifdef HAVE_SYS_INOTIFY_H
+
+/* follow_init -- watch path for appended data and rotation {{{ */
+int
+follow_init(struct follower *f, const char *path)
+{
+  char *dir;
+
+  memset(f, 0, sizeof(*f));
+  f->dir_wd = -1;
+  if ((f->path = strdup(path)) == NULL || (dir = strdup(path)) == NULL)
+    return -1;
+  f->dir = strdup(dirname(dir));
+  free(dir);
+  f->base = strrchr(f->path, '/') ? strrchr(f->path, '/') + 1 : f->path;
+  if (f->dir == NULL)
+    return -1;
+  if ((f->ifd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) == -1)
+    return -1;
+  f->wd = inotify_add_watch(f->ifd, f->path, IN_MODIFY | IN_MOVE_SELF | IN_DELETE_SELF);
+  return f->wd == -1 ? -1 : 0;
+}
+
+/* }}} */
+
+/* follow_free -- stop watching {{{ */
+void
+follow_free(struct follower *f)
+{
+  if (f->ifd > 0)
+    close(f->ifd);
+  free(f->path);
+  free(f->dir);
+}
+
+/* }}} */
+
+/* check_truncate -- start over if the file was truncated {{{ */
+static void
+check_truncate(int fd, struct line_reader *r)
+{
+  struct stat st;
+  off_t pos = lseek(fd, 0, SEEK_CUR);
+
+  if (pos != -1 && fstat(fd, &st) == 0 && st.st_size < pos) {
+    lseek(fd, 0, SEEK_SET);
+    r->start = r->end = r->scanned = 0;
+  }
+}
+
+/* }}} */
+
+/* follow_event -- handle the pending inotify events {{{
+ *
+ * Returns 1 when there is data to read, 0 when there is nothing to do yet
+ * and -1 on error.
+ */
+int
+follow_event(struct follower *f, struct line_reader *r)
+{
+  char buf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+  int ready = 0;
+  ssize_t n;
+
+  while ((n = read(f->ifd, buf, sizeof(buf))) > 0) {
+    char *p;
+    for (p = buf; p < buf + n; p += sizeof(struct inotify_event) + ((struct inotify_event *)p)->len) {
+      struct inotify_event *e = (struct inotify_event *)p;
+      if (e->wd == f->wd && (e->mask & IN_MODIFY)) {
+        check_truncate(r->fd, r);
+        ready = 1;
+      } else if (e->wd == f->wd && (e->mask & (IN_MOVE_SELF | IN_DELETE_SELF))) {
+        /* Rotated - wait for the file to show up again */
+        f->rotated = 1;
+        if (f->dir_wd == -1)
+          f->dir_wd = inotify_add_watch(f->ifd, f->dir, IN_CREATE | IN_MOVED_TO);
+        ready = 1;
+      } else if (e->wd == f->dir_wd && e->len > 0 && !strcmp(e->name, f->base)) {
+        ready = 1;
+      }
+    }
+  }
+  if (n == -1 && errno != EAGAIN && errno != EINTR)
+    return -1;
+  return ready;
+}
+
+/* }}} */
+
+/* follow_reopen -- switch to the new file after a rotation {{{
+ *
+ * Called when the current file is at its end. The old file is read till
+ * its end first so that nothing written before the rotation is lost.
+ * Returns 1 if the reader now reads the new file.
+ */
+int
+follow_reopen(struct follower *f, struct line_reader *r)
+{
+  int fd;
+
+  if (!f->rotated || (fd = open(f->path, O_RDONLY | O_CLOEXEC)) == -1)
+    return 0;
+  inotify_rm_watch(f->ifd, f->wd);
+  f->wd = inotify_add_watch(f->ifd, f->path, IN_MODIFY | IN_MOVE_SELF | IN_DELETE_SELF);
+  if (f->dir_wd != -1) {
+    inotify_rm_watch(f->ifd, f->dir_wd);
+    f->dir_wd = -1;
+  }
+  f->rotated = 0;
+  close(r->fd);
+  r->fd = fd;
+  return 1;
+}
+
+/* }}} */
+
+#endif
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+#
+# Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+#
+#     This program is free software: you can redistribute it and/or modify
+#     it under the terms of the GNU General Public License as published by
+#     the Free Software Foundation, either version 3 of the License, or
+#     (at your option) any later version.
+#
+#     This program is distributed in the hope that it will be useful,
+#     but WITHOUT ANY WARRANTY; without even the implied warranty of
+#     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#     GNU General Public License for more details.
+#
+#     You should have received a copy of the GNU General Public License
+#     along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# gen-unicode-names.py -- generate unicode-names-data.h from the python UCD
+#
+#   python3 gen-unicode-names.py > unicode-names-data.h
+#
+# Names are split into space separated words. Words are numbered by
+# frequency and every name becomes a list of word tokens (one byte for
+# the 192 most frequent words, two bytes for the rest). Names are sorted
+# and stored front coded in blocks of UNAME_BLOCK: every entry records how
+# many leading tokens it shares with the previous entry. Code points are
+# stored as 3 bytes at the start of a block and as zigzag varint deltas
+# after that. Algorithmically named characters (CJK ideographs, Hangul
+# syllables etc.) are left out and handled in unicode-names.c.
+
+import collections
+import sys
+import unicodedata
+
+BLOCK = 16
+ONE_BYTE = 192
+RANGED = ("CJK UNIFIED IDEOGRAPH-", "CJK COMPATIBILITY IDEOGRAPH-",
+          "TANGUT IDEOGRAPH-", "KHITAN SMALL SCRIPT CHARACTER-",
+          "NUSHU CHARACTER-")
+
+names = []
+ranges = []
+for cp in range(0x110000):
+    name = unicodedata.name(chr(cp), None)
+    if name is None or name.startswith("HANGUL SYLLABLE "):
+        continue
+    prefix = next((p for p in RANGED if name.startswith(p)), None)
+    if prefix is not None:
+        if ranges and ranges[-1][0] == prefix and ranges[-1][2] == cp - 1:
+            ranges[-1][2] = cp
+        else:
+            ranges.append([prefix, cp, cp])
+        continue
+    names.append((name, cp))
+names.sort()
+
+counts = collections.Counter(w for name, _ in names for w in name.split(" "))
+words = [w for w, _ in counts.most_common()]
+index = {w: i for i, w in enumerate(words)}
+assert len(words) < ONE_BYTE + (256 - ONE_BYTE) * 256
+assert max(len(w) for w in words) < 256
+assert max(len(name) for name, _ in names) < 128
+
+
+def token(i):
+    if i < ONE_BYTE:
+        return [i]
+    i -= ONE_BYTE
+    return [ONE_BYTE + (i >> 8), i & 0xff]
+
+
+def varint(v):
+    v = (v << 1) if v >= 0 else ((-v << 1) - 1)
+    out = []
+    while v >= 0x80:
+        out.append(0x80 | (v & 0x7f))
+        v >>= 7
+    out.append(v)
+    return out
+
+
+tokens, codes, block_tokens, block_codes = [], [], [], []
+prev, prev_cp = [], 0
+for n, (name, cp) in enumerate(names):
+    t = [index[w] for w in name.split(" ")]
+    shared = 0
+    if n % BLOCK == 0:
+        block_tokens.append(len(tokens))
+        block_codes.append(len(codes))
+        codes += [cp >> 16, (cp >> 8) & 0xff, cp & 0xff]
+    else:
+        while shared < len(t) and shared < len(prev) and t[shared] == prev[shared]:
+            shared += 1
+        codes += varint(cp - prev_cp)
+    tokens += [shared, len(t) - shared]
+    for i in t[shared:]:
+        tokens += token(i)
+    prev, prev_cp = t, cp
+
+
+def emit_bytes(name, data):
+    out = ["static const unsigned char %s[%d] = {" % (name, len(data))]
+    for i in range(0, len(data), 24):
+        out.append("  " + ",".join(str(b) for b in data[i:i + 24]) + ",")
+    out.append("};\n")
+    return "\n".join(out)
+
+
+def emit_ints(name, data):
+    out = ["static const unsigned int %s[%d] = {" % (name, len(data))]
+    for i in range(0, len(data), 12):
+        out.append("  " + ",".join(str(b) for b in data[i:i + 12]) + ",")
+    out.append("};\n")
+    return "\n".join(out)
+
+
+word_base, offset = [], 0
+for i, w in enumerate(words):
+    if i % 16 == 0:
+        word_base.append(offset)
+    offset += len(w)
+
+w = sys.stdout.write
+w("/* Generated by gen-unicode-names.py from Unicode %s - do not edit */\n\n"
+  % unicodedata.unidata_version)
+w("#define UNAME_BLOCK %d\n" % BLOCK)
+w("#define UNAME_ONE_BYTE %d\n" % ONE_BYTE)
+w("#define UNAME_NAMES %d\n" % len(names))
+w("#define UNAME_WORDS %d\n\n" % len(words))
+w("static const char uname_words[] =\n")
+text = "".join(words)
+for i in range(0, len(text), 76):
+    w('  "%s"\n' % text[i:i + 76])
+w("  ;\n\n")
+w(emit_bytes("uname_word_len", [len(x) for x in words]))
+w(emit_ints("uname_word_base", word_base))
+w(emit_bytes("uname_tokens", tokens))
+w(emit_bytes("uname_codes", codes))
+w(emit_ints("uname_block_tokens", block_tokens))
+w(emit_ints("uname_block_codes", block_codes))
+w("static const struct uname_range {\n"
+  "  const char*   prefix;\n"
+  "  unsigned int  first;\n"
+  "  unsigned int  last;\n"
+  "} uname_ranges[] = {\n")
+for prefix, first, last in ranges:
+    w('  { "%s", 0x%X, 0x%X },\n' % (prefix, first, last))
+w("};\n")
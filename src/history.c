@@ -0,0 +1,174 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "osd-cat.h"
+
+/* history_init -- an empty history of at most capacity lines {{{ */
+int
+history_init(struct history *h, int capacity)
+{
+  memset(h, 0, sizeof(*h));
+  h->capacity = capacity;
+  h->top = -1;
+  h->size = READ_BLOCK;
+  h->arena = malloc(h->size);
+  /* One more offset marks the end of the last line */
+  h->index = malloc((capacity + 1) * sizeof(size_t));
+  if (h->arena == NULL || h->index == NULL)
+    return -1;
+  h->index[0] = 0;
+  return 0;
+}
+
+/* }}} */
+
+/* history_free -- free a history {{{ */
+void
+history_free(struct history *h)
+{
+  free(h->arena);
+  free(h->index);
+  h->arena = NULL;
+  h->index = NULL;
+}
+
+/* }}} */
+
+/* drop -- forget the oldest half of the lines {{{
+ *
+ * Moving half the history at a time keeps adding a line O(1) amortized.
+ */
+static void
+drop(struct history *h)
+{
+  int n = h->count / 2 > 0 ? h->count / 2 : h->count;
+  size_t base = h->index[n];
+  int i;
+
+  memmove(h->arena, h->arena + base, h->index[h->count] - base);
+  for (i = n; i <= h->count; i++)
+    h->index[i - n] = h->index[i] - base;
+  h->count -= n;
+  h->dropped += n;
+}
+
+/* }}} */
+
+/* history_add -- append a line {{{ */
+int
+history_add(struct history *h, const char *text, size_t len)
+{
+  size_t used;
+
+  if (h->count == h->capacity)
+    drop(h);
+  used = h->index[h->count];
+  if (used + len > h->size) {
+    size_t size = h->size;
+    char *arena;
+    while (size < used + len)
+      size *= 2;
+    if ((arena = realloc(h->arena, size)) == NULL)
+      return -1;
+    h->arena = arena;
+    h->size = size;
+  }
+  memcpy(h->arena + used, text, len);
+  h->index[++h->count] = used + len;
+  return 0;
+}
+
+/* }}} */
+
+/* history_line -- line i of the history, counting from the oldest kept {{{ */
+const char *
+history_line(struct history *h, int i, size_t *len)
+{
+  *len = h->index[i + 1] - h->index[i];
+  return h->arena + h->index[i];
+}
+
+/* }}} */
+
+/* history_first -- the first of the nlines lines in view {{{
+ *
+ * Following, the view is the newest lines. Scrolled back, it stays on the
+ * same lines as new ones are added, unless they are dropped.
+ */
+int
+history_first(struct history *h, int nlines)
+{
+  long long first;
+
+  if (h->top == -1)
+    first = h->count - nlines;
+  else
+    first = h->top - h->dropped;
+  return first < 0 ? 0 : first;
+}
+
+/* }}} */
+
+/* history_command -- scroll the view {{{
+ *
+ * Commands are up [n], down [n], page-up, page-down, top and bottom (back
+ * to following the input). Returns 1 when the view changed, 0 when it did
+ * not and -1 for an unknown command.
+ */
+int
+history_command(struct history *h, const char *cmd, int nlines)
+{
+  long long first = history_first(h, nlines), top;
+  int n = 1;
+  const char *arg = strchr(cmd, ' ');
+
+  if (arg != NULL && atoi(arg + 1) > 0)
+    n = atoi(arg + 1);
+  if (!strncmp(cmd, "page-", 5)) {
+    n = nlines;
+    cmd += 5;
+  }
+  if (!strncmp(cmd, "up", 2))
+    first -= n;
+  else if (!strncmp(cmd, "down", 4))
+    first += n;
+  else if (!strcmp(cmd, "top"))
+    first = 0;
+  else if (!strcmp(cmd, "bottom"))
+    first = h->count;
+  else
+    return -1;
+  if (first < 0)
+    first = 0;
+  /* At the bottom the view follows the input again */
+  top = first >= h->count - nlines ? -1 : h->dropped + first;
+  if (top == h->top)
+    return 0;
+  h->top = top;
+  return 1;
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
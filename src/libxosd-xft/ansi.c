@@ -0,0 +1,277 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include "intern.h"
+
+/* The xterm defaults for the 16 ANSI colors */
+static const unsigned char ansi_rgb[16][3] = {
+  {   0,   0,   0 }, { 205,   0,   0 }, {   0, 205,   0 }, { 205, 205,   0 },
+  {   0,   0, 238 }, { 205,   0, 205 }, {   0, 205, 205 }, { 229, 229, 229 },
+  { 127, 127, 127 }, { 255,   0,   0 }, {   0, 255,   0 }, { 255, 255,   0 },
+  {  92,  92, 255 }, { 255,   0, 255 }, {   0, 255, 255 }, { 255, 255, 255 }
+};
+
+/* Levels of the 6x6x6 color cube (16-231) */
+static const unsigned char cube[6] = { 0, 95, 135, 175, 215, 255 };
+
+/* palette_rgb -- the color of a palette index {{{ */
+static void
+palette_rgb(int i, unsigned char rgb[3])
+{
+  if (i < 16) {
+    memcpy(rgb, ansi_rgb[i], 3);
+  } else if (i < 232) {
+    i -= 16;
+    rgb[0] = cube[i / 36];
+    rgb[1] = cube[i / 6 % 6];
+    rgb[2] = cube[i % 6];
+  } else {
+    /* Gray ramp 232-255 */
+    rgb[0] = rgb[1] = rgb[2] = 8 + (i - 232) * 10;
+  }
+}
+
+/* }}} */
+
+/* nearest -- the palette index closest to a 24 bit color {{{
+ *
+ * Direct colors map onto the cube or the gray ramp, so no color is ever
+ * allocated while drawing.
+ */
+static int
+nearest(int r, int g, int b)
+{
+  int ci[3], c[3] = { r, g, b }, i, gray, gi, dc = 0, dg = 0;
+
+  for (i = 0; i < 3; i++) {
+    ci[i] = c[i] < 48 ? 0 : c[i] < 115 ? 1 : (c[i] - 35) / 40;
+    dc += (c[i] - cube[ci[i]]) * (c[i] - cube[ci[i]]);
+  }
+  gray = (r + g + b) / 3;
+  gi = gray > 238 ? 23 : gray < 8 ? 0 : (gray - 3) / 10;
+  for (i = 0; i < 3; i++)
+    dg += (c[i] - (8 + gi * 10)) * (c[i] - (8 + gi * 10));
+  return dg < dc ? 232 + gi : 16 + ci[0] * 36 + ci[1] * 6 + ci[2];
+}
+
+/* }}} */
+
+/* init_palette -- allocate the palette colors once {{{
+ *
+ * With a TrueColor visual XftColorAllocValue computes the pixel locally,
+ * so the 256 colors cost no round trips.
+ */
+int
+init_palette(xosd_xft *osd)
+{
+  FUNCTION_START();
+  int i;
+  for (i = 0; i < ANSI_COLORS; i++) {
+    unsigned char rgb[3];
+    XRenderColor c;
+    palette_rgb(i, rgb);
+    c.red = rgb[0] * 0x101;
+    c.green = rgb[1] * 0x101;
+    c.blue = rgb[2] * 0x101;
+    c.alpha = 0xffff;
+    if (!XftColorAllocValue(osd->display, osd->visual, osd->colormap, &c, &osd->palette[i])) {
+      while (--i >= 0)
+        XftColorFree(osd->display, osd->visual, osd->colormap, &osd->palette[i]);
+      FUNCTION_END();
+      fail(-1, "Could not allocate palette color");
+    }
+  }
+  FUNCTION_END();
+  return 0;
+}
+
+/* }}} */
+
+/* free_palette -- free the palette colors {{{ */
+void
+free_palette(xosd_xft *osd)
+{
+  int i;
+  for (i = 0; i < ANSI_COLORS; i++)
+    XftColorFree(osd->display, osd->visual, osd->colormap, &osd->palette[i]);
+}
+
+/* }}} */
+
+/* next_param -- the next SGR parameter, ';' or ':' separated {{{ */
+static const char *
+next_param(const char *p, const char *end, int *n)
+{
+  *n = 0;
+  while (p < end && *p >= '0' && *p <= '9')
+    *n = *n * 10 + *p++ - '0';
+  return p < end ? p + 1 : end;
+}
+
+/* }}} */
+
+/* extended_color -- 5;n or 2;r;g;b after 38 or 48 {{{ */
+static const char *
+extended_color(const char *p, const char *end, int *color)
+{
+  int mode, r, g, b;
+  p = next_param(p, end, &mode);
+  if (mode == 5) {
+    p = next_param(p, end, &r);
+    if (r < ANSI_COLORS)
+      *color = r;
+  } else if (mode == 2) {
+    p = next_param(p, end, &r);
+    p = next_param(p, end, &g);
+    p = next_param(p, end, &b);
+    *color = nearest(r & 0xff, g & 0xff, b & 0xff);
+  }
+  return p;
+}
+
+/* }}} */
+
+/* apply_sgr -- update the attributes from the parameters of an SGR {{{ */
+static void
+apply_sgr(const char *p, const char *end, osd_run *attr)
+{
+  if (p == end) {
+    attr->fg = attr->bg = -1;
+    attr->flags = 0;
+    return;
+  }
+  while (p < end) {
+    int n;
+    p = next_param(p, end, &n);
+    if (n == 0) {
+      attr->fg = attr->bg = -1;
+      attr->flags = 0;
+    } else if (n == 1)
+      attr->flags |= ANSI_BOLD;
+    else if (n == 22)
+      attr->flags &= ~ANSI_BOLD;
+    else if (n == 7)
+      attr->flags |= ANSI_REVERSE;
+    else if (n == 27)
+      attr->flags &= ~ANSI_REVERSE;
+    else if (n >= 30 && n <= 37)
+      attr->fg = n - 30;
+    else if (n == 38)
+      p = extended_color(p, end, &attr->fg);
+    else if (n == 39)
+      attr->fg = -1;
+    else if (n >= 40 && n <= 47)
+      attr->bg = n - 40;
+    else if (n == 48)
+      p = extended_color(p, end, &attr->bg);
+    else if (n == 49)
+      attr->bg = -1;
+    else if (n >= 90 && n <= 97)
+      attr->fg = n - 90 + 8;
+    else if (n >= 100 && n <= 107)
+      attr->bg = n - 100 + 8;
+  }
+}
+
+/* }}} */
+
+/* add_run -- add text from start to end drawn with attr {{{ */
+static void
+add_run(osd_run *runs, int *nruns, int start, int end, const osd_run *attr)
+{
+  osd_run *last = *nruns > 0 ? &runs[*nruns - 1] : NULL;
+  if (end == start)
+    return;
+  if (last != NULL && last->fg == attr->fg && last->bg == attr->bg &&
+      last->flags == attr->flags) {
+    last->len += end - start;
+    return;
+  }
+  runs[*nruns] = *attr;
+  runs[*nruns].start = start;
+  runs[*nruns].len = end - start;
+  (*nruns)++;
+}
+
+/* }}} */
+
+/* ansi_sanitize -- utf8_sanitize interpreting SGR escape sequences {{{
+ *
+ * The text between the escapes is sanitized into dest and the attributes
+ * set by the escapes are returned as runs covering the whole line. Other CSI
+ * sequences are dropped. Lines without escapes get no runs. dest must have
+ * room for UTF8_SANITIZE_SIZE(len) bytes. Returns the length of the text
+ * or -1 when out of memory.
+ */
+int
+ansi_sanitize(const char *src, size_t len, char *dest, osd_run **runs, int *nruns)
+{
+  const char *s = src, *end = src + len, *esc;
+  osd_run attr = { 0, 0, -1, -1, 0 };
+  int o = 0, n = 0;
+
+  *runs = NULL;
+  *nruns = 0;
+  if ((esc = memchr(s, '\033', len)) == NULL)
+    return utf8_sanitize(src, len, dest);
+  /* Every escape can start two runs */
+  for (; esc != NULL; esc = memchr(esc + 1, '\033', end - esc - 1))
+    n++;
+  if ((*runs = malloc((2 * n + 1) * sizeof(osd_run))) == NULL)
+    return -1;
+
+  while (s < end) {
+    const char *p, *params;
+    int start = o;
+    esc = memchr(s, '\033', end - s);
+    if (esc == NULL)
+      esc = end;
+    o += utf8_sanitize(s, esc - s, dest + o);
+    add_run(*runs, nruns, start, o, &attr);
+    if (esc == end)
+      break;
+    /* CSI: ESC [ parameters intermediates final */
+    p = params = esc + 2;
+    if (esc + 1 < end && esc[1] == '[') {
+      while (p < end && *p >= 0x30 && *p <= 0x3f)
+        p++;
+      while (p < end && *p >= 0x20 && *p <= 0x2f)
+        p++;
+    }
+    if (esc + 1 >= end || esc[1] != '[' || p >= end || *p < 0x40 || *p > 0x7e) {
+      /* Not a complete CSI - show the escape */
+      start = o;
+      o += utf8_sanitize(esc, 1, dest + o);
+      add_run(*runs, nruns, start, o, &attr);
+      s = esc + 1;
+      continue;
+    }
+    if (*p == 'm')
+      apply_sgr(params, p, &attr);
+    s = p + 1;
+  }
+  dest[o] = '\0';
+  return o;
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
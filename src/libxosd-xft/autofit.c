@@ -0,0 +1,159 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include "intern.h"
+
+/* hash -- FNV-1a of the lines {{{ */
+static uint32_t
+hash(osd_line *lines, int nlines)
+{
+  uint32_t h = 2166136261u;
+  int i, j;
+
+  for (i = 0; i < nlines; i++) {
+    for (j = 0; j < lines[i].len; j++)
+      h = (h ^ (unsigned char)lines[i].text[j]) * 16777619u;
+    h = (h ^ '\n') * 16777619u;
+  }
+  return h;
+}
+
+/* }}} */
+
+/* measure -- the size the lines take with the font in use {{{ */
+static void
+measure(xosd_xft *osd, int *width, int *height)
+{
+  int i, n = osd->settings.maxlines > 1 ? osd->settings.maxlines : 1;
+
+  *width = 0;
+  for (i = 0; i < osd->settings.nlines; i++) {
+    XGlyphInfo extents;
+    if (osd->settings.lines[i].len == 0)
+      continue;
+    line_extents(osd, &osd->settings.lines[i], &extents);
+    if (extents.width > *width)
+      *width = extents.width;
+  }
+  *height = n * (osd->font->metrics.ascent + osd->font->metrics.descent);
+}
+
+/* }}} */
+
+/* set_size -- switch to the font at a size in points {{{ */
+static int
+set_size(xosd_xft *osd, int pt)
+{
+  FcPattern *pattern = FcNameParse((const FcChar8 *)osd->settings.fontname);
+  FcChar8 *name;
+  int r = -1;
+
+  if (pattern == NULL)
+    return -1;
+  FcPatternDel(pattern, FC_SIZE);
+  FcPatternDel(pattern, FC_PIXEL_SIZE);
+  FcPatternAddDouble(pattern, FC_SIZE, pt);
+  if ((name = FcNameUnparse(pattern)) != NULL) {
+    r = set_font(osd, (const char *)name);
+    free(name);
+  }
+  FcPatternDestroy(pattern);
+  return r;
+}
+
+/* }}} */
+
+/* fit -- the largest size the lines fit in the text area at {{{
+ *
+ * The lines are measured once with the font as set, the size it is scaled
+ * by the space left over is then confirmed with the font opened at it, and
+ * one size smaller if they do not fit after all (hinting does not scale
+ * exactly).
+ */
+static int
+fit(xosd_xft *osd)
+{
+  int min = osd->settings.autofit_min, max = osd->settings.autofit_max;
+  int width, height, pt;
+  double size, scale, pixel_size, dpi;
+
+  if (set_font(osd, osd->settings.fontname) == -1)
+    return -1;
+  if (FcPatternGetDouble(osd->font->xft->pattern, FC_SIZE, 0, &size) != FcResultMatch) {
+    if (FcPatternGetDouble(osd->font->xft->pattern, FC_PIXEL_SIZE, 0, &pixel_size) != FcResultMatch)
+      pixel_size = osd->font->xft->height;
+    if (FcPatternGetDouble(osd->font->xft->pattern, FC_DPI, 0, &dpi) != FcResultMatch)
+      dpi = 75;
+    size = pixel_size * 72 / dpi;
+  }
+  measure(osd, &width, &height);
+  scale = height > 0 ? (double)osd->t_height / height : 1;
+  if (width > 0 && (double)osd->t_width / width < scale)
+    scale = (double)osd->t_width / width;
+  pt = size * scale;
+  pt = pt < min ? min : pt > max ? max : pt;
+  if (set_size(osd, pt) == -1)
+    return -1;
+  measure(osd, &width, &height);
+  if (pt > min && (width > (int)osd->t_width || height > (int)osd->t_height)) {
+    if (set_size(osd, --pt) == -1)
+      return -1;
+  }
+  DEBUG_MSG(Dvalue, "Autofit { size = %g, scale = %g, pt = %d }", size, scale, pt);
+  return pt;
+}
+
+/* }}} */
+
+/* autofit -- switch to the size the lines fit at (called with lock held) {{{
+ *
+ * The size is cached for the text and the text area, so redrawing or
+ * showing the same text again does not measure it.
+ */
+void
+autofit(xosd_xft *osd)
+{
+  FUNCTION_START();
+  uint32_t h = hash(osd->settings.lines, osd->settings.nlines);
+  osd_fit *entry = &osd->fits[h % AUTOFIT_CACHE_SIZE];
+  int pt;
+
+  if (entry->pt != 0 && entry->hash == h &&
+      entry->width == osd->t_width && entry->height == osd->t_height) {
+    pt = entry->pt;
+    if (pt != osd->autofit_pt && set_size(osd, pt) == -1)
+      pt = -1;
+  } else if ((pt = fit(osd)) != -1) {
+    entry->hash = h;
+    entry->width = osd->t_width;
+    entry->height = osd->t_height;
+    entry->pt = pt;
+  }
+  if (pt == -1)
+    fprintf(stderr, "Error in fitting font %s: %s (ignoring)\n", osd->settings.fontname, osd_error);
+  osd->autofit_pt = pt;
+  osd->line_height = osd->font->metrics.ascent + osd->font->metrics.descent;
+  FUNCTION_END();
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
@@ -0,0 +1,257 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include "intern.h"
+
+/* color_font -- does the font have colour glyphs (emoji) {{{
+ *
+ * Bitmap strikes (CBDT, sbix) come at the size of the strike Xft picked,
+ * scale is set to what they are drawn scaled by for the font size.
+ */
+int
+color_font(xosd_xft *osd, XftFont *font, double *scale)
+{
+  int color = 0;
+#ifdef FT_LOAD_COLOR
+  FT_Face face = XftLockFace(font);
+  double pixel_size;
+
+  if (scale != NULL)
+    *scale = 1;
+  if (face == NULL)
+    return 0;
+  color = FT_HAS_COLOR(face);
+  if (color && scale != NULL && !FT_IS_SCALABLE(face) && face->size->metrics.y_ppem > 0 &&
+      FcPatternGetDouble(font->pattern, FC_PIXEL_SIZE, 0, &pixel_size) == FcResultMatch)
+    *scale = pixel_size / face->size->metrics.y_ppem;
+  XftUnlockFace(font);
+#else
+  if (scale != NULL)
+    *scale = 1;
+#endif
+  return color;
+}
+
+/* }}} */
+
+/* upload -- a premultiplied BGRA bitmap as a Picture on the server {{{ */
+static Picture
+upload(xosd_xft *osd, const FT_Bitmap *bitmap, double scale)
+{
+  XRenderPictFormat *format = XRenderFindStandardFormat(osd->display, PictStandardARGB32);
+  unsigned int w = bitmap->width, h = bitmap->rows, row;
+  Picture picture;
+  XImage *image;
+  Pixmap pixmap;
+  char *data;
+  GC gc;
+
+  if (format == NULL || (data = malloc(w * h * 4)) == NULL)
+    return None;
+  for (row = 0; row < h; row++)
+    memcpy(data + row * w * 4, bitmap->buffer + row * bitmap->pitch, w * 4);
+  if ((image = XCreateImage(osd->display, NULL, 32, ZPixmap, 0, data, w, h, 32, w * 4)) == NULL) {
+    free(data);
+    return None;
+  }
+  /* BGRA bytes are ARGB32 read as a little endian word, Xlib swaps for the server */
+  image->byte_order = LSBFirst;
+  pixmap = XCreatePixmap(osd->display, RootWindow(osd->display, osd->screen), w, h, 32);
+  gc = XCreateGC(osd->display, pixmap, 0, NULL);
+  XPutImage(osd->display, pixmap, gc, image, 0, 0, 0, 0, w, h);
+  XFreeGC(osd->display, gc);
+  XDestroyImage(image);
+  picture = XRenderCreatePicture(osd->display, pixmap, format, 0, NULL);
+  XFreePixmap(osd->display, pixmap);
+  if (scale != 1) {
+    XTransform t = {{
+      { XDoubleToFixed(1 / scale), 0, 0 },
+      { 0, XDoubleToFixed(1 / scale), 0 },
+      { 0, 0, XDoubleToFixed(1) }
+    }};
+    XRenderSetPictureTransform(osd->display, picture, &t);
+    XRenderSetPictureFilter(osd->display, picture, FilterBilinear, NULL, 0);
+  }
+  return picture;
+}
+
+/* }}} */
+
+/* rasterize -- render a glyph in colour and upload it, -1 on error {{{ */
+static int
+rasterize(xosd_xft *osd, osd_color_glyph *g, double scale)
+{
+  int ret = -1;
+#ifdef FT_LOAD_COLOR
+  FT_Face face = XftLockFace(g->font);
+  FT_GlyphSlot slot;
+
+  if (face == NULL)
+    return -1;
+  slot = face->glyph;
+  if (FT_Load_Glyph(face, g->glyph, FT_LOAD_COLOR) == 0 &&
+      (slot->format == FT_GLYPH_FORMAT_BITMAP || FT_Render_Glyph(slot, FT_RENDER_MODE_NORMAL) == 0)) {
+    g->info.width = (unsigned short)(slot->bitmap.width * scale + 0.999);
+    g->info.height = (unsigned short)(slot->bitmap.rows * scale + 0.999);
+    g->info.x = (short)-(int)(slot->bitmap_left * scale + 0.5);
+    g->info.y = (short)(int)(slot->bitmap_top * scale + 0.5);
+    g->info.xOff = (short)(int)(slot->advance.x * scale / 64 + 0.5);
+    g->info.yOff = 0;
+    /* The glyphs of a colour font that are not in colour Xft draws */
+    if (slot->bitmap.pixel_mode == FT_PIXEL_MODE_BGRA && slot->bitmap.width > 0 && slot->bitmap.rows > 0)
+      g->picture = upload(osd, &slot->bitmap, scale);
+    ret = 0;
+  }
+  XftUnlockFace(g->font);
+#endif
+  return ret;
+}
+
+/* }}} */
+
+/* free_color_glyph -- empty an entry of the colour glyph cache {{{ */
+static void
+free_color_glyph(xosd_xft *osd, osd_color_glyph *g)
+{
+  if (g->picture != None)
+    XRenderFreePicture(osd->display, g->picture);
+  memset(g, 0, sizeof(*g));
+}
+
+/* }}} */
+
+/* color_glyph -- a glyph of a colour font, rasterized once {{{
+ *
+ * The glyphs are kept on the server, the least recently used one is freed
+ * for a new one. Returns NULL when the glyph cannot be loaded.
+ */
+osd_color_glyph *
+color_glyph(xosd_xft *osd, XftFont *font, FT_UInt glyph)
+{
+  osd_color_glyph *g = NULL;
+  double scale;
+  int i;
+
+  for (i = 0; i < COLOR_CACHE_SIZE; i++) {
+    osd_color_glyph *c = &osd->color_glyphs[i];
+    if (c->font == font && c->glyph == glyph) {
+      c->used = ++osd->color_clock;
+      return c;
+    }
+    if (g == NULL || (g->font != NULL && (c->font == NULL || c->used < g->used)))
+      g = c;
+  }
+  free_color_glyph(osd, g);
+  color_font(osd, font, &scale);
+  g->font = font;
+  g->glyph = glyph;
+  if (rasterize(osd, g, scale) == -1) {
+    free_color_glyph(osd, g);
+    return NULL;
+  }
+  g->used = ++osd->color_clock;
+  DEBUG_MSG(Dtrace, "ColorGlyph { glyph = %u, width = %d, height = %d, scale = %g }",
+      glyph, g->info.width, g->info.height, scale);
+  return g;
+}
+
+/* }}} */
+
+/* draw_color_glyph -- composite a colour glyph at x, y {{{
+ *
+ * In the shadow color only the shape of the glyph is drawn.
+ */
+void
+draw_color_glyph(xosd_xft *osd, XftColor *color, osd_color_glyph *g, int x, int y)
+{
+  Picture dst = XftDrawPicture(osd->draw), src = g->picture, mask = None;
+
+  if (dst == None || src == None)
+    return;
+  if (color == &osd->shadow_color) {
+    mask = src;
+    src = XRenderCreateSolidFill(osd->display, &color->color);
+  }
+  XRenderComposite(osd->display, PictOpOver, src, mask, dst, 0, 0, 0, 0,
+      x - g->info.x, y - g->info.y, g->info.width, g->info.height);
+  if (mask != None)
+    XRenderFreePicture(osd->display, src);
+}
+
+/* }}} */
+
+/* color_text -- extents of text in a colour font, drawn when color is set {{{ */
+void
+color_text(xosd_xft *osd, XftColor *color, XftFont *font, int x, int y, const char *text, int len, XGlyphInfo *extents)
+{
+  const FcChar8 *s = (const FcChar8 *)text;
+  osd_box box = { 0, 0, 0, 0, 1 };
+  int pen = 0;
+
+  while (len > 0) {
+    osd_color_glyph *g;
+    XGlyphInfo info;
+    FT_UInt glyph;
+    FcChar32 c;
+    int l = FcUtf8ToUcs4(s, &c, len);
+    if (l <= 0) {
+      l = 1;
+      c = 0xfffd;
+    }
+    glyph = XftCharIndex(osd->display, font, c);
+    if ((g = color_glyph(osd, font, glyph)) != NULL)
+      info = g->info;
+    else
+      XftGlyphExtents(osd->display, font, &glyph, 1, &info);
+    if (color != NULL) {
+      if (g != NULL && g->picture != None)
+        draw_color_glyph(osd, color, g, x + pen, y);
+      else {
+        touch_glyph(osd, font, glyph);
+        XftDrawGlyphs(osd->draw, color, font, x + pen, y, &glyph, 1);
+      }
+    }
+    extend(&box, pen, 0, &info);
+    pen += info.xOff;
+    s += l;
+    len -= l;
+  }
+  box_extents(&box, pen, 0, extents);
+}
+
+/* }}} */
+
+/* free_color -- empty the colour glyph cache {{{
+ *
+ * Called when a font closes, the entries point to it.
+ */
+void
+free_color(xosd_xft *osd)
+{
+  int i;
+
+  for (i = 0; i < COLOR_CACHE_SIZE; i++)
+    free_color_glyph(osd, &osd->color_glyphs[i]);
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
@@ -0,0 +1,426 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include "intern.h"
+
+/* init_fallbacks -- the fallback fonts from the families of the font name {{{
+ *
+ * For "mono,Symbols Nerd Font,Noto Sans CJK JP:size=12" the font is matched
+ * from the whole name, the fallbacks from each of the other families with
+ * the rest of the name.
+ */
+static int
+init_fallbacks(osd_font *f, FcPattern *pattern)
+{
+  FcChar8 *family;
+  int i, n = 0;
+
+  while (FcPatternGetString(pattern, FC_FAMILY, n, &family) == FcResultMatch)
+    n++;
+  if (n > FALLBACK_MAX + 1)
+    n = FALLBACK_MAX + 1;
+  if (n <= 1)
+    return 0;
+  f->fallbacks = calloc(n - 1, sizeof(osd_fallback));
+  f->pages = calloc(FONT_PAGES, sizeof(unsigned char *));
+  if (f->fallbacks == NULL || f->pages == NULL)
+    fail(-1, "Could not allocate memory");
+  for (i = 1; i < n; i++) {
+    FcPattern *fallback = FcPatternDuplicate(pattern);
+    if (fallback == NULL)
+      continue;
+    FcPatternGetString(pattern, FC_FAMILY, i, &family);
+    FcPatternDel(fallback, FC_FAMILY);
+    FcPatternAddString(fallback, FC_FAMILY, family);
+    f->fallbacks[f->nfallbacks++].pattern = fallback;
+    DEBUG_MSG(Dvalue, "Fallback { family = %s }", family);
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* free_font -- close a font and its fallbacks, freeing its cache slot {{{ */
+static void
+free_font(xosd_xft *osd, osd_font *f)
+{
+  int i;
+
+  for (i = 0; i < f->nfallbacks; i++) {
+    osd_fallback *fb = &f->fallbacks[i];
+    if (fb->font != NULL) {
+      forget_glyphs(osd, fb->font);
+      XftFontClose(osd->display, fb->font);
+    }
+    else if (fb->pattern != NULL)
+      FcPatternDestroy(fb->pattern);
+    if (fb->charset != NULL)
+      FcCharSetDestroy(fb->charset);
+  }
+  if (f->pages != NULL)
+    for (i = 0; i < FONT_PAGES; i++)
+      free(f->pages[i]);
+  free(f->pages);
+  free(f->fallbacks);
+  if (f->bold != NULL && f->bold != f->xft) {
+    forget_glyphs(osd, f->bold);
+    XftFontClose(osd->display, f->bold);
+  }
+  if (f->xft != NULL) {
+    forget_glyphs(osd, f->xft);
+    XftFontClose(osd->display, f->xft);
+  }
+  free(f->name);
+  if (f->xft != NULL) {
+#ifdef HAVE_HARFBUZZ
+    /* The shaped text may have glyphs of the fonts */
+    free_shaped(osd);
+#endif
+    free_color(osd);
+  }
+  memset(f, 0, sizeof(*f));
+}
+
+/* }}} */
+
+/* victim -- a free cache slot, else the least recently used font {{{ */
+static osd_font *
+victim(xosd_xft *osd)
+{
+  osd_font *f = NULL;
+  int i;
+
+  for (i = 0; i < FONT_CACHE_SIZE; i++) {
+    osd_font *c = &osd->fonts[i];
+    if (c->name == NULL)
+      return c;
+    /* Not the one in use, it may be drawing with */
+    if (c != osd->font && (f == NULL || c->used < f->used))
+      f = c;
+  }
+  return f;
+}
+
+/* }}} */
+
+/* set_font -- make a font the one in use, opening it if not open {{{
+ *
+ * Fonts are looked up by their name as fontconfig writes it back after
+ * parsing, so switching back to a recently used font does no matching and
+ * keeps the glyphs already loaded. Called from the event thread once the
+ * OSD is initialized.
+ */
+int
+set_font(xosd_xft *osd, const char *name)
+{
+  FUNCTION_START();
+  FcPattern *pattern = FcNameParse((const FcChar8 *)name);
+  FcChar8 *key = NULL;
+  osd_font *f;
+  double dpi;
+  int i;
+
+  /* At the DPI of the monitor, in place of Xft.dpi rather than on top of
+   * it, unless the name sets one. The DPI is part of the name in the cache */
+  if (pattern != NULL && osd->font_dpi > 0 &&
+      FcPatternGetDouble(pattern, FC_DPI, 0, &dpi) != FcResultMatch)
+    FcPatternAddDouble(pattern, FC_DPI, osd->font_dpi);
+  if (pattern == NULL || (key = FcNameUnparse(pattern)) == NULL) {
+    if (pattern != NULL)
+      FcPatternDestroy(pattern);
+    FUNCTION_END();
+    fail(-1, "Could not parse font name");
+  }
+  for (i = 0; i < FONT_CACHE_SIZE; i++)
+    if (osd->fonts[i].name != NULL && !strcmp(osd->fonts[i].name, (const char *)key))
+      break;
+  if (i < FONT_CACHE_SIZE) {
+    DEBUG_MSG(Dtrace, "Font %s from the cache", key);
+    f = &osd->fonts[i];
+    free(key);
+  } else {
+    f = victim(osd);
+    free_font(osd, f);
+    if ((f->xft = open_font(osd, pattern, (const char *)key)) == NULL) {
+      FcPatternDestroy(pattern);
+      free(key);
+      FUNCTION_END();
+      fail(-1, "Could not open font");
+    }
+    f->name = (char *)key;
+    DEBUG_MSG(Dvalue, "XftFont { name = %s, ascent = %d, descent = %d, height = %d, max_advance_width = %d }",
+        f->name, f->xft->ascent, f->xft->descent, f->xft->height, f->xft->max_advance_width);
+    init_metrics(osd, &f->metrics, f->xft);
+    if (init_fallbacks(f, pattern) == -1) {
+      free_font(osd, f);
+      FcPatternDestroy(pattern);
+      FUNCTION_END();
+      return -1;
+    }
+  }
+  FcPatternDestroy(pattern);
+  f->used = ++osd->font_clock;
+  osd->font = f;
+  FUNCTION_END();
+  return 0;
+}
+
+/* }}} */
+
+/* default_dpi -- the DPI Xft opens fonts at, from Xft.dpi or the screen {{{ */
+static double
+default_dpi(xosd_xft *osd)
+{
+  FcPattern *pattern = FcPatternCreate();
+  double dpi = 75;
+
+  if (pattern != NULL) {
+    XftDefaultSubstitute(osd->display, osd->screen, pattern);
+    FcPatternGetDouble(pattern, FC_DPI, 0, &dpi);
+    FcPatternDestroy(pattern);
+  }
+  return dpi;
+}
+
+/* }}} */
+
+/* init_monitor -- choose the monitor and the font DPI for it {{{
+ *
+ * Returns 1 when the DPI changed. Fonts already opened at a DPI stay in the
+ * cache, so moving back to a monitor opens nothing. The DPI only replaces
+ * Xft.dpi when, rounded, it is denser than 96 and than Xft.dpi.
+ */
+int
+init_monitor(xosd_xft *osd)
+{
+  double dpi, font_dpi = 0;
+
+  osd_init_monitor(osd->display, osd->screen, osd->settings.monitor,
+                   osd->settings.use_xrandr, osd->settings.use_xinerama,
+                   &osd->screen_width, &osd->screen_height,
+                   &osd->screen_xpos, &osd->screen_ypos, &dpi);
+  if (dpi > BASE_DPI)
+    font_dpi = BASE_DPI * (int)(dpi / BASE_DPI * SCALE_STEPS + 0.5) / SCALE_STEPS;
+  if (font_dpi <= BASE_DPI || font_dpi <= default_dpi(osd))
+    font_dpi = 0;
+  DEBUG_MSG(Dvalue, "FontDPI { dpi = %g, font_dpi = %g }", dpi, font_dpi);
+  if (font_dpi == osd->font_dpi)
+    return 0;
+  osd->font_dpi = font_dpi;
+  return 1;
+}
+
+/* }}} */
+
+/* close_fonts -- close all the open fonts {{{ */
+void
+close_fonts(xosd_xft *osd)
+{
+  int i;
+
+  for (i = 0; i < FONT_CACHE_SIZE; i++)
+    free_font(osd, &osd->fonts[i]);
+  osd->font = NULL;
+}
+
+/* }}} */
+
+/* bold_font -- the bold variant of the font, opened on first use {{{ */
+XftFont *
+bold_font(xosd_xft *osd)
+{
+  osd_font *f = osd->font;
+
+  if (f->bold == NULL) {
+    FcPattern *pattern = FcNameParse((const FcChar8 *)f->name), *match;
+    FcResult result;
+    f->bold = f->xft;
+    if (pattern == NULL)
+      return f->xft;
+    FcPatternDel(pattern, FC_WEIGHT);
+    FcPatternAddInteger(pattern, FC_WEIGHT, FC_WEIGHT_BOLD);
+    if ((match = XftFontMatch(osd->display, osd->screen, pattern, &result)) != NULL &&
+        (f->bold = XftFontOpenPattern(osd->display, match)) == NULL) {
+      FcPatternDestroy(match);
+      f->bold = f->xft;
+    }
+    FcPatternDestroy(pattern);
+  }
+  return f->bold;
+}
+
+/* }}} */
+
+/* covers -- does a fallback have the character, matching it on first use {{{ */
+static int
+covers(xosd_xft *osd, osd_fallback *fb, FcChar32 c)
+{
+  if (!fb->matched) {
+    FcResult result;
+    FcPattern *match = XftFontMatch(osd->display, osd->screen, fb->pattern, &result);
+    FcPatternDestroy(fb->pattern);
+    fb->pattern = match;
+    fb->matched = 1;
+    /* A reference of its own, Xft may destroy the match when opening it */
+    if (match == NULL || FcPatternGetCharSet(match, FC_CHARSET, 0, &fb->charset) != FcResultMatch)
+      fb->charset = NULL;
+    else
+      fb->charset = FcCharSetCopy(fb->charset);
+  }
+  return fb->charset != NULL && FcCharSetHasChar(fb->charset, c);
+}
+
+/* }}} */
+
+/* font_index -- the font of a character, looked up once {{{ */
+static int
+font_index(xosd_xft *osd, osd_font *f, FcChar32 c)
+{
+  unsigned char **page, *index;
+  int i;
+
+  if (c >= 0x110000)
+    return 1;
+  page = &f->pages[c >> FONT_PAGE_BITS];
+  if (*page == NULL && (*page = calloc(1 << FONT_PAGE_BITS, 1)) == NULL)
+    return 1;
+  index = &(*page)[c & ((1 << FONT_PAGE_BITS) - 1)];
+  if (*index == 0) {
+    /* Characters no font has are drawn with the font */
+    *index = 1;
+    if (!XftCharExists(osd->display, f->xft, c))
+      for (i = 0; i < f->nfallbacks; i++)
+        if (covers(osd, &f->fallbacks[i], c)) {
+          *index = i + 2;
+          break;
+        }
+  }
+  return *index;
+}
+
+/* }}} */
+
+/* fallback_font -- the font for an index, opening a fallback on first use {{{ */
+static XftFont *
+fallback_font(xosd_xft *osd, XftFont *font, int index)
+{
+  osd_fallback *fb;
+
+  if (index < 2)
+    return font;
+  fb = &osd->font->fallbacks[index - 2];
+  if (fb->font == NULL && fb->pattern != NULL) {
+    DEBUG_MSG(Dtrace, "Opening fallback %d", index - 2);
+    /* The font owns the pattern, or Xft destroyed it for a cached font */
+    if ((fb->font = XftFontOpenPattern(osd->display, fb->pattern)) == NULL) {
+      FcPatternDestroy(fb->pattern);
+      FcCharSetDestroy(fb->charset);
+      fb->charset = NULL;
+    }
+    fb->pattern = NULL;
+  }
+  return fb->font != NULL ? fb->font : font;
+}
+
+/* }}} */
+
+/* char_font -- the font a character is drawn with {{{ */
+XftFont *
+char_font(xosd_xft *osd, XftFont *font, FcChar32 c)
+{
+  if (osd->font->nfallbacks == 0 || (c < METRICS_RANGE && osd->font->metrics.have[c]))
+    return font;
+  return fallback_font(osd, font, font_index(osd, osd->font, c));
+}
+
+/* }}} */
+
+/* font_run -- the length of the start of text drawn with one font {{{
+ *
+ * font is the font for the characters it has, the run font is set to it
+ * or to the fallback for the characters of the run.
+ */
+int
+font_run(xosd_xft *osd, XftFont *font, const char *text, int len, XftFont **run_font)
+{
+  const FcChar8 *s = (const FcChar8 *)text;
+  int n = 0, index = 0;
+
+  while (n < len) {
+    FcChar32 c;
+    int i, l = FcUtf8ToUcs4(s + n, &c, len - n);
+    if (l <= 0) {
+      /* Not after sanitizing, but then the font draws it */
+      l = 1;
+      i = 1;
+    } else if (c < METRICS_RANGE && osd->font->metrics.have[c])
+      i = 1;
+    else
+      i = font_index(osd, osd->font, c);
+    if (index != 0 && i != index)
+      break;
+    index = i;
+    n += l;
+  }
+  *run_font = fallback_font(osd, font, index);
+  return n;
+}
+
+/* }}} */
+
+/* draw_text -- XftDrawStringUtf8 with the fallback fonts, or shaped {{{
+ *
+ * Runs in a colour font are composited from the colour glyph cache.
+ */
+void
+draw_text(xosd_xft *osd, XftColor *color, XftFont *font, int x, int y, const char *text, int len)
+{
+#ifdef HAVE_HARFBUZZ
+  osd_shaped *shaped = shape(osd, font, text, len);
+
+  if (shaped != NULL) {
+    draw_shaped(osd, color, shaped, x, y);
+    return;
+  }
+#endif
+  while (len > 0) {
+    XftFont *run_font = font;
+    XGlyphInfo extents;
+    int n = osd->font->nfallbacks ? font_run(osd, font, text, len, &run_font) : len;
+    if (color_font(osd, run_font, NULL)) {
+      color_text(osd, color, run_font, x, y, text, n, &extents);
+      x += extents.xOff;
+    } else {
+      touch_text(osd, run_font, text, n);
+      XftDrawStringUtf8(osd->draw, color, run_font, x, y, (const FcChar8 *)text, n);
+      if (n < len) {
+        font_extents(osd, run_font, text, n, &extents);
+        x += extents.xOff;
+      }
+    }
+    text += n;
+    len -= n;
+  }
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
@@ -0,0 +1,319 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include "intern.h"
+
+/* glyph_font -- the glyphs of a font, added on first use {{{ */
+static osd_glyphs *
+glyph_font(xosd_xft *osd, XftFont *font)
+{
+  osd_glyphs *f, *grown;
+  FcChar8 *family, *style;
+  FcBool b;
+  double size;
+  int rgba, i;
+
+  for (i = 0; i < osd->nglyph_fonts; i++)
+    if (osd->glyph_fonts[i].font == font)
+      return &osd->glyph_fonts[i];
+  if ((grown = realloc(osd->glyph_fonts, (osd->nglyph_fonts + 1) * sizeof(osd_glyphs))) == NULL)
+    return NULL;
+  osd->glyph_fonts = grown;
+  f = &osd->glyph_fonts[osd->nglyph_fonts];
+  memset(f, 0, sizeof(*f));
+  if ((f->table = calloc(64, sizeof(osd_glyph))) == NULL)
+    return NULL;
+  osd->nglyph_fonts++;
+  f->font = font;
+  f->size = 64;
+  /* The image formats Xft renders to for the pattern */
+  f->render = XftDefaultHasRender(osd->display);
+  if (FcPatternGetBool(font->pattern, XFT_RENDER, 0, &b) == FcResultMatch)
+    f->render = f->render && b;
+  f->format = GLYPH_GRAY;
+  if (FcPatternGetBool(font->pattern, FC_ANTIALIAS, 0, &b) == FcResultMatch && !b)
+    f->format = GLYPH_MONO;
+  else if (f->render && FcPatternGetInteger(font->pattern, FC_RGBA, 0, &rgba) == FcResultMatch &&
+           rgba != FC_RGBA_UNKNOWN && rgba != FC_RGBA_NONE)
+    f->format = GLYPH_ARGB;
+  if (FcPatternGetString(font->pattern, FC_FAMILY, 0, &family) != FcResultMatch)
+    family = (FcChar8 *)"";
+  if (FcPatternGetDouble(font->pattern, FC_PIXEL_SIZE, 0, &size) != FcResultMatch)
+    size = 0;
+  if (FcPatternGetString(font->pattern, FC_STYLE, 0, &style) == FcResultMatch)
+    snprintf(f->stats.name, sizeof(f->stats.name), "%s:style=%s:pixelsize=%g", family, style, size);
+  else
+    snprintf(f->stats.name, sizeof(f->stats.name), "%s:pixelsize=%g", family, size);
+  return f;
+}
+
+/* }}} */
+
+/* lookup -- the slot of a glyph in the table, empty if not there {{{ */
+static osd_glyph *
+lookup(osd_glyphs *f, FT_UInt glyph)
+{
+  unsigned int i = (glyph * 2654435761u) & (f->size - 1);
+
+  while (f->table[i].used != 0 && f->table[i].glyph != glyph)
+    i = (i + 1) & (f->size - 1);
+  return &f->table[i];
+}
+
+/* }}} */
+
+/* grow -- double the table, -1 on error {{{ */
+static int
+grow(osd_glyphs *f)
+{
+  osd_glyphs old = *f;
+  unsigned int i;
+
+  if ((f->table = calloc(old.size * 2, sizeof(osd_glyph))) == NULL) {
+    f->table = old.table;
+    return -1;
+  }
+  f->size = old.size * 2;
+  for (i = 0; i < old.size; i++)
+    if (old.table[i].used != 0)
+      *lookup(f, old.table[i].glyph) = old.table[i];
+  free(old.table);
+  return 0;
+}
+
+/* }}} */
+
+/* image_bytes -- the size of the image Xft makes of a glyph {{{ */
+static unsigned int
+image_bytes(osd_glyphs *f, const XGlyphInfo *info)
+{
+  switch (f->format) {
+  case GLYPH_MONO:
+    return ((info->width + 31) >> 5 << 2) * info->height;
+  case GLYPH_ARGB:
+    return info->width * 4 * info->height;
+  default:
+    return ((info->width + 3) & ~3) * info->height;
+  }
+}
+
+/* }}} */
+
+/* account -- add or take away the bytes of a glyph {{{ */
+static void
+account(xosd_xft *osd, osd_glyphs *f, osd_glyph *g, int sign)
+{
+  unsigned long client = GLYPH_OVERHEAD + (f->render ? 0 : g->bytes);
+  unsigned long server = f->render ? g->bytes : 0;
+
+  if (sign > 0) {
+    f->stats.glyphs++;
+    f->stats.client_bytes += client;
+    f->stats.server_bytes += server;
+    osd->glyph_bytes += client + server;
+  } else {
+    f->stats.glyphs--;
+    f->stats.client_bytes -= client;
+    f->stats.server_bytes -= server;
+    osd->glyph_bytes -= client + server;
+  }
+}
+
+/* }}} */
+
+/* touch_glyph -- note that a glyph is drawn, before drawing it {{{
+ *
+ * A new glyph is measured at the next trim, once drawing has loaded it.
+ */
+void
+touch_glyph(xosd_xft *osd, XftFont *font, FT_UInt glyph)
+{
+  osd_glyphs *f = glyph_font(osd, font);
+  osd_glyph *g;
+
+  if (f == NULL)
+    return;
+  if ((f->count + 1) * 4 > f->size * 3 && grow(f) == -1)
+    return;
+  g = lookup(f, glyph);
+  if (g->used == 0) {
+    osd_glyph_ref *ref;
+    if (osd->nnew_glyphs == osd->new_glyphs_size) {
+      int size = osd->new_glyphs_size ? osd->new_glyphs_size * 2 : 64;
+      if ((ref = realloc(osd->new_glyphs, size * sizeof(osd_glyph_ref))) == NULL)
+        return;
+      osd->new_glyphs = ref;
+      osd->new_glyphs_size = size;
+    }
+    ref = &osd->new_glyphs[osd->nnew_glyphs++];
+    ref->font = font;
+    ref->glyph = glyph;
+    g->glyph = glyph;
+    g->loaded = 1;
+    f->count++;
+  } else if (!g->loaded) {
+    g->loaded = 1;
+    f->stats.reloads++;
+    account(osd, f, g, 1);
+  }
+  g->used = ++osd->glyph_clock;
+}
+
+/* }}} */
+
+/* touch_text -- touch_glyph for the characters of text {{{ */
+void
+touch_text(xosd_xft *osd, XftFont *font, const char *text, int len)
+{
+  const FcChar8 *s = (const FcChar8 *)text;
+
+  while (len > 0) {
+    FcChar32 c;
+    int l = FcUtf8ToUcs4(s, &c, len);
+    if (l <= 0) {
+      l = 1;
+      c = 0xfffd;
+    }
+    touch_glyph(osd, font, XftCharIndex(osd->display, font, c));
+    s += l;
+    len -= l;
+  }
+}
+
+/* }}} */
+
+/* A loaded glyph of a font, for trim_glyphs to sort */
+typedef struct _loaded
+{
+  osd_glyphs*           font;
+  osd_glyph*            glyph;
+} loaded;
+
+/* older -- order glyphs from the least recently used {{{ */
+static int
+older(const void *a, const void *b)
+{
+  unsigned long ua = ((const loaded *)a)->glyph->used, ub = ((const loaded *)b)->glyph->used;
+
+  return ua < ub ? -1 : ua > ub;
+}
+
+/* }}} */
+
+/* trim_glyphs -- measure the new glyphs and keep to the budget {{{
+ *
+ * Called after a redraw. Over the budget, the least recently used glyphs
+ * of all the fonts are unloaded till an eighth of it is free, so that it
+ * is not done on every redraw. Glyphs drawn since the last trim are kept.
+ */
+void
+trim_glyphs(xosd_xft *osd)
+{
+  unsigned long budget = osd->settings.glyph_budget, keep = osd->glyph_frame;
+  loaded *lru;
+  int i, n = 0;
+  unsigned int j;
+
+  for (i = 0; i < osd->nnew_glyphs; i++) {
+    osd_glyph_ref *ref = &osd->new_glyphs[i];
+    osd_glyphs *f = glyph_font(osd, ref->font);
+    osd_glyph *g;
+    XGlyphInfo info;
+    if (f == NULL || (g = lookup(f, ref->glyph))->used == 0)
+      continue;
+    XftGlyphExtents(osd->display, ref->font, &ref->glyph, 1, &info);
+    g->bytes = image_bytes(f, &info);
+    account(osd, f, g, 1);
+  }
+  osd->nnew_glyphs = 0;
+  osd->glyph_frame = osd->glyph_clock;
+  if (budget == 0 || osd->glyph_bytes <= budget)
+    return;
+
+  for (i = 0; i < osd->nglyph_fonts; i++)
+    n += osd->glyph_fonts[i].stats.glyphs;
+  if ((lru = malloc(n * sizeof(loaded))) == NULL)
+    return;
+  n = 0;
+  for (i = 0; i < osd->nglyph_fonts; i++) {
+    osd_glyphs *f = &osd->glyph_fonts[i];
+    for (j = 0; j < f->size; j++)
+      if (f->table[j].used != 0 && f->table[j].loaded && f->table[j].used <= keep) {
+        lru[n].font = f;
+        lru[n++].glyph = &f->table[j];
+      }
+  }
+  qsort(lru, n, sizeof(loaded), older);
+  for (i = 0; i < n && osd->glyph_bytes > budget - budget / 8; i++) {
+    osd_glyphs *f = lru[i].font;
+    osd_glyph *g = lru[i].glyph;
+    XftFontUnloadGlyphs(osd->display, f->font, &g->glyph, 1);
+    g->loaded = 0;
+    f->stats.evictions++;
+    account(osd, f, g, -1);
+  }
+  DEBUG_MSG(Dvalue, "TrimGlyphs { unloaded = %d, bytes = %lu, budget = %lu }", i, osd->glyph_bytes, budget);
+  free(lru);
+}
+
+/* }}} */
+
+/* forget_glyphs -- drop the glyphs of a font that is closing {{{ */
+void
+forget_glyphs(xosd_xft *osd, XftFont *font)
+{
+  int i, n = 0;
+
+  for (i = 0; i < osd->nnew_glyphs; i++)
+    if (osd->new_glyphs[i].font != font)
+      osd->new_glyphs[n++] = osd->new_glyphs[i];
+  osd->nnew_glyphs = n;
+  for (i = 0; i < osd->nglyph_fonts; i++)
+    if (osd->glyph_fonts[i].font == font) {
+      osd_glyphs *f = &osd->glyph_fonts[i];
+      osd->glyph_bytes -= f->stats.client_bytes + f->stats.server_bytes;
+      free(f->table);
+      *f = osd->glyph_fonts[--osd->nglyph_fonts];
+      break;
+    }
+}
+
+/* }}} */
+
+/* free_glyphs -- free the glyph tables {{{ */
+void
+free_glyphs(xosd_xft *osd)
+{
+  int i;
+
+  for (i = 0; i < osd->nglyph_fonts; i++)
+    free(osd->glyph_fonts[i].table);
+  free(osd->glyph_fonts);
+  free(osd->new_glyphs);
+  osd->glyph_fonts = NULL;
+  osd->new_glyphs = NULL;
+  osd->nglyph_fonts = osd->nnew_glyphs = osd->new_glyphs_size = 0;
+  osd->glyph_bytes = 0;
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
@@ -17,8 +17,14 @@ Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
 
 */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE           /* memrchr */
+#endif
+
 #include <ctype.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <pthread.h>
 #include <stdint.h>
 
@@ -32,6 +38,11 @@ Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
 #include <X11/extensions/Xrandr.h>
 #endif
 
+#ifdef HAVE_HARFBUZZ
+#include <hb.h>
+#include <hb-ft.h>
+#endif
+
 #include <xosd-xft.h>
 
 #ifdef DEBUG
@@ -77,16 +88,185 @@ extern int _xosd_debug_fn_level ;
 #define FUNCTION_END() do{}while(0)
 #endif
 
+/* A part of a line drawn with the same attributes */
+typedef struct _osd_run
+{
+  int                   start;
+  int                   len;
+  int                   fg;           /* Palette index, -1 - foreground color */
+  int                   bg;           /* Palette index, -1 - none */
+  int                   flags;        /* ANSI_BOLD, ANSI_REVERSE */
+} osd_run;
+
+#define ANSI_BOLD     (1 << 0)
+#define ANSI_REVERSE  (1 << 1)
+
+typedef struct _osd_line
+{
+  char*                 text;
+  int                   len;
+  osd_run*              runs;         /* NULL - all in the foreground color */
+  int                   nruns;
+} osd_line;
+
+#define ANSI_COLORS 256
+
+#define DIVCEIL(n, d)		(((n) + ((d) - 1)) / (d))
+
+/* Metrics of a font for U+0000 - U+00FF, measured when it opens */
+#define METRICS_RANGE 256
+
+typedef struct _osd_metrics
+{
+  XftFont*              font;
+  XGlyphInfo            glyphs[METRICS_RANGE];
+  unsigned char         have[METRICS_RANGE];   /* Printable and in the font */
+  int                   ascent;
+  int                   descent;
+  int                   char_width;   /* Average advance of printable ASCII */
+  int                   monospace;
+} osd_metrics;
+
+/* A union of glyph boxes, as XftGlyphExtents makes it */
+typedef struct _osd_box
+{
+  int                   left;
+  int                   top;
+  int                   right;
+  int                   bottom;
+  int                   empty;
+} osd_box;
+
+/* A font for the characters the font does not have {{{
+ *
+ * The families after the first in the font name are the fallbacks, tried
+ * in order. Each is matched when a character is first looked for in it and
+ * opened when a character is first drawn with it.
+ */
+typedef struct _osd_fallback
+{
+  FcPattern*            pattern;      /* Matched once matched, NULL once opened */
+  int                   matched;
+  FcCharSet*            charset;      /* Of the match, a reference */
+  XftFont*              font;         /* NULL till needed */
+} osd_fallback;
+
+/* Index of the font of each codepoint, in pages of 256 allocated on first
+ * use: 0 - not looked up yet, 1 - the font, 2.. - fallback index + 2 */
+#define FONT_PAGE_BITS  8
+#define FONT_PAGES      (0x110000 >> FONT_PAGE_BITS)
+#define FALLBACK_MAX    (255 - 2)
+/* }}} */
+
+/* An open font and what is worked out from it, kept in an LRU of fonts */
+typedef struct _osd_font
+{
+  char*                 name;         /* Normalized pattern, NULL - free */
+  XftFont*              xft;
+  XftFont*              bold;         /* NULL till needed, xft if none */
+  osd_metrics           metrics;
+  osd_fallback*         fallbacks;
+  int                   nfallbacks;
+  unsigned char**       pages;        /* NULL till a page is needed */
+  unsigned long         used;
+} osd_font;
+
+#define FONT_CACHE_SIZE 8
+
+/* The size text was fitted at, for a text area */
+typedef struct _osd_fit
+{
+  uint32_t              hash;         /* Of the lines */
+  unsigned int          width;
+  unsigned int          height;
+  int                   pt;           /* 0 - unused */
+} osd_fit;
+
+#define AUTOFIT_CACHE_SIZE 32
+
+#ifdef HAVE_HARFBUZZ
+/* Text shaped with HarfBuzz, glyphs relative to the origin */
+typedef struct _osd_shaped
+{
+  uint32_t              hash;
+  XftFont*              font;
+  char*                 text;         /* NULL - unused */
+  int                   len;
+  XftGlyphFontSpec*     glyphs;
+  int                   nglyphs;
+  XGlyphInfo            extents;
+} osd_shaped;
+
+#define SHAPE_CACHE_SIZE 256
+#endif
+
+/* A glyph of a colour font, uploaded once as a premultiplied ARGB Picture */
+typedef struct _osd_color_glyph
+{
+  XftFont*              font;         /* NULL - unused */
+  FT_UInt               glyph;
+  Picture               picture;      /* None - drawn with Xft */
+  XGlyphInfo            info;         /* As drawn, scaled to the font size */
+  unsigned long         used;
+} osd_color_glyph;
+
+#define COLOR_CACHE_SIZE 64
+
+/* A glyph Xft loaded for a font, for the glyph budget */
+typedef struct _osd_glyph
+{
+  FT_UInt               glyph;
+  unsigned int          bytes;        /* Of the image, measured at the trim */
+  unsigned long         used;         /* 0 - unused slot */
+  int                   loaded;       /* 0 - unloaded for the budget */
+} osd_glyph;
+
+/* The glyphs Xft loaded for a font, in an open addressed table */
+typedef struct _osd_glyphs
+{
+  XftFont*              font;
+  int                   render;       /* The images are on the server */
+  int                   format;       /* GLYPH_MONO, GLYPH_GRAY or GLYPH_ARGB */
+  osd_glyph*            table;
+  unsigned int          size;         /* Power of 2 */
+  unsigned int          count;        /* Loaded or not */
+  osd_font_stats        stats;
+} osd_glyphs;
+
+#define GLYPH_MONO 0
+#define GLYPH_GRAY 1
+#define GLYPH_ARGB 2
+
+/* What Xft keeps in the client for a glyph besides the image, about */
+#define GLYPH_OVERHEAD (sizeof(XGlyphInfo) + 4 * sizeof(long))
+
+/* A glyph loaded since the last trim, to measure */
+typedef struct _osd_glyph_ref
+{
+  XftFont*              font;
+  FT_UInt               glyph;
+} osd_glyph_ref;
+
+/* Codepoints first to last */
+typedef struct _osd_range
+{
+  FcChar32              first;
+  FcChar32              last;
+} osd_range;
+
 typedef struct _osd_settings
 {
   const char*           geometry;
   int                   use_xrandr;
   int                   use_xinerama;
   int                   monitor;
-  char**                lines;
+  osd_line*             lines;
   int                   maxlines;
   int                   nlines;
   const char*           fontname;
+  int                   autofit_min;  /* Points, autofit_max 0 - off */
+  int                   autofit_max;
+  unsigned long         glyph_budget; /* Bytes, 0 - none */
   const char*           color;
   const char*           bg_color;
   unsigned int          bg_alpha;
@@ -94,12 +274,14 @@ typedef struct _osd_settings
   int                   shadow_offset;
   const char*           padding;
   const char*           text_align;
+  int                   ansi;
 } osd_settings;
 
 struct xosd_xft
 {
   /* Thread */
   pthread_t               event_thread;
+  pthread_mutex_t         lock;           /* Guards settings.lines */
 
   /* Display */
   Display*                display;
@@ -114,18 +296,48 @@ struct xosd_xft
   unsigned int            screen_height;
   int                     screen_xpos;
   int                     screen_ypos;
+  double                  font_dpi;       /* Of the monitor, 0 - Xft.dpi */
 
   /* Drawables */
   Window                  window;
   XftDraw*                draw;
+  GC                      gc;             /* For scrolling */
+  int                     scrolls;        /* Sent, not yet copied (lock) */
+  int                     scroll_redraw;  /* Drawn over since, redraw them */
 
-  /* Font */
-  XftFont*                font;
+  /* Fonts */
+  osd_font*               font;           /* In use, one of fonts */
+  osd_font                fonts[FONT_CACHE_SIZE];
+  unsigned long           font_clock;     /* Last use of a font */
+  osd_fit                 fits[AUTOFIT_CACHE_SIZE];
+  int                     autofit_pt;     /* Size in use, 0 - none */
+#ifdef HAVE_HARFBUZZ
+  hb_buffer_t*            hb_buffer;      /* NULL till needed */
+  osd_shaped              shaped[SHAPE_CACHE_SIZE];
+#endif
+  osd_color_glyph         color_glyphs[COLOR_CACHE_SIZE];
+  unsigned long           color_clock;    /* Last use of a colour glyph */
+
+  /* Glyphs to preload on the event thread (guarded by lock) */
+  osd_range*              preload;
+  int                     npreload;
+  osd_preload_stats       preload_stats;
+
+  /* Glyphs Xft loaded, for the budget (guarded by lock) */
+  osd_glyphs*             glyph_fonts;
+  int                     nglyph_fonts;
+  osd_glyph_ref*          new_glyphs;
+  int                     nnew_glyphs;
+  int                     new_glyphs_size;
+  unsigned long           glyph_clock;    /* Last use of a glyph */
+  unsigned long           glyph_frame;    /* Clock at the last trim */
+  unsigned long           glyph_bytes;    /* Client and server */
 
   /* Colors */
   XftColor                color;
   XftColor                bg_color;
   XftColor                shadow_color;
+  XftColor                palette[ANSI_COLORS];
 
   /* Parsed Geometry */
   osd_geometry            geometry;
@@ -168,14 +380,86 @@ int osd_init_monitor(Display *display, int screen,
                        int default_monitor,
                        int use_xrandr, int use_xinerama,
                        unsigned int *width, unsigned int *height,
-                       int *xpos, int *ypos);
+                       int *xpos, int *ypos, double *dpi);
+
+/* Fonts are opened at the DPI of monitors denser than 96, in steps of 24 */
+#define BASE_DPI        96.0
+#define SCALE_STEPS     4
 
 /* Events */
 void send_event(xosd_xft *osd, long event_type);
 
+/* Locking */
+#define LOCK(osd) \
+  do { \
+    DEBUG_MSG(Dlocking, "lock"); \
+    pthread_mutex_lock(&(osd)->lock); \
+  } while (0)
+#define UNLOCK(osd) \
+  do { \
+    DEBUG_MSG(Dlocking, "unlock"); \
+    pthread_mutex_unlock(&(osd)->lock); \
+  } while (0)
+
 /* Colors */
 int init_color(xosd_xft* osd, const char* color, unsigned int alpha, XftColor* xft_color);
 
+/* UTF-8 - worst case every byte becomes a 3 byte replacement */
+#define UTF8_SANITIZE_SIZE(len)   ((len) * 3 + 1)
+size_t utf8_sanitize(const char *src, size_t len, char *dest);
+
+/* Font metrics */
+void extend(osd_box *box, int x, int y, const XGlyphInfo *g);
+void box_extents(const osd_box *box, int x, int y, XGlyphInfo *extents);
+void init_metrics(xosd_xft *osd, osd_metrics *m, XftFont *font);
+void font_extents(xosd_xft *osd, XftFont *font, const char *text, int len, XGlyphInfo *extents);
+void line_extents(xosd_xft *osd, osd_line *line, XGlyphInfo *extents);
+void text_extents(xosd_xft *osd, XftFont *font, const char *text, int len, XGlyphInfo *extents);
+
+/* Fonts */
+int set_font(xosd_xft *osd, const char *name);
+int init_monitor(xosd_xft *osd);
+void close_fonts(xosd_xft *osd);
+XftFont *bold_font(xosd_xft *osd);
+XftFont *open_font(xosd_xft *osd, FcPattern *pattern, const char *name);
+XftFont *char_font(xosd_xft *osd, XftFont *font, FcChar32 c);
+int font_run(xosd_xft *osd, XftFont *font, const char *text, int len, XftFont **run_font);
+void draw_text(xosd_xft *osd, XftColor *color, XftFont *font, int x, int y, const char *text, int len);
+
+#ifdef HAVE_HARFBUZZ
+/* Shaping */
+osd_shaped *shape(xosd_xft *osd, XftFont *font, const char *text, int len);
+void draw_shaped(xosd_xft *osd, XftColor *color, osd_shaped *shaped, int x, int y);
+void free_shaped(xosd_xft *osd);
+#endif
+
+/* Colour glyphs */
+int color_font(xosd_xft *osd, XftFont *font, double *scale);
+osd_color_glyph *color_glyph(xosd_xft *osd, XftFont *font, FT_UInt glyph);
+void draw_color_glyph(xosd_xft *osd, XftColor *color, osd_color_glyph *g, int x, int y);
+void color_text(xosd_xft *osd, XftColor *color, XftFont *font, int x, int y, const char *text, int len, XGlyphInfo *extents);
+void free_color(xosd_xft *osd);
+
+/* Glyph budget */
+void touch_glyph(xosd_xft *osd, XftFont *font, FT_UInt glyph);
+void touch_text(xosd_xft *osd, XftFont *font, const char *text, int len);
+void trim_glyphs(xosd_xft *osd);
+void forget_glyphs(xosd_xft *osd, XftFont *font);
+void free_glyphs(xosd_xft *osd);
+
+/* Font autofit */
+void autofit(xosd_xft *osd);
+
+/* Glyph preloading */
+int add_range(osd_range **ranges, int *n, FcChar32 first, FcChar32 last);
+int parse_glyphs(const char *glyphs, osd_range **ranges, int *n);
+void preload(xosd_xft *osd);
+
+/* ANSI colors */
+int init_palette(xosd_xft *osd);
+void free_palette(xosd_xft *osd);
+int ansi_sanitize(const char *src, size_t len, char *dest, osd_run **runs, int *nruns);
+
 #define XOSD_XFT_event                    "XOSD_XFT_EVENT"
 #define XOSD_XFT_event_Exit               (1 << 0)
 #define XOSD_XFT_event_Hide               (1 << 1)
@@ -184,6 +468,10 @@ int init_color(xosd_xft* osd, const char* color, unsigned int alpha, XftColor* x
 #define XOSD_XFT_event_Foreground         (1 << 4)
 #define XOSD_XFT_event_Background         (1 << 5)
 #define XOSD_XFT_event_Shadow             (1 << 6)
+#define XOSD_XFT_event_Font               (1 << 7)
+#define XOSD_XFT_event_Preload            (1 << 8)
+#define XOSD_XFT_event_Monitor            (1 << 9)
+#define XOSD_XFT_event_Scroll             (1 << 10)
 
 #define fail(r, m)              \
   do                            \
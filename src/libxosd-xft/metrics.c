@@ -0,0 +1,213 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include "intern.h"
+
+/* printable -- is the codepoint one the table is for {{{ */
+static int
+printable(unsigned int c)
+{
+  return (c >= 0x20 && c < 0x7f) || (c >= 0xa0 && c < METRICS_RANGE);
+}
+
+/* }}} */
+
+/* init_metrics -- measure the ASCII and Latin-1 glyphs of a font once {{{
+ *
+ * The glyphs are loaded by the measuring anyway, the first time they are
+ * drawn, so this only moves the work to the font open.
+ */
+void
+init_metrics(xosd_xft *osd, osd_metrics *m, XftFont *font)
+{
+  FUNCTION_START();
+  unsigned int c, n = 0;
+  int sum = 0;
+
+  memset(m, 0, sizeof(*m));
+  m->font = font;
+  m->ascent = font->ascent;
+  m->descent = font->descent;
+  m->monospace = 1;
+  /* Colour fonts are measured from their colour glyphs */
+  for (c = color_font(osd, font, NULL) ? METRICS_RANGE : 0; c < METRICS_RANGE; c++) {
+    FcChar32 ch = c;
+    /* Characters the font does not have are left to the fallback fonts */
+    if (!printable(c) || !XftCharExists(osd->display, font, ch))
+      continue;
+    XftTextExtents32(osd->display, font, &ch, 1, &m->glyphs[c]);
+    m->have[c] = 1;
+    if (c < 0x7f) {
+      sum += m->glyphs[c].xOff;
+      n++;
+      if (m->glyphs[c].xOff != m->glyphs[' '].xOff)
+        m->monospace = 0;
+    }
+  }
+  m->char_width = n ? DIVCEIL(sum, (int)n) : font->max_advance_width;
+  DEBUG_MSG(Dvalue, "Metrics { char_width = %d, monospace = %d }", m->char_width, m->monospace);
+  FUNCTION_END();
+}
+
+/* }}} */
+
+/* extend -- add a glyph box at x, y to the union of boxes {{{
+ *
+ * The boxes are combined the way XftGlyphExtents does, so the result is the
+ * same as measuring with Xft.
+ */
+void
+extend(osd_box *box, int x, int y, const XGlyphInfo *g)
+{
+  int l = x - g->x, t = y - g->y;
+
+  if (box->empty || l < box->left)
+    box->left = l;
+  if (box->empty || t < box->top)
+    box->top = t;
+  if (box->empty || l + g->width > box->right)
+    box->right = l + g->width;
+  if (box->empty || t + g->height > box->bottom)
+    box->bottom = t + g->height;
+  box->empty = 0;
+}
+
+/* }}} */
+
+/* box_extents -- the extents of a union of boxes {{{ */
+void
+box_extents(const osd_box *box, int x, int y, XGlyphInfo *extents)
+{
+  extents->x = -box->left;
+  extents->y = -box->top;
+  extents->width = box->right - box->left;
+  extents->height = box->bottom - box->top;
+  extents->xOff = x;
+  extents->yOff = y;
+}
+
+/* }}} */
+
+/* table_extents -- extents from the table, -1 if a character is not in it {{{ */
+static int
+table_extents(osd_metrics *m, const unsigned char *s, int len, XGlyphInfo *extents)
+{
+  const unsigned char *end = s + len;
+  osd_box box = { 0, 0, 0, 0, 1 };
+  int x = 0, y = 0;
+
+  while (s < end) {
+    unsigned int c = *s++;
+    if (c >= 0x80) {
+      /* Two byte sequences for U+0080 - U+00FF */
+      if ((c != 0xc2 && c != 0xc3) || s == end || (*s & 0xc0) != 0x80)
+        return -1;
+      c = (c & 0x1f) << 6 | (*s++ & 0x3f);
+    }
+    if (!m->have[c])
+      return -1;
+    extend(&box, x, y, &m->glyphs[c]);
+    x += m->glyphs[c].xOff;
+    y += m->glyphs[c].yOff;
+  }
+  box_extents(&box, x, y, extents);
+  return 0;
+}
+
+/* }}} */
+
+/* font_extents -- XftTextExtentsUtf8, from the metrics table when it can {{{ */
+void
+font_extents(xosd_xft *osd, XftFont *font, const char *text, int len, XGlyphInfo *extents)
+{
+  if (font != osd->font->metrics.font ||
+      table_extents(&osd->font->metrics, (const unsigned char *)text, len, extents) == -1) {
+    if (color_font(osd, font, NULL))
+      color_text(osd, NULL, font, 0, 0, text, len, extents);
+    else
+      XftTextExtentsUtf8(osd->display, font, (const FcChar8 *)text, len, extents);
+  }
+}
+
+/* }}} */
+
+/* text_extents -- extents of text drawn with font and the fallback fonts {{{ */
+void
+text_extents(xosd_xft *osd, XftFont *font, const char *text, int len, XGlyphInfo *extents)
+{
+  osd_box box = { 0, 0, 0, 0, 1 };
+  int x = 0, y = 0;
+#ifdef HAVE_HARFBUZZ
+  osd_shaped *shaped = shape(osd, font, text, len);
+
+  if (shaped != NULL) {
+    *extents = shaped->extents;
+    return;
+  }
+#endif
+
+  if (osd->font->nfallbacks == 0) {
+    font_extents(osd, font, text, len, extents);
+    return;
+  }
+  while (len > 0) {
+    XftFont *run_font;
+    int n = font_run(osd, font, text, len, &run_font);
+    font_extents(osd, run_font, text, n, extents);
+    extend(&box, x, y, extents);
+    x += extents->xOff;
+    y += extents->yOff;
+    text += n;
+    len -= n;
+  }
+  box_extents(&box, x, y, extents);
+}
+
+/* }}} */
+
+/* line_extents -- extents of a line, its bold runs in the bold font {{{
+ *
+ * Measures the runs the way draw_line draws them, so that aligning the
+ * line places it where it is drawn.
+ */
+void
+line_extents(xosd_xft *osd, osd_line *line, XGlyphInfo *extents)
+{
+  osd_box box = { 0, 0, 0, 0, 1 };
+  int i, x = 0;
+
+  if (line->runs == NULL) {
+    text_extents(osd, osd->font->xft, line->text, line->len, extents);
+    return;
+  }
+  for (i = 0; i < line->nruns; i++) {
+    osd_run *run = &line->runs[i];
+    XftFont *font = run->flags & ANSI_BOLD ? bold_font(osd) : osd->font->xft;
+    text_extents(osd, font, line->text + run->start, run->len, extents);
+    extend(&box, x, 0, extents);
+    x += extents->xOff;
+  }
+  box_extents(&box, x, 0, extents);
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
@@ -67,12 +67,35 @@ static void get_focus_point(Display *display, int *x_ret, int *y_ret)
 
 /* }}} */
 
+#ifdef HAVE_LIBXRANDR
+/* plausible_size -- is a physical size (mm) one a monitor can have {{{
+ *
+ * Some monitors report their aspect ratio, 16x9 or 16x10 cm, instead of
+ * their size. Pixels are about square, so the horizontal and vertical DPI
+ * of a real size agree.
+ */
+static int
+plausible_size(unsigned width, unsigned height, int mwidth, int mheight)
+{
+  double ratio;
+
+  if (mwidth < 100 || mheight < 50 ||
+      (mwidth == 160 && (mheight == 90 || mheight == 100)))
+    return 0;
+  ratio = (double)width * mheight / ((double)height * mwidth);
+  return ratio > 0.8 && ratio < 1.25;
+}
+
+/* }}} */
+#endif
+
 /* soxsd_init_monitor -- Initialize multihead if xinerama or xrandr available {{{ */
 struct monitor {
   int       number ;
   int       x, y;
   unsigned  width, height;
   int       primary ;
+  double    dpi;          /* 0 - unknown */
 };
 
 static struct monitor*
@@ -96,6 +119,9 @@ get_monitors(Display *display, int *n, int use_xrandr, int use_xinerama)
         r[i].y = monitors[i].y;
         r[i].width = monitors[i].width;
         r[i].height = monitors[i].height;
+        /* From the physical size, which some monitors do not report */
+        r[i].dpi = plausible_size(monitors[i].width, monitors[i].height, monitors[i].mwidth, monitors[i].mheight) ?
+          monitors[i].width * 25.4 / monitors[i].mwidth : 0;
       }
       XRRFreeMonitors(monitors);
 #ifdef HAVE_LIBXINERAMA
@@ -141,7 +167,7 @@ get_monitors(Display *display, int *n, int use_xrandr, int use_xinerama)
 }
 
 int osd_init_monitor(Display *display, int screen, int default_monitor, int use_xrandr, int use_xinerama,
-                       unsigned int *width, unsigned int *height, int *xpos, int *ypos)
+                       unsigned int *width, unsigned int *height, int *xpos, int *ypos, double *dpi)
 {
   FUNCTION_START();
   int monitor = default_monitor;
@@ -154,6 +180,7 @@ int osd_init_monitor(Display *display, int screen, int default_monitor, int use_
   *height = XDisplayHeight(display, screen);
   *xpos = 0;
   *ypos = 0;
+  *dpi = 0;
 
   monitors = get_monitors(display, &n, use_xrandr, use_xinerama);
   if(monitors == NULL || n <= 0)
@@ -187,6 +214,9 @@ int osd_init_monitor(Display *display, int screen, int default_monitor, int use_
   *height = monitors[monitor].height;
   *xpos = monitors[monitor].x;
   *ypos = monitors[monitor].y;
+  *dpi = monitors[monitor].dpi;
+  DEBUG_MSG(Dvalue, "Monitor { number = %d, dpi = %g }", monitor, *dpi);
+  free(monitors);
   FUNCTION_END();
   return 0;
 }
@@ -0,0 +1,283 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <errno.h>
+#include <limits.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "intern.h"
+
+/* A file of records appended to a header, read through mmap. A record is
+ * the key and the matched pattern as fontconfig writes it, both with the
+ * terminating NUL, after their lengths. The stamp in the header is that of
+ * the fontconfig configuration it was written with. */
+#define CACHE_MAGIC     "XOSDFC1"
+#define CACHE_MAX_SIZE  (256 * 1024)
+
+typedef struct _cache_header
+{
+  char                  magic[8];
+  long long             stamp;
+} cache_header;
+
+/* cache_path -- $XDG_CACHE_HOME/xosd-xft/fonts, creating the directory {{{ */
+static int
+cache_path(char *path, size_t size)
+{
+  const char *base = getenv("XDG_CACHE_HOME"), *home = getenv("HOME");
+  char dir[PATH_MAX];
+
+  if (base != NULL && base[0] == '/')
+    snprintf(dir, sizeof(dir), "%s", base);
+  else if (home != NULL)
+    snprintf(dir, sizeof(dir), "%s/.cache", home);
+  else
+    return -1;
+  mkdir(dir, 0700);
+  if ((size_t)snprintf(path, size, "%s/xosd-xft", dir) >= size)
+    return -1;
+  if (mkdir(path, 0700) == -1 && errno != EEXIST)
+    return -1;
+  return (size_t)snprintf(path, size, "%s/xosd-xft/fonts", dir) >= size ? -1 : 0;
+}
+
+/* }}} */
+
+/* newest -- the latest modification time of the files in a list {{{ */
+static long long
+newest(FcStrList *list, long long stamp)
+{
+  FcChar8 *file;
+  struct stat st;
+
+  if (list == NULL)
+    return stamp;
+  while ((file = FcStrListNext(list)) != NULL)
+    if (stat((const char *)file, &st) == 0 &&
+        st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec > stamp)
+      stamp = st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+  FcStrListDone(list);
+  return stamp;
+}
+
+/* }}} */
+
+/* config_stamp -- changes when the fontconfig configuration or fonts do {{{
+ *
+ * Editing a configuration file, adding fonts to a font directory or
+ * running fc-cache all change one of the times.
+ */
+static long long
+config_stamp(void)
+{
+  FcConfig *config;
+  long long stamp = 0;
+
+  if (!FcInit() || (config = FcConfigGetCurrent()) == NULL)
+    return -1;
+  stamp = newest(FcConfigGetConfigFiles(config), stamp);
+  stamp = newest(FcConfigGetFontDirs(config), stamp);
+  stamp = newest(FcConfigGetCacheDirs(config), stamp);
+  return stamp;
+}
+
+/* }}} */
+
+/* cache_lookup -- the pattern stored for a key {{{
+ *
+ * Returns 1 with the pattern, 0 if the key is not there and -1 if the file
+ * has to be written anew (missing, out of date or full).
+ */
+static int
+cache_lookup(const char *path, long long stamp, const char *key, char **value)
+{
+  size_t key_len = strlen(key) + 1;
+  const char *map, *p, *end, *found = NULL;
+  cache_header header;
+  struct stat st;
+  int fd, r = 0;
+
+  *value = NULL;
+  if ((fd = open(path, O_RDONLY | O_CLOEXEC)) == -1)
+    return -1;
+  if (fstat(fd, &st) == -1 || st.st_size < (off_t)sizeof(header) ||
+      (map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+    close(fd);
+    return -1;
+  }
+  close(fd);
+  memcpy(&header, map, sizeof(header));
+  if (memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) || header.stamp != stamp) {
+    munmap((void *)map, st.st_size);
+    return -1;
+  }
+  end = map + st.st_size;
+  for (p = map + sizeof(header); p + 2 * sizeof(uint32_t) <= end; ) {
+    uint32_t klen, vlen;
+    memcpy(&klen, p, sizeof(klen));
+    memcpy(&vlen, p + sizeof(klen), sizeof(vlen));
+    p += 2 * sizeof(uint32_t);
+    if (klen == 0 || vlen == 0 || (size_t)(end - p) < (size_t)klen + vlen)
+      break;
+    /* A later record for the same key replaces an earlier one */
+    if (klen == key_len && !memcmp(p, key, klen) && p[klen + vlen - 1] == '\0')
+      found = p + klen;
+    p += klen + vlen;
+  }
+  if (found != NULL) {
+    *value = strdup(found);
+    r = *value != NULL;
+  } else if (st.st_size >= CACHE_MAX_SIZE)
+    r = -1;
+  munmap((void *)map, st.st_size);
+  return r;
+}
+
+/* }}} */
+
+/* cache_store -- add a record, writing the file anew if told to {{{
+ *
+ * A record is appended with one write, so processes starting together do
+ * not interleave records. A new file is renamed into place.
+ */
+static void
+cache_store(const char *path, long long stamp, int anew, const char *key, const char *value)
+{
+  uint32_t klen = strlen(key) + 1, vlen = strlen(value) + 1;
+  size_t size = sizeof(cache_header) + 2 * sizeof(uint32_t) + klen + vlen;
+  char *buf = malloc(size), *p, tmp[PATH_MAX];
+  cache_header header;
+  int fd;
+
+  if (buf == NULL)
+    return;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+  header.stamp = stamp;
+  memcpy(buf, &header, sizeof(header));
+  p = buf + sizeof(header);
+  memcpy(p, &klen, sizeof(klen));
+  memcpy(p + sizeof(klen), &vlen, sizeof(vlen));
+  memcpy(p + 2 * sizeof(uint32_t), key, klen);
+  memcpy(p + 2 * sizeof(uint32_t) + klen, value, vlen);
+  if (anew) {
+    if ((size_t)snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path) < sizeof(tmp) &&
+        (fd = mkstemp(tmp)) != -1) {
+      if (write(fd, buf, size) != (ssize_t)size || close(fd) == -1 || rename(tmp, path) == -1)
+        unlink(tmp);
+    }
+  } else if ((fd = open(path, O_WRONLY | O_APPEND | O_CLOEXEC)) != -1) {
+    if (write(fd, p, size - sizeof(header)) == -1)
+      DEBUG_MSG(Dtrace, "Could not write %s", path);
+    close(fd);
+  }
+  free(buf);
+}
+
+/* }}} */
+
+/* cache_key -- the font name and the defaults Xft adds for the screen {{{
+ *
+ * The defaults hold the DPI and the rendering settings from the X resources.
+ */
+static char *
+cache_key(xosd_xft *osd, const char *name)
+{
+  FcPattern *defaults = FcPatternCreate();
+  FcChar8 *s = NULL;
+  char *key = NULL;
+
+  if (defaults == NULL)
+    return NULL;
+  XftDefaultSubstitute(osd->display, osd->screen, defaults);
+  if ((s = FcNameUnparse(defaults)) != NULL &&
+      (key = malloc(strlen((char *)s) + strlen(name) + 2)) != NULL)
+    sprintf(key, "%s\t%s", (char *)s, name);
+  free(s);
+  FcPatternDestroy(defaults);
+  return key;
+}
+
+/* }}} */
+
+/* open_font -- match and open a font, the match cached on disk {{{
+ *
+ * Matching against all the installed fonts is the largest part of opening
+ * one. The cache keeps what XftFontOpenPattern needs of a match: the file,
+ * index and rendering settings. The character set is left to Xft to read
+ * from the font. name is the normalized name of the pattern.
+ */
+XftFont *
+open_font(xosd_xft *osd, FcPattern *pattern, const char *name)
+{
+  FUNCTION_START();
+  char path[PATH_MAX], *key = NULL, *value = NULL;
+  long long stamp = config_stamp();
+  FcPattern *match;
+  FcResult result;
+  XftFont *font = NULL;
+  int found = -1;
+
+  if (stamp != -1 && cache_path(path, sizeof(path)) == 0 &&
+      (key = cache_key(osd, name)) != NULL)
+    found = cache_lookup(path, stamp, key, &value);
+  if (found == 1 && (match = FcNameParse((const FcChar8 *)value)) != NULL) {
+    /* The file may be gone till fc-cache runs, then match again */
+    if ((font = XftFontOpenPattern(osd->display, match)) == NULL)
+      FcPatternDestroy(match);
+    else
+      DEBUG_MSG(Dtrace, "Font %s from %s", name, path);
+  }
+  if (font == NULL) {
+    match = XftFontMatch(osd->display, osd->screen, pattern, &result);
+    if (match != NULL && (font = XftFontOpenPattern(osd->display, match)) == NULL)
+      FcPatternDestroy(match);
+    if (font != NULL && key != NULL) {
+      FcObjectSet *os = FcObjectSetBuild(FC_FAMILY, FC_STYLE, FC_WEIGHT, FC_SLANT, FC_WIDTH,
+                                         FC_FILE, FC_INDEX, FC_SIZE, FC_PIXEL_SIZE, FC_DPI,
+                                         FC_SCALE, FC_ASPECT, FC_MATRIX, FC_ANTIALIAS, FC_RGBA,
+                                         FC_LCD_FILTER, FC_HINTING, FC_HINT_STYLE, FC_AUTOHINT,
+                                         FC_VERTICAL_LAYOUT, FC_GLOBAL_ADVANCE, FC_EMBOLDEN,
+                                         FC_SPACING, FC_CHAR_WIDTH, FC_MINSPACE, NULL);
+      FcPattern *kept = os != NULL ? FcPatternFilter(font->pattern, os) : NULL;
+      FcChar8 *s = kept != NULL ? FcNameUnparse(kept) : NULL;
+      if (s != NULL)
+        cache_store(path, stamp, found != 0, key, (const char *)s);
+      free(s);
+      if (kept != NULL)
+        FcPatternDestroy(kept);
+      if (os != NULL)
+        FcObjectSetDestroy(os);
+    }
+  }
+  free(key);
+  free(value);
+  FUNCTION_END();
+  return font;
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
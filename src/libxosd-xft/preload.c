@@ -0,0 +1,177 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <time.h>
+
+#include "intern.h"
+
+/* add_range -- append a range, joining it to the last one if they touch {{{ */
+int
+add_range(osd_range **ranges, int *n, FcChar32 first, FcChar32 last)
+{
+  osd_range *r;
+
+  if (*n > 0 && (*ranges)[*n - 1].last + 1 == first) {
+    (*ranges)[*n - 1].last = last;
+    return 0;
+  }
+  if ((r = realloc(*ranges, (*n + 1) * sizeof(osd_range))) == NULL)
+    fail(-1, "Could not allocate memory");
+  r[*n].first = first;
+  r[*n].last = last;
+  *ranges = r;
+  (*n)++;
+  return 0;
+}
+
+/* }}} */
+
+/* parse_ranges -- U+XXXX[-YYYY] separated by commas {{{ */
+static int
+parse_ranges(const char *s, osd_range **ranges, int *n)
+{
+  while (*s != '\0') {
+    unsigned long first, last;
+    char *end;
+    if (*s == ',' || isspace((unsigned char)*s)) {
+      s++;
+      continue;
+    }
+    if (strncasecmp(s, "U+", 2))
+      fail(-1, "Glyph ranges should be U+XXXX[-YYYY]");
+    first = last = strtoul(s + 2, &end, 16);
+    if (end == s + 2)
+      fail(-1, "Glyph ranges should be U+XXXX[-YYYY]");
+    s = end;
+    if (*s == '-') {
+      s++;
+      if (!strncasecmp(s, "U+", 2))
+        s += 2;
+      last = strtoul(s, &end, 16);
+      if (end == s)
+        fail(-1, "Glyph ranges should be U+XXXX[-YYYY]");
+      s = end;
+    }
+    if (first > last || last > 0x10ffff)
+      fail(-1, "Invalid glyph range");
+    if (add_range(ranges, n, first, last) == -1)
+      return -1;
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* parse_glyphs -- the codepoints of UTF-8 text or of U+XXXX ranges {{{ */
+int
+parse_glyphs(const char *glyphs, osd_range **ranges, int *n)
+{
+  const FcChar8 *s = (const FcChar8 *)glyphs;
+  int len = strlen(glyphs);
+
+  if (!strncasecmp(glyphs, "U+", 2))
+    return parse_ranges(glyphs, ranges, n);
+  while (len > 0) {
+    FcChar32 c;
+    int l = FcUtf8ToUcs4(s, &c, len);
+    if (l <= 0)
+      fail(-1, "Invalid UTF-8 in glyphs");
+    if (add_range(ranges, n, c, c) == -1)
+      return -1;
+    s += l;
+    len -= l;
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* preload -- load the glyphs waiting to be preloaded {{{
+ *
+ * Runs on the event thread. Glyphs are rendered and sent to the server in
+ * batches, for the font in use or the fallback that has the character.
+ * Characters no font has are skipped.
+ */
+void
+preload(xosd_xft *osd)
+{
+  FUNCTION_START();
+  FT_UInt missing[XFT_NMISSING];
+  XftFont *font = NULL;
+  struct timespec start, end;
+  osd_range *ranges;
+  unsigned int loaded = 0;
+  int i, n, nmissing = 0;
+  long long usec;
+
+  LOCK(osd);
+  ranges = osd->preload;
+  n = osd->npreload;
+  osd->preload = NULL;
+  osd->npreload = 0;
+  UNLOCK(osd);
+  if (n == 0) {
+    FUNCTION_END();
+    return;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (i = 0; i < n; i++) {
+    FcChar32 c;
+    for (c = ranges[i].first; c <= ranges[i].last; c++) {
+      XftFont *f = char_font(osd, osd->font->xft, c);
+      FT_UInt glyph = XftCharIndex(osd->display, f, c);
+      if (glyph == 0)
+        continue;
+      if (f != font && nmissing > 0) {
+        XftFontLoadGlyphs(osd->display, font, FcTrue, missing, nmissing);
+        nmissing = 0;
+      }
+      font = f;
+      /* Loads the batch itself when it is full */
+      if (XftFontCheckGlyph(osd->display, f, FcTrue, glyph, missing, &nmissing)) {
+        LOCK(osd);
+        touch_glyph(osd, f, glyph);
+        UNLOCK(osd);
+        loaded++;
+      }
+    }
+  }
+  if (nmissing > 0)
+    XftFontLoadGlyphs(osd->display, font, FcTrue, missing, nmissing);
+  /* Count the upload to the server in the time */
+  XSync(osd->display, False);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  free(ranges);
+  usec = (end.tv_sec - start.tv_sec) * 1000000LL + (end.tv_nsec - start.tv_nsec) / 1000;
+  DEBUG_MSG(Dvalue, "Preload { glyphs = %u, usec = %lld }", loaded, usec);
+  LOCK(osd);
+  trim_glyphs(osd);
+  osd->preload_stats.requests++;
+  osd->preload_stats.glyphs += loaded;
+  osd->preload_stats.usec += usec;
+  osd->preload_stats.last_usec = usec;
+  UNLOCK(osd);
+  FUNCTION_END();
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
@@ -0,0 +1,172 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include "intern.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* U+FFFD REPLACEMENT CHARACTER */
+static const char replacement[] = "\xef\xbf\xbd";
+
+/* ascii_span -- copy printable ASCII, returns the number of bytes copied {{{
+ *
+ * Stops at the first control character, DEL or non ASCII byte. Whole
+ * vectors are stored even when they contain such a byte; the caller
+ * overwrites the tail. This is safe since dest is at least three times
+ * the size of src.
+ */
+static size_t
+ascii_span(const unsigned char *src, size_t len, unsigned char *dest)
+{
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i space = _mm256_set1_epi8(0x20);
+  const __m256i del = _mm256_set1_epi8(0x7f);
+  while (i + 32 <= len) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+    /* Signed compare: bytes >= 0x80 are negative and so also < 0x20 */
+    __m256i bad = _mm256_or_si256(_mm256_cmpgt_epi8(space, v), _mm256_cmpeq_epi8(v, del));
+    unsigned int mask = _mm256_movemask_epi8(bad);
+    _mm256_storeu_si256((__m256i *)(dest + i), v);
+    if (mask != 0)
+      return i + __builtin_ctz(mask);
+    i += 32;
+  }
+#endif
+#if defined(__SSE2__)
+  {
+    const __m128i space = _mm_set1_epi8(0x20);
+    const __m128i del = _mm_set1_epi8(0x7f);
+    while (i + 16 <= len) {
+      __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+      __m128i bad = _mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, del));
+      unsigned int mask = _mm_movemask_epi8(bad);
+      _mm_storeu_si128((__m128i *)(dest + i), v);
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+      i += 16;
+    }
+  }
+#endif
+  for (; i < len; i++) {
+    if (src[i] < 0x20 || src[i] >= 0x7f)
+      break;
+    dest[i] = src[i];
+  }
+  return i;
+}
+
+/* }}} */
+
+/* sequence_length -- length of a valid UTF-8 sequence or the maximal invalid prefix {{{
+ *
+ * Returns the sequence length if s starts a well formed sequence, otherwise
+ * the negated length of the maximal subpart to replace (at least one byte).
+ */
+static int
+sequence_length(const unsigned char *s, size_t len)
+{
+  unsigned char lo = 0x80, hi = 0xbf;
+  int n, i;
+
+  if (s[0] >= 0xc2 && s[0] <= 0xdf)
+    n = 2;
+  else if (s[0] >= 0xe0 && s[0] <= 0xef) {
+    n = 3;
+    if (s[0] == 0xe0)
+      lo = 0xa0;          /* overlong */
+    else if (s[0] == 0xed)
+      hi = 0x9f;          /* surrogates */
+  } else if (s[0] >= 0xf0 && s[0] <= 0xf4) {
+    n = 4;
+    if (s[0] == 0xf0)
+      lo = 0x90;          /* overlong */
+    else if (s[0] == 0xf4)
+      hi = 0x8f;          /* > U+10FFFF */
+  } else
+    return -1;
+
+  for (i = 1; i < n; i++) {
+    if (i >= len || s[i] < lo || s[i] > hi)
+      return -i;
+    lo = 0x80;
+    hi = 0xbf;
+  }
+  return n;
+}
+
+/* }}} */
+
+/* utf8_sanitize -- copy text replacing invalid UTF-8 and control characters {{{
+ *
+ * Invalid sequences become U+FFFD, tabs become a space and other C0
+ * controls and DEL become the matching Control Pictures (U+2400..U+2421)
+ * so they stay visible instead of making Xft stop drawing. dest must have
+ * room for UTF8_SANITIZE_SIZE(len) bytes. The result is NUL terminated
+ * and its length is returned.
+ */
+size_t
+utf8_sanitize(const char *src, size_t len, char *dest)
+{
+  const unsigned char *s = (const unsigned char *)src;
+  unsigned char *d = (unsigned char *)dest;
+  size_t i = 0, o = 0;
+
+  while (i < len) {
+    size_t n = ascii_span(s + i, len - i, d + o);
+    i += n;
+    o += n;
+    while (i < len && (s[i] < 0x20 || s[i] >= 0x7f)) {
+      if (s[i] == '\t') {
+        d[o++] = ' ';
+        i++;
+      } else if (s[i] < 0x20 || s[i] == 0x7f) {
+        /* Control Pictures: U+2400 + c, U+2421 for DEL */
+        unsigned int c = s[i] == 0x7f ? 0x21 : s[i];
+        d[o++] = 0xe2;
+        d[o++] = 0x90;
+        d[o++] = 0x80 + c;
+        i++;
+      } else {
+        int l = sequence_length(s + i, len - i);
+        if (l > 0) {
+          memcpy(d + o, s + i, l);
+          o += l;
+          i += l;
+        } else {
+          memcpy(d + o, replacement, 3);
+          o += 3;
+          i += -l;
+        }
+      }
+    }
+  }
+  d[o] = '\0';
+  return o;
+}
+
+/* }}} */
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
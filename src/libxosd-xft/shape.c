@@ -0,0 +1,307 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include "intern.h"
+
+#ifdef HAVE_HARFBUZZ
+
+/* A run of text with one font, script and direction */
+typedef struct _item
+{
+  int                   start;
+  int                   len;
+  XftFont*              font;
+  hb_script_t           script;
+  hb_direction_t        direction;
+} item;
+
+/* hash -- FNV-1a of the text and the font {{{ */
+static uint32_t
+hash(XftFont *font, const char *text, int len)
+{
+  uint32_t h = 2166136261u ^ (uint32_t)(uintptr_t)font;
+  int i;
+
+  for (i = 0; i < len; i++)
+    h = (h ^ (unsigned char)text[i]) * 16777619u;
+  return h;
+}
+
+/* }}} */
+
+/* neutral -- a script that takes the script of the text around it {{{ */
+static int
+neutral(hb_script_t script)
+{
+  return script == HB_SCRIPT_COMMON || script == HB_SCRIPT_INHERITED || script == HB_SCRIPT_UNKNOWN;
+}
+
+/* }}} */
+
+/* itemize -- split the text into runs of one font, script and direction {{{
+ *
+ * Bidi is kept simple: characters of no script join the run they are in,
+ * a right to left run is shaped right to left and, when the first run with
+ * a script is right to left, the runs are laid out from the right.
+ * Returns the number of runs, -1 on error.
+ */
+static int
+itemize(xosd_xft *osd, XftFont *font, const char *text, int len, item **items)
+{
+  hb_unicode_funcs_t *unicode = hb_unicode_funcs_get_default();
+  const FcChar8 *s = (const FcChar8 *)text;
+  hb_direction_t base = HB_DIRECTION_INVALID;
+  int n = 0, size = 0, i = 0;
+
+  *items = NULL;
+  while (i < len) {
+    FcChar32 c;
+    int l = FcUtf8ToUcs4(s + i, &c, len - i);
+    XftFont *f;
+    hb_script_t script;
+    item *last = n > 0 ? &(*items)[n - 1] : NULL;
+    if (l <= 0) {
+      l = 1;
+      c = 0xfffd;
+    }
+    f = char_font(osd, font, c);
+    script = hb_unicode_script(unicode, c);
+    if (last != NULL && last->font == f &&
+        (neutral(script) || neutral(last->script) || script == last->script)) {
+      if (neutral(last->script) && !neutral(script)) {
+        last->script = script;
+        last->direction = hb_script_get_horizontal_direction(script);
+      }
+      last->len += l;
+    } else {
+      if (n == size) {
+        item *grown = realloc(*items, (size = size ? size * 2 : 8) * sizeof(item));
+        if (grown == NULL)
+          return -1;
+        *items = grown;
+      }
+      last = &(*items)[n++];
+      last->start = i;
+      last->len = l;
+      last->font = f;
+      last->script = script;
+      last->direction = neutral(script) ? HB_DIRECTION_LTR : hb_script_get_horizontal_direction(script);
+    }
+    i += l;
+  }
+  for (i = 0; i < n; i++) {
+    if (!HB_DIRECTION_IS_VALID((*items)[i].direction))
+      (*items)[i].direction = HB_DIRECTION_LTR;
+    if (base == HB_DIRECTION_INVALID && !neutral((*items)[i].script))
+      base = (*items)[i].direction;
+  }
+  if (base == HB_DIRECTION_RTL)
+    for (i = 0; i < n / 2; i++) {
+      item t = (*items)[i];
+      (*items)[i] = (*items)[n - 1 - i];
+      (*items)[n - 1 - i] = t;
+    }
+  return n;
+}
+
+/* }}} */
+
+/* shape_item -- shape a run, adding its glyphs at pen (26.6) {{{ */
+static int
+shape_item(xosd_xft *osd, const char *text, int len, item *it, osd_shaped *shaped, hb_position_t *pen)
+{
+  hb_glyph_info_t *info;
+  hb_glyph_position_t *pos;
+  XftGlyphFontSpec *glyphs;
+  hb_font_t *hb_font;
+  unsigned int i, n;
+  double scale;
+  FT_Face face;
+
+  hb_buffer_clear_contents(osd->hb_buffer);
+  /* The whole text is the context of the run */
+  hb_buffer_add_utf8(osd->hb_buffer, text, len, it->start, it->len);
+  hb_buffer_set_direction(osd->hb_buffer, it->direction);
+  hb_buffer_set_script(osd->hb_buffer, it->script);
+  hb_buffer_guess_segment_properties(osd->hb_buffer);
+  if ((face = XftLockFace(it->font)) == NULL)
+    return -1;
+  hb_font = hb_ft_font_create(face, NULL);
+  hb_shape(hb_font, osd->hb_buffer, NULL, 0);
+  hb_font_destroy(hb_font);
+  XftUnlockFace(it->font);
+  /* Bitmap colour fonts are shaped at the size of the strike */
+  color_font(osd, it->font, &scale);
+
+  info = hb_buffer_get_glyph_infos(osd->hb_buffer, &n);
+  pos = hb_buffer_get_glyph_positions(osd->hb_buffer, NULL);
+  if ((glyphs = realloc(shaped->glyphs, (shaped->nglyphs + n) * sizeof(XftGlyphFontSpec))) == NULL)
+    return -1;
+  shaped->glyphs = glyphs;
+  glyphs += shaped->nglyphs;
+  for (i = 0; i < n; i++) {
+    glyphs[i].font = it->font;
+    glyphs[i].glyph = info[i].codepoint;
+    glyphs[i].x = (*pen + (hb_position_t)(pos[i].x_offset * scale) + 32) >> 6;
+    glyphs[i].y = -(((hb_position_t)(pos[i].y_offset * scale) + 32) >> 6);
+    *pen += (hb_position_t)(pos[i].x_advance * scale);
+  }
+  shaped->nglyphs += n;
+  return 0;
+}
+
+/* }}} */
+
+/* free_entry -- empty an entry of the shaped text cache {{{ */
+static void
+free_entry(osd_shaped *shaped)
+{
+  free(shaped->text);
+  free(shaped->glyphs);
+  memset(shaped, 0, sizeof(*shaped));
+}
+
+/* }}} */
+
+/* shape -- the glyphs of text, shaped once and then from the cache {{{
+ *
+ * The cache is direct mapped on a hash of the text and the font, so a line
+ * drawn again, or measured and then drawn, is not shaped again. Returns NULL
+ * when the text cannot be shaped, to draw it with Xft.
+ */
+osd_shaped *
+shape(xosd_xft *osd, XftFont *font, const char *text, int len)
+{
+  uint32_t h = hash(font, text, len);
+  osd_shaped *shaped = &osd->shaped[h % SHAPE_CACHE_SIZE];
+  osd_box box = { 0, 0, 0, 0, 1 };
+  hb_position_t pen = 0;
+  XftFont *last = NULL;
+  int i, n, color = 0;
+  item *items;
+
+  if (len == 0)
+    return NULL;
+  if (shaped->text != NULL && shaped->hash == h && shaped->font == font &&
+      shaped->len == len && !memcmp(shaped->text, text, len))
+    return shaped;
+  if (osd->hb_buffer == NULL) {
+    osd->hb_buffer = hb_buffer_create();
+    if (!hb_buffer_allocation_successful(osd->hb_buffer))
+      return NULL;
+  }
+  free_entry(shaped);
+  if ((shaped->text = malloc(len)) == NULL)
+    return NULL;
+  memcpy(shaped->text, text, len);
+  if ((n = itemize(osd, font, text, len, &items)) == -1) {
+    free_entry(shaped);
+    return NULL;
+  }
+  for (i = 0; i < n; i++)
+    if (shape_item(osd, text, len, &items[i], shaped, &pen) == -1) {
+      free(items);
+      free_entry(shaped);
+      return NULL;
+    }
+  free(items);
+  for (i = 0; i < shaped->nglyphs; i++) {
+    XftGlyphFontSpec *spec = &shaped->glyphs[i];
+    osd_color_glyph *cg;
+    XGlyphInfo g;
+    if (spec->font != last) {
+      last = spec->font;
+      color = color_font(osd, last, NULL);
+    }
+    if (color && (cg = color_glyph(osd, spec->font, spec->glyph)) != NULL)
+      g = cg->info;
+    else
+      XftGlyphExtents(osd->display, spec->font, &spec->glyph, 1, &g);
+    extend(&box, spec->x, spec->y, &g);
+  }
+  box_extents(&box, (pen + 32) >> 6, 0, &shaped->extents);
+  shaped->hash = h;
+  shaped->font = font;
+  shaped->len = len;
+  DEBUG_MSG(Dvalue, "Shaped { len = %d, runs = %d, glyphs = %d }", len, n, shaped->nglyphs);
+  return shaped;
+}
+
+/* }}} */
+
+/* draw_shaped -- draw shaped text at x, y {{{
+ *
+ * Glyphs in colour are composited from the colour glyph cache, the rest
+ * are drawn with Xft in one request.
+ */
+void
+draw_shaped(xosd_xft *osd, XftColor *color, osd_shaped *shaped, int x, int y)
+{
+  XftGlyphFontSpec local[256], *glyphs = local;
+  XftFont *last = NULL;
+  int i, n = 0, in_color = 0;
+
+  if (shaped->nglyphs > 256 &&
+      (glyphs = malloc(shaped->nglyphs * sizeof(XftGlyphFontSpec))) == NULL)
+    return;
+  for (i = 0; i < shaped->nglyphs; i++) {
+    XftGlyphFontSpec *spec = &glyphs[n];
+    osd_color_glyph *cg;
+    *spec = shaped->glyphs[i];
+    spec->x += x;
+    spec->y += y;
+    if (spec->font != last) {
+      last = spec->font;
+      in_color = color_font(osd, last, NULL);
+    }
+    if (in_color && (cg = color_glyph(osd, spec->font, spec->glyph)) != NULL && cg->picture != None)
+      draw_color_glyph(osd, color, cg, spec->x, spec->y);
+    else {
+      touch_glyph(osd, spec->font, spec->glyph);
+      n++;
+    }
+  }
+  if (n > 0)
+    XftDrawGlyphFontSpec(osd->draw, color, glyphs, n);
+  if (glyphs != local)
+    free(glyphs);
+}
+
+/* }}} */
+
+/* free_shaped -- empty the shaped text cache {{{
+ *
+ * Called when a font closes, the entries point to it.
+ */
+void
+free_shaped(xosd_xft *osd)
+{
+  int i;
+
+  for (i = 0; i < SHAPE_CACHE_SIZE; i++)
+    free_entry(&osd->shaped[i]);
+}
+
+/* }}} */
+
+#endif
+
+/* {{{
+ vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ }}} */
@@ -47,7 +47,7 @@ void load_defaults(osd_settings *settings)
   settings->padding = "0";
   settings->text_align = "center";
   settings->maxlines = 1;
-  settings->lines = calloc(1, sizeof(char*));
+  settings->lines = calloc(1, sizeof(osd_line));
   FUNCTION_END();
 }
 
@@ -66,6 +66,7 @@ osd_create()
     return NULL;
   }
   load_defaults(&osd->settings);
+  pthread_mutex_init(&osd->lock, NULL);
   FUNCTION_END();
   return osd;
 }
@@ -245,7 +246,36 @@ min(unsigned int x, unsigned int y)
   return x < y ? x : y;
 }
 
-#define DIVCEIL(n, d)		(((n) + ((d) - 1)) / (d))
+/* free_line -- free the text of a line {{{ */
+static void
+free_line(osd_line *line)
+{
+  free(line->text);
+  free(line->runs);
+  line->text = NULL;
+  line->runs = NULL;
+  line->len = line->nruns = 0;
+}
+
+/* }}} */
+
+/* drop_lines -- remove the n oldest lines (called with lock held) {{{ */
+static void
+drop_lines(xosd_xft *osd, int n)
+{
+  int i;
+  if (n <= 0)
+    return;
+  if (n > osd->settings.nlines)
+    n = osd->settings.nlines;
+  for (i = 0; i < n; i++)
+    free_line(&osd->settings.lines[i]);
+  memmove(osd->settings.lines, osd->settings.lines + n,
+          (osd->settings.nlines - n) * sizeof(osd_line));
+  osd->settings.nlines -= n;
+}
+
+/* }}} */
 
 /* calc_geometry -- Calculate the geometry of OSD Window {{{ */
 void calc_geometry(xosd_xft *osd, osd_geometry *geometry)
@@ -258,19 +288,10 @@ void calc_geometry(xosd_xft *osd, osd_geometry *geometry)
   unsigned int width, height;
   unsigned int line_height, char_width;
 
-  {
-    XGlyphInfo extents;
-    static char ascii_printable[] =
-	      " !\"#$%&'()*+,-./0123456789:;<=>?"
-	      "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_"
-	      "`abcdefghijklmnopqrstuvwxyz{|}~";
-	  XftTextExtentsUtf8(osd->display, osd->font, (const FcChar8 *) ascii_printable, strlen(ascii_printable), &extents);
-	  char_width = DIVCEIL(extents.xOff, strlen(ascii_printable));
-  }
+  char_width = osd->font->metrics.char_width;
   init_padding(osd);
 
-  line_height = osd->font->ascent + osd->font->descent;
-  /* char_width = osd->font->max_advance_width; */
+  line_height = osd->font->metrics.ascent + osd->font->metrics.descent;
 
   DEBUG_MSG(Dvalue, "CalcGeometry { char_width: %u, width: %u }", char_width, geometry->width);
   width = min(osd->screen_width,
@@ -291,6 +312,7 @@ void calc_geometry(xosd_xft *osd, osd_geometry *geometry)
     int maxlines = osd->t_height / line_height ;
     fprintf(stderr, "Number of lines > displayable lines. Adjusting to %d", maxlines);
     osd->settings.maxlines = maxlines ;
+    drop_lines(osd, osd->settings.nlines - maxlines);
   }
   osd->w_width = width;
   osd->w_height = height;
@@ -355,6 +377,128 @@ void calc_geometry(xosd_xft *osd, osd_geometry *geometry)
 
 /* }}} */
 
+/* intersect -- Intersection of area with a rectangle, returns 0 if empty {{{ */
+static int
+intersect(const XRectangle *area, int x, int y, int width, int height, XRectangle *result)
+{
+  int x1 = area->x > x ? area->x : x;
+  int y1 = area->y > y ? area->y : y;
+  int x2 = area->x + area->width < x + width ? area->x + area->width : x + width;
+  int y2 = area->y + area->height < y + height ? area->y + area->height : y + height;
+
+  if (x2 <= x1 || y2 <= y1)
+    return 0;
+  result->x = x1;
+  result->y = y1;
+  result->width = x2 - x1;
+  result->height = y2 - y1;
+  return 1;
+}
+
+/* }}} */
+
+/* draw_line -- draw a line, one run at a time if it has attributes {{{
+ *
+ * With a shadow color only the text is drawn, in that color.
+ */
+static void
+draw_line(xosd_xft *osd, osd_line *line, int x, int y, XftColor *shadow)
+{
+  int i;
+
+  if (line->runs == NULL) {
+    draw_text(osd, shadow ? shadow : &osd->color, osd->font->xft, x, y, line->text, line->len);
+    return;
+  }
+  for (i = 0; i < line->nruns; i++) {
+    osd_run *run = &line->runs[i];
+    const FcChar8 *text = (const FcChar8 *)line->text + run->start;
+    XftFont *font = run->flags & ANSI_BOLD ? bold_font(osd) : osd->font->xft;
+    XftColor *fg = run->fg < 0 ? &osd->color : &osd->palette[run->fg];
+    XftColor *bg = run->bg < 0 ? NULL : &osd->palette[run->bg];
+    XGlyphInfo extents;
+    text_extents(osd, font, (const char *)text, run->len, &extents);
+    if (run->flags & ANSI_REVERSE) {
+      XftColor *t = fg;
+      fg = bg ? bg : &osd->bg_color;
+      bg = t;
+    }
+    if (shadow != NULL)
+      fg = shadow;
+    else if (bg != NULL)
+      XftDrawRect(osd->draw, bg, x, y - osd->font->metrics.ascent, extents.xOff,
+                  osd->font->metrics.ascent + osd->font->metrics.descent);
+    draw_text(osd, fg, font, x, y, (const char *)text, run->len);
+    x += extents.xOff;
+  }
+}
+
+/* }}} */
+
+/* draw_area -- redraw the lines in an area of the window (lock held) {{{ */
+static void
+draw_area(xosd_xft *osd, XRectangle area)
+{
+  XRectangle clip;
+
+  if (osd->settings.autofit_max > 0) {
+    int pt = osd->autofit_pt;
+    autofit(osd);
+    /* A new size moves every line, not only those in the area */
+    if (osd->autofit_pt != pt) {
+      area.x = 0;
+      area.y = 0;
+      area.width = osd->w_width;
+      area.height = osd->w_height;
+    }
+  }
+  XftDrawRect(osd->draw, &osd->bg_color, area.x, area.y, area.width, area.height);
+  if (osd->settings.lines != NULL && osd->settings.nlines > 0 &&
+      intersect(&area, osd->w_pad_l, osd->w_pad_t,
+                osd->w_width - osd->w_pad_r - osd->w_pad_l,
+                osd->w_height - osd->w_pad_b - osd->w_pad_t, &clip)) {
+    int i;
+    XftDrawSetClipRectangles(osd->draw, 0, 0, &clip, 1);
+    for(i = 0; i < osd->settings.nlines; i++) {
+      int len = osd->settings.lines[i].len;
+      XGlyphInfo extents;
+      if(len == 0)
+        continue;
+      if(osd->settings.maxlines > 1) {
+        int top = osd->line_height * i + osd->w_pad_t;
+        if(top >= clip.y + clip.height || top + (int)osd->line_height <= clip.y)
+          continue;
+      }
+      line_extents(osd, &osd->settings.lines[i], &extents);
+      DEBUG_MSG(Dvalue, "Extents { width = %d, height = %d, x = %d, y = %d, xOff = %d, yOff = %d }", extents.width, extents.height, extents.x, extents.y, extents.xOff, extents.yOff);
+      DEBUG_MSG(Dvalue, "Geometry: { w_x = %d, w_y = %d, w_border_width = %d, w_width = %d, w_height = %d, t_width = %d, t_height = %d, w_pad_t = %d, w_pad_r = %d, w_pad_b = %d, w_pad_l = %d}", osd->w_x, osd->w_y, osd->w_border_width, osd->w_width, osd->w_height, osd->t_width, osd->t_height, osd->w_pad_t, osd->w_pad_r, osd->w_pad_b, osd->w_pad_l);
+      int x = osd->w_pad_l + extents.x;
+      int y = osd->w_pad_t + extents.y;
+      if(osd->geometry.text_halign == XOSD_XFT_right) {
+        x += osd->t_width - extents.width ;
+      } else if(osd->geometry.text_halign == XOSD_XFT_center) {
+        x += (osd->t_width - extents.width)/2 ;
+      }
+      if(osd->settings.maxlines <= 1) {
+        if(osd->geometry.text_valign == XOSD_XFT_bottom) {
+          y += osd->t_height - extents.height;
+        } else if(osd->geometry.text_valign == XOSD_XFT_middle) {
+          y += (osd->t_height - extents.height)/2 ;
+        }
+      } else {
+        y = osd->line_height * i + osd->w_pad_t + extents.y ;
+      }
+      if(osd->settings.shadow_offset) {
+        draw_line(osd, &osd->settings.lines[i], x + osd->settings.shadow_offset, y + osd->settings.shadow_offset, &osd->shadow_color);
+      }
+      draw_line(osd, &osd->settings.lines[i], x, y, NULL);
+    }
+    XftDrawSetClip(osd->draw, NULL);
+  }
+}
+
+/* }}} */
+
 /* event_loop -- X11 event loop {{{ */
 static void *
 event_loop(void *osdv)
@@ -362,49 +506,33 @@ event_loop(void *osdv)
   xosd_xft *osd = osdv;
   Atom xosd_xft_event =  XInternAtom(osd->display, XOSD_XFT_event, False);
 
+  preload(osd);
   while (1) {
     XEvent ev;
 
     XNextEvent(osd->display, &ev);
-    if (ev.type == Expose) {
-      XftDrawRect(osd->draw, &osd->bg_color, 0, 0, osd->w_width, osd->w_height);
-      if (osd->settings.lines != NULL && osd->settings.nlines > 0) {
-        XRectangle clip;
-        int i;
-        clip.x = osd->w_pad_l;
-        clip.y = osd->w_pad_t;
-        clip.width = osd->w_width - osd->w_pad_r - osd->w_pad_l;
-        clip.height = osd->w_height - osd->w_pad_b - osd->w_pad_t;
-        XftDrawSetClipRectangles(osd->draw, 0, 0, &clip, 1);
-        for(i = 0; i < osd->settings.nlines; i++) {
-          char *message = osd->settings.lines[i];
-          XGlyphInfo extents;
-          XftTextExtentsUtf8(osd->display, osd->font, (XftChar8 *)message, strlen(message), &extents);
-          DEBUG_MSG(Dvalue, "Extents { width = %d, height = %d, x = %d, y = %d, xOff = %d, yOff = %d }", extents.width, extents.height, extents.x, extents.y, extents.xOff, extents.yOff);
-          DEBUG_MSG(Dvalue, "Geometry: { w_x = %d, w_y = %d, w_border_width = %d, w_width = %d, w_height = %d, t_width = %d, t_height = %d, w_pad_t = %d, w_pad_r = %d, w_pad_b = %d, w_pad_l = %d}", osd->w_x, osd->w_y, osd->w_border_width, osd->w_width, osd->w_height, osd->t_width, osd->t_height, osd->w_pad_t, osd->w_pad_r, osd->w_pad_b, osd->w_pad_l);
-          int x = osd->w_pad_l + extents.x;
-          int y = osd->w_pad_t + extents.y;
-          if(osd->geometry.text_halign == XOSD_XFT_right) {
-            x += osd->t_width - extents.width ;
-          } else if(osd->geometry.text_halign == XOSD_XFT_center) {
-            x += (osd->t_width - extents.width)/2 ;
-          }
-          if(osd->settings.maxlines <= 1) {
-            if(osd->geometry.text_valign == XOSD_XFT_bottom) {
-              y += osd->t_height - extents.height;
-            } else if(osd->geometry.text_valign == XOSD_XFT_middle) {
-              y += (osd->t_height - extents.height)/2 ;
-            }
-          } else {
-            y = osd->line_height * i + osd->w_pad_t + extents.y ;
-          }
-          if(osd->settings.shadow_offset) {
-            XftDrawStringUtf8(osd->draw, &osd->shadow_color, osd->font, x + osd->settings.shadow_offset, y + osd->settings.shadow_offset, (const FcChar8 *)message, strlen(message));
-          }
-          XftDrawStringUtf8(osd->draw, &osd->color, osd->font, x, y, (const FcChar8 *)message, strlen(message));
-        }
-        XftDrawSetClip(osd->draw, NULL);
+    if (ev.type == Expose || ev.type == GraphicsExpose) {
+      /* Only redraw the exposed area - a zero sized one is the whole window */
+      XRectangle area;
+      if (ev.type == Expose) {
+        area.x = ev.xexpose.x;
+        area.y = ev.xexpose.y;
+        area.width = ev.xexpose.width ? ev.xexpose.width : osd->w_width;
+        area.height = ev.xexpose.height ? ev.xexpose.height : osd->w_height;
+      } else {
+        /* Scrolled from a part of the window that was not drawn */
+        area.x = ev.xgraphicsexpose.x;
+        area.y = ev.xgraphicsexpose.y;
+        area.width = ev.xgraphicsexpose.width;
+        area.height = ev.xgraphicsexpose.height;
       }
+      LOCK(osd);
+      /* Drawn with the lines already scrolled, copying them would be wrong */
+      if (osd->scrolls > 0)
+        osd->scroll_redraw = 1;
+      draw_area(osd, area);
+      trim_glyphs(osd);
+      UNLOCK(osd);
     }
     else if (ev.type == ClientMessage && ev.xclient.message_type == xosd_xft_event) {
       if (ev.xclient.data.l[0] ==  XOSD_XFT_event_Exit) {
@@ -414,8 +542,43 @@ event_loop(void *osdv)
       } else if (ev.xclient.data.l[0] ==  XOSD_XFT_event_Hide) {
         XUnmapWindow(osd->display, osd->window);
       } else if (ev.xclient.data.l[0] ==  XOSD_XFT_event_Geometry) {
+        LOCK(osd);
         calc_geometry(osd, &osd->geometry);
+        UNLOCK(osd);
         XMoveResizeWindow(osd->display, osd->window, osd->w_x, osd->w_y, osd->w_width, osd->w_height);
+      } else if (ev.xclient.data.l[0] ==  XOSD_XFT_event_Font) {
+        int r;
+        LOCK(osd);
+        memset(osd->fits, 0, sizeof(osd->fits));
+        osd->autofit_pt = 0;
+        if((r = set_font(osd, osd->settings.fontname)) != -1) {
+          calc_geometry(osd, &osd->geometry);
+          add_range(&osd->preload, &osd->npreload, 0x20, 0x7e);
+        } else
+          fprintf(stderr, "Error in setting font %s: %s (ignoring)\n", osd->settings.fontname, osd_error);
+        UNLOCK(osd);
+        XMoveResizeWindow(osd->display, osd->window, osd->w_x, osd->w_y, osd->w_width, osd->w_height);
+        if(r != -1)
+          preload(osd);
+      } else if (ev.xclient.data.l[0] ==  XOSD_XFT_event_Monitor) {
+        int r = 0;
+        LOCK(osd);
+        /* A new scale switches fonts, the geometry is for the monitor */
+        if (init_monitor(osd) == 1) {
+          memset(osd->fits, 0, sizeof(osd->fits));
+          osd->autofit_pt = 0;
+          if((r = set_font(osd, osd->settings.fontname)) != -1)
+            add_range(&osd->preload, &osd->npreload, 0x20, 0x7e);
+          else
+            fprintf(stderr, "Error in setting font %s: %s (ignoring)\n", osd->settings.fontname, osd_error);
+        }
+        calc_geometry(osd, &osd->geometry);
+        UNLOCK(osd);
+        XMoveResizeWindow(osd->display, osd->window, osd->w_x, osd->w_y, osd->w_width, osd->w_height);
+        if(r != -1)
+          preload(osd);
+      } else if (ev.xclient.data.l[0] ==  XOSD_XFT_event_Preload) {
+        preload(osd);
       } else if (ev.xclient.data.l[0] ==  XOSD_XFT_event_Foreground) {
         XftColor xft_color ;
         if(init_color(osd, osd->settings.color, 0, &xft_color) != -1) {
@@ -440,6 +603,24 @@ event_loop(void *osdv)
         } else {
           fprintf(stderr, "Error in setting color %s: %s (ignoring)\n", osd->settings.bg_color, osd_error);
         }
+      } else if (ev.xclient.data.l[0] ==  XOSD_XFT_event_Scroll) {
+        /* The lines first .. first + count moved up by n */
+        int n = ev.xclient.data.l[3];
+        int top = osd->w_pad_t + ev.xclient.data.l[1] * osd->line_height;
+        int height = ev.xclient.data.l[2] * osd->line_height;
+        XRectangle area = { 0, top, osd->w_width, height };
+        LOCK(osd);
+        if (!osd->scroll_redraw) {
+          XCopyArea(osd->display, osd->window, osd->window, osd->gc,
+                    0, top + n * osd->line_height, osd->w_width, height - n * osd->line_height, 0, top);
+          area.y = top + height - n * osd->line_height;
+          area.height = n * osd->line_height;
+        }
+        if (--osd->scrolls == 0)
+          osd->scroll_redraw = 0;
+        draw_area(osd, area);
+        trim_glyphs(osd);
+        UNLOCK(osd);
       }
     }
   }
@@ -519,18 +700,12 @@ osd_init(xosd_xft *osd)
     osd->depth = DefaultDepth(osd->display, osd->screen);
   }
 
-  osd_init_monitor(osd->display, osd->screen, osd->settings.monitor,
-                     osd->settings.use_xrandr, osd->settings.use_xinerama,
-                     &osd->screen_width, &osd->screen_height,
-                     &osd->screen_xpos, &osd->screen_ypos);
+  init_monitor(osd);
 
-  osd->font = XftFontOpenName(osd->display, osd->screen, osd->settings.fontname);
-  if (!osd->font) {
+  if (set_font(osd, osd->settings.fontname) == -1) {
     FUNCTION_END();
-    fail(-1, "Could not open font");
+    return -1;
   }
-  DEBUG_MSG(Dvalue, "XftFont { ascent = %d, descent = %d, height = %d, max_advance_width = %d }",
-      osd->font->ascent, osd->font->descent, osd->font->height, osd->font->max_advance_width);
   calc_geometry(osd, &osd->geometry);
 
   winattr.override_redirect = 1;
@@ -576,10 +751,19 @@ osd_init(xosd_xft *osd)
       FUNCTION_END();
       return -1;
   }
+  if (init_palette(osd) == -1) {
+    FUNCTION_END();
+    return -1;
+  }
   osd->draw = XftDrawCreate(osd->display, osd->window, osd->visual, osd->colormap);
+  osd->gc = XCreateGC(osd->display, osd->window, 0, NULL);
 
   stay_on_top(osd->display, osd->window);
 
+  /* Loaded by the event thread as it starts */
+  LOCK(osd);
+  add_range(&osd->preload, &osd->npreload, 0x20, 0x7e);
+  UNLOCK(osd);
   pthread_create(&osd->event_thread, NULL, event_loop, osd);
   FUNCTION_END();
   return 0;
@@ -587,8 +771,8 @@ osd_init(xosd_xft *osd)
 
 /* }}} */
 
-/* send_expose_event -- send an expose event */
-void send_expose_event(xosd_xft *osd)
+/* send_expose_area -- send an expose event for part of the window {{{ */
+static void send_expose_area(xosd_xft *osd, int x, int y, int width, int height)
 {
   FUNCTION_START();
   XEvent exppp;
@@ -596,6 +780,10 @@ void send_expose_event(xosd_xft *osd)
   memset(&exppp, 0, sizeof(exppp));
   exppp.type = Expose;
   exppp.xexpose.window = osd->window;
+  exppp.xexpose.x = x;
+  exppp.xexpose.y = y;
+  exppp.xexpose.width = width;
+  exppp.xexpose.height = height;
   XSendEvent(osd->event_display, osd->window, False, ExposureMask, &exppp);
   XFlush(osd->event_display);
   FUNCTION_END();
@@ -603,6 +791,14 @@ void send_expose_event(xosd_xft *osd)
 
 /* }}} */
 
+/* send_expose_event -- send an expose event for the whole window {{{ */
+void send_expose_event(xosd_xft *osd)
+{
+  send_expose_area(osd, 0, 0, 0, 0);
+}
+
+/* }}} */
+
 /* osd_show --  Show the window {{{ */
 int osd_show(xosd_xft *osd)
 {
@@ -623,13 +819,122 @@ int osd_hide(xosd_xft *osd)
 
 /* }}} */
 
+/* split_lines -- Split message on newlines into sanitized lines {{{
+ *
+ * Only the last max lines can be seen, so the message is scanned backwards
+ * for them. They are stored at the end of lines, which has room for max
+ * lines. Returns the number of lines or -1 when out of memory.
+ */
+static int
+split_lines(const char *message, int len, int max, int ansi, osd_line *lines)
+{
+  const char *end = message + len, *nl;
+  int i, n = 0;
+
+  if (len > 0 && end[-1] == '\n')
+    end--;
+  while (n < max) {
+    const char *start;
+    int l;
+    nl = memrchr(message, '\n', end - message);
+    start = nl ? nl + 1 : message;
+    l = end - start;
+    if (l > 0 && start[l - 1] == '\r')
+      l--;
+    lines[max - ++n].text = (char *)start;
+    lines[max - n].len = l;
+    if (nl == NULL)
+      break;
+    end = nl;
+  }
+  for (i = max - n; i < max; i++) {
+    char *m = malloc(UTF8_SANITIZE_SIZE(lines[i].len)), *shrunk;
+    int l;
+    if (m == NULL)
+      break;
+    if (ansi)
+      l = ansi_sanitize(lines[i].text, lines[i].len, m, &lines[i].runs, &lines[i].nruns);
+    else
+      l = utf8_sanitize(lines[i].text, lines[i].len, m);
+    if (l == -1) {
+      free(m);
+      break;
+    }
+    lines[i].len = l;
+    /* Keep the larger buffer if it can not be shrunk */
+    lines[i].text = (shrunk = realloc(m, l + 1)) != NULL ? shrunk : m;
+  }
+  if (i < max) {
+    while (--i >= max - n)
+      free_line(&lines[i]);
+    return -1;
+  }
+  return n;
+}
+
+/* }}} */
+
+/* add_lines -- Split message on newlines and add (or replace) lines {{{ */
+static int
+add_lines(xosd_xft *osd, const char *message, int len, int replace)
+{
+  FUNCTION_START();
+  osd_line *lines;
+  int n, maxlines;
+
+  if (osd->display == NULL)
+  {
+    if (osd_init(osd) != 0) {
+      FUNCTION_END();
+      fail(-1, osd_error);
+    }
+  }
+  maxlines = osd->settings.maxlines;
+  if ((lines = calloc(maxlines, sizeof(osd_line))) == NULL ||
+      (n = split_lines(message, len, maxlines, osd->settings.ansi, lines)) == -1) {
+    free(lines);
+    FUNCTION_END();
+    fail(-1, "Could not allocate memory...");
+  }
+
+  LOCK(osd);
+  drop_lines(osd, replace ? osd->settings.nlines : osd->settings.nlines + n - osd->settings.maxlines);
+  memcpy(osd->settings.lines + osd->settings.nlines, lines + maxlines - n, n * sizeof(osd_line));
+  osd->settings.nlines += n;
+  UNLOCK(osd);
+  free(lines);
+
+  send_expose_event(osd);
+  FUNCTION_END();
+  osd_show(osd);
+  return 0;
+}
+
+/* }}} */
+
 /* osd_display -- Display a string {{{ */
 int osd_display(xosd_xft *osd, char *message, int len)
+{
+  return add_lines(osd, message, len, 0);
+}
+
+/* }}} */
+
+/* osd_replace -- Replace the displayed lines {{{ */
+int osd_replace(xosd_xft *osd, char *message, int len)
+{
+  return add_lines(osd, message, len, 1);
+}
+
+/* }}} */
+
+/* osd_set_lines -- Replace a range of the displayed lines {{{ */
+int osd_set_lines(xosd_xft *osd, int first, int count, char *message, int len)
 {
   FUNCTION_START();
-  int i;
-  char *m = strndup(message, len);
-  m[len] = '\0';
+  osd_line *lines;
+  int i, n;
+
   if (osd->display == NULL)
   {
     if (osd_init(osd) != 0) {
@@ -637,15 +942,37 @@ int osd_display(xosd_xft *osd, char *message, int len)
       fail(-1, osd_error);
     }
   }
-  if(osd->settings.nlines < osd->settings.maxlines) {
-    osd->settings.lines[osd->settings.nlines++] = m ;
-  } else {
-    for(i = 1; i < osd->settings.maxlines; i++) {
-      osd->settings.lines[i-1] = osd->settings.lines[i];
-    }
-    osd->settings.lines[osd->settings.nlines-1] = m ;
+  if (first < 0 || count <= 0 || first + count > osd->settings.maxlines) {
+    FUNCTION_END();
+    fail(-1, "Line range outside the window");
   }
-  send_expose_event(osd);
+  if ((lines = calloc(count, sizeof(osd_line))) == NULL ||
+      (n = split_lines(message, len, count, osd->settings.ansi, lines)) == -1) {
+    free(lines);
+    FUNCTION_END();
+    fail(-1, "Could not allocate memory...");
+  }
+
+  LOCK(osd);
+  /* Lines below the last one displayed are empty */
+  for (i = osd->settings.nlines; i < first + count; i++)
+    memset(&osd->settings.lines[i], 0, sizeof(osd_line));
+  if (osd->settings.nlines < first + count)
+    osd->settings.nlines = first + count;
+  for (i = 0; i < count; i++) {
+    osd_line *line = &osd->settings.lines[first + i];
+    free_line(line);
+    if (i < n)
+      *line = lines[count - n + i];
+  }
+  if (osd->settings.maxlines > 1)
+    send_expose_area(osd, 0, osd->w_pad_t + first * osd->line_height,
+                     osd->w_width, count * osd->line_height);
+  else
+    send_expose_event(osd);
+  UNLOCK(osd);
+  free(lines);
+
   FUNCTION_END();
   osd_show(osd);
   return 0;
@@ -653,6 +980,88 @@ int osd_display(xosd_xft *osd, char *message, int len)
 
 /* }}} */
 
+/* send_scroll_event -- send a scroll of a range of lines to App {{{ */
+static void send_scroll_event(xosd_xft *osd, int first, int count, int n)
+{
+  FUNCTION_START();
+  XEvent event;
+  memset(&event, 0, sizeof(event));
+  event.xclient.type = ClientMessage;
+  event.xclient.send_event = True;
+  event.xclient.message_type = XInternAtom(osd->event_display, XOSD_XFT_event, False);
+  event.xclient.format = 32;
+  event.xclient.window = osd->window;
+  event.xclient.data.l[0] = XOSD_XFT_event_Scroll;
+  event.xclient.data.l[1] = first;
+  event.xclient.data.l[2] = count;
+  event.xclient.data.l[3] = n;
+  XSendEvent(osd->event_display, osd->window, False, NoEventMask, &event);
+  XFlush(osd->event_display);
+  FUNCTION_END();
+}
+
+/* }}} */
+
+/* osd_scroll_lines -- Scroll a range of the displayed lines up {{{
+ *
+ * The lines move at once and the window is copied up on the event thread,
+ * so only the n lines freed at the bottom are drawn. If anything was drawn
+ * in between, with the lines already moved, the copy would move it again
+ * and the range is drawn instead.
+ */
+int osd_scroll_lines(xosd_xft *osd, int first, int count, int n)
+{
+  FUNCTION_START();
+  int i;
+
+  if (osd->display == NULL)
+  {
+    if (osd_init(osd) != 0) {
+      FUNCTION_END();
+      fail(-1, osd_error);
+    }
+  }
+  if (first < 0 || count <= 0 || first + count > osd->settings.maxlines) {
+    FUNCTION_END();
+    fail(-1, "Line range outside the window");
+  }
+  if (n <= 0) {
+    FUNCTION_END();
+    return 0;
+  }
+  if (n > count)
+    n = count;
+
+  LOCK(osd);
+  /* Lines below the last one displayed are empty */
+  for (i = osd->settings.nlines; i < first + count; i++)
+    memset(&osd->settings.lines[i], 0, sizeof(osd_line));
+  if (osd->settings.nlines < first + count)
+    osd->settings.nlines = first + count;
+  for (i = 0; i < n; i++)
+    free_line(&osd->settings.lines[first + i]);
+  memmove(osd->settings.lines + first, osd->settings.lines + first + n,
+          (count - n) * sizeof(osd_line));
+  memset(osd->settings.lines + first + count - n, 0, n * sizeof(osd_line));
+  /* A single line is aligned in the window, autofit may change the size */
+  if (osd->settings.maxlines <= 1)
+    send_expose_event(osd);
+  else if (n == count || osd->settings.autofit_max > 0)
+    send_expose_area(osd, 0, osd->w_pad_t + first * osd->line_height,
+                     osd->w_width, count * osd->line_height);
+  else {
+    if (osd->scrolls++ > 0)
+      osd->scroll_redraw = 1;
+    send_scroll_event(osd, first, count, n);
+  }
+  UNLOCK(osd);
+
+  FUNCTION_END();
+  return 0;
+}
+
+/* }}} */
+
 /* send_event -- send event to App {{{ */
 void send_event(xosd_xft *osd, long event_type)
 {
@@ -682,16 +1091,22 @@ int osd_destroy(xosd_xft *osd)
   send_event(osd, XOSD_XFT_event_Exit);
   pthread_join(osd->event_thread, NULL);
   XftColorFree(osd->display, osd->visual, osd->colormap, &osd->color);
+  free_palette(osd);
+  close_fonts(osd);
+#ifdef HAVE_HARFBUZZ
+  if (osd->hb_buffer != NULL)
+    hb_buffer_destroy(osd->hb_buffer);
+#endif
   XftDrawDestroy(osd->draw);
+  XFreeGC(osd->display, osd->gc);
   XDestroyWindow(osd->display, osd->window);
   XCloseDisplay(osd->display);
   XCloseDisplay(osd->event_display);
-  {
-    int i ;
-    for(i = 0; i < osd->settings.maxlines; i++)
-      free(osd->settings.lines[i]);
-    free(osd->settings.lines);
-  }
+  drop_lines(osd, osd->settings.nlines);
+  free(osd->settings.lines);
+  free(osd->preload);
+  free_glyphs(osd);
+  pthread_mutex_destroy(&osd->lock);
   free(osd);
   FUNCTION_END();
   return 0;
@@ -718,6 +1133,92 @@ void osd_set_font(xosd_xft *osd, const char *font)
 {
   FUNCTION_START();
   osd->settings.fontname = font;
+  if(osd->display != NULL) {
+    send_event(osd, XOSD_XFT_event_Font);
+    send_expose_event(osd);
+  }
+  FUNCTION_END();
+}
+
+/* }}} */
+
+/* osd_set_font_autofit -- size the font to fit the text {{{ */
+void osd_set_font_autofit(xosd_xft *osd, int min_pt, int max_pt)
+{
+  FUNCTION_START();
+  osd->settings.autofit_min = min_pt > 0 ? min_pt : 1;
+  osd->settings.autofit_max = max_pt >= osd->settings.autofit_min ? max_pt : 0;
+  if(osd->display != NULL) {
+    /* Back to the font as set, when turned off */
+    send_event(osd, XOSD_XFT_event_Font);
+    send_expose_event(osd);
+  }
+  FUNCTION_END();
+}
+
+/* }}} */
+
+/* osd_preload_glyphs -- load glyphs before they are first drawn {{{ */
+int osd_preload_glyphs(xosd_xft *osd, const char *glyphs)
+{
+  FUNCTION_START();
+  osd_range *ranges = NULL;
+  int i, n = 0, r = 0;
+
+  if (parse_glyphs(glyphs, &ranges, &n) == -1) {
+    free(ranges);
+    FUNCTION_END();
+    return -1;
+  }
+  LOCK(osd);
+  for (i = 0; i < n && r != -1; i++)
+    r = add_range(&osd->preload, &osd->npreload, ranges[i].first, ranges[i].last);
+  UNLOCK(osd);
+  free(ranges);
+  if(r != -1 && osd->display != NULL)
+    send_event(osd, XOSD_XFT_event_Preload);
+  FUNCTION_END();
+  return r;
+}
+
+/* }}} */
+
+/* osd_set_glyph_budget -- bound the memory of the loaded glyphs {{{ */
+void osd_set_glyph_budget(xosd_xft *osd, unsigned long bytes)
+{
+  FUNCTION_START();
+  LOCK(osd);
+  osd->settings.glyph_budget = bytes;
+  UNLOCK(osd);
+  FUNCTION_END();
+}
+
+/* }}} */
+
+/* osd_get_font_stats -- get the glyph cache statistics of the fonts {{{ */
+int osd_get_font_stats(xosd_xft *osd, osd_font_stats *stats, int n)
+{
+  FUNCTION_START();
+  int i, nfonts;
+
+  LOCK(osd);
+  nfonts = osd->nglyph_fonts;
+  for (i = 0; i < n && i < nfonts; i++)
+    stats[i] = osd->glyph_fonts[i].stats;
+  UNLOCK(osd);
+  FUNCTION_END();
+  return nfonts;
+}
+
+/* }}} */
+
+/* osd_get_preload_stats -- get the glyph preloading statistics {{{ */
+void osd_get_preload_stats(xosd_xft *osd, osd_preload_stats *stats)
+{
+  FUNCTION_START();
+  LOCK(osd);
+  *stats = osd->preload_stats;
+  UNLOCK(osd);
   FUNCTION_END();
 }
 
@@ -728,6 +1229,10 @@ void osd_set_monitor(xosd_xft *osd, int monitor)
 {
   FUNCTION_START();
   osd->settings.monitor = monitor;
+  if(osd->display != NULL) {
+    send_event(osd, XOSD_XFT_event_Monitor);
+    send_expose_event(osd);
+  }
   FUNCTION_END();
 }
 
@@ -800,6 +1305,16 @@ void osd_set_shadowcolor(xosd_xft *osd, const char *shadowcolor)
 
 /* }}} */
 
+/* osd_set_ansi -- interpret ANSI SGR escapes {{{ */
+void osd_set_ansi(xosd_xft *osd, int ansi)
+{
+  FUNCTION_START();
+  osd->settings.ansi = ansi;
+  FUNCTION_END();
+}
+
+/* }}} */
+
 /* osd_set_xinerama -- set xinerama {{{ */
 void osd_set_xinerama(xosd_xft *osd, int xinerama)
 {
@@ -814,15 +1329,38 @@ void osd_set_xinerama(xosd_xft *osd, int xinerama)
 void osd_set_number_of_lines(xosd_xft *osd, int nlines)
 {
   FUNCTION_START();
+  LOCK(osd);
   if(osd->settings.lines) {
-    int i;
-    for(i = 0; i < osd->settings.maxlines; i++)
-      free(osd->settings.lines[i]);
+    drop_lines(osd, osd->settings.nlines);
     free(osd->settings.lines);
   }
   osd->settings.maxlines = nlines;
-  osd->settings.lines = calloc(nlines, sizeof(char*));
+  osd->settings.lines = calloc(nlines, sizeof(osd_line));
+  UNLOCK(osd);
+  FUNCTION_END();
+}
+
+/* }}} */
+
+/* osd_get_number_of_lines -- Get the number of lines the window shows {{{ */
+int osd_get_number_of_lines(xosd_xft *osd)
+{
+  FUNCTION_START();
+  int nlines;
+
+  /* The geometry may fit fewer lines than were set */
+  if (osd->display == NULL)
+  {
+    if (osd_init(osd) != 0) {
+      FUNCTION_END();
+      fail(-1, osd_error);
+    }
+  }
+  LOCK(osd);
+  nlines = osd->settings.maxlines;
+  UNLOCK(osd);
   FUNCTION_END();
+  return nlines;
 }
 
 /* }}} */
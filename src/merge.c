@@ -0,0 +1,285 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "osd-cat.h"
+
+static const char *months[] = {
+  "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+  "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+/* digits -- parse exactly n digits {{{ */
+static int
+digits(const char *s, const char *end, int n, int *value)
+{
+  int i;
+  *value = 0;
+  if (end - s < n)
+    return 0;
+  for (i = 0; i < n; i++) {
+    if (s[i] < '0' || s[i] > '9')
+      return 0;
+    *value = *value * 10 + s[i] - '0';
+  }
+  return 1;
+}
+
+/* }}} */
+
+/* days_from_civil -- days since 1970-01-01 of a date {{{ */
+static long long
+days_from_civil(int y, int m, int d)
+{
+  long long era, yoe, doy, doe;
+  y -= m <= 2;
+  era = (y >= 0 ? y : y - 399) / 400;
+  yoe = y - era * 400;
+  doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+/* }}} */
+
+/* parse_time -- HH:MM:SS[.fraction], returns the end or NULL {{{ */
+static const char *
+parse_time(const char *s, const char *end, long long *ms)
+{
+  int h, m, sec, frac = 0, scale = 1000;
+  if (!digits(s, end, 2, &h) || s[2] != ':' || !digits(s + 3, end, 2, &m) ||
+      s[5] != ':' || !digits(s + 6, end, 2, &sec))
+    return NULL;
+  s += 8;
+  if (s < end && (*s == '.' || *s == ',')) {
+    for (s++; s < end && *s >= '0' && *s <= '9'; s++) {
+      if (scale > 1) {
+        scale /= 10;
+        frac += (*s - '0') * scale;
+      }
+    }
+  }
+  *ms = ((h * 60LL + m) * 60 + sec) * 1000 + frac;
+  return s;
+}
+
+/* }}} */
+
+/* parse_iso -- YYYY-MM-DD[T ]HH:MM:SS[.fff][Z|+HH[:]MM] {{{ */
+static long long
+parse_iso(const char *s, const char *end)
+{
+  int y, mon, d, oh, om;
+  long long ms;
+
+  if (!digits(s, end, 4, &y) || end - s < 11 || s[4] != '-' ||
+      !digits(s + 5, end, 2, &mon) || s[7] != '-' || !digits(s + 8, end, 2, &d) ||
+      (s[10] != 'T' && s[10] != ' ') || mon < 1 || mon > 12)
+    return -1;
+  if ((s = parse_time(s + 11, end, &ms)) == NULL)
+    return -1;
+  ms += days_from_civil(y, mon, d) * 86400000LL;
+  /* Without a zone the streams are assumed to use the same one */
+  if (s < end && (*s == '+' || *s == '-') && digits(s + 1, end, 2, &oh)) {
+    const char *p = s + 3;
+    if (p < end && *p == ':')
+      p++;
+    if (digits(p, end, 2, &om))
+      ms -= (*s == '+' ? 1 : -1) * (oh * 60LL + om) * 60000;
+  }
+  return ms;
+}
+
+/* }}} */
+
+/* parse_syslog -- "Mmm dd HH:MM:SS" in the current year {{{ */
+static long long
+parse_syslog(const char *s, const char *end)
+{
+  static int year;
+  int mon, d;
+  long long ms;
+
+  if (end - s < 15 || s[3] != ' ')
+    return -1;
+  for (mon = 0; mon < 12 && strncmp(s, months[mon], 3); mon++)
+    ;
+  if (mon == 12)
+    return -1;
+  d = (s[4] == ' ' ? 0 : s[4] - '0') * 10 + s[5] - '0';
+  if (s[5] < '0' || s[5] > '9' || s[6] != ' ' || parse_time(s + 7, end, &ms) == NULL)
+    return -1;
+  if (year == 0) {
+    time_t t = time(NULL);
+    struct tm tm;
+    year = localtime_r(&t, &tm)->tm_year + 1900;
+  }
+  return days_from_civil(year, mon + 1, d) * 86400000LL + ms;
+}
+
+/* }}} */
+
+/* parse_timestamp -- milliseconds since the epoch from the start of a line {{{
+ *
+ * Returns -1 when the line does not start with a timestamp in the given
+ * format.
+ */
+long long
+parse_timestamp(const char *line, size_t len, int format)
+{
+  const char *end = line + len;
+  long long t = -1;
+
+  if (format & MERGE_ISO)
+    t = parse_iso(line, end);
+  if (t == -1 && (format & MERGE_SYSLOG))
+    t = parse_syslog(line, end);
+  return t;
+}
+
+/* }}} */
+
+/* parse_merge_format -- iso, syslog or auto {{{ */
+int
+parse_merge_format(const char *name)
+{
+  if (name == NULL || !strcmp(name, "auto"))
+    return MERGE_ISO | MERGE_SYSLOG;
+  if (!strcmp(name, "iso"))
+    return MERGE_ISO;
+  if (!strcmp(name, "syslog"))
+    return MERGE_SYSLOG;
+  return 0;
+}
+
+/* }}} */
+
+/* Heap of sources ordered on the timestamp of the oldest queued line */
+
+/* before -- heap order {{{ */
+static int
+before(struct source *a, struct source *b)
+{
+  long long ta = queue_peek(&a->queue)->stamp;
+  long long tb = queue_peek(&b->queue)->stamp;
+  return ta < tb || (ta == tb && a < b);
+}
+
+/* }}} */
+
+/* place -- put a source at i of the heap {{{ */
+static void
+place(struct merge_heap *h, int i, struct source *s)
+{
+  h->items[i] = s;
+  s->heap_index = i;
+}
+
+/* }}} */
+
+/* sift_up -- restore the heap above i {{{ */
+static void
+sift_up(struct merge_heap *h, int i)
+{
+  struct source *s = h->items[i];
+  while (i > 0 && before(s, h->items[(i - 1) / 2])) {
+    place(h, i, h->items[(i - 1) / 2]);
+    i = (i - 1) / 2;
+  }
+  place(h, i, s);
+}
+
+/* }}} */
+
+/* sift_down -- restore the heap below i {{{ */
+static void
+sift_down(struct merge_heap *h, int i)
+{
+  struct source *s = h->items[i];
+  for (;;) {
+    int c = 2 * i + 1;
+    if (c >= h->count)
+      break;
+    if (c + 1 < h->count && before(h->items[c + 1], h->items[c]))
+      c++;
+    if (!before(h->items[c], s))
+      break;
+    place(h, i, h->items[c]);
+    i = c;
+  }
+  place(h, i, s);
+}
+
+/* }}} */
+
+/* heap_update -- reorder a source after its queue changed, O(log k) {{{
+ *
+ * A source is in the heap while it has queued lines.
+ */
+void
+heap_update(struct merge_heap *h, struct source *s)
+{
+  int i = s->heap_index;
+
+  if (i == -1) {
+    if (s->queue.count == 0)
+      return;
+    i = h->count++;
+    place(h, i, s);
+    sift_up(h, i);
+  } else if (s->queue.count == 0) {
+    struct source *last = h->items[--h->count];
+    s->heap_index = -1;
+    if (last != s) {
+      place(h, i, last);
+      sift_up(h, i);
+      sift_down(h, last->heap_index);
+    }
+  } else {
+    sift_up(h, i);
+    sift_down(h, s->heap_index);
+  }
+}
+
+/* }}} */
+
+/* heap_pop_line -- move the oldest line to out, O(log k) {{{
+ *
+ * Returns 1 if out dropped a line to make room.
+ */
+int
+heap_pop_line(struct merge_heap *h, struct line_queue *out)
+{
+  struct source *s = h->items[0];
+  struct queued_line *l = queue_peek(&s->queue);
+  int r = queue_push(out, l->text, l->len, l->arrived);
+
+  queue_pop(&s->queue);
+  heap_update(h, s);
+  return r;
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
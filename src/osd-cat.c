@@ -28,6 +28,8 @@ Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
 #include <X11/Xlib.h>
 #include <sys/time.h>
 
+#include "osd-cat.h"
+
 #ifdef HAVE_LIBXINERAMA
 int use_xinerama = True;
 #endif
@@ -50,20 +52,36 @@ static struct option long_options[] = {
     /* Main options */
     {"bg-alpha",        1, NULL, 'a'},
     {"bg-color",        1, NULL, 'b'},
+    {"ansi",            0, NULL, 'A'},
+    {"burst",           1, NULL, 'B'},
     {"color",           1, NULL, 'c'},
+    {"control",         1, NULL, 'C'},
     {"delay-in-millis", 1, NULL, 'd'},
+    {"exclude",         1, NULL, 'x'},
 #ifdef DEBUG
     {"debug",           1, NULL, 'D'},
 #endif
+    {"follow",          0, NULL, 'F'},
     {"font",            1, NULL, 'f'},
+    {"from-end",        0, NULL, 'E'},
     {"geometry",        1, NULL, 'g'},
+    {"glyph-budget",    1, NULL, 'G'},
     {"help",            0, NULL, 'h'},
+    {"highlight",       1, NULL, 'H'},
+    {"history",         1, NULL, 'S'},
+    {"match",           1, NULL, 'e'},
+    {"line-ttl",        1, NULL, 'T'},
+    {"max-latency",     1, NULL, 'L'},
+    {"merge",           2, NULL, 'M'},
 #if defined(HAVE_LIBXINERAMA) || defined(HAVE_LIBXRANDR)
     {"monitor",         1, NULL, 'm'},
 #endif
     {"number-of-lines", 1, NULL, 'n'},
     {"padding",         1, NULL, 'p'},
+    {"rate",            1, NULL, 'r'},
+    {"reorder-window",  1, NULL, 'W'},
     {"text-align",      1, NULL, 't'},
+    {"watch",           1, NULL, 'w'},
 
 /* Multihead support */
 #ifdef HAVE_LIBXINERAMA
@@ -82,7 +100,19 @@ char*     color       = "lightblue";
 char*     bg_color    = "black";
 int       bg_alpha    = 100;
 char*     padding     = "10";
-int       delay_millis = 100;
+double    rate        = 10;
+double    burst       = 1;
+int       max_latency = 0;
+int       line_ttl    = 0;
+int       watch       = 0;
+int       history_lines = 0;
+char*     control     = NULL;
+int       follow      = 0;
+int       from_end    = 0;
+int       merge_format = 0;
+int       reorder_window = 500;
+unsigned long glyph_budget = 0;
+struct filter filter;
 #if defined(HAVE_LIBXINERAMA) || defined(HAVE_LIBXRANDR)
 int       monitor = -1;
 #endif
@@ -93,22 +123,6 @@ int       nlines = 24;
 char*     debug_level = NULL;
 #endif
 
-#define TAB_LEN 8
-
-static void
-tab_replace(char *src, char *dest)
-{
-  while(*src) {
-    if(*src == '\t') {
-      for(int i = 0; i < TAB_LEN; i++)
-        *dest++ = ' ';
-    } else {
-      *dest++ = *src;
-    }
-    src++;
-  }
-}
-
 static void help(char **argv);
 int main(int argc, char *argv[])
 {
@@ -120,7 +134,7 @@ int main(int argc, char *argv[])
   {
     int option_index = 0;
     int c =
-        getopt_long(argc, argv, "D:f:c:m:g:p:b:a:d:ht:",
+        getopt_long(argc, argv, "D:f:c:m:g:G:p:b:a:d:ht:n:r:B:L:FEM::W:e:x:H:AT:w:S:C:",
                     long_options,
                     &option_index);
     if (c == -1)
@@ -145,11 +159,77 @@ int main(int argc, char *argv[])
       bg_alpha = atoi(optarg);
       break;
     case 'd':
-      delay_millis = atoi(optarg);
+      /* A delay between lines is the same as a rate */
+      rate = atoi(optarg) > 0 ? 1000.0 / atoi(optarg) : 0;
+      break;
+    case 'r':
+      rate = atof(optarg);
+      if(rate < 0) rate = 0;
+      break;
+    case 'B':
+      burst = atof(optarg);
+      if(burst < 1) burst = 1;
+      break;
+    case 'L':
+      max_latency = atoi(optarg);
+      break;
+    case 'T':
+      line_ttl = atoi(optarg);
+      break;
+    case 'w':
+      watch = atof(optarg) * 1000;
+      if(watch < 100) watch = 100;
+      break;
+    case 'S':
+      history_lines = atoi(optarg);
+      break;
+    case 'C':
+      control = optarg;
+      break;
+    case 'F':
+#ifdef HAVE_SYS_INOTIFY_H
+      follow = 1;
+#else
+      fprintf(stderr, "--follow is not supported on this system\n");
+      return EXIT_FAILURE;
+#endif
+      break;
+    case 'E':
+      from_end = 1;
+      break;
+    case 'M':
+      merge_format = parse_merge_format(optarg);
+      if (merge_format == 0)
+      {
+        fprintf(stderr, "Invalid timestamp format %s. Use iso, syslog or auto\n", optarg);
+        return EXIT_FAILURE;
+      }
+      break;
+    case 'W':
+      reorder_window = atoi(optarg);
+      if(reorder_window < 0) reorder_window = 0;
+      break;
+    case 'e':
+      if(filter_add(&filter, FILTER_MATCH, optarg) == -1)
+        return EXIT_FAILURE;
+      break;
+    case 'x':
+      if(filter_add(&filter, FILTER_EXCLUDE, optarg) == -1)
+        return EXIT_FAILURE;
+      break;
+    case 'H':
+      if(filter_add(&filter, FILTER_HIGHLIGHT, optarg) == -1)
+        return EXIT_FAILURE;
+      break;
+    case 'A':
+      filter.ansi = 1;
       break;
     case 'g':
       geometry = optarg;
       break;
+    case 'G':
+      glyph_budget = strtoul(optarg, NULL, 10) * 1024;
+      break;
     case 't':
       text_align = optarg;
       break;
@@ -197,7 +277,7 @@ int main(int argc, char *argv[])
     }
   }
 
-  xosd_xft *osd = osd_create();
+  osd = osd_create();
 #ifdef DEBUG
   osd_set_debug_level(debug_level);
 #endif
@@ -214,25 +294,75 @@ int main(int argc, char *argv[])
   osd_set_bgcolor(osd, bg_color, bg_alpha);
   osd_set_xinerama(osd, use_xinerama);
   osd_set_xrandr(osd, use_xrandr);
+  osd_set_ansi(osd, filter.ansi || filter.npatterns[FILTER_HIGHLIGHT] > 0);
+  osd_set_glyph_budget(osd, glyph_budget);
+  if(watch) {
+    int r;
+    if(optind == argc) {
+      fprintf(stderr, "No command to watch\n");
+      return EXIT_FAILURE;
+    }
+    osd_set_number_of_lines(osd, nlines);
+    if((nlines = osd_get_number_of_lines(osd)) == -1) {
+      fprintf(stderr, "%s\n", osd_error);
+      return EXIT_FAILURE;
+    }
+    r = watch_command(argv + optind, watch);
+    filter_free(&filter);
+    osd_destroy(osd);
+    return r == -1 ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+  if(control != NULL && history_lines <= 0)
+    history_lines = DEFAULT_HISTORY;
+  if(history_lines > 0 && line_ttl > 0) {
+    fprintf(stderr, "--line-ttl can't be used with --history\n");
+    return EXIT_FAILURE;
+  }
+  if(argc - optind > nlines && !merge_format)
+    nlines = argc - optind;
   osd_set_number_of_lines(osd, nlines);
-
-#define MAX_LINE 2048
+  /* The regions are split from the lines the geometry fits */
+  if((nlines = osd_get_number_of_lines(osd)) == -1) {
+    fprintf(stderr, "%s\n", osd_error);
+    return EXIT_FAILURE;
+  }
+  if(argc - optind > nlines && !merge_format) {
+    fprintf(stderr, "The window fits %d lines, not one for each of the %d files\n", nlines, argc - optind);
+    return EXIT_FAILURE;
+  }
 
   {
-    char* file = optind < argc ? argv[optind] : "-";
-    FILE* fp = strcmp(file, "-") ? fopen(file, "r") : stdin;
-    char  line[MAX_LINE] = { 0 };
-    if(fp == NULL) {
-      fprintf(stderr, "Unable to read file %s\n", file);
+    /* Each input gets its own region of the window */
+    int nsources = optind < argc ? argc - optind : 1;
+    struct source *sources = calloc(nsources, sizeof(struct source));
+    int i, opened = 0;
+
+    if(sources == NULL) {
+      fprintf(stderr, "Could not allocate memory...\n");
       return EXIT_FAILURE;
     }
-    while(fgets(line, MAX_LINE, fp) != NULL) {
-      char tline[MAX_LINE] = { 0 };
-      tab_replace(line, tline);
-      osd_display(osd, tline, strlen(line)-1);
-      usleep(delay_millis * 1000);
+    for(i = 0; i < nsources; i++) {
+      char *file = optind < argc ? argv[optind + i] : "-";
+      int first = i * nlines / nsources;
+      int count = (i + 1) * nlines / nsources - first;
+      /* Merged sources share the whole window */
+      if(merge_format) {
+        first = 0;
+        count = nlines;
+      }
+      if(source_open(&sources[opened], file, first, count, nsources > 1 && !merge_format) == 0)
+        opened++;
+    }
+    if(opened > 0)
+      cat_sources(sources, opened);
+    for(i = 0; i < opened; i++)
+      source_close(&sources[i]);
+    free(sources);
+    filter_free(&filter);
+    if(opened < nsources) {
+      osd_destroy(osd);
+      return EXIT_FAILURE;
     }
-    fclose(fp);
   }
 
   osd_destroy(osd);
@@ -242,10 +372,12 @@ int main(int argc, char *argv[])
 static void
 help(char **argv)
 {
-      fprintf(stderr, "Usage: %s [OPTION] message...\n", argv[0]);
+      fprintf(stderr, "Usage: %s [OPTION] [file...]\n", argv[0]);
+      fprintf(stderr, "       %s [OPTION] --watch=<secs> -- command [arg...]\n", argv[0]);
       fprintf(stderr, "Version: %s\n", XOSD_XFT_VERSION);
       fprintf(stderr,
-              "Display a given message on top of the display\n"
+              "Display the given files on top of the display, each in its own part of the window\n"
+              "A file can be a FIFO or a UNIX socket, - is the standard input\n"
               "\n"
               "  -h, --help                 Show this help\n"
               "  -g, --geometry=<geo>       Geometry for the window (default: %s)\n"
@@ -282,11 +414,38 @@ help(char **argv)
 #endif
 #endif
               "  -n, --number-of-lines=<n>  Number of lines to display(default: %d)\n"
+              "  -r, --rate=<n>             Lines shown per second, 0 for no limit (default: %g)\n"
+              "  -d, --delay-in-millis=<ms> Delay between lines, same as --rate=1000/<ms>\n"
+              "  -B, --burst=<n>            Lines that can be shown at once after a pause (default: %g)\n"
+              "  -L, --max-latency=<ms>     Show or skip any line within <ms> of reading it\n"
+              "                                   When more lines are waiting than fit in the\n"
+              "                                   window only the newest ones are shown\n"
+              "  -T, --line-ttl=<ms>        Remove each line <ms> after it is shown\n"
+              "  -w, --watch=<secs>         Run the command every <secs> and show its output\n"
+              "  -S, --history=<n>          Keep the last <n> lines read for scrolling back\n"
+              "  -C, --control=<fifo>       Read scroll commands from <fifo> (default history: %d)\n"
+              "                                   up [n], down [n], page-up, page-down, top,\n"
+              "                                   bottom or quit, one per line\n"
+              "  -E, --from-end             Start with the last lines of the file\n"
+#ifdef HAVE_SYS_INOTIFY_H
+              "  -F, --follow               Keep showing lines as they are appended to the file\n"
+#endif
+              "  -e, --match=<regex>        Show only the lines matching one of the patterns\n"
+              "  -x, --exclude=<regex>      Don't show the lines matching the pattern\n"
+              "  -H, --highlight=<regex>[:<color>]\n"
+              "                             Show the matching text in color (default: red)\n"
+              "                                   <color>: black, red, green, yellow, blue, magenta,\n"
+              "                                            cyan, white or bright-<color>\n"
+              "  -A, --ansi                 Show the input colored by its ANSI SGR escapes\n"
+              "  -M, --merge[=<format>]     Show the lines of all the files in timestamp order\n"
+              "                                   <format>: iso, syslog or auto (default: auto)\n"
+              "  -W, --reorder-window=<ms>  Time to wait for older lines when merging (default: %d)\n"
+              "  -G, --glyph-budget=<KiB>   Unload the least recently drawn glyphs above <KiB>\n"
 #ifdef DEBUG
               "  -D, --debug=<level>        The debug levels to be enabled\n"
               "                                   <level>: CSV of none function,locking,select,trace,value,update,all\n"
 #endif
-              "\n\n", geometry, text_align, font, color, padding, bg_color, bg_alpha, nlines );
+              "\n\n", geometry, text_align, font, color, padding, bg_color, bg_alpha, nlines, rate, burst, DEFAULT_HISTORY, reorder_window );
 }
 
 /* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
@@ -0,0 +1,218 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef OSD_CAT_H
+#define OSD_CAT_H
+
+#include <stddef.h>
+#include <sys/types.h>
+#include <regex.h>
+#include <xosd-xft.h>
+
+#define TAB_LEN 8
+#define READ_BLOCK (64 * 1024)
+#define DEFAULT_HISTORY 10000
+
+/* Line reader - reads large blocks and hands out complete lines */
+struct line_reader
+{
+  int       fd;
+  char*     buf;          /* Data read from fd */
+  size_t    size;         /* Allocated size of buf */
+  size_t    start;        /* First byte not yet handed out */
+  size_t    end;          /* End of data in buf */
+  size_t    scanned;      /* Bytes after start known not to contain a newline */
+  char*     line;         /* Tab expanded line */
+  size_t    line_size;    /* Allocated size of line */
+  int       eof;          /* fd reached end of file */
+};
+
+int reader_init(struct line_reader *r, int fd);
+void reader_free(struct line_reader *r);
+ssize_t reader_fill(struct line_reader *r);
+int reader_next(struct line_reader *r, char **line, size_t *len);
+int reader_skip(struct line_reader *r, size_t keep);
+
+/* Following a file as it grows */
+struct follower
+{
+  char*     path;
+  char*     dir;
+  char*     base;         /* Points into path */
+  int       ifd;          /* inotify descriptor */
+  int       wd;           /* Watch on the file */
+  int       dir_wd;       /* Watch on the directory after a rotation */
+  int       rotated;
+};
+
+off_t tail_offset(int fd, size_t nlines);
+int follow_init(struct follower *f, const char *path);
+void follow_free(struct follower *f);
+int follow_event(struct follower *f, struct line_reader *r);
+int follow_reopen(struct follower *f, struct line_reader *r);
+
+/* Pacing - a token bucket of lines per second */
+struct pacer
+{
+  double    rate;         /* Lines per second, 0 - unlimited */
+  double    burst;        /* Bucket size */
+  double    tokens;       /* Available tokens */
+  long long last;         /* Time of the last refill (ms) */
+};
+
+long long now_ms();
+void pacer_init(struct pacer *p, double rate, double burst, long long now);
+int pacer_take(struct pacer *p, long long now);
+void pacer_drain(struct pacer *p, long long now);
+long long pacer_wait(struct pacer *p, long long now);
+
+/* Lines waiting to be shown */
+struct queued_line
+{
+  char*     text;
+  size_t    len;
+  size_t    size;         /* Allocated size of text */
+  long long arrived;      /* Time the line was read (ms) */
+  long long stamp;        /* Timestamp of the line when merging (ms) */
+};
+
+struct line_queue
+{
+  struct queued_line* lines;
+  int       capacity;
+  int       head;
+  int       count;
+};
+
+int queue_init(struct line_queue *q, int capacity);
+void queue_free(struct line_queue *q);
+int queue_push(struct line_queue *q, const char *text, size_t len, long long now);
+struct queued_line *queue_peek(struct line_queue *q);
+void queue_pop(struct line_queue *q);
+
+/* Scrollback - the lines read, in an append only arena with an index */
+struct history
+{
+  char*     arena;        /* The lines, back to back */
+  size_t    size;         /* Allocated size of arena */
+  size_t*   index;        /* Offset of each line, and of the end */
+  int       capacity;     /* Lines kept */
+  int       count;
+  long long dropped;      /* Lines forgotten so far */
+  long long top;          /* First line in view, -1 - following the input */
+};
+
+int history_init(struct history *h, int capacity);
+void history_free(struct history *h);
+int history_add(struct history *h, const char *text, size_t len);
+const char *history_line(struct history *h, int i, size_t *len);
+int history_first(struct history *h, int nlines);
+int history_command(struct history *h, const char *cmd, int nlines);
+
+/* An input and the lines of the window it is shown in */
+struct source
+{
+  const char*         name;
+  struct line_reader  reader;
+  struct line_queue   queue;      /* Lines waiting to be shown */
+  struct line_queue   visible;    /* Lines shown, arrived is when */
+  struct history      history;    /* Lines read, with --history */
+  struct pacer        pacer;
+  struct follower     follower;
+  int                 first;      /* First line of the region */
+  int                 count;      /* Lines in the region */
+  int                 region;     /* Window is shared with other sources */
+  int                 following;
+  int                 idle;       /* At the end of a followed file */
+  int                 pollable;   /* Registered with epoll */
+  int                 ready;      /* Reported readable by epoll */
+  int                 catchup;    /* Show the newest lines at once */
+  long long           stamp;      /* Timestamp of the last line read */
+  int                 heap_index; /* In the merge heap, -1 if not */
+};
+
+int source_open(struct source *s, const char *name, int first, int count, int region);
+void source_close(struct source *s);
+int cat_sources(struct source *sources, int nsources);
+
+/* Merging the sources in timestamp order */
+#define MERGE_ISO     (1 << 0)
+#define MERGE_SYSLOG  (1 << 1)
+
+struct merge_heap
+{
+  struct source**     items;
+  int                 count;
+};
+
+long long parse_timestamp(const char *line, size_t len, int format);
+int parse_merge_format(const char *name);
+void heap_update(struct merge_heap *h, struct source *s);
+int heap_pop_line(struct merge_heap *h, struct line_queue *out);
+
+/* Filtering and highlighting lines */
+#define FILTER_MATCH      0
+#define FILTER_EXCLUDE    1
+#define FILTER_HIGHLIGHT  2
+#define FILTER_KINDS      3
+
+struct pattern
+{
+  regex_t             re;
+  char*               literal;    /* Searched with memmem when not NULL */
+  size_t              literal_len;
+  int                 color;      /* Palette index for highlights */
+};
+
+struct filter
+{
+  struct pattern*     patterns[FILTER_KINDS];
+  int                 npatterns[FILTER_KINDS];
+  char*               buf;        /* Highlighted line */
+  size_t              size;
+  int                 ansi;       /* The escapes in the input are kept */
+};
+
+int filter_add(struct filter *f, int kind, const char *arg);
+void filter_free(struct filter *f);
+int filter_accept(struct filter *f, const char *line, size_t len);
+int filter_highlight(struct filter *f, char **line, size_t *len);
+
+/* Showing the output of a command run periodically */
+int watch_command(char **argv, int interval);
+
+/* Options (osd-cat.c) */
+extern xosd_xft* osd;
+extern int nlines;
+extern double rate;
+extern double burst;
+extern int max_latency;
+extern int line_ttl;
+extern int history_lines;
+extern char* control;
+extern int follow;
+extern int from_end;
+extern int merge_format;
+extern int reorder_window;
+extern struct filter filter;
+
+#endif
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
@@ -58,6 +58,7 @@ static struct option long_options[] = {
 #endif
     {"exec",            1, NULL, 'e'},
     {"font",            1, NULL, 'f'},
+    {"autofit",         1, NULL, 'F'},
     {"geometry",        1, NULL, 'g'},
     {"help",            0, NULL, 'h'},
     {"list-fonts",      2, NULL, 'l'},
@@ -82,6 +83,8 @@ xosd_xft *osd;
 
 /* Default Values */
 char*     font          = "SauceCodePro Nerd Font:size=64:antialias=true";
+int       autofit_min   = 0;
+int       autofit_max   = 0;
 char*     color         = "ghostwhite";
 char*     bg_color      = "black";
 int       bg_alpha      = 50;
@@ -101,40 +104,26 @@ char*     search;
 char*     debug_level = NULL;
 #endif
 
-char *print_utf8(const char *s);
+typedef long (*glyph_lookup)(const char *name);
+char *utf8_transcode_dup(const char *s, glyph_lookup lookup);
 void list_fonts(char *search);
 char* find_code(char *);
+long find_unicode(const char *);
 
-#define MSG_LEN 2049
 static void help(char **argv);
 
-static char*
-replace_font_names(char *m)
+/* find_glyph -- code point for a nerd font glyph or unicode character name {{{ */
+static long
+find_glyph(const char *name)
 {
-  char buffer[MSG_LEN], *dest = &buffer[0];
-  char *src = strdup(m), *to_free = src;
-  while(src && *src) {
-    if(*src != ':' || *++src == ':') {
-      *dest++ = *src++ ;
-    } else {
-      char *end = strstr(src, ":");
-      char *code;
-      if(end != NULL)
-        *end++ = 0;
-      if((code = find_code(src)) != NULL) {
-        while(*code)
-          *dest++ = *code++;
-      } else {
-        fprintf(stderr, "Unable to find code for %s\n", src);
-      }
-      src = end;
-    }
-  }
-  *dest = '\0';
-  free(to_free);
-  return strdup(buffer);
+  char *code = find_code((char *)name);
+  if(code != NULL)
+    return strtol(code + 2, NULL, 16);
+  return find_unicode(name);
 }
 
+/* }}} */
+
 int main(int argc, char *argv[])
 {
   osd_geometry g, *parsed = &g;
@@ -145,7 +134,7 @@ int main(int argc, char *argv[])
   {
     int option_index = 0;
     int c =
-        getopt_long(argc, argv, "D:f:c:e:l::m:g:p:b:a:d:ht:s:S:",
+        getopt_long(argc, argv, "D:f:F:c:e:l::m:g:p:b:a:d:ht:s:S:",
                     long_options,
                     &option_index);
     if (c == -1)
@@ -157,6 +146,13 @@ int main(int argc, char *argv[])
     case 'f':
       font = optarg;
       break;
+    case 'F':
+      if (sscanf(optarg, "%d-%d", &autofit_min, &autofit_max) != 2 ||
+          autofit_min <= 0 || autofit_max < autofit_min) {
+        fprintf(stderr, "Invalid font size range %s. Format: min-max\n", optarg);
+        return EXIT_FAILURE;
+      }
+      break;
     case 'c':
       color = optarg;
       break;
@@ -241,6 +237,8 @@ int main(int argc, char *argv[])
   }
   osd_set_geometry(osd, parsed);
   osd_set_font(osd, font);
+  if(autofit_max > 0)
+    osd_set_font_autofit(osd, autofit_min, autofit_max);
   osd_set_monitor(osd, monitor);
   osd_set_padding(osd, padding);
   osd_set_color(osd, color);
@@ -253,8 +251,11 @@ int main(int argc, char *argv[])
   if(command)
     system(command);
 
-  char *message1 = replace_font_names(optind < argc ? argv[optind] : "XOSD_XFT YaY!!!");
-  char *message = print_utf8(message1);
+  char *message = utf8_transcode_dup(optind < argc ? argv[optind] : "XOSD_XFT YaY!!!", find_glyph);
+  if(message == NULL) {
+    fprintf(stderr, "Could not allocate memory...\n");
+    return EXIT_FAILURE;
+  }
   osd_display(osd, message, strlen(message));
 
   if(delay_millis <= 0) {
@@ -266,7 +267,6 @@ int main(int argc, char *argv[])
   }
   osd_destroy(osd);
   free(message);
-  free(message1);
   return EXIT_SUCCESS;
 }
 
@@ -278,6 +278,7 @@ help(char **argv)
       fprintf(stderr,
               "Display a key glyph OSD using nerd fonts\n"
               "The message can contain a font name between ':'. eg: :fa-home:\n"
+              "or a unicode character name between ':'. eg: :em dash:\n"
               "Use --list-fonts to find a known glyph name\n"
               "\n"
               "  -h, --help                  Show this help\n"
@@ -292,6 +293,8 @@ help(char **argv)
               "                                 halign: one of left,center,right or none\n"
               "  -f, --font=<font>           Font for display (default: %s)\n"
               "                                  <font> is Xft font name\n"
+              "  -F, --autofit=<min>-<max>   Largest font size in points from min to max the\n"
+              "                                  message fits the window at\n"
               "  -l, --list-fonts[=<search>] List known font names\n"
               "                                  <search> is part of nerd font name\n"
               "  -c, --color=<color>         Foreground color for text (default: %s)\n"
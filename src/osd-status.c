@@ -0,0 +1,323 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xosd-xft.h>
+#include <getopt.h>
+#include <locale.h>
+#include <X11/Xlib.h>
+
+#include "osd-status.h"
+
+#ifdef HAVE_LIBXINERAMA
+int use_xinerama = True;
+#endif
+
+#ifdef HAVE_LIBXRANDR
+int use_xrandr = True;
+#endif
+
+static struct option long_options[] = {
+    /* Main options */
+    {"bg-alpha",        1, NULL, 'a'},
+    {"bg-color",        1, NULL, 'b'},
+    {"color",           1, NULL, 'c'},
+#ifdef DEBUG
+    {"debug",           1, NULL, 'D'},
+#endif
+    {"font",            1, NULL, 'f'},
+    {"geometry",        1, NULL, 'g'},
+    {"help",            0, NULL, 'h'},
+#if defined(HAVE_LIBXINERAMA) || defined(HAVE_LIBXRANDR)
+    {"monitor",         1, NULL, 'm'},
+#endif
+    {"padding",         1, NULL, 'p'},
+    {"text-align",      1, NULL, 't'},
+
+/* Multihead support */
+#ifdef HAVE_LIBXINERAMA
+    {"no-xinerama",     0, &use_xinerama, False},
+#endif
+#ifdef HAVE_LIBXRANDR
+    {"no-xrandr",       0, &use_xrandr, False},
+#endif
+    {NULL,              0, NULL, 0}};
+
+xosd_xft *osd;
+
+/* Default Values */
+char*     font        = "mono:size=12";
+char*     color       = "lightblue";
+char*     bg_color    = "black";
+int       bg_alpha    = 100;
+char*     padding     = "10";
+#if defined(HAVE_LIBXINERAMA) || defined(HAVE_LIBXRANDR)
+int       monitor = -1;
+#endif
+char*     geometry = NULL;
+char*     text_align = "left";
+#ifdef DEBUG
+char*     debug_level = NULL;
+#endif
+
+static void help(char **argv);
+
+/* run -- update the providers as they fall due {{{
+ *
+ * All the providers share one timer wheel. A provider whose text did not
+ * change causes no drawing, one that did redraws only its own line.
+ */
+static int
+run(struct provider *providers, int n)
+{
+  struct wheel wheel;
+  int i;
+
+  wheel_init(&wheel);
+  for (i = 0; i < n; i++) {
+    if (provider_update(&providers[i]) == 1 &&
+        osd_set_lines(osd, providers[i].line, 1, providers[i].text, providers[i].len) == -1) {
+      fprintf(stderr, "%s\n", osd_error);
+      return -1;
+    }
+    wheel_add(&wheel, &providers[i]);
+  }
+  for (;;) {
+    long long tick = wheel_next(&wheel);
+    struct provider *p;
+
+    wheel_sleep(&wheel, tick);
+    p = wheel_expire(&wheel, tick);
+    while (p != NULL) {
+      struct provider *next = p->next;
+      int r = provider_update(p);
+      if (r == -1)
+        fprintf(stderr, "Unable to read %s\n", p->type->name);
+      else if (r == 1 && osd_set_lines(osd, p->line, 1, p->text, p->len) == -1) {
+        fprintf(stderr, "%s\n", osd_error);
+        return -1;
+      }
+      wheel_add(&wheel, p);
+      p = next;
+    }
+  }
+  return 0;
+}
+
+/* }}} */
+
+int main(int argc, char *argv[])
+{
+  osd_geometry g, *parsed = &g;
+  struct provider *providers;
+  char default_geometry[64];
+  int i, n, r;
+
+  if (setlocale(LC_ALL, "") == NULL || !XSupportsLocale())
+    fprintf(stderr, "Locale not available, expect problems with fonts.\n");
+
+  while (1)
+  {
+    int option_index = 0;
+    int c =
+        getopt_long(argc, argv, "D:f:c:m:g:p:b:a:ht:",
+                    long_options,
+                    &option_index);
+    if (c == -1)
+      break;
+    switch (c)
+    {
+    case 0:
+      break;
+    case 'f':
+      font = optarg;
+      break;
+    case 'c':
+      color = optarg;
+      break;
+    case 'p':
+      padding = optarg;
+      break;
+    case 'b':
+      bg_color = optarg;
+      break;
+    case 'a':
+      bg_alpha = atoi(optarg);
+      break;
+    case 'g':
+      geometry = optarg;
+      break;
+    case 't':
+      text_align = optarg;
+      break;
+#if defined(HAVE_LIBXINERAMA) || defined(HAVE_LIBXRANDR)
+    case 'm':
+#ifdef HAVE_LIBXRANDR
+      if (!strcmp(optarg, "active"))
+      {
+        monitor = ACTIVE;
+      }
+      else if (!strcmp(optarg, "primary"))
+      {
+        monitor = PRIMARY;
+      }
+      else
+      {
+#endif
+        monitor = atoi(optarg);
+        if (monitor == 0)
+        {
+          fprintf(stderr, "Invalid monitor %s. Numbering  starts from 1\n", optarg);
+          return EXIT_FAILURE;
+        }
+        monitor -= 1;
+#ifdef HAVE_LIBXRANDR
+      }
+#endif
+      break;
+#endif
+#ifdef DEBUG
+    case 'D':
+      debug_level = optarg;
+      break;
+#endif
+    case '?':
+    case 'h':
+    default:
+      help(argv);
+      return EXIT_SUCCESS;
+    }
+  }
+
+  /* Each provider owns a line of the window */
+  n = argc - optind;
+  if(n == 0) {
+    help(argv);
+    return EXIT_FAILURE;
+  }
+  if((providers = calloc(n, sizeof(struct provider))) == NULL) {
+    fprintf(stderr, "Could not allocate memory...\n");
+    return EXIT_FAILURE;
+  }
+  for(i = 0; i < n; i++) {
+    if(provider_open(&providers[i], argv[optind + i], i) == -1) {
+      while(i >= 0)
+        provider_close(&providers[i--]);
+      free(providers);
+      return EXIT_FAILURE;
+    }
+  }
+  if(geometry == NULL) {
+    snprintf(default_geometry, sizeof(default_geometry), "24cx%dl-30+30*top/right", n);
+    geometry = default_geometry;
+  }
+
+  osd = osd_create();
+#ifdef DEBUG
+  osd_set_debug_level(debug_level);
+#endif
+  parsed = osd_parse_geometry(geometry, text_align, parsed);
+  if(parsed == NULL) {
+    fprintf(stderr, "%s\n", osd_error);
+    return EXIT_FAILURE;
+  }
+  osd_set_geometry(osd, parsed);
+  osd_set_font(osd, font);
+  osd_set_monitor(osd, monitor);
+  osd_set_padding(osd, padding);
+  osd_set_color(osd, color);
+  osd_set_bgcolor(osd, bg_color, bg_alpha);
+  osd_set_xinerama(osd, use_xinerama);
+  osd_set_xrandr(osd, use_xrandr);
+  osd_set_number_of_lines(osd, n);
+
+  /* The geometry may fit fewer lines than there are providers */
+  if((r = osd_get_number_of_lines(osd)) == -1)
+    fprintf(stderr, "%s\n", osd_error);
+  else if(r < n) {
+    fprintf(stderr, "The window fits %d lines, not one for each of the %d providers\n", r, n);
+    r = -1;
+  } else
+    r = run(providers, n);
+  for(i = 0; i < n; i++)
+    provider_close(&providers[i]);
+  free(providers);
+  osd_destroy(osd);
+  return r == -1 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static void
+help(char **argv)
+{
+      fprintf(stderr, "Usage: %s [OPTION] provider[=arg][@secs]...\n", argv[0]);
+      fprintf(stderr, "Version: %s\n", XOSD_XFT_VERSION);
+      fprintf(stderr,
+              "Display status information read from /proc and /sys, a line for each provider\n"
+              "\n"
+              "  -h, --help                 Show this help\n"
+              "  -g, --geometry=<geo>       Geometry for the window (default: 24cx<n>l-30+30*top/right)\n"
+              "                             <geo> Format: ((width[%%c]?[xX]height[%%l]?))?([+-]xOffset[+-]yOffset)?(*valign/halign)?\n"
+              "                             Where:\n"
+              "                                 valign: one of top,middle,bottom or none\n"
+              "                                 halign: one of left,center,right or none\n"
+              "  -t, --text-align=<align>   Text alignment within the OSD window(default: %s)\n"
+              "                             <align> Format: <halign/valign>\n"
+              "                                 valign: one of top,middle,bottom or none\n"
+              "                                 halign: one of left,center,right or none\n"
+              "  -f, --font=<font>          Font for display (default: %s)\n"
+              "                                  <font> is Xft font name\n"
+              "  -c, --color=<color>        Foreground color for text (default: %s)\n"
+              "  -p, --padding=<padding>    Padding for the content (default: %s)\n"
+              "                                  <padding> Format: top right bottom left\n"
+              "  -b, --bg-color=color       Color for background (default: %s)\n"
+              "  -a, --bg-alpha=n           Background transparency (default: %d)\n"
+              "                                  <n> should between 0-100\n"
+#ifdef HAVE_LIBXINERAMA
+              "      --no-xinerama          Turn off xinerama support\n"
+#endif
+#ifdef HAVE_LIBXRANDR
+              "      --no-xrandr            Turn off xrandr support\n"
+#endif
+#ifdef HAVE_LIBXRANDR
+              "  -m, --monitor=<monitor>    Monitor to display message (default: active)\n"
+              "                                   <monitor>: Either monitor number (starts with 1),\n"
+              "                                              active or primary\n"
+#else
+#if defined(HAVE_LIBXINERAMA)
+              "  -m, --monitor=<monitor>    Monitor to display message (default: 1)\n"
+              "                                   <monitor>: monitor number (starts with 1),\n"
+#endif
+#endif
+#ifdef DEBUG
+              "  -D, --debug=<level>        The debug levels to be enabled\n"
+              "                                   <level>: CSV of none function,locking,select,trace,value,update,all\n"
+#endif
+              "\n"
+              "Providers:\n", text_align, font, color, padding, bg_color, bg_alpha);
+      provider_list();
+      fprintf(stderr,
+              "\n"
+              "  clock=<format> takes a strftime(3) format, battery=<name> and backlight=<name>\n"
+              "  the device under /sys/class\n\n");
+}
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
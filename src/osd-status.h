@@ -0,0 +1,80 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef OSD_STATUS_H
+#define OSD_STATUS_H
+
+#include <stddef.h>
+
+#define PROVIDER_TEXT 128
+
+struct provider;
+
+/* A kind of provider */
+struct provider_type
+{
+  const char*   name;
+  int           interval;     /* Default update interval (ms) */
+  int           (*open)(struct provider *p, const char *arg);
+  int           (*read)(struct provider *p, char *text, size_t size);
+};
+
+/* A provider and the line of the window it owns */
+struct provider
+{
+  const struct provider_type* type;
+  char*         arg;          /* What follows = in the spec */
+  int           fd[2];        /* Files kept open, -1 when not used */
+  long          max;          /* Maximum brightness */
+  unsigned long long busy;    /* CPU time counters at the last update */
+  unsigned long long total;
+  int           line;
+  int           interval;     /* Ticks between updates */
+  long long     due;          /* Tick of the next update */
+  struct provider* next;      /* Next in the wheel slot */
+  char          text[PROVIDER_TEXT];
+  int           len;
+};
+
+int provider_open(struct provider *p, const char *spec, int line);
+void provider_close(struct provider *p);
+int provider_update(struct provider *p);
+void provider_list(void);
+
+/* Timer wheel shared by the providers */
+#define WHEEL_TICK  100       /* ms */
+#define WHEEL_SLOTS 64
+
+struct wheel
+{
+  struct provider*  slots[WHEEL_SLOTS];
+  long long         tick;     /* Current tick */
+  long long         start;    /* Time of tick 0 (ms) */
+};
+
+void wheel_init(struct wheel *w);
+void wheel_add(struct wheel *w, struct provider *p);
+long long wheel_next(struct wheel *w);
+struct provider *wheel_expire(struct wheel *w, long long tick);
+void wheel_sleep(struct wheel *w, long long tick);
+
+#endif
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
@@ -0,0 +1,186 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "osd-cat.h"
+
+/* now_ms -- monotonic clock in milliseconds {{{ */
+long long
+now_ms()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000LL + ts.tv_nsec / 1000000;
+}
+
+/* }}} */
+
+/* pacer_init -- token bucket with rate lines per second {{{
+ *
+ * A rate of 0 disables pacing. The bucket starts full.
+ */
+void
+pacer_init(struct pacer *p, double rate, double burst, long long now)
+{
+  p->rate = rate;
+  p->burst = burst < 1 ? 1 : burst;
+  p->tokens = p->burst;
+  p->last = now;
+}
+
+/* }}} */
+
+/* refill -- add the tokens earned since the last refill {{{ */
+static void
+refill(struct pacer *p, long long now)
+{
+  if (now > p->last) {
+    p->tokens += (now - p->last) * p->rate / 1000.0;
+    if (p->tokens > p->burst)
+      p->tokens = p->burst;
+  }
+  p->last = now;
+}
+
+/* }}} */
+
+/* pacer_take -- take a token. Returns 0 if none is available {{{ */
+int
+pacer_take(struct pacer *p, long long now)
+{
+  if (p->rate <= 0)
+    return 1;
+  refill(p, now);
+  if (p->tokens < 1)
+    return 0;
+  p->tokens -= 1;
+  return 1;
+}
+
+/* }}} */
+
+/* pacer_drain -- a frame was shown out of turn, start a new interval {{{ */
+void
+pacer_drain(struct pacer *p, long long now)
+{
+  refill(p, now);
+  p->tokens = p->tokens >= 1 ? p->tokens - 1 : 0;
+}
+
+/* }}} */
+
+/* pacer_wait -- milliseconds till the next token is available {{{ */
+long long
+pacer_wait(struct pacer *p, long long now)
+{
+  if (p->rate <= 0)
+    return 0;
+  refill(p, now);
+  if (p->tokens >= 1)
+    return 0;
+  return (long long)((1 - p->tokens) * 1000.0 / p->rate) + 1;
+}
+
+/* }}} */
+
+/* queue_init -- queue holding at most capacity lines {{{ */
+int
+queue_init(struct line_queue *q, int capacity)
+{
+  memset(q, 0, sizeof(*q));
+  q->capacity = capacity;
+  q->lines = calloc(capacity, sizeof(struct queued_line));
+  return q->lines == NULL ? -1 : 0;
+}
+
+/* }}} */
+
+/* queue_free -- free a queue {{{ */
+void
+queue_free(struct line_queue *q)
+{
+  int i;
+  for (i = 0; i < q->capacity; i++)
+    free(q->lines[i].text);
+  free(q->lines);
+  q->lines = NULL;
+}
+
+/* }}} */
+
+/* queue_push -- copy a line into the queue {{{
+ *
+ * The line buffers are reused. When the queue is full the oldest line is
+ * dropped and 1 is returned. Returns -1 when out of memory.
+ */
+int
+queue_push(struct line_queue *q, const char *text, size_t len, long long now)
+{
+  int dropped = 0;
+  struct queued_line *l;
+
+  if (q->count == q->capacity) {
+    q->head = (q->head + 1) % q->capacity;
+    q->count--;
+    dropped = 1;
+  }
+  l = &q->lines[(q->head + q->count) % q->capacity];
+  if (len + 1 > l->size) {
+    char *text = realloc(l->text, len + 1);
+    if (text == NULL)
+      return -1;
+    l->text = text;
+    l->size = len + 1;
+  }
+  memcpy(l->text, text, len);
+  l->len = len;
+  l->arrived = now;
+  q->count++;
+  return dropped;
+}
+
+/* }}} */
+
+/* queue_peek -- the oldest line in the queue {{{ */
+struct queued_line *
+queue_peek(struct line_queue *q)
+{
+  return q->count ? &q->lines[q->head] : NULL;
+}
+
+/* }}} */
+
+/* queue_pop -- drop the oldest line {{{ */
+void
+queue_pop(struct line_queue *q)
+{
+  if (q->count) {
+    q->head = (q->head + 1) % q->capacity;
+    q->count--;
+  }
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
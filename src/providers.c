@@ -0,0 +1,343 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <time.h>
+
+#include "osd-status.h"
+
+#define POWER_SUPPLY "/sys/class/power_supply"
+#define BACKLIGHT "/sys/class/backlight"
+
+/* Files are read into a buffer on the stack, from offset 0 every time */
+#define READ_SIZE 512
+
+/* open_file -- open a file of the provider, keeping it for pread {{{ */
+static int
+open_file(struct provider *p, int i, const char *dir, const char *name, const char *file)
+{
+  char path[256];
+
+  if (dir != NULL)
+    snprintf(path, sizeof(path), "%s/%s/%s", dir, name, file);
+  else
+    snprintf(path, sizeof(path), "%s", file);
+  p->fd[i] = open(path, O_RDONLY | O_CLOEXEC);
+  if (p->fd[i] == -1)
+    fprintf(stderr, "Unable to open %s: %s\n", path, strerror(errno));
+  return p->fd[i];
+}
+
+/* }}} */
+
+/* read_file -- read a kept open file from the start {{{ */
+static int
+read_file(int fd, char *buf, size_t size)
+{
+  ssize_t n = pread(fd, buf, size - 1, 0);
+
+  if (n == -1)
+    return -1;
+  buf[n] = '\0';
+  return n;
+}
+
+/* }}} */
+
+/* field -- the number after name in a "name: value" file {{{ */
+static unsigned long long
+field(const char *buf, const char *name)
+{
+  const char *s = strstr(buf, name);
+  return s == NULL ? 0 : strtoull(s + strlen(name), NULL, 10);
+}
+
+/* }}} */
+
+/* clock -- the time, formatted with strftime {{{ */
+static int
+clock_open(struct provider *p, const char *arg)
+{
+  return 0;
+}
+
+static int
+clock_read(struct provider *p, char *text, size_t size)
+{
+  struct timespec ts;
+  struct tm tm;
+
+  /* Not time(), which can lag behind the second just started */
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return strftime(text, size, p->arg != NULL ? p->arg : "%H:%M:%S", localtime_r(&ts.tv_sec, &tm));
+}
+
+/* }}} */
+
+/* cpu -- CPU usage since the last update, from /proc/stat {{{ */
+static int
+cpu_open(struct provider *p, const char *arg)
+{
+  return open_file(p, 0, NULL, NULL, "/proc/stat");
+}
+
+static int
+cpu_read(struct provider *p, char *text, size_t size)
+{
+  char buf[READ_SIZE], *s = buf + 3;
+  unsigned long long v, busy = 0, total = 0, dtotal;
+  int i;
+
+  if (read_file(p->fd[0], buf, sizeof(buf)) == -1 || strncmp(buf, "cpu ", 4))
+    return -1;
+  /* user nice system idle iowait irq softirq steal */
+  for (i = 0; i < 8; i++) {
+    v = strtoull(s, &s, 10);
+    total += v;
+    if (i != 3 && i != 4)
+      busy += v;
+  }
+  dtotal = total - p->total;
+  i = dtotal ? (busy - p->busy) * 100 / dtotal : 0;
+  p->busy = busy;
+  p->total = total;
+  return snprintf(text, size, "CPU %3d%%", i);
+}
+
+/* }}} */
+
+/* mem -- memory in use, from /proc/meminfo {{{ */
+static int
+mem_open(struct provider *p, const char *arg)
+{
+  return open_file(p, 0, NULL, NULL, "/proc/meminfo");
+}
+
+static int
+mem_read(struct provider *p, char *text, size_t size)
+{
+  char buf[READ_SIZE];
+  unsigned long long total, available;
+
+  if (read_file(p->fd[0], buf, sizeof(buf)) == -1)
+    return -1;
+  total = field(buf, "MemTotal:");
+  available = field(buf, "MemAvailable:");
+  return snprintf(text, size, "Mem %.1f/%.1fG",
+                  (total - available) / 1048576.0, total / 1048576.0);
+}
+
+/* }}} */
+
+/* load -- the load averages, from /proc/loadavg {{{ */
+static int
+load_open(struct provider *p, const char *arg)
+{
+  return open_file(p, 0, NULL, NULL, "/proc/loadavg");
+}
+
+static int
+load_read(struct provider *p, char *text, size_t size)
+{
+  char buf[READ_SIZE], *s = buf;
+  int i;
+
+  if (read_file(p->fd[0], buf, sizeof(buf)) == -1)
+    return -1;
+  /* The first three fields */
+  for (i = 0; i < 3 && (s = strchr(s + 1, ' ')) != NULL; i++)
+    ;
+  if (s == NULL)
+    return -1;
+  return snprintf(text, size, "Load %.*s", (int)(s - buf), buf);
+}
+
+/* }}} */
+
+/* battery -- charge and status of a battery (default BAT0) {{{ */
+static int
+battery_open(struct provider *p, const char *arg)
+{
+  const char *name = arg != NULL ? arg : "BAT0";
+  if (open_file(p, 0, POWER_SUPPLY, name, "capacity") == -1)
+    return -1;
+  return open_file(p, 1, POWER_SUPPLY, name, "status");
+}
+
+static int
+battery_read(struct provider *p, char *text, size_t size)
+{
+  char capacity[32], status[32];
+  int n;
+
+  if (read_file(p->fd[0], capacity, sizeof(capacity)) == -1 ||
+      (n = read_file(p->fd[1], status, sizeof(status))) == -1)
+    return -1;
+  if (n > 0 && status[n - 1] == '\n')
+    status[n - 1] = '\0';
+  return snprintf(text, size, "Bat %d%% %s", atoi(capacity), status);
+}
+
+/* }}} */
+
+/* backlight -- brightness of a backlight (default the first one) {{{ */
+static int
+backlight_open(struct provider *p, const char *arg)
+{
+  char max[32];
+  struct dirent *e = NULL;
+  DIR *dir = NULL;
+
+  if (arg == NULL) {
+    if ((dir = opendir(BACKLIGHT)) != NULL)
+      while ((e = readdir(dir)) != NULL && e->d_name[0] == '.')
+        ;
+    if (e == NULL) {
+      fprintf(stderr, "No backlight found in %s\n", BACKLIGHT);
+      if (dir != NULL)
+        closedir(dir);
+      return -1;
+    }
+    arg = e->d_name;
+  }
+  if (open_file(p, 0, BACKLIGHT, arg, "max_brightness") != -1 &&
+      read_file(p->fd[0], max, sizeof(max)) != -1) {
+    /* The maximum does not change */
+    p->max = atol(max);
+    close(p->fd[0]);
+    p->fd[0] = open_file(p, 0, BACKLIGHT, arg, "brightness");
+  }
+  if (dir != NULL)
+    closedir(dir);
+  return p->fd[0];
+}
+
+static int
+backlight_read(struct provider *p, char *text, size_t size)
+{
+  char buf[32];
+
+  if (read_file(p->fd[0], buf, sizeof(buf)) == -1)
+    return -1;
+  return snprintf(text, size, "Light %ld%%", p->max > 0 ? atol(buf) * 100 / p->max : 0);
+}
+
+/* }}} */
+
+static const struct provider_type types[] = {
+  { "clock",      1000, clock_open,     clock_read },
+  { "cpu",        1000, cpu_open,       cpu_read },
+  { "mem",        2000, mem_open,       mem_read },
+  { "load",       5000, load_open,      load_read },
+  { "battery",   10000, battery_open,   battery_read },
+  { "backlight",  1000, backlight_open, backlight_read },
+  { NULL,            0, NULL,           NULL }
+};
+
+/* provider_open -- open a provider from name[=arg][@seconds] {{{
+ *
+ * The provider owns the given line of the window.
+ */
+int
+provider_open(struct provider *p, const char *spec, int line)
+{
+  const char *at = strrchr(spec, '@'), *eq = strchr(spec, '=');
+  size_t name_len;
+  int interval;
+
+  memset(p, 0, sizeof(*p));
+  p->fd[0] = p->fd[1] = -1;
+  p->line = line;
+  if (eq != NULL && at != NULL && at < eq)
+    at = NULL;
+  name_len = eq != NULL ? (size_t)(eq - spec) : at != NULL ? (size_t)(at - spec) : strlen(spec);
+  for (p->type = types; p->type->name != NULL; p->type++)
+    if (strlen(p->type->name) == name_len && !strncmp(spec, p->type->name, name_len))
+      break;
+  if (p->type->name == NULL) {
+    fprintf(stderr, "Unknown provider %s\n", spec);
+    return -1;
+  }
+  interval = at != NULL ? atof(at + 1) * 1000 : p->type->interval;
+  p->interval = interval < WHEEL_TICK ? 1 : interval / WHEEL_TICK;
+  if (eq != NULL) {
+    size_t len = at != NULL ? (size_t)(at - eq - 1) : strlen(eq + 1);
+    if ((p->arg = strndup(eq + 1, len)) == NULL)
+      return -1;
+  }
+  return p->type->open(p, p->arg) == -1 ? -1 : 0;
+}
+
+/* }}} */
+
+/* provider_close -- close the files of a provider {{{ */
+void
+provider_close(struct provider *p)
+{
+  if (p->fd[0] != -1)
+    close(p->fd[0]);
+  if (p->fd[1] != -1)
+    close(p->fd[1]);
+  free(p->arg);
+}
+
+/* }}} */
+
+/* provider_update -- read the provider {{{
+ *
+ * Returns 1 when the text changed, 0 when it did not and -1 on error.
+ */
+int
+provider_update(struct provider *p)
+{
+  char text[PROVIDER_TEXT];
+  int len = p->type->read(p, text, sizeof(text));
+
+  if (len < 0)
+    return -1;
+  if (len >= (int)sizeof(text))
+    len = sizeof(text) - 1;
+  if (len == p->len && !memcmp(text, p->text, len))
+    return 0;
+  memcpy(p->text, text, len);
+  p->len = len;
+  return 1;
+}
+
+/* }}} */
+
+/* provider_list -- print the known providers {{{ */
+void
+provider_list(void)
+{
+  const struct provider_type *t;
+  for (t = types; t->name != NULL; t++)
+    fprintf(stderr, "  %-10s every %gs\n", t->name, t->interval / 1000.0);
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
@@ -0,0 +1,208 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#define _GNU_SOURCE           /* memrchr */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "osd-cat.h"
+
+/* reader_init -- initialize a line reader for fd {{{ */
+int
+reader_init(struct line_reader *r, int fd)
+{
+  memset(r, 0, sizeof(*r));
+  r->fd = fd;
+  r->size = READ_BLOCK;
+  if ((r->buf = malloc(r->size)) == NULL)
+    return -1;
+  return 0;
+}
+
+/* }}} */
+
+/* reader_free -- free the buffers of a line reader {{{ */
+void
+reader_free(struct line_reader *r)
+{
+  free(r->buf);
+  free(r->line);
+  r->buf = r->line = NULL;
+}
+
+/* }}} */
+
+/* reader_fill -- read the next block {{{
+ *
+ * Returns the number of bytes read, 0 at end of file and -1 on error
+ * (including EAGAIN for non blocking descriptors).
+ */
+ssize_t
+reader_fill(struct line_reader *r)
+{
+  ssize_t n;
+
+  if (r->start == r->end) {
+    r->start = r->end = r->scanned = 0;
+  } else if (r->end == r->size) {
+    if (r->start > 0) {
+      /* Move the partial line to the front */
+      memmove(r->buf, r->buf + r->start, r->end - r->start);
+      r->end -= r->start;
+      r->start = 0;
+    } else {
+      /* A line longer than the buffer - grow it */
+      char *buf = realloc(r->buf, r->size * 2);
+      if (buf == NULL)
+        return -1;
+      r->buf = buf;
+      r->size *= 2;
+    }
+  }
+  do {
+    n = read(r->fd, r->buf + r->end, r->size - r->end);
+  } while (n == -1 && errno == EINTR);
+  if (n == 0)
+    r->eof = 1;
+  else if (n > 0)
+    r->end += n;
+  return n;
+}
+
+/* }}} */
+
+/* expand_tabs -- copy a line into r->line expanding tabs {{{ */
+static ssize_t
+expand_tabs(struct line_reader *r, const char *s, size_t len, const char *tab)
+{
+  size_t column = 0, o = 0;
+  const char *end = s + len;
+
+  while (s < end) {
+    size_t n = tab ? tab - s : end - s;
+    size_t need = o + n + TAB_LEN + 1;
+    size_t i;
+    if (need > r->line_size) {
+      size_t size = r->line_size ? r->line_size : 256;
+      char *line;
+      while (size < need)
+        size *= 2;
+      if ((line = realloc(r->line, size)) == NULL)
+        return -1;
+      r->line = line;
+      r->line_size = size;
+    }
+    memcpy(r->line + o, s, n);
+    o += n;
+    /* Columns count characters - skip UTF-8 continuation bytes */
+    for (i = 0; i < n; i++)
+      column += (s[i] & 0xc0) != 0x80;
+    s += n;
+    if (tab) {
+      do {
+        r->line[o++] = ' ';
+      } while (++column % TAB_LEN);
+      s++;
+      tab = memchr(s, '\t', end - s);
+    }
+  }
+  return o;
+}
+
+/* }}} */
+
+/* reader_next -- get the next complete line {{{
+ *
+ * Returns 1 and sets line/len when a line is available. The line stays
+ * valid till the next call to reader_next or reader_fill. At end of file a
+ * last line without a newline is returned as well. Returns 0 when more
+ * data has to be read and -1 when out of memory.
+ */
+int
+reader_next(struct line_reader *r, char **line, size_t *len)
+{
+  char *s = r->buf + r->start;
+  char *nl = memchr(s + r->scanned, '\n', r->end - r->start - r->scanned);
+  char *tab;
+  ssize_t n;
+
+  if (nl == NULL) {
+    r->scanned = r->end - r->start;
+    if (!r->eof || r->start == r->end)
+      return 0;
+    n = r->end - r->start;
+    r->start = r->end;
+  } else {
+    n = nl - s;
+    r->start += n + 1;
+  }
+  r->scanned = 0;
+  if (n > 0 && s[n - 1] == '\r')
+    n--;
+  if ((tab = memchr(s, '\t', n)) == NULL) {
+    *line = s;
+    *len = n;
+    return 1;
+  }
+  if ((n = expand_tabs(r, s, n, tab)) < 0)
+    return -1;
+  *line = r->line;
+  *len = n;
+  return 1;
+}
+
+/* }}} */
+
+/* reader_skip -- drop all but the last keep complete lines {{{
+ *
+ * Used to catch up when lines arrive faster than they can be shown.
+ * Returns 1 if any line was dropped.
+ */
+int
+reader_skip(struct line_reader *r, size_t keep)
+{
+  char *s = r->buf + r->start;
+  char *end = r->buf + r->end;
+
+  if (!r->eof) {
+    if ((end = memrchr(s, '\n', end - s)) == NULL)
+      return 0;
+  } else if (keep == 0) {
+    r->start = r->end;
+    r->scanned = 0;
+    return 1;
+  } else if (end > s && end[-1] == '\n') {
+    end--;
+  }
+  while (keep-- > 0) {
+    if ((end = memrchr(s, '\n', end - s)) == NULL)
+      return 0;
+  }
+  r->start = end + 1 - r->buf;
+  r->scanned = 0;
+  return 1;
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
@@ -0,0 +1,664 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <stdint.h>
+#include <xosd-xft.h>
+
+#include "osd-cat.h"
+
+#define MAX_EVENTS 16
+
+/* epoll data of the control FIFO */
+#define CONTROL UINT64_MAX
+
+/* Lines joined for a single update */
+static char *batch;
+static size_t batch_size;
+
+/* Partial command read from the control FIFO */
+static char command[256];
+static size_t command_len;
+
+/* open_input -- open a file, FIFO, UNIX socket or "-" for stdin {{{ */
+static int
+open_input(const char *name, struct stat *st)
+{
+  int fd;
+
+  if (!strcmp(name, "-")) {
+    fstat(STDIN_FILENO, st);
+    return STDIN_FILENO;
+  }
+  if (stat(name, st) == -1)
+    return -1;
+  if (S_ISSOCK(st->st_mode)) {
+    struct sockaddr_un addr;
+    if (strlen(name) >= sizeof(addr.sun_path)) {
+      errno = ENAMETOOLONG;
+      return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, name);
+    if ((fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) == -1)
+      return -1;
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+      close(fd);
+      return -1;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+  }
+  /* Don't wait for a writer to open a FIFO */
+  return open(name, O_RDONLY | O_CLOEXEC | (S_ISFIFO(st->st_mode) ? O_NONBLOCK : 0));
+}
+
+/* }}} */
+
+/* source_open -- open an input shown in lines first .. first + count - 1 {{{ */
+int
+source_open(struct source *s, const char *name, int first, int count, int region)
+{
+  struct stat st;
+  int fd;
+
+  memset(s, 0, sizeof(*s));
+  s->name = name;
+  s->first = first;
+  s->count = count;
+  s->region = region;
+  if ((fd = open_input(name, &st)) == -1) {
+    fprintf(stderr, "Unable to read file %s: %s\n", name, strerror(errno));
+    return -1;
+  }
+  if (reader_init(&s->reader, fd) == -1 || queue_init(&s->queue, count) == -1 ||
+      queue_init(&s->visible, count) == -1 ||
+      (history_lines > 0 && history_init(&s->history, history_lines) == -1)) {
+    fprintf(stderr, "Could not allocate memory...\n");
+    close(fd);
+    return -1;
+  }
+  if (from_end) {
+    /* Start with the last screenful, shown at once */
+    off_t offset = tail_offset(fd, count);
+    if (offset > 0)
+      lseek(fd, offset, SEEK_SET);
+    s->catchup = 1;
+  }
+#ifdef HAVE_SYS_INOTIFY_H
+  if (follow && S_ISREG(st.st_mode) && strcmp(name, "-")) {
+    if (follow_init(&s->follower, name) == -1) {
+      fprintf(stderr, "Unable to follow %s: %s\n", name, strerror(errno));
+      follow_free(&s->follower);
+    } else
+      s->following = 1;
+  }
+#endif
+  pacer_init(&s->pacer, rate, burst, now_ms());
+  return 0;
+}
+
+/* }}} */
+
+/* source_close -- release the resources of a source {{{ */
+void
+source_close(struct source *s)
+{
+#ifdef HAVE_SYS_INOTIFY_H
+  if (s->following)
+    follow_free(&s->follower);
+#endif
+  if (s->reader.buf != NULL)
+    close(s->reader.fd);
+  queue_free(&s->queue);
+  queue_free(&s->visible);
+  history_free(&s->history);
+  reader_free(&s->reader);
+}
+
+/* }}} */
+
+/* join -- append a line to the batch {{{ */
+static int
+join(size_t *n, const char *text, size_t len)
+{
+  if (*n + len + 1 > batch_size) {
+    size_t new_size = batch_size ? batch_size : READ_BLOCK;
+    char *b;
+    while (new_size < *n + len + 1)
+      new_size *= 2;
+    if ((b = realloc(batch, new_size)) == NULL) {
+      osd_error = "Could not allocate memory...";
+      return -1;
+    }
+    batch = b;
+    batch_size = new_size;
+  }
+  memcpy(batch + *n, text, len);
+  *n += len;
+  batch[(*n)++] = '\n';
+  return 0;
+}
+
+/* }}} */
+
+/* redraw -- replace the lines of the source with its visible lines {{{ */
+static int
+redraw(struct source *s)
+{
+  struct queued_line *l;
+  size_t n = 0;
+  int i;
+
+  for (i = 0; i < s->visible.count; i++) {
+    l = &s->visible.lines[(s->visible.head + i) % s->visible.capacity];
+    if (join(&n, l->text, l->len) == -1)
+      return -1;
+  }
+  return osd_set_lines(osd, s->first, s->count, batch, n);
+}
+
+/* }}} */
+
+/* show_history -- draw the lines of the history in view {{{
+ *
+ * Only the lines in view are looked at, whatever the size of the history.
+ */
+static int
+show_history(struct source *s)
+{
+  struct history *h = &s->history;
+  int first = history_first(h, s->count), i;
+  size_t n = 0;
+
+  for (i = first; i < h->count && i < first + s->count; i++) {
+    size_t len;
+    const char *text = history_line(h, i, &len);
+    if (join(&n, text, len) == -1)
+      return -1;
+  }
+  return osd_set_lines(osd, s->first, s->count, batch, n);
+}
+
+/* }}} */
+
+/* show -- show the oldest queued line, or all of them, in one update {{{
+ *
+ * With --history the lines shown are kept in the history. A source with a
+ * region of the window, or with lines that expire, keeps the lines it shows
+ * and replaces its lines, otherwise the lines scroll through the whole
+ * window.
+ */
+static int
+show(struct source *s, int all, long long now)
+{
+  struct queued_line *l;
+  size_t n = 0;
+
+  if (history_lines > 0) {
+    /* Scrolled back, the lines are only kept */
+    while ((l = queue_peek(&s->queue)) != NULL) {
+      if (history_add(&s->history, l->text, l->len) == -1) {
+        osd_error = "Could not allocate memory...";
+        return -1;
+      }
+      queue_pop(&s->queue);
+      if (!all)
+        break;
+    }
+    return s->history.top == -1 ? show_history(s) : 0;
+  }
+  if (!s->region && line_ttl <= 0) {
+    if (!all) {
+      l = queue_peek(&s->queue);
+      osd_display(osd, l->text, l->len);
+      queue_pop(&s->queue);
+      return 0;
+    }
+    while ((l = queue_peek(&s->queue)) != NULL) {
+      if (join(&n, l->text, l->len) == -1)
+        return -1;
+      queue_pop(&s->queue);
+    }
+    return osd_display(osd, batch, n);
+  }
+  while ((l = queue_peek(&s->queue)) != NULL) {
+    if (queue_push(&s->visible, l->text, l->len, now) == -1) {
+      osd_error = "Could not allocate memory...";
+      return -1;
+    }
+    queue_pop(&s->queue);
+    if (!all)
+      break;
+  }
+  return redraw(s);
+}
+
+/* }}} */
+
+/* source_expire -- remove the lines shown line_ttl ago {{{
+ *
+ * The visible lines are in the order they were shown, so the ones that
+ * expire are at the head. The rest are scrolled up, which draws only the
+ * lines freed at the bottom.
+ */
+static int
+source_expire(struct source *s, long long now)
+{
+  int expired = 0;
+
+  if (line_ttl <= 0)
+    return 0;
+  while (s->visible.count > 0 && queue_peek(&s->visible)->arrived + line_ttl <= now) {
+    queue_pop(&s->visible);
+    expired++;
+  }
+  return expired ? osd_scroll_lines(osd, s->first, s->count, expired) : 0;
+}
+
+/* }}} */
+
+/* source_read -- read the available data and queue the lines {{{
+ *
+ * Returns 0 when the source is at its end, 1 when there is more to read
+ * and -1 on error.
+ */
+static int
+source_read(struct source *s)
+{
+  ssize_t n = reader_fill(&s->reader);
+  long long now;
+  char *line;
+  size_t len;
+  int r;
+
+  if (n == -1) {
+    if (errno == EAGAIN)
+      return 1;
+    fprintf(stderr, "Error reading %s: %s\n", s->name, strerror(errno));
+    return -1;
+  }
+  if (n == 0 && s->following) {
+    /* Not the end - the partial last line waits for the rest */
+    s->reader.eof = 0;
+#ifdef HAVE_SYS_INOTIFY_H
+    s->idle = !follow_reopen(&s->follower, &s->reader);
+#endif
+  }
+  /* Only the last lines of a backlog can be seen (unless some are filtered
+   * or kept for scrolling back) */
+  if (filter.npatterns[FILTER_MATCH] == 0 && filter.npatterns[FILTER_EXCLUDE] == 0 &&
+      history_lines <= 0)
+    s->catchup |= reader_skip(&s->reader, s->count);
+  now = now_ms();
+  while ((r = reader_next(&s->reader, &line, &len)) == 1) {
+    /* Filtered lines never reach the library */
+    if (!filter_accept(&filter, line, len))
+      continue;
+    if (merge_format) {
+      /* Lines without a timestamp stay with the one before them. Parsed
+       * before highlighting, which may put escapes at the start */
+      long long t = parse_timestamp(line, len, merge_format);
+      if (t != -1)
+        s->stamp = t;
+    }
+    if (filter.npatterns[FILTER_HIGHLIGHT] > 0 &&
+        (r = filter_highlight(&filter, &line, &len)) == -1)
+      break;
+    if (history_lines > 0 && s->queue.count == s->queue.capacity) {
+      /* Lines skipped to catch up can still be scrolled back to */
+      struct queued_line *l = queue_peek(&s->queue);
+      if ((r = history_add(&s->history, l->text, l->len)) == -1)
+        break;
+      queue_pop(&s->queue);
+      s->catchup = 1;
+    }
+    if ((r = queue_push(&s->queue, line, len, now)) == -1)
+      break;
+    s->queue.lines[(s->queue.head + s->queue.count - 1) % s->queue.capacity].stamp = s->stamp;
+    s->catchup |= r;
+  }
+  if (r == -1) {
+    fprintf(stderr, "Could not allocate memory...\n");
+    return -1;
+  }
+  return !s->reader.eof;
+}
+
+/* }}} */
+
+/* source_dispatch -- show the queued lines the pacer allows {{{
+ *
+ * Lines are shown one at a time as tokens become available. When more
+ * lines are waiting than fit, or the oldest one has waited longer than
+ * max_latency, the newest ones are shown at once.
+ */
+static int
+source_dispatch(struct source *s, long long now)
+{
+  if (s->queue.count == 0)
+    return 0;
+  if (s->catchup || rate <= 0 ||
+      (max_latency > 0 && queue_peek(&s->queue)->arrived + max_latency <= now)) {
+    s->catchup = 0;
+    pacer_drain(&s->pacer, now);
+    return show(s, 1, now);
+  }
+  while (s->queue.count > 0 && pacer_take(&s->pacer, now)) {
+    if (show(s, 0, now) == -1)
+      return -1;
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* sooner -- the earlier of a timeout (-1 for none) and a due time {{{ */
+static long long
+sooner(long long wait, long long due)
+{
+  if (due < 0)
+    due = 0;
+  return wait == -1 || due < wait ? due : wait;
+}
+
+/* }}} */
+
+/* source_timeout -- milliseconds till the source needs attention {{{
+ *
+ * Returns -1 when the source has nothing queued, nothing to expire and
+ * nothing to read, so that an idle loop runs no timer at all.
+ */
+static long long
+source_timeout(struct source *s, long long now, int merging)
+{
+  long long wait = -1;
+
+  /* Regular files are always readable - epoll does not take them */
+  if (!s->reader.eof && !s->idle && !s->pollable)
+    return 0;
+  if (s->queue.count > 0 && merging) {
+    wait = sooner(wait, queue_peek(&s->queue)->arrived + reorder_window - now);
+  } else if (s->queue.count > 0) {
+    wait = sooner(wait, pacer_wait(&s->pacer, now));
+    if (max_latency > 0)
+      wait = sooner(wait, queue_peek(&s->queue)->arrived + max_latency - now);
+  }
+  if (line_ttl > 0 && s->visible.count > 0)
+    wait = sooner(wait, queue_peek(&s->visible)->arrived + line_ttl - now);
+  return wait;
+}
+
+/* }}} */
+
+/* merge -- pass on the lines that nothing older can precede any more {{{
+ *
+ * The oldest queued line goes to out once every open source has a line
+ * queued, or once it has waited reorder_window. The heap is kept across
+ * calls, updated as sources read lines, so this is O(log k) per line for k
+ * sources. waiting is the number of open sources with nothing queued.
+ */
+static int
+merge(struct merge_heap *h, int waiting, struct source *out, long long now)
+{
+  while (h->count > 0) {
+    struct source *s = h->items[0];
+    int r;
+    if (waiting > 0 && queue_peek(&s->queue)->arrived + reorder_window > now)
+      break;
+    if ((r = heap_pop_line(h, &out->queue)) == -1)
+      return -1;
+    out->catchup |= r;
+    if (s->queue.count == 0 && !s->reader.eof)
+      waiting++;
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* control_read -- run the commands written to the control FIFO {{{
+ *
+ * Scroll commands apply to the history of every source. Returns 1 after
+ * quit, 0 otherwise.
+ */
+static int
+control_read(int fd, struct source *sources, int nsources)
+{
+  ssize_t n;
+  char *nl;
+
+  while ((n = read(fd, command + command_len, sizeof(command) - command_len - 1)) > 0) {
+    command_len += n;
+    command[command_len] = '\0';
+    while ((nl = strchr(command, '\n')) != NULL) {
+      int i;
+      *nl = '\0';
+      if (!strcmp(command, "quit"))
+        return 1;
+      for (i = 0; i < nsources && command[0] != '\0'; i++) {
+        int r = history_command(&sources[i].history, command, sources[i].count);
+        if (r == -1) {
+          fprintf(stderr, "Unknown command %s\n", command);
+          break;
+        }
+        if (r == 1 && show_history(&sources[i]) == -1)
+          fprintf(stderr, "Could not allocate memory...\n");
+      }
+      command_len -= nl + 1 - command;
+      memmove(command, nl + 1, command_len + 1);
+    }
+    /* A line too long to be a command */
+    if (command_len == sizeof(command) - 1)
+      command_len = 0;
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* cat_sources -- show the lines from all the sources {{{
+ *
+ * One epoll loop drives all the sources. Pipes, FIFOs and sockets are
+ * read when epoll reports them, followed files when inotify does, other
+ * regular files whenever there is room. When merging, the lines of all
+ * the sources go through one queue in timestamp order. With a control
+ * FIFO the window stays up, for scrolling, after the inputs end.
+ */
+int
+cat_sources(struct source *sources, int nsources)
+{
+  struct epoll_event events[MAX_EVENTS];
+  struct merge_heap heap;
+  struct source out;
+  int epfd = epoll_create1(EPOLL_CLOEXEC);
+  int active = nsources;
+  int control_fd = -1, quit = 0;
+  int i;
+
+  if (epfd == -1) {
+    perror("epoll_create1");
+    return -1;
+  }
+  memset(&out, 0, sizeof(out));
+  if (merge_format) {
+    out.name = "merge";
+    out.reader.eof = 1;
+    out.count = nlines;
+    heap.items = calloc(nsources, sizeof(struct source *));
+    heap.count = 0;
+    if (heap.items == NULL || queue_init(&out.queue, nlines) == -1 ||
+        queue_init(&out.visible, nlines) == -1 ||
+        (history_lines > 0 && history_init(&out.history, history_lines) == -1)) {
+      fprintf(stderr, "Could not allocate memory...\n");
+      free(heap.items);
+      queue_free(&out.queue);
+      queue_free(&out.visible);
+      history_free(&out.history);
+      close(epfd);
+      return -1;
+    }
+    pacer_init(&out.pacer, rate, burst, now_ms());
+  }
+  for (i = 0; i < nsources; i++) {
+    struct source *s = &sources[i];
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.u64 = (uint64_t)i << 1;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, s->reader.fd, &ev) == 0)
+      s->pollable = 1;
+#ifdef HAVE_SYS_INOTIFY_H
+    if (s->following) {
+      ev.data.u64 |= 1;
+      epoll_ctl(epfd, EPOLL_CTL_ADD, s->follower.ifd, &ev);
+    }
+#endif
+  }
+  if (control != NULL) {
+    /* Opened for writing too, so that writers coming and going is no EOF */
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.u64 = CONTROL;
+    if ((control_fd = open(control, O_RDWR | O_NONBLOCK | O_CLOEXEC)) == -1 ||
+        epoll_ctl(epfd, EPOLL_CTL_ADD, control_fd, &ev) == -1)
+      fprintf(stderr, "Unable to read commands from %s: %s\n", control, strerror(errno));
+  }
+
+  for (i = 0; i < nsources; i++) {
+    sources[i].heap_index = -1;
+    if (merge_format)
+      heap_update(&heap, &sources[i]);
+  }
+
+  while (active > 0 && !quit) {
+    long long now = now_ms();
+    int timeout = -1, waiting = 0;
+    int n;
+
+    for (i = 0; i <= nsources; i++) {
+      long long wait;
+      if (i == nsources) {
+        if (!merge_format)
+          break;
+        wait = source_timeout(&out, now, 0);
+      } else {
+        wait = source_timeout(&sources[i], now, merge_format);
+        sources[i].ready = 0;
+      }
+      if (wait >= 0 && (timeout == -1 || wait < timeout))
+        timeout = wait;
+    }
+    n = epoll_wait(epfd, events, MAX_EVENTS, timeout);
+    if (n == -1 && errno != EINTR) {
+      perror("epoll_wait");
+      break;
+    }
+    for (i = 0; i < n; i++) {
+      struct source *s;
+      if (events[i].data.u64 == CONTROL) {
+        quit = merge_format ? control_read(control_fd, &out, 1) :
+          control_read(control_fd, sources, nsources);
+        continue;
+      }
+      s = &sources[events[i].data.u64 >> 1];
+#ifdef HAVE_SYS_INOTIFY_H
+      if (events[i].data.u64 & 1) {
+        int r = follow_event(&s->follower, &s->reader);
+        if (r == -1)
+          fprintf(stderr, "Error following %s: %s\n", s->name, strerror(errno));
+        s->idle = r != 1;
+        continue;
+      }
+#endif
+      s->ready = 1;
+    }
+
+    now = now_ms();
+    active = 0;
+    for (i = 0; i < nsources; i++) {
+      struct source *s = &sources[i];
+      if (!s->reader.eof && !s->idle && (s->ready || !s->pollable)) {
+        if (source_read(s) != 1) {
+          s->reader.eof = 1;
+          if (s->pollable)
+            epoll_ctl(epfd, EPOLL_CTL_DEL, s->reader.fd, NULL);
+        }
+        if (merge_format)
+          heap_update(&heap, s);
+      }
+      if (merge_format) {
+        waiting += !s->reader.eof && s->queue.count == 0;
+        out.catchup |= s->catchup;
+        s->catchup = 0;
+      } else if (source_expire(s, now) == -1 || source_dispatch(s, now) == -1) {
+        /* The library's error, or the memory for the lines */
+        fprintf(stderr, "Could not show %s: %s\n", s->name, osd_error);
+        s->reader.eof = 1;
+        s->queue.count = 0;
+        s->visible.count = 0;
+      }
+      /* The lines up wait to expire too */
+      active += !s->reader.eof || s->queue.count > 0 ||
+        (line_ttl > 0 && s->visible.count > 0);
+    }
+    if (merge_format) {
+      if (merge(&heap, waiting, &out, now) == -1) {
+        fprintf(stderr, "Could not allocate memory...\n");
+        break;
+      }
+      if (source_expire(&out, now) == -1 || source_dispatch(&out, now) == -1) {
+        fprintf(stderr, "Could not show the lines: %s\n", osd_error);
+        break;
+      }
+      active += out.queue.count > 0 || (line_ttl > 0 && out.visible.count > 0);
+    }
+    active += control_fd != -1;
+  }
+  if (merge_format) {
+    free(heap.items);
+    queue_free(&out.queue);
+    queue_free(&out.visible);
+    history_free(&out.history);
+  }
+  if (control_fd != -1)
+    close(control_fd);
+  close(epfd);
+  free(batch);
+  batch = NULL;
+  batch_size = 0;
+  /* Leave the last line up for one interval, unless lines expire */
+  if (rate > 0 && line_ttl <= 0)
+    usleep(1000000 / rate);
+  return 0;
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
@@ -0,0 +1,10208 @@
+/* Generated by gen-unicode-names.py from Unicode 14.0.0 - do not edit */
+
+#define UNAME_BLOCK 16
+#define UNAME_ONE_BYTE 192
+#define UNAME_NAMES 32647
+#define UNAME_WORDS 13106
+
+static const char uname_words[] =
+  "LETTERSIGNWITHSMALLSYLLABLECAPITALHIEROGLYPHLATINARABICYICUNEIFORMSYMBOLMATH"
+  "EMATICALEGYPTIANDIGITFORMVOWELTANGUTCANADIANSYLLABICSASIGNWRITINGTIMESBAMUMA"
+  "NDBOLDANATOLIANARROWHANGULNUMBERLINEARCOMBININGLIGATUREGREEKETHIOPICMUSICALO"
+  "LDRIGHTABOVELEFTFORCYRILLICMARKSQUAREITALICCIRCLEDURADICALSANS-SERIFONEFINAL"
+  "DOUBLETAIOTWOBLACKEBELOWIDOTVAIMODIFIERBWHITEHENTAIGANATHREETOVARIATIONPATTE"
+  "RNBRAILLEBYZANTINESTROKEKATAKANAISOLATEDOFHEAVYMIDDLEMYANMARFOURKANGXIMENDEK"
+  "IKAKUIHOOKVERTICALTIBETANFIVEINITIALCJKMEEMHMONGKARIGHTWARDSYEHCOPTICZNAMENN"
+  "YCARRIERUPPLUSRSBOXSQUAREDGEORGIANCHEROKEEFACEMONGOLIANINDEXLOWERLEFTWARDSDE"
+  "VANAGARIHALFPHASE-ELUPPERBLOCKEIGHTDOWNSIXALEFBARCIRCLEMIAOLIGHTVOCALICKHMER"
+  "TILEDRAWINGSDUPLOYANSEVENHABRACKETTHAMPARENTHESIZEDNINEHUNDREDLOWTONEGONDIJO"
+  "NGSEONGHIGHDOTSGLAGOLITICHEBREWTAMILTHUMBOVERSIYAQMALAYALAMPAHAWHCHOSEONGPAB"
+  "ALINESENHAND-FISTRAHALFWIDTHMEROITICSCRIPTIDEOGRAPHICRINGTURNEDPHASE-DIDEOGR"
+  "AMALCHEMICALEQUALHAHNEUMEMABRAHMITHOUSANDLALONGHORIZONTALNATRIANGLENUMERICYA"
+  "OPENMSINHALATAHUNGARIANSADOWNWARDSTILDEMEDIUMBARBUPWARDSNORTHDIAGONALTAGDAFU"
+  "LLWIDTHJEEMGGAPUNCTUATIONTKDOMINOTELUGUVCYPRO-MINOANFRAKTURMEDIALPHASE-CFRAC"
+  "TIONNEGATIVESIDDHAMDOUBLE-STRUCKHBHAIKSUKIDNEWAARMENIANBENGALICHESSSHARADAOR"
+  "ZCHARACTERJUNGSEONGHIRAGANAACUTEBAZEROLARGEYIDEOGRAPHGUJARATIJAVANESEMEDEFAI"
+  "DRINORIYAWEST-CREESYRIACKANNADACURSIVEAARUNICTANGSAADLAMCONSONANTSOUTHPHASE-"
+  "ACCARDNEWTHAIREVERSEDXPGRANTHASOGDIANSUBJOINEDLUEMOVEMENT-WALLPLANEWARANGCIT"
+  "ITENCHAMDASIAPLAYINGSOYOMBOLAOSAURASHTRATIRHUTAAICIRCUMFLEXSINGLEWTETRAGRAMH"
+  "AMZAIIDESERETGURMUKHIJPSILINOTATIONMEETEIMAYEKMODIPOINTINGNUMERALINDICTRIANG"
+  "LE-HEADEDGA2MOVEMENT-FLOORPLANENGADIAERESISARROWHEADAUBOPOMOFOMASARAMSHAJAUU"
+  "STOPLAMLEPCHACAOMEGAWATURKICVIETALPHAFSHORTDIVESAKURUOSAGESUNDANESEZANABAZAR"
+  "CHAKMALITTLENYIAKENGPUACHUELINEAPLFUNCTIONALGRAVEVITHKUQIMAKSURATELEGRAPHKHU"
+  "DAWADIACCENTNOONKHAHONMACRONKAITHIKHAROSHTHILIMBUMARCHENTAKRICHAINVERTEDKHAN"
+  "YANOTCENTREAHOMLIORNAMENTNANDINAGARIROTATEDHARPOONHEXAGRAMARABIANANGLEEASTIN"
+  "LAGABGUNJALAOXIAVARIAKHOJKIMONOSPACENKOSAMARITANTHACOMMATAILOTTOMANSTARGREAT"
+  "ER-THANLESS-THANTRIPLEQDOGRANUNTIFINAGHWANCHOHAUAEGEANBREVEINSCRIPTIONALPAUC"
+  "INPHASE-BBATAKENASHGUNUETAPAHLAVIPHAGS-PAVAPHAWESTAVESTANCYPRIOTIOTAPHASE-FH"
+  "ITTINGTEHANUSVARADEGREESCAUCASIANALBANIANACROPHONICPERSIANFULLPICROSSROMANUN"
+  "IFIEDTTAROHINGYASEENKAYAHMANICHAEANKAFDDAZAHANIFITHAANATWENTYHEHLECARIANMOUT"
+  "HDISCLISUOLDHAOOVEDICUPSILONCHIKISHAVIANPEGHATOPDIAMONDOPERATORPERISPOMENIYE"
+  "ZIDIASTERISKSHEPARENTHESISMTAVRULISHANPHAISTOSNNAAINBEHCARONSYLOTINAGRITHEBH"
+  "ACLOSEDOESHEENMAHJONGPERMICALIGALIMROWAWTTHAEEDOTTEDRETROFLEXNEUTRALORKHONFA"
+  "HEVIRAMADASHTENUWIDE-HEADEDALTERNATEDDHATAHYUNOSUBSCRIPTARCHAICMUBASSASSARRD"
+  "ESCENDERELBASANNABATAEANOSMANYACURVEMAHAJANININETYSECTIONEPSILONFEHREHEIGHTH"
+  "VISARGAYPOGEGRAMMENIQUARTERMULTANIBOTTOMPOINTEDANTEVAHCORNERHIINSTRUMENTALRE"
+  "JANGJHACURLYQAFSTRAIGHTEQUALSLU2FROMSIDEFIFTYTACKARABIC-INDICNENILLGLOTTALSO"
+  "RASOMPENGSEVENTYSADRAISEDMEDUGCANDRABINDUHORNSTRELAAESHINWAVEINDICATORPRESEN"
+  "TATIONCOLONDADNUSHELLYOCROSSINGVARIANTIGIDINGBATAFFIXDAYHIEROGLYPHICPALMYREN"
+  "EENDVERYHANDYUSEZENFINGERSDIGRAPHIMPERIALARAMAICYENISEIRUMIHAND-HINGETOTOUGA"
+  "RITICTHIRTYHEARTMIBENTDANDABUGINESETSAQUOTATIONOMICRONPARTHIANQUESTIONMOONCE"
+  "DILLASAGGARKISIM5LOGICALVOCALPALATALVESSELLYCIANMANDAICTODOOGHAMPHOENICIANPS"
+  "ALTERCONJOINEDRHOSUPERSCRIPTHEADKNIGHTCHORASMIANEPACTUDSLANTEDPROSGEGRAMMENI"
+  "FORTYLLACLOCKLOOPLOOPEDHODAGATNEOPOINTNINDA2URUNOTEGOTHICLYDIANHAND-FLATCHIE"
+  "XCLAMATIONSEPARATORHOURGHAINLUBETWEENBUTORTOISEWEROSOSUBSETSUPERSETSHAFTEYES"
+  "SIGMAHATRANLAINGUYGHURREGIONALTUNUKTAUNDERBARINTEGRALQUADSTRETCHEDKOPHITHETA"
+  "MAKASARNOTEHEADKHAMTITHEHKISOLIDUSEQUILATERALRIGHT-POINTINGSMILINGWOCHEGIQUA"
+  "DRANTATTICDAGESHINDEPENDENTWORDELRUSIUEOVERLAYDISHELYMAICSIBEALTERNATINGTAGA"
+  "LOGEXTENDEDDESEZEKUMOPERSONMANWISUZHAC-SIMPLIFIEDLEAFGAMMAGAN2GISHSPACEMAICU"
+  "RLTRIANGULARARMANTICLOCKWISEATTACHEDDOTLESSKEREVERSEMINUSTHOABTIPHANUNOOMANC"
+  "HUDELTANGARCDORRACURVEDLEFT-POINTINGBUHIDLOQAUNIONINSULARCLANLEGMAYANHINGEDI"
+  "NSIDEDALSIDEWAYSABBREVIATIONTIARCHAIONDIDUMEMTONOSBETAESHBADAB2KURBIREDTWO-H"
+  "EADEDANNOTATIONVULGARGHEREPAPPOKINGSPOKEDFTHORABLACKFOOTFILLRESTINTERSECTION"
+  "EMTAUCOUNTINGRODGURAGEKAPPAFLOORKARENWALLFORWARDHAND-ANGLETAGBANWASIXTYARROW"
+  "SVEUP-POINTINGGUSOUNDSAYISIALEPHBETHTAWIEDIALYTIKAPSIMUSHALGUDOBLIQUEN-ARYTO"
+  "NGUECEILINGCIRCLESHEARTSHAND-CIRCLEEARTHALMOSTRISLASHZAINTAILEDZHEYEAVAGRAHA"
+  "QUEENSUNGIMELKAPHSAMEKHCLOCKWISEIOTIFIEDTAK4SHESHIGKOMISADHESHADCIMOUTSPREAD"
+  "MOVEMENT-DIAGONALROTATIONEIGHTYEMPTYROUNDEDBECANDRASHULENGTHBIGERIMNASKAPIHE"
+  "THLAMEDHYODHTWELVEOGONEKLAGARU2KASKALXASHADEDENTISTRYEQUIVALENTXIRISINGQUART"
+  "ERSTHROUGHKOETROCEIGHTHSTSHAHAND-CUPROTATION-FLOORPLANEROTATION-WALLPLANEMGO"
+  "CHECKWATERFATHAKASRAFARSIZAHASSHADDANYIBULLETGOTSEPWOHUZAYINSOFTNUNUZTONALCA"
+  "NLAMDABIRGANORCLUBSDIAMONDSSPADESWRISTHUMPSARAXIANGQITHIRDOVERBARROUNDETSHAD"
+  "OWEDBALLOTMONPUBINDUDOWN-POINTINGLOZENGEANGOMICHOSMARTYRIADZAWOODS-CREECATRE"
+  "SHMULTIPLICATIONPRODUCTCROSSEDSHIMDASHEDPRECEDESSUCCEEDSELEMENTZETAPADAMINNA"
+  "NPALIMULTIPLERTAGSPOVYSHEUNITSEMICOLONKEHEHCOHYPHENFEJEBACKTEDUNGMURDABALLLU"
+  "MZOBISHOPPAWNROOKFLAGTELEPHONEAHENGAYKHOZUNATTILIKOJIBWAYY-CREEE2AYINBYELEVE"
+  "NOCLOCKWIDEZIGZAGNUBIANSHAR2SHA3USHLALUR2YANGDOESPRIMEBOHANGZHOUDESCRIPTIONE"
+  "ZHMEASUREDYIGKRYZHEMFIREDAMMAMADDAWAVYKIRGHIZMENSHOJOSIMALUNGUNFIFTEENRAYSSA"
+  "LTIREZIQUADRUPLECHOWUFIFOHAAWINDESYERUSCHWATENSLAK-617STEMBESIDETETHPHORIBBO"
+  "NWIDTHNOSEINVERSELEKBELTCLICKKIEVANOCRTSHEGKLYUCHEVAYAKRYUKOVAYASKAMEYTSASTA"
+  "TYAAMSALTCARETBUTGAFEHVOGEEFCURRENCYSIXTEENHARDRECYCLINGWESTERNDALETHTREEMAL"
+  "EPARALLELFISHEYECLOUDVOICEDNORMALASH2ESH2KAKSALTABGADLAK-648BARREDTICKPREFIX"
+  "EDDOUBLE-LINENOTCHEDPAGEFINGERSIMILARTHESPIANLUNATEYODTONE-2TONE-5ATTAKDZTWE"
+  "LFTHSCHINESELEFT-STEMCLEFUNDERSEGMENTEDDYNAMICHAND-HOOKFLEXTRAVEL-WALLPLANEA"
+  "LPAPRAANAMAHAAPRAANALITHHORARDELBRACKETEDSVARITAFIRSTSECONDVIHORSEKEYAPOSTRO"
+  "PHEIMAGETEXTPEHBARREETHENCEENVELOPEFUPEESETRHASANDHISUITCENTREDRECTANGLEEIBU"
+  "BBLECIEUCIEUNGEIGHTEENREPEATHANDSKAVYKAYATURCONTAINSCRYPTOGRAMMICGESH2THIRDS"
+  "GALSHU2UNBURUMFILLERDIGRAMYINEUSLOANPINWHEELEMOJIHHANYOVINEITERATIONTONE-3CR"
+  "OSSED-TAILMONOGRAMBAMBOOSCHARACTERSCHILLUMETRICALREFORMEDNEITHERASTROLOGICAL"
+  "LARGESTFRONTCONTAININGSUBUNITAIRPLANEAMPERSANDBEGINLOGOGRAMJOTMARKERVERTICAL"
+  "LYGOALTHALSUKUNTHOUSANDSSASAKMAHAPRANAMFONVEERUPEEBACKHANDPIECEBLUEJIOUAGOGI"
+  "DODEKATAANOSIMANSISDZELHANUNAVIKTHTH-CREECAROVERLINEDIVISIONCHIEUCHHIEUHKHIE"
+  "UKHKIYEOKMIEUMNIEUNPHIEUPHPIEUPRIEULSIOSTHIEUTHTIKEUTFIGURENAMEFOURTEENNINET"
+  "EENSEVENTEENTHIRTEENDRAGONETHSUBGROUPSHEIDIALECT-PNAGAOPPOSINGTUG2HUB2EXTENS"
+  "IONABKHASIANNJEDIETURNSTILEELLIPSISCOMPRESSEDPAIREDSECANTQOPHPHARYNGEALLIPSS"
+  "TICKSTATERSGREENBUDMOUNTAINICEJAPANESEWOMANTHORNFISHHOOKLENTICULARENDINGLONS"
+  "UMSTAFFTEMPUSCUMPROLATIONELOCATIONCRESCENTSMOVEMENTHAND-CLAWHAND-OVALLIMBAWA"
+  "YTOWARDSTUAREGTRIGRAMNIZKOZAPYATAYASVETLAYAVRAKHIYAMEASUREOREBACKSLASHSHOEFA"
+  "THATANTCHEHWITHINPLACEFEEKETTETSEETAATAMDOLLARMIDVUBELLFOLDERSHJOINERDIPLIAR"
+  "KTIKODIESISKATODIATONIKIYFESISJUTHITSINGOSHWEBBASPIRALSPEECHRAINMILLIONSFITA"
+  "ENCLOSINGKATAKANA-HIRAGANAHATSHIMABAN2DUN3ADMASHGIR2DIMGI4GANGU2LUGALTARTIRD"
+  "AGGEREAROUTLINEDTEARDROP-SPOKEDOPENINGHAIRFALLINGFLATTALENTSSURROUNDTALLYNAS"
+  "ALIZEDTONE-4MOUSESHARPVOSPLASTICSSPEAKEREYEBROWSTENSEWRINKLEDHEELANGLEDMOVEM"
+  "ENT-HINGECHESTTEETHTRAVEL-FLOORPLANEDIGAODDPOWERSMALONHAWEIGHTAIRANTIMONYCOP"
+  "PERSTILEAPPROXIMATELYSWASHTTEHRADITATWEELECHKENXEBABYHOOKEDREPAMBAANAANDANJI"
+  "PENYAAHOUSERAETOOSIXTEENTHNUMERATORTHANBETGAPEQUIHOPPERSCISSORSBUTTONBLACK-F"
+  "EATHEREDBOOKBOWLLLACRESCENTJIHVAMULIYAUPADHMANIYABRIDGEBROKENKAILEIMMADEEJEE"
+  "SHIYEELOOTIEFEMALEBRUSHEATEVENDOGKNIFENETGLASSUKIZHEIOTATEDINFINITYISAVWIGGL"
+  "YCONTROLRICEKHEIGANGIAHORISAMPIUADIVIDERBURUSHARUAKERIN2DUBKUSHU2KU3HALSARTU"
+  "RSHIDSUMGIR3SHIRLAK-449LU3URUDAMUSH3PIRIGIZHITSAKOPPAYNNARROWTALLBEETEEGGADR"
+  "UMERROR-BARREDMYAEXTREMELYHOLDINGPALMKISSAENHARKANSANSINGLE-LINETROEZENIANVR"
+  "ACHYDIGAMMAEKVAVGREATPOWERCORNERSSUNGORANGEVOLAPUKEPIGRAPHICSUBSTITUTION-ANA"
+  "BLAPARTIALDIFFERENTIALBENDBARLINEOTTAVAIMPERFECTAAITONENYPOSITIONRUSSIANCHEE"
+  "KSFLICKHIPCONTACTCUPPEDSPLITPEAKSSQUEEZETHREE-DVYSOKOKHOKHLOMOSOKADVOECHELNA"
+  "YAZAPYATOYGROMOPOVODNAYAGEMINATIONSUBLIMATETRIDENTALLWAYTRAFFICBARSSEMICIRCL"
+  "EU-SHAPEDDAMMATANKASRATANDOUBLEDAFRICANBEEHBEHEHDYEHGUEHDOACHASHMEENGOEHGHUN"
+  "NANYEHPEHEHRNOONTCHEHEHTEHEHTTEHEHUIGHURVEHALAYHEALLAAHUPERCENTSTARTROOTPERO"
+  "HCURVINGPOINTERDHETTEADEGLEFT-HANDTALINGKPANGGANJEEMAPPONMBAMUCHYENTUMREECHA"
+  "RTPOLEUMBRELLANOTESDISKPENTAGONTINYBLACK-LETTERIRIUNNNNNABUILDINGAPLITHESEOS"
+  "PARESTIGMENONGORGONKENTIMATAGEEGAAJJATHEEZEEKOOLAAWAAWOOHOOPIIPOOPWAQIRAASII"
+  "SOOTHAATWEFILESMILEQAROIBOARDMVKOREANTURTLECOWLAMESIMPLIFIEDWALKYELLOWMOBILE"
+  "SCREENLIGHTNINGTITLOCHRIVIMYSLITEFLATTENEDROTUNDACOMMERCIALHALF-CIRCLEELAMIT"
+  "EGESHUKAD3BAHAR2BALIDIMKALPADCUPPARAGRAPHYERYAEOWSTRESSANUDATTANASALDOCUMENT"
+  "FENCENESTEDSUMMATIONFACINGROCKETLEFT-TO-RIGHTOASELECTORFITZPATRICKBBEQUWITHO"
+  "UTMEDALSWIRLFLOWERHIEJILNARZENOVERLAPPINGYOTGRINNINGEOMONKEYINTERROBANGOVALR"
+  "ETURNHOTCLOSINGINPUTJOINEDTONE-1KEYBOARDAQFLOURISHHENGSEMIDIRECTPATHCHARIOTC"
+  "IRCULARKSSAREPETITIONDZHAFREEIMPERFECTUMMARK-1MARK-2ORIGINALECEZONCOMINGPLUT"
+  "OFRANKSCASKETEYEGAZE-WALLPLANESHOULDERKOMBUVACLUSTER-INITIALCUBEDERAGTERDKAR"
+  "NAGBREATHYNDOLEYAJURVEDICKANARANGEGORAZDOGOLUBCHIKMECHIKNEPOSTOYANNAYAPRIZNA"
+  "KACLENGTHENERBHEGBEKPOZALBASEFOURTHAQUAIRONGOLDMERCURYNIGHTOILPOTREGULUSSPIR"
+  "ITINTEGRATIONDELVANEWASLAMARBUTATHINAS-SALAAMALAYHIPOUNDRUBNOWAOBOTTLELENGAD"
+  "ANGRIGHT-HANDULUSUKUKYEELOQNDAAKUTNTAPSUUNYAMNTEUMNDUKAAFAARENRIISHEESHIIMBE"
+  "EPAASAAYOQBANKNOTEMBEBEAMEDMUGCANCELLATIONYYACAPBIRDLIPBOWTIETWENTY-FIVEISOS"
+  "CELESDRAUGHTSFLORETTEFLOPPYELLIPSEHOURGLASSSHOGISLIGHTLYBONECROPLOTUSSILHOUE"
+  "TTEEKFONITIKONDIASTOLIDYOEXDIGORGONCHROMATROMIKONKENTIMAKLASMAARSEOSCAMERACH"
+  "EECHUDLAHEEKHIKKLEETSOTSUWEECIEASTERNKWAAKWEKWIMWAMWINGAANGINWAPWIQOSOUTH-SL"
+  "AVEYTTHOYOOFOODSSRATBAACHECKERHVPOSTALTOOTHFOOTGRASSJ-SIMPLIFIEDMEATRAMSNAKE"
+  "TIGERHPPHONESERIFSLOCKMAILBOXPARENTHESESYERICENTRALIZATIONZATAUSMEMBEREIEKAP"
+  "AKSIOOUGURIMINMINBALAGSHITAAMARBULUGDINKIDGABAUMUMKULSIG4SURDJEMONOCULARDZEL"
+  "OLJEOTSHHADALETDEGREEZHEEDDDAUDATTAHEAVENDOWNWARDFINGER-POSTHEADEDARROWHEADS"
+  "UIGLOBEINSERTNDEQEELECTRICCOMPONENTSEBATBEITZZASWEATOKFEATHERWHEELISOLATEFOR"
+  "KFRAMEFROWNFROWNINGJOINHYPHEN-MINUSBANCHARCHINCILDONGHANHAEHOEJHANKHARLASPAR"
+  "PHARTANVINXANZHARAPPROXIMATEOBOLSNIEUN-CIEUCNIEUN-HIEUHPIEUP-SIOSRIEUL-HIEUH"
+  "RIEUL-KIYEOKRIEUL-MIEUMRIEUL-PIEUPRIEUL-SIOSSSANGCIEUCSSANGKIYEOKSSANGPIEUPS"
+  "SANGSIOSSSANGTIKEUTHAMMERRIGHT-SHADOWEDPATAHQAMATSRAFELAMEDSINYIDDISHHELMETT"
+  "OGETHERQUILTSCANIDENTICALOHMPENTAGRAMPIGWINETONE-8TYPEKISSINGTOPBARCUATRILLO"
+  "EGYPTOLOGICALMIDDLE-WELSHRUMWYNNLONGADEZHLEZHTESHTSRECEIVERBAGDELIMITERQUILL"
+  "LEFT-FACINGSVASTIARROW-TAILSQUIGGLEKANGPLACUSPPENCILMMJOKERSIXTEENTHSAGLAISH"
+  "ORTSTONE-6ERRIAEXTRA-HIGHEXTRA-LOWRAILWAYMIMMUSICALTATURNPERFECTAPALAUNGSGAW"
+  "EPUCENCENTNIKOLSBURGRUDIMENTAPOLICESQUARESOXXYEEMPAPERLOW-FALLINGACEJACKRELA"
+  "TIONTHUMBSRIGHT-FACINGRIGHT-TO-LEFTRADYUTSHORTHANDFORMATDREAMYEYEGAZE-FLOORP"
+  "LANEDIRECTIONTILTINGSEQUENTIALHAND-CURLICUEKNUCKLESHAKINGSANYAKAYAHKMSATANGA"
+  "POETRYDEVICESKEWEDCANTILLATIONFIXED-FORMNYISMCHUPEDESTALWOMANSCLUSTER-FINALK"
+  "RYZHTIKHAYATRESVETLAYAPROSTAYASLOZHITIEGROMNAYAGROMOKRYZHEVAYAPOVODNAYACURRE"
+  "NTALIFLAAMQAAFNASALIZATIONDRYAWBATHSULFURBRICKCROCUSGUMMONTHROCKSTRATUMALTER"
+  "NATIVEANGERCONTOURDIVIDEDECIMALDAHALDDAHALDDALDULJEHRREHVERSECUBEAYBBENGIMIN"
+  "IKEHPIWRVEWXEHYIWNMACHINEGGENYEAXECHICKBACK-TILTEDBACKSLANTEDCARIKJEGOGANPIN"
+  "GPEPETBALLOONBALLOON-SPOKEDFOMMEEEENJAEMNSHANTEEPEUXLETMAEMLEERAEWANENNGGENN"
+  "YETNZAMEUTSHOQNSHUTSOTMAEMBAYUQMBITMBUNGOMKUOPLAPMBINDAPNGGUSEUXNDEETAECALLP"
+  "UAEREUXWUEYITCOVERBANKGBUBATKAROMANDAILINGDESCENDINGBEAVERANJIHUNDREDSCAKEFO"
+  "RTY-FIVETHIRTY-FIVECLUBSHIELDHEXAGONPUSHPINROSETTESAFETYSKULLSNOWMANTRUCKENN"
+  "IHKWLHBOWLSPOONBROWNBUBBLESNRACONSTRUCTIONWAVESBUSEXOAPOSTROFOSCHROATESSERAA"
+  "RISTERAPARAKALESMAFANEROSISSKLIRONISONALLOKORONISKRATIMACHRONONTETARTOSOXEIA"
+  "PARAKLITIKISTIGMASYNAGMAVAREIACALENDARDENECAADENTALHWEKHEKKAMEENEETHUTLATLET"
+  "LHATLITLOTLUTTOCOOCWACWAACWISTROKESFOOKAYKWALWAMAAMOOMWAAMWEN-CREETHIINWAASW"
+  "AATWAAYWAANOOOYPWAAPWEQAAQOOSHOOSHWASWATHOOTHWATHWAATTHAATWAYWAINSERTIONA2MB"
+  "STTTSAWCASTLETEARSJOYEBTRENDHNANAHNVQUOQUUSVCHILDCHRISTMASDIVIDEDOVERLAIDFOR"
+  "MEEPOMMEEHUMANSCHOOLSTOCKWOODINFORMATIONSOURCEPERPENDICULARTENTBAMBOOBOLTCLO"
+  "THFLYFROGSILKLEATHERCLIFFCLOTHESGHOSTMOUNDPAWRAPSEALSHEEPWHEATSNOUTTABLETHRE"
+  "ADCLOSESNOWDJERVMONOGRAPHSHCHAUKRAINIANFERMATAAZUBUKYDJERVIDOBROFRITUGLAGOLI"
+  "HERUKAKOLJUDIJENASHIONUPOKOJIRITSISHTASLOVOTVRIDOUKUVEDEYATIYESTUZEMLJAZHIVE"
+  "TESEMI-VOICEDSUSPENSIONCOMPOSITIONWAUSIMADIRECTCREDITCRYINGLIMMUASSYRIANSIXT"
+  "HSHESHDIM2ANSHEASHGABDUNLUHMESISHGESHTINKINLISHIBKA2KAD5LULNIMNINPANTILZU5ST"
+  "ONECUTCCHEDWEUPTURNGJEIODEEREWCOMPUTERHEADSTROKEGHHAUUESPACINGPRISHTHAMATRAT"
+  "ARGETHALANTAMASKPICTURECONTAINTRANSPOSITIONMULTIMAPPEACEDRACHMATIGHTUHXWSEGM"
+  "ENTELEPHANTCUDDOKEEKXAKYANYUPHESSISSOSSUZHIZHOZHUCONSTANTPOSTOFFICECOLDCOVER"
+  "INGPARTYSTUCK-OUTFAXICONPARTFLORALFLYINGPARAGRAPHOSFRONT-TILTEDOUTERWONGEARM"
+  "NASEPIDAUREANHERMIONIANTWO-CIRCLEKIYEOK-SIOSRIEUL-PHIEUPHRIEUL-THIEUTHWAEWEO"
+  "YEOKAPYEOUNMIEUMKAPYEOUNPHIEUPHKAPYEOUNPIEUPMIEUM-PIEUPMIEUM-SIOSNIEUN-SIOSN"
+  "IEUN-TIKEUTPANSIOSPIEUP-CIEUCPIEUP-SIOS-TIKEUTPIEUP-TIKEUTRIEUL-TIKEUTSIOS-C"
+  "IEUCSIOS-KIYEOKSIOS-PIEUPSIOS-TIKEUTSSANGIEUNGSSANGNIEUNYEORINHIEUHYESIEUNGS"
+  "NOWFLAKEGERESHSEGOLMAPIQTSADIQOFTAVHOLAMHATAFCOMPLETIONGATHERINGGRACEINCREAS"
+  "EOPPOSITIONTHUNDERWORKTRAINRACINGLOVEDEPARTINGFEEDTWENTY-TWOLAKHPLACEHOLDERL"
+  "ETTERSSYMBOLSAROUNDINTERLINEARLAZYINVISIBLEBRANCHENCLOSURESTEPTONE-7LINESLYB"
+  "EIBUONDAPMUOYPRAMPRAM-BEIPRAM-BUONPRAM-MUOYPRAM-PIIYYPURPLELASTPOLISHVYBILAB"
+  "IALBLACKLETTERFENGENTRYRUNNINGFACTOROPEN-HEADEDTHOUGHTETERNITYFISTLEFT-SHADE"
+  "DRIGHT-SHADEDSHADEDMOODTRASEMICIRCULARFIFTHTENTHARITFLEURONWHEELCHAIRMEDIEVA"
+  "LMITSAMNUNGGBANDONGGEMBOONGGOONGGONDIMBONJUHONEAINGMILITARYIYMULTISETNATURAL"
+  "BREATHTIMEFINGEREDPEDALWHOLEMINIMAREPEATEDSEMIBREVISSEMIMINIMASIXTY-FOURTHPE"
+  "RFECTUMTHIRTY-SECONDCOUNCILNO-BREAKICSUANEWLINEJONATRUEEVSATIQOPOQOLDERLEADE"
+  "ROVERLAPYAJROGHLISHIPMID-LEVELPOUTINGPOPPREGNANTPUTRISHEYELASHESFOREHEADGRAS"
+  "PKNUCKLESWRINKLESSTRIKESURFACETOUCHBAYANNADAYANNADDAYANNAGAYANNAJAYANNADANTA"
+  "JASAYANNAMUURDHAJATAALUJAAELA-PILLAGAYANUKITTAKETTISLEEPINGSPHERICALCMDMMEGA"
+  "BEHINDHARKLEANPTHAHASUBLINEARSUPRALINEARZQAPHARATHAKHUENKOIYAKTOP-LIGHTEDBZH"
+  "IGSUM-KHYILYAZHYAGHKATHAKAFIFTHSWAVINGCONCAVE-SIDEDSCHEMACHASHKASTRANNOPODCH"
+  "ASHIETSATAMRACHNAYASTOPITSAACCOUNTACTIVATESHAPINGSYMMETRICSWAPPINGDAALIJIIMM"
+  "IIMSINNYIIYHEYHEADULTLIQUIDDEPARTUREALEMBICASHESCADUCEUSANTIMONIATEDRAMOUNCE"
+  "DUNGSOAPSUPERVINEGARWAXALIENCOPRODUCTFOOTBALLA001A002A003A004A005A006A007A00"
+  "8A009A010A011A012A013A014A015A016A017A018A019A020A021A022A023A024A025A026A02"
+  "7A028A029A030A031A032A033A034A035A036A037A038A039A040A041A042A043A044A045A04"
+  "5AA046A047A048A049A050A051A052A053A054A055A056A057A058A059A060A061A062A063A0"
+  "64A065A066A067A068A069A070A301A302A303A304A305A306A307A308A309AA310A311A312A"
+  "314A315A316A317A318A319A320A321A322A323A324A325A326A327A328A329A330A331A333A"
+  "334A335A336A337A338A339A340A341A342A343A344A345A346A347A348A349A350A351A352A"
+  "353A354A355A356A357A358A359A360A361A362A363A364A365A366A367A368A369A370A371A"
+  "501A502A503A504A505A506A508A509A510A511A512A513A515A516A520A521A523A524A525A"
+  "526A527A528A529A530ANCHORANTENNAGAPPEDQUOTEACTUALLYBASELINEDATEAYAHFOOTNOTEK"
+  "ASHMIRIKAZAKHUSEDKORANICALLAAHSALLASALLALLAHOUWASALLAMMADDAHRAYSAFHASINDHIRE"
+  "CTANGULARSAHOVERSTRUCKMILLECHEHGHADJHEHLIWNSEHTIWNEMPHASISASCENDINGNODEURANU"
+  "SASYMPTOTICALLYAUTOMOBILEAANAEENGEXYECAMELBADGERRACQUETBREADAKARAJNYAIKARAOK"
+  "ARAUKARAKEMPLIKEMPULSURANGDONGTUKPAMADALANTANGPANTISARIWINDUKEUXLEEEEMBENNGK"
+  "WAENNJUAENTUUNUAEMAESIMBANYINGGEUAETNAQNGKUENJAMNKAARAENSHIEENTAANYITPAAMPIP"
+  "AEMBAPIPAEMGBIEEPUPYUMTEUAENTITANAELOMTEUAEQNGGAAMNGGUOQMVOPPITSHETSUENSIEEF"
+  "UELAWKEUMMBEUMMIEEMUAENDAMNJEUXNJUEQMEUNPINSHIQYUWOQGHAAGHEUAEKUNPIPSAPSHEUX"
+  "TOQTUOTWAPYUOPLOOTMAEMAQMGBAMYNGKANGOPNJAEMLIPEOPLEPUESOMWUOYAPRIEESAMBAEURO"
+  "GAHYIENORTHERNPAKPAKSOUTHERNPANGOLATBATHTUBBATTERYBEARBEERBEETLEPEPPERDENOMI"
+  "NATORISSHARBENZENEBEVERAGEBICYCLISTBITINGKNIGHT-BISHOPKNIGHT-QUEENKNIGHT-ROO"
+  "KRECORDDROPLETLANEMERGENIBOCTAGONPARALLELOGRAMPENNANTCROSSBONESSPADETOUCHTON"
+  "ETWO-WAYUNIVERSALBLANKBLOSSOMBOARBOOKMARKBOOMERANGCHONGONNUNNZYBOUQUETMPABUL"
+  "LHORNARGIGORGIPOLIAPESOAPODERMAAPOSTROFOITELOUSICHIMATOSARGOSYNTHETONVOUCHOR"
+  "EVMADIGRAMMOSMONOGRAMMOSTETARTIMORIONTRIGRAMMOSOKTOTRITIMORIONDEXIAETERONDIF"
+  "ONIASMONOFONIASNANAMALAKONGENIKIGORTHMIKONAPLOUNMESOKONTEVMACHRONOUALLIDEYTE"
+  "ROSPROTOSLEGETOSPLAGIOSOLIGONOYRANISMAPELASTONPIASMAPSIFISTONSEISMADISIMOUTE"
+  "TRASIMOUTRISIMOUSTAVROSTELEIATHEMATHEMATISMOSYFENYPOKRISISAAIAAYATHAPASCANDZ"
+  "EEDZIDZODZUGHOGWAJJIJJOJJUJWALHILHOTLHETLHITLHOTSEETTICWECWIICWOCWOOFWAAKWII"
+  "KWOKWOOLHAALWAALWELWILWIILWOLWOOMAYMWIIMWOMWOOHIISHRINIINWENWINWIINWONWOOPWI"
+  "IPWOOQAIQIIR-CREEROORWARWAASAYSHAASHOYSHWAASHWISHWIISHWOSHWOOKAHSWSWESWISWII"
+  "SWOSWOOTTHETTHITWITWIITWOOWIIYWEYWIYWIIYWOYWOOYAYCANCELCARPENTRYCAYNCHATDATE"
+  "YNLANCENTCENTRELINECHAIRCHAADAADDAADDHAAJAAKHAANYAAPHAATTAAVAADVGVLVQUAQUEQU"
+  "IQUVTLVTSVWVYVCHURCHCCCDLANESNOTCHALLIANCECONGRATULATIONENTERPRISEFINANCIALH"
+  "AVEKOTOLABORMETALPRINTRESOURCESOCIETYSPECIALSTUDYSUPERVISEFUNCTIONCITYSCAPEC"
+  "ARTGATETANNEDCITYDEATHDIVINATIONEWEJADEMESHMORTARMOTHERTRUNKHGHZCLINKINGLOWE"
+  "REDSMASHCOATCONJOININGPNEUMATAPAYEROKKEYCAPUPWARDPENTASEMETETRASEMETRISEMEHO"
+  "MOTHETICARCHDOINENOESTRONGUNDERLINESTORECOOKIEAKHMIMICALFABOHAIRICDALDADEIFE"
+  "IHATEIAUDAL-SHAPEDLAULADJAHEISOUTHETHEVIDASPIRITUSLENISCOPYRIGHTLAMPCRICKETP"
+  "ATTYCROSSBARCROWNSIXTHSILIMMUESHE3TRICOLONARADKABAZIDANA2MASH2DARDARA3DIBERE"
+  "NZIZ2GULGUR7IGILSIGSUHURKABKAD2KAPKESH2KU4LAK-050LAK-079LAK-081SIK2MAHMARZA7"
+  "NAMNUTILLUNAM2NU11SILA3PESH2UBSHA6UZ3ZIBALEUTBASHKIRBINOCULARBLENDEDBROADBYE"
+  "LORUSSIAN-UKRAINIANDCHEDZHEDZWEDZZEDZZHEKHAKASSIANKJEDZJESJETJEZJESEMISOFTTC"
+  "HETSHETSSETSWEZEMLYAZHWEPALOCHKAGUARDDARKSUNGLASSESDECREASEFONTSIZEGAYDESERT"
+  "DESKTOPWINDOWDDDHAKHHAOOELOCOMOTIVEEARTHLYGREATERLESSERHITDISAPPOINTEDRELIEV"
+  "EDDIZZYLITTERPRECEDESUCCEEDDOORHIGH-REVERSED-9LOW-9DOVEANCORADRESSDRIVESLOWB"
+  "LOODTANGENTDHPERNINROMANIANWEIEAGLEGROUNDEGGB001B002B003B004B005B006B007B008"
+  "B009M001M002M003M004M005M006M007M008M009M010M011M012M013M014M015M016M017M018"
+  "M019M020M021M022M023M024M025M026M027M028M029M030M031M032M033M034M035M036M037"
+  "M038M039M040M041M042M043M044PETALLEDRECTILINEARPROPELLERRRETYPE-3TYPE-4TYPE-"
+  "5TYPE-6NESTPAGESENTERERASEERISBBIBBOBBUBWABWEEBWICEEDDEDDHODDIDDUFWAFWEEFWIG"
+  "GIGGOGGUGWEGWEEGWIHHWAKWEEMWEEPWEEQWEQWEEQWIHHAANYEESSEXOXYAZAAZZEZZIZZOZZUR"
+  "IKRIKEUROPEANGESTUREROLLINGTIGHTLY-CLOSEDWINKINGTHERMOMETERFAMILYFATHERFEMIN"
+  "INEORDINALFIELDHOCKEYFILMENGINEHOLEFLATBREADFORKEDFOUNTAINCIRCLINGFOXFRENCHS"
+  "HRIMPGAMEPROPORTIONGEOMETRICALLYELIFILABIALCAUDATELATINATEOTUSHTAPICSPIDERYT"
+  "ROKUTASTIHWAIRPLUTADRACHMASHETAPAMPHYLIANSYMBOL-1SYMBOL-11SYMBOL-12SYMBOL-13"
+  "SYMBOL-14SYMBOL-17SYMBOL-18SYMBOL-19SYMBOL-2SYMBOL-23SYMBOL-24SYMBOL-4SYMBOL"
+  "-5SYMBOL-50SYMBOL-51SYMBOL-52SYMBOL-53SYMBOL-54SYMBOL-7SYMBOL-8YEARAPPLEGROU"
+  "PBINDIPROLONGEDPICKWRENCHIEUNG-KIYEOKKAPYEOUNRIEULKAPYEOUNSSANGPIEUPMIEUM-KI"
+  "YEOKNIEUN-KIYEOKPHIEUPH-PIEUPPIEUP-CHIEUCHPIEUP-HIEUHPIEUP-KIYEOKPIEUP-PHIEU"
+  "PHPIEUP-SIOS-KIYEOKPIEUP-THIEUTHRIEUL-KAPYEOUNPIEUPRIEUL-KHIEUKHRIEUL-NIEUNR"
+  "IEUL-SSANGKIYEOKSIOS-CHIEUCHSIOS-HIEUHSIOS-MIEUMSIOS-NIEUNSIOS-RIEULSIOS-THI"
+  "EUTHSSANGHIEUHSSANGRIEULTIKEUT-CIEUCTIKEUT-KIYEOKTIKEUT-PIEUPTIKEUT-RIEULTIK"
+  "EUT-SIOSMIEUM-PANSIOSNIEUN-PANSIOSRIEUL-KIYEOK-SIOSRIEUL-PANSIOSRIEUL-PIEUP-"
+  "SIOSRIEUL-YEORINHIEUHYESIEUNG-PANSIOSYESIEUNG-SIOSARAEAYA-YOYO-IYO-YAYO-YAEY"
+  "U-IYU-YEYU-YEOKINNAPAMUDPODRAISINGAYNZAYNHEADSTONEDECORATIONCHEVRONSPARKLEWE"
+  "DGE-TAILEDGERSHAYIMMERKHAPARATELISHAZAQEFQATANHETHIRIQSOFNA-2NE-2RA-2SA-2TA-"
+  "2TE-2MEETDARKENINGFOLLOWINGPOSSESSIONPREPONDERANCETAMINGINNERCAULDRONLAKEKEE"
+  "PINGWAITINGBRIGHTNESSHIGH-SPEEDBOOTHOLLOWBLOCK-2BLOCK-3BLOCK-4BLOCK-5BLOCK-6"
+  "BLOCK-7HOTELBUILDINGSHUGGINGHYPHENATIONCREAMSKATEIDENTIFICATIONLEVELTWENTY-F"
+  "OURTWENTY-ONETWENTY-THREETRAYNEGATEDINHIBITMEM-QOPHWAW-AYIN-RESHINTERIORUNDE"
+  "RTIEDOLLSSTANDARDJARCAKRARERENGGANLELETPISELEHCECAKWULUBOATBODYFLUTEFURLIDME"
+  "LONSELFSLICESPEARSTEAMSWEETTRACKTURBANNAKAARAPOLLUHTACALYAPLOPHUTTTARYMUANDA"
+  "P-BEIDAP-BUONDAP-MUOYDAP-PIIDAP-PRAMINHERENTKIPKHMULINGSANSKRITSEMIVOWELKONR"
+  "INGSLARGERANGLICANACONLJSCOTSNJSQUIRRELSALTILLOSIGMOIDTRESILLOTZVENDVISIGOTH"
+  "ICYOGHIJALVEOLARPERCUSSIVELATERALYRSERIFDBLSLZHANDLERAMSSQUATTCOPEN-OUOFLUTT"
+  "ERINGPARAPHRASELUGGAGEOMISSIONS-SHAPEDWRITINGINTERLACEDMAGNIFYINGEMBEDDINGOV"
+  "ERRIDEHLAMLACER-WATA-ROLTSHOOKYANOLIVEWOOLLINKLIRACYABLADEDROP-SHADOWEDFORTI"
+  "ETHONE-HUNDRED-AND-SIXTIETHTWENTIETHEIGHTIETHSTWENTIETHSAPAZBHETHKHAPHARTSDR"
+  "INKMECHANICALATIUKPNYIYEKKOKNGOUKPEEHENHINNGONNDOOGBOGBOOKPUHUNNGGIGBEEFANBO"
+  "OKPEKPOONGGEEGBIHANKPINJOOVOONJAJOODOONGENMHANGHANYHAASPIRATIONVOICINGIANMIC"
+  "ROPHONEMIDLINEMIRRORSHANGSHELFMONEYBALUDAUBADAMAMOTORSCOOTERKHAIARPEGGIATOBE"
+  "AMPHRASESLURBREVISCLUSTERFLIPTREMOLO-1TREMOLO-2TREMOLO-3SEGNODAMPFRETBOARDFU"
+  "SAGLISSANDOGREGORIANNULLTWENTY-EIGHTHPORRECTUSFLEXUSQUINDICESIMASCANDICUSDIM"
+  "INUTION-1TORCULUSTRIANGLE-ROUNDRUMAIOAYREDUPLICATIONNATIONALSHAPESWCNEPTUNEK"
+  "VAXVALAEUYNEWSPAPERWOLOSOSMOKINGNOTEBOOKNUTREPLACEMENTTTUDDAAGOVMUCAADAMBECS"
+  "EDEGEGYEJELYEMPENT-SHAPEDESZETYEZSOEEUNKPERSONALAEBAEGAEKAETAEYOEKLESHTAXIOP"
+  "EN-CIRCUIT-OUTPUTOPTICALORNATEBRAEHCHAEHKAEHPAEHTAEHTSAEINHYAOINKAAFNTOGTXWV"
+  "YAMMEEJREACHPARTNERSHIPPEDESTRIANSTAMPEDBOTHPESOPLANEPHILIPPINESADEPIEPILCRO"
+  "WPITCHFORKPLANCKREVOLVINGDIRECTIONALPOTATOPRINTERRABBITRADIOINTERPOLATIONSPL"
+  "AYEDMCRESPONSERESTRICTEDPRECEDINGVICTORYROLLERSEXTULAAESCOSBITTITEPENTHETICN"
+  "EQUDAAQITSAOVERLONGSATELLITESESAMETOTZOOSHOPPINGMARK-3ENCLOSURESHORNSROTATIO"
+  "NSBLOWINGSUCKEDRELAXEDSIMULTANEOUSEARSBLINKMODIFIER-2MODIFIER-3MODIFIER-4MOD"
+  "IFIER-5MODIFIER-6MOVEHINGECURLICUERIPPLETOUCHINGNECKYAWNJAWTHREE-QUARTERSTIC"
+  "KINGTORSO-WALLPLANECAYANNAKAYANNAPAYANNATAYANNATTAYANNALAYANNANAYANNANAASIKY"
+  "AYAAEDA-PILLAGAETTA-PILLAIS-PILLAPAA-PILLASKISLOPINGSMALLERHEART-SHAPEDSOLID"
+  "FLAMESUBJOINERTERMINALSPIDERWHALEKGMWCROSSHATCHIDEOGRAPH-4E09IDEOGRAPH-4E8CI"
+  "DEOGRAPH-6253LEANINGRULERPASANGANLEUSUNRISEBHODHORROHASANTAACKNOWLEDGEESCAPE"
+  "DELETETRANSMISSIONTABULATIONSHIFTSUBSTITUTEZLAMAESASAHBASAALAPHDALATHSEMKATH"
+  "GAMALGARSHUNIYUDHRBASATENNISAUERANAKHHONUENGCULTIVATIONTOTALTRADITIONALAWXAX"
+  "IXUEXUEZTAPEWATCHTHONGTHERESANDALCONSECUTIVESIGNSCONVERGINGBEATMIGLOGOTYPEKH"
+  "ANGGYASGYONSHOGRGYAN-DZUDPHURBRDARNYINGSGAB-UMRNAMBCADGUGMDUNMCHANNGASBZUNGZ"
+  "LARGYAGRAMGRURGYINGSLCETSHESGCIGGNYISYARRDORJEBERBERACADEMYYAZYAKHYAQTIRONIA"
+  "NTRAMBINARYTROPICALINTERSECTINGNJOANTARGOMUKHAVAMAGOMUKHAARDHAVISARGAVIDEOVI"
+  "ETNAMESEREADINGIJETUPWANINGGIBBOUSHIYOHOLOHORRSSUUVIYOYUJDIRECTLYWAXINGWEARY"
+  "CANNONGENERALMANDARINSOLDIERBBUTCIPCUOPCYCYPCYTDDURGEPGGOPGGUOGOTHMOHXITHXOP"
+  "HXUOJJIEJJUTJJYKITLIELYRMOPNBIENYIPNYOPNZUPPYTQOTSHATSHOPSHURSHYTATVEPVURZOT"
+  "ZUPZURZZIETANTIRESTRICTIONBINDINGDOUBLE-LINEDOMETDEMESTVENNYZADERZHKASOROCHY"
+  "ANOZHKASREDNECHELYUSTKAKLYUCHTIKHYKRYUKPEREVODKAKLYUCHENEPOSTOYANNAYAZAKRYTA"
+  "YADVOECHELNOPOVODNAYAABACUSACCORDIONADDRESSEDSUBJECTADHESIVEBANDAGEADISHAKTI"
+  "GEMINATEADMETOSADMISSIONTICKETSAERIALTRAMWAYAFGHANILIGATINGKILLERRULAIARRIVI"
+  "NGAKTIESELSKABALARMALKALIALKALI-2ALUMAMALGAMREGIAREGIA-2VITAEVITAE-2AQUAFORT"
+  "ISARSENICAURIPIGMENTMARYVAPOURSBISMUTHBORAXBORAX-2BORAX-3CALXCAPUTMORTUUMCIN"
+  "NABARCOPPER-2CRUCIBLECRUCIBLE-2CRUCIBLE-3CRUCIBLE-4CRUCIBLE-5DAY-NIGHTDISSOL"
+  "VEDISSOLVE-2DISTILLORE-2IRON-COPPERLEADLODESTONEMARCASITESUBLIMATE-2SUBLIMAT"
+  "E-3NITREPHILOSOPHERSPOWDERPOWDEREDPRECIPITATEPURIFYPUTREFACTIONQUICKLIMEQUIN"
+  "TESSENCEREALGARREALGAR-2ANTIMONY-2REGULUS-2REGULUS-3REGULUS-4RETORTSALT-2SAL"
+  "-AMMONIACSCEPTERJOVESILVERSTARREDSTRATUM-2SUBLIMATIONTARTARTARTAR-2TINTINCTU"
+  "RETUTTYURINEVERDIGRISVINEGAR-2VINEGAR-3VITRIOLVITRIOL-2MONSTERAROUND-PROFILE"
+  "ONE-WAYAMALGAMATIONAMBULANCEAMERICANAMPHORAA010AA026AA039AA041AA046AA046BA06"
+  "6AA066BA066CA071A072A073A074A075A076A077A078A079A080A081A082A083A084A085A086"
+  "A087A088A089A090A091A092A093A094A095A096A097A097AA098A098AA099A100A100AA101A"
+  "101AA102A102AA103A104A104AA104BA104CA105A105AA105BA106A107A107AA107BA107CA10"
+  "8A109A110A110AA110BA111A112A113A114A115A115AA116A117A118A119A120A121A122A123"
+  "A124A125A125AA126A127A128A129A130A131A132A133A134A135A135AA136A137A138A139A1"
+  "40A141A142A143A144A145A146A147A148A149A150A151A152A153A154A155A156A157A158A1"
+  "59A160A161A162A163A164A165A166A167A168A169A170A171A172A173A174A175A176A177A1"
+  "78A179A180A181A182A183A184A185A186A187A188A189A190A191A192A193A194A195A196A1"
+  "97A198A199A200A201A202A202AA202BA203A204A205A206A207A207AA208A209A209AA210A2"
+  "11A212A213A214A215A215AA216A216AA217A218A219A220A221A222A223A224A225A226A227"
+  "A227AA228A229A230A231A232A233A234A235A236A237A238A239A240A241A242A243A244A24"
+  "5A246A247A248A249A250A251A252A253A254A255A256A257A258A259A260A261A262A263A26"
+  "4A265A266A267A267AA268A269A270A271A272A273A274A275A276A277A278A279A280A281A2"
+  "82A283A284A285A286A287A288A289A289AA290A291A292A293A294A294AA295A296A297A298"
+  "A299A299AA300A309A313A329AA332AA332BA332CA336AA336BA336CA359AA364AA368AA371A"
+  "A372A373A374A375A376A377A378A379A380A381A381AA382A383A383AA384A385A386A386AA"
+  "387A388A389A390A391A392A393A394A395A396A397A398A399A400A401A402A403A404A405A"
+  "406A407A408A409A410A410AA411A412A413A414A415A416A417A418A419A420A421A422A423"
+  "A424A425A426A427A428A429A430A431A432A433A434A435A436A437A438A439A440A441A442"
+  "A443A444A445A446A447A448A449A450A450AA451A452A453A454A455A456A457A457AA458A4"
+  "59A460A461A462A463A464A465A466A467A468A469A470A471A472A473A474A475A476A477A4"
+  "78A479A480A481A482A483A484A485A486A487A488A489A490A491A492A493A494A495A496A4"
+  "97A507A514A517A518A519A522ANATOMICALANGRYANGSTROMANGUISHEDANKHANTI-BEAMSQUIS"
+  "HZILDEAPOLLONAPPROACHESLIMITAQUARIUSDISPUTEDHORIZONTALLYMOVEDGRAFAKBARALAYHA"
+  "AAS-SALAATUWAS-SALAAMALAYHIMALAYHIMAAALLAHAZZAJALLBISMILLAHAR-RAHMANAR-RAHEE"
+  "MJALLAJALALOUHOUMOHAMMADQALAQUDDISASIRRAHANHANHAAANHUMANHUMAAANHUNNARAHIMAHU"
+  "RAHIMAHUMRASOULSALAAMUHUALAYNAASALAMSALLALLAAHUWA-AALIHSALLALLAHUWAAALIHEEWA"
+  "-SALLAMSUBHAANAHUTAAALAATABAARAKAWA-TAAALAAWAAJIBPIASTRESAJDAHPOETICFILLEDAS"
+  "SALLAMMISRAALLAHOUANHURAHMATULLAHWASSALLAMSAMVATSANAHPOSTPOSITIONTAKHALLUSUP"
+  "RIGHTAL-JUZAN-NISFAR-RUBAS-SAJDAATH-THALATHAQIFSAKTAWAQFAIMAALAISHMAAMTASHEE"
+  "LHIZBMOKHASSASFRAGMENTZWARAKAYARIESARROWHEAD-SHAPEDARTICULATEDLORRYARTISTPAL"
+  "ETTEASCIAASSERTIONASTERISMASTONISHEDASTRAEAASTRONOMICALATHLETICATOMAUBERGINE"
+  "AUSTRALAUTORICKSHAWAUTOMATEDTELLERAAOHMENGVENGYENNESHYESSHEXVEYYEAVOCADOANGE"
+  "LBACONBACTRIANBADMINTONSHUTTLECOCKBAGELBAGGAGECLAIMBAGUETTEPAMUNGKAHPARERENS"
+  "IKIAIKARAASYURAKEMBANGLACAMADUALPAPRANAEKARAGORAJERAKHOTRAMBATKAPALSAGASAPAL"
+  "ATIKTAWATZIRBENDEENDEPGONGTEGEHDAENGDAINGGEDEDENGDEUNGDINGPLAKPLUKPANGPUNGTA"
+  "KPAMENENGBISAHCECEKREREKANRICEMILUTYARNBALLETSHOESKOQNDONTUKWENTISFAAMAEKOGH"
+  "OMKOVUUFIRIGBIEEFONGHEUAEGHEUAEGHEUAERAEKAFAKAQKEUKEUTNDAKPOQKUOQLAPAQLOMMAE"
+  "LUAEPMAEKEUPMAEMBGBIEEMAEMKPENMAEMVEUXMAENYIMANSUAEPIEETMBAQMEUNJOMNDEUQMGBA"
+  "SAMOOMEUTMOOMPUQMVEUAENGAMNDAANGGEUAETNGANGUNGKUENZEUMNIKANKINDIMFAANTOQPENM"
+  "ONGKEUAEQNZUNPAARAEPAMSHAEPASHAEPETROMSEUNYAMSHINDASHIRAESHUENSHUETSHUMSISAS"
+  "ONJAMSOQTEUTEUWENTUAEPUNKNOWNFEUXGHEUGHENGHEUGHEUAEMKAMKEUAEMKEUPUQKEUYEUXKI"
+  "EEMKIQLAANAENJEUAENANJUQAMAELEEMBAARAEMBEURIMBAAKETMBUOQMEUQNGGEETMFIYAQMONT"
+  "IEENNJAANGGEUNGKINDINSENNSHUETNTIEESHEUOQNYAEMAEPARUMPEESHIPUNGAAMSAKEUAENJA"
+  "QSHEUAEQTUSIEETAAMMAEMGBIEEVEUMWUAETYAFUYEURAEBUNGGBAYIGHAPGHARAEFATIGUEKEUK"
+  "AQKEUSEUXKEUSHEUAEPKPARAQLIQKEUAERICABBAGE-TREEPICKETMBEEKEETMBERAEMBEUXMBIR"
+  "IEENMBUAEMMBUEMGBASAQNANSANAQNDEUAEREENDEUTNDIDANDOMBUNGAQNGGUAENNGGUEETNGGU"
+  "MNGGUONNGKAQNJEEEENSANSEUAENNSHAQNSOMNSUNNSUOTNTENNTEUNGBANTUNYIRMKPARAQNZEU"
+  "MPIRIEENSETFONSHUEQSUAETTAASHAETEUTEUXYUETITUAEPVEUAEPENVEUXWANGKUOQWUPYEUQM"
+  "UOMAEFEUFEUAETKEUAETMEUNKEUOTMBUAEKEUPKUOMKUQKWAETLEUAEPLEUMLIEEMAENJETMALEE"
+  "RIMBUOMFEUAEMFEUTMFIEEMFOMGBEUNMGBIEEMGBOFUMMONINDEUXNDONNGGAAMAENGGAPNGGEUX"
+  "NGGUOMNGGWAENNGKAPNGKEUAEQNGKEURINGKIEENGKUNNGKYEENJAPNJEUAEMNJEUTNJIEENSHEE"
+  "NSIEEPNSIEETNSUMNYUEPEUTAEPUQPUUTRAEMSAQSEUAEQSHEUAESUAETEEEETEUNTEUTWUAENYA"
+  "EMMAEYUOMFAQREMEDYFUETGBETGBEUXGHAAMAEGHETGHEUNGHEUXGHOMKEUAEKPEUXKUETLAQLEU"
+  "AEMLOONMFEUQMGBENMVISOFTNESSNDIAQNDIQNDUNNGEUREUTNGGEEEENGGEUAENGGUAESHAENGG"
+  "UPNGGURAENGKAAMINGKEUAEMNGKEUXNGKUMNGKUPNGOQNGUAENGUAETEPOCHNKOMNSHUENSHUOPN"
+  "TUMCLEAVERNZAQNZUQPLURALPEEMPEUTPIEEQPIETPOONPUAQPUMRAQRIMGBASHEUAEQSUAENTAA"
+  "QTAENTAQTEUTOONTUAETUMAEVEUAEVOMWEUXYEUAEYEUAETYEUMYEUXYIEESWIMMINGYUAENYUEQ"
+  "YUNVUEQBANANABANJOBARBERBASEBALLBASKETBASKETBALLHOOPHIGH-LOWLOW-MIDDHIIENNIH"
+  "WAHKPAHUWUWADDAYEINPANONGONANTOMPIJUDULMETEKPINARBORASBEACHBEANSBEARDEDBEATI"
+  "NGBECAUSEBEDBELLHOPLESSGANDAKHANDABENTOFILLER-1FILLER-2BICYCLEBIKINIBILLEDBI"
+  "LLIARDSBIOHAZARDBIRTHDAYBISONBITCOINLILITHSEXTANT-1SEXTANT-12SEXTANT-123SEXT"
+  "ANT-1234SEXTANT-12345SEXTANT-12346SEXTANT-1235SEXTANT-12356SEXTANT-1236SEXTA"
+  "NT-124SEXTANT-1245SEXTANT-12456SEXTANT-1246SEXTANT-125SEXTANT-1256SEXTANT-12"
+  "6SEXTANT-13SEXTANT-134SEXTANT-1345SEXTANT-13456SEXTANT-1346SEXTANT-1356SEXTA"
+  "NT-136SEXTANT-14SEXTANT-145SEXTANT-1456SEXTANT-146SEXTANT-15SEXTANT-156SEXTA"
+  "NT-16SEXTANT-2SEXTANT-23SEXTANT-234SEXTANT-2345SEXTANT-23456SEXTANT-2346SEXT"
+  "ANT-235SEXTANT-2356SEXTANT-236SEXTANT-24SEXTANT-245SEXTANT-2456SEXTANT-25SEX"
+  "TANT-256SEXTANT-26SEXTANT-3SEXTANT-34SEXTANT-345SEXTANT-3456SEXTANT-346SEXTA"
+  "NT-35SEXTANT-356SEXTANT-36SEXTANT-4SEXTANT-45SEXTANT-456SEXTANT-46SEXTANT-5S"
+  "EXTANT-56SEXTANT-6BLOWFISHBLUEBERRIESBOMBTABSBOOKSAINNANNAUNNGHGNGWINNINNNNG"
+  "GZHPOPPINGCORKFLOWERSHYGIEIABOWLINGBOXINGGLOVEBOYBOYSBHATTIPROLUDOTS-1DOTS-1"
+  "2DOTS-123DOTS-1234DOTS-12345DOTS-123456DOTS-1234567DOTS-12345678DOTS-1234568"
+  "DOTS-123457DOTS-1234578DOTS-123458DOTS-12346DOTS-123467DOTS-1234678DOTS-1234"
+  "68DOTS-12347DOTS-123478DOTS-12348DOTS-1235DOTS-12356DOTS-123567DOTS-1235678D"
+  "OTS-123568DOTS-12357DOTS-123578DOTS-12358DOTS-1236DOTS-12367DOTS-123678DOTS-"
+  "12368DOTS-1237DOTS-12378DOTS-1238DOTS-124DOTS-1245DOTS-12456DOTS-124567DOTS-"
+  "1245678DOTS-124568DOTS-12457DOTS-124578DOTS-12458DOTS-1246DOTS-12467DOTS-124"
+  "678DOTS-12468DOTS-1247DOTS-12478DOTS-1248DOTS-125DOTS-1256DOTS-12567DOTS-125"
+  "678DOTS-12568DOTS-1257DOTS-12578DOTS-1258DOTS-126DOTS-1267DOTS-12678DOTS-126"
+  "8DOTS-127DOTS-1278DOTS-128DOTS-13DOTS-134DOTS-1345DOTS-13456DOTS-134567DOTS-"
+  "1345678DOTS-134568DOTS-13457DOTS-134578DOTS-13458DOTS-1346DOTS-13467DOTS-134"
+  "678DOTS-13468DOTS-1347DOTS-13478DOTS-1348DOTS-135DOTS-1356DOTS-13567DOTS-135"
+  "678DOTS-13568DOTS-1357DOTS-13578DOTS-1358DOTS-136DOTS-1367DOTS-13678DOTS-136"
+  "8DOTS-137DOTS-1378DOTS-138DOTS-14DOTS-145DOTS-1456DOTS-14567DOTS-145678DOTS-"
+  "14568DOTS-1457DOTS-14578DOTS-1458DOTS-146DOTS-1467DOTS-14678DOTS-1468DOTS-14"
+  "7DOTS-1478DOTS-148DOTS-15DOTS-156DOTS-1567DOTS-15678DOTS-1568DOTS-157DOTS-15"
+  "78DOTS-158DOTS-16DOTS-167DOTS-1678DOTS-168DOTS-17DOTS-178DOTS-18DOTS-2DOTS-2"
+  "3DOTS-234DOTS-2345DOTS-23456DOTS-234567DOTS-2345678DOTS-234568DOTS-23457DOTS"
+  "-234578DOTS-23458DOTS-2346DOTS-23467DOTS-234678DOTS-23468DOTS-2347DOTS-23478"
+  "DOTS-2348DOTS-235DOTS-2356DOTS-23567DOTS-235678DOTS-23568DOTS-2357DOTS-23578"
+  "DOTS-2358DOTS-236DOTS-2367DOTS-23678DOTS-2368DOTS-237DOTS-2378DOTS-238DOTS-2"
+  "4DOTS-245DOTS-2456DOTS-24567DOTS-245678DOTS-24568DOTS-2457DOTS-24578DOTS-245"
+  "8DOTS-246DOTS-2467DOTS-24678DOTS-2468DOTS-247DOTS-2478DOTS-248DOTS-25DOTS-25"
+  "6DOTS-2567DOTS-25678DOTS-2568DOTS-257DOTS-2578DOTS-258DOTS-26DOTS-267DOTS-26"
+  "78DOTS-268DOTS-27DOTS-278DOTS-28DOTS-3DOTS-34DOTS-345DOTS-3456DOTS-34567DOTS"
+  "-345678DOTS-34568DOTS-3457DOTS-34578DOTS-3458DOTS-346DOTS-3467DOTS-34678DOTS"
+  "-3468DOTS-347DOTS-3478DOTS-348DOTS-35DOTS-356DOTS-3567DOTS-35678DOTS-3568DOT"
+  "S-357DOTS-3578DOTS-358DOTS-36DOTS-367DOTS-3678DOTS-368DOTS-37DOTS-378DOTS-38"
+  "DOTS-4DOTS-45DOTS-456DOTS-4567DOTS-45678DOTS-4568DOTS-457DOTS-4578DOTS-458DO"
+  "TS-46DOTS-467DOTS-4678DOTS-468DOTS-47DOTS-478DOTS-48DOTS-5DOTS-56DOTS-567DOT"
+  "S-5678DOTS-568DOTS-57DOTS-578DOTS-58DOTS-6DOTS-67DOTS-678DOTS-68DOTS-7DOTS-7"
+  "8DOTS-8BRAINBREAST-FEEDINGBRIDEVEILBRIEFCASEBRIEFSBROCCOLINORTHWESTBROOMTEAB"
+  "UCKETBUGNYCAPALLAWABULLSEYEBURRITOBUSTBUSTSBUTTERBUTTERFLYARGOTERIGORGOTERIM"
+  "ESIMETRIAANATRICHISMAANTIKENOKYLISMAANTIKENOMASYNDESMOSAPOTHEMAARGONCHAMILIC"
+  "HAMILONKLITONSPATHIZYGOSDASEIADIARGONMEGALIMIKRIDIFTOGGOSDIGRAMMAGGEKSTREPTO"
+  "NELAFRONENARXISENDOFONONEPEGERMATETRAFONIASFHTORAVASISDEYTEROUICHOUENARMONIO"
+  "SANTIFONIANAOSNENANOSYNAFIDIATONONGORGOSYNTHETONDIPLOUNGRONTHISMATAICHADINIM"
+  "IDIARGONIMIFONONIMIFTHORAIMIFTHORONISAKIAKATAVAKATAVASMAKATHISTIKOUFISMAKRAT"
+  "IMATAKRATIMOKOUFISMAKRATIMOYPORROONKREMASTIKYLISMAENOSIMISEOSTESSARONTRIONLE"
+  "MOILYGISMAPROTOVARYSTRIFONIASTRITOSVARYSMIKRONOMALONOXEIAIPARICHONPETASMAPET"
+  "ASTIPETASTOKOUFISMAPSIFISTOLYGISMAPSIFISTOPARAKALESMAPSIFISTOSYNAGMAPSILONRA"
+  "PISMAREVMASAXIMATAAPODEXIASTRAGGISMATAMETASTAVROUSYNEVMASYRMASYRMATIKITETRAP"
+  "LIESOTHESAPOTHESTHITATINAGMATRIATRIGORGONTRIPLITROMIKOLYGISMATROMIKOPARAKALE"
+  "SMATROMIKOPSIFISTONTROMIKOSYNAGMAVAREIAIVATHYXIRONYPORROIYPSILICACTUSCADAUNA"
+  "FLASHCAMPINGAIVILIKBIBLE-CREECAAIDLEDLEEDLIDLODLUGHEEGHIGHUGWUHWAHWEEHWIHWOH"
+  "WUJJEJJEEKHEEKHUKKEKKEEKKIKKOKKULHELHEELHUTLEETLHEETLHUTTEETTSATTSETTSEETTSI"
+  "TTSOTTSUTTUCIIFAAIFIIHKKAAIKIIKWAYLAAILAYLHIILHOOLIIMAAIMHMIIMOOSE-CREESKNAA"
+  "IS-WSCWASKWSKWASPWASTWASHRASHRAASHRIISHROSHROONAYNGAAINGAINGIINGOONHNNGNNGAN"
+  "NGAANNGINNGIINNGONNGOONOYNUNAVUTPAAIPAYPOYPWOYQAAIRWERAAIRWEERWIRWIIRWORWOOS"
+  "AAIJUUSHAYSHWOYKIHKOHSOYSPASPESPISPOTAAITAYTHWETIITLHOOTLHWETTHTTHOOTTHWETYA"
+  "TYETYITYOTHWEETHWITHWIITHWOTHWOOYAAIYIIYOYCANCERCANDLECANDYCANNEDCANOECAPITU"
+  "LUMCAPRICORNSLIDINGDIVIDERSCAREC-18C-39D2G2K2LDLD2MB2MB3MB4NDP2SH2ST2TT2UUUU"
+  "UU2UUU3UUUUCAROUSELCARPSTREAMERCARROTWRYCITATIONALTAORCHOYCYAWCYAYDYANDZAYDZ"
+  "YAYFAMGHEYSHEYTINYAIRBIWNJAYNJHOXKARKIWLYITNOWCQAYSEYKSHAKTASTIWRTYAYVEYZXEY"
+  "NYAYDYOWDZARLZHILCAUTIONCEDICELTICCERESCHAINSBHAADHAAJHAANNAAYYAAMAAYYAACHHA"
+  "MUENGUENHJANHUENUEPPACHEERINGMEGAPHONECHEESEWEDGECHEQUEREDCHERRIESCHERRYCHES"
+  "TNUTCHICKENCHILDRENCHIPMUNKCHIRONCHOCOLATECHOPSTICKSCURLEDCINEMASUPERIMPOSED"
+  "ANTICLOCKWISE-ROTATEDACCEPTADVANTAGEATTENTIONCOPYCORRECTEXCELLENTITEMKINDERG"
+  "ARTENMEDICINERELIGIONSECRETSUITABLECHAMKOJUEUIWZCIRCULATIONCIRCUSDUSKCHOKECI"
+  "VILIANBXGHPWGHXWGHZGHZTHZWHZWGHZZHZZPHZZZHZZZGPDPGPZSGSPSWGSWZSZSZWGSZZTNWGX"
+  "GCLAMSHELLCLAPPERCLAPPINGCLASSICALCLEARMUGSGLASSESCLIPBOARDEIGHT-THIRTYELEVE"
+  "N-THIRTYFIVE-THIRTYFOUR-THIRTYNINE-THIRTYONE-THIRTYSEVEN-THIRTYSIX-THIRTYTEN"
+  "-THIRTYTHREE-THIRTYTWELVE-THIRTYTWO-THIRTYTORNADOCLOWNCOCKROACHCOCKTAILCOCON"
+  "UTCOFFINCOINCOLLISIONACUTE-GRAVE-ACUTEACUTE-MACRONANNUITYBREVE-MACRONES-TEPA"
+  "LATALIZATIONPOKRYTIEVZMETDELETIONDIAERESIS-RINGGRAPHEMEGRAVE-ACUTE-GRAVEGRAV"
+  "E-MACRONMACRON-ACUTEMACRON-BREVEMACRON-GRAVEPALATALIZEDSEAGULLBRACKETSUNDERD"
+  "OTX-XCOMETCOMPASSCOMPLEMENTCOMPRESSIONCONFETTICONFOUNDEDCONFUSEDCONGRUENTCON"
+  "ICALTAPERCONJUNCTIONWORKERCONTINUOUSKNOBSCONVENIENCECOOKEDCOOKINGASPERMORPHO"
+  "LOGICALINDIRECTSTAUROSCOPYLEFTCORALCORNISHCORRESPONDSCOUCHCOUNTERBORECOUNTER"
+  "SINKCOUPLECRABCROCODILECROISSANTJERUSALEMLORRAINEFLAGSSWORDSCRUTCHCRUZEIROCR"
+  "YSTALCUCUMBERUSSUUSSU3LIMMU4NIGIDAESHNIGIDAMINILIMMU3ILIMMU4IMIN3ASH9ESH16ES"
+  "H21QUADCOLONALANKUGAPINARKABASAL2BAG3BARA2BUR2DAG3DAMDARA4DUB2LAK-020DUGUDDU"
+  "HDUN4DUR2EDINEGIRGALAMGAMGAR3GASHANGE22GIDIMGIGGISALGURUNGURUSHHUL2HUSHIL2AS"
+  "H3SHULKAD4KAM2KAM4KISALKISHKU7KWU318LAHSHULAK-003LAK-021LAK-025LAK-030LAK-05"
+  "1LAK-062LAK-080LAK-092LAK-130LAK-142LAK-210LAK-219LAK-220LAK-225LAK-228LAK-2"
+  "38LAK-265LAK-266LAK-343LAK-347LAK-348LAK-383LAK-384LAK-390LAK-441LAK-450LAK-"
+  "457LAK-470LAK-483LAK-490LAK-492LAK-493LAK-495LAK-550LAK-608LAK-636LAK-724LAK"
+  "-749LILLIMMU2MA2MUNSUBMURGU2NA4NAGARNI2NIN9NISAGPIR2RABSANGA2SHAB6SHEG9SHENS"
+  "HESH2SHESHLAMSHINIGSHUBURSUDSUD2SUMASHSUR9TI2UDUGUMBINUR4URIURI3LAK-668USH2U"
+  "SHUMXUSHXUTUKIUZUZAGZAMXZE2ZI3ZIGZUBURZUMSTRAWCUPCAKECUPIDOCURLINGEXCHANGECU"
+  "RRYCUSTARDCUSTOMSCYCLONECYLINDRICITYCM001CM002CM004CM005CM006CM007CM008CM009"
+  "CM010CM011CM012CM012BCM013CM015CM017CM019CM021CM023CM024CM025CM026CM027CM028"
+  "CM029CM030CM033CM034CM035CM036CM037CM038CM039CM040CM041CM044CM046CM047CM049C"
+  "M050CM051CM052CM053CM054CM055CM056CM058CM059CM060CM061CM062CM063CM064CM066CM"
+  "067CM068CM069CM070CM071CM072CM073CM074CM075CM075BCM076CM078CM079CM080CM081CM"
+  "082CM083CM084CM085CM086CM087CM088CM089CM090CM091CM092CM094CM095CM096CM097CM0"
+  "98CM099CM100CM101CM102CM103CM104CM105CM107CM108CM109CM110CM112CM114CM301CM30"
+  "2MULTIOCULARLONG-LEGGEDTHREE-LEGGEDUNBLENDEDDANCERDANGODEAFDECIDUOUSEXPONENT"
+  "CELSIUSFAHRENHEITDELIVERYDEPARTMENTDERELICTISLANDJAINMARWARIPUSHPIKADIAMETER"
+  "SHAPEFACE-1FACE-2FACE-3FACE-4FACE-5FACE-6DIESELDIFFERENCEHEAVENLYDIMENSIONOR"
+  "IGINDISABLEDDISCONTINUOUSDISGUISEDDITTODIVIDESDIVINGDIVORCEDIYADNAHELIXDODON"
+  "EGATIONFORCEPROVEDOLPHINHORIZONTAL-00-00HORIZONTAL-00-01HORIZONTAL-00-02HORI"
+  "ZONTAL-00-03HORIZONTAL-00-04HORIZONTAL-00-05HORIZONTAL-00-06HORIZONTAL-01-00"
+  "HORIZONTAL-01-01HORIZONTAL-01-02HORIZONTAL-01-03HORIZONTAL-01-04HORIZONTAL-0"
+  "1-05HORIZONTAL-01-06HORIZONTAL-02-00HORIZONTAL-02-01HORIZONTAL-02-02HORIZONT"
+  "AL-02-03HORIZONTAL-02-04HORIZONTAL-02-05HORIZONTAL-02-06HORIZONTAL-03-00HORI"
+  "ZONTAL-03-01HORIZONTAL-03-02HORIZONTAL-03-03HORIZONTAL-03-04HORIZONTAL-03-05"
+  "HORIZONTAL-03-06HORIZONTAL-04-00HORIZONTAL-04-01HORIZONTAL-04-02HORIZONTAL-0"
+  "4-03HORIZONTAL-04-04HORIZONTAL-04-05HORIZONTAL-04-06HORIZONTAL-05-00HORIZONT"
+  "AL-05-01HORIZONTAL-05-02HORIZONTAL-05-03HORIZONTAL-05-04HORIZONTAL-05-05HORI"
+  "ZONTAL-05-06HORIZONTAL-06-00HORIZONTAL-06-01HORIZONTAL-06-02HORIZONTAL-06-03"
+  "HORIZONTAL-06-04HORIZONTAL-06-05HORIZONTAL-06-06VERTICAL-00-00VERTICAL-00-01"
+  "VERTICAL-00-02VERTICAL-00-03VERTICAL-00-04VERTICAL-00-05VERTICAL-00-06VERTIC"
+  "AL-01-00VERTICAL-01-01VERTICAL-01-02VERTICAL-01-03VERTICAL-01-04VERTICAL-01-"
+  "05VERTICAL-01-06VERTICAL-02-00VERTICAL-02-01VERTICAL-02-02VERTICAL-02-03VERT"
+  "ICAL-02-04VERTICAL-02-05VERTICAL-02-06VERTICAL-03-00VERTICAL-03-01VERTICAL-0"
+  "3-02VERTICAL-03-03VERTICAL-03-04VERTICAL-03-05VERTICAL-03-06VERTICAL-04-00VE"
+  "RTICAL-04-01VERTICAL-04-02VERTICAL-04-03VERTICAL-04-04VERTICAL-04-05VERTICAL"
+  "-04-06VERTICAL-05-00VERTICAL-05-01VERTICAL-05-02VERTICAL-05-03VERTICAL-05-04"
+  "VERTICAL-05-05VERTICAL-05-06VERTICAL-06-00VERTICAL-06-01VERTICAL-06-02VERTIC"
+  "AL-06-03VERTICAL-06-04VERTICAL-06-05VERTICAL-06-06OBELOSLOW-REVERSED-9STACKE"
+  "DDOUBLE-ENDEDDOUGHNUTDRAFTINGDROMEDARYDROOLINGDROPDRUMSTICKSDUCKDUMPLINGAOUH"
+  "LOOHRHWHWOWCHINOOKTHICKDVDE-MAILMAIZEHEARINGAIDAMERICASASIA-AUSTRALIAEUROPE-"
+  "AFRICAEDITORIALCORONISA005AA006AA006BA014AA017AA032AA040AA042AA043AAA001AA00"
+  "2AA003AA004AA005AA006AA007AA007AAA007BAA008AA009AA010AA011AA012AA013AA014AA0"
+  "15AA016AA017AA018AA019AA020AA021AA022AA023AA024AA025AA026AA027AA028AA029AA03"
+  "0AA031AA032B005AC001C002C002AC002BC002CC003C004C005C006C007C008C009C010C010A"
+  "C011C012C013C014C015C016C017C018C019C020C021C022C023C024D001D002D003D004D005"
+  "D006D007D008D008AD009D010D011D012D013D014D015D016D017D018D019D020D021D022D02"
+  "3D024D025D026D027D027AD028D029D030D031D031AD032D033D034D034AD035D036D037D038"
+  "D039D040D041D042D043D044D045D046D046AD047D048D048AD049D050D050AD050BD050CD05"
+  "0DD050ED050FD050GD050HD050ID051D052D052AD053D054D054AD055D056D057D058D059D06"
+  "0D061D062D063D064D065D066D067D067AD067BD067CD067DD067ED067FD067GD067HE001E00"
+  "2E003E004E005E006E007E008E008AE009E009AE010E011E012E013E014E015E016E016AE017"
+  "E017AE018E019E020E020AE021E022E023E024E025E026E027E028E028AE029E030E031E032E"
+  "033E034E034AE036E037E038F001F001AF002F003F004F005F006F007F008F009F010F011F01"
+  "2F013F013AF014F015F016F017F018F019F020F021F021AF022F023F024F025F026F027F028F"
+  "029F030F031F031AF032F033F034F035F036F037F037AF038F038AF039F040F041F042F043F0"
+  "44F045F045AF046F046AF047F047AF048F049F050F051F051AF051BF051CF052F053G001G002"
+  "G003G004G005G006G006AG007G007AG007BG008G009G010G011G011AG012G013G014G015G016"
+  "G017G018G019G020G020AG021G022G023G024G025G026G026AG027G028G029G030G031G032G0"
+  "33G034G035G036G036AG037G037AG038G039G040G041G042G043G043AG044G045G045AG046G0"
+  "47G048G049G050G051G052G053G054H001H002H003H004H005H006H006AH007H008I001I002I"
+  "003I004I005I005AI006I007I008I009I009AI010I010AI011I011AI012I013I014I015K001K"
+  "002K003K004K005K006K007K008L001L002L002AL003L004L005L006L006AL007L008M001AM0"
+  "01BM003AM010AM012AM012BM012CM012DM012EM012FM012GM012HM015AM016AM017AM022AM02"
+  "4AM028AM031AM033AM033BM040AN001N002N003N004N005N006N007N008N009N010N011N012N"
+  "013N014N015N016N017N018N018AN018BN019N020N021N022N023N024N025N025AN026N027N0"
+  "28N029N030N031N032N033N033AN034N034AN035N035AN036N037N037AN038N039N040N041N0"
+  "42NL001NL002NL003NL004NL005NL005ANL006NL007NL008NL009NL010NL011NL012NL013NL0"
+  "14NL015NL016NL017NL017ANL018NL019NL020NU001NU002NU003NU004NU005NU006NU007NU0"
+  "08NU009NU010NU010ANU011NU011ANU012NU013NU014NU015NU016NU017NU018NU018ANU019N"
+  "U020NU021NU022NU022AO001O001AO002O003O004O005O005AO006O006AO006BO006CO006DO0"
+  "06EO006FO007O008O009O010O010AO010BO010CO011O012O013O014O015O016O017O018O019O"
+  "019AO020O020AO021O022O023O024O024AO025O025AO026O027O028O029O029AO030O030AO03"
+  "1O032O033O033AO034O035O036O036AO036BO036CO036DO037O038O039O040O041O042O043O0"
+  "44O045O046O047O048O049O050O050AO050BO051P001P001AP002P003P003AP004P005P006P0"
+  "07P008P009P010P011Q001Q002Q003Q004Q005Q006Q007R001R002R002AR003R003AR003BR00"
+  "4R005R006R007R008R009R010R010AR011R012R013R014R015R016R016AR017R018R019R020R"
+  "021R022R023R024R025R026R027R028R029S001S002S002AS003S004S005S006S006AS007S00"
+  "8S009S010S011S012S013S014S014AS014BS015S016S017S017AS018S019S020S021S022S023"
+  "S024S025S026S026AS026BS027S028S029S030S031S032S033S034S035S035AS036S037S038S"
+  "039S040S041S042S043S044S045S046T001T002T003T003AT004T005T006T007T007AT008T00"
+  "8AT009T009AT010T011T011AT012T013T014T015T016T016AT017T018T019T020T021T022T02"
+  "3T024T025T026T027T028T029T030T031T032T032AT033T033AT034T035T036U001U002U003U"
+  "004U005U006U006AU006BU007U008U009U010U011U012U013U014U015U016U017U018U019U02"
+  "0U021U022U023U023AU024U025U026U027U028U029U029AU030U031U032U032AU033U034U035"
+  "U036U037U038U039U040U041U042V001V001AV001BV001CV001DV001EV001FV001GV001HV001"
+  "IV002V002AV003V004V005V006V007V007AV007BV008V009V010V011V011AV011BV011CV012V"
+  "012AV012BV013V014V015V016V017V018V019V020V020AV020BV020CV020DV020EV020FV020G"
+  "V020HV020IV020JV020KV020LV021V022V023V023AV024V025V026V027V028V028AV029V029A"
+  "V030V030AV031V031AV032V033V033AV034V035V036V037V037AV038V039V040V040AW001W00"
+  "2W003W003AW004W005W006W007W008W009W009AW010W010AW011W012W013W014W014AW015W01"
+  "6W017W017AW018W018AW019W020W021W022W023W024W024AW025X001X002X003X004X004AX00"
+  "4BX005X006X006AX007X008X008AY001Y001AY002Y003Y004Y005Y006Y007Y008Z001Z002Z00"
+  "2AZ002BZ002CZ002DZ003Z003AZ003BZ004Z004AZ005Z005AZ006Z007Z008Z009Z010Z011Z01"
+  "2Z013Z014Z015Z015AZ015BZ015CZ015DZ015EZ015FZ015GZ015HZ015IZ016Z016AZ016BZ016"
+  "CZ016DZ016EZ016FZ016GZ016HEJECTGHAMMALLEBULBPLUGTORCHELECTRICALELEVATORELFZA"
+  "YIN-YODHBALDTYPE-1-2PROOFDEFINITIONBUMPYEQUIANGULARESTIMATEDESTIMATESPREFACE"
+  "BBAABBEEBOABWECCACCAACCECCEECCHACCHAACCHEECCHHACCHHAACCHHECCHHEECCHHICCHHOCC"
+  "HHUCCHICCHOCCHUCCICCOCCUCHOACHWACOADDEEDDHEDDHEEDDHIDDHUDDOADDWADOADWADZAAFW"
+  "EFYAGGAAGGEEGGWAGGWAAGGWEGGWEEGGWIGOAGWAAGYAGYAAGYEGYEEGYIGYOGYUHHEHHEEHHIHH"
+  "OHHUHHWEHHWEEHHWIHHYAHHYAAHHYEHHYEEHHYIHHYOHHYUHOAJOAKOAKXAAKXEKXEEKXIKXOKXU"
+  "KXWAKXWAAKXWEKXWEEKXWIKYAAKYEKYIKYOKYULOAMOANOANYOANYWAPHEEPHOAPHUPHWAPOAQEE"
+  "QHAQHAAQHEQHEEQHIQHOQHUQHWAQHWAAQHWEQHWEEQHWIQOAQWAQWAAQYAQYAAQYEQYEEQYIQYOQ"
+  "YUROARYASHOASOASSAASSEESZASZAASZESZEESZISZOSZUSZWATHOATOATSAATSWATTHEETTHUTZ"
+  "ATZAATZETZEETZITZOTZOATZUVWAWOAXAAXEEXOAXUXWAXWAAXWEXWEEXWIXYAAXYEEXYIXYOXYU"
+  "YOAZHAAZHWAZOAZWAZZAAZZEECHIRETDERETDERET-HIDETDIFATHIDETKENATKURTYIZETWORDS"
+  "PACEEULEREURO-CURRENCYEVERGREENEXCESSEXPRESSIONLESSEXTRATERRESTRIALEYEGLASSE"
+  "SMASSAGESAVOURINGDELICIOUSSCREAMINGFEARTHROWINGCOWBOYHEAD-BANDAGELOOKTRIUMPH"
+  "MEDICALMONOCLEGOODEYEBROWVOMITINGPEEKINGPLEADINGUNEVENFACSIMILEFACTORYFAIRYF"
+  "ALAFELFALLENFEARFULFENCERFERRISFERRYCABINETFRAMESPROJECTORFINITEEXTINGUISHER"
+  "FIRECRACKERFIREWORKSPARKLERFIREWORKSDESIGNFISHEYEFISHINGFISTEDFLAMINGOFLATNE"
+  "SSFLEUR-DE-LISFLEXEDBICEPSCARDSFLUSHEDSAUCERFOGFOGGYFONDUEFOOTPRINTSFORCESPL"
+  "ATEFORKINGFORTUNECLUB-SPOKEDCLOVERFOUR-PER-EMTILESFREEZINGFRANCFRIESFRIEDFRO"
+  "NT-FACINGFUELPUMPAPPLICATIONFUNERALURNFUSEGARLICHANDLESHUBGEMGEMINIGENIEGEOM"
+  "ETRICGERMANPENNYGETAGIRAFFEGIRLGIRLSMILKGLEICHSTARKMERIDIANSGLOVESGLOWINGGOA"
+  "TGOGGLESGOLFERGORILLAAHSAAIHVUSBAIRKANDAGSEISFAIHUGIBAHAGLIGGWSIUJAJERKUSMAL"
+  "AGUSMANNANAUTHSOTHALPAIRTHRAQAIRTHRARAIDASAUILTEIWSTHIUTHURUSWINJAGRADUATION"
+  "GRAPESCARYSTIANCYRENAICDELPHICHERAEUMPLETHRONMESSENIANNAXIANSTRATIANAROURAAR"
+  "TABEGRAMMAINDICTIONSYMBOL-25SYMBOL-26SYMBOL-27SYMBOL-29SYMBOL-30SYMBOL-32SYM"
+  "BOL-36SYMBOL-37SYMBOL-38SYMBOL-39SYMBOL-40SYMBOL-42SYMBOL-43SYMBOL-45SYMBOL-"
+  "47SYMBOL-48SYMBOL-49KYATHOSLITRAMETRETESOBOLOUNKIASINUSOIDTALENTTRYBLIONSYMB"
+  "OL-10SYMBOL-15SYMBOL-16SYMBOL-20SYMBOL-21SYMBOL-22SYMBOL-3SYMBOL-6SYMBOL-9XE"
+  "STESSALADGRIMACINGGROWINGGUARANIGUARDSMANGUIDEGUITARTHREE-DOTADDAKONKARIRIAD"
+  "AKUDAATYAKASHTIPPIURAHADESHAIRCUTFORMSHAMBURGERSICKLEHAMSAHAMSTERHANDBAGHAND"
+  "BALLHANDSHAKECEONGCHIEUMCHIEUCHCEONGCHIEUMCIEUCCEONGCHIEUMSIOSCEONGCHIEUMSSA"
+  "NGCIEUCCEONGCHIEUMSSANGSIOSCHIEUCH-HIEUHCHIEUCH-KHIEUKHCHITUEUMCHIEUCHCHITUE"
+  "UMCIEUCCHITUEUMSIOSCHITUEUMSSANGCIEUCCHITUEUMSSANGSIOSCIEUC-IEUNGHIEUH-SIOSI"
+  "EUNG-CHIEUCHIEUNG-CIEUCIEUNG-HIEUHIEUNG-MIEUMIEUNG-PANSIOSIEUNG-PHIEUPHIEUNG"
+  "-PIEUPIEUNG-RIEULIEUNG-SIOSIEUNG-THIEUTHIEUNG-TIKEUTKIYEOK-TIKEUTMIEUM-TIKEU"
+  "TNIEUN-PIEUPPHIEUPH-HIEUHPIEUP-KHIEUKHPIEUP-NIEUNPIEUP-SIOS-CIEUCPIEUP-SIOS-"
+  "PIEUPPIEUP-SIOS-THIEUTHPIEUP-SSANGSIOSRIEUL-CIEUCRIEUL-SSANGPIEUPRIEUL-SSANG"
+  "TIKEUTSIOS-IEUNGSIOS-KHIEUKHSIOS-PHIEUPHSIOS-PIEUP-KIYEOKSIOS-SSANGSIOSSSANG"
+  "CIEUC-HIEUHSSANGSIOS-PIEUPSSANGTHIEUTHSSANGYEORINHIEUHTIKEUT-MIEUMCIEUC-PIEU"
+  "PCIEUC-SSANGPIEUPHIEUH-MIEUMHIEUH-NIEUNHIEUH-PIEUPHIEUH-RIEULIEUNG-KHIEUKHIE"
+  "UNG-SSANGKIYEOKKIYEOK-CHIEUCHKIYEOK-HIEUHKIYEOK-KHIEUKHKIYEOK-NIEUNKIYEOK-PI"
+  "EUPKIYEOK-RIEULKIYEOK-SIOS-KIYEOKMIEUM-CHIEUCHMIEUM-CIEUCMIEUM-HIEUHMIEUM-NI"
+  "EUNMIEUM-PIEUP-SIOSMIEUM-RIEULMIEUM-SSANGNIEUNMIEUM-SSANGSIOSNIEUN-CHIEUCHNI"
+  "EUN-RIEULNIEUN-THIEUTHPANSIOS-KAPYEOUNPIEUPPANSIOS-PIEUPPHIEUPH-SIOSPHIEUPH-"
+  "THIEUTHPIEUP-MIEUMPIEUP-RIEULPIEUP-RIEUL-PHIEUPHRIEUL-KIYEOK-HIEUHRIEUL-MIEU"
+  "M-HIEUHRIEUL-MIEUM-KIYEOKRIEUL-MIEUM-SIOSRIEUL-PIEUP-HIEUHRIEUL-PIEUP-PHIEUP"
+  "HRIEUL-PIEUP-TIKEUTRIEUL-SSANGSIOSRIEUL-TIKEUT-HIEUHRIEUL-YEORINHIEUH-HIEUHR"
+  "IEUL-YESIEUNGSIOS-KAPYEOUNPIEUPSIOS-PANSIOSSSANGMIEUMSSANGRIEUL-KHIEUKHSSANG"
+  "SIOS-KIYEOKSSANGSIOS-TIKEUTSSANGTIKEUT-PIEUPTIKEUT-CHIEUCHTIKEUT-SIOS-KIYEOK"
+  "TIKEUT-THIEUTHYESIEUNG-HIEUHYESIEUNG-MIEUMA-EUA-OA-UARAEA-AARAEA-EARAEA-EOAR"
+  "AEA-IARAEA-UEO-EUEO-OEO-UEU-AEU-EEU-EOEU-EUEU-OEU-UI-AI-ARAEAI-EUI-II-OI-O-I"
+  "I-UI-YAI-YA-OI-YAEI-YEI-YEOI-YOI-YUO-EO-EOO-OO-O-IO-UO-YAO-YAEO-YEO-YEOSSANG"
+  "ARAEAU-AU-AEU-EO-EUU-I-IU-UU-YEU-YEOYA-OYA-UYEO-OYEO-UYEO-YAYI-UYO-AYO-AEYO-"
+  "EOYO-OYO-YEOYU-AYU-AEYU-EYU-EOYU-OYU-UARAEAEKHONNASAKINHARBAHAYTAHALATANATAS"
+  "SIHAPPYHATCHINGDALETH-RESHHEADPHONEGRAVEYARDHEAR-NO-EVILCONCAVE-POINTEDROUND"
+  "-TIPPEDTEARDROP-SHANKEDATNAHHAFUKHDARGADEHIETNAHTAMUQDAMILUYMAHAPAKHKEFULAMU"
+  "NAHOLEPASHTAPAZERQADMAQARNEYREVIASHALSHELETGEDOLAQETANATEVIRTIPEHAYERAHYOMOY"
+  "ETIVGADOLZARQAZINORMASORAHASERJUDEO-SPANISHVARIKAMETEGQUBUTSSHEVATSEREMAQAFH"
+  "AFUKHAPASEQPASUQHEDGEHOGHELICOPTERHELLSCHREIBERPAUSEHELMA-1A-2A-3A-WOE-2E-3E"
+  "-4E-5E-6HA-1HA-10HA-11HA-2HA-3HA-4HA-5HA-6HA-7HA-8HA-9HE-1HE-2HE-3HE-4HE-5HE"
+  "-6HE-7HI-1HI-2HI-3HI-4HI-5HI-6HI-7HO-1HO-2HO-3HO-4HO-5HO-6HO-7HO-8HU-1HU-2HU"
+  "-3I-1I-2I-3I-4KA-1KA-10KA-11KA-2KA-3KA-4KA-5KA-6KA-7KA-8KA-9KA-KEKE-1KE-2KE-"
+  "3KE-4KE-5KE-6KI-1KI-2KI-3KI-4KI-5KI-6KI-7KI-8KO-1KO-2KO-3KO-KIKU-1KU-2KU-3KU"
+  "-4KU-5KU-6KU-7MA-1MA-2MA-3MA-4MA-5MA-6MA-7ME-1ME-2ME-MAMI-1MI-2MI-3MI-4MI-5M"
+  "I-6MI-7MO-1MO-2MO-3MO-4MO-5MO-6MU-1MU-2MU-3MU-4N-MU-MO-1N-MU-MO-2NA-1NA-3NA-"
+  "4NA-5NA-6NA-7NA-8NA-9NE-1NE-3NE-4NE-5NE-6NE-KONI-1NI-2NI-3NI-4NI-5NI-6NI-7NI"
+  "-TENO-1NO-2NO-3NO-4NO-5NU-1NU-2NU-3O-1O-2O-3RA-1RA-3RA-4RE-1RE-2RE-3RE-4RI-1"
+  "RI-2RI-3RI-4RI-5RI-6RI-7RO-1RO-2RO-3RO-4RO-5RO-6RU-1RU-2RU-3RU-4RU-5RU-6SA-1"
+  "SA-3SA-4SA-5SA-6SA-7SA-8SE-1SE-2SE-3SE-4SE-5SI-1SI-2SI-3SI-4SI-5SI-6SO-1SO-2"
+  "SO-3SO-4SO-5SO-6SO-7SU-1SU-2SU-3SU-4SU-5SU-6SU-7SU-8TA-1TA-3TA-4TE-1TE-3TE-4"
+  "TE-5TE-6TE-7TE-8TE-9TI-1TI-2TI-3TI-4TI-5TI-6TI-7TO-1TO-2TO-3TO-4TO-5TO-6TO-R"
+  "ATU-1TU-2TU-3TU-4TU-TOU-1U-2U-3U-4U-5WA-1WA-2WA-3WA-4WA-5WE-1WE-2WE-3WE-4WI-"
+  "1WI-2WI-3WI-4WI-5WO-1WO-2WO-3WO-4WO-5WO-6WO-7YA-1YA-2YA-3YA-4YA-5YO-1YO-2YO-"
+  "3YO-4YO-5YO-6YU-1YU-2YU-3YU-4HERBHERMITIANCONJUGATEMATRIXABUNDANCEAFTERAPPRO"
+  "ACHBEFOREBREAKTHROUGHCOMINGCONFLICTCONTEMPLATIONDELIVERANCEDEVELOPMENTDIFFIC"
+  "ULTYBEGINNINGDISPERSIONDURATIONENTHUSIASMFELLOWSHIPINFLUENCETRUTHINNOCENCELI"
+  "MITATIONMODESTYOBSTRUCTIONOPPRESSIONPROGRESSPUSHINGRETREATREVOLUTIONSPLITTIN"
+  "GAPARTSTANDSTILLABYSMALARMYAROUSINGCLINGINGCREATIVEGENTLEJOYOUSSTILLMARRYING"
+  "MAIDENRECEPTIVEWANDERERWELLTREADINGDECAYEDYOUTHFULFOLLYHIBISCUSVOLTAGEHIGH-H"
+  "EELEDHIKINGHINDUTEMPLEHIPPOPOTAMUSYORIHISTORICSITEHOCHOHONEYHONEYBEEBLOCK-13"
+  "58LINE-1LINE-3LINE-7LINE-9HOSPITALSPRINGSFLOWINGSANDGARDENHRYVNIAPOINTSHUSHE"
+  "DHUTHYGIEAHYPODIASTOLEHYSTERESISYOUPUCKLINKINGENTERINGAPRILAUGUSTTHIRTY-ONET"
+  "WENTY-EIGHTTWENTY-NINETWENTY-SEVENTWENTY-SIXDECEMBERFEBRUARYJANUARYJULYJUNEM"
+  "ARCHNOVEMBEROCTOBERSEPTEMBERIMPINBOXINCOMINGINCOMPLETEINCREASESINCREMENTVIEW"
+  "ERINDIANKARORKARORANLAKHANDESKNUMBERSAVERAGEINTERCALATETERMINATORINTERLOCKED"
+  "IZAKAYALANTERNJACK-O-LANTERNGOBLININDUSTRIALOGREBEGINNERKERETPENGKALKAWIRASW"
+  "ADICEREKAGUNGANDAPISEN-ISENLINGSALUHURLUNGSIMADYAPANGKATTIRTATUMETESPANGKONP"
+  "ANGRANGKEPTELULAYARPANYANGGAWIGNYANDIRGAMUREMENDUTTARUNGTOLONGMELIKJEANSJIGS"
+  "AWPUZZLEJOYSTICKJUGGLINGJUNOJUPITERKAABAENUMERATIONKANGAROOAGAINARRIVEBEANBI"
+  "TTERBRISTLECAVECLAWCOLORCOMPARECORPSEDIPPERDISTINGUISHEMBROIDERYEVENINGFANGF"
+  "IGHTFRAGRANTSLOWLYGRAINHALBERDHEMPHIDINGINCHINSECTLACKLEEKLEGSLIFESTRIDEMILL"
+  "ETMINISTERMORNINGONESELFOPPOSEPLOWPRIVATEPROFOUNDRIVERROOFRUNSACRIFICIALSCHO"
+  "LARSHOOTSICKNESSSKINSLAVESPROUTSTANDSTOPPINGTRIPODUSEVALLEYVILLAGEWEAPONWRAP"
+  "WRONGSHYAKELVINTTTHAVHAMANGALAMCAUDAKHITANRIELLYYQAQQAUQUKQUUVRYYNNOAHSDAATT"
+  "HACANAVAKRAHASANYABANTOCBARIYOOSANBATHAMASATBEYYALCAMNUCKUUHCOENGKAKABATKHAN"
+  "KOOMUUTMUUSIKATOANNIKAHITPHNAEKREAHMUKROBATSAMYOKSANNYATOANDAKHIATTRIISAPVIR"
+  "IAMYUUKALEAPINTUSONPATHAMASATTUTEYASATKIMONOKITEKIWIFRUITKNEELINGKNOTKOALAKR"
+  "ONOSLABLABELLACROSSELADDERLADYLANGUAGENIGGAHITACATAWALARIBIDENTALFRICATIVESI"
+  "NOLOGICALLARYNGEALSPIRANTREVERSED-SCHWADUMTRILLKRALAMBDAMUMPRECEDEDNUMQPSAKH"
+  "ADIAERESIZEDSTIRRUPTAILLESSSTRIKETHROUGHFFFFIFFLFLLEAFYLEDGERLEFT-HANDEDLEFT"
+  "-SIDEBOTTOM-SHADEDLEMONLEOLEOPARDNYIN-DOBLAFLAGLAKLATHYOOMRANSLIDERLIBRARAIL"
+  "GYANKEMPHRENGMUKPHRENGSA-IVOWEL-CARRIERLIMITEDLIABILITYINCLUDINGA028BA100-10"
+  "2A120BA131CA309BA309CA313AA313BA313CA332A400-VASA401-VASA402-VASA403-VASA404"
+  "-VASA405-VASA406-VASA407-VASA408-VASA409-VASA410-VASA411-VASA412-VASA413-VAS"
+  "A414-VASA415-VASA416-VASA417-VASA418-VASA531A532A534A535A536A537A538A539A540"
+  "A541A542A545A547A548A549A550A551A552A553A554A555A556A557A559A563A564A565A566"
+  "A568A569A570A571A572A573A574A575A576A577A578A579A580A581A582A583A584A585A586"
+  "A587A588A589A591A592A594A595A596A598A600A601A602A603A604A606A608A609A610A611"
+  "A612A613A614A615A616A617A618A619A620A621A622A623A624A626A627A628A629A634A637"
+  "A638A640A642A643A644A645A646A648A649A651A652A653A654A655A656A657A658A659A660"
+  "A661A662A663A664A701A702A703A704A705A706A707A708A709A709-2L2A709-3L3A709-4L4"
+  "A709-6L6A710A711A712A713A714ABBA715BBA717DDA726EYYYA732A800A801A802A803A804A"
+  "805A806A807AB001AB002AB003AB004AB005AB006AB007AB008AB009AB010AB011AB013AB016"
+  "AB017AB020AB021AB021FAB021MAB022AB022FAB022MAB023AB023MAB024AB026AB027AB028A"
+  "B029AB030AB031AB034AB037AB038AB039AB040AB041AB044AB045AB046AB047AB048AB049AB"
+  "050AB051AB053AB054AB055AB056AB057AB058AB059AB060AB061AB065AB066AB067AB069AB0"
+  "70AB073AB074AB076AB077AB078AB079AB080AB081AB082AB085AB086AB087AB118AB120AB12"
+  "2AB123AB131AAB131BAB164AB171AB180AB188AB191B100B102B104B105EQUIDB105FMAREB10"
+  "5MSTALLIONB106FB106MB107FSHE-GOATB107MHE-GOATB108FSOWB108MB109FB109MBULLB120"
+  "B121BARLEYB122B123SPICEB125CYPERUSB130B131B132B140BRONZEB141B142B145B146B150"
+  "B151B152B153B154B157B158B159B160B161B162GARMENTB163ARMOURB164B165B166B167B16"
+  "8B169B170B171B172B173B174B176B177B178B179B180B181B182B183B184B185B189B190B19"
+  "1B220FOOTSTOOLB225B230B231B232B233SWORDB234B236B240WHEELEDB241B242B243B245B2"
+  "46B248B249B251B252B253B254DARTB255B256B257B258B259B155B200B201B202B203B204B2"
+  "05B206B207B208B209B210B211B212B213B214B215B216B217B218B219B221B222B226B227B2"
+  "28B229B250B305B127KAPOB128KANAKOB133AREPAB135MERIB156TURO2B247DIPTEB010B011B"
+  "012B013B014B015B016B017B020B021B023B024B025B026B027B028B029PU2B030B031B032B0"
+  "33RA3B036B037B038B039B040B041B042B043A3B044B045B046B048B050B051B052B053B054B"
+  "055B057B058B059B060B061B062PTEB065B066TA2B067B068RO2B069B070B071B072B073B074"
+  "B075B076RA2B077B078B080B081B085B087B090DWOB091B018B019B022B034B047B049B056B0"
+  "63B064B079B082B083B086B089LINKEDPAPERCLIPSLIONLIPSTICKJEUYHALIVRETOURNOISLIZ"
+  "ARDLLAMALOBSTERINKLOLLIPOPLOTIONLOUDLYBALLPOINTCRAYONPAINTBRUSHRULELUNGSBHLY"
+  "INGMAGEMAGICWANDMAGNETAUTUMNCHRYSANTHEMUMORCHIDPLUMSPRINGSUMMERWINTERANGKAPA"
+  "SSIMBANGLLLREPHMALTESEMAMMOTHDANCINGBUSINESSLEVITATINGTUXEDOGUAMAOMANATAFFRI"
+  "CATIONAKSAASZATTDUSHENNAHALQAKADUSHENNAVOCALIZATIONMANGOAAYINDHAMEDHGHIMELJA"
+  "YINJHAYINQHOPHSSHINTHAMEDHXAPHXOPHZHAYINMANSMANTELPIECEMANUALLIGHTHOUSEMAPLE"
+  "MARRIAGEMARTIALUNIFORMRA-KARAREPHAMASCULINEMASUMATEMAXIMIZEAIVAAHANGKHUDAMAP"
+  "UNCHEIKHANCHEIKHEIATIYABHAMCHILDHOUDILGHOUGOKHUKJHAMKHOUPHAMRAITHOUWAIAAUANA"
+  "PCHEINAPINAPONAPSOUNAPUNAPYENAPMELTINGMEMOTEENSMUNNANM045M046HUANM047M048M04"
+  "9WVAM050M051M052M053M054M055M056M057M058NYANM059M060NYONM061WVIM062M063M064M"
+  "065M066M067M068M069M070M071M072M073M074M075M076M077M078M079M080M081M082M083H"
+  "EEIM084M085M086M087M088M089M090M091M092M093M094M095M096M097M098NYENM099M100M"
+  "101M102M103M104M105M106M107M108M109M110M111M112M113M114M115M116M117M118M119M"
+  "120M121M122M123M124M125M126M127NGGUAM128HOOUM129M130M131M132M133M134M135M136"
+  "M137M138M139WVEM140M141M142M143M144M145M146M147M148M149M150M151M152M153M154M"
+  "155M156M157M158M159NGGAAM160M161M162M163M164NYINM165M166GUEIM167GUANM168M169"
+  "NONM170NYUNM171M172M173M174M175M176M177NGUANM178M179KUAM180M181M182M183M184M"
+  "185M186M187MBUUM188M189MUENM190M191M192M193M194WUIM195M196SIAM197FUAMENORAHB"
+  "RANCHESMENSTWELFTHIMNRMTBA-2VIDJVIDJ-2MERPERSONMETROBRIDLHADLHYADZYIDZZALHYA"
+  "LYANNHAQGARTESYITLHYATSSAVFAZSAZSHAZZSAZZSYAZZYAAHHIANGIONGOEROEYOGUANUANGUE"
+  "IUNGUOGVWYUIMICROMICROBEMICROSCOPEMILKYMILLMINIBUSMINIDISCMINIMIZEMINUS-OR-P"
+  "LUSMINYOFFMODELSMODERNPENTATHLONARDHACANDRAHUVARHOTICUNASPIRATEDMODULOWINGSM"
+  "ONEY-MOUTHDAGALGADAMARUJIANIAZRANIRUGUBOUNDARYMONORAILMONOSTABLEVIEWINGCEREM"
+  "ONYMOSQUEMOSQUITOMOTORIZEDMOTORWAYMOUNTFUJICABLEWAYTRAPMOVIEMOYAIDAIHAIHAOKE"
+  "AAETEKTHEAMUSHROOMJACKSSCOREBRACECAESURACLIMACUSCLIVISCODAACCENT-STACCATOAUG"
+  "MENTATIONDOITFLAG-1FLAG-2FLAG-3FLAG-4FLAG-5HARMONICLOUREMARCATOMARCATO-STACC"
+  "ATORIPSMEARSNAPPIZZICATOSPRECHGESANGSTACCATISSIMOSTACCATOTENUTOCOMMONCRESCEN"
+  "DOCROIXCAPODECRESCENDOCLEF-1CLEF-2STIMMEFIVE-LINEFORTEFOUR-LINEFOUR-STRINGHA"
+  "UPTSTIMMERECITATIVEKORONMAXIMAMEZZOMULTINEBENSTIMMEONE-LINESTROKE-1STROKE-10"
+  "STROKE-11STROKE-2STROKE-3STROKE-4STROKE-5STROKE-6STROKE-7STROKE-8STROKE-9PES"
+  "SUBPUNCTISPIANOPODATUSFIGURE-1FIGURE-2FIGURE-3RINFORZANDOSIX-LINESIX-STRINGS"
+  "ORISUBITODIMINUTION-2DIMINUTION-3THREE-LINERESUPINUSTRTWO-LINEVIRGAVOIDFINGE"
+  "RNAILSGHWANNYAHMQNASATPAOEMPHATICAFOREMENTIONEDCOMPLETEDGENITIVELOCATIVEHATH"
+  "IGEBACRUCIFORMNAILNAIRABADGENANDPARKNAUSEATEDNAZARAMULETNECKTIENERDNESSUSEGG"
+  "SNESTINGNEUTERSHEQELLAEVUEYSHORTENERSIDDHINEXTSTARSNINJADANTAYALANDOROMELAJA"
+  "NYALANDAGBASINNAGBAKURUNENDENNENTAMANBICYCLESPHONESPEDESTRIANSPIRACYNOMINALN"
+  "OMISMANON-BREAKINGNON-POTABLENONFORKINGNORDICQUANTITYNORTHEAST-POINTINGDECOR"
+  "ATIVENUMERONUSHUNCANKANPANPLANQANTANTSANTXATXANYAJANIMALINVERTEBRATETHINGTON"
+  "E-BTONE-DTONE-GTONE-JTONE-MTONE-STONE-VOBJECTOBSERVERAMOUNTBUCKLECUSTOMEROCT"
+  "AGONALOCTOPUSODENAILMBEITHCEIRTCOLLDAIREABHADHEADHADHEAMHANCHOLLFEARNGORTIFI"
+  "NIODHADHLUISMUINNGEADALNIONPEITHRUISSAILSTRAIFTINNEUATHUILLEANNAHADGAAHLAAAA"
+  "JAAKAAMAAWEDDINYOBOTTTTUDDAGMU-GAAHLAAPHAARKAARELAAEKSERSESSES-1ES-2ES-3GEEM"
+  "CHERYDZHOIDZITAGAIKOKELEIMENOEPEEIREISHCHOOISHOOITSIUVERVOOIYRYZHOIAURAMAZDA"
+  "AAURAMAZDAA-2AURAMAZDAAHABAGABUUMISHDAHYAAUSHDAHYAAUSH-2XSHAAYATHIYARESH-AYI"
+  "N-DALETHAYIN-DALETHDHADHEDHALETHGHAYNKHETHTHAWTHETHAEDAELAERAESBASHELTAENGGI"
+  "MEL-HETHONE-PIECESWIMSUITONIONH-TYPEL-TYPEOPEN-OUTLINEDOPHIUCHUSOPTIONORANGU"
+  "TANORTHODOXDEELLAANMIINNUUNSHIINOTTERMARRATANOUTBOXOVERHEATEDOWLOYSTERPACKAG"
+  "EPAGERPAGODAFAJHAMHAWJKHABKWMLAUJLISMUASPHABTHOJTSABTSHEEJTSWBVAJVWJXYOOJYEE"
+  "GCAUCHAUHLAUHNAULAUMAUNAUNCHAUNKAUNLAUNTHAUNTSAUPLHAUQHAURAUVAUXAUYAUHOMKESK"
+  "HAVSUAMTAUMTUBBILLIONSTRILLIONSCHEEMCUAMTSHOOJHAISLUSNRESTOSPUBDAWBTSOVCHWVH"
+  "NUBLOSSUABTSEEBMUSNQIGNTUJTHIRD-STAGETXHEEJCEEVFEEMLUBNRUASEEVTHIABTHOMTSHAB"
+  "CEEBXAUSXIABFAIBNTXIVTOVXYOOZWJTHAJKAABKAAVKAIBKAIVKAUBKAUVKAVKAWBKAWVKEBKEE"
+  "BKEEVKEVKIABKIAVKIBKIVKOBKOOBKOOVKOVKUABKUAVKUBKUVKWBKWVPALLASPALMSPANCAKESP"
+  "ANDAPAPERCLIPPARACHUTEPARAGRAPHUSFESTIVALREPRESENTOJEONPARROTALTERNATIONPART"
+  "IALLY-RECYCLEDPOPPERPASSEDPASSENGERPASSIVE-PULL-DOWN-OUTPUTPASSIVE-PULL-UP-O"
+  "UTPUTPASSPORTPRINTSPEACHPEACOCKPEANUTSPEARPENGUINPENSIVEPERFORMINGPERMANENTP"
+  "ERSEVERINGBOWINGDEEPLYCLIMBINGDOINGCARTWHEELSTEAMYROOMCELEBRATIONBLONDFOLDED"
+  "HEADSCARFPERSPECTIVEPESETAPETRIASPIRATEDVOICELESSSUPERFIXEDBEEHIVEBULLSCAPTI"
+  "VECOLUMNCOMBDOLIUMGAUNTLETGRATERHIDELILYMANACLESMATTOCKPAPYRUSPLUMEDSLINGSTR"
+  "AINERTATTOOEDTIARATUNNYBANDALFDELTGAMLLAMDROSHSEMKZAIPHOLUSPICKUPPILEPILLPIN"
+  "ATAPINCHEDPINCHINGPINEPINEAPPLEPISCESPISTOLPLACARDINTERESTWORSHIPPLAYGROUNDS"
+  "LIDEFOOLTRUMP-1TRUMP-10TRUMP-11TRUMP-12TRUMP-13TRUMP-14TRUMP-15TRUMP-16TRUMP"
+  "-17TRUMP-18TRUMP-19TRUMP-2TRUMP-20TRUMP-21TRUMP-3TRUMP-4TRUMP-5TRUMP-6TRUMP-"
+  "7TRUMP-8TRUMP-9PLUNGERPLUS-MINUSPOCKETCALCULATORCARSOFFICERPOODLEFORMATTINGP"
+  "OPCORNPORTABLESTEREOPOSEIDONPOSTBOXPOTABLEPOTTEDPLANTPOUCHPOULTRYPOURINGON-O"
+  "FFSLEEPPRAYERBEADSPRESCRIPTIONTAKEBRAKCETPRETZELPREVIOUSPRINCEPRINCESSPROBIN"
+  "GCANEPROHIBITEDPROJECTIVEPROPERTYPROPORTIONALPROSERPINAPUBLICADDRESSLOUDSPEA"
+  "KERPUNCTUSELEVATUSPURSEITSQUATERNIONQUESTIONEDQUINCUNXRACCOONMOTORCYCLERADIO"
+  "ACTIVERAINBOWMDMRRATIORAZORRECEIPTRECREATIONALVEHICLERECYCLEDGENERICMATERIAL"
+  "STYPE-1TYPE-2TYPE-7GIFTREFERENCEREGISTEREDNYJAREMINDERENTRY-1ENTRY-2RESTROOM"
+  "RHINOCEROSRIALCRACKERRIFLERIGHT-HANDEDRIGHT-SIDERIGHTHANDBUOYRINGEDPLANETRIN"
+  "GINGROASTEDROBOTROLLROLLED-UPCOASTERLAUGHINGCENTURIALDENARIUSDIMIDIADUPONDIU"
+  "SEARLYLATEQUINARIUSSEMUNCIASESTERTIUSSEXTANSSILIQUAUNCIAROOSTERROSECAISHOUSH"
+  "UANGXIROWBOATRUBLERUGBYRULE-DELAYEDARLAUGBELGTHORALGIZEOLHXANSUZBERKANANBEOR"
+  "CBJARKANCALCCEALCCENCWEORTHDAGAZDAEGDOTTED-LDOTTED-NDOTTED-PEHWAZFEHUFEOHGEB"
+  "OGYFUGERHAEGLHAGLAZICELANDIC-YRINGWAZIORISAZISSIWAZEOHJERANKAUNKAUNALAUKAZLA"
+  "GULOGRLONG-BRANCH-ARLONG-BRANCH-HAGALLLONG-BRANCH-MADRLONG-BRANCH-OSSLONG-BR"
+  "ANCH-YRMANNAZNAUDIZNYDNAUDOPEN-POTHALANETHELPERTHOPEORTHRAIDOREIDSHORT-TWIG-"
+  "ARSHORT-TWIG-BJARKANSHORT-TWIG-HAGALLSHORT-TWIG-MADRSHORT-TWIG-NAUDSHORT-TWI"
+  "G-OSSSHORT-TWIG-SOLSHORT-TWIG-TYRSHORT-TWIG-YRSIGELLONG-BRANCH-SOLSOWILOSTAN"
+  "THURISAZTHURSTIWAZTYRURUZWUNJOTVIMADURRUNNERSHIRTSASHBINOVILENOVILEQUINTILES"
+  "ENTAGONTREDECILEVIGINTILEVESTSAGITTARIUSSAILBOATSAKESHAKERSALUTINGALAFDALATG"
+  "AMANLABATQUFSINGAATTAAFTSAADIYIN-ALAFOCCLUSIONAFSAAQANGEDANNAAUARKAANUATMAAU"
+  "BAUMELODICSHIYYAALAAMASHFAATTURUZAEFZIQAASANDWICHSATURNHAARUSAUROPODSAXOPHON"
+  "ESCALESSCARFSATCHELSCORPIONSCORPIUSSCREWDRIVERSCROLLSCRUPLESEATSECTORSEDNASE"
+  "E-NO-EVILSEEDLINGSELFIESEMISEXTILESEPARATEDSERIOUSSERVICESESQUIQUADRATESEWIN"
+  "GNEEDLESEXTILESHALLOWSHAMROCKCONTINUATIONEKAMEXTRASUTRASHARKSHAVEDADOAGEAREA"
+  "RRAYAWEBIBDEADGAGHA-HAHUNGIFJUDGEKICKLOLLMIMEOAKOOZEPEEPROARSURETHEYTHIGHVOW"
+  "WOEYEAYEWSHINTOSHRINESHOCKEDEXPLODINGSHOOTINGBAGSTROLLEYSHORTCAKECONTINUINGS"
+  "HOULDEREDSHOWERSHRUGSHUFFLETHREE-CIRCLESEPTUPLEORNAMENTSBLOWSUCKSUCKINGEXHAL"
+  "EINHALEPUFFEDEVERYOTHERFASTGRADUALEXCITEMENTWINKSQUEEZEDWIDENINGFLOORPLANEOT"
+  "HERSTOUCHESFACINGSTILTRIMCOMBINATIONLENGTH-1LENGTH-2LENGTH-3LENGTH-4LENGTH-5"
+  "LENGTH-6LENGTH-7PRESSEDDEPTHHEIGHTLIMBSDIGITSTORSOLOCATION-FLOORPLANELOCATIO"
+  "N-WALLPLANECOMBINEDWIGGLESMODIFIER-10MODIFIER-11MODIFIER-12MODIFIER-13MODIFI"
+  "ER-14MODIFIER-15MODIFIER-16MODIFIER-7MODIFIER-8MODIFIER-9POSITIONSSPINEWAIST"
+  "BITELICKINGMOVESAGAINSTCHEEKFARTORSO-FLOORPLANETWISTINGSTRETCHJOINTSWALLPLAN"
+  "EJAPANSINEAAYANNAAEEYANNAAEYANNAAIYANNAAMBAAUYANNAAYANNAEEYANNAEYANNAFAYANNA"
+  "HAYANNAIIYANNAILUUYANNAILUYANNAIRUUYANNAIRUYANNAIYANNAKANTAJAMAYANNAOOYANNAO"
+  "YANNARAYANNASANYOOGANAAKSIKYAYAUUYANNAUYANNAVAYANNAYAYANNAKUNDDALIYAAL-LAKUN"
+  "AANUSVARAYAVISARGAYAKOMBUDEKASIX-PER-EMSKATEBOARDSKIERSKUNKSLAVONICSLEDACCOM"
+  "MODATIONSLEEPYSLEUTHSPYPIZZASLOPESLOTSLOTHHALOTEARSMIRKINGSNAILSNEEZINGCAPPE"
+  "DSNOWBOARDERSOCCERSOCKSSOFTBALLSOFTWARE-FUNCTIONFETHRESH-AYINSOONBAHCAHDAHEE"
+  "HJAHLAHNGAHNYAHPAHRAHRECORDINGSPAGHETTISPARKLESSPARKLINGSPEAK-NO-EVILSPEAKIN"
+  "GSPEEDBOATSPESMILOWEBSPLASHINGSPONGESPOOLSPORTSSPOUTINGAARUANPEAAPAATOARUHUA"
+  "BAARERUBEETABIRUBORUTOBQBUSSYERUCALCORPORATIONDAASUDESIDJDLDORUEEKAAHEISEIME"
+  "IZIREIWASYOUWATAISYOUERGESUKUUDOFMGANMAGARONGBGHZGIGAGINIIGIRUDAAGPAGURAMUGU"
+  "RAMUTONGYHAITUHEKUTAARUHERUTUHOKAHOONHOORUHPAHUARADDOHUIITOHURANININGUINTIKA"
+  "IRIKARATTOKARORIIKBKCALKEESUKHZKIROKIROGURAMUKIROMEETORUKIROWATTOKLKOOPOKORU"
+  "NAKTKUROONEKURUZEIROKVKYURIILMLNLOGLXMAHHAMAIKUROMAIRUMANSYONMARUKUMEETORUME"
+  "GATONMGMHZMIKURONMILMIRIMIRIBAARUMLMOLMSNANONFNMNOTTONSNWONSUOOMUAMPSPAASENT"
+  "OPAATUPCPEEZIPENIHIPENSUPFPHPIASUTORUPIKOPIKURUPMPOINTOPONDOPPMPRPSPVPWREMUR"
+  "ENTOGENRIRARITTORURUPIIRUUBURUSAIKURUSANTIIMUSENTISENTOSIRINGUSRTHZTONUONWAT"
+  "TOWBCONTOUREDOUTLINEORTHOGONALYAADOYAARUYUANIDEOGRAPH-4E00IDEOGRAPH-4E2DIDEO"
+  "GRAPH-4EA4IDEOGRAPH-518DIDEOGRAPH-521DIDEOGRAPH-524DIDEOGRAPH-5272IDEOGRAPH-"
+  "53CCIDEOGRAPH-53F3IDEOGRAPH-5408IDEOGRAPH-5439IDEOGRAPH-55B6IDEOGRAPH-58F0ID"
+  "EOGRAPH-591AIDEOGRAPH-5929IDEOGRAPH-5B57IDEOGRAPH-5DE6IDEOGRAPH-5F8CIDEOGRAP"
+  "H-624BIDEOGRAPH-6295IDEOGRAPH-6307IDEOGRAPH-6355IDEOGRAPH-6599IDEOGRAPH-65B0"
+  "IDEOGRAPH-6620IDEOGRAPH-6708IDEOGRAPH-6709IDEOGRAPH-6E80IDEOGRAPH-6F14IDEOGR"
+  "APH-7121IDEOGRAPH-751FIDEOGRAPH-7533IDEOGRAPH-7981IDEOGRAPH-7A7AIDEOGRAPH-7D"
+  "42IDEOGRAPH-89E3IDEOGRAPH-8CA9IDEOGRAPH-8D70IDEOGRAPH-904AIDEOGRAPH-914DCLCO"
+  "OLHCHDRHI-RESIDKOKOLOSSLESSPPVSDSHVSOSUHDVODVSSQUIDSTADIUMAESCULAPIUSHERMESS"
+  "TANDINGDAVIDSTATIONSTATUELIBERTYSTEAMINGSTENOGRAPHICSTETHOSCOPEARMSSTOPWATCH"
+  "STRAIGHTNESSSTRAWBERRYSTRICTLYSTUDIOSTUFFEDSTUPAPAMINGKALPANYAKRAPANYIKUREUS"
+  "YAPANGLONGPURNAMASURYAPAMAAEHPANGLAYARPANGWISADPANYECEKPAMEPETPANAELAENGPANE"
+  "ULEUNGPANGHULUPANOLONGPANYUKUSUNFLOWERMOUNTAINSSUNSETSUPERHEROSUPERVILLAINSU"
+  "RFERSUSHISWANSWIMMERSWUNGJHOMARK-4DVISVARABACKSPACECARRIAGEDATAENQUIRYMARKSC"
+  "HAPTERHEADINGSYNCHRONOUSIDLEELECTRONICSSYMMETRYSYNAGOGUEBARREKHCONTRACTIONAN"
+  "GULARASTERISCUSMETOBELUSOBELUSHBASA-ESASALAMADHDHALATHGHAMALQAPHZHAINQUSHSHA"
+  "YARUKKAKHARWAHASYRINGET-REXT-SHIRTPADDLETACOTANGRATARUECAANGDOKMAIHANGHOYKAA"
+  "NKAANKUUKEOWKHUEN-LUEKARANYAMOKHAAMSAKOTSATKAANSATKAANKUUSAWANWIANGWIANGWAAK"
+  "KHITHOISONGUEATAKEOUTTAMALEDEBITDOWNSCALINGKIIZHEIGHTIETHHALF-1HALF-2SIXTEEN"
+  "TH-1SIXTEENTH-2THREE-HUNDRED-AND-TWENTIETHSIXTY-FOURTHSLANDAAZHAAKKUCEVITUKA"
+  "ACUKURUNIKUZHIMUKKURUNIMUTHALIYAMUUVUZHAKKUNELPAARAMPANAMPATHAKKUUZHAKKUVAKA"
+  "IYARAAVARAAKANVELISPENTSTARTINGWETTANABATATANGERINEAWCAWQAWZEQHTTAIZMQMXMZOC"
+  "OZUECUEQUICUIQUIUCUIUQUIUXUIUZUIXUIZUQUXUZVCVQVXVZCOMPONENT-001COMPONENT-002"
+  "COMPONENT-003COMPONENT-004COMPONENT-005COMPONENT-006COMPONENT-007COMPONENT-0"
+  "08COMPONENT-009COMPONENT-010COMPONENT-011COMPONENT-012COMPONENT-013COMPONENT"
+  "-014COMPONENT-015COMPONENT-016COMPONENT-017COMPONENT-018COMPONENT-019COMPONE"
+  "NT-020COMPONENT-021COMPONENT-022COMPONENT-023COMPONENT-024COMPONENT-025COMPO"
+  "NENT-026COMPONENT-027COMPONENT-028COMPONENT-029COMPONENT-030COMPONENT-031COM"
+  "PONENT-032COMPONENT-033COMPONENT-034COMPONENT-035COMPONENT-036COMPONENT-037C"
+  "OMPONENT-038COMPONENT-039COMPONENT-040COMPONENT-041COMPONENT-042COMPONENT-04"
+  "3COMPONENT-044COMPONENT-045COMPONENT-046COMPONENT-047COMPONENT-048COMPONENT-"
+  "049COMPONENT-050COMPONENT-051COMPONENT-052COMPONENT-053COMPONENT-054COMPONEN"
+  "T-055COMPONENT-056COMPONENT-057COMPONENT-058COMPONENT-059COMPONENT-060COMPON"
+  "ENT-061COMPONENT-062COMPONENT-063COMPONENT-064COMPONENT-065COMPONENT-066COMP"
+  "ONENT-067COMPONENT-068COMPONENT-069COMPONENT-070COMPONENT-071COMPONENT-072CO"
+  "MPONENT-073COMPONENT-074COMPONENT-075COMPONENT-076COMPONENT-077COMPONENT-078"
+  "COMPONENT-079COMPONENT-080COMPONENT-081COMPONENT-082COMPONENT-083COMPONENT-0"
+  "84COMPONENT-085COMPONENT-086COMPONENT-087COMPONENT-088COMPONENT-089COMPONENT"
+  "-090COMPONENT-091COMPONENT-092COMPONENT-093COMPONENT-094COMPONENT-095COMPONE"
+  "NT-096COMPONENT-097COMPONENT-098COMPONENT-099COMPONENT-100COMPONENT-101COMPO"
+  "NENT-102COMPONENT-103COMPONENT-104COMPONENT-105COMPONENT-106COMPONENT-107COM"
+  "PONENT-108COMPONENT-109COMPONENT-110COMPONENT-111COMPONENT-112COMPONENT-113C"
+  "OMPONENT-114COMPONENT-115COMPONENT-116COMPONENT-117COMPONENT-118COMPONENT-11"
+  "9COMPONENT-120COMPONENT-121COMPONENT-122COMPONENT-123COMPONENT-124COMPONENT-"
+  "125COMPONENT-126COMPONENT-127COMPONENT-128COMPONENT-129COMPONENT-130COMPONEN"
+  "T-131COMPONENT-132COMPONENT-133COMPONENT-134COMPONENT-135COMPONENT-136COMPON"
+  "ENT-137COMPONENT-138COMPONENT-139COMPONENT-140COMPONENT-141COMPONENT-142COMP"
+  "ONENT-143COMPONENT-144COMPONENT-145COMPONENT-146COMPONENT-147COMPONENT-148CO"
+  "MPONENT-149COMPONENT-150COMPONENT-151COMPONENT-152COMPONENT-153COMPONENT-154"
+  "COMPONENT-155COMPONENT-156COMPONENT-157COMPONENT-158COMPONENT-159COMPONENT-1"
+  "60COMPONENT-161COMPONENT-162COMPONENT-163COMPONENT-164COMPONENT-165COMPONENT"
+  "-166COMPONENT-167COMPONENT-168COMPONENT-169COMPONENT-170COMPONENT-171COMPONE"
+  "NT-172COMPONENT-173COMPONENT-174COMPONENT-175COMPONENT-176COMPONENT-177COMPO"
+  "NENT-178COMPONENT-179COMPONENT-180COMPONENT-181COMPONENT-182COMPONENT-183COM"
+  "PONENT-184COMPONENT-185COMPONENT-186COMPONENT-187COMPONENT-188COMPONENT-189C"
+  "OMPONENT-190COMPONENT-191COMPONENT-192COMPONENT-193COMPONENT-194COMPONENT-19"
+  "5COMPONENT-196COMPONENT-197COMPONENT-198COMPONENT-199COMPONENT-200COMPONENT-"
+  "201COMPONENT-202COMPONENT-203COMPONENT-204COMPONENT-205COMPONENT-206COMPONEN"
+  "T-207COMPONENT-208COMPONENT-209COMPONENT-210COMPONENT-211COMPONENT-212COMPON"
+  "ENT-213COMPONENT-214COMPONENT-215COMPONENT-216COMPONENT-217COMPONENT-218COMP"
+  "ONENT-219COMPONENT-220COMPONENT-221COMPONENT-222COMPONENT-223COMPONENT-224CO"
+  "MPONENT-225COMPONENT-226COMPONENT-227COMPONENT-228COMPONENT-229COMPONENT-230"
+  "COMPONENT-231COMPONENT-232COMPONENT-233COMPONENT-234COMPONENT-235COMPONENT-2"
+  "36COMPONENT-237COMPONENT-238COMPONENT-239COMPONENT-240COMPONENT-241COMPONENT"
+  "-242COMPONENT-243COMPONENT-244COMPONENT-245COMPONENT-246COMPONENT-247COMPONE"
+  "NT-248COMPONENT-249COMPONENT-250COMPONENT-251COMPONENT-252COMPONENT-253COMPO"
+  "NENT-254COMPONENT-255COMPONENT-256COMPONENT-257COMPONENT-258COMPONENT-259COM"
+  "PONENT-260COMPONENT-261COMPONENT-262COMPONENT-263COMPONENT-264COMPONENT-265C"
+  "OMPONENT-266COMPONENT-267COMPONENT-268COMPONENT-269COMPONENT-270COMPONENT-27"
+  "1COMPONENT-272COMPONENT-273COMPONENT-274COMPONENT-275COMPONENT-276COMPONENT-"
+  "277COMPONENT-278COMPONENT-279COMPONENT-280COMPONENT-281COMPONENT-282COMPONEN"
+  "T-283COMPONENT-284COMPONENT-285COMPONENT-286COMPONENT-287COMPONENT-288COMPON"
+  "ENT-289COMPONENT-290COMPONENT-291COMPONENT-292COMPONENT-293COMPONENT-294COMP"
+  "ONENT-295COMPONENT-296COMPONENT-297COMPONENT-298COMPONENT-299COMPONENT-300CO"
+  "MPONENT-301COMPONENT-302COMPONENT-303COMPONENT-304COMPONENT-305COMPONENT-306"
+  "COMPONENT-307COMPONENT-308COMPONENT-309COMPONENT-310COMPONENT-311COMPONENT-3"
+  "12COMPONENT-313COMPONENT-314COMPONENT-315COMPONENT-316COMPONENT-317COMPONENT"
+  "-318COMPONENT-319COMPONENT-320COMPONENT-321COMPONENT-322COMPONENT-323COMPONE"
+  "NT-324COMPONENT-325COMPONENT-326COMPONENT-327COMPONENT-328COMPONENT-329COMPO"
+  "NENT-330COMPONENT-331COMPONENT-332COMPONENT-333COMPONENT-334COMPONENT-335COM"
+  "PONENT-336COMPONENT-337COMPONENT-338COMPONENT-339COMPONENT-340COMPONENT-341C"
+  "OMPONENT-342COMPONENT-343COMPONENT-344COMPONENT-345COMPONENT-346COMPONENT-34"
+  "7COMPONENT-348COMPONENT-349COMPONENT-350COMPONENT-351COMPONENT-352COMPONENT-"
+  "353COMPONENT-354COMPONENT-355COMPONENT-356COMPONENT-357COMPONENT-358COMPONEN"
+  "T-359COMPONENT-360COMPONENT-361COMPONENT-362COMPONENT-363COMPONENT-364COMPON"
+  "ENT-365COMPONENT-366COMPONENT-367COMPONENT-368COMPONENT-369COMPONENT-370COMP"
+  "ONENT-371COMPONENT-372COMPONENT-373COMPONENT-374COMPONENT-375COMPONENT-376CO"
+  "MPONENT-377COMPONENT-378COMPONENT-379COMPONENT-380COMPONENT-381COMPONENT-382"
+  "COMPONENT-383COMPONENT-384COMPONENT-385COMPONENT-386COMPONENT-387COMPONENT-3"
+  "88COMPONENT-389COMPONENT-390COMPONENT-391COMPONENT-392COMPONENT-393COMPONENT"
+  "-394COMPONENT-395COMPONENT-396COMPONENT-397COMPONENT-398COMPONENT-399COMPONE"
+  "NT-400COMPONENT-401COMPONENT-402COMPONENT-403COMPONENT-404COMPONENT-405COMPO"
+  "NENT-406COMPONENT-407COMPONENT-408COMPONENT-409COMPONENT-410COMPONENT-411COM"
+  "PONENT-412COMPONENT-413COMPONENT-414COMPONENT-415COMPONENT-416COMPONENT-417C"
+  "OMPONENT-418COMPONENT-419COMPONENT-420COMPONENT-421COMPONENT-422COMPONENT-42"
+  "3COMPONENT-424COMPONENT-425COMPONENT-426COMPONENT-427COMPONENT-428COMPONENT-"
+  "429COMPONENT-430COMPONENT-431COMPONENT-432COMPONENT-433COMPONENT-434COMPONEN"
+  "T-435COMPONENT-436COMPONENT-437COMPONENT-438COMPONENT-439COMPONENT-440COMPON"
+  "ENT-441COMPONENT-442COMPONENT-443COMPONENT-444COMPONENT-445COMPONENT-446COMP"
+  "ONENT-447COMPONENT-448COMPONENT-449COMPONENT-450COMPONENT-451COMPONENT-452CO"
+  "MPONENT-453COMPONENT-454COMPONENT-455COMPONENT-456COMPONENT-457COMPONENT-458"
+  "COMPONENT-459COMPONENT-460COMPONENT-461COMPONENT-462COMPONENT-463COMPONENT-4"
+  "64COMPONENT-465COMPONENT-466COMPONENT-467COMPONENT-468COMPONENT-469COMPONENT"
+  "-470COMPONENT-471COMPONENT-472COMPONENT-473COMPONENT-474COMPONENT-475COMPONE"
+  "NT-476COMPONENT-477COMPONENT-478COMPONENT-479COMPONENT-480COMPONENT-481COMPO"
+  "NENT-482COMPONENT-483COMPONENT-484COMPONENT-485COMPONENT-486COMPONENT-487COM"
+  "PONENT-488COMPONENT-489COMPONENT-490COMPONENT-491COMPONENT-492COMPONENT-493C"
+  "OMPONENT-494COMPONENT-495COMPONENT-496COMPONENT-497COMPONENT-498COMPONENT-49"
+  "9COMPONENT-500COMPONENT-501COMPONENT-502COMPONENT-503COMPONENT-504COMPONENT-"
+  "505COMPONENT-506COMPONENT-507COMPONENT-508COMPONENT-509COMPONENT-510COMPONEN"
+  "T-511COMPONENT-512COMPONENT-513COMPONENT-514COMPONENT-515COMPONENT-516COMPON"
+  "ENT-517COMPONENT-518COMPONENT-519COMPONENT-520COMPONENT-521COMPONENT-522COMP"
+  "ONENT-523COMPONENT-524COMPONENT-525COMPONENT-526COMPONENT-527COMPONENT-528CO"
+  "MPONENT-529COMPONENT-530COMPONENT-531COMPONENT-532COMPONENT-533COMPONENT-534"
+  "COMPONENT-535COMPONENT-536COMPONENT-537COMPONENT-538COMPONENT-539COMPONENT-5"
+  "40COMPONENT-541COMPONENT-542COMPONENT-543COMPONENT-544COMPONENT-545COMPONENT"
+  "-546COMPONENT-547COMPONENT-548COMPONENT-549COMPONENT-550COMPONENT-551COMPONE"
+  "NT-552COMPONENT-553COMPONENT-554COMPONENT-555COMPONENT-556COMPONENT-557COMPO"
+  "NENT-558COMPONENT-559COMPONENT-560COMPONENT-561COMPONENT-562COMPONENT-563COM"
+  "PONENT-564COMPONENT-565COMPONENT-566COMPONENT-567COMPONENT-568COMPONENT-569C"
+  "OMPONENT-570COMPONENT-571COMPONENT-572COMPONENT-573COMPONENT-574COMPONENT-57"
+  "5COMPONENT-576COMPONENT-577COMPONENT-578COMPONENT-579COMPONENT-580COMPONENT-"
+  "581COMPONENT-582COMPONENT-583COMPONENT-584COMPONENT-585COMPONENT-586COMPONEN"
+  "T-587COMPONENT-588COMPONENT-589COMPONENT-590COMPONENT-591COMPONENT-592COMPON"
+  "ENT-593COMPONENT-594COMPONENT-595COMPONENT-596COMPONENT-597COMPONENT-598COMP"
+  "ONENT-599COMPONENT-600COMPONENT-601COMPONENT-602COMPONENT-603COMPONENT-604CO"
+  "MPONENT-605COMPONENT-606COMPONENT-607COMPONENT-608COMPONENT-609COMPONENT-610"
+  "COMPONENT-611COMPONENT-612COMPONENT-613COMPONENT-614COMPONENT-615COMPONENT-6"
+  "16COMPONENT-617COMPONENT-618COMPONENT-619COMPONENT-620COMPONENT-621COMPONENT"
+  "-622COMPONENT-623COMPONENT-624COMPONENT-625COMPONENT-626COMPONENT-627COMPONE"
+  "NT-628COMPONENT-629COMPONENT-630COMPONENT-631COMPONENT-632COMPONENT-633COMPO"
+  "NENT-634COMPONENT-635COMPONENT-636COMPONENT-637COMPONENT-638COMPONENT-639COM"
+  "PONENT-640COMPONENT-641COMPONENT-642COMPONENT-643COMPONENT-644COMPONENT-645C"
+  "OMPONENT-646COMPONENT-647COMPONENT-648COMPONENT-649COMPONENT-650COMPONENT-65"
+  "1COMPONENT-652COMPONENT-653COMPONENT-654COMPONENT-655COMPONENT-656COMPONENT-"
+  "657COMPONENT-658COMPONENT-659COMPONENT-660COMPONENT-661COMPONENT-662COMPONEN"
+  "T-663COMPONENT-664COMPONENT-665COMPONENT-666COMPONENT-667COMPONENT-668COMPON"
+  "ENT-669COMPONENT-670COMPONENT-671COMPONENT-672COMPONENT-673COMPONENT-674COMP"
+  "ONENT-675COMPONENT-676COMPONENT-677COMPONENT-678COMPONENT-679COMPONENT-680CO"
+  "MPONENT-681COMPONENT-682COMPONENT-683COMPONENT-684COMPONENT-685COMPONENT-686"
+  "COMPONENT-687COMPONENT-688COMPONENT-689COMPONENT-690COMPONENT-691COMPONENT-6"
+  "92COMPONENT-693COMPONENT-694COMPONENT-695COMPONENT-696COMPONENT-697COMPONENT"
+  "-698COMPONENT-699COMPONENT-700COMPONENT-701COMPONENT-702COMPONENT-703COMPONE"
+  "NT-704COMPONENT-705COMPONENT-706COMPONENT-707COMPONENT-708COMPONENT-709COMPO"
+  "NENT-710COMPONENT-711COMPONENT-712COMPONENT-713COMPONENT-714COMPONENT-715COM"
+  "PONENT-716COMPONENT-717COMPONENT-718COMPONENT-719COMPONENT-720COMPONENT-721C"
+  "OMPONENT-722COMPONENT-723COMPONENT-724COMPONENT-725COMPONENT-726COMPONENT-72"
+  "7COMPONENT-728COMPONENT-729COMPONENT-730COMPONENT-731COMPONENT-732COMPONENT-"
+  "733COMPONENT-734COMPONENT-735COMPONENT-736COMPONENT-737COMPONENT-738COMPONEN"
+  "T-739COMPONENT-740COMPONENT-741COMPONENT-742COMPONENT-743COMPONENT-744COMPON"
+  "ENT-745COMPONENT-746COMPONENT-747COMPONENT-748COMPONENT-749COMPONENT-750COMP"
+  "ONENT-751COMPONENT-752COMPONENT-753COMPONENT-754COMPONENT-755COMPONENT-756CO"
+  "MPONENT-757COMPONENT-758COMPONENT-759COMPONENT-760COMPONENT-761COMPONENT-762"
+  "COMPONENT-763COMPONENT-764COMPONENT-765COMPONENT-766COMPONENT-767COMPONENT-7"
+  "68CARTRIDGETAURUSTEACUPTEAPOTTEAR-OFFTEARDROP-BARBEDTEDDYMODEMRECORDERTELESC"
+  "OPETELEVISIONRRRATUUMUTENGETESTTUBEACCUMULATIONADVANCEAGGRAVATIONASCENTBARRI"
+  "ERRESOLUTIONBRANCHINGCHANGECLOSENESSCLOSURECOMPLIANCECONSTANCYCONTENTIONCONT"
+  "RARIETYDECISIVENESSDEFECTIVENESSDISTORTIONDIFFICULTIESDIMINISHMENTDIMMINGDIV"
+  "ERGENCEDOUBTDUTIESEASEEMBELLISHMENTENCOUNTERSENDEAVOURENLARGEMENTEXHAUSTIONF"
+  "AILUREFLIGHTFOSTERINGFULLNESSGOINGGREATNESSGUARDEDNESSHARDNESSKINSHIPLABOURI"
+  "NGMODELLEGIONMASSINGMIREDVERGEPACKINGPENETRATIONPURITYRELEASERESIDENCERESIST"
+  "ANCERITUALSEVERANCESINKINGSTOPPAGESTOVESTRENGTHUNITYVASTNESSWASTINGYOUTHFULN"
+  "ESSAABAAFILIABAFILIEBEFILIEEBEEFILIEYBEYFILIIBIFILIAINUALIFUCHAVIYANIDAADHUD"
+  "AVIYANIDHAALUFAAFUGAAFUGHAINUGNAVIYANIJAVIYANIKAAFULAAMULHAVIYANIMEEMUNOONUP"
+  "AVIYANIQAAFUSAADHUSEENUSHAVIYANISHEENUTAVIYANITHAALUVAAVUWAAVUZAVIYANIOABOAF"
+  "ILIOBOFILIOOBOOFILIUBUFILIANGKHANKHUBAIMAICHANCHANGCHINGCHOECHADADEKFONGMANN"
+  "OKHUKKHONKHUATKHWAIRAKHANGKHOMUTLAKKHANGYAOCHULACHATTAWAHAN-AKATTRIMAITAIKHU"
+  "MAIYAMOKNGUNIKHAHITPAIYANNOIPHINTHUPHANPHUNGSAMPHAORUAMAIMALAIMAIMUANUEERUSI"
+  "SALATHANTHAKHATNANGMONTHOPHUTHAOTHAHANTHUNGPATAKTAOWAENYAMAKKANYINGBAHTEXIST"
+  "EXISTSTHEREFORETHERMODYNAMICTHINKINGDIMENSIONALNETWORKEDCOMPUTERSBOTTOM-LIGH"
+  "TEDLEFT-LIGHTEDRIGHT-LIGHTEDTHREE-EMTHREE-PER-EMTHUNDERSTORM-KHYUDSDONGTSHUG"
+  "SSGRAGCAN-CHARCANGTE-USBUB-CHALCHADLHAGBKA-BSDUSBSKA-BSKURBSTARTRUNCATEDINTE"
+  "RSYLLABICLEADINGMNYAMSGORPALUTARINCHENSPUNGSSBRULTRAILING-PHRUMEDLCIRJESSNAL"
+  "DANDRILPADMAGDANTICKETAHAGGARAYERTAWELLEMETYAGNYABYABHYACHYADYADDYADDHYADHYA"
+  "FYAGYAGHHYAHHYAKHHYALYARRYASYASHYASSYATHYATTYAVYAWYAZZYEYLABIALIZATIONTRIFOL"
+  "IATETIMERTIREDGVANGTOILETTOKYOTOWERTOMATOTOOLBOXTOOTHBRUSHIDEOGRAPH-52DDIDEO"
+  "GRAPH-5B89IDEOGRAPH-6557IDEOGRAPH-672CIDEOGRAPH-70B9IDEOGRAPH-76D7RUNOUTTRAC"
+  "KBALLTRACTORTRADETRANSPLUTOTRANSVERSALEMBLEMTROLLTROLLEYBUSTROPHYARTATRUMPET"
+  "TUGRIKTULIPTUMBLERTURKEYTURKISHTWISTEDASTERISKSALIGNEDWOMENTWO-EMALPADHALGAM"
+  "LAHOTAQOPARASHASAMKATHANNADROPSUNAMUSEDUNCERTAINTYUNDOUNICORNUNITEDUNMARRIED"
+  "UPSIDE-DOWNBHEEBHIBHOOBHUDHEEDHHADHHEDHHEEDHHIDHHODHHOODHHUDHIDHOODHUEENGBEN"
+  "GBONGENGOOKPANKPENMGBEMGBEEMGBIMGBOMGBOOMGBUNGANNYOOOONWANWEENWENWINWOONWUNZ"
+  "HOOBANGDO-ODOONGFEENGJONGKEENGKUNGTINGTONGVAMPIRESELECTOR-1SELECTOR-10SELECT"
+  "OR-100SELECTOR-101SELECTOR-102SELECTOR-103SELECTOR-104SELECTOR-105SELECTOR-1"
+  "06SELECTOR-107SELECTOR-108SELECTOR-109SELECTOR-11SELECTOR-110SELECTOR-111SEL"
+  "ECTOR-112SELECTOR-113SELECTOR-114SELECTOR-115SELECTOR-116SELECTOR-117SELECTO"
+  "R-118SELECTOR-119SELECTOR-12SELECTOR-120SELECTOR-121SELECTOR-122SELECTOR-123"
+  "SELECTOR-124SELECTOR-125SELECTOR-126SELECTOR-127SELECTOR-128SELECTOR-129SELE"
+  "CTOR-13SELECTOR-130SELECTOR-131SELECTOR-132SELECTOR-133SELECTOR-134SELECTOR-"
+  "135SELECTOR-136SELECTOR-137SELECTOR-138SELECTOR-139SELECTOR-14SELECTOR-140SE"
+  "LECTOR-141SELECTOR-142SELECTOR-143SELECTOR-144SELECTOR-145SELECTOR-146SELECT"
+  "OR-147SELECTOR-148SELECTOR-149SELECTOR-15SELECTOR-150SELECTOR-151SELECTOR-15"
+  "2SELECTOR-153SELECTOR-154SELECTOR-155SELECTOR-156SELECTOR-157SELECTOR-158SEL"
+  "ECTOR-159SELECTOR-16SELECTOR-160SELECTOR-161SELECTOR-162SELECTOR-163SELECTOR"
+  "-164SELECTOR-165SELECTOR-166SELECTOR-167SELECTOR-168SELECTOR-169SELECTOR-17S"
+  "ELECTOR-170SELECTOR-171SELECTOR-172SELECTOR-173SELECTOR-174SELECTOR-175SELEC"
+  "TOR-176SELECTOR-177SELECTOR-178SELECTOR-179SELECTOR-18SELECTOR-180SELECTOR-1"
+  "81SELECTOR-182SELECTOR-183SELECTOR-184SELECTOR-185SELECTOR-186SELECTOR-187SE"
+  "LECTOR-188SELECTOR-189SELECTOR-19SELECTOR-190SELECTOR-191SELECTOR-192SELECTO"
+  "R-193SELECTOR-194SELECTOR-195SELECTOR-196SELECTOR-197SELECTOR-198SELECTOR-19"
+  "9SELECTOR-2SELECTOR-20SELECTOR-200SELECTOR-201SELECTOR-202SELECTOR-203SELECT"
+  "OR-204SELECTOR-205SELECTOR-206SELECTOR-207SELECTOR-208SELECTOR-209SELECTOR-2"
+  "1SELECTOR-210SELECTOR-211SELECTOR-212SELECTOR-213SELECTOR-214SELECTOR-215SEL"
+  "ECTOR-216SELECTOR-217SELECTOR-218SELECTOR-219SELECTOR-22SELECTOR-220SELECTOR"
+  "-221SELECTOR-222SELECTOR-223SELECTOR-224SELECTOR-225SELECTOR-226SELECTOR-227"
+  "SELECTOR-228SELECTOR-229SELECTOR-23SELECTOR-230SELECTOR-231SELECTOR-232SELEC"
+  "TOR-233SELECTOR-234SELECTOR-235SELECTOR-236SELECTOR-237SELECTOR-238SELECTOR-"
+  "239SELECTOR-24SELECTOR-240SELECTOR-241SELECTOR-242SELECTOR-243SELECTOR-244SE"
+  "LECTOR-245SELECTOR-246SELECTOR-247SELECTOR-248SELECTOR-249SELECTOR-25SELECTO"
+  "R-250SELECTOR-251SELECTOR-252SELECTOR-253SELECTOR-254SELECTOR-255SELECTOR-25"
+  "6SELECTOR-26SELECTOR-27SELECTOR-28SELECTOR-29SELECTOR-3SELECTOR-30SELECTOR-3"
+  "1SELECTOR-32SELECTOR-33SELECTOR-34SELECTOR-35SELECTOR-36SELECTOR-37SELECTOR-"
+  "38SELECTOR-39SELECTOR-4SELECTOR-40SELECTOR-41SELECTOR-42SELECTOR-43SELECTOR-"
+  "44SELECTOR-45SELECTOR-46SELECTOR-47SELECTOR-48SELECTOR-49SELECTOR-5SELECTOR-"
+  "50SELECTOR-51SELECTOR-52SELECTOR-53SELECTOR-54SELECTOR-55SELECTOR-56SELECTOR"
+  "-57SELECTOR-58SELECTOR-59SELECTOR-6SELECTOR-60SELECTOR-61SELECTOR-62SELECTOR"
+  "-63SELECTOR-64SELECTOR-65SELECTOR-66SELECTOR-67SELECTOR-68SELECTOR-69SELECTO"
+  "R-7SELECTOR-70SELECTOR-71SELECTOR-72SELECTOR-73SELECTOR-74SELECTOR-75SELECTO"
+  "R-76SELECTOR-77SELECTOR-78SELECTOR-79SELECTOR-8SELECTOR-80SELECTOR-81SELECTO"
+  "R-82SELECTOR-83SELECTOR-84SELECTOR-85SELECTOR-86SELECTOR-87SELECTOR-88SELECT"
+  "OR-89SELECTOR-9SELECTOR-90SELECTOR-91SELECTOR-92SELECTOR-93SELECTOR-94SELECT"
+  "OR-95SELECTOR-96SELECTOR-97SELECTOR-98SELECTOR-99VECTORBAHIRGOMUKHAUBHAYATOM"
+  "UKHAATIKRAMAHEXIFORMNIHSHVASARTHANGTIRYAKATHARVAVEDICKARSHANAPRENKHARIGVEDIC"
+  "SHARAAGGRAVATEDSCHROEDERVERSICLEVESTAVIBRATIONMODEVIDEOCASSETTENHAYVIEWDATAV"
+  "IOLINVIRGOVOIDEDVOLCANOVOLLEYBALLVOLUMEVULCANUSNINTHSEVENTHWAFFLEAANGLLHAUEN"
+  "YIHNGUNKOINITUPNIWARNINGWASTEBASKETBUFFALOCLOSETPOLOWATERMELONWEDDINGLIFTERD"
+  "HARMASTRIPESELENABISECTINGTRAPEZIUMWHITE-FEATHEREDWILTEDCHIMEWIREDWOLFBUNNYB"
+  "OOTSWOMENSWORLDWORMWORRIEDWRAPPEDPRESENTWREATHWRESTLERSX-RAYXORYAWNINGCHHIMC"
+  "HIMELIFHAYKHAFXHEYNBAPBAXBBAPBBATBBAXBBEPBBEXBBIEBBIEPBBIETBBIEXBBIPBBITBBIX"
+  "BBOPBBOTBBOXBBUOBBUOPBBUOXBBUPBBURBBURXBBUXBBYBBYPBBYTBBYXBEPBEXBIEBIEPBIETB"
+  "IEXBIPBIXBOPBOTBUOBUOPBUOXBUPBURXBUXBYPBYRBYRXBYTBYXCAXCEPCEXCHAPCHAXCHEPCHE"
+  "TCHEXCHOPCHOTCHOXCHUOCHUOPCHUOTCHUOXCHUPCHURCHURXCHUXCHYCHYPCHYRCHYRXCHYTCHY"
+  "XCIECIEPCIETCIEXCITCIXCOPCOTCOXCUOCUOXCURCURXCUXCYRCYRXCYXDAXDDAPDDATDDAXDDE"
+  "PDDEXDDIEDDIEPDDIEXDDIPDDITDDIXDDOPDDOTDDOXDDUODDUOPDDUOXDDUPDDURXDDUTDDUXDE"
+  "PDEXDIEPDIEXDIPDITDIXDOPDOXDUODUOXDUPDURDURXDUTDUXFAPFATFIPFITFIXFOPFUPFURXF"
+  "UTFUXFYFYPFYTFYXGATGAXGETGEXGGAPGGATGGAXGGEPGGETGGEXGGIEGGIEPGGIEXGGITGGIXGG"
+  "OTGGOXGGUOPGGUOTGGUOXGGUPGGURGGURXGGUTGGUXGIEGIEPGIETGIEXGIPGITGIXGOPGOXGUOG"
+  "UOPGUOTGUOXGUPGURXGUTGUXHAPHAXHEPHEXHIEXHLAPHLATHLAXHLEHLEPHLEXHLIEHLIEPHLIE"
+  "XHLIPHLITHLIXHLOHLOPHLOXHLUHLUOHLUOPHLUOXHLUPHLURHLURXHLUTHLUXHLYHLYPHLYRHLY"
+  "RXHLYTHLYXHMAHMAPHMATHMAXHMIHMIEHMIEPHMIEXHMIPHMITHMIXHMOPHMOTHMOXHMUHMUOHMU"
+  "OPHMUOXHMUPHMURHMURXHMUTHMUXHMYHMYPHMYRHMYRXHMYXHNAPHNATHNAXHNEHNEPHNEXHNIHN"
+  "IEHNIEPHNIETHNIEXHNIPHNITHNIXHNOPHNOTHNOXHNUOHNUOXHNUTHOPHOXHUOHUOPHUOTHUOXH"
+  "XAHXAPHXATHXAXHXEHXEPHXEXHXIHXIEHXIEPHXIETHXIEXHXIPHXIXHXOHXOTHXOXHXUOPHXUOT"
+  "HXUOXIEPIETIEXIPJIEJIEPJIETJIEXJIPJITJIXJJIEPJJIETJJIEXJJIPJJITJJIXJJOPJJOTJ"
+  "JOXJJUOJJUOPJJUOXJJUPJJURJJURXJJUXJJYPJJYTJJYXJOPJOXJUOJUOPJUOTJUOXJUPJURJUR"
+  "XJUTJUXJYJYPJYRJYRXJYTJYXKATKAXKEPKEXKIEKIEPKIEXKIXKOPKOTKOXKUOKUOXKUPKURXKU"
+  "XLATLAXLEPLEXLIEPLIETLIEXLITLIXLOPLOTLOXLUOLUOPLUOTLUOXLUPLURLURXLUTLUXLYPLY"
+  "RXLYTLYXMATMAXMEXMGAMGAPMGATMGAXMGEMGEPMGEXMGIEMGIEXMGOPMGOTMGOXMGUMGUOMGUOP"
+  "MGUOXMGUPMGURMGURXMGUTMGUXMIEMIEPMIEXMIPMIXMOTMOXMUOMUOPMUOTMUOXMUPMURMURXMU"
+  "TMUXMYPMYTMYXNAPNAXNBANBAPNBATNBAXNBINBIEPNBIEXNBIPNBITNBIXNBONBOPNBOTNBOXNB"
+  "UNBUPNBURNBURXNBUTNBUXNBYNBYPNBYRNBYRXNBYTNBYXNDATNDAXNDEPNDEXNDIENDIEXNDIPN"
+  "DITNDIXNDOPNDOTNDOXNDUPNDURNDURXNDUTNDUXNEPNEXNGAPNGATNGAXNGEPNGEXNGIENGIEPN"
+  "GIEXNGOTNGOXNGUONGUOTNGUOXNIENIEPNIEXNIPNITNIXNJIENJIEPNJIETNJIEXNJIPNJITNJI"
+  "XNJOPNJOTNJOXNJUONJUOXNJUPNJURNJURXNJUXNJYNJYPNJYRNJYRXNJYTNJYXNOPNOXNRAPNRA"
+  "TNRAXNRENREPNRETNREXNRONROPNROXNRUNRUPNRURNRURXNRUTNRUXNRYNRYPNRYRNRYRXNRYTN"
+  "RYXNUONUOPNUOXNUPNURNURXNUXNYIENYIEPNYIETNYIEXNYIXNYOTNYOXNYUONYUOPNYUOXNYUP"
+  "NYUTNYUXNZAPNZATNZAXNZENZEXNZINZIENZIEPNZIEXNZIPNZITNZIXNZOPNZOXNZUNZUONZUOX"
+  "NZURNZURXNZUXNZYNZYPNZYRNZYRXNZYTNZYXPATPAXPIEPPIEXPIXPOXPUOPUOPPUOXPURPURXP"
+  "UXPYPYPPYRPYRXPYXQIEQIEPQIETQIEXQIPQITQIXQOPQOXQUOPQUOTQUOXQUPQURQURXQUTQUXQ"
+  "YQYPQYRQYRXQYTQYXRAXREPREXROPROTROXRRAXRREPRRETRREXRROPRROTRROXRRURRUORRUOXR"
+  "RUPRRURRRURXRRUTRRUXRRYRRYPRRYRRRYRXRRYTRRYXRUORUOPRUOXRUPRURRURXRUTRUXRYPRY"
+  "RRYRXRYTRYXSAXSEPSEXSHAPSHAXSHEPSHEXSHOTSHOXSHUOSHUOPSHUOXSHUPSHURXSHUTSHUXS"
+  "HYPSHYRSHYRXSHYTSHYXSIESIEPSIEXSIPSITSOPSOXSSAPSSATSSAXSSEPSSEXSSIESSIEPSSIE"
+  "XSSIPSSITSSIXSSOPSSOTSSOXSSUPSSUTSSUXSSYSSYPSSYRSSYRXSSYTSSYXSUOSUOPSUOXSUPS"
+  "URXSUTSUXSYSYPSYRSYRXSYTSYXTAPTAXTEPTEXTIEPTIEXTIXTOXTUOTUOPTUOXTURXTUTTUXUO"
+  "PUOXVAPVATVAXVEXVIEVIEPVIEXVIPVITVIXVOPVOTVOXVUPVURXVUTVUXVYPVYRVYRXVYTVYXWA"
+  "TWEPWEXWOPWOXWUOPWUOXXIEXIEPXIETXIEXXIPXITXIXXOPXOTXOXXUOXUOXXYXYPXYRXYRXXYT"
+  "XYXYIEPYIETYIEXYIPYIXYOPYOXYUOYUOTYUOXYUPYURYURXYUXYYPYYRYYRXYYTYYXZAPZATZAX"
+  "ZEPZEXZHAPZHATZHAXZHEPZHETZHEXZHOPZHOTZHOXZHUOZHUOPZHUOXZHUPZHURZHURXZHUTZHU"
+  "XZHYZHYPZHYRZHYRXZHYTZHYXZIEZIEPZIEXZIPZITZIXZOPZOXZUOZUOPZUOXZURXZUTZUXZYPZ"
+  "YRZYRXZYTZYXZZAPZZATZZAXZZEPZZEXZZIEZZIEPZZIEXZZIPZZITZZIXZZOPZZOXZZUPZZURZZ"
+  "URXZZUXZZYZZYPZZYRZZYRXZZYTZZYXYO-YOMEMBERSHIPDOMAINRELATIONALPIPINGPROJECTI"
+  "ONSPOTZEBRANON-JOINERZEUSZIPPER-MOUTHATTACHINGBORZAYAPOLNAYADVOETOCHIEKACHKA"
+  "KUPNAYALOMKAOBLACHKOOTSECHKAPODVERTKARAVNORAZSEKASKOBATOCHKAUDARKAZELOZEVOKM"
+  "RACHNOSVETLOTRESVETLODERBITSADUDADVACHELNUBORZYMRACHNYSVETLYTRESVETLYKHAMILO"
+  "KOBYLAKUFISMAKLYUCHENEPOSTOYANNYKLYUCHEPOVODNYKLYUCHEVOYPOVODNYNEMKAOBLAKOPA"
+  "LKAPARAKLITPAUKPOLKULIZMYZAKRYTOEDVUMYAZAPYATYMIROGOMPODCHASHIEMOCHKOMDVOECH"
+  "ELNOKRYZHEVAYAKLYUCHEPOVODNAYATRYASKAKRYZHEVAYAMRACHNOTIKHAYAPOLUPOVODNAYAPU"
+  "TNAYATRYASOGLASNAYATRYASOPOVODNAYATRYASOSTRELNAYAZANOZHEKZMEYTSALEVEL-2LEVEL"
+  "-3ZOMBIE"
+  ;
+
+static const unsigned char uname_word_len[13106] = {
+  6,4,4,5,8,7,10,5,6,2,9,6,12,8,5,4,5,6,8,9,1,11,5,5,
+  3,4,9,5,6,6,6,9,8,5,8,7,3,5,5,4,3,8,4,6,6,7,1,7,
+  10,3,5,6,3,1,3,5,1,5,1,3,3,8,1,5,10,5,2,9,7,7,9,6,
+  8,8,2,5,6,7,4,6,5,7,4,8,7,4,7,3,4,5,2,10,3,6,8,7,
+  2,4,1,1,3,7,8,8,4,9,5,5,9,10,4,7,1,5,5,5,4,3,4,3,
+  6,4,5,7,5,4,8,8,5,2,7,4,13,4,7,3,4,5,9,4,4,10,6,5,
+  5,4,5,9,6,8,2,8,1,9,2,9,8,6,11,4,6,7,8,10,5,3,5,2,
+  6,8,2,4,10,2,8,7,2,4,1,7,2,9,2,9,5,6,4,7,5,8,3,2,
+  9,4,1,2,11,1,1,6,6,1,12,7,6,7,8,8,7,13,1,9,1,4,8,7,
+  5,7,2,1,9,9,8,5,2,4,5,1,9,8,8,11,5,9,6,7,7,2,5,6,
+  5,9,5,7,1,4,3,4,8,1,1,7,7,9,3,18,6,4,3,4,5,7,7,3,
+  10,7,2,10,6,1,9,5,2,7,8,1,5,8,6,5,4,8,7,5,15,3,19,3,
+  9,9,2,8,7,3,2,2,4,3,6,2,5,2,6,4,5,1,5,5,5,5,9,9,
+  6,6,8,7,4,3,10,5,8,7,9,9,6,4,4,2,6,6,10,5,7,5,3,8,
+  3,3,3,6,4,2,8,11,7,7,8,7,5,4,2,5,7,4,5,6,9,3,9,3,
+  5,4,7,4,12,9,6,1,5,3,8,6,3,6,5,13,3,3,7,5,2,3,4,3,
+  7,8,2,3,4,7,7,4,7,7,3,8,7,9,8,10,7,4,2,5,5,7,3,8,
+  4,5,10,3,3,2,6,6,6,3,2,6,5,4,4,2,3,2,5,7,5,7,2,3,
+  3,7,8,11,6,8,3,11,8,4,8,3,3,3,5,6,5,3,3,6,2,5,7,6,
+  3,4,3,3,4,2,6,9,7,6,2,2,6,4,4,11,9,4,3,2,2,9,7,2,
+  5,3,2,9,7,9,7,5,8,6,7,7,3,3,6,7,13,7,7,6,7,2,2,3,
+  6,2,12,6,3,5,3,8,6,3,4,4,5,4,12,2,2,2,7,4,7,7,3,6,
+  2,3,11,4,6,2,4,4,9,12,5,3,2,5,2,8,7,3,7,5,3,12,9,3,
+  4,4,3,4,7,7,8,7,7,4,10,4,8,6,5,2,4,5,8,3,9,7,8,8,
+  4,7,3,3,6,7,5,7,6,6,7,4,5,10,7,9,3,11,4,6,10,5,2,7,
+  14,5,3,5,4,6,2,3,2,3,5,6,3,4,6,6,9,3,11,9,4,5,2,7,
+  2,8,2,2,2,6,8,5,4,5,6,5,6,8,2,5,8,8,4,9,2,3,5,7,
+  8,6,4,2,7,11,14,7,2,3,2,8,5,6,11,4,2,2,2,2,7,4,7,4,
+  11,7,8,2,2,2,2,2,6,3,2,2,3,12,4,5,4,4,5,3,4,10,3,13,
+  8,7,2,7,5,3,2,3,7,6,5,2,3,2,3,6,13,5,2,2,5,7,4,3,
+  5,6,6,3,8,12,2,8,2,2,3,5,4,3,3,3,3,2,3,10,10,6,3,2,
+  3,2,4,6,6,9,4,4,12,2,3,8,3,6,5,5,5,4,7,10,8,5,6,2,
+  11,2,5,6,5,4,3,2,9,3,4,2,3,7,5,6,7,7,6,11,5,6,2,5,
+  4,6,3,2,8,5,3,5,4,6,9,8,4,7,4,5,4,3,3,6,17,8,6,5,
+  7,2,6,3,6,3,2,2,7,4,6,4,6,6,5,2,6,2,5,9,10,2,6,8,
+  7,4,3,7,4,8,19,18,3,5,5,5,5,5,3,2,6,3,6,2,3,3,2,5,
+  4,5,5,3,5,5,3,5,8,6,5,4,4,7,5,7,5,2,8,6,3,2,5,13,
+  7,3,2,5,8,3,10,3,4,14,7,7,4,6,8,8,7,4,4,6,4,8,5,7,
+  4,9,5,2,6,2,2,4,6,5,4,3,2,6,4,4,4,9,2,3,2,3,2,8,
+  7,6,2,4,2,6,6,4,6,6,5,4,3,3,3,4,4,5,2,8,11,3,8,3,
+  7,4,5,5,4,7,3,3,2,10,7,4,7,2,9,3,2,2,2,3,4,2,4,5,
+  4,7,4,6,4,3,6,5,4,7,3,4,5,6,3,5,11,10,9,6,2,4,5,3,
+  3,2,2,2,2,8,7,4,9,7,6,4,4,8,4,3,5,6,6,4,4,3,3,3,
+  3,7,6,4,8,11,7,4,6,7,8,6,3,6,6,5,2,8,7,9,4,5,9,7,
+  9,4,16,10,11,4,4,4,9,7,5,6,2,5,3,10,5,4,3,6,4,2,8,2,
+  3,3,3,6,4,7,9,2,6,5,5,8,6,5,6,3,2,8,13,5,6,3,4,2,
+  3,2,6,6,3,2,5,8,5,3,3,4,9,6,12,8,7,10,6,8,8,7,12,7,
+  5,10,7,8,9,5,8,3,6,10,4,4,5,9,5,9,4,3,5,8,5,4,2,2,
+  5,8,3,8,3,3,7,2,7,3,8,8,7,5,7,6,5,5,7,5,5,4,7,6,
+  6,4,8,8,9,8,6,3,8,4,9,4,8,4,4,9,9,3,3,9,8,10,6,6,
+  4,10,4,5,7,5,3,8,3,8,5,5,8,10,6,6,5,6,3,10,8,9,8,9,
+  9,4,4,7,6,7,5,9,8,8,7,3,9,4,8,5,6,5,3,3,3,3,3,3,
+  6,3,2,4,6,2,6,5,7,6,4,9,6,2,3,3,3,4,3,6,6,4,8,4,
+  9,17,3,5,4,4,2,4,4,3,3,3,3,5,3,3,6,3,8,15,7,4,7,4,
+  7,8,5,9,6,5,5,3,8,7,8,5,8,4,6,14,5,5,17,4,3,6,4,3,
+  6,3,8,6,5,13,5,4,4,7,3,3,2,4,6,4,4,3,3,3,3,3,5,3,
+  3,9,9,4,3,3,10,8,6,15,4,3,4,8,11,11,6,6,3,6,3,3,3,3,
+  3,3,6,5,3,4,3,5,3,5,2,4,7,8,2,2,6,7,4,4,6,4,5,2,
+  7,4,5,2,5,3,6,3,3,3,3,4,3,4,4,7,3,5,5,5,7,5,2,6,
+  4,3,3,3,4,12,3,9,7,4,4,3,3,3,3,11,10,6,7,2,3,5,5,7,
+  4,6,7,10,12,2,5,7,12,4,7,6,10,5,3,8,7,6,5,3,7,6,5,5,
+  7,7,6,8,5,12,8,14,10,9,7,3,3,7,4,10,8,8,8,7,7,4,5,4,
+  4,11,5,6,4,5,5,7,5,6,6,3,6,7,7,5,4,3,2,7,7,3,3,4,
+  9,6,3,4,4,3,3,3,4,3,3,3,5,4,8,5,4,8,4,12,2,2,2,4,
+  8,4,7,13,6,9,3,3,3,4,3,3,3,3,3,3,3,3,3,2,3,3,3,4,
+  3,4,5,3,2,5,2,6,6,3,4,10,4,6,6,6,9,5,6,7,9,7,10,11,
+  7,5,4,6,3,4,3,3,3,9,3,3,2,6,8,5,8,5,6,9,6,6,13,2,
+  8,11,3,2,7,5,5,6,3,3,3,3,11,3,8,2,6,11,4,6,3,7,5,6,
+  6,8,2,8,4,10,4,7,8,4,10,4,4,11,6,6,8,2,2,8,5,6,6,17,
+  8,7,15,5,3,4,4,3,7,5,10,4,5,7,9,6,14,7,2,10,3,3,3,3,
+  4,6,4,4,4,7,5,3,3,7,6,11,3,4,5,7,4,9,6,5,3,3,2,6,
+  5,4,10,3,4,4,3,4,3,4,3,4,5,3,3,3,3,3,4,4,4,3,3,3,
+  8,3,6,3,12,3,3,4,3,6,11,9,8,8,6,7,9,5,8,4,4,5,10,11,
+  8,3,2,8,6,8,7,6,6,6,4,3,3,3,3,2,3,3,3,3,2,7,4,3,
+  3,3,3,4,3,3,3,2,12,4,3,4,2,3,3,7,2,6,5,4,5,12,4,3,
+  5,5,2,5,6,4,7,11,4,14,4,2,6,3,4,3,3,3,4,3,5,5,4,5,
+  3,3,4,4,3,4,3,3,9,5,3,2,4,5,6,4,4,6,6,8,11,6,10,2,
+  5,6,3,2,8,9,9,3,5,2,7,5,7,4,5,5,8,4,12,3,4,4,3,3,
+  4,3,3,4,4,3,3,4,3,3,3,4,11,5,11,11,10,11,12,11,11,10,10,11,
+  10,9,11,6,14,5,6,4,5,3,7,6,8,5,4,9,3,9,3,4,6,4,7,6,
+  9,13,12,3,4,5,4,4,4,2,8,3,9,5,11,6,10,8,4,3,4,6,2,5,
+  10,2,3,6,6,3,2,10,9,7,3,5,4,4,8,7,4,2,2,3,3,10,9,6,
+  7,2,5,5,11,3,4,8,6,12,13,3,3,9,6,6,18,9,7,10,13,7,7,7,
+  3,2,7,6,6,6,12,10,4,4,8,6,13,5,7,11,8,9,8,15,9,7,4,4,
+  4,12,3,2,4,6,5,6,3,5,4,7,11,5,7,6,7,5,6,4,3,3,4,5,
+  4,3,3,3,3,3,4,3,3,4,7,3,3,3,5,11,11,5,7,4,5,7,14,3,
+  5,5,4,4,4,3,4,8,3,5,4,3,4,4,5,3,6,3,4,3,4,4,3,3,
+  4,4,4,4,3,4,4,4,3,3,5,4,3,3,4,10,10,6,4,8,4,10,11,4,
+  6,7,7,7,6,5,7,5,3,2,2,2,4,5,5,7,3,12,5,3,3,10,5,7,
+  8,11,9,7,4,4,7,7,7,8,5,11,6,7,6,8,4,3,6,3,3,3,3,3,
+  3,3,3,4,3,3,3,3,3,3,4,3,7,3,3,3,3,3,3,4,3,6,4,4,
+  4,4,4,3,2,4,3,3,3,4,4,3,4,4,5,5,3,3,9,2,2,2,2,3,
+  6,5,3,2,5,3,3,2,3,3,2,5,9,7,8,6,6,5,6,5,4,11,6,13,
+  4,6,4,5,3,4,4,7,5,7,5,5,3,3,4,5,5,5,5,6,5,4,5,9,
+  5,9,7,3,4,6,5,5,7,4,4,7,5,3,6,5,4,5,6,3,4,4,5,6,
+  7,11,10,11,3,4,6,6,6,5,8,5,5,4,5,6,3,3,3,3,7,3,4,2,
+  3,4,3,3,3,3,3,3,5,3,4,3,6,3,2,4,2,8,10,4,3,7,13,6,
+  7,4,7,7,13,8,5,7,5,2,2,7,8,2,3,3,3,3,3,3,3,3,3,3,
+  3,3,8,4,6,4,8,5,9,3,4,4,6,6,11,12,5,3,4,4,10,10,10,11,
+  13,13,3,3,3,13,15,13,11,10,10,12,7,11,17,12,12,10,11,10,11,10,10,11,
+  8,9,6,5,5,5,3,3,5,5,10,9,5,8,10,7,4,5,6,4,9,4,10,4,
+  11,7,7,6,11,4,9,6,9,4,6,5,2,3,4,3,4,4,8,9,9,8,2,6,
+  4,6,2,8,11,4,5,7,6,11,7,8,4,11,12,6,4,3,12,5,5,2,2,7,
+  10,8,3,3,4,3,3,4,4,5,4,3,3,3,3,2,3,8,2,8,7,6,4,8,
+  5,5,6,8,10,10,12,9,13,7,8,2,3,7,4,4,2,3,2,2,2,5,6,7,
+  3,3,3,4,9,7,3,8,3,4,9,8,5,8,8,6,7,5,7,7,8,7,7,7,
+  7,9,7,10,11,5,8,9,2,2,4,6,8,6,9,11,6,5,5,3,3,11,4,4,
+  6,4,4,7,6,6,13,6,7,7,10,5,9,8,7,8,7,9,8,5,4,4,10,3,
+  5,6,9,7,5,8,11,4,5,4,4,5,7,3,5,9,8,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,6,7,6,5,8,8,4,4,8,8,6,
+  4,7,6,5,11,8,6,3,5,6,11,3,10,5,4,4,4,4,3,4,8,9,4,6,
+  14,10,3,3,3,3,5,6,7,5,5,4,5,5,5,6,6,6,4,3,6,7,5,4,
+  5,4,5,4,7,5,4,4,5,6,8,3,5,4,7,6,4,4,4,8,11,3,3,6,
+  4,3,3,6,6,6,4,3,4,3,5,3,3,4,5,4,4,4,5,5,4,3,4,5,
+  4,6,3,3,3,5,3,4,3,4,4,3,3,4,2,4,4,7,6,3,3,3,3,4,
+  5,4,3,3,8,6,8,8,7,7,4,4,6,6,11,6,7,8,9,6,13,12,11,6,
+  7,4,5,3,7,13,7,10,5,9,7,9,5,7,4,8,9,2,3,3,3,2,7,3,
+  8,4,5,4,5,8,10,6,9,13,3,8,9,11,13,10,4,11,5,6,8,10,4,7,
+  6,10,6,4,8,7,4,8,6,7,7,6,9,8,6,9,6,7,10,8,7,6,5,11,
+  4,9,3,3,10,4,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,3,3,4,
+  3,4,4,4,3,4,4,4,3,3,4,3,4,3,4,3,4,3,4,3,3,3,4,3,
+  4,4,4,3,3,6,3,3,4,3,4,4,5,4,5,4,5,3,2,3,3,4,3,4,
+  4,4,3,4,4,3,3,3,4,3,4,3,6,9,4,4,3,3,3,4,10,5,4,3,
+  4,5,3,4,4,4,4,3,2,2,2,3,3,3,3,3,3,2,2,6,2,2,5,5,
+  8,14,10,9,4,4,5,5,5,8,7,7,5,9,8,9,4,4,6,4,5,10,3,4,
+  4,6,6,5,2,2,8,7,5,4,10,8,7,6,6,9,9,7,10,4,3,5,6,9,
+  5,6,8,4,8,5,3,3,4,5,8,5,3,3,3,6,4,8,5,9,4,7,5,8,
+  5,6,6,5,8,4,4,4,3,5,3,5,3,4,4,3,4,2,2,3,5,3,4,3,
+  5,3,7,7,7,4,3,3,3,3,7,4,4,5,5,2,4,3,3,5,7,9,7,5,
+  22,4,4,4,4,5,10,3,4,3,3,3,8,4,4,4,4,6,4,8,5,4,10,8,
+  4,4,3,6,7,6,5,4,3,10,7,7,6,3,12,8,5,6,7,7,4,15,5,4,
+  6,5,5,4,5,7,2,6,8,3,5,6,3,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,8,11,9,3,6,6,
+  6,6,4,5,5,5,4,3,3,3,3,4,3,3,3,4,3,3,3,4,3,3,3,3,
+  3,4,3,4,4,4,4,3,4,3,4,4,3,2,3,3,3,3,3,3,6,8,7,7,
+  14,7,11,6,6,8,7,5,6,4,6,4,9,6,8,8,3,6,6,4,10,13,5,6,
+  7,8,3,7,7,10,5,5,8,4,10,8,9,9,9,9,9,9,9,8,9,9,8,8,
+  9,9,9,9,9,8,8,4,5,5,5,9,4,6,12,13,18,12,12,13,13,11,12,13,
+  17,13,19,13,11,17,12,10,10,10,10,12,10,10,12,13,12,12,11,13,13,17,13,16,
+  17,16,13,5,5,4,5,6,4,5,6,5,8,7,3,4,9,10,7,7,12,9,6,4,
+  7,5,5,3,5,3,4,4,4,4,4,4,4,9,9,10,13,6,5,8,4,7,7,10,
+  10,4,6,7,7,7,7,7,7,5,9,7,11,5,5,14,5,11,10,12,4,7,7,8,
+  13,8,8,5,8,3,5,9,5,7,5,4,4,4,5,3,3,5,4,5,5,5,5,5,
+  6,7,5,3,5,6,4,2,4,7,8,8,7,8,8,3,4,4,8,9,3,5,6,9,
+  3,2,5,2,8,8,7,8,2,4,10,4,2,8,10,7,2,5,2,2,2,6,4,5,
+  2,6,2,10,10,7,8,8,7,10,10,9,8,3,3,6,6,6,3,5,4,4,4,3,
+  5,13,8,24,9,10,10,2,2,5,5,4,5,10,4,2,2,4,3,4,4,3,3,4,
+  4,3,4,3,3,4,4,3,3,3,4,5,3,3,3,4,3,3,3,3,4,3,4,4,
+  10,7,3,10,7,6,5,5,5,6,7,5,7,4,10,4,6,4,6,7,4,9,9,9,
+  5,4,9,4,9,9,4,13,9,6,12,9,12,8,14,5,3,13,8,6,2,7,3,3,
+  3,2,9,6,7,8,3,11,8,2,6,3,3,2,2,3,2,3,3,10,3,3,3,3,
+  3,8,3,3,3,3,3,3,4,4,19,7,6,3,5,4,4,4,5,3,3,3,4,4,
+  4,3,4,5,11,10,7,4,4,5,10,4,3,7,9,6,9,11,6,7,6,5,13,7,
+  2,8,10,9,7,6,7,4,2,3,3,10,7,5,8,9,6,3,3,8,6,10,5,9,
+  7,6,7,12,4,5,10,10,10,10,10,4,5,8,6,8,4,4,3,13,8,15,7,7,
+  7,7,8,7,7,10,10,12,8,9,3,7,7,12,5,5,9,8,6,5,2,2,10,14,
+  14,14,7,5,8,3,7,3,3,3,7,11,6,6,12,10,5,10,5,5,5,5,6,7,
+  5,8,4,5,6,3,4,4,5,11,5,11,3,2,2,3,3,4,5,5,5,6,11,5,
+  10,4,3,8,5,4,4,4,5,5,4,4,6,4,3,4,4,3,4,5,4,5,3,4,
+  4,3,7,3,5,4,5,3,3,3,6,7,3,4,3,8,4,6,8,12,3,12,11,12,
+  5,10,7,3,3,6,7,4,4,4,4,4,3,8,6,5,6,7,8,7,4,3,4,2,
+  3,3,4,3,4,4,3,3,4,4,4,4,4,3,3,3,3,3,4,4,4,4,3,3,
+  4,4,4,3,3,3,3,3,3,3,5,15,7,12,4,11,9,8,6,6,10,6,5,5,
+  9,21,9,19,6,9,9,7,8,7,3,6,8,7,9,7,6,7,7,8,6,5,8,12,
+  5,6,8,4,7,5,7,5,7,10,7,11,4,7,7,5,7,7,4,5,7,8,8,8,
+  10,10,10,10,9,8,10,7,5,11,4,9,9,11,11,5,12,6,8,11,6,12,5,4,
+  12,7,9,10,9,9,9,6,6,12,7,4,6,7,9,11,6,8,3,8,5,5,9,9,
+  9,7,9,7,14,7,12,9,8,7,5,5,5,5,5,5,5,5,5,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,
+  5,4,4,5,4,5,4,5,4,4,5,5,5,4,5,5,4,4,5,5,5,4,4,4,
+  5,5,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,4,
+  4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,5,5,4,4,4,4,4,5,4,4,5,4,4,4,4,4,4,5,4,5,4,4,4,
+  4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  5,4,4,4,4,4,5,4,4,4,4,4,5,4,4,4,5,5,5,5,5,5,5,5,
+  5,5,5,4,4,4,4,4,4,4,4,4,4,5,4,4,5,4,4,4,5,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,5,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,10,5,8,
+  9,4,3,6,6,5,7,10,5,8,8,12,5,4,5,7,10,10,7,9,5,4,4,9,
+  9,9,15,8,4,7,6,3,5,5,7,7,8,9,6,9,7,5,11,8,10,9,9,10,
+  7,9,10,6,7,6,6,6,8,5,7,4,11,9,6,5,12,9,7,6,7,6,8,12,
+  3,5,5,6,7,7,4,9,8,8,5,16,11,5,6,7,5,9,8,10,7,12,8,4,
+  9,7,4,8,9,6,3,3,4,4,3,4,4,3,3,7,5,5,8,9,11,5,7,5,
+  8,9,7,4,6,6,7,4,4,9,5,4,4,4,6,5,4,4,5,4,4,5,5,4,
+  5,5,5,4,4,5,4,4,4,4,4,3,8,5,5,7,5,4,4,6,5,7,9,6,
+  6,5,4,5,3,12,9,4,3,10,4,4,5,6,5,7,10,8,8,6,7,5,4,12,
+  6,7,7,10,12,6,10,4,6,4,7,10,4,6,7,6,3,3,7,6,6,10,4,4,
+  6,3,9,5,7,4,8,11,3,6,6,7,5,3,6,8,5,6,7,6,7,5,4,6,
+  6,8,4,5,7,4,6,5,6,7,5,6,7,7,4,9,4,4,9,4,5,4,6,4,
+  5,4,6,7,6,7,10,6,3,7,12,6,8,6,5,8,6,4,7,8,9,5,5,6,
+  4,7,7,5,6,5,6,3,7,5,4,4,5,4,8,3,4,7,5,7,6,5,5,7,
+  7,3,7,8,4,8,3,4,6,9,10,5,5,4,4,3,5,6,4,4,7,7,4,6,
+  5,5,3,6,6,7,4,5,4,8,5,6,6,7,5,8,7,6,5,6,4,7,5,5,
+  5,6,6,4,4,6,3,4,4,3,6,6,4,5,4,4,5,7,4,3,6,4,4,5,
+  7,4,5,5,4,5,5,4,3,6,4,5,5,3,8,5,4,4,8,7,7,10,5,7,
+  7,8,6,5,5,4,5,6,5,4,5,6,4,7,4,4,6,4,4,5,4,4,4,3,
+  3,6,7,5,4,4,3,3,4,4,5,5,3,4,5,6,4,4,4,8,5,4,3,4,
+  6,5,6,8,6,10,4,8,7,4,4,4,4,3,5,4,10,5,5,5,10,5,5,7,
+  7,7,3,7,4,5,6,5,8,8,7,6,6,9,9,8,5,7,6,9,10,11,12,13,
+  13,12,13,12,11,12,13,12,11,12,11,10,11,12,13,12,12,11,10,11,12,11,10,11,
+  10,9,10,11,12,13,12,11,12,11,10,11,12,10,11,10,9,10,11,12,11,10,11,10,
+  9,10,11,10,9,10,9,8,11,4,4,5,4,3,4,2,2,2,3,4,3,2,7,4,
+  7,7,7,6,5,3,4,11,6,7,8,9,10,11,12,13,12,11,12,11,10,11,12,11,
+  10,11,10,9,10,11,12,11,10,11,10,9,10,11,10,9,10,9,8,9,10,11,12,11,
+  10,11,10,9,10,11,10,9,10,9,8,9,10,11,10,9,10,9,8,9,10,9,8,9,
+  8,7,8,9,10,11,12,11,10,11,10,9,10,11,10,9,10,9,8,9,10,11,10,9,
+  10,9,8,9,10,9,8,9,8,7,8,9,10,11,10,9,10,9,8,9,10,9,8,9,
+  8,7,8,9,10,9,8,9,8,7,8,9,8,7,8,7,6,7,8,9,10,11,12,11,
+  10,11,10,9,10,11,10,9,10,9,8,9,10,11,10,9,10,9,8,9,10,9,8,9,
+  8,7,8,9,10,11,10,9,10,9,8,9,10,9,8,9,8,7,8,9,10,9,8,9,
+  8,7,8,9,8,7,8,7,6,7,8,9,10,11,10,9,10,9,8,9,10,9,8,9,
+  8,7,8,9,10,9,8,9,8,7,8,9,8,7,8,7,6,7,8,9,10,9,8,9,
+  8,7,8,9,8,7,8,7,6,7,8,9,8,7,8,7,6,7,8,7,6,7,6,5,
+  14,5,4,9,6,8,9,5,3,6,3,4,7,8,7,4,5,6,9,8,9,4,6,12,
+  15,10,9,8,5,7,8,6,6,5,6,7,6,5,9,8,2,10,7,7,9,8,11,6,
+  5,8,5,10,9,4,6,6,8,14,7,12,7,10,8,9,10,6,6,9,8,8,9,15,
+  15,8,7,4,7,8,5,5,7,10,9,6,5,6,6,6,8,7,7,15,15,19,15,6,
+  7,5,8,8,12,4,7,7,5,9,8,3,4,7,5,7,4,9,6,14,18,16,14,7,
+  5,5,7,6,6,4,3,5,7,7,10,4,3,4,3,3,3,4,3,3,3,3,4,3,
+  3,3,3,4,4,3,3,4,3,3,3,3,4,3,4,5,4,4,4,4,5,4,4,4,
+  3,3,4,3,2,4,3,4,4,3,4,4,3,4,2,3,10,2,4,3,4,3,4,4,
+  4,4,5,5,4,5,3,5,4,4,4,2,3,4,5,4,5,4,5,3,7,4,3,3,
+  4,4,3,4,4,3,4,3,4,4,3,4,5,3,3,3,3,3,3,3,4,3,4,3,
+  5,5,3,5,5,3,3,3,3,5,4,5,4,5,4,3,3,6,6,5,6,5,9,9,
+  7,8,4,4,4,2,2,2,2,3,3,3,3,2,2,3,3,3,3,4,4,4,8,4,
+  8,6,3,8,3,3,4,4,4,4,4,5,3,5,4,4,3,3,4,4,3,3,4,4,
+  3,4,4,3,4,4,4,4,4,4,4,4,7,4,6,5,6,4,4,4,4,4,7,4,
+  3,4,4,4,3,3,8,9,6,5,9,8,6,8,7,8,8,6,9,10,6,6,12,21,
+  6,9,9,4,7,9,4,12,8,8,6,8,6,5,2,11,6,4,5,8,3,4,4,3,
+  3,3,4,3,4,4,5,2,2,2,2,2,3,3,2,4,3,2,2,2,9,7,8,9,
+  5,4,7,9,12,13,11,11,11,10,12,10,10,12,13,10,7,5,9,8,7,6,4,9,
+  17,12,7,12,5,14,8,5,8,14,8,17,12,12,12,12,11,7,8,8,3,5,7,10,
+  11,8,10,8,9,7,5,11,6,10,5,11,6,7,5,13,8,7,8,5,7,11,5,11,
+  11,6,4,9,9,9,8,5,6,6,8,7,8,4,5,6,9,9,7,7,5,4,5,5,
+  9,4,3,4,5,5,4,5,4,4,3,5,4,7,5,3,4,4,4,4,5,3,4,6,
+  4,5,3,5,5,6,4,4,3,4,4,4,4,4,5,4,3,6,6,7,7,7,7,7,
+  7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+  7,7,7,7,7,7,7,7,7,3,6,3,6,6,3,5,3,4,5,4,3,6,5,5,
+  4,6,8,6,6,3,4,6,4,3,4,5,3,3,4,7,4,6,4,5,3,3,4,3,
+  3,3,5,3,5,7,6,7,8,5,7,7,7,12,5,5,5,5,5,5,5,5,5,5,
+  5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+  5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+  5,5,5,5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+  5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,11,11,12,9,6,5,4,
+  9,8,7,10,8,10,8,6,4,7,8,8,5,6,6,6,6,6,6,6,10,8,9,6,
+  8,13,9,5,7,6,7,4,3,5,4,8,5,5,7,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,14,14,14,14,14,14,14,14,
+  14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+  14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,6,14,7,12,8,8,9,
+  8,4,10,4,8,3,2,3,2,2,3,7,5,3,6,5,7,3,8,14,13,9,7,5,
+  5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,5,5,5,5,5,5,5,
+  5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,4,5,5,5,
+  4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,5,4,4,4,4,5,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,
+  4,5,4,4,5,4,4,5,5,5,5,5,5,5,5,5,4,4,5,4,4,5,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,4,4,4,4,4,
+  4,4,4,5,4,5,4,4,4,4,4,4,4,5,4,5,4,4,4,5,4,4,4,4,
+  4,4,4,4,5,4,4,4,4,4,4,5,4,4,4,4,5,4,4,4,4,4,4,4,
+  4,4,4,4,4,5,4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,
+  4,5,4,4,4,4,4,4,5,4,5,4,4,4,4,4,4,4,5,4,5,4,5,4,
+  4,4,4,5,5,5,4,4,4,4,4,4,4,4,5,4,5,5,4,4,4,4,5,4,
+  4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,
+  4,4,5,4,5,4,4,4,4,4,4,5,4,4,5,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,5,4,4,4,4,4,4,4,5,4,4,4,4,5,4,5,4,5,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,5,4,4,5,5,
+  5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,4,4,4,4,4,4,4,5,
+  4,4,4,4,4,4,4,4,5,4,5,4,5,4,4,5,4,4,4,4,4,5,5,5,
+  5,5,6,5,5,5,5,5,5,5,5,5,5,5,5,6,5,5,5,5,5,5,5,5,
+  5,5,5,5,5,6,5,6,5,5,5,5,5,5,5,6,5,5,5,5,6,4,5,4,
+  4,4,4,5,4,5,5,5,5,5,5,4,4,4,4,5,5,5,4,4,4,4,4,4,
+  4,4,4,5,4,5,4,4,4,4,5,4,5,4,4,4,4,5,4,5,4,4,4,5,
+  4,4,4,5,5,5,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,4,
+  4,5,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,
+  5,5,4,4,4,4,4,4,4,5,4,4,4,4,4,4,5,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,5,4,4,4,4,5,4,4,4,4,4,4,4,4,5,5,
+  4,4,4,5,4,4,4,4,4,4,4,4,4,5,5,4,4,4,4,4,4,4,4,4,
+  5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,5,4,5,4,
+  5,4,4,5,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,5,4,5,4,4,4,4,4,4,4,4,4,5,5,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,5,4,4,4,5,4,4,4,
+  4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,4,5,4,4,4,4,4,
+  5,5,4,4,4,4,5,5,5,4,5,5,4,4,4,4,4,4,4,4,5,5,5,5,
+  5,5,5,5,5,5,5,5,4,4,4,5,4,4,4,4,4,5,4,5,4,5,4,5,
+  4,4,5,4,4,4,4,5,4,4,4,5,4,4,4,5,4,4,4,4,4,4,5,4,
+  5,4,4,4,4,5,4,4,4,5,4,5,4,4,4,4,4,4,5,4,4,4,4,4,
+  5,5,4,4,5,4,4,5,4,5,4,4,4,4,4,4,4,4,4,5,5,5,5,4,
+  5,5,4,5,4,5,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,
+  5,4,5,5,5,5,5,5,5,5,5,6,3,4,4,5,10,8,3,10,4,8,5,10,
+  5,11,9,9,7,4,4,3,3,3,4,3,4,4,5,5,5,6,5,6,5,5,5,4,
+  4,4,3,3,3,4,4,3,4,4,5,4,4,4,4,3,3,4,3,3,4,4,4,5,
+  4,5,4,3,4,3,4,3,4,3,3,3,3,4,3,3,3,4,5,4,4,5,4,5,
+  4,4,4,3,3,3,4,3,4,3,3,3,4,5,4,5,4,4,3,3,3,3,3,3,
+  3,4,4,4,4,3,4,3,3,3,4,3,4,3,3,3,4,5,4,5,4,3,3,4,
+  3,4,3,4,3,3,3,3,3,4,3,4,4,3,4,3,4,3,3,3,4,4,3,4,
+  4,5,4,3,4,3,4,3,3,4,3,3,3,3,3,3,2,3,4,3,4,3,4,4,
+  3,3,3,3,4,4,3,3,4,4,6,5,11,5,5,5,4,5,9,5,13,9,6,14,
+  16,10,7,9,9,9,4,8,6,12,4,7,7,7,4,7,8,7,8,6,9,7,5,7,
+  6,7,6,6,5,7,6,9,6,12,11,8,8,9,6,7,7,6,8,8,12,6,6,5,
+  7,6,3,5,6,10,6,5,7,7,11,6,11,5,8,5,5,5,12,4,4,11,7,3,
+  4,6,7,3,3,6,5,9,6,5,4,7,4,5,4,6,5,9,6,7,4,7,6,7,
+  4,6,7,4,3,5,4,4,5,4,3,5,5,5,6,5,8,8,5,5,5,6,4,5,
+  10,6,9,8,7,7,8,9,6,8,6,6,6,9,9,9,9,9,9,9,9,9,9,9,
+  9,9,9,9,9,9,9,7,5,8,4,6,8,6,8,9,9,9,9,9,9,8,8,8,
+  6,5,9,7,7,9,5,6,9,5,5,3,4,5,6,5,3,5,7,5,9,6,5,7,
+  7,8,9,18,16,15,21,20,13,15,15,13,12,18,17,11,10,13,11,11,11,13,13,11,
+  11,10,13,12,13,12,11,13,13,11,16,16,18,15,11,16,17,10,12,12,17,14,16,15,
+  12,16,12,11,16,11,11,11,11,13,17,14,12,14,12,12,12,18,13,11,11,11,16,11,
+  16,15,13,11,13,21,13,12,15,11,11,19,18,17,18,16,17,19,18,15,18,23,14,18,
+  12,10,18,16,16,17,14,18,14,14,14,4,3,3,7,7,8,7,7,5,4,4,4,4,
+  5,5,4,4,3,7,4,3,3,5,3,4,6,5,4,5,4,4,3,4,3,5,3,4,
+  5,4,5,10,3,4,7,5,3,4,5,4,4,5,5,6,4,4,5,5,4,6,4,5,
+  4,5,4,4,6,6,5,8,6,4,5,5,8,11,9,9,12,15,12,16,5,6,5,4,
+  7,6,4,8,6,5,3,6,5,5,6,5,10,6,6,5,6,5,4,5,5,5,5,6,
+  5,13,6,5,6,5,5,5,7,5,5,8,10,13,5,4,3,3,3,4,3,3,3,3,
+  3,4,5,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,3,3,3,3,4,5,5,4,4,4,4,
+  4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,9,9,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  5,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,3,3,3,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,5,4,4,4,4,5,3,3,3,3,3,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,9,9,6,9,5,8,6,12,6,8,13,11,11,10,9,10,8,
+  10,10,9,5,9,10,7,11,10,8,7,7,10,9,5,10,7,4,8,8,8,6,6,5,
+  8,6,9,8,4,8,7,8,5,8,7,11,6,5,6,12,4,8,4,5,5,8,10,6,
+  6,6,6,8,7,7,4,6,7,6,6,3,6,12,10,3,4,7,8,5,6,10,12,11,
+  12,10,8,8,7,4,4,5,8,7,9,3,5,8,10,9,9,6,6,5,7,6,4,7,
+  7,11,10,11,7,7,14,6,10,4,8,5,7,4,7,5,5,5,9,6,5,6,5,7,
+  5,7,7,11,4,5,9,7,5,4,6,6,6,5,5,6,6,8,8,4,7,5,11,8,
+  5,6,4,6,7,4,4,5,7,6,6,11,10,7,4,5,8,6,5,7,4,6,4,6,
+  4,4,4,4,6,6,8,7,7,6,4,7,8,5,4,3,11,7,5,8,4,5,6,5,
+  8,6,3,6,7,6,4,5,4,6,5,3,8,5,6,4,3,3,3,3,4,3,3,5,
+  8,13,6,10,10,6,6,4,5,7,4,7,11,7,6,7,5,6,6,11,7,6,13,3,
+  10,9,6,4,9,8,4,5,6,3,5,8,6,4,8,9,6,4,8,9,11,9,7,14,
+  3,5,3,6,3,8,3,2,5,11,7,8,13,2,3,3,2,5,6,11,9,13,5,3,
+  7,7,3,3,3,3,6,3,6,5,4,4,9,9,4,13,7,9,9,5,8,5,5,5,
+  5,5,5,5,4,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,6,2,6,
+  2,6,2,6,2,4,4,4,4,4,3,4,2,4,2,4,4,4,4,4,4,4,4,4,
+  4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,5,6,6,5,
+  6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+  5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+  5,5,5,5,6,6,5,5,5,5,5,4,4,4,4,5,5,4,5,8,5,5,5,8,
+  5,7,5,3,5,5,5,4,4,4,6,4,4,5,4,7,4,4,4,4,6,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,7,4,6,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,9,4,4,4,4,4,5,4,
+  4,4,7,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,6,4,5,4,4,4,5,4,5,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,3,4,4,4,4,3,4,4,4,4,4,4,4,4,2,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,3,4,4,3,4,4,3,4,4,4,4,
+  4,4,4,4,3,4,4,4,4,4,4,4,3,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,6,10,4,8,3,3,5,8,6,5,7,3,8,6,6,9,6,10,4,5,
+  2,5,4,5,4,6,6,13,6,4,6,6,6,5,10,3,4,7,7,7,8,10,6,3,
+  3,5,11,4,3,3,8,5,3,7,12,5,5,7,6,5,6,5,5,7,4,4,6,4,
+  11,6,10,5,8,7,7,7,5,9,4,4,8,4,5,6,4,8,8,5,4,4,4,3,
+  4,3,3,4,4,4,3,4,3,3,4,7,4,4,6,4,5,7,4,5,3,3,4,4,
+  4,4,4,4,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,3,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,
+  4,4,4,4,4,4,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,3,4,4,4,4,4,4,
+  4,4,4,5,4,4,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+  3,4,4,3,4,3,7,8,4,7,3,3,4,4,6,9,5,3,4,5,4,4,4,3,
+  4,3,3,3,5,4,3,3,4,4,5,4,3,4,4,3,3,2,3,4,3,3,3,2,
+  3,5,7,10,5,4,7,8,8,13,4,3,6,6,10,11,4,6,11,6,5,11,7,6,
+  3,3,3,6,8,8,10,7,8,6,8,9,8,5,4,8,4,5,5,3,3,3,5,3,
+  4,8,5,5,5,7,8,6,4,15,12,4,6,6,6,6,6,8,5,7,16,3,5,4,
+  9,12,13,8,6,6,9,5,4,11,6,6,6,9,5,9,11,11,10,5,6,5,5,11,
+  8,8,9,9,8,8,8,8,8,8,8,8,3,10,5,7,8,8,8,11,8,10,4,6,
+  12,12,10,9,2,8,5,4,11,4,4,2,2,4,3,8,14,9,8,8,5,4,9,4,
+  5,5,4,4,9,5,6,7,4,6,4,7,6,6,4,3,9,6,4,5,5,10,6,10,
+  10,10,6,5,8,6,11,6,7,7,12,11,10,6,8,18,10,6,5,3,3,3,4,3,
+  3,4,4,3,4,6,12,5,6,6,6,6,6,6,6,6,8,6,6,8,9,7,4,4,
+  5,5,4,4,7,7,11,5,4,4,7,4,4,7,4,5,4,4,6,5,4,8,4,7,
+  3,3,3,3,3,3,2,3,7,10,8,5,3,3,3,4,4,4,4,5,5,5,3,4,
+  3,5,4,3,7,5,4,3,4,3,4,10,12,12,4,7,9,11,12,16,11,6,7,5,
+  5,4,5,3,3,3,3,4,3,4,10,9,8,5,6,6,13,9,6,9,8,4,4,4,
+  4,5,5,8,6,10,3,6,7,5,6,3,3,4,4,3,4,3,4,4,4,4,6,4,
+  3,3,5,4,3,4,4,4,3,3,3,5,4,4,5,5,5,4,3,3,3,3,3,3,
+  4,4,4,3,8,9,5,4,6,4,3,4,3,3,4,4,4,4,3,4,5,3,4,4,
+  11,6,4,4,3,4,4,5,4,5,4,4,4,4,5,3,4,3,4,4,4,4,4,4,
+  4,3,4,4,3,4,4,3,4,4,3,3,3,4,4,3,4,4,3,3,3,3,6,5,
+  8,5,9,9,11,8,9,5,6,11,18,6,6,9,24,22,8,6,5,7,7,4,7,7,
+  10,9,11,6,6,8,5,9,6,4,11,5,6,9,11,6,5,9,9,10,7,5,7,6,
+  4,6,8,6,4,4,8,7,7,6,5,8,8,5,5,4,3,4,4,4,4,4,3,6,
+  6,4,4,6,7,8,4,9,6,6,7,8,7,10,5,4,7,8,8,8,8,8,8,8,
+  8,8,8,7,8,8,7,7,7,7,7,7,7,7,10,6,10,4,7,6,10,7,8,6,
+  8,7,7,6,5,5,7,7,6,5,6,5,12,4,7,7,8,6,8,7,4,10,10,8,
+  12,10,6,7,11,7,8,5,3,10,10,8,7,10,11,7,2,2,5,5,7,12,7,8,
+  7,9,6,6,6,4,9,10,4,8,7,7,8,10,4,7,5,12,10,9,4,6,6,7,
+  7,5,4,9,7,8,9,8,7,9,5,4,9,8,10,7,7,5,7,4,3,4,8,7,
+  5,5,12,6,8,5,5,5,8,5,7,4,5,3,7,5,4,8,8,8,5,4,4,4,
+  4,3,5,6,12,6,3,4,3,4,3,5,4,5,6,4,4,14,18,16,15,14,6,6,
+  3,4,6,7,5,6,6,5,4,13,18,17,15,15,14,14,14,13,5,15,6,4,8,5,
+  5,3,4,5,8,6,5,4,8,6,8,8,9,9,4,11,8,4,6,8,4,5,5,5,
+  3,7,4,7,7,9,6,5,6,7,6,3,7,10,8,4,4,5,8,6,5,8,9,6,
+  5,7,8,8,11,6,7,4,6,5,11,8,6,11,9,7,7,14,6,6,7,7,8,12,
+  4,5,5,5,6,3,3,3,5,3,3,4,3,5,4,2,5,4,4,4,3,4,4,4,
+  4,4,5,3,3,3,3,6,6,7,9,8,4,7,9,10,10,6,5,7,12,8,9,4,
+  4,7,6,6,6,5,5,4,7,10,4,8,8,10,6,7,7,4,3,11,8,8,8,8,
+  8,8,8,7,5,6,5,6,5,19,18,8,7,11,11,11,11,11,11,11,10,10,10,9,
+  5,5,4,7,5,7,5,3,16,8,7,6,9,5,4,7,8,7,7,4,7,6,7,6,
+  7,7,7,9,8,9,8,6,7,7,7,6,7,8,11,7,6,7,7,10,9,10,9,5,
+  4,10,10,5,5,8,4,13,6,6,3,5,5,4,5,4,4,8,5,8,6,11,6,5,
+  8,17,4,9,4,3,3,3,3,3,3,4,4,3,3,9,9,8,9,13,8,9,8,3,
+  9,6,5,6,8,4,5,6,6,7,5,4,6,2,8,3,11,5,4,2,2,4,5,6,
+  5,5,6,7,3,8,2,5,5,2,3,4,5,7,3,6,9,2,5,9,6,4,4,5,
+  3,8,6,5,6,4,5,7,7,2,4,5,3,4,10,11,9,2,5,6,2,7,9,2,
+  6,2,2,3,2,5,7,5,7,6,7,7,2,3,7,3,4,9,2,3,2,4,2,2,
+  5,2,2,4,4,4,8,5,2,5,6,5,2,2,9,4,6,2,6,5,3,2,2,2,
+  2,4,8,4,7,5,7,7,8,5,5,7,2,3,3,3,5,2,9,7,10,5,5,4,
+  14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+  14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,2,4,2,3,6,2,4,8,
+  3,2,3,3,3,3,2,5,7,11,6,8,5,7,6,7,8,12,11,4,9,12,10,8,
+  6,7,5,9,8,7,3,3,8,7,5,7,9,9,8,7,10,10,8,8,7,9,9,6,
+  9,12,6,5,4,7,5,3,6,8,9,8,4,7,5,7,7,11,4,11,8,9,7,11,
+  7,10,9,6,11,6,7,6,4,5,9,8,5,7,5,7,6,4,4,4,3,5,6,4,
+  3,4,7,4,9,5,5,4,5,7,10,5,5,9,4,3,4,3,7,6,5,11,5,9,
+  6,6,11,11,27,13,4,9,6,5,6,5,9,9,11,3,6,5,8,7,10,8,4,5,
+  8,3,8,9,3,3,3,2,4,2,2,2,2,2,2,3,3,3,3,4,4,4,4,3,
+  3,2,2,2,2,2,2,2,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+  13,13,13,13,13,13,13,13,9,6,6,6,8,15,5,5,8,9,10,4,5,5,4,4,
+  12,7,11,6,7,10,9,6,9,7,10,9,10,11,12,13,10,12,12,7,10,5,6,4,
+  13,10,9,11,10,7,6,9,8,5,9,11,8,7,9,5,6,7,5,5,7,11,6,7,
+  9,10,6,9,7,8,5,8,5,8,7,12,9,7,7,9,9,7,4,5,9,6,8,6,
+  5,5,6,9,8,5,5,9,5,5,8,5,6,5,9,6,8,6,5,5,8,9,7,9,
+  7,10,6,4,5,5,4,5,3,7,6,4,5,5,7,6,11,5,8,8,3,9,8,3,
+  8,9,7,4,5,7,3,8,7,3,4,4,11,10,7,6,5,5,3,4,8,4,4,5,
+  6,9,13,8,11,9,9,14,12,13,8,12,12,6,5,6,4,4,5,4,4,4,5,4,
+  4,4,5,5,5,5,9,13,7,5,4,6,3,4,6,5,8,5,3,3,4,3,4,4,
+  5,4,6,7,4,10,4,3,4,4,3,4,5,4,3,3,5,4,5,3,4,3,4,4,
+  4,4,3,3,4,3,13,10,5,5,5,6,5,5,6,7,10,14,14,14,14,14,14,6,
+  9,7,5,10,11,6,5,10,6,4,7,6,5,7,6,7,7,9,7,5,6,4,4,5,
+  4,4,5,5,6,5,8,11,4,7,6,9,11,4,3,4,3,4,4,4,5,4,4,5,
+  4,3,4,3,3,4,4,3,3,4,4,4,5,4,4,5,4,4,4,3,3,4,3,3,
+  4,3,4,4,4,5,5,4,5,4,4,4,7,10,11,12,12,12,12,12,12,12,12,12,
+  12,11,12,12,12,12,12,12,12,12,12,12,11,12,12,12,12,12,12,12,12,12,12,11,
+  12,12,12,12,12,12,12,12,12,12,11,12,12,12,12,12,12,12,12,12,12,11,12,12,
+  12,12,12,12,12,12,12,12,11,12,12,12,12,12,12,12,12,12,12,11,12,12,12,12,
+  12,12,12,12,12,12,11,12,12,12,12,12,12,12,12,12,12,11,12,12,12,12,12,12,
+  12,12,12,12,10,11,12,12,12,12,12,12,12,12,12,12,11,12,12,12,12,12,12,12,
+  12,12,12,11,12,12,12,12,12,12,12,12,12,12,11,12,12,12,12,12,12,12,12,12,
+  12,11,12,12,12,12,12,12,12,12,12,12,11,12,12,12,12,12,12,12,11,11,11,11,
+  10,11,11,11,11,11,11,11,11,11,11,10,11,11,11,11,11,11,11,11,11,11,10,11,
+  11,11,11,11,11,11,11,11,11,10,11,11,11,11,11,11,11,11,11,11,10,11,11,11,
+  11,11,11,11,11,11,11,10,11,11,11,11,11,11,11,11,11,11,10,11,11,11,11,11,
+  11,11,11,11,11,6,12,8,5,8,8,9,6,6,12,8,7,8,5,10,9,8,5,9,
+  4,13,4,8,6,5,6,7,10,6,8,5,7,6,4,4,3,3,4,5,5,7,11,7,
+  6,4,10,7,6,6,6,6,9,9,15,6,5,5,4,5,5,6,5,4,7,7,7,6,
+  9,5,3,7,5,4,4,3,4,5,3,3,4,4,4,4,4,4,5,5,5,4,4,4,
+  4,4,4,4,5,5,4,4,5,4,3,4,4,4,3,3,3,4,4,4,3,3,3,3,
+  3,4,4,3,4,3,3,3,4,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,
+  5,5,4,4,5,4,3,4,4,5,4,4,3,4,4,4,3,3,3,3,3,3,4,3,
+  4,3,3,4,3,3,4,4,4,4,4,4,5,5,4,4,4,4,4,4,4,5,5,4,
+  5,4,4,3,3,4,4,3,3,3,3,3,3,4,3,3,4,3,3,3,3,3,3,3,
+  3,3,4,3,3,2,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,4,4,
+  4,4,5,5,5,4,4,5,4,4,3,4,4,4,3,3,3,3,3,3,4,4,4,3,
+  4,3,3,3,3,3,3,4,4,4,4,3,4,4,4,5,5,4,4,4,3,4,4,3,
+  4,5,5,4,4,5,4,4,3,4,4,5,4,4,3,4,4,4,3,4,5,5,4,4,
+  4,4,4,4,3,4,5,5,4,4,5,4,4,3,4,4,5,4,4,4,4,3,4,4,
+  3,4,5,5,5,4,4,4,4,4,4,4,5,4,3,3,3,4,4,4,3,4,4,4,
+  3,4,4,3,4,5,5,5,4,4,3,4,4,5,5,5,3,3,3,2,3,4,4,4,
+  3,3,3,5,5,5,4,4,4,4,4,4,4,5,5,4,4,5,4,4,4,4,3,3,
+  3,4,4,4,3,3,4,3,3,2,3,3,4,3,3,3,3,3,3,3,4,4,3,3,
+  3,3,3,4,3,4,3,3,3,3,3,4,4,4,3,3,3,3,3,3,4,4,4,3,
+  3,4,3,3,3,4,3,3,3,3,3,3,4,4,4,3,4,4,4,5,4,4,4,3,
+  4,5,5,4,4,5,4,4,3,4,4,3,3,3,3,3,4,4,4,3,3,4,3,3,
+  3,3,3,3,3,3,4,4,4,3,5,5,4,4,4,3,4,4,4,3,4,4,5,4,
+  4,3,4,4,5,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,5,4,4,
+  3,3,4,4,4,4,4,4,5,5,4,4,4,5,5,3,4,4,3,3,3,4,5,5,
+  5,4,4,4,4,4,4,4,5,4,4,5,4,3,4,4,5,4,4,3,3,4,4,4,
+  3,4,4,4,3,4,4,3,4,4,5,4,4,3,4,4,5,4,4,3,4,4,3,3,
+  4,3,4,5,5,5,4,4,4,4,5,5,4,4,4,4,4,4,3,4,3,4,5,5,
+  4,4,4,4,4,3,4,5,4,5,4,3,4,4,5,4,4,3,3,4,4,3,3,3,
+  4,4,3,4,3,2,3,3,4,3,3,4,4,4,3,3,3,3,3,4,4,4,3,3,
+  4,3,3,2,3,3,4,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,3,4,
+  5,4,4,5,4,4,3,4,4,5,4,4,3,4,4,3,3,4,3,3,3,3,4,3,
+  3,3,3,3,4,4,4,4,4,4,4,5,5,4,5,4,4,4,4,5,4,4,3,4,
+  4,3,3,3,3,4,4,4,4,4,4,5,5,4,4,4,4,4,4,4,4,4,3,4,
+  4,5,4,4,3,4,4,3,4,3,3,2,3,3,4,3,3,3,3,3,3,4,4,3,
+  3,3,4,4,4,3,3,3,3,3,3,3,3,3,4,4,3,3,3,3,3,3,3,4,
+  3,3,3,3,4,3,3,3,3,3,3,3,4,4,3,4,4,4,3,3,3,3,3,3,
+  3,4,2,3,3,4,3,3,4,4,4,3,3,3,3,3,4,4,3,3,4,3,3,3,
+  4,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,4,4,5,4,
+  4,3,4,4,5,4,4,3,4,4,3,3,3,3,3,3,4,4,4,3,3,3,3,4,
+  3,3,4,4,4,4,4,4,5,5,4,4,4,4,4,4,4,5,4,3,4,4,5,4,
+  4,5,10,6,10,6,10,4,5,10,4,12,9,7,7,10,6,7,5,8,8,9,5,7,
+  5,6,6,4,5,7,6,9,8,4,3,6,5,7,6,9,7,6,7,19,14,10,7,5,
+  6,5,8,4,10,8,6,9,5,11,6,20,16,7,10,14,13,7,14,15,15,8,7,7,
+  7,6,
+};
+static const unsigned int uname_word_base[820] = {
+  0,101,199,286,349,450,540,627,704,796,893,986,
+  1062,1152,1248,1343,1435,1524,1630,1704,1797,1896,1981,2075,
+  2154,2255,2335,2401,2498,2569,2649,2743,2835,2913,2995,3088,
+  3186,3282,3372,3457,3533,3638,3709,3782,3865,3940,4015,4092,
+  4183,4260,4345,4444,4515,4633,4696,4777,4862,4965,5033,5103,
+  5181,5263,5326,5413,5488,5572,5670,5779,5850,5937,6022,6142,
+  6227,6317,6413,6517,6614,6723,6804,6878,6964,7045,7153,7250,
+  7310,7421,7486,7557,7623,7702,7785,7893,8004,8108,8200,8268,
+  8341,8419,8473,8582,8656,8758,8842,8944,9047,9145,9228,9303,
+  9358,9458,9562,9620,9682,9768,9840,9905,10003,10084,10163,10314,
+  10403,10505,10589,10675,10778,10908,11030,11120,11183,11278,11346,11407,
+  11499,11579,11684,11770,11824,11881,11939,12011,12104,12185,12270,12365,
+  12437,12492,12603,12659,12755,12888,13063,13166,13273,13359,13471,13549,
+  13622,13735,13804,13910,14024,14117,14228,14325,14393,14457,14522,14586,
+  14650,14715,14779,14843,14907,14971,15061,15159,15248,15331,15413,15491,
+  15556,15614,15692,15815,15925,16007,16138,16249,16348,16401,16458,16515,
+  16575,16640,16706,16754,16871,16951,17059,17138,17230,17286,17358,17457,
+  17539,17634,17727,17796,17860,17924,18007,18071,18125,18191,18306,18411,
+  18546,18670,18886,19080,19193,19293,19401,19519,19642,19716,19807,19898,
+  19973,20082,20198,20262,20318,20398,20500,20632,20726,20785,20866,20944,
+  21056,21156,21267,21389,21513,21630,21736,21817,21903,21970,22041,22154,
+  22233,22289,22344,22459,22603,22709,22821,22960,23095,23210,23329,23396,
+  23461,23534,23604,23669,23734,23798,23862,23926,23992,24060,24125,24189,
+  24253,24318,24384,24457,24525,24591,24656,24720,24784,24850,24914,24978,
+  25053,25157,25276,25401,25513,25626,25755,25836,25942,26018,26094,26188,
+  26292,26404,26500,26590,26686,26777,26882,26965,27055,27144,27234,27317,
+  27391,27469,27567,27640,27711,27800,27887,27992,28163,28343,28518,28678,
+  28742,28868,29042,29202,29358,29506,29662,29806,29946,30082,30238,30382,
+  30522,30654,30794,30922,31044,31156,31257,31377,31490,31636,31750,31900,
+  32036,32118,32171,32232,32285,32354,32418,32476,32534,32616,32670,32742,
+  32803,32871,32946,33081,33195,33260,33322,33482,33617,33771,33903,34026,
+  34127,34201,34271,34353,34465,34577,34651,34727,34798,34894,34975,35055,
+  35135,35216,35296,35399,35515,35631,35812,36068,36324,36564,36788,37012,
+  37202,37277,37383,37465,37545,37615,37680,37745,37810,37876,37951,38017,
+  38089,38157,38223,38289,38355,38420,38489,38557,38624,38690,38758,38823,
+  38891,38956,39031,39107,39173,39238,39309,39391,39473,39553,39625,39693,
+  39762,39830,39898,39963,40030,40095,40163,40230,40295,40362,40429,40495,
+  40561,40626,40692,40766,40837,40913,40982,41050,41117,41184,41253,41325,
+  41397,41473,41583,41655,41715,41775,41835,41894,41949,42007,42061,42119,
+  42171,42242,42379,42490,42609,42715,42826,42910,42998,43082,43205,43347,
+  43470,43566,43727,43934,44145,44358,44566,44805,45068,45177,45247,45320,
+  45393,45492,45612,45701,45808,45866,45930,45991,46057,46122,46187,46251,
+  46325,46391,46452,46516,46580,46644,46708,46771,46833,46897,46995,47146,
+  47264,47382,47482,47598,47715,47838,47936,48034,48132,48234,48321,48417,
+  48485,48602,48714,48831,48916,49005,49112,49224,49320,49384,49448,49512,
+  49576,49640,49704,49770,49827,49897,49981,50062,50142,50222,50300,50384,
+  50456,50525,50589,50659,50726,50790,50854,50923,50986,51047,51110,51171,
+  51234,51318,51417,51515,51607,51709,51794,51858,51924,51987,52051,52115,
+  52179,52243,52307,52371,52436,52499,52563,52639,52699,52753,52863,52967,
+  53054,53161,53283,53403,53526,53651,53750,53835,53952,54068,54157,54257,
+  54338,54404,54472,54605,54686,54790,54858,54920,54988,55050,55124,55184,
+  55243,55409,55524,55640,55735,55815,55931,56050,56160,56273,56405,56510,
+  56624,56740,56836,56925,57002,57137,57317,57420,57513,57615,57734,57835,
+  57896,57987,58091,58208,58351,58475,58589,58710,58832,58923,59006,59122,
+  59202,59278,59366,59454,59528,59590,59653,59733,59892,60116,60340,60395,
+  60526,60634,60752,60874,60986,61063,61161,61302,61394,61441,61562,61770,
+  61978,62186,62394,62602,62810,63018,63226,63434,63642,63850,64058,64266,
+  64474,64682,64890,65098,65306,65514,65722,65930,66138,66346,66554,66762,
+  66970,67178,67386,67594,67802,68010,68218,68426,68634,68842,69050,69258,
+  69466,69674,69882,70090,70298,70506,70714,70922,71130,71338,71502,71619,
+  71766,71903,72019,72137,72238,72341,72439,72542,72659,72767,72857,72934,
+  72996,73084,73247,73342,73438,73499,73560,73650,73841,74031,74222,74413,
+  74603,74794,74982,75173,75363,75554,75741,75915,76090,76264,76439,76607,
+  76730,76833,76929,77034,77105,77174,77231,77285,77352,77409,77471,77535,
+  77585,77636,77706,77762,77820,77886,77950,78015,78081,78142,78209,78267,
+  78332,78384,78436,78490,78543,78610,78664,78722,78786,78852,78917,78981,
+  79045,79106,79170,79236,79301,79354,79409,79459,79523,79580,79643,79703,
+  79768,79824,79877,79928,79980,80031,80085,80142,80208,80262,80326,80414,
+  80533,80629,80760,80935,
+};
+static const unsigned char uname_tokens[148288] = {
+  0,1,207,52,0,2,197,202,199,29,0,1,207,53,0,2,201,86,74,0,4,201,87,8,
+  15,201,88,1,2,201,89,201,90,0,2,192,31,192,132,1,1,192,156,0,4,207,54,66,
+  193,1,207,55,0,2,207,56,207,57,0,2,207,58,207,59,0,3,192,48,199,30,197,203,
+  1,3,5,0,199,30,3,1,192,32,3,1,197,204,3,1,193,169,0,4,192,48,5,0,
+  201,91,3,1,192,232,3,1,56,3,1,193,18,3,1,192,3,3,1,197,205,3,1,129,
+  3,1,58,3,1,201,92,3,1,192,219,3,1,192,144,3,1,197,206,3,1,199,31,3,
+  1,201,93,3,1,196,103,3,1,192,177,0,4,192,48,5,0,192,145,3,1,53,3,1,
+  192,238,3,1,199,32,3,1,154,3,1,192,101,3,1,201,94,3,1,193,190,3,1,46,
+  3,1,192,194,3,1,193,11,3,1,176,3,1,201,95,3,1,197,207,1,2,192,49,61,
+  1,2,14,115,0,3,192,48,14,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,
+  117,2,1,65,2,1,54,2,1,192,33,1,3,207,60,192,49,61,1,2,197,0,42,1,
+  1,192,79,1,3,86,193,170,42,2,2,193,127,42,1,2,199,33,42,1,1,193,191,0,
+  4,192,48,3,0,199,30,3,1,192,32,3,1,197,204,3,1,193,169,3,1,201,91,3,
+  1,192,232,3,1,56,3,1,193,18,3,1,192,3,3,1,197,205,3,1,129,3,1,58,
+  3,1,201,92,3,1,192,219,3,1,192,144,3,1,197,206,0,4,192,48,3,0,199,31,
+  3,1,201,93,3,1,196,103,3,1,192,177,3,1,192,145,3,1,53,3,1,192,238,3,
+  1,199,32,3,1,154,3,1,192,101,3,1,201,94,3,1,193,190,3,1,46,3,1,192,
+  194,3,1,193,11,3,1,176,0,4,192,48,3,0,201,95,3,1,197,207,1,2,16,197,
+  203,0,1,207,61,0,2,207,62,207,63,0,1,201,96,0,3,192,181,194,145,42,1,4,
+  199,34,196,18,195,106,195,170,1,4,201,97,196,18,195,106,195,170,1,3,196,18,195,107,
+  195,170,2,2,194,174,195,170,1,2,29,115,3,1,134,3,1,169,2,1,194,110,3,1,
+  169,0,3,192,181,29,193,68,3,1,169,2,1,85,3,1,134,3,1,169,2,1,193,153,
+  3,1,169,2,1,78,3,1,134,3,1,169,2,1,133,3,1,134,3,1,169,2,1,193,
+  41,3,1,169,2,1,49,0,4,192,181,29,49,134,3,1,169,2,1,128,3,1,134,3,
+  1,169,2,1,193,77,3,1,169,2,1,117,3,1,134,3,1,169,2,1,194,61,3,1,
+  169,2,1,192,66,3,1,169,2,1,193,117,3,1,169,0,3,192,181,29,65,3,1,134,
+  3,1,169,2,1,192,224,3,1,169,2,1,54,3,1,134,3,1,169,1,3,196,104,197,
+  208,194,208,2,2,195,106,195,170,2,2,197,209,195,170,2,2,195,107,195,170,2,2,194,
+  174,195,170,1,3,193,215,193,171,59,3,1,192,124,0,2,207,64,207,65,0,2,207,66,
+  1,0,5,192,148,192,49,1,192,12,170,4,2,207,67,154,4,1,154,1,2,14,115,2,
+  1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,
+  1,192,33,1,2,0,20,2,2,193,24,192,32,0,4,192,148,0,193,24,192,3,3,1,
+  180,2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,
+  2,1,193,25,2,1,192,232,2,1,192,3,2,1,192,239,2,1,129,2,1,192,102,2,
+  1,193,60,2,1,90,0,3,192,148,0,192,144,2,1,170,2,1,193,154,2,1,167,2,
+  1,173,2,1,192,95,2,1,192,251,2,1,192,145,2,1,150,2,1,192,195,2,1,154,
+  2,1,182,2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,0,3,192,148,29,192,
+  66,2,1,192,224,1,2,1,207,68,2,1,207,69,2,1,193,42,2,2,3,193,42,1,
+  2,11,195,108,1,3,16,1,20,3,1,192,45,3,1,192,74,3,1,195,44,3,1,199,
+  35,3,1,56,3,1,58,3,1,192,80,3,1,53,0,4,192,148,16,1,46,3,1,192,
+  103,0,1,195,171,1,1,207,70,1,1,201,98,0,1,207,71,0,2,207,72,193,155,0,
+  4,163,11,40,196,105,3,1,201,99,3,1,207,73,3,1,207,74,3,1,207,75,3,1,
+  207,76,3,2,196,106,196,19,3,2,197,210,207,77,4,1,207,78,0,5,163,11,40,197,
+  210,207,79,4,1,207,80,3,1,207,81,3,1,207,82,3,1,201,100,3,1,207,83,3,
+  3,199,36,74,207,84,5,1,207,85,3,2,207,86,196,19,3,2,55,199,37,3,1,207,
+  87,3,1,207,88,3,1,207,89,3,1,199,38,3,1,201,101,3,1,207,90,0,5,163,
+  11,40,207,91,207,92,3,1,207,93,3,2,196,107,201,102,4,1,196,19,3,3,199,39,
+  74,196,107,5,1,207,94,5,1,197,211,3,1,207,95,3,1,207,96,3,1,207,97,3,
+  1,207,98,3,1,207,99,3,1,207,100,3,1,207,101,3,1,207,102,3,1,207,103,0,
+  4,163,11,40,194,84,3,1,195,1,3,1,197,212,3,1,199,40,3,2,110,201,103,4,
+  1,201,104,3,2,195,109,201,105,3,1,193,172,3,2,197,211,196,19,4,1,207,104,3,
+  2,207,105,196,19,3,2,207,106,196,19,3,1,207,107,3,1,207,108,3,2,197,213,197,
+  1,4,1,207,109,0,5,163,11,40,197,213,207,110,3,1,199,41,3,1,197,214,3,1,
+  207,111,3,1,197,215,3,2,207,112,199,37,3,2,197,216,201,100,3,1,207,113,3,2,
+  207,114,199,38,3,1,207,115,3,1,207,116,3,1,207,117,3,2,207,118,207,119,3,1,
+  207,120,3,1,207,121,3,1,207,122,0,4,163,11,40,197,217,4,2,74,196,106,5,1,
+  207,123,5,1,197,211,3,1,207,124,3,1,207,125,3,1,207,126,3,1,207,127,3,2,
+  199,42,195,45,4,1,207,128,3,1,207,129,3,1,195,45,4,2,74,196,106,5,2,196,
+  107,201,102,3,3,207,130,74,207,131,3,1,207,132,0,4,163,11,40,201,106,3,1,197,
+  218,3,2,207,133,197,2,3,3,199,43,201,107,199,43,5,1,207,134,3,3,197,1,74,
+  196,106,5,1,196,107,5,3,195,45,74,196,106,7,1,196,107,3,1,207,135,3,1,199,
+  37,3,1,207,136,3,1,207,137,3,2,207,138,196,19,3,1,207,139,3,1,197,2,0,
+  4,163,11,40,207,140,3,1,207,141,3,1,207,142,3,1,201,108,4,2,74,196,106,3,
+  1,207,143,3,1,207,144,3,1,207,145,3,1,207,146,3,1,194,146,3,1,201,109,0,
+  2,118,11,0,1,201,99,0,2,201,110,207,147,0,2,197,3,207,148,1,2,164,66,0,
+  5,194,85,164,192,26,164,66,2,1,66,3,3,2,192,75,192,132,0,5,193,24,207,149,
+  39,197,4,197,5,0,3,199,44,195,110,11,0,3,207,150,192,26,201,111,0,1,207,151,
+  0,2,207,152,201,112,0,1,195,172,0,1,207,153,0,3,26,6,201,113,2,1,201,114,
+  2,1,201,115,2,1,201,116,2,1,201,117,2,1,201,118,0,3,26,6,201,119,2,1,
+  201,120,2,1,201,121,2,1,201,122,2,1,207,154,2,1,201,123,2,1,201,124,2,1,
+  201,125,2,1,201,126,2,1,201,127,2,1,201,128,2,1,201,129,2,1,201,130,2,1,
+  201,131,2,1,201,132,2,1,201,133,0,3,26,6,201,134,2,1,201,135,2,1,201,136,
+  2,1,201,137,2,1,201,138,2,1,207,155,2,1,201,139,2,1,201,140,2,1,201,141,
+  2,1,201,142,2,1,201,143,2,1,201,144,2,1,201,145,2,1,201,146,2,1,201,147,
+  2,1,201,148,0,3,26,6,201,149,2,1,201,150,2,1,201,151,2,1,207,156,2,1,
+  201,152,2,1,201,153,2,1,207,157,2,1,201,154,2,1,201,155,2,1,201,156,2,1,
+  201,157,2,1,201,158,2,1,201,159,2,1,207,158,2,1,207,159,2,1,201,160,0,3,
+  26,6,201,161,2,1,201,162,2,1,201,163,2,1,201,164,2,1,201,165,2,1,201,166,
+  2,1,201,167,2,1,201,168,2,1,201,169,2,1,201,170,2,1,201,171,2,1,201,172,
+  2,1,201,173,2,1,201,174,2,1,201,175,2,1,201,176,0,3,26,6,201,177,2,1,
+  201,178,2,1,201,179,2,1,207,160,2,1,207,161,2,1,207,162,2,1,201,180,2,1,
+  201,181,2,1,201,182,2,1,201,183,2,1,207,163,2,1,207,164,2,1,207,165,2,1,
+  207,166,2,1,207,167,2,1,207,168,0,3,26,6,207,169,2,1,207,170,2,1,207,171,
+  2,1,207,172,2,1,207,173,2,1,207,174,2,1,207,175,2,1,207,176,2,1,207,177,
+  2,1,207,178,2,1,207,179,2,1,207,180,2,1,207,181,2,1,207,182,2,1,207,183,
+  2,1,207,184,0,3,26,6,207,185,2,1,207,186,2,1,207,187,2,1,207,188,2,1,
+  207,189,2,1,207,190,2,1,207,191,2,1,207,192,2,1,207,193,2,1,207,194,2,1,
+  207,195,2,1,207,196,2,1,207,197,2,1,207,198,2,1,207,199,2,1,207,200,0,3,
+  26,6,207,201,2,1,207,202,2,1,207,203,2,1,207,204,2,1,207,205,2,1,207,206,
+  2,1,207,207,2,1,207,208,2,1,207,209,2,1,207,210,2,1,207,211,2,1,207,212,
+  2,1,207,213,2,1,207,214,2,1,207,215,2,1,207,216,0,3,26,6,207,217,2,1,
+  207,218,2,1,207,219,2,1,207,220,2,1,207,221,2,1,207,222,2,1,207,223,2,1,
+  207,224,2,1,207,225,2,1,207,226,2,1,207,227,2,1,207,228,2,1,207,229,2,1,
+  207,230,2,1,207,231,2,1,207,232,0,3,26,6,207,233,2,1,207,234,2,1,207,235,
+  2,1,207,236,2,1,207,237,2,1,207,238,2,1,207,239,2,1,207,240,2,1,207,241,
+  2,1,207,242,2,1,207,243,2,1,207,244,2,1,207,245,2,1,207,246,2,1,207,247,
+  2,1,207,248,0,3,26,6,207,249,2,1,207,250,2,1,207,251,2,1,207,252,2,1,
+  207,253,2,1,207,254,2,1,207,255,2,1,208,0,2,1,208,1,2,1,208,2,2,1,
+  208,3,2,1,208,4,2,1,208,5,2,1,208,6,2,1,208,7,2,1,208,8,0,3,
+  26,6,208,9,2,1,208,10,2,1,208,11,2,1,208,12,2,1,208,13,2,1,208,14,
+  2,1,208,15,2,1,208,16,2,1,208,17,2,1,208,18,2,1,208,19,2,1,208,20,
+  2,1,208,21,2,1,208,22,2,1,208,23,2,1,208,24,0,3,26,6,208,25,2,1,
+  208,26,2,1,208,27,2,1,208,28,2,1,208,29,2,1,208,30,2,1,208,31,2,1,
+  208,32,2,1,208,33,2,1,208,34,2,1,208,35,2,1,208,36,2,1,208,37,2,1,
+  208,38,2,1,208,39,2,1,208,40,0,3,26,6,208,41,2,1,208,42,2,1,208,43,
+  2,1,208,44,2,1,208,45,2,1,208,46,2,1,208,47,2,1,208,48,2,1,208,49,
+  2,1,208,50,2,1,208,51,2,1,208,52,2,1,208,53,2,1,208,54,2,1,208,55,
+  2,1,208,56,0,3,26,6,208,57,2,1,208,58,2,1,208,59,2,1,208,60,2,1,
+  208,61,2,1,208,62,2,1,208,63,2,1,208,64,2,1,208,65,2,1,208,66,2,1,
+  208,67,2,1,208,68,2,1,208,69,2,1,208,70,2,1,208,71,2,1,208,72,0,3,
+  26,6,208,73,2,1,208,74,2,1,208,75,2,1,208,76,2,1,208,77,2,1,208,78,
+  2,1,208,79,2,1,208,80,2,1,208,81,2,1,208,82,2,1,208,83,2,1,208,84,
+  2,1,208,85,2,1,208,86,2,1,208,87,2,1,208,88,0,3,26,6,208,89,2,1,
+  208,90,2,1,208,91,2,1,208,92,2,1,208,93,2,1,208,94,2,1,208,95,2,1,
+  208,96,2,1,208,97,2,1,208,98,2,1,208,99,2,1,208,100,2,1,208,101,2,1,
+  208,102,2,1,208,103,2,1,208,104,0,3,26,6,208,105,2,1,208,106,2,1,208,107,
+  2,1,208,108,2,1,208,109,2,1,208,110,2,1,208,111,2,1,208,112,2,1,208,113,
+  2,1,208,114,2,1,208,115,2,1,208,116,2,1,208,117,2,1,208,118,2,1,208,119,
+  2,1,208,120,0,3,26,6,208,121,2,1,208,122,2,1,208,123,2,1,208,124,2,1,
+  208,125,2,1,208,126,2,1,208,127,2,1,208,128,2,1,208,129,2,1,208,130,2,1,
+  208,131,2,1,208,132,2,1,208,133,2,1,208,134,2,1,208,135,2,1,208,136,0,3,
+  26,6,208,137,2,1,208,138,2,1,208,139,2,1,208,140,2,1,208,141,2,1,208,142,
+  2,1,208,143,2,1,208,144,2,1,208,145,2,1,208,146,2,1,208,147,2,1,208,148,
+  2,1,208,149,2,1,208,150,2,1,208,151,2,1,208,152,0,3,26,6,208,153,2,1,
+  208,154,2,1,208,155,2,1,208,156,2,1,208,157,2,1,208,158,2,1,208,159,2,1,
+  208,160,2,1,208,161,2,1,208,162,2,1,208,163,2,1,208,164,2,1,208,165,2,1,
+  201,184,2,1,201,185,2,1,201,186,0,3,26,6,201,187,2,1,201,188,2,1,201,189,
+  2,1,201,190,2,1,201,191,2,1,208,166,2,1,201,192,2,1,201,193,2,1,201,194,
+  2,1,201,195,2,1,208,167,2,1,201,196,2,1,201,197,2,1,201,198,2,1,201,199,
+  2,1,201,200,0,3,26,6,201,201,2,1,201,202,2,1,201,203,2,1,201,204,2,1,
+  201,205,2,1,201,206,2,1,201,207,2,1,201,208,2,1,201,209,2,1,201,210,2,1,
+  201,211,2,1,208,168,2,1,201,212,2,1,201,213,2,1,208,169,2,1,208,170,0,3,
+  26,6,208,171,2,1,201,214,2,1,201,215,2,1,201,216,2,1,201,217,2,1,208,172,
+  2,1,208,173,2,1,208,174,2,1,201,218,2,1,201,219,2,1,201,220,2,1,201,221,
+  2,1,201,222,2,1,201,223,2,1,201,224,2,1,201,225,0,3,26,6,201,226,2,1,
+  201,227,2,1,201,228,2,1,201,229,2,1,201,230,2,1,201,231,2,1,201,232,2,1,
+  201,233,2,1,201,234,2,1,201,235,2,1,201,236,2,1,201,237,2,1,201,238,2,1,
+  201,239,2,1,201,240,2,1,208,175,0,3,26,6,201,241,2,1,201,242,2,1,201,243,
+  2,1,201,244,2,1,201,245,2,1,208,176,2,1,201,246,2,1,201,247,2,1,201,248,
+  2,1,201,249,2,1,208,177,2,1,201,250,2,1,201,251,2,1,201,252,2,1,208,178,
+  2,1,208,179,0,3,26,6,208,180,2,1,208,181,2,1,208,182,2,1,208,183,2,1,
+  208,184,2,1,208,185,2,1,208,186,2,1,208,187,2,1,208,188,2,1,208,189,2,1,
+  208,190,2,4,208,191,154,192,26,194,86,2,1,208,192,2,1,208,193,2,1,208,194,2,
+  1,208,195,0,3,26,6,208,196,2,1,208,197,2,1,208,198,2,1,208,199,2,1,208,
+  200,2,1,208,201,2,1,208,202,2,2,208,203,115,2,1,208,204,2,1,208,205,2,1,
+  208,206,2,1,208,207,2,1,208,208,2,1,208,209,2,1,208,210,2,1,208,211,0,3,
+  26,6,208,212,2,1,208,213,2,1,208,214,2,1,208,215,2,1,208,216,2,1,208,217,
+  2,1,208,218,2,1,208,219,2,4,208,220,195,173,195,174,42,2,4,208,221,193,103,195,
+  174,42,2,1,208,222,2,1,208,223,2,1,208,224,2,1,208,225,2,1,208,226,2,1,
+  208,227,0,3,26,6,208,228,2,1,208,229,2,1,208,230,2,1,208,231,2,1,208,232,
+  2,1,208,233,2,1,208,234,2,1,208,235,2,1,208,236,2,1,208,237,2,1,208,238,
+  2,1,208,239,2,1,208,240,2,1,208,241,2,1,208,242,2,1,208,243,0,3,26,6,
+  208,244,2,1,208,245,2,1,208,246,2,1,208,247,2,1,208,248,2,1,208,249,2,1,
+  208,250,2,1,208,251,2,1,208,252,2,1,208,253,2,1,208,254,2,1,208,255,2,1,
+  209,0,2,1,209,1,2,1,209,2,2,1,209,3,0,3,26,6,209,4,2,1,209,5,
+  2,1,209,6,2,1,209,7,2,1,209,8,2,1,209,9,2,1,209,10,2,1,209,11,
+  2,1,209,12,2,1,209,13,2,1,209,14,2,1,209,15,2,1,209,16,2,1,209,17,
+  2,1,209,18,2,1,209,19,0,3,26,6,209,20,2,1,209,21,2,1,209,22,2,1,
+  209,23,2,1,209,24,2,1,209,25,2,1,209,26,2,1,209,27,2,1,209,28,2,1,
+  209,29,2,1,209,30,2,1,209,31,2,1,209,32,2,1,209,33,2,1,209,34,2,1,
+  209,35,0,3,26,6,209,36,2,1,209,37,2,1,209,38,2,1,209,39,2,1,209,40,
+  2,1,209,41,2,1,209,42,2,1,209,43,2,1,209,44,2,1,209,45,2,1,209,46,
+  2,1,209,47,2,1,209,48,2,1,209,49,2,1,209,50,2,1,209,51,0,3,26,6,
+  209,52,2,1,209,53,2,1,209,54,2,1,201,253,2,1,201,254,2,1,201,255,2,1,
+  202,0,2,1,202,1,2,1,202,2,2,1,209,55,2,1,202,3,2,1,202,4,2,1,
+  202,5,2,1,202,6,2,1,202,7,2,1,202,8,0,3,26,6,209,56,2,1,202,9,
+  2,1,202,10,2,1,209,57,2,1,209,58,2,1,209,59,2,1,202,11,2,1,202,12,
+  2,1,209,60,2,1,202,13,2,1,202,14,2,1,202,15,2,1,202,16,2,1,202,17,
+  2,1,202,18,2,1,202,19,0,3,26,6,202,20,0,2,209,61,193,118,0,1,202,21,
+  0,3,24,2,59,0,2,199,45,11,0,1,192,156,1,3,2,99,194,18,2,1,193,192,
+  0,2,209,62,104,0,2,209,63,1,0,2,209,64,104,0,1,209,65,0,1,209,66,0,
+  3,202,22,2,197,6,0,4,193,247,193,3,120,27,1,2,199,46,193,193,0,7,193,247,
+  183,24,187,177,120,194,62,1,3,202,23,120,27,1,1,197,219,1,3,177,120,27,1,3,
+  192,240,197,7,27,1,4,192,92,193,51,197,8,27,2,3,39,197,8,27,2,3,177,120,
+  27,2,3,37,197,8,27,2,3,192,240,197,8,27,0,4,192,125,192,126,11,192,112,4,
+  1,193,192,3,2,196,20,119,3,2,120,196,20,4,1,192,96,4,1,195,175,0,5,192,
+  125,192,126,11,120,192,171,4,1,196,108,4,1,193,192,3,2,192,168,119,3,2,197,220,
+  192,96,4,1,196,108,4,1,184,3,2,194,2,196,108,4,1,193,192,3,2,192,241,193,
+  192,3,3,116,195,46,184,4,2,196,21,196,108,4,2,193,69,195,175,5,1,193,192,3,
+  2,183,197,221,3,2,193,43,193,192,0,5,192,125,192,126,11,192,172,192,96,3,1,209,
+  67,3,1,192,199,4,1,193,192,3,2,195,175,192,96,4,1,193,192,3,3,39,196,21,
+  196,108,3,2,108,197,221,3,1,192,108,4,1,193,192,3,1,193,194,4,1,196,20,4,
+  1,120,4,1,193,90,4,1,197,220,4,1,194,2,0,5,192,125,192,126,11,193,194,192,
+  241,4,1,199,47,4,2,116,195,46,4,2,183,27,4,1,164,4,1,192,172,4,1,195,
+  175,4,2,108,27,4,1,192,173,4,2,192,146,164,4,1,193,127,4,2,91,27,4,1,
+  194,87,4,2,96,195,46,4,2,187,27,3,2,202,24,193,194,0,5,192,125,192,126,11,
+  202,24,193,192,3,1,193,144,3,2,91,197,221,3,2,194,209,193,192,3,2,194,87,119,
+  3,2,209,68,193,194,3,2,192,171,192,96,3,2,196,108,184,3,2,184,192,96,3,3,
+  96,195,46,184,4,2,196,21,195,175,4,2,193,69,192,96,5,1,195,175,5,1,194,175,
+  3,2,187,197,221,3,1,209,69,0,1,209,70,0,1,195,111,0,3,209,71,193,1,209,
+  72,0,6,196,109,195,47,192,146,202,25,164,66,1,4,164,192,26,164,66,2,1,66,3,
+  4,192,26,193,1,195,112,74,0,1,209,73,0,4,8,202,26,194,176,59,1,1,192,168,
+  1,2,193,61,195,2,2,1,197,9,2,1,194,147,2,1,196,22,2,1,194,148,2,1,
+  197,10,0,2,8,195,2,2,2,73,15,2,2,192,12,15,2,2,2,59,1,1,197,9,
+  2,2,73,15,1,2,202,27,193,171,1,2,199,48,193,171,1,4,209,74,193,103,74,202,
+  28,1,4,51,37,192,97,38,5,2,2,59,1,2,197,11,195,3,1,4,194,111,192,147,
+  139,192,104,3,2,135,192,104,1,3,193,103,74,202,28,3,2,195,113,42,0,2,8,194,
+  147,2,2,73,15,2,2,192,12,15,2,3,2,59,38,3,1,159,3,2,54,140,1,1,
+  196,22,2,2,73,15,1,3,85,193,52,192,171,1,2,202,29,195,176,1,2,192,209,192,
+  104,1,4,110,195,3,145,195,3,1,2,192,79,38,2,1,57,1,2,192,143,195,2,1,
+  1,194,148,0,4,8,194,148,73,15,2,2,192,12,15,2,3,2,59,57,1,1,197,10,
+  2,2,73,15,1,3,192,34,120,57,2,3,194,176,59,38,4,1,57,4,3,194,18,120,
+  57,1,3,39,192,97,38,3,1,57,1,2,0,193,85,2,2,197,12,193,44,3,1,192,
+  133,3,1,193,62,4,4,2,65,140,38,0,3,8,0,192,252,3,2,50,15,3,2,86,
+  15,3,2,73,15,3,2,192,12,15,3,4,2,65,140,38,6,1,57,6,3,192,89,183,
+  38,4,3,54,140,38,6,2,195,177,38,2,1,118,3,2,50,15,3,2,73,15,3,1,
+  192,129,4,2,50,15,4,2,73,15,0,4,8,0,118,197,222,4,2,50,15,4,2,73,
+  15,3,5,2,193,248,193,51,37,194,148,8,3,24,59,38,9,2,39,159,5,1,194,147,
+  5,1,194,148,5,2,39,192,79,6,2,194,176,59,5,2,37,192,79,6,2,194,176,59,
+  5,3,194,176,59,38,7,1,57,5,3,192,240,37,194,147,8,3,24,59,38,0,11,8,
+  0,118,2,193,248,192,240,37,194,147,24,39,159,4,2,59,38,4,5,193,226,193,70,14,
+  65,38,7,2,54,38,4,2,192,79,38,6,2,50,15,6,2,73,15,5,1,57,6,2,
+  50,15,6,2,73,15,4,3,39,76,71,4,2,195,3,38,6,2,50,15,6,2,73,15,
+  4,3,37,76,71,7,3,24,59,38,0,10,8,0,118,2,37,76,71,24,39,159,4,3,
+  195,4,192,79,38,6,1,57,2,1,197,13,3,2,50,15,3,2,86,15,3,2,73,15,
+  3,2,192,12,15,2,1,192,253,3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,
+  12,15,3,7,2,59,57,24,65,140,38,4,2,192,79,38,4,4,192,143,3,192,9,57,
+  0,7,8,0,192,253,2,3,88,38,5,1,192,9,6,1,57,4,4,65,140,209,75,57,
+  6,3,192,89,187,57,9,4,24,54,140,38,4,6,54,140,57,24,59,38,2,1,197,14,
+  3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,2,1,193,91,3,2,50,
+  15,3,2,86,15,3,2,73,15,0,5,8,0,193,91,192,12,15,3,3,2,59,57,2,
+  1,199,49,3,2,50,15,3,2,73,15,2,1,194,19,3,2,50,15,3,2,73,15,3,
+  3,2,59,57,6,3,24,3,193,26,4,3,78,140,38,4,4,192,143,3,192,9,57,5,
+  1,192,9,4,1,159,4,4,65,140,38,183,6,1,57,0,11,8,0,194,19,2,54,140,
+  195,177,57,24,3,193,26,2,1,199,50,3,2,50,15,3,2,73,15,2,1,199,51,3,
+  2,50,15,3,2,73,15,2,2,193,249,192,253,3,1,193,44,3,1,193,62,2,1,199,
+  52,3,2,50,15,3,2,73,15,2,1,197,15,3,2,50,15,3,2,86,15,0,5,8,
+  0,197,15,73,15,3,2,192,12,15,2,1,56,3,2,50,15,3,2,86,15,3,2,73,
+  15,3,2,192,12,15,2,2,194,149,92,4,2,50,15,4,2,86,15,4,2,73,15,4,
+  2,192,12,15,4,6,2,193,226,193,70,14,78,57,8,2,65,38,8,2,54,38,5,2,
+  192,143,192,9,0,8,8,0,194,149,92,2,65,140,38,5,3,54,140,38,2,1,193,44,
+  3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,3,3,2,59,57,6,4,
+  24,65,140,38,5,2,209,76,57,4,3,65,140,57,6,3,192,89,187,57,4,3,54,140,
+  57,2,1,195,48,3,2,50,15,3,2,86,15,0,5,8,0,195,48,73,15,3,2,192,
+  12,15,3,3,2,192,143,71,4,1,159,4,3,65,140,38,4,3,54,140,57,2,1,193,
+  173,3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,3,3,2,59,57,4,
+  3,65,140,38,2,1,209,77,2,1,197,16,3,2,50,15,0,5,8,0,197,16,86,15,
+  3,2,73,15,3,2,192,12,15,2,1,165,3,2,50,15,3,2,86,15,3,2,73,15,
+  3,2,192,12,15,3,6,2,193,226,193,70,14,78,57,4,2,192,79,38,4,4,192,143,
+  3,192,9,57,4,5,3,8,0,193,26,38,8,3,24,54,140,8,1,57,4,3,65,140,
+  38,6,3,192,89,187,57,0,7,8,0,165,2,54,140,38,6,2,83,38,2,1,192,79,
+  3,2,73,15,2,1,192,225,3,1,197,17,4,2,50,15,4,2,86,15,4,2,73,15,
+  4,2,192,12,15,3,2,50,15,3,1,195,178,4,2,50,15,4,2,86,15,4,2,73,
+  15,4,2,192,12,15,0,7,8,0,192,225,195,178,2,192,79,38,3,2,86,15,3,2,
+  73,15,3,2,192,12,15,3,3,2,192,143,192,9,4,2,92,38,6,2,50,15,6,2,
+  73,15,2,2,139,192,79,4,1,118,4,1,193,11,4,1,92,2,1,192,1,3,2,50,
+  15,3,2,86,15,3,2,73,15,0,5,8,0,192,1,192,12,15,3,4,2,65,140,38,
+  6,1,57,4,3,54,140,38,2,1,199,53,3,2,50,15,3,2,73,15,2,1,192,219,
+  3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,3,3,2,59,38,5,1,
+  57,4,1,159,4,3,65,140,57,0,7,8,0,192,219,2,54,140,38,2,2,202,30,92,
+  2,1,194,210,3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,3,3,2,
+  59,38,4,2,3,192,9,4,3,65,140,38,6,1,57,6,3,192,89,187,57,4,3,54,
+  140,38,6,2,195,177,57,2,1,192,134,3,2,50,15,0,5,8,0,192,134,86,15,3,
+  2,73,15,3,2,192,12,15,2,2,195,5,193,4,4,2,50,15,4,2,73,15,3,1,
+  193,27,4,2,50,15,4,2,73,15,2,1,192,105,3,2,50,15,3,2,86,15,3,2,
+  73,15,3,2,192,12,15,3,2,2,119,4,2,59,38,0,6,8,0,192,105,2,51,119,
+  4,5,3,8,0,193,26,38,5,1,192,9,4,3,65,140,38,6,1,57,2,2,135,118,
+  2,1,42,2,1,88,3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,3,
+  3,2,59,38,5,1,57,4,3,65,140,38,2,1,194,3,0,5,8,0,194,3,50,15,
+  3,2,86,15,3,2,73,15,3,2,192,12,15,2,1,197,18,3,2,50,15,3,2,86,
+  15,3,2,73,15,3,2,192,12,15,2,1,192,133,3,2,50,15,3,1,197,19,4,2,
+  50,15,4,2,73,15,3,2,86,15,3,2,73,15,0,5,8,0,192,133,192,12,15,3,
+  3,2,59,57,4,3,192,143,3,192,9,4,1,159,4,2,3,193,26,5,1,192,9,4,
+  3,65,140,38,4,3,54,140,57,2,1,197,20,3,2,50,15,3,2,86,15,3,2,73,
+  15,3,2,192,12,15,2,1,193,4,3,2,50,15,3,2,73,15,0,3,8,0,195,114,
+  3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,3,4,2,3,88,38,5,
+  1,192,9,2,1,197,21,3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,
+  2,1,193,62,3,2,50,15,3,2,86,15,3,2,73,15,0,5,8,0,193,62,192,12,
+  15,3,3,2,59,38,5,1,57,6,4,24,193,28,140,38,4,3,65,140,38,2,1,193,
+  45,3,2,50,15,3,2,73,15,3,3,2,59,57,6,3,24,59,38,4,3,78,140,38,
+  4,2,192,79,38,4,2,192,143,192,9,4,1,193,156,4,1,159,4,7,3,8,0,193,
+  26,24,54,140,0,7,8,0,193,45,2,3,192,133,38,5,1,192,9,6,1,57,4,1,
+  71,4,3,54,140,38,6,2,195,177,38,2,1,197,22,3,2,50,15,3,2,86,15,3,
+  2,73,15,3,2,192,12,15,2,2,192,215,92,2,1,199,54,3,2,50,15,3,2,73,
+  15,2,1,193,78,0,5,8,0,193,78,50,15,3,2,86,15,3,2,73,15,3,2,192,
+  12,15,3,4,2,65,140,38,6,1,57,4,3,54,140,57,2,1,192,216,3,2,50,15,
+  3,2,86,15,3,2,73,15,3,2,192,12,15,3,6,2,59,57,24,59,38,4,5,193,
+  226,193,70,14,78,38,4,3,78,140,38,4,2,192,143,192,9,0,11,8,0,192,216,2,
+  3,8,0,193,26,24,54,140,4,3,65,140,57,7,4,24,65,140,38,4,4,54,140,195,
+  177,38,2,1,193,5,3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,3,
+  3,2,59,57,2,2,193,63,193,11,2,2,193,145,118,2,2,196,110,192,219,2,1,193,
+  26,3,2,50,15,3,2,86,15,0,5,8,0,193,26,73,15,3,2,192,12,15,3,3,
+  2,59,57,4,3,65,140,38,6,1,57,4,3,54,140,38,2,1,196,23,3,2,50,15,
+  3,2,86,15,3,2,73,15,3,2,192,12,15,3,3,2,59,38,4,2,3,192,9,2,
+  1,197,23,3,2,50,15,3,2,86,15,0,5,8,0,197,23,73,15,3,2,192,12,15,
+  2,1,192,202,3,2,50,15,3,2,86,15,3,2,73,15,3,1,197,223,4,2,50,15,
+  4,1,195,178,4,2,73,15,3,2,192,12,15,3,2,2,159,4,3,3,192,202,38,5,
+  1,192,9,4,4,65,140,38,183,2,1,197,24,0,5,8,0,197,24,50,15,3,2,86,
+  15,3,2,73,15,3,2,192,12,15,2,1,195,179,3,2,50,15,3,2,73,15,2,1,
+  193,202,3,2,50,15,3,2,86,15,3,2,73,15,3,2,192,12,15,2,2,197,224,92,
+  2,1,196,111,3,2,50,15,3,2,86,15,0,5,8,0,196,111,73,15,3,2,192,12,
+  15,3,3,2,3,192,9,2,1,197,25,3,2,50,15,3,2,86,15,3,2,73,15,3,
+  2,192,12,15,2,1,46,3,2,50,15,3,2,73,15,3,3,2,192,79,38,6,2,73,
+  15,2,7,197,26,202,31,195,5,118,192,129,86,15,7,2,192,12,15,2,1,194,63,0,
+  5,8,0,194,63,50,15,3,2,73,15,2,1,197,27,3,2,50,15,3,2,86,15,3,
+  2,73,15,3,2,192,12,15,2,1,193,11,3,2,50,15,3,2,73,15,3,3,2,59,
+  38,5,1,196,24,4,5,193,226,193,70,14,65,38,7,2,54,38,4,2,192,79,38,6,
+  2,50,15,0,8,8,0,193,11,2,192,79,38,73,15,4,1,159,4,3,54,140,38,2,
+  1,92,3,1,195,115,4,2,50,15,4,2,73,15,4,6,2,193,226,193,70,14,65,38,
+  8,2,54,38,5,2,192,79,38,7,2,50,15,7,2,73,15,3,2,50,15,3,2,86,
+  15,3,2,73,15,3,2,192,12,15,0,6,8,0,92,2,192,79,38,6,2,50,15,6,
+  2,86,15,6,2,73,15,6,2,192,12,15,4,2,3,192,9,4,1,192,169,4,3,65,
+  140,57,4,6,54,140,57,24,59,38,8,2,192,79,38,8,3,3,192,133,38,2,1,193,
+  27,3,2,50,15,3,2,73,15,2,1,194,150,3,2,50,15,0,5,8,0,194,150,86,
+  15,3,2,73,15,3,2,192,12,15,2,1,194,88,3,2,50,15,3,2,73,15,3,4,
+  2,192,143,192,9,38,1,7,32,192,252,2,118,192,129,50,15,6,2,73,15,4,3,192,
+  1,86,15,5,2,73,15,5,4,2,88,50,15,7,2,86,15,4,3,88,86,15,5,2,
+  73,15,5,5,2,118,192,129,50,15,0,9,8,32,192,252,2,88,2,88,50,15,7,2,
+  86,15,6,3,92,50,15,4,3,92,50,15,5,2,73,15,2,3,209,78,73,15,2,2,
+  209,79,197,225,2,3,197,28,73,15,2,2,197,226,197,225,3,2,209,80,209,81,2,2,
+  209,82,197,225,2,2,209,83,197,225,2,7,118,192,129,2,193,145,118,50,15,7,2,73,
+  15,3,4,2,196,22,50,15,5,2,73,15,0,5,8,32,209,84,73,15,2,3,209,85,
+  192,109,209,86,2,6,192,253,2,118,192,129,50,15,6,2,73,15,4,3,165,86,15,5,
+  2,73,15,5,4,2,92,50,15,4,3,192,225,86,15,5,2,192,12,15,4,3,192,1,
+  86,15,5,2,73,15,4,3,192,134,86,15,5,2,73,15,5,4,2,92,50,15,4,3,
+  88,50,15,5,2,86,15,0,7,8,32,192,253,2,88,73,15,5,2,192,12,15,4,3,
+  192,133,50,15,4,3,193,45,50,15,4,3,92,50,15,5,2,73,15,4,3,194,88,50,
+  15,2,3,209,87,209,88,209,89,2,6,193,91,2,118,192,129,50,15,6,2,73,15,4,
+  3,165,86,15,5,2,73,15,5,5,2,118,192,129,50,15,6,3,92,50,15,4,3,192,
+  1,86,15,5,2,73,15,0,7,8,32,193,91,2,192,134,86,15,5,2,73,15,5,4,
+  2,88,50,15,7,2,86,15,4,3,88,86,15,5,2,73,15,4,3,193,45,50,15,5,
+  2,73,15,4,3,92,50,15,5,2,73,15,2,6,193,44,2,118,192,129,50,15,6,2,
+  73,15,4,3,165,86,15,5,2,73,15,4,3,192,1,86,15,5,2,73,15,0,7,8,
+  32,193,44,2,192,134,86,15,5,2,73,15,5,4,2,88,50,15,7,2,86,15,4,3,
+  88,86,15,5,2,73,15,5,4,2,92,50,15,4,3,92,50,15,5,2,73,15,2,6,
+  193,173,2,118,192,129,50,15,6,2,73,15,4,3,192,1,86,15,5,2,73,15,4,3,
+  88,86,15,5,2,73,15,5,5,2,118,192,129,50,15,0,9,8,32,193,173,2,88,2,
+  88,50,15,6,3,92,50,15,4,3,92,50,15,5,2,73,15,2,6,165,2,118,192,129,
+  50,15,6,2,73,15,4,3,192,1,86,15,5,2,73,15,5,4,2,92,50,15,4,3,
+  88,86,15,5,2,73,15,5,5,2,118,192,129,50,15,6,3,92,50,15,4,3,92,50,
+  15,5,2,73,15,2,6,192,225,2,118,192,129,73,15,0,7,8,32,192,225,2,192,1,
+  86,15,5,2,73,15,4,3,88,86,15,5,2,73,15,5,4,2,192,1,86,15,6,3,
+  88,86,15,4,4,193,145,118,86,15,4,3,92,73,15,2,1,209,90,2,6,192,1,2,
+  118,192,129,50,15,6,2,73,15,4,3,165,86,15,5,2,73,15,5,5,2,118,192,129,
+  50,15,6,3,92,50,15,4,3,88,86,15,0,7,8,32,192,1,2,88,73,15,5,5,
+  2,118,192,129,50,15,6,3,165,50,15,7,2,86,15,6,3,92,50,15,4,3,92,50,
+  15,5,2,73,15,2,5,192,219,2,118,50,15,5,2,73,15,5,3,192,129,50,15,6,
+  2,73,15,4,3,165,86,15,5,2,73,15,4,3,192,1,86,15,5,2,73,15,4,3,
+  192,134,86,15,0,7,8,32,192,219,2,192,134,73,15,4,3,192,105,50,15,5,2,86,
+  15,5,2,73,15,5,2,192,12,15,4,3,88,50,15,5,2,86,15,5,2,73,15,5,
+  2,192,12,15,5,4,2,88,50,15,7,2,86,15,6,3,92,50,15,4,3,92,50,15,
+  5,2,73,15,2,6,192,134,2,118,192,129,50,15,6,2,73,15,0,7,8,32,192,134,
+  2,165,73,15,4,3,192,1,86,15,5,2,73,15,4,3,88,86,15,5,2,73,15,4,
+  3,92,50,15,5,2,73,15,2,5,192,105,2,118,50,15,5,2,73,15,5,3,192,129,
+  50,15,6,2,73,15,5,5,2,192,79,38,50,15,8,2,73,15,7,3,57,50,15,8,
+  2,73,15,6,4,195,3,38,50,15,0,10,8,32,192,105,2,118,2,195,3,38,73,15,
+  4,3,165,86,15,5,2,73,15,5,5,2,118,192,129,50,15,6,3,88,50,15,7,2,
+  86,15,6,3,92,50,15,4,3,192,225,86,15,4,3,192,1,86,15,5,2,73,15,5,
+  4,2,192,1,50,15,7,2,86,15,6,3,88,50,15,7,2,86,15,6,3,92,50,15,
+  4,3,192,134,86,15,0,7,8,32,192,105,2,192,134,73,15,5,4,2,88,50,15,7,
+  2,86,15,4,3,88,50,15,5,2,86,15,5,2,73,15,5,2,192,12,15,5,4,2,
+  165,50,15,7,2,86,15,6,3,92,50,15,4,3,92,50,15,5,2,73,15,2,5,88,
+  2,118,50,15,5,3,192,129,73,15,4,3,165,86,15,5,2,73,15,0,9,8,32,88,
+  2,165,2,192,1,86,15,6,3,88,86,15,6,3,92,50,15,4,3,192,1,86,15,5,
+  2,73,15,5,4,2,165,86,15,6,3,192,134,86,15,6,3,88,86,15,6,3,92,50,
+  15,4,3,192,134,86,15,5,2,73,15,5,4,2,192,1,86,15,6,3,88,86,15,6,
+  3,92,50,15,4,3,88,50,15,5,2,86,15,0,7,8,32,88,2,88,73,15,5,4,
+  2,92,50,15,4,3,92,73,15,2,3,209,91,73,15,2,6,192,133,2,118,192,129,50,
+  15,6,2,73,15,4,3,165,86,15,5,2,73,15,5,5,2,118,192,129,50,15,6,3,
+  88,86,15,6,3,92,50,15,4,3,192,225,86,15,5,2,192,12,15,4,3,192,1,86,
+  15,5,2,73,15,5,5,2,118,192,129,50,15,0,9,8,32,192,133,2,192,1,2,165,
+  50,15,7,2,86,15,6,3,88,50,15,7,2,86,15,6,3,92,50,15,4,3,192,134,
+  86,15,5,2,73,15,4,3,88,50,15,5,2,86,15,5,2,73,15,5,2,192,12,15,
+  5,5,2,118,192,129,50,15,6,3,92,50,15,4,3,192,133,50,15,4,3,193,45,50,
+  15,4,3,92,50,15,0,7,8,32,192,133,2,92,73,15,4,3,194,88,50,15,2,6,
+  193,62,2,118,192,129,50,15,6,2,73,15,4,3,165,86,15,5,2,73,15,4,3,88,
+  86,15,5,2,73,15,5,4,2,165,50,15,7,2,86,15,6,3,88,50,15,6,3,92,
+  50,15,4,3,92,50,15,5,2,73,15,2,8,209,92,202,32,194,151,202,33,192,104,1,
+  73,15,2,2,209,93,209,94,0,5,8,32,196,112,197,29,209,95,4,1,209,96,4,1,
+  209,97,4,1,209,98,4,1,209,99,2,2,209,100,202,34,2,2,209,101,202,34,2,3,
+  209,102,73,15,2,6,193,45,2,193,145,118,73,15,2,6,193,78,2,118,192,129,50,15,
+  6,2,73,15,4,3,165,86,15,5,2,73,15,5,4,2,165,50,15,7,2,86,15,6,
+  3,92,50,15,0,7,8,32,193,78,2,192,134,86,15,4,3,88,86,15,5,2,73,15,
+  5,4,2,88,50,15,7,2,86,15,4,3,193,45,50,15,5,2,73,15,4,3,92,50,
+  15,5,2,73,15,2,2,209,103,209,104,2,3,209,105,73,15,2,3,202,35,73,15,3,
+  7,202,32,194,151,202,33,192,104,1,73,15,2,3,209,106,197,226,209,107,2,3,202,36,
+  197,28,202,37,2,4,209,108,197,226,209,109,209,110,0,8,8,32,192,216,2,118,192,129,
+  50,15,6,2,73,15,4,3,165,86,15,5,2,73,15,5,2,192,12,15,5,4,2,192,
+  1,86,15,4,3,192,225,86,15,5,2,192,12,15,4,3,192,1,86,15,5,2,73,15,
+  5,2,192,12,15,5,5,2,118,192,129,50,15,6,3,165,86,15,4,3,192,134,86,15,
+  5,2,73,15,5,2,192,12,15,0,10,8,32,192,216,2,192,134,2,118,192,129,50,15,
+  6,3,92,50,15,4,3,88,86,15,5,2,73,15,5,2,192,12,15,5,4,2,165,50,
+  15,7,2,86,15,6,3,192,1,86,15,6,3,88,50,15,7,2,86,15,4,3,193,45,
+  50,15,5,2,73,15,4,3,92,50,15,5,2,73,15,2,5,194,152,2,195,2,73,15,
+  5,2,192,12,15,0,7,8,32,194,152,2,197,9,73,15,4,3,194,147,73,15,5,2,
+  192,12,15,4,3,194,148,73,15,5,2,192,12,15,4,3,197,10,73,15,4,4,193,145,
+  118,73,15,2,6,193,5,2,118,192,129,50,15,6,2,73,15,4,3,165,50,15,5,2,
+  86,15,5,2,73,15,5,2,192,12,15,5,4,2,88,50,15,7,2,86,15,6,3,92,
+  50,15,0,7,8,32,193,5,2,192,225,86,15,5,2,192,12,15,4,3,192,1,50,15,
+  5,2,86,15,5,2,73,15,5,2,192,12,15,5,4,2,92,50,15,4,3,192,134,50,
+  15,5,2,86,15,5,2,73,15,5,2,192,12,15,4,3,88,50,15,5,2,86,15,5,
+  2,73,15,5,2,192,12,15,5,4,2,192,134,50,15,0,9,8,32,193,5,2,88,2,
+  192,134,86,15,6,3,88,50,15,7,2,86,15,4,3,193,45,50,15,5,2,73,15,4,
+  3,92,50,15,5,2,73,15,2,3,209,111,192,109,209,112,2,2,209,113,209,114,2,6,
+  193,26,2,118,192,129,50,15,6,2,73,15,4,3,165,86,15,5,2,73,15,4,3,88,
+  86,15,5,2,73,15,5,2,192,12,15,0,9,8,32,193,26,2,88,2,165,50,15,7,
+  2,86,15,6,3,88,86,15,6,3,92,50,15,4,3,92,50,15,5,2,73,15,2,6,
+  192,202,2,118,192,129,50,15,6,2,73,15,4,3,165,86,15,5,2,73,15,5,4,2,
+  192,1,50,15,7,2,86,15,6,3,88,86,15,4,3,192,225,86,15,5,2,192,12,15,
+  4,3,192,1,86,15,0,7,8,32,192,202,2,192,1,73,15,5,5,2,118,192,129,50,
+  15,6,3,88,86,15,6,3,92,50,15,4,3,192,134,86,15,5,2,73,15,5,5,2,
+  118,192,129,50,15,6,3,88,86,15,6,3,92,50,15,4,3,88,50,15,5,2,86,15,
+  5,2,73,15,5,2,192,12,15,5,5,2,118,192,129,50,15,6,3,165,86,15,6,3,
+  192,1,86,15,0,9,8,32,192,202,2,88,2,192,134,86,15,6,3,92,50,15,4,3,
+  192,133,50,15,4,3,193,45,50,15,4,3,92,50,15,5,2,73,15,4,3,194,88,50,
+  15,2,6,195,179,2,193,145,118,73,15,2,6,193,202,2,118,192,129,50,15,6,2,73,
+  15,4,3,192,225,192,12,15,4,3,192,1,73,15,4,3,88,50,15,5,2,86,15,5,
+  2,73,15,5,2,192,12,15,0,7,8,32,193,202,2,192,133,50,15,4,3,193,45,50,
+  15,4,3,92,50,15,5,2,73,15,4,3,194,88,50,15,2,11,197,26,195,5,92,2,
+  192,79,38,2,118,192,129,50,15,11,2,86,15,11,2,73,15,2,3,202,37,73,15,2,
+  6,92,2,118,192,129,50,15,6,2,73,15,4,3,165,86,15,5,2,73,15,5,4,2,
+  92,50,15,4,6,192,79,38,2,193,85,50,15,8,2,73,15,0,10,8,32,92,2,192,
+  79,38,2,118,50,15,8,2,73,15,8,3,192,129,50,15,9,2,73,15,7,3,56,50,
+  15,8,2,86,15,8,2,73,15,7,3,165,86,15,8,2,73,15,7,3,192,225,86,15,
+  8,2,192,12,15,7,3,192,1,86,15,8,2,73,15,7,3,192,134,86,15,7,3,88,
+  50,15,8,2,86,15,0,10,8,32,92,2,192,79,38,2,88,73,15,8,2,192,12,15,
+  7,3,192,133,50,15,7,3,193,4,50,15,8,2,73,15,7,3,193,45,50,15,7,3,
+  46,50,15,8,2,73,15,7,3,193,11,50,15,8,2,73,15,7,3,92,50,15,8,2,
+  73,15,7,3,193,27,50,15,8,2,73,15,7,3,194,88,50,15,4,3,192,225,86,15,
+  0,7,8,32,92,2,192,225,192,12,15,4,3,192,1,86,15,5,2,73,15,5,4,2,
+  92,50,15,4,3,192,134,86,15,5,2,73,15,4,3,88,50,15,5,2,86,15,5,2,
+  73,15,5,2,192,12,15,5,4,2,88,50,15,7,2,86,15,6,3,92,50,15,4,3,
+  192,133,50,15,4,3,193,45,50,15,4,3,92,50,15,0,7,8,32,92,2,92,73,15,
+  4,3,194,88,50,15,2,5,194,150,2,88,86,15,5,2,73,15,5,2,192,12,15,1,
+  2,195,3,209,115,1,2,202,38,38,1,3,42,192,133,197,19,2,3,194,20,192,133,197,
+  19,1,2,12,192,252,2,1,118,2,1,192,253,2,1,193,91,2,1,194,19,2,2,193,
+  249,192,253,3,1,193,44,0,4,8,12,193,249,192,133,3,1,193,62,2,2,192,17,192,
+  252,3,1,192,253,3,1,193,91,3,1,194,19,3,1,193,44,3,1,193,173,3,1,165,
+  3,1,192,1,3,1,192,134,3,1,192,105,3,1,88,3,1,192,133,3,1,193,62,3,
+  1,193,45,0,4,8,12,192,17,193,78,3,1,192,216,3,1,193,5,3,1,193,26,3,
+  1,192,202,3,1,195,179,3,1,193,202,3,1,193,11,3,1,92,3,1,194,150,3,1,
+  194,88,2,1,193,44,2,1,193,173,2,1,165,2,2,86,192,252,3,1,192,253,0,4,
+  8,12,86,193,91,3,1,193,44,3,1,193,173,3,1,165,3,1,192,225,3,1,192,1,
+  3,1,192,219,3,1,192,134,3,1,192,105,3,1,88,3,1,192,133,3,1,193,62,3,
+  1,193,78,3,1,192,216,3,1,193,5,3,1,192,202,0,4,8,12,86,193,202,3,1,
+  92,2,1,192,1,2,1,192,219,2,1,192,134,2,1,192,105,2,2,193,157,192,252,3,
+  1,118,3,1,192,253,3,1,193,91,3,1,194,19,3,1,193,44,3,1,193,173,3,1,
+  165,3,1,192,225,3,1,192,1,0,4,8,12,193,157,192,134,3,1,192,105,3,1,88,
+  3,1,192,133,3,1,193,62,3,1,193,45,3,1,193,78,3,1,192,216,3,1,193,5,
+  3,1,193,26,3,1,192,202,3,1,195,179,3,1,193,202,3,1,193,11,3,1,92,3,
+  1,194,150,0,4,8,12,193,157,194,88,2,1,88,2,1,192,133,2,4,192,242,165,2,
+  194,19,3,5,88,2,165,2,196,113,2,1,193,62,2,1,193,45,2,1,193,78,2,1,
+  192,216,2,1,193,5,2,2,193,195,192,252,3,1,192,253,3,1,193,91,3,2,193,249,
+  192,253,4,1,193,44,3,1,193,44,0,4,8,12,193,195,193,173,3,1,165,3,1,192,
+  225,3,1,192,1,3,1,192,219,3,1,192,134,3,1,88,3,1,192,133,3,1,193,62,
+  3,1,193,78,3,1,192,216,3,1,193,5,3,1,193,26,3,1,192,202,3,1,193,202,
+  3,1,92,0,4,8,12,193,195,194,150,2,1,193,26,2,2,194,89,192,252,3,1,193,
+  91,3,2,193,249,192,133,4,1,193,62,3,1,193,173,3,1,165,3,1,192,1,3,1,
+  192,134,3,1,192,105,3,1,192,133,3,1,193,62,3,1,193,78,3,1,192,216,3,1,
+  193,5,0,4,8,12,194,89,92,2,1,192,202,2,1,195,179,2,1,193,202,2,1,193,
+  11,2,1,92,2,1,194,150,2,1,194,88,1,3,29,42,38,2,1,1,1,2,177,197,
+  9,2,1,196,22,2,1,197,10,1,2,197,30,1,1,3,209,116,42,38,1,3,196,25,
+  74,209,117,0,4,8,209,118,199,55,1,1,3,197,227,42,38,1,2,193,127,42,1,3,
+  193,79,194,176,59,1,1,202,39,1,2,192,56,195,2,1,3,37,192,97,38,4,2,2,
+  59,3,1,57,1,6,194,112,139,192,104,2,209,119,192,147,1,1,194,209,1,1,194,152,
+  2,2,73,15,2,2,192,12,15,1,3,1,197,28,209,120,2,1,209,121,0,5,8,1,
+  196,112,209,122,209,123,2,2,209,124,197,28,2,1,202,40,2,3,202,36,197,28,209,125,
+  2,1,209,126,2,1,209,127,2,2,202,41,195,172,3,2,209,128,195,6,2,1,209,129,
+  1,2,3,195,2,2,2,194,149,92,2,1,194,147,2,2,139,192,252,3,4,193,249,193,
+  146,74,192,134,3,2,194,149,92,3,2,202,29,195,176,0,4,8,3,139,192,1,3,2,
+  192,105,118,3,6,32,118,2,192,105,2,92,4,6,193,62,2,192,105,2,118,192,129,4,
+  6,193,78,2,192,105,2,118,192,129,3,1,195,3,3,3,88,86,15,4,2,73,15,3,
+  1,192,133,4,2,2,194,148,3,1,193,62,3,2,194,112,192,33,3,1,193,78,3,1,
+  192,216,3,2,1,202,40,3,1,193,26,0,5,8,3,139,65,140,3,3,209,130,202,42,
+  192,33,3,1,193,11,3,2,193,215,209,131,4,1,209,132,4,1,209,133,4,1,209,134,
+  4,1,209,135,4,1,209,136,4,1,202,43,4,1,209,137,4,1,209,138,3,1,92,4,
+  5,195,115,2,54,140,57,3,1,194,150,3,1,194,88,0,3,8,3,194,148,2,2,135,
+  88,3,3,192,133,2,194,148,3,1,192,216,3,1,193,11,3,2,193,215,209,139,4,1,
+  209,140,4,1,209,141,2,1,193,11,2,1,92,1,5,197,31,74,197,228,193,216,209,142,
+  1,2,193,29,118,1,1,195,180,2,1,57,2,2,73,15,2,2,192,12,15,0,4,8,
+  193,145,118,209,143,1,3,11,59,38,3,1,57,2,4,51,83,119,57,2,3,78,140,38,
+  4,1,57,2,1,159,2,3,3,193,26,38,4,1,57,2,3,65,140,38,4,1,57,4,
+  3,192,89,183,38,6,1,57,2,3,54,140,38,4,1,57,4,2,195,177,38,0,6,8,
+  11,54,140,195,177,57,2,2,197,222,38,1,2,192,169,209,144,1,1,196,113,2,3,2,
+  196,22,38,3,2,202,44,192,79,4,1,193,11,3,3,54,140,57,1,2,195,181,193,171,
+  1,3,136,193,156,38,3,1,57,2,3,49,59,38,4,1,57,2,3,54,140,38,4,1,
+  57,1,4,192,174,59,192,4,42,0,4,8,160,195,2,57,1,2,83,192,169,1,4,16,
+  1,59,57,3,4,192,143,3,192,9,38,3,3,3,192,9,38,1,3,195,4,192,79,57,
+  1,1,209,145,0,3,193,70,199,56,197,32,1,2,14,115,2,1,85,2,1,78,2,1,
+  133,2,1,49,2,1,128,2,1,117,2,1,65,0,3,193,70,14,54,2,1,192,33,1,
+  2,197,209,197,32,1,3,197,33,202,45,1,2,3,192,66,169,1,0,1,194,4,0,1,
+  209,146,0,3,192,22,194,21,42,1,1,195,111,1,3,5,0,199,57,3,1,199,58,3,
+  1,192,107,3,1,192,142,3,1,202,46,3,1,194,211,3,1,191,0,4,192,22,5,0,
+  196,114,3,1,195,49,3,1,194,177,3,1,193,44,3,1,202,47,3,1,199,59,3,1,
+  193,158,3,1,199,60,3,1,192,102,3,1,202,48,3,1,199,61,3,1,196,115,3,1,
+  202,49,3,1,195,6,3,1,197,229,3,1,197,34,0,4,192,22,5,0,195,114,3,1,
+  199,62,3,1,154,3,1,193,45,3,1,202,50,3,1,192,101,3,1,202,51,3,1,66,
+  3,1,199,63,3,1,195,50,3,1,199,64,3,1,9,3,1,199,65,3,1,192,221,3,
+  1,194,90,1,1,192,168,0,3,192,22,201,103,1,1,2,202,52,42,1,2,193,170,42,
+  1,2,192,209,192,104,1,1,194,212,1,5,61,0,39,110,159,1,2,193,127,42,1,3,
+  3,0,199,57,3,1,199,58,3,1,192,107,3,1,192,142,3,1,202,46,3,1,194,211,
+  3,1,191,3,1,196,114,3,1,195,49,0,4,192,22,3,0,194,177,3,1,193,44,3,
+  1,202,47,3,1,199,59,3,1,193,158,3,1,199,60,3,1,192,102,3,1,202,48,3,
+  1,199,61,3,1,196,115,3,1,202,49,3,1,195,6,3,1,197,229,3,1,197,34,3,
+  1,195,114,3,1,199,62,0,4,192,22,3,0,154,3,1,193,45,3,1,202,50,3,1,
+  192,101,3,1,202,51,3,1,66,3,2,160,199,57,3,1,199,63,3,1,195,50,3,1,
+  199,64,3,1,9,4,2,2,71,3,1,199,65,3,1,192,221,3,1,194,90,2,3,32,
+  196,114,199,65,0,5,192,22,3,32,195,6,196,114,4,1,199,60,4,1,197,229,4,1,
+  199,64,3,2,199,63,197,229,0,6,27,192,89,183,195,116,197,35,108,5,1,91,2,4,
+  91,195,116,197,35,183,5,2,192,50,192,196,5,1,187,2,4,187,195,116,188,192,196,0,
+  2,209,147,197,36,0,2,209,148,209,149,0,2,209,150,209,151,0,2,202,53,202,54,0,
+  2,209,152,11,0,1,209,153,0,1,192,245,1,1,192,242,0,1,209,154,0,2,209,155,
+  104,0,1,209,156,0,4,209,157,11,40,202,55,0,3,202,56,164,66,0,2,209,158,196,
+  21,0,2,209,159,11,0,1,209,160,0,2,209,161,1,0,2,209,162,209,163,0,3,209,
+  164,209,165,199,66,0,1,202,57,0,3,192,197,194,21,42,0,3,192,197,0,20,2,1,
+  192,45,2,1,202,58,2,1,209,166,2,1,193,85,2,1,202,59,2,1,193,53,2,1,
+  197,230,2,1,194,113,2,1,197,204,2,1,195,117,2,1,193,227,2,1,197,37,2,1,
+  56,2,1,193,13,2,1,194,213,0,3,192,197,0,195,51,2,1,199,67,2,1,194,38,
+  2,1,193,19,2,1,209,167,2,1,58,2,1,192,80,2,1,194,214,2,1,193,250,2,
+  1,192,226,2,1,193,80,2,1,193,71,2,1,202,60,2,1,209,168,2,1,209,169,2,
+  1,209,170,0,3,192,197,0,199,68,2,1,53,2,1,192,233,2,1,192,238,2,1,194,
+  39,2,1,193,228,2,1,192,246,2,1,209,171,2,1,209,172,2,1,193,54,2,1,193,
+  1,2,1,197,38,2,1,46,2,1,192,103,2,1,194,63,2,1,196,116,0,3,192,197,
+  0,209,173,2,1,202,61,2,1,194,91,2,1,209,174,2,1,193,229,2,1,194,90,0,
+  1,209,175,0,1,199,69,0,1,196,117,1,1,209,176,1,1,197,231,1,1,199,70,1,
+  1,11,0,3,194,215,74,195,118,1,4,2,108,27,38,0,5,199,71,194,178,63,91,27,
+  0,6,199,72,192,50,27,2,196,118,192,169,4,2,172,192,169,0,1,209,177,0,2,209,
+  178,202,62,0,1,202,63,0,4,209,179,202,64,24,209,180,0,1,209,181,0,2,209,182,
+  209,183,0,2,209,184,202,65,0,3,151,197,39,197,39,1,2,199,73,209,185,2,1,209,
+  186,2,1,209,187,1,2,14,115,2,1,85,2,1,78,0,3,151,14,133,2,1,49,2,
+  1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,2,0,209,188,2,1,202,66,
+  3,1,194,216,2,2,193,30,202,67,2,2,209,189,195,182,2,1,192,32,3,1,209,190,
+  2,1,192,107,3,1,209,191,0,3,151,0,191,3,1,209,192,3,2,194,217,209,193,4,
+  1,195,183,2,2,195,52,195,182,2,1,209,194,2,1,192,3,3,1,209,195,2,1,129,
+  2,1,202,68,3,1,194,216,2,1,192,102,3,1,209,196,2,1,90,3,1,195,183,2,
+  2,192,219,195,182,0,4,151,0,209,197,195,182,2,1,170,3,1,197,232,4,1,194,216,
+  2,1,167,2,1,173,3,1,209,198,2,1,192,95,2,1,192,145,2,1,202,69,3,1,
+  194,216,2,1,150,3,1,209,199,2,1,154,3,1,196,119,4,1,194,216,0,3,151,0,
+  182,3,1,209,200,3,1,209,201,2,1,180,3,1,209,202,3,2,194,217,195,183,3,1,
+  209,203,2,2,209,204,195,182,2,1,202,70,3,1,194,216,2,2,194,63,195,182,2,1,
+  192,109,2,1,176,2,2,197,207,195,182,1,4,35,11,31,209,205,4,1,209,206,0,5,
+  151,35,11,31,209,207,4,1,199,74,4,1,202,71,5,2,2,199,74,4,1,202,72,5,
+  2,2,199,74,4,1,209,208,3,1,209,209,3,1,209,210,3,1,197,233,4,1,209,211,
+  4,1,202,73,3,1,209,212,3,1,209,213,3,1,209,214,3,1,202,74,0,4,151,35,
+  11,201,105,3,3,197,40,193,3,209,215,5,1,209,216,4,2,177,209,217,5,1,199,75,
+  5,1,209,218,3,3,197,234,193,3,209,219,5,1,202,75,4,2,177,193,159,5,1,193,
+  81,1,1,202,76,2,1,202,77,1,1,209,220,1,1,202,78,2,1,202,77,1,2,1,
+  209,221,0,3,151,1,209,222,2,1,209,223,2,1,202,73,2,2,197,235,194,114,3,1,
+  209,224,1,4,16,1,170,197,232,5,1,194,216,3,1,199,76,4,1,194,216,3,2,154,
+  196,119,5,1,194,216,3,1,197,236,4,1,209,225,3,1,197,41,4,1,196,119,5,1,
+  194,216,0,5,151,16,1,197,41,194,216,3,1,194,216,3,1,197,235,4,1,202,79,1,
+  1,202,80,0,3,194,218,74,209,226,0,2,209,227,209,228,0,1,199,77,0,2,199,78,
+  192,245,0,4,194,179,25,157,192,57,1,1,100,2,2,2,194,179,3,2,25,194,145,4,
+  2,157,192,57,3,1,194,145,3,2,122,192,57,0,5,194,179,100,2,157,192,57,3,1,
+  192,57,1,2,157,192,57,1,1,192,57,0,2,23,193,90,1,3,31,42,209,229,3,1,
+  209,230,1,1,192,168,1,2,192,209,192,104,1,2,0,20,2,1,193,13,2,1,209,231,
+  2,1,196,26,2,1,199,79,2,1,195,119,2,1,58,0,3,23,0,90,2,1,196,115,
+  2,1,196,27,2,1,202,81,2,1,193,203,2,1,193,196,2,1,209,232,2,1,209,233,
+  2,1,197,42,2,1,193,230,2,1,197,237,2,1,170,2,1,202,82,2,1,192,149,2,
+  1,197,238,2,1,193,174,0,3,23,0,178,2,1,167,2,1,196,120,2,1,202,83,2,
+  1,199,80,2,1,195,6,2,1,193,119,2,1,193,231,2,1,193,31,2,1,173,2,1,
+  197,239,2,1,192,95,2,1,197,43,2,1,202,84,2,1,193,72,2,1,199,81,0,3,
+  23,0,197,44,2,1,202,85,2,1,199,82,2,1,199,83,2,1,202,86,2,1,193,92,
+  2,1,202,87,2,1,194,153,2,1,53,2,1,150,2,1,195,120,2,1,199,84,2,2,
+  192,51,209,234,3,2,209,235,209,236,3,1,209,237,3,1,209,238,0,4,23,0,192,51,
+  209,239,3,1,209,240,3,1,196,27,3,1,209,241,3,1,209,242,3,1,209,243,3,1,
+  209,244,3,2,199,85,197,240,3,1,209,245,3,1,193,174,3,1,209,246,3,1,209,247,
+  3,1,199,86,3,1,209,248,3,1,209,249,3,1,209,250,0,4,23,0,192,51,209,251,
+  3,1,202,88,3,1,209,252,3,2,197,45,209,253,3,1,202,89,3,1,209,254,3,1,
+  209,255,3,1,210,0,3,2,194,180,202,90,3,1,210,1,3,1,210,2,3,1,210,3,
+  3,2,196,121,195,184,3,1,202,91,3,2,196,122,199,87,3,1,210,4,0,4,23,0,
+  192,51,199,88,3,1,210,5,3,1,199,89,3,2,202,92,195,184,3,1,210,6,3,1,
+  210,7,3,1,202,93,3,1,202,94,3,1,210,8,3,1,199,82,3,1,202,95,3,1,
+  197,241,4,1,210,9,4,1,202,96,3,1,210,10,3,1,199,90,0,4,23,0,192,51,
+  194,153,3,2,202,97,210,11,3,2,199,91,195,184,3,2,210,12,199,92,3,2,150,199,
+  87,3,1,202,98,3,1,210,13,3,1,210,14,3,1,210,15,3,1,210,16,3,3,197,
+  46,195,184,202,99,5,1,202,100,4,3,150,196,123,202,99,6,1,202,100,3,1,202,101,
+  3,1,210,17,0,4,23,0,192,51,210,18,3,3,210,19,150,196,123,3,1,210,20,3,
+  3,199,93,199,94,202,102,3,1,210,21,3,1,210,22,3,1,210,23,3,1,210,24,3,
+  1,210,25,3,1,199,95,3,1,197,242,3,1,202,103,3,1,210,26,3,2,202,104,195,
+  184,3,2,193,190,199,96,3,1,210,27,0,6,23,0,192,51,46,199,97,202,105,3,1,
+  210,28,3,1,195,185,2,2,192,186,196,26,3,1,210,29,3,1,210,30,3,1,210,31,
+  3,1,210,32,3,1,210,33,3,1,210,34,3,1,210,35,3,1,210,36,3,1,210,37,
+  3,1,210,38,3,3,192,105,199,94,197,243,3,1,199,85,0,5,23,0,192,186,202,106,
+  197,244,3,1,167,4,1,210,39,4,1,210,40,3,2,197,47,210,41,3,1,210,42,3,
+  1,210,43,3,2,199,98,210,44,3,1,210,45,3,1,210,46,3,2,199,92,210,47,3,
+  1,210,48,3,2,195,184,202,107,3,1,210,49,3,2,197,245,210,50,3,1,202,108,0,
+  5,23,0,192,186,210,51,199,99,3,1,202,109,4,1,192,34,3,2,210,52,202,110,3,
+  1,199,100,3,1,210,53,3,1,210,54,3,2,210,55,210,56,3,1,210,57,3,2,194,
+  153,197,244,3,1,210,58,3,1,210,59,3,1,202,111,3,1,210,60,3,1,210,61,3,
+  2,195,121,193,190,0,5,23,0,192,186,202,112,210,62,3,1,210,63,3,1,210,64,3,
+  1,202,113,3,1,210,65,3,2,193,190,210,66,4,1,202,114,3,1,210,67,3,1,210,
+  68,3,2,210,69,199,87,3,1,210,70,2,2,192,13,210,71,3,1,202,115,3,1,210,
+  72,3,1,210,73,3,1,210,74,0,4,23,0,192,13,197,246,3,2,196,115,210,75,4,
+  1,202,116,3,1,196,27,3,1,210,76,3,1,202,117,3,1,210,77,3,1,210,78,3,
+  1,210,79,3,2,199,101,202,94,3,1,197,240,3,1,192,105,3,1,199,102,3,1,210,
+  80,3,1,193,174,3,2,167,210,81,0,5,23,0,192,13,167,202,114,3,1,199,96,3,
+  1,202,88,3,2,196,120,210,82,4,1,210,83,3,1,202,89,3,1,210,84,3,1,210,
+  85,3,1,202,118,3,1,210,86,3,1,199,103,3,1,210,87,3,1,199,98,3,1,210,
+  88,3,1,210,89,3,1,210,90,0,4,23,0,192,13,202,119,3,1,202,120,3,1,210,
+  91,3,1,202,91,3,1,202,121,3,1,199,104,3,1,210,92,3,1,210,93,3,1,210,
+  94,3,1,210,95,3,1,210,96,3,1,199,89,3,1,199,105,3,2,210,97,197,243,3,
+  1,210,98,3,1,210,99,0,4,23,0,192,13,210,100,3,1,210,101,3,2,202,92,199,
+  96,3,1,199,100,3,1,199,81,3,1,202,93,3,1,210,102,3,1,202,122,3,1,202,
+  123,3,1,210,103,3,1,210,104,3,1,210,105,3,1,210,106,3,1,210,107,3,2,210,
+  108,199,100,3,1,202,96,0,4,23,0,192,13,210,109,3,1,210,110,3,2,210,111,199,
+  98,3,3,210,112,210,113,202,124,3,1,199,91,3,1,210,114,3,1,196,124,3,1,202,
+  125,3,1,210,115,3,1,193,217,3,1,210,116,3,1,199,106,3,1,202,126,3,1,210,
+  117,3,1,210,118,3,1,210,119,0,4,23,0,192,13,196,28,3,1,210,120,3,2,202,
+  104,210,121,3,1,210,122,3,1,210,123,3,1,210,124,3,1,210,125,3,1,210,126,3,
+  1,196,125,3,1,210,127,3,2,193,27,210,128,3,1,202,102,3,1,202,127,2,2,161,
+  197,247,3,1,210,129,3,1,202,128,0,4,23,0,161,202,129,3,1,196,27,3,1,210,
+  130,3,1,202,117,3,2,210,131,210,132,3,1,210,133,3,1,193,230,3,1,202,130,3,
+  1,210,134,3,1,210,135,3,1,210,136,3,1,197,237,3,1,202,82,3,1,199,85,3,
+  1,210,137,3,1,210,138,0,4,23,0,161,210,139,3,1,197,238,3,1,194,219,3,1,
+  178,3,1,210,140,3,1,210,141,3,1,196,120,4,1,128,3,1,210,142,3,1,199,80,
+  3,1,202,124,3,1,199,92,3,1,210,143,3,1,210,144,3,1,210,145,3,1,210,146,
+  0,4,23,0,161,195,184,3,1,210,147,3,1,210,148,3,1,210,149,3,1,210,150,3,
+  1,193,31,3,1,202,110,3,1,202,121,3,1,199,107,3,1,210,151,3,1,210,152,3,
+  1,202,108,3,1,210,153,3,1,210,154,3,1,210,155,3,1,210,156,0,4,23,0,161,
+  210,157,3,1,210,158,3,1,210,159,3,1,210,160,3,1,210,161,3,1,210,162,3,1,
+  210,163,3,1,193,72,3,1,210,164,3,1,210,165,3,1,210,166,3,1,196,123,3,1,
+  210,167,3,1,202,123,3,1,210,168,3,1,199,94,0,4,23,0,161,210,169,3,1,210,
+  170,3,1,210,171,3,1,199,83,3,1,197,244,3,1,202,86,3,1,193,92,3,1,197,
+  243,3,1,199,90,3,1,194,153,3,1,210,172,3,1,194,40,3,1,195,120,3,1,210,
+  173,3,1,202,131,3,1,210,174,0,4,23,0,161,210,175,3,1,210,176,3,2,197,248,
+  197,48,4,1,36,3,1,197,249,3,1,202,132,3,1,210,177,3,1,210,178,3,1,197,
+  250,3,1,210,179,3,1,202,133,3,1,197,251,3,1,199,93,3,1,194,115,3,1,199,
+  95,3,1,210,180,0,4,23,0,161,202,113,3,1,197,242,3,1,199,108,3,1,210,181,
+  3,1,202,103,3,1,210,182,3,1,210,183,3,1,194,22,3,1,202,134,3,1,193,190,
+  3,1,202,135,3,1,202,136,3,1,210,184,3,1,210,185,3,1,197,49,3,1,210,186,
+  0,4,23,0,161,202,137,3,1,202,127,2,2,111,20,3,1,193,18,3,1,210,187,3,
+  1,196,26,3,1,199,79,3,2,195,119,199,109,4,1,58,4,1,210,188,3,1,202,115,
+  3,1,210,189,3,1,210,190,3,1,210,191,3,1,210,192,3,1,210,193,0,4,23,0,
+  111,202,129,3,1,210,194,3,1,210,195,3,1,210,196,3,1,58,3,1,196,27,3,1,
+  210,197,3,1,202,81,3,1,193,203,3,1,193,196,3,1,210,198,3,1,210,199,3,1,
+  199,101,3,1,197,240,3,1,199,31,3,1,199,102,0,4,23,0,111,210,200,3,1,210,
+  201,3,1,202,106,3,1,210,202,3,1,202,138,3,1,197,238,3,1,193,174,3,1,167,
+  3,1,202,139,3,1,199,86,3,1,197,45,3,1,202,140,3,1,197,252,3,1,202,118,
+  3,1,195,6,3,1,210,203,0,4,23,0,111,202,141,3,1,210,204,3,1,193,119,3,
+  1,202,119,3,1,194,180,3,1,202,120,3,1,210,205,3,1,173,3,1,202,105,3,3,
+  197,239,202,142,196,126,4,1,210,206,3,1,199,104,3,1,210,207,3,1,210,208,3,1,
+  210,209,3,1,192,95,0,4,23,0,111,210,210,3,1,210,211,3,1,210,212,3,1,202,
+  90,3,2,210,213,197,243,3,1,210,214,3,1,210,215,3,1,202,143,3,1,210,216,3,
+  1,210,217,3,1,210,218,3,1,210,219,3,1,210,220,3,1,202,144,3,1,210,221,3,
+  1,210,222,0,4,23,0,111,210,223,3,1,202,145,3,1,197,44,4,1,210,224,3,1,
+  202,122,3,1,210,225,3,1,202,95,3,1,210,226,3,1,210,227,3,1,197,241,3,1,
+  210,228,3,2,194,153,193,175,4,1,210,229,3,1,210,230,3,1,210,231,3,1,53,0,
+  5,23,0,111,150,202,146,4,1,210,232,3,1,197,253,3,1,202,98,3,1,210,233,3,
+  1,210,234,3,1,199,84,3,1,192,210,3,1,210,235,3,1,210,236,3,1,194,41,3,
+  1,210,237,3,1,194,181,3,1,199,110,3,1,210,238,3,1,202,147,0,4,23,0,111,
+  210,239,3,1,196,127,3,1,210,240,3,1,199,111,3,1,210,241,3,1,197,254,3,1,
+  196,29,3,1,195,121,3,1,210,242,3,1,202,126,3,1,195,7,3,1,199,93,3,1,
+  202,148,3,1,210,243,3,1,196,30,3,1,210,244,0,5,23,0,111,210,245,197,244,3,
+  1,196,31,3,1,210,246,3,1,192,66,3,1,210,247,3,1,202,107,3,1,196,128,3,
+  1,210,248,3,1,202,134,3,1,210,249,3,1,197,50,3,1,210,250,3,1,195,185,3,
+  1,210,251,3,1,210,252,3,1,210,253,0,4,23,0,111,199,112,3,1,202,149,3,1,
+  202,150,3,1,210,254,3,1,210,255,3,1,211,0,3,1,211,1,3,1,211,2,3,1,
+  199,113,3,2,197,255,199,114,4,1,211,3,3,1,211,4,3,1,211,5,3,1,211,6,
+  3,1,199,97,2,2,192,200,193,13,0,4,23,0,192,200,199,79,3,1,90,3,1,196,
+  115,3,1,196,27,3,1,193,196,3,1,197,42,3,1,193,230,3,1,197,237,3,1,170,
+  3,1,192,149,3,1,197,238,3,1,178,3,1,167,3,1,196,120,3,1,202,83,3,1,
+  199,80,0,4,23,0,192,200,193,231,3,1,197,239,3,1,197,43,3,1,202,84,3,1,
+  193,72,3,1,199,81,3,1,202,85,3,1,199,82,3,1,199,83,3,1,193,92,3,1,
+  202,87,3,1,194,153,3,1,195,120,3,1,199,84,3,1,199,110,3,1,197,51,0,4,
+  23,0,192,200,197,248,3,1,199,111,3,1,202,151,3,1,197,249,3,1,193,217,3,1,
+  202,152,3,1,199,106,3,1,197,251,3,1,195,7,3,1,194,115,3,1,193,218,3,1,
+  197,242,3,1,196,30,3,1,199,108,3,1,196,28,3,1,46,0,4,23,0,192,200,211,
+  7,3,1,192,109,3,1,199,112,3,1,176,3,1,197,255,2,1,192,210,2,1,199,110,
+  2,1,202,147,2,1,196,127,2,1,197,51,2,1,197,248,2,1,199,111,2,1,202,151,
+  2,1,197,249,2,1,193,217,2,1,202,152,0,3,23,0,199,106,2,1,202,133,2,1,
+  197,251,2,1,195,7,2,1,194,115,2,1,193,218,2,1,197,242,2,1,196,30,2,1,
+  199,108,2,1,192,66,2,1,196,28,2,1,194,22,2,1,46,2,1,192,109,2,1,199,
+  112,2,1,176,0,3,23,0,197,255,2,1,199,97,1,1,202,145,1,2,193,127,42,1,
+  1,194,209,0,1,211,8,0,1,211,9,0,1,199,115,0,4,198,0,2,196,32,1,2,
+  2,202,153,1,2,2,197,227,1,2,2,197,49,1,0,2,119,197,52,1,2,74,201,106,
+  0,2,211,10,197,53,0,1,211,11,0,1,211,12,0,3,211,13,24,211,14,0,5,193,
+  32,193,55,31,139,136,3,2,211,15,136,3,2,135,136,3,2,211,16,136,3,2,196,33,
+  136,2,2,192,209,192,104,2,2,0,20,3,1,192,32,3,1,195,117,3,1,211,17,3,
+  1,194,5,3,1,56,3,1,193,13,3,1,211,18,0,4,193,32,193,55,0,193,18,3,
+  1,202,154,3,1,199,116,3,1,211,19,3,1,58,3,1,195,8,3,1,90,3,1,211,
+  20,3,1,198,1,3,1,53,3,1,192,233,3,1,150,3,1,193,228,3,1,66,3,1,
+  46,3,1,211,21,0,4,193,32,193,55,0,196,34,3,1,192,109,3,1,211,22,3,1,
+  211,23,3,1,202,155,3,1,194,220,0,1,199,117,0,4,192,187,192,49,1,192,18,3,
+  1,194,3,1,2,0,20,2,1,192,32,2,1,192,107,2,1,191,2,1,192,3,2,1,
+  129,2,1,58,0,3,192,187,0,192,102,2,2,199,118,192,32,2,1,170,2,1,167,2,
+  2,199,119,129,3,1,173,3,1,182,2,1,197,47,2,1,173,2,1,196,122,2,1,192,
+  95,2,2,202,156,180,2,1,192,145,2,1,150,2,2,202,157,192,109,2,1,154,0,3,
+  192,187,0,182,2,2,195,9,20,3,1,192,3,3,1,129,3,1,170,3,1,167,3,1,
+  150,3,1,154,3,1,182,3,1,192,109,3,1,176,2,2,202,158,180,2,1,46,2,1,
+  192,109,2,1,176,1,1,202,159,0,2,192,187,211,24,1,2,1,211,25,1,3,11,194,
+  182,211,26,3,2,173,211,27,3,1,202,159,3,1,211,28,1,3,16,1,56,3,1,193,
+  13,3,1,58,3,2,199,118,58,4,1,53,3,1,53,3,2,202,157,56,3,1,46,4,
+  3,40,195,9,182,0,1,199,36,0,1,202,160,0,1,202,161,0,3,211,29,2,197,54,
+  0,4,198,2,202,53,35,197,55,1,3,199,120,35,197,55,1,2,193,46,197,55,1,2,
+  196,129,197,55,0,1,211,30,0,2,202,162,104,0,2,211,31,193,232,0,2,211,32,193,
+  118,0,1,199,121,0,1,211,33,0,1,211,34,0,2,202,163,198,3,0,1,202,164,0,
+  1,196,35,1,1,202,165,1,1,11,1,3,2,198,4,71,0,2,211,35,196,35,0,3,
+  192,23,194,21,1,1,1,199,122,1,3,192,98,194,116,42,1,3,195,53,202,166,195,54,
+  2,2,196,130,78,3,1,49,4,4,211,36,196,131,193,1,202,166,3,1,65,3,1,54,
+  1,2,14,115,2,1,85,0,3,192,23,14,78,2,1,133,2,1,49,2,1,128,2,1,
+  117,2,1,65,2,1,54,2,1,192,33,1,2,211,37,42,1,1,202,167,1,2,0,20,
+  2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,2,1,193,2,0,3,192,23,
+  0,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,232,2,1,
+  56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,2,1,192,102,2,
+  1,193,60,2,1,90,2,1,192,144,0,4,192,23,0,211,38,180,2,1,170,2,1,167,
+  2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,2,1,53,2,1,150,2,1,192,
+  195,2,1,154,3,3,2,107,189,4,2,76,189,2,1,195,122,2,1,194,6,2,1,182,
+  0,3,192,23,0,192,101,2,1,193,33,2,1,180,2,1,192,167,2,1,192,214,2,1,
+  193,12,2,1,46,2,1,192,103,2,2,192,234,192,203,2,2,123,112,3,1,193,73,3,
+  1,98,3,1,193,34,2,1,176,2,1,198,5,1,2,195,186,42,0,3,192,23,195,186,
+  1,1,2,195,123,42,1,2,1,192,203,2,1,194,92,2,1,193,82,2,1,193,191,2,
+  1,193,20,2,1,193,47,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,1,56,
+  3,1,58,3,1,192,80,3,1,53,3,1,46,0,4,192,23,16,1,192,103,3,2,123,
+  112,4,1,193,73,4,1,98,4,1,193,34,0,7,193,120,27,192,89,183,195,116,188,192,
+  157,0,2,211,39,100,0,2,202,168,159,2,2,2,120,0,2,196,132,11,0,1,193,175,
+  0,2,202,169,100,0,2,192,19,193,121,1,2,14,115,2,1,85,2,1,78,0,3,192,
+  19,14,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,2,
+  51,193,121,1,2,196,133,211,40,2,1,211,41,1,3,199,123,194,208,42,1,2,0,20,
+  2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,0,3,192,19,0,193,2,2,
+  1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,232,2,1,
+  56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,2,1,192,102,2,
+  1,193,60,2,1,90,0,3,192,19,0,192,144,2,1,170,2,1,167,2,1,173,2,1,
+  192,95,2,1,192,251,2,1,192,145,2,1,53,2,1,150,2,1,192,195,2,1,154,2,
+  1,182,2,1,192,101,2,1,193,33,2,1,180,2,1,192,167,0,3,192,19,0,192,214,
+  2,1,193,12,2,1,46,2,1,192,103,2,1,192,194,2,2,123,112,3,1,98,3,1,
+  193,34,2,1,176,1,2,29,115,2,1,194,110,2,1,193,68,2,1,85,2,1,193,153,
+  2,1,78,2,1,133,0,3,192,19,29,193,41,2,1,49,2,1,128,2,1,193,77,2,
+  1,117,2,1,194,61,2,1,192,66,2,1,193,117,2,1,65,2,1,192,224,2,1,54,
+  1,2,1,192,203,2,1,194,92,2,1,193,82,2,1,193,20,2,1,193,47,0,4,192,
+  19,16,1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,58,3,1,192,80,3,
+  1,53,3,1,46,3,1,192,103,3,2,123,112,4,1,98,4,1,193,34,1,2,193,215,
+  193,171,0,1,211,42,0,1,202,170,0,3,194,117,193,251,193,204,0,2,194,117,193,204,
+  0,1,211,43,0,2,211,44,198,6,0,1,211,45,0,2,211,46,1,0,1,198,7,0,
+  2,211,47,199,124,0,1,211,48,0,2,211,49,1,0,2,202,171,198,8,0,2,55,198,
+  9,1,3,192,147,63,192,171,1,2,192,24,194,221,3,3,192,152,193,41,192,204,4,4,
+  54,134,193,77,192,204,2,1,196,134,0,6,55,192,24,196,134,192,152,193,41,192,204,2,
+  1,194,42,3,3,192,152,193,41,192,204,4,4,54,134,193,77,192,204,2,1,193,147,3,
+  3,192,152,199,125,192,204,4,2,193,41,192,204,4,4,49,134,199,126,192,204,4,4,65,
+  134,195,10,192,204,4,4,54,134,193,77,192,204,6,2,198,10,192,204,2,1,202,172,2,
+  1,202,173,2,1,202,174,2,1,194,222,3,3,192,152,193,41,192,204,0,8,55,192,24,
+  194,222,192,152,54,134,193,77,192,204,2,1,194,93,3,3,192,152,193,41,192,204,4,4,
+  54,134,193,77,192,204,2,1,194,223,3,3,192,152,193,41,192,204,4,4,54,134,193,77,
+  192,204,2,2,160,194,221,3,1,194,42,3,1,193,147,3,1,194,222,3,1,194,93,3,
+  1,194,223,1,1,120,2,2,40,202,175,2,3,2,116,27,0,6,55,120,2,54,63,140,
+  3,3,63,59,37,1,2,199,127,195,124,1,3,192,211,192,135,199,128,1,5,194,7,183,
+  24,108,27,4,2,91,27,2,4,108,24,183,27,4,2,187,27,2,4,91,24,183,27,4,
+  2,187,27,2,4,187,24,108,27,4,2,91,27,1,1,192,241,2,1,195,125,2,3,193,
+  252,63,192,57,2,2,192,135,192,211,0,3,55,192,241,195,124,2,3,2,116,27,1,4,
+  116,192,89,195,187,106,1,3,194,183,51,174,2,3,198,11,37,174,2,2,3,174,2,1,
+  174,1,3,183,193,205,192,97,1,2,198,12,194,42,2,1,193,233,1,1,202,176,1,1,
+  194,224,1,1,198,13,1,1,196,36,1,3,78,193,52,192,171,1,4,195,55,193,93,198,
+  14,197,56,0,2,55,193,118,2,1,195,124,1,1,199,129,1,2,172,198,15,1,1,198,
+  16,1,2,192,34,120,2,1,43,1,3,39,202,177,202,178,2,3,192,89,195,187,106,3,
+  1,106,1,3,194,8,51,174,4,3,2,83,119,2,3,198,11,37,174,2,1,197,36,2,
+  2,3,174,2,1,174,0,3,55,108,194,154,2,2,193,205,192,97,1,3,107,39,174,2,
+  2,37,174,1,1,194,184,1,2,185,192,241,2,2,194,183,174,4,1,195,125,2,2,194,
+  8,174,4,1,195,125,2,1,194,184,2,2,193,206,174,4,1,195,125,2,2,3,192,241,
+  3,1,194,184,3,1,43,0,3,55,185,43,2,2,194,64,174,4,1,195,125,1,2,193,
+  128,211,50,1,1,202,179,1,1,202,180,1,1,202,181,1,1,202,182,1,1,197,57,1,
+  1,199,130,1,3,193,127,42,192,150,1,1,195,126,1,4,37,192,89,195,187,106,3,1,
+  106,1,3,193,206,51,174,4,3,2,83,119,0,5,55,193,206,198,11,37,174,2,1,197,
+  57,2,1,197,36,2,2,3,174,2,1,174,3,4,2,51,83,119,1,2,91,27,2,1,
+  192,97,2,1,194,154,2,2,193,205,192,97,1,1,199,131,1,2,199,132,196,135,1,1,
+  196,135,1,2,198,17,195,188,1,3,199,133,24,202,183,1,3,198,18,3,120,0,4,55,
+  198,18,3,43,1,2,3,192,241,2,1,194,184,2,1,43,2,1,192,171,1,2,193,207,
+  104,1,1,199,134,1,2,202,184,195,124,1,1,43,2,1,196,136,2,1,195,125,2,2,
+  40,192,104,1,1,192,171,1,3,194,94,2,195,11,1,1,194,225,1,2,197,58,192,241,
+  0,3,55,197,58,194,184,2,1,43,1,2,202,185,194,225,1,1,199,135,1,4,202,186,
+  39,197,4,197,5,1,3,202,187,195,56,11,1,4,96,192,89,195,187,106,1,3,194,64,
+  51,174,2,3,198,11,37,174,2,2,3,174,2,1,174,1,3,113,39,174,2,2,37,174,
+  1,3,187,193,205,192,97,1,2,83,198,15,2,1,195,126,0,4,55,193,104,3,192,241,
+  3,1,194,184,3,1,43,0,4,196,137,188,192,157,27,1,2,91,27,1,3,192,50,192,
+  157,27,0,3,197,59,5,192,52,2,1,192,18,2,1,58,2,1,98,2,1,192,27,0,
+  2,202,188,11,0,2,114,211,51,1,1,211,52,1,1,211,53,1,1,211,54,0,2,114,
+  211,55,1,1,211,56,1,1,211,57,1,1,211,58,1,1,211,59,1,1,211,60,1,1,
+  211,61,1,1,211,62,1,1,211,63,1,1,211,64,1,1,211,65,1,1,211,66,1,1,
+  211,67,1,1,211,68,1,1,211,69,1,1,211,70,0,2,114,211,71,1,1,211,72,1,
+  1,211,73,1,1,211,74,1,1,211,75,1,1,211,76,1,1,211,77,1,1,211,78,1,
+  1,211,79,1,1,211,80,1,1,211,81,1,1,211,82,1,1,211,83,1,1,211,84,1,
+  1,211,85,1,1,211,86,0,2,114,211,87,1,1,211,88,1,1,211,89,1,1,211,90,
+  1,1,211,91,1,1,211,92,1,1,211,93,1,1,211,94,1,1,211,95,1,1,211,96,
+  1,1,211,97,1,1,211,98,1,1,211,99,1,1,211,100,1,1,211,101,1,1,211,102,
+  0,2,114,211,103,1,1,211,104,1,1,211,105,1,1,211,106,1,1,211,107,1,1,211,
+  108,1,1,211,109,1,1,211,110,0,1,202,189,0,1,211,111,0,2,195,189,196,138,1,
+  1,193,118,0,1,211,112,0,1,202,190,0,4,25,115,194,43,192,245,1,3,85,194,43,
+  192,245,0,3,25,33,192,211,1,1,195,12,1,3,117,194,43,192,245,1,2,63,120,2,
+  1,43,0,1,211,113,0,1,198,19,0,1,196,138,0,1,202,191,1,1,211,114,0,1,
+  211,115,0,1,202,192,0,4,192,99,50,0,192,2,3,1,192,18,3,1,192,6,3,1,
+  192,58,0,4,192,99,50,0,192,5,1,2,0,20,2,1,194,226,2,1,192,74,2,1,
+  211,116,2,1,195,44,2,1,193,53,2,1,194,185,2,1,211,117,2,1,192,98,2,1,
+  211,118,2,1,62,2,1,193,176,2,1,192,52,2,1,202,193,2,1,192,20,0,3,192,
+  99,0,56,2,1,193,13,2,1,195,49,2,1,195,127,2,1,192,188,2,1,194,227,2,
+  1,199,136,2,1,194,118,2,1,192,113,2,1,192,2,2,1,211,119,2,1,211,120,2,
+  1,194,65,2,1,211,121,2,1,192,18,2,1,58,0,3,192,99,0,199,137,2,1,194,
+  119,2,1,211,122,2,1,211,123,2,1,197,60,2,1,197,61,2,1,192,83,2,1,195,
+  190,2,1,192,6,2,1,199,138,2,1,112,2,1,199,139,2,1,178,2,1,152,2,1,
+  194,3,2,1,211,124,0,3,192,99,0,197,62,2,1,53,3,3,2,59,38,2,1,193,
+  4,2,1,194,186,2,1,202,194,2,1,202,195,2,1,192,233,2,1,195,191,2,1,192,
+  58,2,1,192,175,2,1,98,2,1,99,2,1,196,37,2,1,192,5,2,1,46,0,3,
+  192,99,0,202,196,2,1,192,9,2,1,192,57,2,1,192,27,2,1,211,125,2,1,195,
+  13,2,1,202,197,0,4,197,231,2,211,126,211,127,0,4,193,51,194,4,193,247,27,1,
+  2,193,61,130,1,3,110,55,120,2,1,193,193,2,2,39,192,247,2,2,37,192,247,1,
+  2,39,193,56,2,1,198,20,0,4,193,51,39,110,130,1,1,192,247,1,2,37,193,56,
+  2,1,198,20,2,2,110,130,1,2,43,130,3,4,145,192,240,43,130,1,3,193,177,193,
+  93,130,0,1,202,198,1,2,74,211,128,0,3,196,139,24,27,0,3,199,140,74,211,129,
+  1,2,2,199,141,0,1,211,130,0,1,198,9,1,4,2,39,110,55,0,5,198,9,2,
+  37,110,55,0,6,100,126,51,116,24,172,5,1,39,5,1,37,3,1,172,3,3,96,24,
+  172,5,1,39,5,1,37,3,1,83,4,2,24,172,5,1,39,5,1,37,2,5,116,51,
+  24,172,192,76,5,2,39,192,76,5,2,37,192,76,3,4,75,24,172,122,0,7,100,126,
+  116,75,24,39,122,6,2,96,122,5,2,37,122,6,2,96,122,5,3,96,172,122,3,4,
+  122,24,172,75,5,2,39,75,6,2,96,75,5,2,37,75,6,2,96,75,5,3,96,172,
+  75,3,4,192,76,24,172,51,5,2,39,51,5,2,37,51,2,4,75,51,193,21,172,5,
+  1,83,0,4,100,126,75,116,4,2,24,172,5,1,39,5,1,37,3,1,172,3,1,39,
+  4,3,24,122,37,3,3,195,14,193,21,172,5,1,83,3,1,37,3,3,192,174,193,21,
+  172,5,1,83,3,1,96,4,2,24,172,5,1,39,5,2,122,116,0,6,100,126,75,96,
+  24,37,3,1,83,4,2,24,172,5,1,39,5,1,37,2,7,39,116,75,24,37,96,122,
+  3,5,75,24,37,116,122,6,2,96,122,6,2,83,122,3,5,122,24,37,116,75,6,2,
+  96,75,6,2,83,75,3,6,96,75,24,37,116,122,2,5,122,194,4,116,24,39,6,1,
+  37,4,3,96,24,39,0,7,100,126,122,194,4,96,24,37,3,2,189,192,211,4,1,192,
+  241,4,5,76,39,66,107,192,147,9,3,66,76,37,7,5,113,192,147,66,76,37,12,3,
+  66,107,192,147,5,4,37,66,107,192,147,7,8,113,192,147,66,76,39,66,107,192,147,4,
+  5,113,192,147,66,76,39,9,6,24,76,37,66,107,192,147,9,3,66,107,192,147,12,3,
+  66,76,37,8,1,37,9,6,24,76,39,66,107,192,147,9,3,66,107,192,147,0,15,100,
+  126,122,189,113,192,147,66,76,37,66,107,192,147,66,76,39,5,4,39,66,107,37,5,4,
+  37,66,107,39,3,3,51,193,21,172,5,1,83,3,1,116,4,2,24,172,5,1,39,5,
+  1,37,3,1,172,4,3,2,83,71,3,1,39,4,3,24,75,37,3,3,195,14,193,21,
+  172,5,1,83,3,1,37,0,6,100,126,122,192,174,193,21,172,5,1,83,3,1,96,4,
+  3,24,75,116,5,1,172,5,1,39,5,1,37,3,1,83,4,2,24,172,5,1,39,5,
+  1,37,2,7,37,116,75,24,39,96,122,3,5,75,24,39,116,122,6,2,96,122,6,2,
+  83,122,3,5,122,24,39,116,75,0,8,100,126,37,122,24,39,96,75,6,2,83,75,3,
+  6,96,75,24,39,116,122,2,5,96,51,24,172,192,76,5,2,39,192,76,5,2,37,192,
+  76,3,5,75,24,116,172,122,5,2,172,122,5,3,39,116,122,6,1,122,5,3,37,116,
+  122,6,1,122,3,5,122,24,116,172,75,5,2,172,75,5,3,39,116,75,6,1,75,0,
+  8,100,126,96,122,24,37,116,75,6,1,75,3,4,192,76,24,172,51,5,2,39,51,5,
+  2,37,51,2,5,83,51,24,172,192,76,5,2,39,192,76,5,2,37,192,76,3,4,75,
+  24,172,122,5,2,39,122,5,2,37,122,3,4,122,24,172,75,5,2,39,75,5,2,37,
+  75,3,4,192,76,24,172,51,5,2,39,51,0,7,100,126,83,192,76,24,37,51,0,2,
+  211,131,211,132,0,1,211,133,0,2,211,134,11,0,2,168,193,121,1,2,14,115,2,1,
+  85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,
+  192,33,1,2,51,193,121,0,3,168,0,20,2,1,192,45,2,1,192,74,2,1,192,98,
+  2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,
+  1,193,25,2,1,192,232,2,1,56,2,1,192,3,2,1,192,239,2,1,129,0,3,168,
+  0,58,2,1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,
+  2,1,193,154,2,1,167,2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,2,1,
+  53,2,3,36,143,193,154,4,1,196,140,0,5,168,0,36,143,197,63,4,1,194,6,4,
+  2,192,114,56,5,1,53,2,1,150,2,1,192,195,2,1,154,2,1,182,2,1,192,101,
+  2,1,193,33,2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,
+  192,103,0,3,168,0,192,194,2,2,123,112,3,1,193,73,3,1,98,3,1,193,34,2,
+  1,176,1,2,29,115,2,1,194,110,2,1,193,68,2,1,85,2,1,193,153,2,1,78,
+  2,1,196,38,2,1,133,2,1,193,41,2,1,49,0,4,168,29,49,134,3,1,169,2,
+  1,128,2,1,193,77,2,1,117,2,1,194,61,2,1,192,66,2,1,193,117,2,1,65,
+  2,1,192,224,2,1,54,1,3,192,4,196,141,119,2,1,59,2,2,51,59,2,1,192,
+  124,2,1,198,21,0,3,168,1,192,203,2,1,193,82,2,1,196,142,2,3,36,143,193,
+  20,2,1,196,143,2,1,193,47,1,1,193,20,1,3,16,1,192,45,3,1,192,74,3,
+  1,192,98,3,2,211,135,192,45,3,1,56,3,1,58,3,1,192,80,3,1,53,3,4,
+  36,143,192,114,56,0,7,168,16,1,36,143,192,114,53,3,1,46,3,1,192,103,3,2,
+  123,112,4,1,193,73,4,1,98,4,1,193,34,0,3,69,68,202,188,2,1,211,136,2,
+  1,211,137,2,1,211,138,2,1,211,139,2,1,211,140,2,1,211,141,2,1,211,142,2,
+  1,211,143,0,3,69,68,211,144,2,1,211,145,2,1,211,146,2,1,211,147,2,1,211,
+  148,2,1,211,149,2,1,211,150,2,1,211,151,2,1,211,152,2,1,211,153,2,1,211,
+  154,2,1,211,155,2,1,211,156,2,1,211,157,2,1,211,158,2,1,211,159,0,3,69,
+  68,211,160,2,1,211,161,2,1,211,162,2,1,211,163,2,1,211,164,2,1,211,165,2,
+  1,211,166,2,1,211,167,2,1,211,168,2,1,211,169,2,1,211,170,2,1,211,171,2,
+  1,211,172,2,1,211,173,2,1,211,174,2,1,211,175,0,3,69,68,211,176,2,1,211,
+  177,2,1,211,178,2,1,211,179,2,1,211,180,2,1,211,181,2,1,211,182,2,1,211,
+  183,2,1,211,184,2,1,211,185,2,1,211,186,2,1,211,187,2,1,211,188,2,1,211,
+  189,2,1,211,190,2,1,211,191,0,3,69,68,211,192,2,1,211,193,2,1,211,194,2,
+  1,211,195,2,1,211,196,2,1,211,197,2,1,211,198,2,1,211,199,2,1,211,200,2,
+  1,211,201,2,1,211,202,2,1,211,203,2,1,211,204,2,1,211,205,2,1,211,206,2,
+  1,211,207,0,3,69,68,211,208,2,1,211,209,2,1,211,210,2,1,211,211,2,1,211,
+  212,2,1,211,213,2,1,211,214,2,1,211,215,2,1,211,216,2,1,211,217,2,1,211,
+  218,2,1,211,219,2,1,211,220,2,1,211,221,2,1,211,222,2,1,211,223,0,3,69,
+  68,211,224,2,1,211,225,2,1,211,226,2,1,211,227,2,1,211,228,2,1,211,229,2,
+  1,211,230,2,1,211,231,2,1,211,232,2,1,211,233,2,1,211,234,2,1,211,235,2,
+  1,211,236,2,1,211,237,2,1,211,238,2,1,211,239,0,3,69,68,211,240,2,1,211,
+  241,2,1,211,242,2,1,211,243,2,1,211,244,2,1,211,245,2,1,211,246,2,1,211,
+  247,2,1,211,248,2,1,211,249,2,1,211,250,2,1,211,251,2,1,211,252,2,1,211,
+  253,2,1,211,254,2,1,211,255,0,3,69,68,212,0,2,1,212,1,2,1,212,2,2,
+  1,212,3,2,1,212,4,2,1,212,5,2,1,212,6,2,1,212,7,2,1,212,8,2,
+  1,212,9,2,1,212,10,2,1,212,11,2,1,212,12,2,1,212,13,2,1,212,14,2,
+  1,212,15,0,3,69,68,212,16,2,1,212,17,2,1,212,18,2,1,212,19,2,1,212,
+  20,2,1,212,21,2,1,212,22,2,1,212,23,2,1,212,24,2,1,212,25,2,1,212,
+  26,2,1,212,27,2,1,212,28,2,1,212,29,2,1,212,30,2,1,212,31,0,3,69,
+  68,212,32,2,1,212,33,2,1,212,34,2,1,212,35,2,1,212,36,2,1,212,37,2,
+  1,212,38,2,1,212,39,2,1,212,40,2,1,212,41,2,1,212,42,2,1,212,43,2,
+  1,212,44,2,1,212,45,2,1,212,46,2,1,212,47,0,3,69,68,212,48,2,1,212,
+  49,2,1,212,50,2,1,212,51,2,1,212,52,2,1,212,53,2,1,212,54,2,1,212,
+  55,2,1,212,56,2,1,212,57,2,1,212,58,2,1,212,59,2,1,212,60,2,1,212,
+  61,2,1,212,62,2,1,212,63,0,3,69,68,212,64,2,1,212,65,2,1,212,66,2,
+  1,212,67,2,1,212,68,2,1,212,69,2,1,212,70,2,1,212,71,2,1,212,72,2,
+  1,212,73,2,1,212,74,2,1,212,75,2,1,212,76,2,1,212,77,2,1,212,78,2,
+  1,212,79,0,3,69,68,212,80,2,1,212,81,2,1,212,82,2,1,212,83,2,1,212,
+  84,2,1,212,85,2,1,212,86,2,1,212,87,2,1,212,88,2,1,212,89,2,1,212,
+  90,2,1,212,91,2,1,212,92,2,1,212,93,2,1,212,94,2,1,212,95,0,3,69,
+  68,212,96,2,1,212,97,2,1,212,98,2,1,212,99,2,1,212,100,2,1,212,101,2,
+  1,212,102,2,1,212,103,2,1,212,104,2,1,212,105,2,1,212,106,2,1,212,107,2,
+  1,212,108,2,1,212,109,2,1,212,110,2,1,212,111,0,3,69,68,212,112,2,1,212,
+  113,2,1,212,114,2,1,212,115,2,1,212,116,2,1,212,117,2,1,212,118,2,1,212,
+  119,2,1,212,120,2,1,212,121,2,1,212,122,2,1,212,123,2,1,212,124,2,1,212,
+  125,2,1,212,126,2,1,212,127,0,3,69,68,212,128,2,1,212,129,2,1,212,130,2,
+  1,212,131,2,1,212,132,2,1,212,133,2,1,212,134,0,1,212,135,0,1,202,65,0,
+  1,212,136,0,1,192,182,0,1,199,38,0,3,212,137,2,212,138,0,3,196,144,193,160,
+  197,214,0,1,212,139,0,1,212,140,0,1,212,141,0,2,196,145,119,1,4,120,2,212,
+  142,27,1,1,193,118,0,1,212,143,0,2,199,142,193,118,0,2,195,128,212,144,0,1,
+  199,143,0,1,212,145,0,1,212,146,0,4,193,122,193,103,74,193,42,1,2,0,20,2,
+  1,192,32,2,1,192,107,2,1,191,2,1,192,3,0,3,193,122,0,129,2,1,192,102,
+  2,1,90,2,1,170,2,1,167,2,1,202,199,2,1,173,2,1,192,95,2,1,202,143,
+  2,1,199,144,2,1,192,145,2,1,212,147,2,1,150,2,1,154,2,1,182,2,1,180,
+  0,3,193,122,0,192,194,2,1,176,1,1,212,148,1,3,16,1,193,85,3,1,56,3,
+  1,58,3,1,53,3,1,46,0,3,194,9,0,20,2,1,192,32,2,1,191,2,1,192,
+  3,2,1,129,2,1,58,2,1,90,2,1,170,0,3,194,9,0,167,2,1,173,2,1,
+  192,95,2,1,150,2,1,154,2,1,182,2,1,180,2,1,46,2,1,192,109,2,1,176,
+  1,3,16,1,58,3,1,46,0,2,197,64,199,145,0,1,194,154,1,1,192,242,0,1,
+  202,200,0,4,202,200,2,194,66,199,146,0,1,212,149,0,1,212,150,0,1,199,147,1,
+  1,192,104,0,3,212,151,192,158,198,22,0,3,212,152,192,158,198,22,0,1,212,153,0,
+  1,212,154,0,5,70,35,11,195,192,202,201,4,1,212,155,4,1,202,202,4,1,212,156,
+  4,1,212,157,4,1,212,158,4,2,202,203,202,201,0,6,70,35,11,195,192,202,203,202,
+  202,3,1,212,159,3,1,212,160,3,1,212,161,3,2,202,204,198,23,4,2,199,148,193,
+  161,3,1,197,65,3,2,202,205,194,23,4,1,193,161,3,3,202,206,212,162,193,161,4,
+  2,202,207,202,208,3,1,199,149,4,1,196,39,4,1,193,161,3,1,212,163,3,1,212,
+  164,0,4,70,35,11,202,209,3,2,196,40,194,24,4,1,192,3,4,1,193,250,4,1,
+  193,72,4,1,150,4,1,202,210,4,1,194,220,3,1,212,165,3,1,212,166,3,2,202,
+  211,194,23,4,1,193,161,3,2,199,150,212,167,4,1,212,168,4,1,212,169,3,1,212,
+  170,0,4,70,35,11,212,171,3,3,198,24,197,65,212,172,5,1,212,173,4,1,196,39,
+  4,1,197,66,3,4,196,41,197,65,198,25,195,193,4,3,202,212,198,26,195,193,4,3,
+  202,213,199,151,195,193,4,1,202,214,4,3,202,215,202,216,195,193,4,1,202,217,3,2,
+  212,174,195,191,3,1,198,27,4,3,197,67,199,152,195,194,6,1,196,42,5,1,202,218,
+  0,5,70,35,11,212,175,212,176,3,1,196,39,4,1,194,23,3,1,198,25,3,1,212,
+  177,3,1,212,178,3,4,212,179,196,146,194,44,202,210,3,1,212,180,3,1,212,181,3,
+  2,202,219,202,209,4,1,199,153,3,2,199,148,198,23,3,2,199,154,202,220,4,1,202,
+  221,4,1,212,182,3,4,212,183,199,155,198,28,212,184,0,5,70,35,11,194,44,194,23,
+  5,2,212,185,212,186,4,2,196,43,194,24,5,1,193,250,5,1,202,222,5,2,193,72,
+  195,194,6,1,196,42,5,1,150,5,1,194,220,4,2,212,187,212,188,4,3,58,196,44,
+  202,214,4,3,202,223,198,28,202,220,6,1,202,221,4,2,212,189,194,187,4,1,212,190,
+  4,3,199,155,198,28,212,191,0,7,70,35,11,194,44,199,155,212,192,194,24,3,2,202,
+  224,196,41,4,1,196,44,3,2,197,68,194,23,4,2,193,161,195,194,5,1,196,42,4,
+  2,197,67,199,152,5,1,202,218,3,1,212,193,3,3,202,225,152,202,226,5,1,212,194,
+  3,1,212,195,3,1,212,196,3,1,212,197,3,1,212,198,3,1,212,199,0,4,70,35,
+  11,212,200,3,3,212,201,202,207,202,208,3,2,199,156,194,23,4,1,193,161,3,2,212,
+  202,198,29,3,1,212,203,3,1,212,204,3,2,198,30,194,23,4,2,193,161,195,194,5,
+  1,196,42,5,1,202,227,3,1,197,69,4,1,194,23,4,2,193,161,195,194,5,1,196,
+  42,5,1,202,227,0,4,70,35,11,198,31,4,1,195,194,4,1,196,42,3,1,202,228,
+  4,1,199,157,3,1,199,158,3,1,212,205,3,2,199,159,199,157,4,1,194,23,4,1,
+  193,161,3,1,212,206,3,1,212,207,3,1,212,208,3,1,212,209,3,1,212,210,3,3,
+  196,147,198,25,199,160,0,6,70,35,11,196,147,212,211,202,229,4,2,212,212,202,229,4,
+  2,212,213,199,160,4,2,212,214,199,160,3,1,212,215,3,1,212,216,3,4,194,188,202,
+  230,202,231,194,187,5,2,202,232,194,187,4,2,202,231,194,187,4,2,202,233,194,187,4,
+  2,202,234,194,187,5,2,199,161,194,187,4,2,202,232,194,187,4,2,212,217,194,187,4,
+  2,199,161,194,187,5,2,202,233,194,187,0,5,70,35,11,194,188,212,218,4,2,212,219,
+  194,187,4,2,212,220,194,187,3,2,212,221,199,156,3,1,202,222,3,2,202,235,194,23,
+  4,1,193,161,3,1,212,222,3,2,199,162,196,39,4,1,198,23,4,1,193,161,3,2,
+  212,223,194,23,3,2,202,236,194,23,4,1,193,161,3,2,199,153,194,23,4,1,193,161,
+  0,4,70,35,11,199,163,4,1,194,23,4,1,193,161,3,1,212,224,3,1,202,237,4,
+  1,193,161,3,1,192,243,3,1,212,225,3,1,212,226,3,1,212,227,3,2,202,238,194,
+  23,4,1,193,161,3,1,212,228,3,1,202,239,4,1,193,161,3,1,212,229,0,4,70,
+  35,11,212,230,3,1,192,84,3,1,212,231,3,1,212,232,3,1,212,233,3,1,212,234,
+  3,1,202,240,4,1,193,161,3,2,195,195,198,32,5,1,202,241,5,1,202,242,5,1,
+  202,243,4,1,197,66,5,1,202,241,5,1,202,242,5,1,202,243,0,4,70,35,11,202,
+  244,4,1,212,235,3,1,199,164,3,1,212,236,3,2,199,165,194,23,4,2,212,237,212,
+  238,4,1,193,161,3,1,212,239,3,1,212,240,3,1,212,241,3,1,202,245,3,1,199,
+  151,3,1,212,242,3,1,202,246,4,1,202,226,3,2,202,247,212,243,0,5,70,35,11,
+  202,247,199,148,3,3,212,244,196,146,212,245,3,1,212,246,3,1,212,247,3,1,212,248,
+  3,1,212,249,3,1,212,250,3,1,212,251,3,2,198,29,199,157,4,1,194,23,4,1,
+  193,161,3,1,212,252,3,1,212,253,3,1,212,254,3,2,199,166,196,39,4,1,198,23,
+  0,5,70,35,11,199,166,193,161,3,2,212,255,194,23,3,1,213,0,3,2,213,1,198,
+  31,3,2,202,248,195,194,4,1,196,42,3,4,196,44,197,65,198,25,195,193,4,3,202,
+  212,198,26,195,193,4,3,202,213,199,151,195,193,4,3,202,215,202,216,195,193,4,1,202,
+  217,3,1,202,249,4,1,196,39,3,1,213,2,3,1,213,3,0,1,213,4,0,2,213,
+  5,213,6,0,1,201,101,0,1,199,167,0,3,199,109,193,80,193,105,0,1,198,33,1,
+  2,2,213,7,0,1,213,8,0,3,18,19,20,2,1,192,45,2,1,202,250,2,1,202,
+  251,2,1,192,74,2,2,213,9,62,2,1,193,53,2,2,202,252,178,3,1,99,0,3,
+  18,19,194,228,2,3,199,121,199,168,112,4,1,98,2,2,213,10,192,35,2,2,194,45,
+  20,3,1,56,3,1,58,3,1,90,3,1,193,250,3,1,193,203,3,1,193,196,3,1,
+  173,3,1,193,71,3,1,193,72,3,1,193,28,3,1,53,0,4,18,19,194,45,99,3,
+  1,192,77,3,1,192,109,3,1,193,178,3,1,193,234,3,1,193,208,2,1,192,52,2,
+  1,192,107,2,1,199,169,2,1,213,11,2,2,95,192,142,3,1,193,209,3,1,198,34,
+  3,1,193,169,3,1,195,15,3,1,198,35,0,4,18,19,95,196,148,3,2,199,168,197,
+  70,3,2,199,170,99,3,1,194,24,3,1,198,36,3,1,213,12,3,1,213,13,3,1,
+  213,14,3,1,213,15,3,1,213,16,3,1,194,189,3,1,195,196,3,1,202,253,3,1,
+  202,254,3,1,202,255,3,1,203,0,0,4,18,19,95,193,13,3,1,192,3,3,1,197,
+  71,3,1,195,51,3,1,197,70,3,1,192,239,3,1,194,38,3,1,213,17,3,1,213,
+  18,3,1,203,1,3,1,213,19,3,1,193,210,3,1,194,155,3,1,194,65,3,1,203,
+  2,3,1,213,20,0,4,18,19,95,192,18,3,1,198,37,3,1,193,57,3,1,213,21,
+  3,1,199,171,3,1,213,22,3,1,213,23,3,1,213,24,3,1,213,25,3,1,58,3,
+  2,86,192,27,3,1,192,102,3,1,194,214,3,1,196,149,3,1,195,190,3,1,197,72,
+  0,4,18,19,95,213,26,3,1,213,27,3,1,203,3,3,1,203,4,3,1,203,5,3,
+  1,195,8,3,1,196,45,3,1,203,6,3,1,192,144,3,1,199,172,3,1,213,28,3,
+  1,198,38,3,1,194,229,3,1,213,29,3,1,198,39,3,1,199,173,0,4,18,19,95,
+  213,30,3,1,213,31,3,1,213,32,3,1,213,33,3,1,213,34,3,1,170,3,1,192,
+  226,3,1,198,40,3,1,195,197,3,1,213,35,3,1,213,36,3,1,203,7,3,1,203,
+  8,3,1,213,37,3,1,192,149,3,1,194,10,0,4,18,19,95,193,174,3,1,167,3,
+  1,193,80,3,1,199,174,3,1,193,119,3,1,193,231,3,1,193,31,3,1,173,3,1,
+  193,71,3,1,199,175,3,1,194,3,3,1,193,72,3,1,193,28,3,1,193,92,3,1,
+  192,58,3,1,150,0,4,18,19,95,192,238,3,1,195,120,3,1,192,210,3,1,194,41,
+  3,1,194,181,3,1,154,3,1,194,39,3,1,197,51,3,1,194,86,3,1,193,179,3,
+  1,193,217,3,1,182,3,1,193,228,3,1,196,29,3,1,196,37,3,1,192,101,0,4,
+  18,19,95,192,246,3,1,197,250,3,1,196,150,3,1,195,7,3,1,194,115,3,1,193,
+  218,3,1,193,180,3,1,193,235,3,1,192,167,3,1,193,1,3,1,197,73,3,1,196,
+  46,3,1,193,253,3,1,199,176,3,1,199,177,3,1,199,178,0,4,18,19,95,213,38,
+  3,1,199,179,3,1,203,9,3,1,213,39,3,1,203,10,3,1,203,11,3,1,213,40,
+  3,1,199,180,3,1,199,181,3,1,199,182,3,1,193,123,3,1,194,156,3,1,203,12,
+  3,1,196,47,3,1,198,41,3,1,198,42,0,4,18,19,95,192,214,3,1,197,38,3,
+  1,213,41,3,1,203,13,3,1,199,183,3,1,213,42,3,1,213,43,3,1,213,44,3,
+  1,213,45,3,1,213,46,3,1,213,47,3,1,213,48,3,1,192,109,3,1,193,178,3,
+  1,198,43,3,1,193,234,0,4,18,19,95,193,208,3,1,195,16,3,1,176,3,1,194,
+  91,3,1,196,151,3,1,9,3,1,193,94,3,1,193,27,3,1,192,27,3,1,192,221,
+  3,1,193,229,3,1,197,74,3,1,195,13,3,1,194,220,3,1,194,230,2,1,195,117,
+  0,4,18,19,193,169,1,2,1,198,44,2,1,213,49,2,1,194,211,2,1,199,184,2,
+  1,199,185,2,1,199,186,2,1,203,14,2,1,199,187,2,1,203,15,2,1,203,16,2,
+  1,203,17,2,1,56,2,2,198,45,192,77,2,1,192,188,2,1,192,113,0,3,18,19,
+  193,18,2,1,197,247,2,1,213,50,2,1,194,213,2,1,195,17,2,1,213,51,2,2,
+  50,192,31,3,3,193,51,110,159,3,2,51,192,31,4,3,192,114,83,199,188,3,2,116,
+  193,69,3,1,192,127,3,2,76,59,3,1,97,3,2,193,79,59,3,3,37,110,159,0,
+  4,18,19,50,159,3,3,192,114,172,71,3,2,3,159,3,3,192,240,110,159,2,1,195,
+  18,2,1,199,189,2,2,192,209,192,104,2,1,203,18,2,2,193,74,192,104,2,1,213,
+  52,2,1,194,212,2,1,58,2,1,192,80,2,1,192,158,2,1,192,6,2,1,90,0,
+  3,18,19,197,246,2,1,213,53,2,1,199,190,2,1,193,250,2,1,193,203,2,1,213,
+  54,2,1,193,196,2,1,197,75,2,1,199,138,2,1,199,191,2,1,198,46,2,1,213,
+  55,2,1,198,47,2,1,198,48,2,1,203,19,2,1,203,20,0,3,18,19,203,21,2,
+  1,112,2,1,170,2,1,197,76,2,1,213,56,2,1,213,57,2,1,192,226,2,1,199,
+  139,2,1,195,197,2,1,203,22,2,1,203,7,2,1,213,58,2,1,203,8,2,1,213,
+  59,2,1,192,149,2,1,213,60,0,3,18,19,194,10,2,1,196,152,2,1,199,192,2,
+  1,203,23,2,1,203,24,2,1,203,25,2,1,203,26,2,1,203,27,2,1,203,28,2,
+  1,178,2,1,167,2,1,199,193,2,1,213,61,2,1,203,29,2,1,193,80,2,2,192,
+  12,112,0,4,18,19,192,12,98,2,1,213,62,2,1,193,119,2,1,213,63,2,1,193,
+  231,2,1,199,194,2,2,213,64,213,65,2,1,198,49,2,1,199,195,2,1,199,196,2,
+  1,198,50,2,1,203,30,2,1,203,31,2,1,203,32,2,1,152,2,2,199,197,193,1,
+  0,4,18,19,199,197,196,46,3,1,199,198,2,1,173,2,1,196,121,2,1,213,66,2,
+  2,194,120,199,186,3,1,198,46,3,1,199,195,3,1,199,199,3,1,213,67,3,1,213,
+  68,3,1,213,69,3,1,213,70,3,1,213,71,3,1,213,72,3,1,199,200,0,4,18,
+  19,194,120,199,201,3,1,197,77,3,1,197,78,3,1,199,202,2,2,194,231,129,3,1,
+  195,19,3,1,193,57,3,1,203,33,3,1,193,158,3,1,197,79,3,1,213,73,3,1,
+  213,74,3,1,203,34,3,1,213,75,3,1,213,76,3,1,213,77,0,3,18,19,213,78,
+  2,1,193,71,2,1,194,3,2,1,192,95,2,1,198,51,2,1,213,79,2,1,213,80,
+  2,1,198,52,2,1,213,81,2,1,196,48,2,1,213,82,2,1,213,83,2,1,193,72,
+  2,1,203,35,2,1,213,84,2,1,213,85,0,3,18,19,213,86,2,1,213,87,2,1,
+  213,88,2,1,213,89,2,1,213,90,2,1,193,28,2,1,199,203,2,1,213,91,2,2,
+  195,198,192,18,3,1,129,3,1,195,19,3,1,193,19,3,1,193,57,3,1,203,33,3,
+  1,193,158,3,1,197,79,0,4,18,19,213,92,192,18,2,1,198,53,2,1,199,199,2,
+  1,203,36,2,1,203,37,2,1,203,38,2,1,203,39,2,1,203,40,2,1,53,2,2,
+  194,232,192,52,3,1,192,6,3,1,178,3,1,152,3,1,203,37,3,1,203,38,3,1,
+  203,39,0,4,18,19,194,232,203,40,3,1,192,58,3,1,99,3,1,196,37,3,1,192,
+  5,2,1,192,135,2,1,192,233,2,1,199,204,2,1,192,58,2,1,150,2,1,197,253,
+  2,1,213,93,2,1,213,94,2,1,192,238,2,1,192,210,2,1,197,80,0,3,18,19,
+  194,41,2,1,197,81,2,1,213,95,2,1,197,82,2,1,199,205,2,1,199,206,2,1,
+  198,54,2,1,203,41,2,1,194,157,2,1,203,42,2,1,213,96,2,1,192,175,2,1,
+  194,11,2,1,199,207,2,1,213,97,2,1,203,43,0,3,18,19,197,83,2,1,203,44,
+  2,1,198,55,2,1,199,208,2,1,98,2,2,203,45,194,39,3,1,213,98,2,1,154,
+  2,1,197,84,2,1,213,99,2,1,202,39,2,1,194,39,2,1,194,86,2,1,197,249,
+  2,1,193,179,2,1,203,46,0,3,18,19,203,47,2,1,203,48,2,1,213,100,2,1,
+  213,101,2,1,213,102,2,1,213,103,2,1,213,104,2,1,99,2,1,182,2,1,197,254,
+  2,1,213,105,2,1,203,49,2,2,194,67,129,3,1,193,19,3,1,193,57,3,1,193,
+  158,0,4,18,19,194,67,197,79,3,1,195,190,3,1,196,45,3,1,213,106,3,1,178,
+  3,1,192,101,3,1,192,246,3,1,196,150,3,1,195,7,3,1,199,209,3,1,196,49,
+  3,1,195,199,3,1,9,2,1,193,228,2,1,196,37,2,1,192,101,0,3,18,19,203,
+  50,2,1,213,107,2,1,192,246,2,1,196,150,2,1,197,251,2,1,195,7,2,1,199,
+  209,2,1,203,51,2,1,199,210,2,1,203,52,2,1,196,49,2,1,203,53,2,1,203,
+  54,2,1,203,55,2,1,203,56,2,1,213,108,0,3,18,19,193,218,2,1,197,85,2,
+  1,193,180,2,1,197,86,2,2,198,56,203,57,3,1,199,61,3,1,213,109,3,1,213,
+  110,2,1,213,111,2,1,213,112,2,1,213,113,2,1,213,114,2,1,213,115,2,1,203,
+  58,2,1,199,211,2,1,199,200,0,3,18,19,203,59,2,1,203,60,2,1,203,61,2,
+  1,203,62,2,1,203,63,2,1,192,5,2,1,180,2,1,196,30,2,1,213,116,2,1,
+  213,117,2,1,193,54,2,1,195,199,2,2,195,200,195,199,3,1,192,167,3,1,197,87,
+  3,1,193,1,0,4,18,19,195,200,196,46,3,1,199,198,3,1,193,253,3,1,199,212,
+  2,1,192,167,2,1,197,87,2,1,193,1,2,1,196,46,2,1,199,198,2,1,193,253,
+  2,1,199,212,2,1,199,213,2,1,199,214,2,1,213,118,2,1,194,22,2,1,213,119,
+  0,3,18,19,199,179,2,1,203,9,2,1,203,10,2,1,203,11,2,1,213,120,2,1,
+  213,121,2,1,66,2,1,196,128,2,1,192,214,2,1,197,38,2,1,213,122,2,1,193,
+  12,2,1,199,215,2,1,203,64,2,1,203,65,2,1,198,57,0,3,18,19,213,123,2,
+  1,213,124,2,1,203,13,2,1,199,183,2,1,199,216,2,1,199,201,2,1,197,88,2,
+  1,203,66,2,1,203,67,2,1,54,2,1,203,68,2,1,213,125,2,1,213,126,2,1,
+  213,127,2,1,213,128,2,1,192,109,0,3,18,19,197,77,2,1,197,4,2,1,193,178,
+  2,2,192,41,199,185,3,1,199,186,3,1,203,14,3,1,199,187,3,1,203,15,3,1,
+  203,16,3,1,203,17,3,1,203,18,3,1,199,191,3,1,198,46,3,1,198,47,3,1,
+  198,48,3,1,203,19,0,4,18,19,192,41,203,20,3,1,203,21,3,1,112,3,1,170,
+  3,1,197,76,3,1,192,226,3,1,194,10,3,1,196,152,3,1,199,192,3,1,203,23,
+  3,1,203,24,3,1,203,25,3,1,203,26,3,1,203,27,3,1,203,28,3,1,178,0,
+  4,18,19,192,41,198,49,3,1,199,195,3,1,199,196,3,1,198,50,3,1,203,30,3,
+  1,203,31,3,1,203,32,3,1,198,53,3,1,199,199,3,1,203,36,3,1,192,58,3,
+  1,197,82,3,1,199,205,3,1,199,206,3,1,198,54,3,1,203,41,0,4,18,19,192,
+  41,194,157,3,1,203,42,3,1,98,3,1,154,3,1,194,39,3,1,194,86,3,1,193,
+  179,3,1,203,48,3,1,199,210,3,1,203,52,3,1,196,49,3,1,203,53,3,1,203,
+  54,3,1,203,55,3,1,203,56,3,1,199,211,0,4,18,19,192,41,199,200,3,1,203,
+  59,3,1,203,60,3,1,203,61,3,1,203,62,3,1,203,63,3,1,199,214,3,1,199,
+  216,3,1,199,201,3,1,197,88,3,1,203,66,3,1,203,67,3,1,54,3,1,203,68,
+  3,1,192,109,3,1,197,77,0,4,18,19,192,41,193,178,3,1,193,234,3,1,203,69,
+  3,1,193,208,3,1,197,78,3,1,192,35,3,1,199,217,3,1,199,202,3,1,203,70,
+  3,1,203,71,3,1,203,72,3,1,203,73,3,1,203,74,2,2,195,57,192,77,2,1,
+  193,234,2,1,203,69,0,3,18,19,193,208,2,1,197,78,2,3,194,190,50,195,199,3,
+  1,195,199,3,1,192,167,3,1,193,1,3,1,196,46,3,1,193,253,3,1,199,213,3,
+  1,199,214,3,1,213,129,3,1,213,130,3,1,213,131,3,1,213,132,3,1,213,133,2,
+  1,192,35,0,4,18,19,194,233,199,184,3,1,197,75,3,1,196,152,3,1,199,194,3,
+  1,199,203,3,1,192,233,3,1,197,81,3,1,199,205,3,1,197,86,3,1,196,128,3,
+  1,192,77,3,1,198,58,2,1,176,2,1,196,125,2,1,213,134,2,1,203,75,0,3,
+  18,19,194,91,2,1,9,2,1,213,135,2,1,193,94,2,1,198,58,2,1,213,136,2,
+  1,199,217,2,1,199,202,2,1,203,70,2,1,203,71,2,1,203,72,2,1,203,73,2,
+  1,203,74,0,2,203,76,190,0,2,198,4,192,57,0,1,213,137,0,1,213,138,0,1,
+  213,139,0,2,213,140,198,59,0,1,213,141,0,1,213,142,0,1,213,143,0,2,195,201,
+  213,144,0,3,192,53,197,89,100,1,1,106,2,1,213,145,0,2,213,146,74,0,1,195,
+  46,1,2,199,218,193,162,0,3,192,227,0,20,2,1,199,219,2,1,62,0,3,192,227,
+  0,213,147,2,1,213,148,2,1,192,20,2,1,213,149,2,1,56,2,1,194,234,2,1,
+  192,2,2,1,213,150,2,1,58,2,1,192,80,2,1,192,6,2,1,213,151,2,1,112,
+  2,1,213,152,2,1,213,153,2,1,178,0,3,192,227,0,199,220,2,1,213,154,2,1,
+  213,155,2,1,213,156,2,1,152,2,1,213,157,2,1,194,3,2,1,197,62,2,1,53,
+  2,1,192,58,2,1,213,158,2,1,192,175,2,1,98,2,1,193,34,2,1,99,2,1,
+  196,37,0,3,192,227,0,213,159,2,1,198,60,2,1,199,221,2,1,213,160,2,1,192,
+  5,2,1,199,222,2,1,213,161,2,1,46,2,1,192,103,2,1,213,162,2,1,213,163,
+  2,1,213,164,2,1,213,165,2,1,192,57,0,1,192,254,0,2,213,166,195,109,0,2,
+  213,167,213,168,0,2,203,77,199,223,0,1,213,169,0,1,199,224,0,1,194,191,1,1,
+  104,2,4,2,199,225,74,199,226,3,2,213,170,197,90,0,4,192,205,192,206,213,171,42,
+  2,2,0,213,172,3,1,213,173,3,1,196,132,3,1,195,201,3,1,203,78,3,1,192,
+  142,3,1,203,79,0,4,192,205,192,206,0,193,169,3,1,213,174,3,1,213,175,3,1,
+  213,176,3,1,203,80,3,1,213,177,3,1,213,178,3,1,213,179,3,1,199,227,3,1,
+  203,81,3,1,213,180,3,1,213,181,3,1,199,59,3,1,213,182,3,1,213,183,3,1,
+  213,184,0,4,192,205,192,206,0,213,185,3,1,213,186,3,1,213,187,3,1,213,188,3,
+  1,213,189,3,1,203,82,3,1,213,190,3,1,202,140,3,1,213,191,3,1,192,135,3,
+  1,196,124,3,1,199,62,3,1,197,91,3,1,213,192,3,1,198,61,3,1,213,193,0,
+  4,192,205,192,206,0,192,101,3,1,213,194,3,1,203,51,3,1,213,195,3,1,213,196,
+  3,1,213,197,3,1,213,198,3,1,213,199,3,1,213,200,3,1,213,201,3,1,213,202,
+  3,1,193,236,3,1,213,203,0,2,213,204,1,0,2,213,205,1,0,1,193,129,0,2,
+  213,206,192,211,0,2,203,83,1,0,3,192,147,192,124,11,0,3,203,84,135,192,124,1,
+  1,195,202,0,1,213,207,0,1,213,208,0,1,203,85,0,3,192,120,192,98,42,1,1,
+  193,121,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,0,3,192,
+  120,14,117,2,1,65,2,1,54,2,1,192,33,1,2,51,193,121,1,2,0,192,45,2,
+  1,198,62,2,1,213,209,2,1,199,169,2,1,203,86,2,1,203,87,2,1,203,88,2,
+  1,203,89,2,1,213,210,2,1,56,2,1,197,71,0,3,192,120,0,202,128,2,1,195,
+  19,2,1,58,2,1,203,90,2,1,213,211,2,1,197,246,2,1,203,91,2,1,197,76,
+  2,1,203,22,2,1,199,193,2,1,196,121,2,1,198,51,2,1,213,212,2,1,203,92,
+  2,1,197,253,2,1,203,93,0,3,192,120,0,197,84,2,1,197,254,2,1,196,30,2,
+  1,197,87,2,1,203,94,2,1,199,215,2,1,46,2,1,203,95,2,1,197,77,2,1,
+  196,125,2,1,213,213,1,1,213,214,1,2,53,42,1,2,193,127,42,1,2,193,42,42,
+  1,2,1,192,203,0,3,192,120,1,193,82,2,1,193,47,1,1,193,20,1,3,16,1,
+  20,3,1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,195,127,3,1,58,3,
+  1,192,80,3,1,53,3,1,197,92,3,1,46,3,1,192,103,0,5,192,67,192,49,1,
+  50,192,18,0,5,192,67,192,49,1,50,178,4,1,194,3,3,1,170,3,1,154,3,1,
+  192,109,3,1,176,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,
+  2,1,117,2,1,65,2,1,54,2,1,192,33,0,3,192,67,0,20,2,1,192,74,2,
+  1,192,32,2,1,196,50,2,1,193,2,2,1,192,142,2,1,213,215,2,1,191,2,1,
+  192,220,2,1,192,232,2,1,56,2,2,50,202,193,3,1,192,2,3,1,192,6,3,1,
+  112,3,1,152,0,4,192,67,0,50,194,3,3,1,192,58,3,1,98,3,1,198,60,3,
+  1,192,5,3,1,192,35,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,
+  102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,167,0,3,192,67,0,213,
+  216,2,1,173,2,1,192,95,2,1,213,217,2,1,196,103,2,1,213,218,2,1,213,219,
+  2,1,213,220,2,1,53,2,1,150,2,1,192,195,2,1,213,221,2,1,154,2,1,182,
+  2,1,193,33,2,1,180,0,3,192,67,0,192,167,2,1,46,2,1,192,194,2,1,176,
+  1,2,192,4,193,121,2,2,51,193,121,2,1,196,51,2,2,192,174,193,121,1,3,16,
+  1,192,45,3,1,192,74,3,1,192,98,3,1,195,127,3,1,58,3,1,192,80,3,1,
+  53,3,1,193,4,0,4,192,67,16,1,46,3,1,193,219,0,2,192,28,196,153,0,4,
+  197,52,2,183,199,228,2,2,187,199,228,4,3,24,197,49,1,0,2,194,145,42,0,2,
+  198,63,197,93,2,1,194,46,0,2,213,222,213,223,0,2,213,224,213,225,0,2,213,226,
+  194,224,0,3,103,0,20,2,1,191,2,1,193,227,2,1,194,24,0,3,103,0,198,36,
+  2,1,194,5,2,1,194,25,2,1,203,96,2,1,56,2,1,192,3,2,1,195,51,2,
+  1,193,210,2,1,194,155,2,1,194,65,2,1,203,97,2,1,129,2,1,193,19,2,1,
+  193,57,2,1,199,229,2,1,193,158,0,3,103,0,194,158,2,1,198,64,2,1,58,2,
+  1,90,2,1,170,2,1,192,226,2,1,192,149,2,1,194,10,2,1,193,174,2,1,203,
+  98,2,1,167,2,1,193,80,2,1,193,119,2,1,193,231,2,1,193,31,2,1,197,94,
+  0,3,103,0,173,2,1,199,230,2,1,193,71,2,1,193,72,2,1,193,28,2,1,193,
+  92,2,1,199,231,2,1,53,2,1,203,99,2,1,203,100,2,1,203,101,2,1,199,232,
+  2,1,199,233,2,1,203,102,2,1,99,2,1,182,0,3,103,0,193,228,2,1,193,218,
+  2,1,193,180,2,1,193,235,2,1,199,234,2,1,180,2,1,193,54,2,1,194,22,2,
+  1,199,177,2,1,199,178,2,1,199,180,2,1,199,181,2,1,199,182,2,1,203,103,2,
+  1,193,123,2,1,194,156,0,3,103,0,196,47,2,1,198,41,2,1,198,42,2,1,203,
+  104,2,1,46,2,1,192,9,2,1,192,109,2,1,193,178,2,1,193,234,2,1,193,208,
+  2,1,195,16,2,1,203,105,2,1,176,2,1,194,91,2,1,9,2,1,193,94,0,3,
+  103,0,193,27,2,1,203,106,1,3,3,0,20,3,1,191,3,1,193,227,3,1,194,24,
+  3,1,198,36,3,1,194,5,3,1,194,25,3,1,203,96,3,1,56,3,1,192,3,3,
+  1,195,51,3,1,193,210,3,1,194,155,3,1,194,65,0,4,103,3,0,203,97,3,1,
+  129,3,1,193,19,3,1,193,57,3,1,199,229,3,1,193,158,3,1,194,158,3,1,198,
+  64,3,1,58,3,1,90,3,1,170,3,1,192,226,3,1,192,149,3,1,194,10,3,1,
+  193,174,3,1,203,98,0,4,103,3,0,167,3,1,193,80,3,1,193,119,3,1,193,231,
+  3,1,193,31,3,1,197,94,3,1,173,3,1,199,230,3,1,193,71,3,1,193,72,3,
+  1,193,28,3,1,193,92,3,1,199,231,3,1,53,3,1,203,99,3,1,203,100,0,4,
+  103,3,0,203,101,3,1,199,232,3,1,199,233,3,1,203,102,3,1,99,3,1,182,3,
+  1,193,228,3,1,193,218,3,1,193,180,3,1,193,235,3,1,199,234,3,1,180,3,1,
+  193,54,3,1,194,22,3,1,199,177,3,1,199,178,0,4,103,3,0,199,180,3,1,199,
+  181,3,1,199,182,3,1,203,103,3,1,193,123,3,1,194,156,3,1,196,47,3,1,198,
+  41,3,1,198,42,3,1,203,104,3,1,46,3,1,192,9,3,1,192,109,3,1,193,178,
+  3,1,193,234,3,1,193,208,0,4,103,3,0,195,16,3,1,203,105,3,1,176,3,1,
+  194,91,3,1,9,3,1,193,94,3,1,193,27,3,1,203,106,0,1,213,227,0,2,213,
+  228,202,189,0,1,213,229,0,2,193,169,193,144,0,1,213,230,0,1,199,235,0,2,213,
+  231,193,95,0,1,213,232,0,1,213,233,0,2,213,234,119,0,1,213,235,0,3,193,148,
+  0,194,68,2,1,194,235,2,1,194,69,2,2,213,236,193,11,2,1,195,58,2,1,194,
+  95,2,1,193,19,2,1,194,121,2,1,194,96,2,1,194,122,2,1,194,26,2,1,192,
+  177,2,1,192,238,0,3,193,148,0,194,192,2,1,194,97,2,1,193,86,2,2,3,194,
+  68,2,1,194,70,2,1,193,11,2,1,194,123,2,1,194,159,1,2,29,78,2,1,49,
+  3,1,134,2,1,192,66,2,1,65,2,1,192,224,2,1,54,0,2,199,236,195,59,0,
+  1,203,107,0,1,213,237,0,12,120,199,237,194,236,172,119,24,192,240,110,199,237,194,236,
+  83,119,1,7,2,197,3,195,47,113,39,193,211,55,2,2,172,119,2,3,39,110,55,2,
+  3,107,110,55,2,3,37,110,55,2,5,3,120,66,193,1,37,2,2,213,238,192,57,2,
+  6,54,172,199,188,66,193,1,37,2,3,113,110,55,3,3,37,193,211,55,2,2,83,194,
+  46,0,3,45,193,247,27,1,3,213,239,195,203,1,0,3,45,192,245,192,242,1,2,25,
+  192,57,1,1,194,154,1,4,192,52,2,199,238,196,20,1,1,203,108,1,1,203,109,1,
+  2,192,211,199,239,3,3,2,78,140,4,2,54,140,2,1,199,240,1,2,193,95,203,110,
+  1,1,193,21,1,2,14,115,2,1,85,2,1,78,2,1,133,0,3,45,14,49,2,1,
+  128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,2,195,203,1,2,1,194,87,1,
+  5,196,32,1,2,199,238,196,20,1,2,59,192,242,1,1,193,64,1,1,192,172,1,2,
+  28,195,204,3,1,20,2,1,195,129,3,1,20,0,3,45,28,195,205,3,1,20,2,1,
+  195,130,3,1,20,3,1,46,2,1,195,206,3,1,20,2,1,195,207,3,1,20,2,1,
+  195,208,3,1,20,2,1,195,209,3,1,20,2,1,195,210,3,1,20,2,1,195,211,0,
+  4,45,28,195,211,20,2,1,195,212,3,1,20,2,1,195,213,3,1,20,2,1,195,214,
+  3,1,20,2,1,195,215,3,1,20,1,4,75,63,91,27,1,4,172,119,2,203,111,1,
+  2,199,241,195,216,1,2,192,36,213,240,2,1,213,241,2,1,203,112,2,1,213,242,0,
+  3,45,192,36,192,147,2,1,203,113,2,1,213,243,2,1,213,244,2,1,194,84,2,1,
+  115,2,1,203,114,2,1,213,245,2,1,196,154,2,1,203,115,2,1,195,1,2,1,85,
+  2,1,78,2,1,203,116,2,1,139,2,1,213,246,0,3,45,192,36,213,247,2,1,203,
+  117,2,1,203,118,2,1,39,2,1,135,2,1,195,60,2,1,213,248,2,1,203,119,2,
+  1,193,128,2,1,195,217,2,1,197,214,2,1,133,2,1,49,2,1,203,120,2,1,193,
+  127,2,1,213,249,0,3,45,192,36,203,121,2,1,194,47,2,1,37,2,1,199,242,2,
+  1,213,250,2,1,128,2,1,117,2,1,203,122,2,1,203,123,2,1,199,243,2,1,203,
+  124,2,1,213,251,2,1,194,94,2,1,203,125,2,1,192,66,2,1,65,0,3,45,192,
+  36,54,2,1,194,146,2,1,199,244,1,2,199,245,199,246,1,5,44,7,5,0,192,52,
+  5,1,98,1,2,72,20,2,1,56,2,1,129,2,1,193,19,2,1,193,57,2,1,193,
+  158,2,1,194,158,2,1,58,2,1,90,2,1,193,250,0,3,45,72,193,203,2,1,193,
+  196,2,1,193,230,2,1,167,2,1,193,80,2,1,193,119,2,1,193,231,2,1,193,31,
+  2,1,173,2,1,193,71,2,1,193,72,2,1,193,28,2,1,193,92,2,1,53,2,1,
+  154,2,1,194,39,0,3,45,72,194,86,2,1,193,179,2,1,193,217,2,1,182,2,1,
+  193,228,2,1,193,218,2,1,193,180,2,1,193,235,2,1,180,2,1,193,54,2,1,194,
+  22,2,1,66,2,1,193,190,2,1,46,2,1,192,109,2,1,193,178,0,3,45,72,193,
+  234,2,1,193,208,2,1,176,2,1,193,94,2,1,193,27,1,3,197,95,192,28,213,252,
+  3,1,213,253,1,4,7,5,0,20,4,1,62,4,1,192,52,4,1,192,20,4,1,56,
+  4,1,192,113,4,1,192,2,4,1,192,18,4,1,58,0,5,45,7,5,0,192,83,4,
+  1,192,6,4,1,112,4,1,178,4,1,152,4,1,53,4,1,192,58,4,1,192,175,4,
+  1,98,4,1,99,4,1,192,5,4,1,46,4,1,192,9,4,1,192,77,4,1,192,57,
+  4,1,192,35,0,5,45,7,5,0,192,27,2,3,3,0,20,4,1,62,4,1,192,52,
+  4,1,192,20,4,1,56,4,1,192,113,4,1,192,2,4,1,192,18,4,1,58,4,1,
+  192,83,4,1,192,6,4,1,112,4,1,178,4,1,152,4,1,53,0,5,45,7,3,0,
+  192,58,4,1,192,175,4,1,98,4,1,99,4,1,192,5,4,1,46,4,1,192,9,4,
+  1,192,77,4,1,192,57,4,1,192,35,4,1,192,27,1,1,192,173,1,1,193,252,1,
+  5,194,193,1,2,192,75,192,132,1,2,29,195,131,2,4,194,110,192,135,55,43,0,3,
+  45,29,194,237,2,1,195,10,2,1,193,68,3,3,192,135,55,43,2,1,193,153,3,1,
+  115,3,1,85,3,1,78,3,1,133,3,3,192,135,55,43,3,1,49,3,1,128,3,1,
+  117,3,1,65,3,1,54,2,1,195,218,0,3,45,29,195,219,2,1,195,220,2,4,193,
+  77,192,135,55,43,2,1,195,54,2,4,194,61,192,135,55,43,2,1,192,66,3,3,192,
+  135,55,43,2,1,195,221,2,1,193,117,3,1,115,3,1,85,3,1,78,3,1,133,3,
+  3,192,135,55,43,3,1,49,3,1,128,0,4,45,29,193,117,117,3,1,65,3,1,54,
+  2,1,194,124,2,1,192,224,3,1,115,3,1,85,3,1,78,3,1,133,3,3,192,135,
+  55,43,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,1,5,177,192,147,115,193,
+  52,192,171,0,2,45,195,61,1,1,199,247,1,1,97,1,2,198,65,42,1,2,193,251,
+  193,204,1,2,159,192,242,1,1,43,1,1,22,1,1,174,2,1,116,1,2,83,119,1,
+  2,63,194,154,2,1,192,171,1,1,213,254,1,1,192,57,1,3,192,33,2,194,87,0,
+  2,213,255,203,126,0,2,192,75,192,132,0,2,214,0,199,248,0,1,203,127,1,2,193,
+  160,214,1,0,3,87,47,199,249,2,1,195,189,2,3,199,250,74,199,251,2,1,198,19,
+  2,1,100,2,2,196,155,49,3,1,54,2,2,193,237,198,7,3,1,203,128,3,1,195,
+  222,3,1,196,156,0,4,87,47,193,237,196,157,3,1,195,62,3,1,199,252,3,1,199,
+  253,3,1,203,129,3,1,197,212,3,1,195,109,3,1,193,238,3,1,171,3,1,195,45,
+  3,1,196,29,3,1,193,93,3,1,199,254,3,1,196,52,3,2,203,130,199,255,3,1,
+  198,66,0,4,87,47,193,237,197,96,3,1,195,20,2,1,214,2,2,1,203,131,2,1,
+  214,3,2,1,200,0,2,1,200,1,2,1,197,97,2,1,203,132,2,1,203,133,2,1,
+  196,158,2,2,196,156,49,3,1,65,3,1,54,2,1,203,134,2,1,195,63,0,3,87,
+  47,195,1,2,1,198,67,2,1,200,2,2,2,198,68,49,3,1,65,3,1,54,2,1,
+  193,105,2,1,193,146,2,2,193,118,49,3,1,54,2,1,193,83,2,2,198,69,195,222,
+  3,1,196,157,3,1,198,66,3,1,197,96,2,1,203,135,0,4,87,47,196,159,49,3,
+  1,54,2,2,197,98,78,3,1,49,3,1,65,3,1,54,2,2,171,49,3,1,54,2,
+  1,198,70,2,1,203,136,2,1,193,128,2,1,203,137,2,1,203,138,2,2,200,3,49,
+  3,1,54,2,2,196,160,78,0,4,87,47,196,160,49,3,1,65,3,1,54,2,1,36,
+  2,2,200,4,49,3,1,54,2,1,193,232,2,1,196,53,2,1,198,71,2,1,200,5,
+  2,1,195,132,2,1,200,6,2,2,195,107,49,3,1,65,3,1,54,2,1,200,7,0,
+  3,87,47,199,254,2,4,197,99,110,195,59,203,139,3,1,193,83,3,1,197,100,3,1,
+  200,8,3,1,197,101,2,2,3,49,3,1,54,2,1,198,72,2,2,200,9,49,3,1,
+  54,2,2,197,218,49,3,1,54,2,1,194,94,2,1,200,10,2,1,200,11,0,3,87,
+  47,198,73,2,1,197,96,2,2,197,100,49,3,1,54,2,2,194,146,49,3,1,54,2,
+  2,192,196,49,3,1,54,1,2,71,214,4,2,1,192,20,2,1,192,18,2,1,203,140,
+  2,1,198,74,2,1,214,5,2,1,214,6,2,1,203,141,0,3,87,71,214,7,2,1,
+  214,8,2,1,214,9,2,1,214,10,2,1,214,11,2,1,214,12,2,1,214,13,2,1,
+  214,14,2,1,152,2,1,192,58,2,1,214,15,2,1,214,16,2,1,214,17,2,1,192,
+  175,2,1,99,2,1,214,18,0,3,87,71,214,19,2,1,199,221,2,1,203,58,2,1,
+  214,20,2,1,214,21,2,1,214,22,2,1,214,23,2,1,214,24,2,1,192,5,2,1,
+  214,25,2,1,214,26,2,1,214,27,0,3,214,28,197,102,198,75,0,2,214,29,197,93,
+  0,3,214,30,195,133,1,0,2,214,31,197,64,0,3,214,32,197,103,11,0,3,203,142,
+  202,163,214,33,1,1,214,34,0,1,214,35,0,4,193,155,104,115,194,238,2,1,214,36,
+  2,2,194,237,194,238,2,1,214,37,2,2,85,194,238,2,1,214,38,2,2,78,194,238,
+  2,1,214,39,2,2,133,194,238,2,1,214,40,2,2,49,194,238,2,1,214,41,0,4,
+  193,155,104,128,194,238,2,1,214,42,2,2,117,194,238,2,1,214,43,2,2,192,66,194,
+  238,2,1,214,44,2,2,65,194,238,2,1,214,45,2,2,194,124,194,238,2,1,214,46,
+  2,2,54,194,238,2,1,214,47,0,4,194,98,193,3,120,27,1,2,199,46,193,193,1,
+  6,183,24,187,177,120,194,62,1,3,202,23,120,27,0,2,194,98,193,193,1,3,177,120,
+  27,1,5,37,24,39,197,7,194,62,1,6,91,24,108,177,120,194,62,7,4,2,45,49,
+  193,220,1,3,192,240,197,7,27,1,4,192,92,177,120,27,0,2,200,12,96,0,2,193,
+  3,196,138,1,3,194,48,2,198,76,1,3,198,77,2,195,110,1,4,198,78,2,203,143,
+  194,224,3,2,193,79,194,224,1,1,193,181,2,3,192,26,164,66,1,1,193,182,0,5,
+  193,3,193,182,192,26,164,66,1,1,197,54,1,3,194,12,2,198,76,4,3,24,203,144,
+  194,194,0,1,195,64,1,2,2,197,104,2,1,196,53,2,1,200,13,2,1,214,48,0,
+  2,214,49,104,0,1,203,145,0,1,214,50,0,2,214,51,196,161,0,1,214,52,0,1,
+  214,53,0,1,214,54,0,2,214,55,11,0,1,193,90,1,1,193,64,1,1,1,0,3,
+  31,192,31,192,132,3,1,57,2,2,136,42,1,1,214,56,1,1,214,57,1,4,194,85,
+  164,66,38,4,1,57,1,2,214,58,11,1,3,193,247,27,38,2,2,159,193,220,1,2,
+  192,245,38,2,1,57,0,3,31,194,182,57,1,1,192,182,2,1,57,1,1,214,59,1,
+  2,196,144,38,2,1,57,1,1,193,82,1,1,192,254,2,1,57,1,1,193,129,1,2,
+  192,75,192,132,3,1,57,1,3,194,98,27,38,2,2,159,193,220,1,2,192,168,38,3,
+  1,37,0,3,31,192,168,57,1,2,203,146,192,136,3,1,57,1,3,41,192,68,203,147,
+  2,3,134,196,54,1,3,2,195,181,1,2,1,195,134,2,2,0,20,3,1,194,113,3,
+  2,194,117,193,106,3,1,193,209,3,1,193,227,3,1,200,14,3,1,195,52,3,1,193,
+  216,3,1,194,49,0,4,31,41,0,192,188,3,1,194,118,3,1,195,21,3,1,214,60,
+  3,1,196,55,3,1,194,38,3,1,129,3,2,195,55,1,3,1,58,3,1,194,71,3,
+  2,194,99,20,4,2,194,117,193,106,4,1,56,3,1,90,3,2,192,121,193,106,3,2,
+  200,15,196,162,0,4,31,41,0,53,3,1,192,108,3,1,192,238,3,1,192,101,3,1,
+  200,16,3,2,194,160,1,3,1,193,54,3,1,194,156,3,1,46,3,2,200,17,194,71,
+  3,1,194,63,3,1,195,135,3,1,195,22,3,1,9,3,1,193,27,3,1,193,229,0,
+  4,31,41,0,194,90,2,2,196,54,1,2,1,214,61,2,1,203,148,2,1,214,62,2,
+  2,192,84,203,147,2,3,192,66,196,54,1,2,3,169,196,54,1,2,1,197,105,3,2,
+  39,110,3,2,37,110,2,1,214,63,1,2,214,64,42,1,3,109,14,115,3,1,85,3,
+  1,78,0,4,31,109,14,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,
+  1,192,33,2,2,0,20,3,1,90,3,1,173,3,1,150,3,1,154,3,1,46,3,1,
+  195,108,2,2,1,194,92,1,1,192,96,0,3,31,192,96,57,1,1,214,65,1,2,59,
+  38,3,1,39,3,1,37,2,1,57,3,1,39,1,3,193,14,192,31,192,132,2,2,192,
+  127,192,132,1,3,51,192,31,192,132,2,1,192,182,3,1,57,2,2,192,75,38,2,2,
+  192,127,192,132,2,2,192,143,192,182,4,1,57,0,4,31,51,135,192,124,2,1,192,136,
+  3,1,57,2,3,177,42,57,2,1,195,202,2,2,198,79,38,2,3,97,1,38,4,1,
+  57,2,3,91,27,57,2,2,159,57,2,1,184,3,2,39,110,3,2,37,110,2,3,83,
+  192,124,38,4,1,57,3,2,71,193,220,0,4,31,197,11,192,75,192,132,1,3,116,193,
+  69,57,1,2,183,27,1,2,196,56,120,3,1,196,20,2,1,192,241,2,1,203,149,2,
+  1,197,103,2,1,43,2,3,203,150,192,89,174,1,3,193,64,1,57,1,1,200,18,1,
+  3,78,140,38,1,3,141,0,200,19,3,2,194,117,193,106,3,1,200,20,0,4,31,141,
+  0,197,106,3,1,200,21,3,1,200,22,3,1,196,55,3,1,200,23,3,1,200,24,3,
+  1,200,25,3,1,58,3,2,86,196,163,3,3,196,164,194,117,193,106,4,2,3,193,106,
+  3,1,196,163,3,1,200,26,3,1,200,27,3,1,197,107,3,1,200,28,0,4,31,141,
+  0,200,29,3,1,200,30,3,1,200,31,3,1,192,101,3,1,200,32,3,1,200,33,3,
+  2,3,193,106,3,1,196,47,3,1,200,34,3,1,200,35,3,1,200,36,3,1,200,37,
+  3,1,198,80,3,1,195,22,3,1,200,38,3,1,193,94,0,4,31,141,0,193,27,3,
+  1,200,39,3,1,200,40,1,3,192,59,14,85,3,1,78,3,1,49,3,1,117,3,1,
+  65,3,1,54,3,1,192,33,2,2,0,20,3,1,90,3,1,173,3,1,150,3,1,195,
+  108,1,2,214,66,196,38,0,3,31,192,127,192,132,3,1,57,2,2,136,42,1,1,214,
+  67,1,1,214,68,1,3,33,194,72,194,27,2,1,199,158,2,2,35,203,151,3,1,203,
+  152,3,1,203,153,2,1,192,243,2,1,193,48,1,2,203,154,38,1,2,82,38,1,1,
+  193,83,1,1,196,165,0,3,31,192,143,192,182,3,1,57,2,2,196,144,57,2,3,51,
+  203,155,38,4,1,57,1,2,196,166,57,1,4,196,57,200,41,194,66,42,2,3,195,65,
+  194,66,42,1,3,195,134,38,39,3,1,37,1,5,7,0,3,5,192,2,5,1,112,5,
+  1,178,5,1,152,5,1,98,2,3,3,0,20,0,7,31,7,3,0,20,2,192,96,4,
+  1,193,85,4,1,192,112,4,1,197,230,4,1,196,167,4,1,62,4,1,194,28,4,1,
+  192,52,5,1,193,129,4,1,192,20,4,1,56,4,1,194,29,4,1,195,223,4,1,192,
+  113,4,4,197,108,177,20,38,4,1,192,2,0,5,31,7,3,0,192,18,4,1,58,4,
+  2,194,13,192,20,5,1,192,2,5,1,98,5,1,192,5,4,1,192,6,4,1,112,5,
+  4,2,51,76,184,4,2,171,99,4,1,178,4,1,152,4,1,53,5,2,2,192,96,6,
+  3,122,198,81,71,4,1,192,58,0,5,31,7,3,0,98,5,1,57,5,1,197,109,4,
+  1,99,4,1,195,23,4,1,192,5,4,3,160,192,77,57,4,1,46,5,2,2,192,96,
+  6,3,122,198,81,71,4,1,192,9,4,1,192,77,5,1,57,4,1,192,57,4,1,192,
+  27,1,3,39,192,156,38,0,4,31,39,192,156,57,2,2,27,38,3,1,57,2,2,192,
+  97,38,3,1,57,2,3,110,159,38,4,1,57,2,2,192,153,38,2,3,192,247,38,39,
+  3,2,57,39,2,3,37,27,38,4,1,57,2,2,193,69,57,1,3,108,27,193,220,2,
+  4,192,153,2,186,183,1,3,32,39,110,0,5,31,32,39,110,57,2,2,37,110,4,1,
+  57,1,4,122,198,81,71,57,1,4,171,51,193,204,193,220,2,2,193,204,193,220,2,2,
+  71,193,220,2,3,83,192,124,193,220,1,2,135,192,124,1,1,192,136,2,1,57,2,2,
+  39,110,4,1,57,2,2,37,110,4,1,57,1,1,214,69,0,2,31,214,70,1,1,214,
+  71,1,3,193,252,1,57,1,3,192,146,184,38,1,3,29,1,38,1,1,194,125,2,1,
+  38,1,4,36,193,7,0,193,53,4,1,203,156,4,1,203,157,4,1,197,85,4,1,198,
+  82,1,3,177,42,57,1,1,195,202,1,3,214,72,82,57,1,2,198,79,38,0,3,31,
+  198,79,57,2,1,193,220,1,3,97,1,38,3,1,57,1,3,193,15,82,57,1,3,193,
+  251,193,204,193,220,1,3,192,56,192,168,38,1,3,37,27,38,3,1,57,2,2,192,97,
+  38,3,4,24,116,192,97,57,4,3,96,192,97,57,3,1,57,2,3,110,159,38,4,1,
+  57,2,2,192,153,38,0,5,31,37,192,247,38,37,3,2,57,37,2,2,193,69,57,1,
+  5,91,192,153,2,186,183,1,2,159,38,2,1,57,2,1,193,220,1,2,214,73,57,1,
+  3,192,114,193,204,193,220,2,2,71,193,220,2,3,83,192,124,193,220,1,2,198,72,57,
+  1,2,43,57,2,2,214,74,38,1,4,203,158,198,81,71,57,1,2,200,42,42,0,4,
+  31,65,140,38,1,1,184,2,1,57,2,3,39,110,57,2,1,193,220,2,3,37,110,57,
+  1,3,192,174,192,31,192,132,2,1,59,2,1,214,75,1,3,160,192,168,38,1,3,96,
+  193,69,38,3,1,57,1,3,187,27,57,1,2,195,136,38,1,2,198,83,38,1,3,83,
+  192,124,38,0,4,31,83,192,124,57,2,1,184,1,3,194,239,196,144,38,2,3,192,143,
+  196,144,57,1,3,196,168,192,124,57,1,2,192,57,38,2,1,57,1,2,214,76,57,1,
+  2,194,240,38,2,1,57,0,1,214,77,0,1,192,168,0,2,197,110,193,160,1,2,193,
+  252,1,0,1,214,78,0,1,214,79,0,2,200,43,11,0,1,214,80,0,2,214,81,194,
+  218,0,2,214,82,104,0,2,214,83,104,0,4,214,84,2,59,38,0,2,214,85,214,86,
+  0,1,214,87,0,2,199,145,1,1,1,214,88,0,3,195,137,194,151,198,84,2,2,195,
+  66,195,224,4,3,192,26,164,66,1,4,2,171,172,71,2,1,194,175,2,7,83,119,193,
+  160,193,103,74,172,71,0,3,214,89,203,159,11,0,2,199,46,193,193,0,2,196,169,214,
+  90,0,2,214,91,203,160,0,2,214,92,196,170,0,1,203,161,0,1,214,93,0,5,93,
+  5,0,203,162,196,171,3,1,203,163,3,2,203,164,196,171,3,2,194,195,195,225,3,2,
+  195,138,198,85,4,1,196,172,4,1,193,72,4,1,195,225,3,1,203,165,0,4,93,5,
+  0,203,166,3,2,195,226,118,4,1,196,173,4,1,198,86,4,1,193,72,3,1,198,85,
+  3,1,203,167,3,1,195,17,3,1,193,239,3,1,196,172,3,1,203,168,3,1,196,173,
+  3,1,203,169,3,1,198,86,3,1,196,171,3,1,198,38,0,4,93,5,0,198,87,3,
+  2,203,170,129,3,1,203,171,3,1,193,119,3,1,193,72,3,1,53,3,3,36,93,192,
+  252,5,1,203,172,5,1,194,29,5,1,196,172,5,1,129,5,1,196,58,5,1,203,173,
+  5,1,196,173,5,1,198,88,5,1,195,225,0,6,93,5,0,36,93,196,59,4,2,194,
+  241,198,52,5,1,194,153,5,1,196,59,5,1,200,44,3,1,198,88,3,1,192,210,3,
+  1,194,73,3,1,193,179,3,1,196,174,3,1,195,225,3,1,196,59,3,1,200,45,3,
+  1,203,174,3,1,194,50,3,1,203,175,0,4,93,5,0,196,175,3,1,203,176,3,1,
+  198,82,1,3,31,193,72,38,2,2,203,177,214,94,3,1,203,178,1,3,193,149,14,115,
+  3,1,85,3,1,78,3,1,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,
+  2,3,29,115,134,0,4,93,193,149,29,194,110,3,1,193,68,3,2,85,134,3,1,193,
+  153,3,2,78,134,3,2,133,134,3,1,193,41,3,2,49,134,3,2,128,134,3,1,193,
+  77,3,2,117,134,3,1,194,61,3,1,192,66,3,1,193,117,3,2,65,134,3,1,192,
+  224,0,5,93,193,149,29,54,134,2,2,195,181,42,1,3,192,14,49,110,1,2,192,209,
+  192,104,1,2,214,95,196,176,1,5,36,194,241,200,46,193,127,42,3,2,192,209,192,104,
+  3,3,214,96,193,127,42,3,2,199,55,196,176,1,4,3,0,203,162,196,171,3,1,203,
+  163,3,2,203,164,196,171,3,2,194,195,195,225,3,2,195,138,198,85,4,1,196,172,4,
+  1,193,72,0,5,93,3,0,195,138,195,225,3,1,203,165,3,1,203,166,3,2,195,226,
+  118,4,1,196,173,4,1,198,86,4,1,193,72,3,1,198,85,3,1,203,167,3,1,195,
+  17,3,1,193,239,3,1,196,172,3,1,203,168,3,1,196,173,3,1,203,169,3,1,198,
+  86,0,4,93,3,0,196,171,3,1,198,38,3,1,198,87,3,2,203,170,129,3,1,203,
+  171,3,1,193,119,3,1,193,72,3,1,53,3,3,36,93,192,252,5,1,203,172,5,1,
+  194,29,5,1,196,172,5,1,129,5,1,196,58,5,1,203,173,5,1,196,173,0,6,93,
+  3,0,36,93,198,88,5,1,195,225,5,1,196,59,4,2,194,241,198,52,5,1,194,153,
+  5,1,196,59,5,1,200,44,3,1,198,88,3,1,192,210,3,1,194,73,3,1,193,179,
+  3,1,196,174,3,1,195,225,3,1,196,59,3,1,200,45,3,1,203,174,0,4,93,3,
+  0,194,50,3,1,203,175,3,1,196,175,3,1,203,176,3,1,198,82,1,2,11,196,146,
+  2,2,198,38,193,179,2,2,193,119,193,179,2,2,192,210,193,179,2,2,196,59,200,45,
+  2,1,214,97,2,2,194,50,193,179,0,2,214,98,11,0,2,203,179,1,0,1,214,99,
+  0,3,214,100,199,55,196,176,0,2,214,101,66,0,3,214,102,24,203,180,0,1,214,103,
+  0,1,214,104,0,5,194,51,194,52,195,24,14,115,4,1,85,4,1,78,4,1,133,4,
+  1,49,4,1,128,4,1,117,4,1,65,4,1,54,2,3,194,208,14,115,4,1,85,4,
+  1,78,0,5,194,51,194,52,194,208,14,133,4,1,49,4,1,128,4,1,117,4,1,65,
+  4,1,54,0,3,214,105,2,193,118,0,1,197,97,1,1,104,0,1,214,106,0,2,200,
+  47,192,53,0,2,196,141,193,128,0,1,203,181,1,3,199,117,24,194,218,0,1,214,107,
+  0,1,214,108,0,2,192,211,42,1,2,74,214,109,2,1,214,110,1,4,203,182,2,39,
+  203,183,3,2,37,203,183,1,1,199,240,2,3,2,197,111,57,0,2,194,195,214,111,1,
+  6,192,15,101,7,5,0,192,58,1,1,214,112,0,2,193,95,203,110,0,1,203,184,0,
+  1,214,113,0,2,214,114,1,0,3,200,48,194,191,104,1,1,104,0,2,214,115,194,218,
+  0,2,199,56,197,32,0,1,214,116,0,5,10,175,1,115,192,189,4,1,193,221,4,1,
+  195,139,4,1,194,242,4,1,46,5,2,193,96,15,4,3,193,96,15,214,117,6,1,214,
+  118,3,2,197,112,193,68,4,1,193,153,4,2,49,194,174,4,2,54,195,140,3,2,85,
+  192,189,0,6,10,175,1,85,192,189,193,22,4,1,196,60,5,2,193,96,15,4,1,196,
+  177,4,1,193,221,4,1,195,139,4,1,197,113,4,1,194,242,4,1,196,178,4,2,203,
+  185,193,221,4,1,46,5,2,193,96,15,3,2,78,192,189,5,1,193,22,4,1,196,60,
+  5,2,193,96,15,0,5,10,175,1,78,196,177,4,1,193,221,4,1,195,139,4,1,197,
+  113,4,1,194,242,4,1,196,178,4,1,46,5,2,193,96,15,4,3,193,96,15,200,49,
+  7,1,20,7,1,62,6,1,214,119,3,1,214,120,3,1,214,121,3,2,133,192,189,4,
+  1,193,221,0,5,10,175,1,133,195,139,4,1,194,242,4,1,46,5,2,193,96,15,4,
+  3,193,96,15,203,186,7,1,20,6,1,214,122,6,1,214,123,3,4,36,200,50,49,193,
+  49,6,1,200,51,3,2,49,196,60,4,1,196,177,4,2,193,46,192,189,4,1,203,187,
+  4,1,195,139,4,1,197,113,0,6,10,175,1,49,110,198,89,4,2,193,49,192,189,5,
+  1,198,89,4,1,196,178,4,2,194,174,193,221,5,3,193,96,15,20,3,2,128,192,189,
+  4,1,193,221,4,1,195,139,4,1,194,242,4,1,46,5,2,193,96,15,4,4,193,96,
+  15,198,90,20,7,1,62,6,1,214,124,3,5,194,242,22,195,141,97,193,221,0,8,10,
+  175,1,194,242,22,195,141,97,198,91,3,2,117,192,189,5,1,193,22,4,1,193,221,4,
+  1,195,139,4,1,194,242,4,1,46,5,2,193,96,15,4,3,193,96,15,214,125,3,2,
+  65,192,189,5,1,193,22,4,1,196,60,4,1,196,177,5,2,193,96,15,4,1,193,221,
+  4,1,195,139,0,5,10,175,1,65,197,113,4,1,194,242,5,2,193,96,15,4,1,196,
+  178,5,2,193,96,15,4,3,193,96,15,214,126,6,1,214,127,3,2,54,192,189,5,1,
+  193,22,4,1,196,60,4,1,196,177,4,1,203,187,4,1,195,139,4,1,197,113,4,1,
+  194,242,4,1,196,178,0,6,10,175,1,54,195,140,193,221,5,3,193,96,15,20,1,4,
+  192,4,1,189,193,90,4,1,214,128,4,1,203,188,3,4,36,200,50,193,215,196,176,3,
+  2,83,193,90,1,2,1,20,3,2,22,20,4,1,194,30,4,2,193,240,193,22,4,1,
+  129,4,1,193,97,4,2,194,126,192,190,4,1,194,74,4,1,193,130,0,3,10,1,199,
+  219,2,1,193,254,3,1,192,190,3,2,22,195,67,4,2,196,61,192,190,4,1,195,141,
+  4,2,193,240,193,22,4,1,129,4,2,193,97,192,190,4,1,198,90,4,1,192,159,4,
+  1,192,177,5,1,193,22,4,1,200,52,4,1,195,142,4,5,46,97,46,97,46,0,3,
+  10,1,194,31,3,2,22,20,4,1,198,92,4,2,193,240,193,22,4,3,193,80,97,192,
+  188,4,1,194,243,4,1,194,100,2,1,196,62,3,2,22,195,68,2,1,196,179,3,2,
+  22,196,180,4,3,198,93,97,193,241,2,1,194,75,3,2,22,194,75,4,1,200,53,4,
+  1,193,241,0,5,10,1,194,75,22,129,4,1,197,114,4,1,193,203,4,1,192,246,4,
+  1,194,244,2,1,214,129,2,1,194,68,2,1,198,94,3,2,22,214,130,4,1,192,246,
+  2,1,193,53,3,2,145,193,53,3,6,97,195,227,195,228,193,53,97,195,227,5,1,101,
+  3,2,65,22,2,1,200,54,0,3,10,1,214,131,2,1,203,189,3,2,22,194,32,2,
+  1,214,132,2,1,214,133,2,1,192,189,3,2,203,190,193,22,3,4,145,192,189,145,192,
+  189,7,6,193,95,192,189,145,192,189,145,192,189,5,7,195,229,145,195,229,195,229,145,195,
+  229,194,40,3,2,203,191,193,22,2,1,195,67,2,1,200,55,2,1,192,32,2,1,194,
+  30,3,3,22,193,221,193,22,0,3,10,1,214,134,2,1,197,115,3,2,22,194,31,4,
+  1,193,72,4,1,192,221,2,1,197,116,3,2,145,197,116,2,1,198,92,2,1,119,2,
+  1,214,135,2,1,194,33,3,2,22,20,4,1,193,131,4,2,193,97,192,190,2,1,193,
+  176,3,2,193,95,193,176,0,6,10,1,193,176,145,193,176,193,254,5,2,22,203,192,5,
+  1,195,143,2,1,198,95,3,2,145,198,95,2,1,195,144,2,1,214,136,2,1,191,3,
+  2,22,194,100,2,1,193,159,3,5,193,132,22,20,97,196,63,5,1,198,94,5,1,198,
+  92,5,1,194,33,5,1,192,3,6,2,97,196,63,0,6,10,1,193,159,193,132,22,193,
+  210,5,1,196,64,5,1,194,76,5,1,129,5,1,197,60,6,2,97,193,174,5,1,195,
+  69,5,1,170,5,1,193,174,6,2,97,203,193,5,1,194,219,5,1,193,71,5,3,194,
+  40,97,194,40,5,1,193,218,5,1,194,100,5,3,194,127,97,196,64,0,8,10,1,193,
+  159,193,132,22,194,127,97,196,63,5,1,194,244,3,2,22,194,32,2,1,214,137,2,1,
+  214,138,2,1,203,194,2,1,203,195,2,1,214,139,2,1,194,24,2,1,203,196,2,1,
+  196,65,3,2,22,193,97,4,1,192,246,4,3,46,46,46,2,1,200,53,3,2,22,193,
+  150,0,3,10,1,198,96,3,4,194,128,46,192,190,193,221,2,1,193,221,3,2,97,194,
+  115,2,1,194,25,3,1,192,190,3,2,145,194,25,3,1,194,101,2,1,196,181,3,2,
+  22,195,68,4,1,192,246,2,1,214,140,2,1,193,81,3,2,22,200,54,4,1,192,189,
+  5,2,193,160,39,0,5,10,1,193,81,22,198,96,4,1,200,56,4,1,196,180,4,1,
+  192,3,4,1,193,210,4,2,196,64,192,190,4,1,193,241,4,1,129,4,1,193,57,4,
+  2,193,97,192,190,4,1,194,128,4,1,194,32,4,1,196,182,5,2,97,194,128,4,1,
+  214,141,4,1,192,105,0,7,10,1,193,81,22,192,105,22,194,32,4,3,200,57,97,193,
+  241,4,1,196,63,4,1,200,58,4,1,193,119,4,1,193,72,4,1,192,210,4,1,192,
+  246,4,2,193,218,192,190,2,1,214,142,2,1,214,143,2,1,200,56,2,1,196,61,3,
+  1,192,190,4,1,192,190,2,1,214,144,0,3,10,1,214,145,2,1,56,3,5,145,56,
+  192,177,145,192,177,3,2,22,194,40,2,1,194,234,3,6,22,20,97,129,97,191,4,1,
+  193,131,4,1,194,32,4,1,193,119,4,1,194,40,4,1,195,70,4,1,192,246,4,1,
+  46,2,1,214,146,2,1,214,147,2,1,193,216,0,3,10,1,192,188,3,2,193,95,192,
+  188,3,2,195,228,192,188,3,1,101,3,2,22,193,240,5,1,193,22,4,1,193,80,2,
+  1,203,197,2,1,196,180,3,1,192,57,2,1,195,68,3,2,193,95,195,68,2,1,193,
+  107,3,3,194,101,22,192,189,5,1,193,57,5,2,193,97,192,190,0,6,10,1,193,107,
+  194,101,22,170,5,1,194,245,5,1,193,80,5,1,200,58,5,1,193,235,3,2,22,20,
+  5,2,97,194,245,7,2,22,194,245,4,1,193,53,4,1,194,30,4,2,196,61,192,190,
+  6,1,192,190,4,1,194,76,4,1,129,5,1,192,190,4,2,193,97,192,190,0,5,10,
+  1,193,107,22,194,128,5,1,101,4,1,196,183,4,1,170,4,3,194,245,22,194,245,4,
+  1,192,149,4,1,193,174,4,1,192,246,4,1,193,235,4,1,194,127,4,1,193,150,2,
+  1,192,3,3,1,192,190,2,1,192,93,3,2,145,192,93,3,6,22,20,97,191,97,129,
+  0,7,10,1,192,93,22,20,97,129,6,1,193,97,4,4,194,31,193,22,97,195,71,4,
+  1,193,53,5,4,97,195,69,97,20,4,1,192,189,4,1,195,67,5,2,97,195,141,4,
+  1,194,30,4,1,197,115,4,3,119,97,154,4,1,195,144,5,2,97,154,4,1,191,4,
+  1,194,24,4,2,196,65,192,190,0,7,10,1,192,93,22,196,65,22,192,246,4,1,196,
+  181,4,4,193,81,22,193,97,192,190,6,1,194,128,4,1,193,216,5,2,97,170,4,1,
+  192,188,5,3,22,193,240,193,22,4,1,203,197,4,1,192,3,4,2,193,240,193,22,4,
+  1,193,131,5,2,97,194,24,6,1,193,71,4,1,193,210,4,1,196,66,0,7,10,1,
+  192,93,22,196,66,97,20,4,3,196,64,97,193,235,4,3,129,97,20,6,3,193,174,97,
+  195,68,4,1,196,184,5,2,97,170,4,3,193,57,97,192,149,4,1,195,230,4,2,193,
+  97,192,190,4,5,200,59,97,194,158,97,192,189,4,1,195,69,4,1,194,128,4,1,198,
+  97,5,2,97,194,245,4,3,196,183,97,193,53,4,3,196,182,97,194,128,0,5,10,1,
+  192,93,22,170,4,1,192,105,5,2,22,194,32,4,1,200,57,4,3,193,80,97,192,188,
+  4,1,193,119,4,1,194,74,4,1,193,71,5,2,97,194,234,6,1,193,210,4,1,192,
+  177,5,2,145,192,177,4,1,150,4,1,195,70,4,1,196,185,4,1,192,246,0,7,10,
+  1,192,93,22,192,246,97,196,186,4,1,196,187,4,1,194,196,4,1,196,188,4,1,194,
+  100,4,1,46,4,1,193,150,5,2,97,194,25,4,1,203,198,2,1,198,98,3,2,193,
+  95,198,98,3,3,192,152,193,41,192,204,2,1,195,72,3,5,145,195,72,193,131,145,193,
+  131,2,1,195,141,3,6,195,72,145,195,72,193,131,145,193,131,0,3,10,1,214,148,2,
+  1,214,149,2,1,196,67,2,1,193,240,3,2,193,95,193,240,3,2,145,193,240,3,1,
+  193,22,2,1,193,131,2,1,214,150,2,1,214,151,2,1,214,152,2,1,200,60,3,2,
+  22,194,32,4,1,46,2,1,193,210,3,2,193,95,193,210,0,5,10,1,193,210,22,56,
+  4,1,46,2,1,196,66,3,2,193,95,196,66,3,2,145,196,66,2,1,214,153,2,1,
+  214,154,2,1,196,64,3,1,192,190,2,1,196,189,3,4,22,20,97,193,97,4,2,193,
+  240,193,22,4,1,193,97,4,3,193,174,97,193,97,4,1,150,2,1,214,155,0,3,10,
+  1,193,241,3,2,193,95,193,241,3,1,193,22,3,2,22,194,30,4,3,193,241,193,95,
+  193,241,4,1,194,100,2,1,194,65,3,2,193,95,194,65,2,1,196,68,3,1,192,190,
+  3,3,22,193,97,192,190,4,1,195,69,5,3,22,193,97,192,190,4,1,192,177,4,3,
+  195,70,97,195,229,2,1,194,76,0,6,10,1,194,76,145,194,76,196,69,3,4,97,193,
+  241,22,194,100,3,4,22,20,97,194,32,4,1,194,32,2,1,203,199,2,1,199,40,3,
+  2,22,192,246,2,1,198,89,2,1,203,200,2,1,214,156,2,1,214,157,2,1,129,3,
+  1,192,190,3,1,193,22,4,1,192,190,2,1,196,184,0,3,10,1,193,57,3,2,22,
+  192,189,5,4,145,193,57,22,192,189,4,1,195,67,4,1,194,30,4,1,193,221,4,1,
+  195,72,4,1,200,61,4,1,192,177,4,1,192,246,4,1,46,2,1,194,158,2,1,195,
+  230,3,2,22,193,53,4,1,196,184,4,1,194,128,0,5,10,1,195,230,22,200,62,4,
+  1,193,150,2,1,214,158,2,1,214,159,2,1,58,3,1,20,2,1,200,63,2,1,197,
+  117,3,3,145,197,117,195,144,5,1,101,2,1,203,201,2,1,193,97,3,1,203,196,3,
+  1,192,190,3,8,145,193,97,196,190,145,196,190,193,150,145,193,150,3,1,194,86,0,3,
+  10,1,203,202,3,3,22,193,240,193,22,2,1,214,160,2,1,194,119,3,2,193,95,194,
+  119,3,2,195,228,194,119,3,1,101,3,2,22,194,100,2,1,198,90,2,1,192,158,2,
+  1,197,60,2,1,200,59,2,1,90,3,2,22,20,4,1,196,62,5,2,97,196,183,0,
+  5,10,1,90,22,200,54,4,1,195,67,4,1,214,161,4,1,194,30,4,1,198,92,4,
+  1,119,4,1,194,33,4,1,193,176,4,1,196,180,4,1,195,68,4,1,192,3,4,1,
+  195,141,4,2,193,240,193,22,4,1,193,131,5,4,97,194,243,97,20,4,1,193,210,0,
+  5,10,1,90,22,196,64,4,1,193,241,5,2,193,95,193,241,5,2,97,196,185,4,1,
+  194,65,4,1,194,76,4,1,203,200,4,3,193,57,22,195,67,4,1,193,97,4,1,194,
+  119,4,1,90,4,1,195,69,4,1,193,203,4,1,198,97,4,1,192,149,4,1,193,174,
+  0,5,10,1,90,22,194,219,4,1,193,80,5,2,97,194,25,6,1,193,210,6,1,193,
+  54,4,1,193,119,5,2,97,194,161,4,1,193,71,4,1,192,177,4,1,150,4,1,192,
+  210,4,1,193,217,4,1,182,4,1,196,185,4,1,192,101,4,1,192,246,0,5,10,1,
+  90,22,196,187,4,1,194,115,4,1,214,162,4,1,203,203,4,1,203,204,4,1,196,70,
+  4,1,193,190,4,1,46,5,2,46,46,4,1,194,127,4,1,193,150,4,3,198,99,22,
+  150,4,1,195,136,4,1,194,246,4,1,194,244,4,1,195,13,0,3,10,1,200,64,3,
+  2,193,95,200,64,2,1,203,205,2,1,203,206,2,1,197,114,2,1,214,163,2,1,200,
+  65,3,2,145,200,65,2,1,195,69,3,3,22,193,97,192,190,2,1,197,118,3,2,193,
+  95,197,118,3,2,22,194,30,2,1,214,164,2,1,214,165,2,2,203,207,197,112,0,3,
+  10,1,194,128,3,7,192,159,22,46,145,192,159,22,46,3,9,145,194,128,192,159,22,46,
+  145,192,159,22,46,2,1,203,208,2,1,193,203,3,2,22,194,30,4,1,46,4,1,193,
+  150,2,1,198,97,2,1,200,61,2,1,214,166,2,1,214,167,2,1,193,132,3,2,145,
+  193,132,2,1,193,230,3,9,145,193,57,22,195,67,193,230,145,193,57,22,195,67,0,3,
+  10,1,196,183,2,1,203,209,3,2,193,96,15,2,1,214,168,2,1,198,100,3,1,192,
+  190,2,1,202,130,2,1,194,32,3,2,195,228,194,32,2,1,196,182,2,1,214,169,2,
+  1,170,2,1,192,159,3,1,101,3,2,22,20,5,4,97,191,97,129,0,7,10,1,192,
+  159,22,20,97,193,131,6,1,194,245,4,1,194,75,4,1,193,53,4,3,192,189,203,191,
+  193,22,4,1,194,30,4,1,194,33,4,1,203,194,4,1,192,188,4,1,192,3,4,1,
+  193,131,4,1,193,210,4,1,194,76,5,2,97,194,76,4,1,129,4,1,196,184,0,7,
+  10,1,192,159,22,193,57,22,192,177,4,2,193,97,192,190,4,1,194,119,5,2,97,129,
+  6,1,193,174,4,1,193,203,4,1,200,61,4,1,196,183,4,1,198,100,5,4,97,193,
+  57,97,20,4,1,192,159,4,1,200,62,4,1,193,174,4,1,200,66,4,1,193,80,5,
+  2,97,192,188,0,5,10,1,192,159,22,194,74,4,1,193,71,4,3,192,246,97,196,188,
+  4,5,198,93,97,193,241,97,196,180,7,1,193,22,4,1,195,142,5,2,97,195,142,4,
+  1,196,188,4,1,190,4,1,194,100,4,7,193,54,97,20,97,193,235,97,173,4,1,46,
+  5,2,97,20,6,3,46,97,46,4,3,194,127,97,192,189,4,1,193,150,0,5,10,1,
+  192,159,22,194,244,4,3,194,230,145,194,230,2,1,194,126,3,1,192,190,4,4,145,194,
+  126,192,190,192,246,3,2,22,192,246,5,2,97,196,188,2,1,214,170,2,1,214,171,2,
+  1,214,172,2,1,214,173,2,1,214,174,2,1,203,210,2,1,214,175,2,1,214,176,2,
+  4,203,211,145,203,211,192,190,0,3,10,1,214,177,2,3,203,212,145,203,212,2,1,214,
+  178,2,1,214,179,2,1,214,180,2,1,214,181,2,1,214,182,2,1,214,183,2,1,214,
+  184,2,1,214,185,2,1,214,186,2,1,214,187,2,1,214,188,2,1,214,189,2,1,214,
+  190,2,1,214,191,0,3,10,1,214,192,2,1,214,193,2,1,214,194,2,1,214,195,2,
+  1,196,191,3,2,22,194,65,4,1,193,97,4,3,194,40,97,196,192,6,3,194,40,97,
+  196,192,4,3,194,127,97,192,32,2,1,214,196,2,1,214,197,2,1,214,198,2,1,214,
+  199,2,1,214,200,2,1,214,201,0,3,10,1,214,202,2,1,214,203,2,1,214,204,2,
+  1,214,205,2,1,195,25,3,2,22,192,189,4,1,194,30,4,3,196,61,192,190,192,190,
+  4,1,196,183,4,1,170,4,1,196,70,4,1,193,54,4,1,194,127,4,1,193,150,4,
+  1,196,193,2,1,214,206,0,3,10,1,195,73,3,2,22,196,181,4,1,192,3,4,1,
+  193,97,5,1,192,190,4,1,193,72,4,5,194,40,97,194,40,97,196,192,4,3,200,52,
+  97,193,203,4,1,193,150,4,1,196,193,2,1,214,207,2,1,214,208,2,1,194,245,3,
+  2,22,194,245,2,1,192,105,3,2,22,194,32,0,7,10,1,192,105,22,194,32,97,193,
+  217,2,1,192,149,2,1,214,209,2,1,214,210,2,1,200,62,2,1,193,174,3,2,22,
+  194,30,2,1,193,65,3,2,193,95,193,65,3,3,192,190,22,192,189,3,2,195,228,193,
+  65,3,1,194,101,4,2,22,194,30,3,1,101,3,1,193,22,3,2,22,194,75,0,5,
+  10,1,193,65,22,194,30,4,1,193,221,4,1,195,68,5,2,97,194,245,5,1,193,22,
+  4,2,193,240,193,22,4,1,196,184,4,3,193,57,22,194,30,4,1,194,119,4,1,203,
+  206,4,1,197,114,5,2,97,192,189,4,1,193,203,4,3,170,97,192,189,4,1,192,159,
+  4,3,193,80,97,192,188,0,5,10,1,193,65,22,193,71,4,1,193,92,4,1,194,40,
+  5,4,97,194,40,97,196,192,4,1,194,115,4,3,193,218,97,192,189,4,3,203,213,97,
+  193,176,4,1,194,100,4,1,195,229,2,1,196,192,2,1,196,69,3,2,195,228,196,69,
+  3,2,145,196,69,3,1,194,101,2,1,200,57,2,1,200,66,0,3,10,1,194,219,3,
+  2,145,194,219,5,3,193,131,145,193,131,2,1,167,3,1,192,190,3,2,22,194,100,2,
+  1,214,211,2,1,203,214,2,1,203,215,2,1,196,63,2,1,203,193,2,1,193,80,2,
+  1,200,58,2,1,203,136,2,1,193,119,3,2,97,203,216,0,3,10,1,198,91,2,1,
+  193,31,3,2,145,193,31,2,1,198,3,3,1,192,190,2,1,214,212,2,1,214,213,2,
+  1,194,74,3,2,193,95,194,74,3,2,145,194,74,5,4,22,20,97,173,6,1,192,3,
+  6,1,195,69,3,2,22,20,4,1,194,32,4,1,192,221,0,3,10,1,196,194,3,1,
+  192,190,3,2,22,20,5,2,97,194,24,4,1,194,24,4,1,192,221,2,1,173,2,1,
+  203,192,2,1,214,214,2,1,195,227,3,1,192,143,3,2,195,228,195,227,3,3,22,194,
+  115,193,22,2,1,214,215,2,1,203,217,3,1,203,218,0,3,10,1,203,219,2,1,193,
+  71,3,1,194,101,3,2,22,20,4,1,193,150,2,1,193,72,3,2,22,56,2,1,214,
+  216,2,1,200,67,3,3,22,193,240,193,22,4,4,193,131,97,193,240,193,22,2,1,200,
+  68,2,1,214,217,2,1,193,163,3,2,22,193,53,4,1,192,189,0,7,10,1,193,163,
+  22,192,189,97,192,189,4,1,197,116,4,2,196,65,192,190,4,1,193,210,4,1,193,241,
+  4,1,194,76,4,1,203,199,4,1,193,57,4,1,203,208,4,1,203,210,4,1,196,63,
+  4,4,193,80,97,193,240,193,22,4,1,193,71,4,1,192,177,4,3,194,40,97,194,40,
+  4,1,192,246,0,8,10,1,193,163,22,192,246,97,20,193,53,6,1,192,189,7,2,97,
+  192,189,4,1,46,5,2,97,46,4,3,194,127,97,192,189,4,1,196,193,4,1,194,244,
+  2,1,214,218,2,1,193,92,2,1,203,220,3,3,192,152,193,41,192,204,2,1,192,177,
+  3,2,193,95,192,177,5,3,194,126,145,194,126,3,3,194,126,22,193,131,0,6,10,1,
+  192,177,194,126,22,196,63,5,1,195,70,6,5,145,192,177,194,126,22,195,70,5,1,194,
+  244,3,2,145,192,177,3,1,193,22,2,1,194,161,3,3,194,31,22,200,55,5,1,194,
+  33,5,1,193,81,5,1,194,76,5,2,193,97,192,190,5,1,197,114,5,1,170,5,1,
+  193,71,5,1,203,221,0,6,10,1,194,161,194,31,22,194,127,3,3,193,132,22,194,33,
+  6,1,46,2,1,150,2,1,197,119,2,1,200,69,2,1,194,40,2,1,203,222,3,1,
+  192,245,2,1,192,210,3,2,193,95,192,210,3,2,22,20,4,1,193,254,4,1,194,33,
+  4,1,193,176,4,1,56,0,5,10,1,192,210,22,58,4,1,200,63,4,1,46,4,1,
+  194,127,2,1,214,219,2,1,196,195,3,2,195,228,196,195,3,2,22,197,118,4,1,193,
+  150,4,1,192,221,2,1,154,2,1,214,220,2,1,194,86,2,1,193,217,2,1,182,2,
+  1,193,130,0,4,10,1,193,130,192,190,4,2,22,129,3,1,203,218,3,2,145,193,130,
+  3,2,22,20,4,1,194,25,4,1,196,181,4,1,192,188,4,1,129,4,2,193,97,192,
+  190,4,1,195,69,4,1,194,32,4,1,194,219,4,1,193,119,4,1,192,177,4,1,195,
+  70,0,7,10,1,193,130,22,192,246,193,160,39,4,1,196,187,4,1,195,71,4,1,194,
+  100,4,1,194,127,4,1,203,223,4,1,195,145,4,1,195,136,4,1,194,244,2,1,195,
+  70,3,3,192,159,22,195,67,2,1,214,221,2,1,196,185,2,1,192,101,2,1,194,243,
+  3,2,22,20,0,5,10,1,194,243,22,194,30,4,1,193,241,4,1,193,71,4,1,195,
+  142,4,1,196,186,4,1,46,5,2,97,20,2,1,203,224,3,1,193,22,2,1,214,222,
+  2,1,194,242,2,1,192,246,3,1,194,158,3,2,145,192,246,5,6,195,72,145,195,72,
+  193,131,145,193,131,5,6,195,71,145,195,71,193,131,145,193,131,0,5,10,1,192,246,97,
+  195,230,4,1,203,219,4,1,196,185,2,1,214,223,2,1,214,224,2,1,200,52,2,1,
+  214,225,2,1,214,226,2,1,196,187,3,2,22,20,4,1,194,119,2,1,194,196,3,2,
+  22,20,4,1,197,116,4,1,198,95,4,1,198,96,0,5,10,1,194,196,22,193,131,4,
+  1,193,97,5,1,192,190,4,1,196,182,4,1,200,66,4,1,198,3,4,1,195,70,2,
+  1,214,227,2,1,196,190,3,5,145,196,190,195,144,145,195,144,3,1,193,22,2,1,198,
+  93,2,1,194,115,3,3,145,192,143,194,115,2,1,195,142,3,4,97,193,81,22,193,72,
+  0,7,10,1,195,142,97,194,234,22,193,53,2,1,214,228,2,1,193,218,3,1,192,190,
+  3,2,22,194,100,2,1,203,203,2,1,198,101,3,3,145,198,101,195,142,2,1,203,213,
+  2,1,203,221,2,1,193,235,3,2,145,193,235,2,1,214,229,2,1,214,230,2,1,203,
+  204,2,1,196,188,0,3,10,1,214,231,2,1,198,102,2,1,214,232,2,1,180,3,1,
+  192,245,3,1,192,190,3,2,22,193,57,4,1,193,119,2,1,195,71,3,8,145,195,71,
+  193,72,145,193,72,193,221,145,193,221,3,1,101,2,1,190,3,2,22,194,33,4,1,194,
+  76,4,1,192,246,4,1,194,115,0,5,10,1,190,22,195,229,4,1,193,150,2,1,194,
+  100,3,2,97,193,130,2,1,196,70,2,1,193,54,3,1,192,190,2,1,194,22,3,1,
+  193,22,2,1,214,233,2,1,200,70,2,1,196,71,3,2,145,196,71,5,6,195,72,145,
+  195,72,193,131,145,193,131,3,2,22,194,100,2,1,193,190,0,3,10,1,195,229,2,1,
+  202,75,2,1,197,50,3,3,22,193,240,193,22,4,2,65,193,221,2,1,196,186,3,5,
+  145,196,186,192,221,145,192,221,2,1,46,3,1,194,76,3,8,145,46,150,145,150,193,131,
+  145,193,131,5,3,198,102,145,198,102,5,5,46,192,56,145,46,192,56,3,1,46,4,1,
+  46,2,1,194,127,2,1,203,223,0,3,10,1,193,150,3,1,192,190,3,1,196,182,3,
+  1,194,101,4,2,22,194,30,3,2,22,194,30,4,1,193,119,4,5,46,97,46,97,46,
+  9,1,192,190,2,1,214,234,2,1,195,145,3,2,22,192,159,4,1,193,80,5,2,97,
+  191,4,1,194,243,4,1,46,0,3,10,1,214,235,2,1,198,99,3,2,22,194,128,4,
+  1,150,2,1,195,143,3,1,192,190,2,1,195,136,3,2,193,95,195,136,3,1,194,101,
+  2,1,194,246,3,1,192,143,3,4,22,20,97,129,6,1,173,4,1,194,75,4,1,129,
+  4,1,192,177,0,5,10,1,194,246,22,194,127,5,2,97,192,189,6,1,194,33,4,1,
+  193,150,2,1,214,236,2,1,214,237,2,1,214,238,2,1,193,164,3,2,22,20,4,1,
+  200,55,4,1,119,4,1,203,195,4,1,200,56,4,1,192,3,4,1,195,141,4,2,193,
+  240,193,22,0,5,10,1,193,164,22,193,131,4,1,194,65,4,1,129,4,1,193,97,4,
+  1,194,119,4,1,200,59,4,1,193,203,4,1,214,239,4,1,196,192,4,1,194,219,4,
+  1,198,91,4,1,150,4,1,192,246,4,1,198,101,4,1,193,190,4,3,46,97,194,76,
+  0,5,10,1,193,164,22,193,150,4,1,196,193,2,1,196,193,3,2,22,46,2,1,194,
+  244,3,2,22,20,4,1,193,230,4,1,194,32,4,1,194,100,2,1,214,240,2,1,214,
+  241,2,1,214,242,2,1,214,243,2,1,203,225,3,2,22,194,128,2,1,214,244,0,3,
+  10,1,192,221,3,3,101,22,194,32,3,1,193,22,2,1,203,216,2,1,214,245,2,1,
+  214,246,2,1,214,247,2,1,195,13,3,2,145,195,13,2,1,214,248,2,1,203,226,3,
+  2,203,190,193,22,2,1,214,249,2,1,203,198,2,1,194,230,3,4,145,194,230,97,196,
+  185,0,3,10,1,200,71,3,2,22,20,4,3,65,193,221,193,22,2,1,214,250,2,1,
+  214,251,0,4,197,120,192,135,55,43,1,2,2,214,252,0,1,214,253,0,1,214,254,0,
+  2,214,255,200,72,0,3,193,61,130,195,231,1,2,193,133,24,2,1,192,26,1,1,193,
+  156,0,2,195,53,215,0,1,1,1,0,3,215,1,24,196,170,0,5,194,7,195,26,197,
+  121,1,192,150,0,1,215,2,0,1,215,3,0,3,200,73,74,198,70,0,1,215,4,0,
+  1,215,5,0,3,192,198,4,20,2,1,56,2,1,58,2,1,192,102,2,1,195,8,2,
+  1,90,2,1,193,250,2,1,193,203,2,1,193,196,0,3,192,198,4,193,230,2,1,170,
+  2,1,192,226,2,1,192,149,2,1,194,10,2,1,193,174,2,1,167,2,1,193,80,2,
+  1,193,119,2,1,193,231,2,1,193,31,2,1,173,2,1,193,71,2,1,193,72,2,1,
+  193,28,2,1,193,92,0,3,192,198,4,53,2,1,150,2,1,192,238,2,1,192,210,2,
+  1,194,41,2,1,194,181,2,1,154,2,1,194,39,2,1,194,86,2,1,193,179,2,1,
+  193,217,2,1,182,2,1,193,228,2,1,193,218,2,1,193,180,2,1,193,235,0,3,192,
+  198,4,180,2,1,193,54,2,1,194,22,2,1,66,2,1,193,190,2,1,46,2,1,192,
+  109,2,1,193,178,2,1,193,234,2,1,193,208,2,1,194,129,2,1,196,116,2,1,192,
+  221,2,1,194,220,0,3,192,10,1,215,6,2,1,215,7,0,3,192,10,1,215,8,2,
+  1,215,9,2,1,215,10,2,1,215,11,2,1,215,12,2,1,215,13,2,1,215,14,2,
+  1,215,15,2,1,215,16,2,1,215,17,2,1,215,18,2,1,215,19,2,1,215,20,2,
+  1,215,21,2,1,215,22,2,1,215,23,0,3,192,10,1,215,24,2,1,215,25,2,1,
+  215,26,2,1,215,27,2,1,215,28,2,1,215,29,2,1,215,30,2,1,215,31,2,1,
+  215,32,2,1,215,33,2,1,215,34,2,1,215,35,2,1,215,36,2,1,215,37,2,1,
+  215,38,2,1,215,39,0,3,192,10,1,215,40,2,1,215,41,2,1,215,42,2,1,215,
+  43,2,1,215,44,2,1,215,45,2,1,215,46,2,1,215,47,2,1,215,48,2,1,215,
+  49,2,1,215,50,2,1,215,51,2,1,215,52,2,1,215,53,2,1,215,54,2,1,215,
+  55,0,3,192,10,1,215,56,2,1,215,57,2,1,215,58,2,1,215,59,2,1,215,60,
+  2,1,215,61,2,1,215,62,2,1,215,63,2,1,215,64,2,1,215,65,2,1,215,66,
+  2,1,215,67,2,1,215,68,2,1,215,69,2,1,215,70,2,1,215,71,0,3,192,10,
+  1,215,72,2,1,215,73,2,1,215,74,2,1,215,75,2,1,215,76,2,1,215,77,2,
+  1,215,78,2,1,215,79,2,1,215,80,2,1,215,81,2,1,215,82,2,1,215,83,2,
+  1,215,84,2,1,215,85,2,1,215,86,2,1,215,87,0,3,192,10,1,215,88,2,1,
+  215,89,2,1,215,90,2,1,215,91,2,1,215,92,2,1,215,93,2,1,215,94,2,1,
+  215,95,2,1,215,96,2,1,215,97,2,1,215,98,2,1,215,99,2,1,215,100,2,1,
+  215,101,2,1,215,102,2,1,215,103,0,3,192,10,1,215,104,0,4,41,5,0,20,4,
+  2,2,192,182,5,1,192,96,3,2,195,232,193,209,5,2,2,193,35,4,1,195,196,4,
+  1,129,3,2,203,227,90,3,2,195,74,53,5,2,2,192,96,3,2,203,228,90,3,1,
+  194,113,3,2,194,117,193,106,3,2,203,229,53,3,2,203,230,193,106,0,5,41,5,0,
+  203,231,192,108,3,2,203,232,58,3,1,200,74,3,1,193,209,4,2,2,193,35,5,1,
+  192,96,5,2,83,71,3,3,193,3,192,121,193,106,3,2,194,195,53,3,1,203,233,3,
+  1,193,227,3,1,198,103,3,1,200,14,3,3,51,198,104,53,4,1,53,3,1,200,75,
+  0,4,41,5,0,195,196,3,1,198,105,3,1,203,234,3,1,203,235,3,1,203,236,3,
+  1,203,237,3,1,56,4,2,2,192,96,3,1,195,52,3,1,193,216,4,2,2,193,35,
+  5,1,82,5,2,76,82,5,1,192,169,3,1,194,49,4,2,2,192,169,0,4,41,5,
+  0,192,188,4,2,2,193,35,5,1,82,5,2,39,82,5,2,76,82,5,1,192,169,3,
+  1,194,118,4,2,2,195,75,3,1,195,21,4,2,2,193,35,3,1,196,55,3,1,194,
+  38,4,2,2,193,35,5,2,76,82,5,1,71,6,2,24,82,0,6,41,5,0,194,38,
+  2,200,76,3,1,200,77,3,1,129,4,2,2,193,35,5,1,82,5,1,71,3,2,195,
+  55,1,3,1,199,171,3,1,58,4,2,2,192,96,5,1,192,127,5,1,192,136,3,1,
+  194,71,4,2,2,192,182,5,1,192,127,3,1,200,78,0,4,41,5,0,192,199,3,2,
+  194,99,20,4,2,194,117,193,106,4,3,193,3,192,121,193,106,4,1,56,4,2,192,121,
+  193,106,4,1,195,135,3,1,196,196,4,4,2,51,192,127,192,132,3,1,194,214,3,1,
+  90,4,2,2,193,35,5,1,82,5,1,71,5,2,83,71,3,2,203,238,193,209,0,4,
+  41,5,0,203,239,3,2,194,102,193,227,4,1,198,103,4,1,203,240,4,1,198,106,4,
+  1,195,233,4,1,203,241,4,1,203,242,4,1,203,243,3,1,196,197,3,1,198,87,3,
+  1,195,197,3,2,192,121,193,106,3,1,198,106,3,2,198,104,53,3,2,200,15,196,162,
+  0,5,41,5,0,193,16,197,122,3,1,195,233,3,1,53,4,2,2,192,96,3,1,192,
+  108,4,2,2,197,105,3,1,198,107,3,1,192,238,4,2,2,193,35,5,2,76,82,3,
+  1,194,73,3,1,194,11,3,2,192,56,195,196,4,1,194,156,4,1,193,27,4,1,193,
+  229,0,4,41,5,0,195,122,3,2,194,176,192,108,3,1,195,23,4,2,2,192,96,3,
+  2,203,244,1,3,1,192,101,3,1,200,16,3,1,198,108,4,2,2,193,35,3,2,192,
+  114,58,5,2,2,192,169,4,1,46,3,1,196,49,3,2,194,160,193,227,4,1,193,216,
+  4,1,194,49,0,5,41,5,0,194,160,1,3,2,193,63,46,5,2,2,71,3,1,203,
+  245,3,1,193,54,4,2,2,193,35,5,2,76,82,3,1,194,156,3,1,203,246,3,1,
+  203,247,3,1,203,248,3,1,197,88,3,1,46,4,2,2,192,96,5,2,51,192,31,5,
+  1,192,136,0,4,41,5,0,196,162,3,2,200,17,194,71,3,1,194,63,3,1,193,178,
+  3,1,176,3,1,197,123,3,1,195,135,3,1,195,22,4,3,2,194,215,197,122,5,1,
+  192,96,3,1,9,3,1,196,198,3,1,193,27,3,1,193,229,4,2,2,193,35,5,1,
+  192,96,0,4,41,5,0,203,249,3,1,194,90,4,2,2,192,182,5,1,193,35,5,1,
+  192,96,3,1,203,250,2,3,32,20,194,71,3,2,192,188,194,38,3,2,193,54,194,156,
+  1,1,195,134,1,3,0,215,105,53,2,1,203,251,2,3,3,5,193,216,1,1,203,148,
+  1,3,3,0,20,4,2,2,192,182,0,6,41,3,0,20,2,192,96,3,2,195,232,193,
+  209,5,2,2,193,35,4,1,195,196,4,1,129,3,2,203,227,90,3,2,195,74,53,5,
+  2,2,192,96,3,2,203,228,90,3,1,194,113,3,2,194,117,193,106,3,2,203,229,53,
+  3,2,203,230,193,106,3,2,203,231,192,108,3,2,203,232,58,3,1,200,74,0,4,41,
+  3,0,193,209,4,2,2,193,35,5,1,192,96,5,2,83,71,3,3,193,3,192,121,193,
+  106,3,2,194,195,53,3,1,203,233,3,1,193,227,3,1,198,103,3,1,200,14,3,3,
+  51,198,104,53,4,1,53,3,1,200,75,3,1,195,196,3,1,198,105,3,1,203,234,0,
+  4,41,3,0,203,235,3,1,203,236,3,1,203,237,3,1,56,4,2,2,192,96,3,1,
+  195,52,3,1,193,216,4,2,2,193,35,5,1,82,5,2,76,82,5,1,192,169,3,1,
+  194,49,4,2,2,192,169,3,1,192,188,4,2,2,193,35,5,1,82,0,7,41,3,0,
+  192,188,2,39,82,5,2,76,82,5,1,192,169,3,1,194,118,4,2,2,195,75,3,1,
+  195,21,4,2,2,193,35,3,1,196,55,3,1,194,38,4,2,2,193,35,5,2,76,82,
+  5,1,71,6,2,24,82,5,1,200,76,3,1,200,77,3,1,129,0,6,41,3,0,129,
+  2,193,35,5,1,82,5,1,71,3,2,195,55,1,3,1,199,171,3,1,58,4,2,2,
+  192,96,5,1,192,127,5,1,192,136,3,1,194,71,4,2,2,192,182,5,1,192,127,3,
+  1,200,78,3,1,192,199,3,2,194,99,20,4,2,194,117,193,106,0,7,41,3,0,194,
+  99,193,3,192,121,193,106,4,1,56,4,2,192,121,193,106,4,1,195,135,3,1,196,196,
+  4,4,2,51,192,127,192,132,3,1,194,214,3,1,90,4,2,2,193,35,5,1,82,5,
+  1,71,5,2,83,71,3,2,203,238,193,209,3,1,203,239,3,2,194,102,193,227,4,1,
+  198,103,0,5,41,3,0,194,102,203,240,4,1,198,106,4,1,195,233,4,1,203,241,4,
+  1,203,242,4,1,203,243,3,1,196,197,3,1,198,87,3,1,195,197,3,2,192,121,193,
+  106,3,1,198,106,3,2,215,106,193,227,3,2,198,104,53,3,2,200,15,196,162,3,2,
+  196,199,53,3,2,193,16,197,122,0,4,41,3,0,195,233,3,1,53,4,2,2,192,96,
+  3,1,192,108,4,2,2,197,105,3,1,198,107,3,1,203,251,3,1,192,238,4,2,2,
+  193,35,5,2,76,82,3,1,194,73,3,1,194,11,3,2,192,56,195,196,4,1,194,156,
+  4,1,193,27,4,1,193,229,0,4,41,3,0,195,122,3,2,194,176,192,108,3,2,194,
+  112,194,63,3,1,195,23,4,2,2,192,96,3,2,203,244,1,3,1,192,101,3,1,200,
+  16,3,1,198,108,4,2,2,193,35,3,2,192,114,58,5,2,2,192,169,4,1,46,3,
+  1,196,49,3,2,194,160,193,227,4,1,193,216,0,5,41,3,0,194,160,194,49,4,1,
+  1,3,2,193,63,46,5,2,2,71,3,3,196,200,195,55,1,4,1,193,54,4,1,195,
+  135,3,1,203,245,3,1,193,54,4,2,2,193,35,5,2,76,82,3,2,215,107,193,54,
+  3,1,194,156,3,1,203,246,3,1,203,247,3,1,203,248,0,4,41,3,0,197,88,3,
+  1,46,4,2,2,192,96,5,2,51,192,31,5,1,192,136,3,1,196,162,3,2,200,17,
+  194,71,3,2,215,108,196,162,3,1,194,63,3,1,193,178,3,2,194,239,195,21,3,1,
+  176,3,1,197,123,3,1,195,135,3,1,195,22,4,3,2,194,215,197,122,0,6,41,3,
+  0,195,22,2,192,96,3,1,9,3,1,196,198,3,1,193,27,3,1,193,229,4,2,2,
+  193,35,5,1,192,96,3,1,203,249,3,1,194,90,4,2,2,192,182,5,1,193,35,5,
+  1,192,96,3,1,203,250,2,3,32,20,194,71,3,2,192,188,194,38,3,2,193,54,194,
+  156,0,3,41,195,181,1,0,1,196,72,1,1,196,159,1,3,2,39,203,252,2,2,37,
+  203,252,0,2,198,109,11,0,1,215,109,0,1,215,110,0,2,203,253,194,130,1,1,203,
+  254,0,2,193,21,11,1,3,2,39,200,76,0,3,194,197,135,192,124,1,1,195,202,1,
+  3,192,92,91,27,0,2,215,111,193,232,0,2,215,112,195,59,0,3,199,48,215,113,11,
+  1,3,193,171,195,110,11,0,4,203,255,204,0,204,1,11,0,1,200,79,0,2,198,110,
+  215,114,1,1,215,115,1,1,1,0,2,215,116,199,135,0,3,194,2,164,66,0,6,194,
+  131,11,122,116,24,172,6,2,2,120,7,1,174,7,1,193,87,3,3,96,24,172,6,2,
+  2,120,0,8,194,131,11,122,96,24,172,2,174,7,1,193,87,3,4,83,24,193,51,39,
+  6,1,37,5,2,192,240,39,6,1,37,5,1,193,87,4,2,2,120,5,1,174,0,2,
+  215,117,203,160,0,3,215,118,196,126,197,64,0,2,199,120,202,54,0,4,192,81,5,0,
+  194,228,3,1,196,201,3,1,198,34,3,1,196,148,0,4,192,81,5,0,195,52,3,1,
+  193,216,3,1,194,49,3,1,192,188,3,1,194,227,3,1,194,118,3,1,195,21,3,1,
+  194,29,3,1,195,223,3,1,200,80,3,1,204,2,3,1,192,18,3,1,196,149,3,1,
+  199,190,3,2,171,20,4,1,194,226,0,5,192,81,5,0,171,56,4,1,58,4,1,53,
+  4,1,192,233,3,1,197,92,3,1,197,124,3,1,195,120,3,2,192,114,20,4,1,194,
+  226,4,1,56,4,1,58,4,1,53,4,1,192,233,3,1,196,202,3,1,197,73,3,1,
+  195,185,0,4,192,81,5,0,195,16,3,1,196,151,3,1,197,74,3,1,198,111,1,3,
+  3,0,194,228,3,1,196,201,3,1,198,34,3,1,196,148,3,1,195,52,3,1,193,216,
+  3,1,194,49,3,1,192,188,3,1,194,227,3,1,194,118,3,1,195,21,3,1,194,29,
+  0,4,192,81,3,0,195,223,3,1,200,80,3,1,204,2,3,1,192,18,3,1,196,149,
+  3,1,199,190,3,2,171,20,4,1,194,226,4,1,56,4,1,58,4,1,53,4,1,192,
+  233,3,1,197,92,3,1,197,124,3,1,195,120,3,2,192,114,20,0,5,192,81,3,0,
+  192,114,194,226,4,1,56,4,1,58,4,1,53,4,1,192,233,3,1,196,202,3,1,197,
+  73,3,1,195,185,3,1,195,16,3,1,196,151,3,1,197,74,3,1,198,111,0,1,204,
+  3,1,1,215,119,0,2,204,4,200,81,1,1,204,5,0,3,109,194,21,1,1,2,192,
+  31,192,132,1,1,195,46,1,1,193,121,1,2,14,115,2,1,85,2,1,78,2,1,133,
+  2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,2,51,193,121,
+  1,2,196,133,195,146,0,3,109,192,127,192,132,1,1,200,82,1,2,215,120,194,186,1,
+  2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,199,35,2,1,194,228,2,
+  1,192,32,2,1,196,50,2,1,193,2,2,1,192,107,2,2,194,114,20,3,1,56,3,
+  1,53,0,3,109,0,192,142,2,1,191,2,1,192,220,2,1,198,112,2,1,204,6,2,
+  1,193,25,2,1,192,232,2,1,56,2,1,193,18,2,1,192,3,2,1,196,203,2,1,
+  192,239,2,1,200,83,2,2,193,74,192,104,2,1,129,2,2,75,176,0,3,109,0,58,
+  2,1,192,80,2,1,192,102,2,1,193,60,2,1,197,72,2,1,90,2,1,192,144,2,
+  1,204,7,2,1,170,2,1,193,154,2,1,196,140,2,1,167,2,2,215,121,192,220,2,
+  1,173,2,1,192,95,2,1,192,251,0,3,109,0,197,63,2,1,192,145,2,1,53,2,
+  1,193,4,2,1,204,8,2,1,150,2,1,192,195,2,1,194,11,2,1,154,2,1,195,
+  122,2,1,194,6,2,1,182,2,1,192,101,2,2,192,114,20,3,1,56,3,1,53,0,
+  3,109,0,193,33,2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,
+  1,193,219,2,1,192,103,2,1,200,84,2,1,192,194,2,2,123,112,3,1,193,73,3,
+  1,98,3,1,193,34,2,1,176,2,1,198,5,0,3,109,0,192,221,2,1,193,236,1,
+  1,194,186,1,2,1,192,203,2,1,194,92,2,1,193,82,3,1,194,92,3,1,65,3,
+  1,54,3,1,193,20,2,3,51,193,82,193,20,2,3,139,200,85,59,2,2,192,143,193,
+  82,2,1,193,191,2,1,215,122,2,1,192,16,0,4,109,1,200,85,193,82,2,1,193,
+  20,2,1,193,47,1,3,197,125,1,197,126,3,1,198,113,1,3,16,1,192,45,3,1,
+  192,74,3,1,192,98,3,1,199,35,3,1,194,228,3,2,194,114,56,4,2,171,56,4,
+  1,53,3,1,56,3,1,58,3,1,192,80,0,4,109,16,1,53,3,1,193,4,3,1,
+  204,8,3,2,200,86,56,3,2,192,114,56,4,1,53,3,1,46,3,1,193,219,3,1,
+  192,103,3,1,200,84,3,2,123,112,4,1,193,73,4,1,98,4,1,193,34,0,1,192,
+  96,0,2,215,123,1,0,2,192,241,192,242,1,5,215,124,2,20,59,194,18,1,1,200,
+  87,1,4,2,193,51,110,55,2,3,39,110,55,2,3,37,110,55,2,3,192,240,110,55,
+  0,2,195,234,215,125,1,1,215,126,1,1,215,127,1,1,215,128,1,1,215,129,1,1,
+  215,130,0,2,215,131,204,9,0,2,215,132,193,175,0,2,14,115,0,3,14,115,192,168,
+  2,2,192,209,192,104,1,1,85,2,1,192,168,2,2,192,209,192,104,1,1,78,2,1,
+  192,168,2,2,192,209,192,104,1,1,133,2,1,192,168,2,2,192,209,192,104,1,1,49,
+  2,1,192,168,2,2,192,209,192,104,1,1,128,2,1,192,168,0,4,14,128,192,209,192,
+  104,1,1,117,2,1,192,168,2,2,192,209,192,104,1,1,65,2,1,192,168,2,2,192,
+  209,192,104,1,1,54,2,1,192,168,2,2,192,209,192,104,1,1,192,33,2,1,192,168,
+  2,2,192,209,192,104,0,3,195,147,40,194,84,2,2,204,10,198,114,3,1,199,241,0,
+  4,195,147,40,204,11,194,247,3,1,195,148,2,2,215,133,194,84,2,2,199,241,194,84,
+  2,2,204,12,194,247,3,1,195,148,0,2,215,134,215,135,0,5,193,98,45,48,14,115,
+  4,1,85,4,1,78,4,1,133,4,1,49,4,1,128,4,1,117,4,1,65,4,1,54,
+  0,5,193,98,45,48,14,192,33,3,2,29,192,66,1,4,192,15,45,14,115,4,1,85,
+  4,1,78,4,1,133,4,1,49,4,1,128,4,1,117,4,1,65,4,1,54,3,2,29,
+  192,66,3,3,48,14,115,5,1,85,5,1,78,5,1,133,0,6,193,98,192,15,45,48,
+  14,49,5,1,128,5,1,117,5,1,65,5,1,54,5,1,192,33,4,2,29,192,66,0,
+  5,200,46,199,29,11,15,54,1,1,204,13,0,2,215,136,195,201,0,4,204,14,195,47,
+  204,15,104,1,1,104,0,3,215,137,203,159,11,0,2,215,138,104,0,2,215,139,42,0,
+  4,192,115,192,116,14,115,0,4,192,115,192,116,14,85,3,1,78,3,1,133,3,1,49,
+  3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,2,2,51,193,121,2,4,193,
+  103,74,195,113,42,2,2,196,133,195,146,2,2,86,154,2,2,0,20,3,1,192,45,3,
+  1,192,32,0,4,192,115,192,116,0,193,2,3,1,192,107,3,1,192,142,3,1,191,3,
+  1,192,220,3,1,193,25,3,1,192,232,3,1,56,3,1,192,3,3,1,192,239,3,1,
+  129,3,1,58,3,1,192,80,3,1,192,102,3,1,90,3,1,192,144,0,4,192,115,192,
+  116,0,170,3,1,193,154,3,1,167,3,1,173,3,1,192,95,3,1,192,251,3,1,192,
+  145,3,1,53,3,1,150,3,1,192,195,3,1,154,3,1,182,3,1,192,101,3,1,193,
+  33,3,1,180,3,1,192,167,0,4,192,115,192,116,0,192,214,3,1,46,3,1,192,103,
+  3,1,192,194,3,1,176,3,1,198,5,3,1,192,221,2,2,192,12,154,3,1,176,2,
+  3,195,76,197,127,1,2,2,1,192,203,3,1,193,82,3,1,200,88,3,1,193,191,2,
+  1,193,20,2,3,16,1,192,45,0,5,192,115,192,116,16,1,192,74,4,1,56,4,1,
+  58,4,1,192,80,4,1,53,4,1,46,4,1,192,103,0,1,215,140,0,2,215,141,200,
+  89,0,2,195,203,1,1,1,194,87,1,1,22,0,2,215,142,11,0,2,215,143,203,180,
+  0,2,204,16,104,1,1,11,0,3,215,144,51,215,145,0,4,194,5,192,146,204,17,11,
+  0,1,197,128,1,2,2,200,90,2,1,195,113,3,2,24,200,90,0,1,215,146,0,5,
+  194,248,192,146,200,91,194,151,198,84,4,2,195,66,195,224,6,2,192,26,164,2,1,199,
+  47,3,4,2,192,56,215,147,194,87,2,1,215,148,2,1,204,18,3,2,192,26,164,2,
+  1,215,149,0,3,194,248,192,146,204,19,3,2,192,26,164,0,1,196,158,1,1,104,0,
+  3,192,176,194,21,1,1,2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,
+  192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,
+  25,0,3,192,176,0,192,232,2,1,56,2,1,192,3,2,1,192,239,2,1,129,2,1,
+  58,2,1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,
+  1,167,2,1,173,2,1,192,95,2,1,192,251,0,3,192,176,0,192,145,2,1,53,2,
+  1,150,2,1,192,195,2,1,154,2,1,194,6,2,1,182,2,1,192,101,2,1,193,33,
+  2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,2,1,
+  192,194,0,3,192,176,0,176,1,2,1,192,203,2,1,193,191,2,1,193,20,2,1,193,
+  47,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,58,3,1,192,
+  80,3,1,53,3,1,46,3,1,192,103,3,2,123,98,4,1,193,34,0,2,196,32,1,
+  0,1,215,150,0,4,192,7,125,172,194,215,2,1,215,151,2,1,215,152,2,1,215,153,
+  2,1,215,154,2,1,215,155,2,1,215,156,2,1,215,157,2,1,215,158,2,1,215,159,
+  2,1,215,160,2,1,215,161,2,1,215,162,2,1,215,163,0,3,192,7,125,215,164,2,
+  1,215,165,2,1,215,166,2,1,215,167,2,1,215,168,2,1,215,169,2,1,215,170,2,
+  1,215,171,2,1,215,172,2,1,215,173,2,1,215,174,2,1,215,175,2,1,215,176,2,
+  1,215,177,2,1,215,178,2,1,215,179,0,3,192,7,125,215,180,2,1,215,181,2,1,
+  215,182,2,1,215,183,2,1,215,184,2,1,215,185,2,1,215,186,2,1,215,187,2,1,
+  215,188,2,1,215,189,2,1,215,190,2,1,215,191,2,1,215,192,2,1,215,193,2,1,
+  215,194,2,1,215,195,0,3,192,7,125,215,196,2,1,215,197,2,1,215,198,2,1,215,
+  199,2,2,83,194,215,2,1,215,200,2,1,215,201,2,1,215,202,2,1,215,203,2,1,
+  215,204,2,1,215,205,2,1,215,206,2,1,215,207,2,1,215,208,2,1,215,209,2,1,
+  215,210,0,3,192,7,125,215,211,2,1,215,212,2,1,215,213,2,1,215,214,2,1,215,
+  215,2,1,215,216,2,1,215,217,2,1,215,218,2,1,215,219,2,1,215,220,2,1,215,
+  221,2,1,215,222,2,1,215,223,2,1,215,224,2,1,215,225,2,1,215,226,0,3,192,
+  7,125,215,227,2,1,215,228,2,1,215,229,2,1,215,230,2,1,215,231,2,1,215,232,
+  2,1,215,233,2,1,215,234,2,1,215,235,2,1,215,236,2,1,215,237,2,1,215,238,
+  2,1,215,239,2,1,215,240,2,1,215,241,2,1,215,242,0,3,192,7,125,215,243,2,
+  1,215,244,2,1,215,245,2,1,215,246,2,1,215,247,2,1,215,248,0,2,202,74,1,
+  0,1,204,20,0,2,59,38,1,1,193,252,1,1,192,242,1,1,97,0,2,193,14,120,
+  1,1,192,211,1,1,197,129,1,2,192,124,104,0,2,193,14,215,249,1,2,193,206,192,
+  156,1,1,193,204,1,1,43,1,2,200,92,195,176,0,3,51,192,31,192,132,1,3,45,
+  14,115,3,1,85,3,1,78,3,1,133,3,1,49,3,1,128,3,1,117,3,1,65,3,
+  1,54,2,2,29,192,66,0,3,51,193,90,164,1,2,193,61,193,156,1,1,196,72,1,
+  2,116,193,69,1,2,193,170,42,1,3,204,21,193,124,42,1,1,194,212,1,1,193,193,
+  1,1,194,48,1,4,39,194,4,192,172,130,1,2,193,133,24,2,1,192,26,1,2,135,
+  192,124,1,3,204,22,193,124,42,1,3,215,250,193,124,42,1,2,197,130,192,172,0,3,
+  51,197,130,192,173,3,2,2,193,192,1,2,194,77,194,212,1,1,97,1,1,194,198,1,
+  1,194,249,2,2,193,124,42,1,2,193,127,42,1,4,37,194,4,192,173,130,1,2,193,
+  204,192,242,1,2,43,194,48,2,1,194,12,1,2,215,251,192,168,1,3,71,192,146,1,
+  1,1,193,181,1,1,194,199,0,2,51,193,182,1,2,200,42,42,1,1,194,12,1,2,
+  96,193,69,1,2,83,119,3,3,51,39,195,235,4,2,37,195,235,3,2,39,195,235,2,
+  1,192,124,1,2,195,4,195,202,0,2,215,252,200,93,0,5,195,77,164,66,192,26,192,
+  172,4,1,192,173,1,5,193,151,164,66,192,26,192,172,5,1,192,173,2,4,192,172,192,
+  26,164,66,0,6,195,77,193,151,192,173,192,26,164,66,0,3,192,17,5,192,52,2,1,
+  193,239,2,1,192,18,2,1,152,2,1,192,58,2,1,192,210,2,1,192,175,2,1,98,
+  2,1,192,27,1,3,44,5,192,20,2,2,3,192,20,3,1,56,3,1,58,3,1,192,
+  83,1,2,194,78,197,131,0,3,192,17,3,193,239,2,1,192,210,0,3,197,11,196,154,
+  1,1,2,195,60,1,1,1,11,0,1,215,253,0,3,204,23,74,200,94,0,2,116,192,
+  97,1,2,195,62,192,169,1,3,37,189,195,236,1,1,193,69,2,3,2,120,57,0,3,
+  194,183,194,34,174,1,3,3,194,34,174,1,5,174,2,39,110,55,3,3,37,110,55,0,
+  3,198,115,197,132,82,3,2,2,59,2,2,195,78,82,4,2,2,59,0,2,183,204,24,
+  1,1,27,2,5,24,37,49,193,46,114,2,2,193,66,119,2,4,108,74,187,27,2,2,
+  66,119,2,3,2,193,56,108,3,2,51,71,3,2,193,205,192,97,3,2,172,71,3,3,
+  192,34,174,192,97,3,3,185,174,192,97,0,5,183,27,2,195,78,192,169,3,3,3,193,
+  205,192,97,4,2,174,192,97,3,2,193,255,108,4,1,91,1,2,55,27,2,3,45,63,
+  27,1,2,195,237,27,1,2,194,197,27,1,2,51,27,1,2,198,116,27,1,10,192,153,
+  2,186,39,195,27,183,192,153,2,186,37,6,5,187,192,153,2,186,37,5,2,193,66,119,
+  5,2,66,119,4,1,108,0,7,183,192,153,2,186,37,193,66,119,5,2,66,119,4,1,
+  91,1,2,75,27,2,2,195,237,27,1,2,195,238,194,62,1,2,195,14,27,1,1,197,
+  133,1,2,48,27,1,2,101,27,1,2,174,192,97,1,2,192,92,27,3,5,108,74,187,
+  192,92,27,3,2,66,119,3,3,2,25,193,183,4,3,51,172,71,0,6,183,192,92,27,
+  2,75,193,183,4,3,171,193,255,108,6,1,91,4,2,185,193,183,4,2,196,199,193,183,
+  4,3,193,104,75,193,183,2,2,194,197,27,2,2,195,238,194,62,2,2,194,240,27,1,
+  2,192,174,27,1,3,54,198,117,27,1,5,194,35,27,2,174,198,118,1,2,63,27,3,
+  3,196,24,174,192,97,1,2,194,240,27,0,2,200,95,1,0,4,215,254,193,162,91,27,
+  0,1,195,222,1,1,104,0,1,204,25,0,3,204,26,204,27,1,0,2,215,255,202,62,
+  0,2,216,0,104,0,3,216,1,74,204,28,0,1,202,176,0,3,196,204,2,216,2,0,
+  1,216,3,0,1,216,4,0,5,127,193,99,193,248,56,82,3,2,58,82,3,2,197,134,
+  195,239,3,1,195,239,0,4,127,193,99,193,248,192,169,3,1,204,29,4,1,82,2,2,
+  139,192,31,3,1,120,3,1,59,3,1,192,127,3,1,192,124,3,2,171,192,127,3,2,
+  200,96,192,31,3,1,83,4,1,195,239,3,1,193,87,2,3,39,172,195,239,2,2,135,
+  192,31,3,1,27,0,4,127,193,99,135,120,3,1,59,3,1,192,127,3,1,192,124,3,
+  2,171,192,127,3,2,200,96,192,31,3,1,83,4,1,195,239,3,1,193,87,2,3,196,
+  33,172,195,239,3,2,83,195,239,2,3,37,172,195,239,1,2,51,42,1,2,0,20,2,
+  1,216,5,2,1,62,0,3,127,0,192,20,3,1,99,2,1,204,30,2,1,56,2,1,
+  193,13,2,1,195,149,2,1,192,113,3,1,152,2,1,192,2,3,2,98,99,2,1,192,
+  18,2,1,216,6,2,1,58,2,1,194,71,2,1,192,83,3,1,178,0,5,127,0,192,
+  83,178,99,3,1,152,4,1,99,3,1,99,4,2,2,59,3,2,2,59,4,4,140,194,
+  18,24,38,2,1,192,6,3,1,178,3,2,98,99,2,1,198,39,2,1,112,2,1,199,
+  139,2,2,171,58,3,1,46,2,1,178,0,4,127,0,178,152,4,1,99,3,1,99,3,
+  2,2,59,2,1,152,3,1,178,4,1,99,3,1,99,3,2,2,59,2,2,197,127,20,
+  3,1,58,3,1,53,3,1,46,2,1,53,2,1,197,135,2,1,216,7,0,3,127,0,
+  195,191,2,1,197,124,2,1,192,58,3,1,152,2,2,204,31,195,44,3,1,193,53,2,
+  1,98,3,1,99,2,1,216,8,2,2,204,32,58,3,1,46,2,1,99,3,1,192,83,
+  4,1,99,3,1,192,6,4,1,98,0,4,127,0,99,178,3,1,152,3,1,192,58,4,
+  1,98,3,1,99,3,1,192,5,4,1,98,3,2,2,59,5,1,57,2,2,192,114,58,
+  2,2,195,150,193,53,3,1,204,30,3,1,193,13,3,1,195,49,3,1,192,188,3,1,
+  192,83,0,4,127,0,195,150,192,135,3,1,197,124,3,1,46,2,1,192,5,3,2,98,
+  99,3,1,99,2,1,195,199,2,1,46,3,1,152,2,1,200,97,2,1,198,119,2,1,
+  192,9,2,2,123,178,2,1,192,77,3,1,98,2,1,192,109,0,3,127,0,204,33,2,
+  1,216,9,2,1,193,234,2,1,193,208,2,1,216,10,2,1,192,57,2,1,200,98,2,
+  1,194,91,1,4,192,4,216,11,192,209,192,104,1,4,1,53,2,192,211,1,3,216,12,
+  0,197,136,0,1,216,13,0,2,216,14,11,0,1,204,34,0,1,196,73,1,2,74,216,
+  15,0,3,196,73,74,196,170,1,3,2,216,16,216,17,0,1,194,84,1,2,198,120,216,
+  18,2,1,216,19,2,1,216,20,1,1,204,35,0,3,192,157,192,42,192,211,0,2,216,
+  21,216,22,0,1,204,36,0,3,13,6,201,113,2,1,201,114,2,1,201,115,2,1,201,
+  116,2,1,201,117,2,1,216,23,0,3,13,6,201,118,2,1,216,24,2,1,216,25,2,
+  1,201,119,2,1,201,120,2,1,201,121,2,1,201,122,2,1,201,123,2,1,201,124,2,
+  1,201,125,2,1,201,126,2,1,216,26,2,1,201,127,2,1,201,128,2,1,201,129,2,
+  1,216,27,0,3,13,6,201,130,2,1,201,131,2,1,201,132,2,1,201,133,2,1,201,
+  134,2,1,201,135,2,1,201,136,2,1,201,137,2,1,201,138,2,1,201,139,2,1,201,
+  140,2,1,201,141,2,1,201,142,2,1,201,143,2,1,201,144,2,1,216,28,0,3,13,
+  6,201,145,2,1,201,146,2,1,201,147,2,1,201,148,2,1,201,149,2,1,201,150,2,
+  1,201,151,2,1,201,152,2,1,216,29,2,1,201,153,2,1,201,154,2,1,216,30,2,
+  1,201,155,2,1,216,31,2,1,201,156,2,1,201,157,0,3,13,6,201,158,2,1,201,
+  159,2,1,201,160,2,1,201,161,2,1,201,162,2,1,201,163,2,1,201,164,2,1,201,
+  165,2,1,201,166,2,1,201,167,2,1,201,168,2,1,201,169,2,1,201,170,2,1,201,
+  171,2,1,201,172,2,1,201,173,0,3,13,6,201,174,2,1,201,175,2,1,201,176,2,
+  1,201,177,2,1,201,178,2,1,201,179,2,1,201,180,2,1,201,181,2,1,201,182,2,
+  1,201,183,2,1,216,32,2,1,216,33,2,1,216,34,2,1,216,35,2,1,216,36,2,
+  1,216,37,0,3,13,6,216,38,2,1,216,39,2,1,216,40,2,1,216,41,2,1,216,
+  42,2,1,216,43,2,1,216,44,2,1,216,45,2,1,216,46,2,1,216,47,2,1,216,
+  48,2,1,216,49,2,1,216,50,2,1,216,51,2,1,216,52,2,1,216,53,0,3,13,
+  6,216,54,2,1,216,55,2,1,216,56,2,1,216,57,2,1,216,58,2,1,216,59,2,
+  1,216,60,2,1,216,61,2,1,216,62,2,1,216,63,2,1,216,64,2,1,216,65,2,
+  1,204,37,2,1,204,38,2,1,204,39,2,1,204,40,0,3,13,6,204,41,2,1,216,
+  66,2,1,204,42,2,1,204,43,2,1,204,44,2,1,204,45,2,2,195,173,200,99,2,
+  1,216,67,2,1,216,68,2,1,216,69,2,1,216,70,2,1,216,71,2,1,216,72,2,
+  1,216,73,2,1,216,74,2,1,216,75,0,3,13,6,216,76,2,1,216,77,2,1,216,
+  78,2,1,216,79,2,1,216,80,2,1,216,81,2,1,216,82,2,1,216,83,2,1,216,
+  84,2,1,216,85,2,1,216,86,2,1,216,87,2,1,216,88,2,1,216,89,2,1,216,
+  90,2,1,216,91,0,3,13,6,216,92,2,1,216,93,2,1,216,94,2,1,216,95,2,
+  1,216,96,2,1,216,97,2,1,216,98,2,1,216,99,2,1,216,100,2,1,216,101,2,
+  1,216,102,2,1,216,103,2,1,216,104,2,1,216,105,2,1,216,106,2,1,216,107,0,
+  3,13,6,216,108,2,1,216,109,2,1,216,110,2,1,216,111,2,1,216,112,2,1,216,
+  113,2,1,216,114,2,1,216,115,2,1,216,116,2,1,216,117,2,1,216,118,2,1,216,
+  119,2,1,216,120,2,1,216,121,2,1,216,122,2,1,216,123,0,3,13,6,216,124,2,
+  1,216,125,2,1,216,126,2,1,216,127,2,1,216,128,2,1,216,129,2,1,216,130,2,
+  1,216,131,2,1,216,132,2,1,216,133,2,1,216,134,2,1,216,135,2,1,216,136,2,
+  1,216,137,2,1,216,138,2,1,216,139,0,3,13,6,216,140,2,1,216,141,2,1,216,
+  142,2,1,216,143,2,1,216,144,2,1,216,145,2,1,216,146,2,1,216,147,2,1,216,
+  148,2,1,216,149,2,1,216,150,2,1,216,151,2,1,216,152,2,1,216,153,2,1,216,
+  154,2,1,216,155,0,3,13,6,216,156,2,1,216,157,2,1,216,158,2,1,216,159,2,
+  1,216,160,2,1,216,161,2,1,216,162,2,1,216,163,2,1,216,164,2,1,216,165,2,
+  1,216,166,2,1,216,167,2,1,216,168,2,1,216,169,2,1,216,170,2,1,216,171,0,
+  3,13,6,216,172,2,1,216,173,2,1,216,174,2,1,216,175,2,1,216,176,2,1,216,
+  177,2,1,216,178,2,1,216,179,2,1,216,180,2,1,216,181,2,1,216,182,2,1,216,
+  183,2,1,216,184,2,1,216,185,2,1,216,186,2,1,216,187,0,3,13,6,216,188,2,
+  1,216,189,2,1,216,190,2,1,216,191,2,1,216,192,2,1,216,193,2,1,216,194,2,
+  1,216,195,2,1,216,196,2,1,216,197,2,1,216,198,2,1,216,199,2,1,216,200,2,
+  1,216,201,2,1,216,202,2,1,216,203,0,3,13,6,216,204,2,1,216,205,2,1,216,
+  206,2,1,216,207,2,1,216,208,2,1,216,209,2,1,216,210,2,1,216,211,2,1,216,
+  212,2,1,216,213,2,1,216,214,2,1,216,215,2,1,216,216,2,1,216,217,2,1,216,
+  218,2,1,216,219,0,3,13,6,216,220,2,1,216,221,2,1,216,222,2,1,216,223,2,
+  1,216,224,2,1,216,225,2,1,216,226,2,1,216,227,2,1,216,228,2,1,216,229,2,
+  1,216,230,2,2,193,103,200,99,2,1,216,231,2,1,216,232,2,1,216,233,2,1,216,
+  234,0,3,13,6,216,235,2,1,216,236,2,1,216,237,2,1,216,238,2,1,216,239,2,
+  1,216,240,2,1,216,241,2,1,216,242,2,1,216,243,2,1,216,244,2,1,216,245,2,
+  1,216,246,2,1,216,247,2,1,216,248,2,1,216,249,2,1,216,250,0,3,13,6,216,
+  251,2,1,216,252,2,1,216,253,2,1,216,254,2,1,216,255,2,1,217,0,2,1,217,
+  1,2,1,217,2,2,1,217,3,2,1,217,4,2,1,217,5,2,1,217,6,2,1,217,
+  7,2,1,217,8,2,1,217,9,2,1,217,10,0,3,13,6,217,11,2,1,217,12,2,
+  1,217,13,2,1,217,14,2,1,217,15,2,1,217,16,2,1,217,17,2,1,217,18,2,
+  1,217,19,2,1,217,20,2,1,217,21,2,1,217,22,2,1,217,23,2,1,217,24,2,
+  1,217,25,2,1,217,26,0,3,13,6,217,27,2,1,217,28,2,1,217,29,2,1,217,
+  30,2,1,217,31,2,1,217,32,2,1,217,33,2,1,217,34,2,1,217,35,2,1,217,
+  36,2,1,217,37,2,1,217,38,2,1,217,39,2,1,217,40,2,1,217,41,2,1,217,
+  42,0,3,13,6,217,43,2,1,217,44,2,1,217,45,2,1,217,46,2,1,217,47,2,
+  1,217,48,2,1,217,49,2,1,217,50,2,1,217,51,2,1,217,52,2,1,217,53,2,
+  1,217,54,2,1,217,55,2,1,217,56,2,1,217,57,2,1,217,58,0,3,13,6,217,
+  59,2,1,217,60,2,1,217,61,2,1,217,62,2,1,217,63,2,1,217,64,2,1,217,
+  65,2,1,217,66,2,1,217,67,2,1,217,68,2,1,217,69,2,1,217,70,2,1,217,
+  71,2,1,217,72,2,1,217,73,2,1,217,74,0,3,13,6,217,75,2,1,217,76,2,
+  1,217,77,2,1,217,78,2,1,217,79,2,1,217,80,2,1,217,81,2,1,217,82,2,
+  1,217,83,2,1,217,84,2,1,217,85,2,1,217,86,2,1,217,87,2,1,217,88,2,
+  1,217,89,2,1,217,90,0,3,13,6,217,91,2,1,217,92,2,1,217,93,2,1,217,
+  94,2,1,217,95,2,1,217,96,2,1,217,97,2,1,217,98,2,1,217,99,2,1,217,
+  100,2,1,217,101,2,1,217,102,2,1,217,103,2,1,217,104,2,1,217,105,2,1,217,
+  106,0,3,13,6,217,107,2,1,217,108,2,1,217,109,2,1,217,110,2,1,217,111,2,
+  1,217,112,2,2,172,196,38,2,1,217,113,2,1,217,114,2,1,217,115,2,1,217,116,
+  2,1,217,117,2,1,217,118,2,1,217,119,2,1,217,120,2,1,217,121,0,3,13,6,
+  217,122,2,1,217,123,2,1,217,124,2,1,217,125,2,1,217,126,2,1,217,127,2,1,
+  217,128,2,1,217,129,2,1,217,130,2,1,217,131,2,4,198,121,193,160,193,51,193,103,
+  5,1,197,31,4,2,192,240,193,103,5,1,197,31,2,1,217,132,2,1,217,133,0,3,
+  13,6,217,134,2,1,217,135,2,1,217,136,2,1,217,137,2,1,217,138,2,1,217,139,
+  2,1,217,140,2,1,217,141,2,1,217,142,2,1,217,143,2,1,217,144,2,1,217,145,
+  2,1,217,146,2,1,217,147,2,1,217,148,2,1,217,149,0,3,13,6,204,46,2,1,
+  217,150,2,1,217,151,2,1,204,47,2,1,204,48,2,1,217,152,2,1,204,49,2,1,
+  204,50,2,1,204,51,2,1,204,52,2,1,204,53,2,1,204,54,2,1,204,55,2,1,
+  217,153,2,1,204,56,2,1,204,57,0,3,13,6,217,154,2,1,217,155,2,1,217,156,
+  2,1,217,157,2,1,217,158,2,1,217,159,2,1,217,160,2,1,217,161,2,1,204,58,
+  2,1,204,59,2,1,204,60,2,1,217,162,2,1,204,61,2,1,217,163,2,1,204,62,
+  2,1,217,164,0,3,13,6,204,63,2,1,204,64,2,1,204,65,2,1,204,66,2,1,
+  204,67,2,1,217,165,2,1,204,68,2,1,204,69,2,1,217,166,2,1,204,70,2,1,
+  204,71,2,1,204,72,2,1,204,73,2,1,217,167,2,1,204,74,2,1,204,75,0,3,
+  13,6,204,76,2,1,217,168,2,1,204,77,2,1,204,78,2,1,217,169,2,1,217,170,
+  2,1,204,79,2,1,204,80,2,1,204,81,2,1,204,82,2,1,204,83,2,1,204,84,
+  2,1,204,85,2,1,217,171,2,1,204,86,2,1,204,87,0,3,13,6,204,88,2,1,
+  204,89,2,1,217,172,2,1,217,173,2,1,217,174,2,1,217,175,2,1,217,176,2,1,
+  217,177,2,1,217,178,2,1,217,179,2,1,217,180,2,1,217,181,2,1,217,182,2,1,
+  217,183,2,1,217,184,2,1,217,185,0,3,13,6,217,186,2,1,217,187,2,1,217,188,
+  2,1,217,189,2,1,217,190,2,1,217,191,2,1,217,192,2,1,217,193,2,1,217,194,
+  2,1,217,195,2,1,217,196,2,1,217,197,2,1,217,198,2,1,217,199,2,1,217,200,
+  2,1,217,201,0,3,13,6,217,202,2,1,217,203,2,1,217,204,2,1,217,205,2,1,
+  217,206,2,1,217,207,2,1,217,208,2,1,217,209,2,1,217,210,2,1,217,211,2,1,
+  217,212,2,1,217,213,2,1,217,214,2,1,217,215,2,1,217,216,2,1,217,217,0,3,
+  13,6,217,218,2,1,217,219,2,1,217,220,2,1,217,221,2,1,217,222,2,1,217,223,
+  2,1,217,224,2,1,217,225,2,1,217,226,2,1,217,227,2,1,217,228,2,1,217,229,
+  2,1,217,230,2,1,217,231,2,1,217,232,2,1,217,233,0,3,13,6,217,234,2,1,
+  217,235,2,1,217,236,2,1,217,237,2,1,217,238,2,1,217,239,2,1,217,240,2,1,
+  217,241,2,1,217,242,2,1,217,243,2,1,217,244,2,1,217,245,2,1,217,246,2,1,
+  217,247,2,1,217,248,2,1,217,249,0,3,13,6,217,250,2,1,217,251,2,1,217,252,
+  2,1,217,253,2,1,217,254,2,1,217,255,2,1,218,0,2,1,218,1,2,1,218,2,
+  2,1,218,3,2,1,218,4,2,1,218,5,2,1,218,6,2,1,218,7,2,1,218,8,
+  2,1,218,9,0,3,13,6,218,10,2,1,218,11,2,1,218,12,2,1,218,13,2,1,
+  218,14,2,1,218,15,2,1,218,16,2,1,218,17,2,1,218,18,2,1,218,19,2,1,
+  218,20,2,1,218,21,2,1,218,22,2,1,218,23,2,1,218,24,2,1,218,25,0,3,
+  13,6,218,26,2,1,218,27,2,1,218,28,2,1,218,29,2,1,218,30,2,1,218,31,
+  2,1,218,32,2,1,218,33,2,1,218,34,2,1,218,35,2,1,218,36,2,1,218,37,
+  2,1,218,38,2,1,218,39,2,1,218,40,2,1,218,41,0,3,13,6,218,42,2,1,
+  218,43,2,1,218,44,2,1,218,45,2,1,218,46,2,1,218,47,2,1,218,48,2,1,
+  218,49,2,1,218,50,2,1,218,51,2,1,218,52,2,1,218,53,2,1,218,54,2,1,
+  218,55,2,1,218,56,2,1,218,57,0,3,13,6,218,58,2,1,218,59,2,1,218,60,
+  2,1,218,61,2,1,218,62,2,1,218,63,2,1,218,64,2,1,218,65,2,1,218,66,
+  2,1,218,67,2,1,218,68,2,1,218,69,2,1,218,70,2,1,218,71,2,1,218,72,
+  2,1,218,73,0,3,13,6,218,74,2,1,218,75,2,1,218,76,2,1,218,77,2,1,
+  218,78,2,1,218,79,2,1,218,80,2,1,218,81,2,1,218,82,2,1,218,83,2,1,
+  218,84,2,1,218,85,2,1,218,86,2,1,218,87,2,2,193,220,76,2,1,218,88,0,
+  3,13,6,218,89,2,1,218,90,2,1,218,91,2,1,218,92,2,1,218,93,2,1,218,
+  94,2,1,218,95,2,1,218,96,2,1,218,97,2,1,218,98,2,1,218,99,2,1,218,
+  100,2,1,218,101,2,1,218,102,2,1,218,103,2,1,218,104,0,3,13,6,218,105,2,
+  1,218,106,2,1,218,107,2,1,218,108,2,1,218,109,2,1,218,110,2,1,218,111,2,
+  1,218,112,2,1,218,113,2,1,218,114,2,1,218,115,2,1,218,116,2,1,218,117,2,
+  1,218,118,2,1,218,119,2,1,218,120,0,3,13,6,218,121,2,1,218,122,2,1,218,
+  123,2,1,218,124,2,1,218,125,2,1,218,126,2,1,218,127,2,1,218,128,2,1,218,
+  129,2,1,218,130,2,1,218,131,2,1,218,132,2,1,218,133,2,1,218,134,2,1,218,
+  135,2,1,218,136,0,3,13,6,218,137,2,1,218,138,2,1,218,139,2,1,218,140,2,
+  1,218,141,2,1,218,142,2,1,218,143,2,1,218,144,2,1,218,145,2,1,218,146,2,
+  1,218,147,2,1,218,148,2,1,218,149,2,1,218,150,2,1,218,151,2,1,218,152,0,
+  3,13,6,218,153,2,1,218,154,2,1,218,155,2,1,218,156,2,1,218,157,2,1,218,
+  158,2,1,218,159,2,1,218,160,2,1,218,161,2,1,218,162,2,1,218,163,2,1,218,
+  164,2,1,218,165,2,1,218,166,2,1,218,167,2,1,218,168,0,3,13,6,218,169,2,
+  1,218,170,2,1,218,171,2,1,218,172,2,1,218,173,2,1,218,174,2,1,218,175,2,
+  1,218,176,2,1,218,177,2,1,218,178,2,1,218,179,2,1,218,180,2,1,218,181,2,
+  1,218,182,2,1,218,183,2,1,218,184,0,3,13,6,218,185,2,1,218,186,2,1,218,
+  187,2,1,218,188,2,1,218,189,2,1,218,190,2,1,218,191,2,1,218,192,2,1,218,
+  193,2,1,218,194,2,1,218,195,2,1,218,196,2,1,218,197,2,1,218,198,2,1,218,
+  199,2,1,218,200,0,3,13,6,218,201,2,1,218,202,2,1,218,203,2,1,218,204,2,
+  1,218,205,2,1,218,206,2,1,218,207,2,1,218,208,2,1,218,209,2,1,218,210,2,
+  1,218,211,2,1,218,212,2,1,218,213,2,1,218,214,2,1,218,215,2,1,218,216,0,
+  3,13,6,218,217,2,1,218,218,2,1,218,219,2,1,218,220,2,1,218,221,2,1,218,
+  222,2,1,218,223,2,1,218,224,2,1,218,225,2,1,218,226,2,1,218,227,2,1,218,
+  228,2,1,218,229,2,1,218,230,2,1,218,231,2,1,218,232,0,3,13,6,218,233,2,
+  1,218,234,2,1,218,235,2,1,218,236,2,1,218,237,2,1,218,238,2,1,218,239,2,
+  1,218,240,2,1,218,241,2,1,218,242,2,1,218,243,2,1,218,244,2,1,218,245,2,
+  1,218,246,2,1,218,247,2,1,218,248,0,3,13,6,218,249,2,1,218,250,2,1,218,
+  251,2,1,218,252,2,1,218,253,2,1,218,254,2,1,218,255,2,1,219,0,2,1,219,
+  1,2,1,219,2,2,1,219,3,2,1,219,4,2,1,219,5,2,1,219,6,2,1,219,
+  7,2,1,219,8,0,3,13,6,219,9,2,1,219,10,2,1,219,11,2,1,219,12,2,
+  1,219,13,2,1,219,14,2,1,219,15,2,1,219,16,2,1,219,17,2,1,219,18,2,
+  1,219,19,2,1,219,20,2,1,219,21,2,1,219,22,2,1,219,23,2,1,219,24,0,
+  3,13,6,219,25,2,1,219,26,2,1,219,27,2,1,219,28,2,1,219,29,2,1,219,
+  30,2,1,219,31,2,1,219,32,2,1,219,33,2,1,219,34,2,1,219,35,2,1,219,
+  36,2,1,219,37,2,1,219,38,2,1,219,39,2,1,219,40,0,3,13,6,219,41,2,
+  1,219,42,2,1,219,43,2,1,219,44,2,1,219,45,2,1,219,46,2,1,219,47,2,
+  1,219,48,2,1,219,49,2,1,219,50,2,1,219,51,2,1,219,52,2,1,219,53,2,
+  1,219,54,2,1,219,55,2,1,219,56,0,3,13,6,219,57,2,1,219,58,2,1,219,
+  59,2,1,219,60,2,1,219,61,2,1,219,62,2,1,219,63,2,1,219,64,2,1,219,
+  65,2,1,219,66,2,1,219,67,2,1,219,68,2,1,219,69,2,1,219,70,2,1,219,
+  71,2,1,219,72,0,3,13,6,219,73,2,1,219,74,2,1,219,75,2,1,219,76,2,
+  1,219,77,2,1,219,78,2,1,219,79,2,1,219,80,2,1,219,81,2,1,219,82,2,
+  1,219,83,2,1,219,84,2,1,219,85,2,1,219,86,2,1,219,87,2,1,219,88,0,
+  3,13,6,219,89,2,1,219,90,2,1,219,91,2,1,219,92,2,1,219,93,2,1,219,
+  94,2,1,219,95,2,1,219,96,2,1,219,97,2,1,219,98,2,1,219,99,2,1,219,
+  100,2,1,219,101,2,1,219,102,2,1,219,103,2,1,219,104,0,3,13,6,219,105,2,
+  1,219,106,2,1,219,107,2,2,83,196,38,2,1,219,108,2,1,219,109,2,1,219,110,
+  2,1,219,111,2,1,219,112,2,1,219,113,2,1,219,114,2,1,219,115,2,1,219,116,
+  2,1,219,117,2,1,219,118,2,1,219,119,0,3,13,6,219,120,2,1,219,121,2,1,
+  219,122,2,1,219,123,2,1,219,124,2,1,219,125,2,1,219,126,2,1,219,127,2,1,
+  219,128,2,1,219,129,2,1,219,130,2,1,219,131,2,1,219,132,2,1,219,133,2,1,
+  219,134,2,1,219,135,0,3,13,6,219,136,2,1,219,137,2,1,219,138,2,1,219,139,
+  2,1,219,140,2,1,219,141,2,1,219,142,2,1,219,143,2,1,219,144,2,1,219,145,
+  2,1,219,146,2,1,219,147,2,1,219,148,2,1,219,149,2,1,219,150,2,1,219,151,
+  0,3,13,6,219,152,2,1,219,153,2,1,219,154,2,1,219,155,2,1,219,156,2,1,
+  219,157,2,1,219,158,2,1,219,159,2,1,219,160,2,1,219,161,2,1,219,162,2,1,
+  219,163,2,1,219,164,2,1,219,165,2,1,219,166,2,1,219,167,0,3,13,6,219,168,
+  2,1,219,169,2,1,219,170,2,1,219,171,2,1,219,172,2,1,219,173,2,1,219,174,
+  2,1,219,175,2,1,219,176,2,1,219,177,2,1,219,178,2,1,219,179,2,1,219,180,
+  2,1,219,181,2,1,219,182,2,1,219,183,0,3,13,6,219,184,2,1,219,185,2,1,
+  219,186,2,1,219,187,2,1,219,188,2,1,219,189,2,1,219,190,2,1,219,191,2,1,
+  219,192,2,1,219,193,2,1,219,194,2,1,219,195,2,1,219,196,2,1,219,197,2,1,
+  219,198,2,1,219,199,0,3,13,6,219,200,2,1,219,201,0,5,115,204,90,196,74,55,
+  198,13,1,3,193,52,55,192,171,2,2,195,151,192,171,2,3,204,91,55,192,171,1,2,
+  194,43,192,245,1,3,196,75,204,92,192,245,0,2,193,46,193,165,0,2,219,202,11,0,
+  3,193,36,0,20,2,1,194,113,2,1,195,117,2,1,193,209,2,1,193,227,2,1,197,
+  37,0,3,193,36,0,56,2,1,195,127,2,1,194,213,2,1,195,51,2,1,219,203,2,
+  1,194,38,2,1,200,77,2,1,193,19,2,1,58,2,1,194,214,2,1,193,250,2,1,
+  199,172,2,1,192,226,2,1,219,204,2,1,193,80,2,1,173,0,3,193,36,0,198,122,
+  2,1,193,71,2,1,195,233,2,1,53,2,1,192,238,2,1,198,123,2,1,194,39,2,
+  1,204,93,2,1,193,228,2,1,192,246,2,1,193,54,2,1,193,1,2,1,46,2,1,
+  194,63,2,1,196,116,2,1,192,35,0,3,193,36,0,193,229,2,1,194,90,0,2,198,
+  124,27,1,2,122,219,205,1,1,219,206,1,1,219,207,0,2,219,208,194,48,0,2,194,
+  200,74,2,2,196,76,183,3,1,187,2,3,2,59,38,3,3,171,172,71,3,1,194,175,
+  3,3,54,172,199,188,3,1,193,192,3,7,83,119,193,160,193,103,74,172,71,0,1,200,
+  100,0,1,219,209,0,1,219,210,0,3,193,222,0,194,68,2,1,194,235,2,1,194,69,
+  2,1,195,58,2,1,194,95,2,1,193,19,2,1,194,121,2,1,194,96,2,1,194,122,
+  2,1,194,26,2,1,192,177,2,1,192,238,2,1,195,240,0,3,193,222,0,194,192,2,
+  1,194,103,2,1,194,97,2,1,193,86,2,1,194,70,2,1,195,28,2,1,193,11,2,
+  1,194,123,2,1,194,159,1,2,32,219,211,0,2,194,49,193,21,1,1,193,194,1,1,
+  193,242,0,3,195,152,198,125,219,212,2,2,193,61,196,77,2,2,194,34,196,77,0,4,
+  195,152,198,125,63,196,77,1,3,61,197,137,219,213,3,1,204,94,3,1,204,95,3,1,
+  204,96,3,1,204,97,0,2,202,52,11,0,2,194,111,197,128,1,1,204,98,1,1,193,
+  165,2,1,197,119,2,1,195,79,1,1,195,79,1,1,204,99,1,1,195,121,2,4,2,
+  39,27,38,0,4,194,111,195,121,2,194,175,3,3,37,27,38,3,3,3,120,38,0,2,
+  192,188,193,21,1,1,193,194,1,1,193,242,0,3,193,103,74,219,214,1,4,2,108,27,
+  38,0,2,204,100,11,0,1,195,118,1,4,2,183,27,38,2,1,197,104,0,4,164,24,
+  195,61,66,1,3,66,194,236,219,215,2,2,192,26,192,172,3,1,192,173,0,4,164,66,
+  192,26,194,198,3,1,194,199,0,2,193,64,193,90,1,1,1,2,3,38,108,27,3,2,
+  97,1,3,2,91,27,3,2,184,192,242,2,3,24,193,151,195,61,5,3,2,184,38,2,
+  3,2,219,216,38,3,2,59,57,3,2,196,165,57,3,7,54,140,38,24,54,140,57,1,
+  2,2,192,245,0,2,219,217,66,0,2,194,132,66,1,4,2,78,140,38,0,4,204,101,
+  66,193,1,39,3,1,37,0,3,204,102,15,49,2,1,54,0,3,196,205,55,120,2,1,
+  192,241,2,1,43,1,2,63,120,2,1,192,241,2,1,43,0,2,219,218,11,0,1,219,
+  219,0,2,34,193,90,1,6,31,197,0,24,16,194,116,42,0,4,34,31,197,0,42,2,
+  3,16,194,116,42,1,1,192,168,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,
+  49,2,1,128,2,1,117,2,1,65,2,1,54,1,2,192,209,192,104,1,2,29,194,110,
+  2,1,193,68,2,1,193,153,0,3,34,29,134,2,1,193,41,2,1,193,77,2,1,194,
+  61,2,1,192,66,3,1,169,2,1,193,117,2,1,192,224,1,2,197,121,193,171,1,2,
+  219,220,193,90,1,2,193,127,42,1,2,193,42,42,1,1,194,209,1,2,4,192,32,2,
+  1,198,62,2,1,196,50,0,3,34,4,219,221,2,1,197,138,2,1,219,222,2,1,204,
+  103,2,1,204,104,2,1,204,105,2,1,194,113,2,1,196,201,2,1,194,33,2,1,194,
+  250,2,1,219,223,2,1,193,176,2,1,204,106,2,1,219,224,2,1,204,107,2,1,204,
+  108,0,3,34,4,192,107,2,1,199,169,2,1,219,225,2,1,219,226,2,1,219,227,2,
+  1,219,228,2,1,219,229,2,1,219,230,2,1,200,74,2,1,219,231,2,1,219,232,2,
+  1,219,233,2,1,219,234,2,1,219,235,2,1,219,236,2,1,219,237,0,3,34,4,219,
+  238,2,1,219,239,2,1,219,240,2,1,219,241,2,1,219,242,2,1,219,243,2,1,219,
+  244,2,1,195,117,2,1,204,109,2,1,192,142,2,1,203,86,2,1,193,209,2,1,198,
+  34,2,1,193,169,2,1,195,15,2,1,219,245,0,3,34,4,198,35,2,1,219,246,2,
+  1,198,44,2,1,194,211,2,1,219,247,2,1,200,101,2,1,199,185,2,1,191,2,1,
+  203,87,2,1,192,220,2,1,203,88,2,1,204,110,2,1,219,248,2,1,203,89,2,1,
+  219,249,2,1,219,250,0,3,34,4,219,251,2,1,204,111,2,1,219,252,2,1,204,112,
+  2,1,200,102,2,1,219,253,2,1,204,113,2,1,219,254,2,1,193,227,2,1,196,148,
+  2,1,194,24,2,1,194,5,2,1,219,255,2,1,194,25,2,1,220,0,2,1,220,1,
+  0,3,34,4,195,196,2,1,202,253,2,1,202,254,2,1,202,255,2,1,203,0,2,1,
+  193,18,2,1,197,247,2,1,194,213,2,1,196,26,2,1,195,17,2,1,195,18,2,1,
+  195,119,2,1,204,114,2,1,220,2,2,1,204,115,2,1,204,116,0,3,34,4,220,3,
+  2,1,192,3,2,1,197,71,2,1,195,51,2,1,197,70,2,1,196,203,2,1,220,4,
+  2,1,199,67,2,1,220,5,2,1,204,117,2,1,204,118,2,1,204,119,2,1,220,6,
+  2,1,220,7,2,1,220,8,2,1,220,9,0,3,34,4,220,10,2,1,193,210,2,2,
+  193,74,20,3,1,192,45,3,1,56,3,1,193,13,3,1,58,3,1,53,3,1,197,135,
+  3,1,46,3,1,192,109,2,1,194,155,2,1,220,11,2,1,194,65,2,2,194,53,204,
+  107,3,1,204,108,0,4,34,4,194,53,204,115,3,1,204,116,3,1,204,120,3,1,204,
+  121,3,1,204,122,3,1,204,123,3,1,198,47,3,1,204,124,3,1,198,48,3,1,204,
+  125,3,1,198,50,3,1,204,126,3,1,198,54,3,1,204,127,3,1,204,128,3,1,204,
+  129,0,3,34,4,203,2,2,1,220,12,2,1,204,120,2,1,204,121,2,1,204,122,2,
+  1,220,13,2,1,220,14,2,1,220,15,2,1,220,16,2,1,220,17,2,1,220,18,2,
+  1,220,19,2,1,129,2,1,195,19,2,1,193,19,2,1,198,37,0,3,34,4,195,153,
+  2,1,204,130,2,1,220,20,2,1,220,21,2,1,220,22,2,1,220,23,2,1,220,24,
+  2,1,204,123,2,1,220,25,2,1,220,26,2,1,220,27,2,1,220,28,2,1,220,29,
+  2,1,220,30,2,1,220,31,2,1,220,32,0,3,34,4,220,33,2,1,220,34,2,1,
+  193,57,2,1,193,158,2,1,220,35,2,1,194,158,2,1,192,102,2,1,203,90,2,1,
+  194,214,2,1,196,149,2,1,195,190,2,1,195,8,2,1,220,36,2,1,196,45,2,1,
+  203,6,2,1,90,0,3,34,4,197,246,2,1,193,250,2,1,200,103,2,1,193,203,2,
+  1,193,196,2,1,220,37,2,1,193,230,2,1,199,191,2,1,198,46,2,1,198,47,2,
+  1,204,124,2,1,198,48,2,1,200,104,2,1,220,38,2,1,220,39,2,1,220,40,0,
+  3,34,4,220,41,2,1,220,42,2,1,220,43,2,1,220,44,2,1,220,45,2,1,220,
+  46,2,1,220,47,2,1,220,48,2,1,200,105,2,1,220,49,2,1,220,50,2,1,197,
+  237,2,1,220,51,2,1,220,52,2,1,220,53,2,1,170,0,3,34,4,197,76,2,1,
+  192,226,2,1,198,40,2,1,192,149,2,1,194,10,2,1,220,54,2,1,193,174,2,1,
+  199,192,2,1,167,2,1,199,193,2,1,193,80,2,1,199,174,2,1,193,119,2,1,193,
+  231,2,1,220,55,2,1,193,31,0,3,34,4,198,49,2,1,199,196,2,1,204,125,2,
+  1,198,50,2,1,196,206,2,1,173,2,1,196,121,2,1,193,71,2,1,199,175,2,1,
+  193,72,2,1,193,28,2,1,220,56,2,1,193,92,2,1,198,53,2,1,192,145,2,1,
+  203,92,0,3,34,4,199,68,2,1,204,131,2,1,194,153,2,1,195,154,2,1,220,57,
+  2,1,200,106,2,1,220,58,2,1,150,2,1,197,253,2,1,192,238,2,1,195,120,2,
+  1,192,195,2,1,203,93,2,2,195,241,20,3,1,192,45,3,1,56,0,4,34,4,195,
+  241,193,13,3,1,58,3,1,53,3,1,46,2,1,200,107,2,1,220,59,2,1,193,197,
+  2,1,195,29,2,1,220,60,2,1,220,61,2,1,220,62,2,1,192,210,2,1,194,41,
+  2,1,220,63,2,1,194,181,2,1,197,82,0,3,34,4,199,206,2,1,204,126,2,1,
+  198,54,2,1,194,11,2,1,199,207,2,1,198,123,2,1,220,64,2,1,220,65,2,1,
+  220,66,2,1,220,67,2,1,220,68,2,1,220,69,2,1,220,70,2,1,220,71,2,1,
+  220,72,2,1,220,73,0,3,34,4,220,74,2,1,220,75,2,1,220,76,2,1,197,83,
+  2,1,198,55,2,1,220,77,2,1,197,139,2,1,220,78,2,1,220,79,2,1,204,127,
+  2,1,204,128,2,1,204,129,2,1,220,80,2,1,220,81,2,1,220,82,2,1,220,83,
+  0,3,34,4,220,84,2,1,220,85,2,1,220,86,2,1,154,2,1,197,84,2,1,194,
+  39,2,1,197,51,2,1,194,86,2,1,193,179,2,1,220,87,2,1,193,217,2,1,203,
+  47,2,1,220,88,2,1,182,2,1,197,254,2,1,193,228,0,4,34,4,198,126,204,106,
+  3,1,204,114,3,1,198,49,3,1,197,82,2,1,196,29,2,1,192,101,2,1,203,50,
+  2,1,192,246,2,1,197,250,2,1,196,150,2,1,195,7,2,1,220,89,2,1,194,115,
+  2,1,199,210,2,1,193,218,2,1,193,180,0,3,34,4,220,90,2,1,193,33,2,1,
+  220,91,2,1,204,132,2,1,220,92,2,1,200,108,2,1,200,109,2,1,200,110,2,1,
+  193,235,2,1,199,211,2,1,220,93,2,1,220,94,2,1,220,95,2,1,220,96,2,1,
+  220,97,2,1,220,98,0,3,34,4,220,99,2,1,220,100,2,1,180,2,1,196,30,2,
+  1,193,54,2,1,196,202,2,1,192,167,2,1,197,87,2,1,193,1,2,1,197,73,2,
+  1,196,46,2,1,193,253,2,1,220,101,2,1,199,176,2,1,199,213,2,1,194,22,0,
+  3,34,4,66,2,1,220,102,2,1,193,123,2,1,220,103,2,1,194,156,2,1,203,12,
+  2,1,196,47,2,1,198,41,2,1,198,42,2,1,220,104,2,1,199,215,2,1,203,64,
+  2,1,220,105,2,1,203,65,2,1,198,57,2,1,220,106,0,3,34,4,193,190,2,1,
+  199,216,2,1,220,107,2,1,220,108,2,1,220,109,2,1,220,110,2,1,220,111,2,1,
+  220,112,2,1,220,113,2,1,220,114,2,1,192,194,2,1,203,95,2,1,194,63,2,1,
+  195,185,2,1,195,108,2,1,195,50,0,3,34,4,196,34,2,1,220,115,2,1,192,109,
+  2,1,197,77,2,1,193,178,2,1,198,43,2,1,193,234,2,1,193,208,2,1,220,116,
+  2,1,195,16,2,1,194,129,2,1,220,117,2,1,196,116,2,1,220,118,2,1,194,133,
+  2,1,204,133,0,3,34,4,220,119,2,1,220,120,2,1,220,121,2,1,220,122,2,1,
+  220,123,2,1,220,124,2,1,220,125,2,1,204,134,2,1,220,126,2,1,202,61,2,1,
+  220,127,2,1,220,128,2,1,220,129,2,1,220,130,2,1,176,2,1,196,125,0,3,34,
+  4,194,91,2,1,196,151,2,1,9,2,1,193,94,2,1,220,131,2,1,193,27,2,1,
+  192,221,2,1,204,135,2,1,193,229,2,1,197,74,2,1,193,236,2,1,220,132,2,1,
+  194,90,2,1,198,111,2,1,200,111,2,1,200,112,0,3,34,4,200,113,2,1,220,133,
+  2,1,195,13,2,1,194,220,2,1,220,134,2,1,194,230,2,1,220,135,2,1,198,127,
+  2,1,220,136,2,1,204,136,2,1,220,137,2,1,204,137,2,1,204,138,2,1,204,139,
+  1,3,194,162,42,220,138,3,1,220,139,0,4,34,194,162,42,220,140,3,1,220,141,3,
+  1,220,142,3,1,220,143,3,1,220,144,3,1,204,140,3,2,192,114,204,140,3,1,220,
+  145,1,1,220,146,0,2,220,147,200,114,0,2,202,153,1,0,2,220,148,1,0,2,204,
+  141,199,224,1,2,200,115,200,116,0,2,220,149,195,59,0,1,220,150,0,2,193,170,42,
+  1,2,193,127,42,0,2,220,151,104,0,4,193,226,193,70,14,115,3,1,85,3,1,78,
+  3,1,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,0,2,
+  220,152,201,110,0,5,196,207,75,85,194,43,192,245,2,2,33,192,211,0,3,196,207,75,
+  195,12,2,3,117,194,43,192,245,2,2,63,120,3,1,43,0,1,195,63,0,1,220,153,
+  0,1,193,184,0,4,104,196,208,194,215,199,225,1,1,220,154,1,1,196,209,1,3,220,
+  155,220,156,198,59,1,3,220,157,192,158,220,158,1,3,220,159,20,196,210,1,3,2,200,
+  117,198,128,2,2,220,160,196,58,2,2,189,192,228,0,6,104,2,195,80,200,118,193,3,
+  195,242,2,1,220,161,2,3,220,162,74,220,163,2,2,220,164,200,89,2,1,220,165,2,
+  3,193,28,220,166,204,142,2,2,198,129,204,142,2,3,49,220,167,193,79,2,6,177,193,
+  184,24,193,105,145,192,228,3,1,192,228,4,3,24,200,117,198,128,4,1,220,168,2,5,
+  200,119,193,83,24,200,119,196,58,2,2,220,169,195,63,2,2,220,170,193,184,2,2,204,
+  143,193,184,0,4,104,2,200,120,194,79,4,3,24,204,144,193,184,5,2,204,145,195,63,
+  2,3,199,225,74,199,226,2,1,204,146,2,5,220,171,193,184,24,195,4,192,228,1,2,
+  197,140,192,228,0,2,220,172,1,0,1,220,173,0,1,220,174,0,1,220,175,0,2,220,
+  176,193,238,0,6,196,78,189,193,95,188,192,157,27,3,2,194,134,189,2,6,192,158,63,
+  120,192,158,55,43,0,1,204,147,0,2,194,149,11,0,2,204,148,199,236,0,2,200,121,
+  200,122,1,1,199,66,0,2,220,177,104,0,1,198,130,0,2,196,154,1,0,3,204,149,
+  204,150,193,88,0,1,220,178,0,2,220,179,198,131,0,1,220,180,0,5,204,151,204,152,
+  195,243,24,194,218,0,2,195,216,193,21,1,1,193,242,0,2,197,89,220,181,1,1,196,
+  36,0,2,204,153,220,182,1,1,220,183,0,3,220,184,200,123,193,193,0,1,195,1,1,
+  1,204,154,1,1,220,185,0,1,220,186,0,2,220,187,220,188,0,1,220,189,0,3,195,
+  106,196,25,197,141,1,2,193,49,193,128,3,1,11,3,2,2,104,1,2,203,158,198,132,
+  0,1,195,62,1,4,199,124,2,197,142,220,190,0,1,220,191,0,4,220,192,197,53,24,
+  195,62,0,3,220,193,193,105,1,0,3,85,59,42,2,1,192,4,0,3,194,224,192,158,
+  204,155,0,1,220,194,0,2,196,79,196,21,0,1,204,156,0,1,220,195,0,1,220,196,
+  0,2,220,197,220,198,0,2,198,14,197,56,0,2,200,124,193,118,0,1,197,143,1,2,
+  192,69,220,199,0,3,197,143,192,4,42,0,2,220,200,104,0,1,199,252,0,2,200,125,
+  192,229,1,1,195,118,1,1,220,201,0,1,220,202,0,1,220,203,0,1,196,36,0,1,
+  220,204,0,1,198,67,0,1,220,205,0,2,40,197,3,0,1,220,206,0,3,198,133,24,
+  196,159,3,2,2,220,207,0,2,204,157,200,126,0,1,220,208,0,2,220,209,203,161,0,
+  1,204,158,0,3,78,199,78,192,245,1,2,220,210,192,245,1,4,193,56,194,62,204,159,
+  193,247,1,2,59,42,2,1,192,4,1,2,193,238,220,211,1,3,193,52,55,192,171,1,
+  2,196,75,192,245,0,2,220,212,193,242,0,2,197,209,197,32,0,2,204,160,104,0,3,
+  192,14,196,130,49,0,2,192,14,194,87,0,4,198,134,2,193,53,192,57,2,1,200,90,
+  2,1,220,213,0,2,220,214,104,0,3,204,161,220,215,1,1,1,220,216,0,2,220,217,
+  204,162,0,2,199,253,104,0,3,220,218,196,117,199,70,0,5,200,127,194,178,63,91,27,
+  0,1,198,135,0,5,198,136,104,2,177,192,228,0,2,220,219,220,220,0,2,192,209,114,
+  1,2,193,128,11,0,4,192,209,193,128,2,104,1,2,200,128,198,137,1,1,192,104,0,
+  2,192,0,195,172,1,1,195,111,1,1,192,245,1,2,196,145,119,1,2,203,83,1,1,
+  2,192,75,192,132,1,1,193,90,1,1,192,168,1,2,197,110,193,160,1,2,14,115,2,
+  1,85,2,1,78,2,1,133,0,3,192,0,14,49,2,1,128,2,1,117,2,1,65,2,
+  1,54,2,1,192,33,1,2,196,32,1,1,2,193,64,1,1,2,193,170,42,1,2,192,
+  209,192,104,1,2,192,127,192,132,1,2,192,172,1,1,1,198,138,1,4,7,5,0,20,
+  4,1,62,4,1,192,52,0,5,192,0,7,5,0,192,20,4,1,56,4,1,192,113,4,
+  1,192,2,4,1,192,18,4,1,58,4,1,192,83,4,1,192,6,4,1,112,4,1,178,
+  4,1,152,4,1,53,4,1,192,58,4,1,192,175,4,1,98,4,1,99,0,5,192,0,
+  7,5,0,192,5,4,1,46,4,1,192,9,4,1,192,77,4,1,192,57,4,1,192,35,
+  4,1,192,27,2,3,3,0,20,4,1,62,4,1,192,52,4,1,192,20,4,1,56,4,
+  1,192,113,4,1,192,2,4,1,192,18,4,1,58,0,5,192,0,7,3,0,192,83,4,
+  1,192,6,4,1,112,4,1,178,4,1,152,4,1,53,4,1,192,58,4,1,192,175,4,
+  1,98,4,1,99,4,1,192,5,4,1,46,4,1,192,9,4,1,192,77,4,1,192,57,
+  4,1,192,35,0,5,192,0,7,3,0,192,27,1,3,39,193,61,130,2,1,192,247,2,
+  2,43,130,2,2,63,192,247,1,2,192,173,1,1,2,135,192,124,1,1,192,136,1,2,
+  192,146,1,1,2,29,1,1,2,197,30,1,1,2,97,1,1,2,197,227,1,1,2,193,
+  127,42,1,2,193,124,42,1,2,193,251,193,204,0,4,192,0,37,193,61,130,2,1,192,
+  247,2,2,43,130,2,2,63,192,247,1,1,194,209,1,1,193,204,1,1,184,1,2,83,
+  192,124,1,2,200,129,1,1,2,197,49,1,0,2,203,126,220,221,0,2,220,222,220,223,
+  0,1,220,224,0,2,204,163,195,234,0,1,220,225,0,1,200,130,0,3,200,130,2,220,
+  226,1,2,197,140,220,227,0,2,220,228,200,72,0,1,220,229,0,1,220,230,0,2,220,
+  231,204,164,0,3,204,165,164,66,1,2,194,132,66,0,4,102,5,0,196,211,3,1,193,
+  53,3,1,198,139,3,1,194,163,3,1,198,140,3,1,198,141,3,1,198,142,3,1,198,
+  143,0,4,102,5,0,192,188,3,1,196,67,3,1,198,144,3,1,198,145,3,1,196,212,
+  3,1,193,19,3,1,197,144,3,1,198,146,3,1,192,158,3,1,198,147,3,1,197,145,
+  3,1,196,213,3,1,198,148,3,1,198,149,3,1,193,233,3,1,197,146,0,4,102,5,
+  0,192,135,3,1,198,150,3,1,198,151,3,1,197,91,3,1,196,127,3,1,196,214,3,
+  1,193,86,3,1,198,152,3,1,196,70,3,1,195,143,3,1,198,153,3,1,193,178,3,
+  1,198,154,3,1,196,198,3,1,197,147,3,1,198,155,0,3,102,0,196,211,2,1,192,
+  252,2,1,193,53,2,1,198,139,2,1,194,163,2,1,198,140,2,1,198,141,2,1,198,
+  142,2,1,198,143,2,1,204,166,2,1,192,188,2,1,195,17,2,1,196,67,2,1,198,
+  144,2,1,198,145,2,1,196,212,0,4,102,0,195,55,1,2,1,193,19,2,1,197,144,
+  2,1,198,146,2,1,192,158,2,1,198,147,2,1,197,145,2,1,196,213,2,1,198,148,
+  2,2,204,167,1,2,1,198,149,2,1,193,233,2,1,197,146,2,1,192,135,2,1,198,
+  150,2,1,198,151,0,3,102,0,197,91,2,1,196,127,2,1,196,214,2,1,193,86,2,
+  1,198,152,2,1,196,70,2,2,160,196,67,2,1,195,143,2,1,198,153,2,1,193,178,
+  2,1,198,154,2,1,196,198,2,1,197,147,2,1,198,155,1,4,192,248,5,0,196,211,
+  4,1,192,252,0,5,102,192,248,5,0,193,53,4,1,198,139,4,1,194,163,4,1,198,
+  140,4,1,198,141,4,1,198,142,4,1,198,143,4,1,204,166,4,1,192,188,4,1,195,
+  17,4,1,196,67,4,1,198,144,4,1,198,145,4,1,196,212,4,2,195,55,1,4,1,
+  193,19,0,5,102,192,248,5,0,197,144,4,1,198,146,4,1,192,158,4,1,198,147,4,
+  1,197,145,4,1,196,213,4,1,198,148,4,2,204,167,1,4,1,198,149,4,1,193,233,
+  4,1,197,146,4,1,192,135,4,1,198,150,4,1,198,151,4,1,197,91,4,1,196,127,
+  0,5,102,192,248,5,0,196,214,4,1,193,86,4,1,198,152,4,1,196,70,4,2,160,
+  196,67,4,1,195,143,4,1,198,153,4,1,193,178,4,1,198,154,4,1,196,198,4,1,
+  197,147,4,1,198,155,1,2,197,121,193,171,1,3,3,0,196,211,3,1,193,53,3,1,
+  198,139,0,4,102,3,0,194,163,3,1,198,140,3,1,198,141,3,1,198,142,3,1,198,
+  143,3,1,192,188,3,1,196,67,3,1,198,144,3,1,198,145,3,1,196,212,3,1,193,
+  19,3,1,197,144,3,1,198,146,3,1,192,158,3,1,198,147,3,1,197,145,0,4,102,
+  3,0,196,213,3,1,198,148,3,1,198,149,3,1,193,233,3,1,197,146,3,1,192,135,
+  3,1,198,150,3,1,198,151,3,1,197,91,3,1,196,127,3,1,196,214,3,1,193,86,
+  3,1,198,152,3,1,196,70,3,1,195,143,3,1,198,153,0,4,102,3,0,193,178,3,
+  1,198,154,3,1,196,198,3,1,197,147,3,1,198,155,0,3,220,232,220,233,1,0,2,
+  220,234,42,0,1,200,2,0,2,194,95,11,0,2,220,235,104,0,1,220,236,0,2,220,
+  237,11,0,4,141,5,0,200,19,3,2,194,117,193,106,3,1,200,20,3,2,204,168,197,
+  106,0,4,141,5,0,197,106,3,1,200,21,3,1,200,22,3,1,198,105,3,1,196,55,
+  3,1,200,23,3,1,200,24,3,1,200,25,3,1,58,3,2,86,196,163,3,3,196,164,
+  194,117,193,106,4,2,3,193,106,3,1,196,163,3,1,196,196,3,1,200,26,3,2,204,
+  169,197,107,0,4,141,5,0,200,27,3,1,197,107,3,1,200,28,3,1,200,29,3,1,
+  204,170,3,1,192,238,3,1,200,30,3,1,200,31,3,1,192,101,3,1,200,32,3,1,
+  204,171,3,1,200,33,3,2,3,193,106,5,2,2,192,169,3,2,204,172,129,3,2,204,
+  173,20,0,4,141,5,0,196,47,3,1,200,34,3,1,200,35,3,1,200,36,3,1,200,
+  37,3,1,198,80,3,1,195,22,3,1,200,38,3,1,193,94,3,1,193,27,3,1,200,
+  39,3,1,200,40,1,3,3,0,200,19,3,2,194,117,193,106,3,1,200,20,3,2,204,
+  168,197,106,0,4,141,3,0,197,106,3,1,200,21,3,1,200,22,3,1,198,105,3,1,
+  196,55,3,1,200,23,3,1,200,24,3,1,200,25,3,1,58,3,2,86,196,163,3,3,
+  196,164,194,117,193,106,4,2,3,193,106,3,1,196,163,3,1,196,196,3,1,200,26,3,
+  2,204,169,197,107,0,4,141,3,0,200,27,3,1,197,107,3,1,200,28,3,1,200,29,
+  3,1,204,170,3,1,192,238,3,1,200,30,3,1,200,31,3,1,192,101,3,1,200,32,
+  3,1,204,171,3,1,200,33,3,2,3,193,106,5,2,2,192,169,3,2,204,172,129,3,
+  2,204,173,20,0,4,141,3,0,196,47,3,1,200,34,3,1,200,35,3,1,200,36,3,
+  1,200,37,3,1,198,80,3,1,195,22,3,1,200,38,3,1,193,94,3,1,193,27,3,
+  1,200,39,3,1,200,40,0,3,196,161,74,220,238,0,2,220,239,220,240,0,3,198,120,
+  2,220,241,0,1,220,242,0,2,220,243,192,171,0,2,195,178,196,160,0,1,220,244,0,
+  1,220,245,0,1,220,246,0,1,220,247,0,3,193,166,0,220,248,2,1,220,249,2,1,
+  220,250,2,1,220,251,2,1,220,252,2,1,220,253,2,1,220,254,2,1,220,255,2,1,
+  204,174,2,1,221,0,0,3,193,166,0,221,1,2,1,221,2,2,1,221,3,2,1,221,
+  4,2,1,221,5,2,1,221,6,2,2,133,134,2,1,193,41,2,1,221,7,2,1,221,
+  8,2,1,221,9,2,1,221,10,2,1,221,11,2,1,221,12,2,1,221,13,2,1,221,
+  14,0,3,193,166,0,221,15,0,2,221,16,198,6,0,4,192,59,192,98,194,116,42,1,
+  2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,2,1,193,2,2,
+  1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,232,2,1,
+  193,13,0,3,192,59,0,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,2,
+  1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,193,154,2,1,167,
+  2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,0,3,192,59,0,192,233,2,1,
+  150,2,1,192,195,2,1,154,2,1,182,2,1,192,101,2,1,193,33,2,1,180,2,1,
+  192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,2,1,192,194,2,2,192,
+  234,192,203,3,2,51,192,203,0,4,192,59,0,123,112,3,1,193,73,3,1,98,3,1,
+  193,34,2,1,176,1,1,194,186,1,2,1,192,203,2,1,194,92,2,1,193,82,2,3,
+  31,192,203,38,2,1,193,191,2,1,204,175,2,1,193,20,2,1,193,47,1,3,16,1,
+  192,45,3,1,192,74,0,4,192,59,16,1,192,98,3,1,193,13,3,1,58,3,1,192,
+  80,3,1,192,233,3,1,46,3,1,192,103,3,2,123,112,4,1,193,73,4,1,98,4,
+  1,193,34,0,1,221,17,0,2,192,127,192,132,0,6,192,172,38,195,77,164,38,192,173,
+  2,4,192,173,38,195,77,164,2,2,91,27,0,5,192,172,38,195,81,38,192,173,3,2,
+  192,26,164,2,7,193,151,164,38,192,173,38,193,151,164,1,3,24,192,146,198,156,2,4,
+  196,215,192,146,164,66,1,2,195,27,192,173,1,4,195,47,192,146,164,66,3,2,194,132,
+  66,1,3,193,3,194,236,193,39,4,3,38,193,151,164,1,4,164,66,192,26,192,173,1,
+  2,192,26,198,156,2,2,164,66,2,2,194,132,66,2,1,192,173,2,3,193,151,164,66,
+  0,8,192,172,192,26,193,151,164,66,2,59,38,8,1,39,7,1,194,18,1,3,145,164,
+  66,1,2,197,148,192,173,1,1,1,1,3,2,120,194,18,2,1,59,2,3,193,127,42,
+  38,0,4,33,192,207,193,212,193,68,4,1,195,244,4,1,196,80,4,1,169,5,1,195,
+  244,3,1,85,4,1,134,0,6,33,192,207,193,212,85,134,195,244,5,1,196,80,4,1,
+  195,244,4,1,196,80,4,1,169,5,1,196,80,3,2,49,200,95,4,1,110,4,2,134,
+  195,244,5,1,196,80,4,1,193,49,4,2,169,195,244,5,1,196,80,3,2,192,66,200,
+  131,4,1,195,244,4,1,196,80,0,6,33,192,207,193,212,192,66,169,195,244,2,3,221,
+  18,85,134,2,3,221,19,54,204,176,2,3,221,20,85,200,131,2,3,200,132,85,134,3,
+  1,54,4,1,204,176,2,3,221,21,49,221,22,2,2,200,133,193,68,3,1,49,3,1,
+  192,66,2,2,221,23,192,66,2,3,221,24,85,134,2,3,221,25,193,68,200,131,2,2,
+  195,82,193,68,3,2,85,134,0,5,33,192,207,195,82,85,169,3,1,49,4,1,134,4,
+  1,169,3,1,192,66,3,1,193,117,3,2,65,134,3,1,54,2,2,196,216,193,68,4,
+  2,193,24,15,3,1,85,4,1,134,3,1,192,66,4,2,193,24,15,1,2,195,194,202,
+  245,1,2,221,26,1,0,3,33,221,27,1,1,2,194,28,11,1,5,5,193,14,195,83,
+  193,185,11,2,2,196,146,11,2,2,0,192,112,4,2,2,192,68,6,2,24,192,161,8,
+  2,24,193,152,7,1,192,243,8,2,24,193,152,7,1,193,152,7,1,192,162,8,2,24,
+  193,152,5,1,192,136,5,1,192,161,5,1,193,152,0,6,33,5,0,192,112,2,192,84,
+  6,2,24,192,161,8,2,24,193,152,7,1,192,243,8,2,24,193,152,7,1,193,152,7,
+  1,192,162,8,2,24,193,152,5,1,194,27,5,1,192,162,5,1,196,217,3,2,193,30,
+  196,174,3,1,194,28,3,1,193,169,3,1,194,2,3,1,193,43,0,6,33,5,0,193,
+  43,2,192,68,6,2,24,192,161,7,1,192,162,5,1,192,161,5,1,192,84,6,2,24,
+  192,161,7,1,192,162,5,1,194,27,5,1,192,162,3,1,192,191,4,2,2,192,68,6,
+  2,24,192,161,8,2,24,193,152,7,1,192,243,8,2,24,193,152,7,1,193,152,0,8,
+  33,5,0,192,191,2,192,68,24,192,162,8,2,24,193,152,5,1,192,161,5,1,193,152,
+  5,1,192,84,6,2,24,192,161,8,2,24,193,152,7,1,192,243,8,2,24,193,152,7,
+  1,193,152,7,1,192,162,8,2,24,193,152,5,1,194,27,5,1,192,162,3,1,193,239,
+  3,1,204,177,0,4,33,5,0,192,199,4,2,2,192,68,6,2,24,192,161,7,1,192,
+  243,7,1,192,162,5,1,194,72,5,1,192,136,5,1,192,161,5,1,192,84,6,2,24,
+  192,161,7,1,192,243,7,1,192,162,5,1,194,27,5,1,192,162,5,1,196,217,3,1,
+  194,54,0,4,33,5,0,194,164,3,1,193,31,3,1,193,92,3,1,192,108,4,2,2,
+  192,68,6,2,24,192,161,8,2,24,193,152,7,1,192,243,8,2,24,193,152,7,1,193,
+  152,7,1,192,162,8,2,24,193,152,5,1,192,161,5,1,193,152,5,1,192,84,6,2,
+  24,192,161,0,10,33,5,0,192,108,2,192,84,24,192,161,24,193,152,7,1,192,243,8,
+  2,24,193,152,7,1,193,152,7,1,192,162,8,2,24,193,152,5,1,194,27,5,1,192,
+  162,3,1,193,125,4,2,2,192,68,6,2,24,192,161,7,1,192,162,5,1,192,161,5,
+  1,192,84,6,2,24,192,161,7,1,192,162,0,6,33,5,0,193,125,2,194,27,5,1,
+  192,162,3,2,204,178,196,218,3,1,193,197,3,1,192,210,3,1,194,73,3,1,193,144,
+  4,2,2,192,68,3,1,196,214,3,1,195,7,3,1,193,185,3,1,194,50,3,1,193,
+  198,3,1,192,235,4,2,2,192,68,6,2,24,192,161,0,8,33,5,0,192,235,2,192,
+  68,24,192,243,7,1,192,162,5,1,194,72,5,1,192,136,5,1,192,161,5,1,194,27,
+  5,1,192,162,5,1,196,217,3,1,194,133,3,1,197,149,3,1,194,201,2,3,195,83,
+  193,185,11,2,5,192,56,193,14,195,83,193,185,11,3,3,195,83,193,185,11,2,2,193,
+  198,11,1,1,192,68,0,4,33,192,68,24,192,161,3,1,192,243,3,1,192,162,1,3,
+  194,72,24,192,161,3,1,192,243,3,1,192,162,2,1,194,27,1,2,200,95,1,1,3,
+  85,198,157,1,1,3,78,198,157,1,1,2,221,28,1,1,2,221,29,1,1,3,193,58,
+  192,85,204,179,3,1,204,180,3,1,204,181,3,1,204,182,0,4,33,193,58,192,85,204,
+  183,3,1,204,184,3,1,204,185,3,1,204,186,3,1,204,187,3,1,204,188,3,1,204,
+  189,3,1,221,30,3,1,221,31,3,1,221,32,3,1,221,33,3,1,221,34,3,1,221,
+  35,3,1,221,36,3,1,221,37,3,1,221,38,0,4,33,193,58,192,85,221,39,3,1,
+  204,190,3,1,221,40,3,1,221,41,3,1,221,42,3,1,221,43,3,1,221,44,3,1,
+  221,45,3,1,221,46,3,1,204,191,3,1,204,192,3,1,204,193,3,1,204,194,3,1,
+  204,195,3,1,204,196,3,1,204,197,0,4,33,193,58,192,85,204,198,1,2,196,146,11,
+  1,2,194,54,11,1,1,199,158,1,3,221,47,197,208,1,1,3,0,193,30,196,197,2,
+  1,196,218,2,1,196,197,2,1,196,174,2,3,3,5,193,239,4,1,194,164,4,1,192,
+  108,4,1,192,210,4,1,194,73,4,1,193,144,2,1,199,164,0,3,33,0,197,149,1,
+  2,221,48,1,1,3,107,192,90,1,1,3,195,83,193,43,11,2,2,193,185,11,1,2,
+  221,49,1,1,2,35,196,147,1,2,192,90,1,1,2,221,50,1,1,3,49,110,1,4,
+  2,193,24,15,2,2,193,49,1,1,2,221,51,1,1,1,192,161,1,1,192,243,1,2,
+  193,197,11,0,3,33,192,210,11,1,1,193,152,1,1,192,84,2,2,24,192,161,3,1,
+  192,243,3,1,192,162,1,2,193,127,42,1,4,192,56,195,83,193,43,11,1,2,193,144,
+  11,2,3,2,71,11,1,2,221,52,1,1,5,3,193,14,195,83,193,185,11,2,2,0,
+  192,112,4,2,2,192,68,6,2,24,192,161,8,2,24,193,48,0,8,33,3,0,192,112,
+  2,192,68,24,192,243,8,2,24,193,48,7,1,192,162,8,2,24,193,48,7,1,193,48,
+  5,1,192,136,5,1,192,161,6,2,24,193,48,5,1,192,243,6,2,24,193,48,5,1,
+  192,84,6,2,24,192,161,8,2,24,193,48,7,1,192,243,8,2,24,193,48,7,1,192,
+  162,0,10,33,3,0,192,112,2,192,84,24,192,162,24,193,48,7,1,193,48,5,1,194,
+  27,5,1,192,162,6,2,24,193,48,5,1,196,217,5,1,193,48,3,2,193,30,196,197,
+  4,1,196,174,3,1,194,28,3,1,193,169,3,1,194,2,3,1,196,218,3,1,193,43,
+  4,2,2,192,68,6,2,24,192,161,0,8,33,3,0,193,43,2,192,68,24,192,162,5,
+  1,192,161,5,1,192,84,6,2,24,192,161,7,1,192,162,5,1,194,27,5,1,192,162,
+  3,1,192,191,4,2,2,192,68,6,2,24,192,161,8,2,24,193,48,7,1,192,243,8,
+  2,24,193,48,7,1,192,162,8,2,24,193,48,7,1,193,48,0,6,33,3,0,192,191,
+  2,192,161,6,2,24,193,48,5,1,192,243,6,2,24,193,48,5,1,192,84,6,2,24,
+  192,161,8,2,24,193,48,7,1,192,243,8,2,24,193,48,7,1,192,162,8,2,24,193,
+  48,7,1,193,48,5,1,194,27,5,1,192,162,6,2,24,193,48,5,1,193,48,0,5,
+  33,3,0,50,193,185,3,1,193,239,3,1,204,177,3,1,192,199,4,2,2,192,68,6,
+  2,24,192,161,7,1,192,243,7,1,192,162,5,1,194,72,6,2,24,192,161,7,1,192,
+  243,7,1,194,27,7,1,192,162,5,1,192,136,5,1,192,161,5,1,192,243,0,6,33,
+  3,0,192,199,2,192,84,6,2,24,192,161,7,1,192,243,7,1,192,162,5,1,194,27,
+  5,1,192,162,5,1,196,217,3,1,194,54,3,1,196,197,3,1,194,164,3,1,193,31,
+  3,1,193,92,3,1,192,108,4,2,2,192,68,6,2,24,192,161,8,2,24,193,48,0,
+  8,33,3,0,192,108,2,192,68,24,192,243,8,2,24,193,48,7,1,192,162,8,2,24,
+  193,48,7,1,193,48,5,1,192,161,6,2,24,193,48,5,1,192,243,6,2,24,193,48,
+  5,1,192,84,6,2,24,192,161,8,2,24,193,48,7,1,192,243,8,2,24,193,48,7,
+  1,192,162,8,2,24,193,48,0,8,33,3,0,192,108,2,192,84,24,193,48,5,1,194,
+  27,5,1,192,162,6,2,24,193,48,5,1,193,48,3,1,193,125,4,2,2,192,68,6,
+  2,24,192,161,7,1,192,162,5,1,192,161,5,1,192,84,6,2,24,192,161,7,1,192,
+  162,5,1,194,27,5,1,192,162,3,2,204,178,196,218,0,4,33,3,0,193,197,3,1,
+  192,210,3,1,194,73,3,1,193,144,4,2,2,192,68,5,1,192,84,3,1,196,174,3,
+  1,196,214,3,1,195,7,3,1,193,185,3,1,199,164,3,1,194,50,3,1,193,198,3,
+  1,192,235,4,2,2,192,68,6,2,24,192,161,0,8,33,3,0,192,235,2,192,68,24,
+  192,243,7,1,192,162,5,1,194,72,6,2,24,192,161,7,1,192,243,7,1,194,27,7,
+  1,192,162,5,1,192,136,5,1,192,161,5,1,192,243,5,1,192,84,6,2,24,192,161,
+  7,1,192,243,7,1,192,162,5,1,194,27,5,1,192,162,0,6,33,3,0,192,235,2,
+  196,217,3,1,194,133,3,1,194,201,2,5,192,56,193,14,195,83,193,185,11,3,3,195,
+  83,193,185,11,1,4,193,29,3,0,194,28,4,1,193,169,4,1,193,239,4,1,193,197,
+  4,1,193,144,1,3,11,194,50,193,144,1,2,221,53,1,1,2,193,198,11,1,3,65,
+  198,157,1,2,2,194,135,1,1,1,194,27,0,4,33,221,54,197,208,1,1,3,54,198,
+  157,1,2,2,195,140,1,1,6,192,235,2,192,31,24,82,11,3,4,192,96,24,82,11,
+  3,2,82,11,1,1,192,162,1,3,193,134,192,85,204,179,3,1,221,55,3,1,204,180,
+  3,1,204,181,3,1,204,182,3,1,204,183,3,1,221,56,3,1,221,57,3,1,204,184,
+  0,4,33,193,134,192,85,204,185,3,1,204,186,3,1,204,187,3,1,221,58,3,1,221,
+  59,3,1,221,60,3,1,204,188,3,1,204,189,3,1,221,61,3,1,204,190,3,1,204,
+  191,3,1,204,192,3,1,204,193,3,1,204,194,3,1,204,195,3,1,204,196,0,4,33,
+  193,134,192,85,221,62,3,1,204,197,3,1,204,198,3,1,221,63,1,2,221,64,1,1,
+  2,204,199,1,1,1,193,48,1,2,192,33,1,0,2,195,245,204,200,1,1,196,138,1,
+  1,193,118,1,1,221,65,0,2,221,66,104,0,6,197,150,194,191,104,2,193,207,193,184,
+  1,1,104,2,7,2,49,192,34,24,49,3,195,63,0,5,197,150,104,2,193,207,193,184,
+  3,2,192,171,193,184,0,2,204,201,42,0,2,221,67,193,118,0,2,221,68,1,0,1,
+  221,69,0,2,221,70,196,158,0,1,221,71,0,3,192,37,194,21,1,1,2,14,115,2,
+  1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,0,3,192,37,14,65,2,
+  1,54,2,1,192,33,1,2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,
+  192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,
+  25,2,1,192,232,2,1,56,0,3,192,37,0,192,3,2,1,192,239,2,1,129,2,1,
+  58,2,1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,
+  1,193,154,2,1,167,2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,0,3,192,
+  37,0,53,2,1,150,2,1,192,195,2,1,154,2,1,182,2,1,192,101,2,1,193,33,
+  2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,2,1,
+  192,194,2,2,123,112,3,1,193,73,0,4,192,37,0,123,98,3,1,193,34,2,1,176,
+  2,1,193,236,1,1,194,186,1,2,195,186,1,1,2,1,192,203,2,1,194,92,2,1,
+  193,82,2,3,120,193,191,38,2,1,202,38,2,1,193,191,2,1,194,152,2,1,195,180,
+  2,3,221,72,193,191,38,2,3,200,134,193,191,38,0,3,192,37,1,193,20,2,1,193,
+  47,1,3,16,194,114,56,3,1,53,2,2,1,192,45,3,1,192,74,3,1,192,98,3,
+  2,194,114,56,4,1,53,3,1,56,3,1,58,3,1,192,80,3,1,53,3,1,46,3,
+  1,192,103,3,2,123,112,0,5,192,37,16,1,123,193,73,4,1,98,4,1,193,34,0,
+  4,192,160,137,14,115,3,1,85,3,1,78,3,1,133,3,1,49,3,1,128,3,1,117,
+  3,1,65,3,1,54,3,1,192,33,2,2,0,20,3,1,192,45,3,1,192,74,0,4,
+  192,160,137,0,192,98,3,1,192,32,3,1,193,2,3,1,192,107,3,1,192,142,3,1,
+  191,3,1,192,220,3,1,193,25,3,1,192,232,3,1,193,13,3,1,192,3,3,1,192,
+  239,3,1,129,3,1,58,3,1,192,80,3,1,192,102,0,4,192,160,137,0,193,60,3,
+  1,90,3,1,192,144,3,1,170,3,1,193,154,3,1,167,3,1,173,3,1,192,95,3,
+  1,192,233,3,1,150,3,1,192,195,3,1,154,3,1,182,3,1,180,3,1,192,167,3,
+  1,192,214,0,4,192,160,137,0,193,12,3,1,46,3,1,192,103,3,1,192,194,3,1,
+  176,2,1,194,186,2,2,1,192,203,3,1,193,47,2,1,193,20,2,3,16,1,192,45,
+  4,1,192,74,4,1,192,98,4,1,193,13,4,1,58,4,1,192,80,4,1,192,233,0,
+  5,192,160,137,16,1,46,4,1,192,103,0,3,192,82,194,21,1,1,1,221,73,1,2,
+  14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,
+  1,54,2,1,192,33,1,2,196,219,221,74,1,1,221,75,0,3,192,82,0,20,2,1,
+  192,45,2,1,192,74,2,1,192,98,2,1,192,32,2,1,193,2,2,1,192,107,2,1,
+  192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,232,2,1,193,13,2,1,193,
+  18,2,1,192,3,2,1,192,239,0,3,192,82,0,200,83,2,1,129,2,1,58,2,1,
+  192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,204,7,2,1,170,
+  2,1,193,154,2,1,167,2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,0,3,
+  192,82,0,192,233,2,1,150,2,1,192,195,2,1,154,2,1,194,6,2,1,182,2,1,
+  192,101,2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,
+  2,1,192,194,2,1,176,2,1,192,221,0,4,192,82,1,221,76,204,202,2,1,204,202,
+  2,1,193,191,2,1,221,77,2,1,193,20,2,1,193,47,2,1,221,78,1,1,221,79,
+  1,1,221,80,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,1,193,13,3,1,
+  58,3,1,192,80,3,1,192,233,0,4,192,82,16,1,46,3,1,192,103,0,1,221,81,
+  0,2,196,77,193,242,0,1,221,82,0,3,155,55,43,1,2,183,27,1,3,221,83,122,
+  83,1,2,28,195,146,2,2,0,20,3,1,193,85,3,1,195,204,3,1,195,129,3,1,
+  56,3,1,197,151,3,1,195,149,0,4,155,28,0,195,205,3,1,58,3,1,195,130,3,
+  1,195,206,3,1,195,207,3,1,200,135,3,1,195,208,3,1,195,209,3,1,198,158,3,
+  1,198,159,3,1,53,3,1,193,4,3,1,195,210,3,1,195,211,3,1,198,160,3,1,
+  195,212,0,4,155,28,0,198,161,3,1,198,162,3,1,198,163,3,1,200,136,3,1,198,
+  164,3,1,198,165,3,1,200,137,3,1,195,213,3,1,198,166,3,1,198,167,3,1,198,
+  168,3,1,198,169,3,1,198,170,3,1,195,214,3,1,195,215,3,1,46,0,4,155,28,
+  0,192,109,3,1,200,138,3,1,193,178,3,1,200,139,3,1,193,234,3,1,176,3,1,
+  197,123,3,1,194,91,3,1,200,140,3,1,9,3,1,193,94,3,1,193,27,1,2,158,
+  192,168,2,2,192,209,192,104,1,3,72,0,20,3,1,56,0,4,155,72,0,129,3,1,
+  193,19,3,1,193,57,3,1,193,158,3,1,194,158,3,1,58,3,1,90,3,1,193,250,
+  3,1,193,203,3,1,193,196,3,1,193,230,3,1,167,3,1,193,80,3,1,193,119,3,
+  1,193,231,3,1,193,31,0,4,155,72,0,152,3,1,173,3,1,193,71,3,1,193,72,
+  3,1,193,28,3,1,193,92,3,1,53,3,1,154,3,1,194,39,3,1,194,86,3,1,
+  193,179,3,1,193,217,3,1,182,3,1,193,228,3,1,193,218,3,2,3,20,0,5,155,
+  72,0,3,56,4,1,58,4,1,53,4,1,193,190,4,1,46,4,1,176,4,1,193,94,
+  4,1,193,27,3,1,193,180,3,1,193,235,3,1,180,3,1,193,54,3,1,194,22,3,
+  1,66,3,1,193,190,3,1,46,0,4,155,72,0,192,109,3,1,193,208,3,1,176,3,
+  1,193,94,3,1,193,27,2,2,76,59,2,3,200,41,194,66,42,2,3,195,65,194,66,
+  42,1,4,196,57,204,203,194,66,42,1,3,39,193,56,130,1,2,108,27,1,3,37,193,
+  56,130,1,2,91,27,1,2,187,27,1,2,63,120,0,1,221,84,0,1,198,171,1,2,
+  24,204,204,2,1,221,85,2,1,204,205,0,1,221,86,0,2,221,87,104,0,7,193,105,
+  2,106,24,76,193,108,194,195,3,4,195,80,24,144,194,195,0,1,221,88,0,1,221,89,
+  0,1,221,90,0,3,28,149,221,91,2,1,221,92,2,1,221,93,2,1,221,94,2,1,
+  221,95,0,3,28,149,195,204,2,1,221,96,2,1,221,97,2,1,221,98,2,1,221,99,
+  2,1,221,100,2,1,221,101,2,1,221,102,2,1,195,129,2,1,221,103,2,1,195,146,
+  2,1,195,205,2,1,221,104,2,1,195,130,2,1,221,105,2,1,221,106,0,3,28,149,
+  221,107,2,1,204,206,2,1,221,108,2,1,221,109,2,1,221,110,2,1,221,111,2,1,
+  221,112,2,1,221,113,2,1,221,114,2,1,221,115,2,1,200,141,2,1,200,142,2,1,
+  200,143,2,1,204,207,2,1,204,208,2,1,195,206,0,3,28,149,195,207,2,1,221,116,
+  2,1,195,208,2,1,204,209,2,1,200,144,2,1,200,145,2,1,221,117,2,1,195,209,
+  2,1,198,158,2,1,198,159,2,1,204,210,2,1,221,118,2,1,200,146,2,1,200,147,
+  2,1,200,148,2,1,195,210,0,3,28,149,221,119,2,1,204,211,2,1,195,211,2,1,
+  204,212,2,1,200,149,2,1,204,213,2,1,221,120,2,1,204,214,2,1,221,121,2,1,
+  204,215,2,1,198,160,2,1,221,122,2,1,204,216,2,1,221,123,2,1,221,124,2,1,
+  200,150,0,3,28,149,221,125,2,1,204,217,2,1,200,151,2,1,195,212,2,1,221,126,
+  2,1,198,161,2,1,204,218,2,1,204,219,2,1,198,162,2,1,198,163,2,1,204,220,
+  2,1,198,164,2,1,198,165,2,1,204,221,2,1,221,127,2,1,221,128,0,3,28,149,
+  200,152,2,1,195,213,2,1,204,222,2,1,200,153,2,1,204,223,2,1,221,129,2,1,
+  221,130,2,1,200,154,2,1,204,224,2,1,204,225,2,1,221,131,2,1,200,155,2,1,
+  221,132,2,1,204,226,2,1,221,133,2,1,204,227,0,3,28,149,200,156,2,1,198,166,
+  2,1,221,134,2,1,204,228,2,1,200,157,2,1,198,167,2,1,200,158,2,1,198,168,
+  2,1,204,229,2,1,198,169,2,1,221,135,2,1,221,136,2,1,198,170,2,1,221,137,
+  2,1,195,214,2,1,195,215,0,3,28,149,204,230,2,1,204,231,2,1,221,138,2,1,
+  204,232,2,1,204,233,2,1,204,234,2,1,200,159,2,1,200,160,1,4,51,59,136,42,
+  1,1,195,146,1,2,138,195,204,2,1,195,129,2,1,221,139,2,1,221,140,2,1,195,
+  205,2,1,221,141,0,3,28,138,221,142,2,1,221,143,2,1,221,144,2,1,195,130,2,
+  1,221,145,2,1,204,206,2,1,221,146,2,1,200,141,2,1,200,142,2,1,200,143,2,
+  1,204,207,2,1,195,206,2,1,195,207,2,1,221,147,2,1,221,148,2,1,221,149,0,
+  3,28,138,221,150,2,1,221,151,2,1,221,152,2,1,200,135,2,1,221,153,2,1,195,
+  208,2,1,221,154,2,1,221,155,2,1,221,156,2,1,204,209,2,1,221,157,2,1,204,
+  235,2,1,200,144,2,1,221,158,2,1,221,159,2,1,200,145,0,3,28,138,221,160,2,
+  1,221,161,2,1,195,209,2,1,221,162,2,1,198,158,2,1,198,159,2,1,204,210,2,
+  1,204,236,2,1,221,163,2,1,200,146,2,1,221,164,2,1,200,147,2,1,200,148,2,
+  1,221,165,2,1,221,166,2,1,195,210,0,3,28,138,204,211,2,1,221,167,2,1,221,
+  168,2,1,195,211,2,1,204,212,2,1,200,149,2,1,204,213,2,1,221,169,2,1,204,
+  215,2,1,221,170,2,1,221,171,2,1,198,160,2,1,200,150,2,1,200,151,2,1,195,
+  212,2,1,198,161,0,3,28,138,204,218,2,1,204,219,2,1,198,162,2,1,221,172,2,
+  1,204,237,2,1,198,163,2,1,221,173,2,1,221,174,2,1,221,175,2,1,204,220,2,
+  1,204,238,2,1,200,136,2,1,198,164,2,1,221,176,2,1,221,177,2,1,204,239,0,
+  3,28,138,221,178,2,1,198,165,2,1,204,221,2,1,221,179,2,1,200,137,2,1,200,
+  152,2,1,221,180,2,1,204,240,2,1,221,181,2,1,221,182,2,1,195,213,2,1,204,
+  222,2,1,200,153,2,1,204,223,2,1,221,183,2,1,200,154,0,3,28,138,204,224,2,
+  1,221,184,2,1,200,155,2,1,204,226,2,1,204,227,2,1,200,156,2,1,198,166,2,
+  1,200,157,2,1,198,167,2,1,221,185,2,1,200,158,2,1,198,168,2,1,204,229,2,
+  1,221,186,2,1,198,169,2,1,221,187,0,3,28,138,221,188,2,1,198,170,2,1,221,
+  189,2,1,195,214,2,1,195,215,2,1,221,190,2,1,204,230,2,1,204,231,2,1,204,
+  232,2,1,204,233,2,1,204,234,2,1,221,191,2,1,221,192,2,1,200,159,2,1,200,
+  160,2,1,221,193,0,3,28,138,221,194,2,1,204,241,2,1,204,242,1,2,192,29,20,
+  2,1,221,195,2,1,221,196,2,1,221,197,2,1,193,85,2,1,204,243,2,1,221,198,
+  2,1,221,199,2,1,221,200,2,1,221,201,2,1,221,202,2,1,56,2,1,197,151,0,
+  3,28,192,29,221,203,2,1,221,204,2,1,221,205,2,1,195,149,2,1,221,206,2,1,
+  221,207,2,1,221,208,2,1,221,209,2,1,221,210,2,1,221,211,2,1,195,146,2,1,
+  58,2,1,221,212,2,1,221,213,2,1,221,214,2,1,221,215,0,3,28,192,29,221,216,
+  2,1,221,217,2,1,221,218,2,1,221,219,2,1,221,220,2,1,221,221,2,1,221,222,
+  2,1,221,223,2,1,221,224,2,1,221,225,2,1,53,2,1,221,226,2,1,221,227,2,
+  1,221,228,2,1,221,229,2,1,221,230,0,3,28,192,29,221,231,2,1,221,232,2,1,
+  221,233,2,1,221,234,2,1,193,4,2,1,221,235,2,1,46,2,1,221,236,2,1,221,
+  237,2,1,221,238,2,1,221,239,2,1,221,240,2,1,221,241,2,1,221,242,2,1,192,
+  109,2,1,200,138,0,3,28,192,29,193,178,2,1,200,139,2,1,193,234,2,1,176,2,
+  1,221,243,2,1,221,244,2,1,204,244,2,1,197,123,2,1,194,91,2,1,200,140,2,
+  1,221,245,2,1,221,246,2,1,221,247,2,1,9,2,1,221,248,2,1,193,94,0,3,
+  28,192,29,221,249,2,1,221,250,2,1,221,251,2,1,204,245,2,1,221,252,2,1,204,
+  246,2,1,204,247,2,1,221,253,2,1,193,27,2,1,221,254,2,1,221,255,2,1,222,
+  0,2,1,222,1,2,1,204,248,2,1,222,2,2,1,222,3,0,3,28,192,29,204,249,
+  2,1,204,250,1,2,0,20,2,1,193,85,2,1,204,243,2,1,222,4,2,1,195,204,
+  2,1,195,129,2,1,56,2,1,197,151,2,1,195,149,2,1,195,205,2,1,58,2,1,
+  195,130,2,1,200,141,2,1,200,142,0,3,28,0,200,143,2,1,204,208,2,1,195,206,
+  2,1,195,207,2,1,200,135,2,1,195,208,2,1,204,235,2,1,200,144,2,1,200,145,
+  2,1,195,209,2,1,198,158,2,1,198,159,2,1,204,236,2,1,200,146,2,1,200,147,
+  2,1,53,0,3,28,0,193,4,2,1,200,148,2,1,195,210,2,1,195,211,2,1,200,
+  149,2,1,204,214,2,1,198,160,2,1,204,216,2,1,200,150,2,1,204,217,2,1,200,
+  151,2,1,195,212,2,1,198,161,2,1,198,162,2,1,204,237,2,1,198,163,0,3,28,
+  0,204,238,2,1,200,136,2,1,198,164,2,1,204,239,2,1,198,165,2,1,200,137,2,
+  1,200,152,2,1,204,240,2,1,195,213,2,1,200,153,2,1,200,154,2,1,204,225,2,
+  1,200,155,2,1,200,156,2,1,198,166,2,1,204,228,0,3,28,0,200,157,2,1,198,
+  167,2,1,200,158,2,1,198,168,2,1,198,169,2,1,198,170,2,1,195,214,2,1,195,
+  215,2,1,46,2,1,192,109,2,1,200,138,2,1,193,178,2,1,200,139,2,1,193,234,
+  2,1,176,2,1,197,123,0,3,28,0,194,91,2,1,200,140,2,1,200,159,2,1,200,
+  160,2,1,204,241,2,1,204,242,2,1,9,2,1,193,94,2,1,204,245,2,1,204,246,
+  2,1,204,247,2,1,193,27,2,1,204,248,2,1,204,249,2,1,204,250,1,4,192,76,
+  59,136,42,0,3,194,251,192,90,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,
+  128,2,1,117,2,1,192,66,2,1,193,117,2,1,65,2,1,192,224,2,1,54,0,4,
+  192,222,192,215,14,115,3,1,85,3,1,78,3,1,133,0,4,192,222,192,215,14,49,3,
+  1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,2,2,0,20,3,1,192,32,3,
+  1,192,107,3,1,191,3,1,192,220,3,1,193,18,3,1,192,3,3,1,129,3,1,192,
+  102,3,1,90,0,4,192,222,192,215,0,192,144,3,2,204,251,192,109,4,1,176,3,1,
+  170,3,1,167,3,1,173,3,1,192,95,3,1,192,145,3,1,150,3,1,154,3,1,194,
+  6,3,1,182,3,1,192,101,3,1,180,3,1,192,214,3,1,192,194,0,4,192,222,192,
+  215,0,192,109,3,1,176,3,1,192,221,2,3,42,173,222,5,3,1,222,6,2,2,1,
+  222,7,3,1,222,8,3,1,222,9,3,1,222,10,2,2,16,20,3,1,56,3,1,58,
+  3,1,53,3,1,46,0,3,194,0,0,20,2,1,192,32,0,3,194,0,0,191,2,1,
+  192,3,2,1,129,2,1,58,2,1,90,2,1,170,2,1,167,2,1,173,2,1,192,95,
+  2,1,150,2,1,154,2,1,182,2,1,180,2,1,46,2,1,192,109,2,1,176,0,3,
+  194,0,1,204,252,1,3,16,1,58,3,1,46,0,5,222,11,193,232,204,253,49,193,105,
+  0,2,195,55,197,56,0,2,222,12,199,70,0,3,193,186,0,194,68,2,1,204,254,2,
+  1,194,69,2,1,222,13,2,1,194,95,2,1,193,19,2,1,194,121,2,1,194,96,2,
+  1,194,122,2,1,194,26,0,3,193,186,0,192,177,2,1,192,238,2,1,195,240,2,1,
+  194,103,2,1,194,97,2,1,193,86,2,1,194,70,2,1,195,28,2,1,193,11,2,1,
+  194,123,2,1,204,255,1,2,29,85,2,1,49,3,1,134,2,1,192,66,2,1,192,224,
+  0,1,222,14,0,1,205,0,1,2,222,15,11,0,2,222,16,197,152,0,2,193,118,205,
+  1,1,1,195,133,1,2,2,27,2,1,195,30,2,4,193,255,192,135,193,1,39,0,3,
+  75,195,172,192,150,1,4,27,193,183,195,31,49,5,1,110,5,1,194,174,4,2,54,195,
+  140,1,1,192,245,1,2,194,179,192,57,0,7,75,55,194,7,183,24,91,27,3,4,187,
+  24,91,27,2,1,193,118,1,4,196,137,188,192,157,27,2,2,91,27,2,3,192,50,192,
+  157,27,1,2,194,145,42,1,2,205,2,200,161,1,1,120,2,3,2,120,194,18,3,5,
+  71,24,54,140,38,1,2,45,195,12,1,4,222,17,55,91,27,1,4,194,197,192,92,91,
+  27,1,2,195,203,1,1,2,196,32,1,0,6,75,51,192,168,193,124,42,192,150,2,5,
+  160,192,168,193,124,42,192,150,1,5,183,27,2,193,205,192,97,4,3,192,34,193,205,192,
+  97,1,4,115,193,52,55,192,171,3,2,195,151,192,171,3,3,204,91,55,192,171,2,2,
+  194,43,192,245,2,3,196,75,204,92,192,245,1,2,193,64,1,1,3,193,170,42,192,150,
+  3,1,11,1,4,85,193,52,55,192,171,2,2,194,43,192,245,1,3,78,199,78,192,245,
+  1,2,33,192,211,0,5,75,193,118,193,170,42,192,150,1,2,172,194,46,1,2,197,153,
+  192,150,1,2,192,34,120,1,2,7,192,211,1,4,194,8,192,156,130,192,150,3,3,193,
+  124,42,192,150,1,5,108,27,2,193,205,192,97,4,3,192,34,193,205,192,97,1,4,32,
+  177,194,177,192,150,1,6,135,51,192,168,193,124,42,192,150,2,5,192,76,192,168,193,124,
+  42,192,150,1,5,107,198,172,63,91,27,1,2,193,252,1,1,2,194,193,192,57,1,3,
+  188,192,157,27,0,5,75,188,192,157,192,89,195,246,4,2,195,155,193,238,2,3,192,196,
+  192,89,195,246,4,2,195,155,193,238,1,3,177,192,147,192,211,1,3,196,74,55,192,171,
+  1,4,197,154,2,197,154,194,18,1,2,97,1,1,4,193,206,192,156,130,192,150,3,3,
+  193,124,42,192,150,1,2,91,27,3,3,2,193,205,192,97,4,3,192,34,193,205,192,97,
+  1,3,222,18,91,27,1,1,195,12,1,3,48,197,153,192,150,0,5,75,157,32,194,177,
+  192,150,1,5,192,76,192,168,193,124,42,192,150,2,5,160,192,168,193,124,42,192,150,1,
+  4,117,193,52,55,192,171,2,2,194,43,192,245,1,3,192,50,192,157,27,3,2,192,89,
+  195,246,4,2,195,155,193,238,2,3,192,196,192,89,195,246,4,2,195,155,193,238,1,1,
+  205,3,1,3,222,19,91,27,1,2,196,75,192,245,2,2,195,151,192,245,1,3,192,92,
+  91,27,1,4,194,124,193,52,55,192,171,0,5,75,194,124,193,52,195,151,192,171,1,5,
+  113,198,172,63,91,27,1,5,187,27,2,193,205,192,97,4,3,192,34,193,205,192,97,1,
+  2,83,119,1,3,205,4,91,27,1,2,63,120,2,2,194,183,174,2,1,43,1,3,193,
+  23,91,27,0,4,142,192,132,222,20,222,21,2,1,222,22,2,1,222,23,2,1,222,24,
+  2,1,200,162,3,1,222,25,0,3,142,192,132,205,5,2,1,222,26,2,1,222,27,2,
+  1,205,6,3,1,222,28,2,1,222,29,2,1,222,30,2,1,222,31,2,1,222,32,2,
+  1,222,33,2,2,222,34,205,7,2,1,222,35,2,1,200,163,2,1,222,36,2,2,205,
+  8,222,37,3,1,222,38,0,3,142,192,132,222,39,2,1,222,40,2,3,222,41,199,58,
+  222,42,2,1,222,43,2,2,205,9,222,44,3,1,205,10,2,1,222,45,2,1,222,46,
+  1,2,0,118,3,2,2,200,164,4,1,198,173,4,1,198,174,2,2,199,44,194,235,3,
+  2,97,1,2,1,194,235,2,1,196,132,0,5,142,0,196,132,2,193,213,4,1,198,175,
+  2,1,198,109,3,2,2,193,213,2,2,50,192,219,4,2,2,193,213,3,1,194,26,3,
+  1,192,177,3,1,192,238,4,2,2,193,213,3,1,200,165,2,1,194,95,3,2,2,193,
+  213,2,1,193,19,3,2,2,200,164,2,1,205,11,0,3,142,0,192,219,3,2,2,193,
+  213,4,1,198,175,2,1,198,176,3,2,2,193,213,2,1,194,26,3,2,2,193,213,2,
+  1,192,177,3,2,2,193,213,2,1,192,238,3,2,2,193,213,4,1,198,175,2,1,200,
+  166,3,2,2,193,213,2,1,194,192,3,2,2,193,213,0,3,142,0,194,97,3,2,2,
+  193,213,2,1,193,86,3,2,2,193,213,5,3,24,193,86,59,6,2,198,177,59,4,2,
+  193,86,59,4,2,198,177,59,2,1,200,167,3,2,2,193,213,2,1,196,28,3,2,2,
+  193,213,2,1,200,165,3,2,2,193,213,2,1,196,220,3,2,2,193,213,0,5,142,0,
+  196,220,2,200,168,2,2,194,239,118,3,1,198,109,3,2,50,194,26,3,1,193,19,3,
+  1,192,219,3,1,198,176,3,1,194,192,3,1,200,167,2,1,195,84,3,2,2,193,213,
+  4,1,205,12,2,1,194,159,3,2,2,193,213,1,3,32,118,198,176,2,3,198,178,51,
+  196,220,0,5,142,32,198,178,51,195,84,3,2,196,220,195,84,3,3,195,84,195,84,198,
+  173,1,3,42,107,59,2,2,222,47,120,2,2,113,59,1,4,193,162,193,213,192,26,200,
+  164,2,2,200,169,198,173,3,1,198,174,3,1,200,163,2,1,205,12,2,1,200,168,3,
+  3,222,48,40,196,220,2,2,222,49,222,50,2,1,222,51,2,1,198,173,0,3,142,193,
+  162,198,174,3,1,205,10,2,1,222,52,2,1,198,175,2,1,200,163,2,1,222,53,2,
+  2,193,86,59,2,2,198,177,59,2,1,222,54,1,2,192,4,200,162,2,1,205,5,2,
+  1,222,55,2,2,192,177,222,56,2,1,222,57,2,2,205,13,222,58,1,2,195,84,174,
+  0,1,222,59,0,1,222,60,0,3,222,61,222,62,11,0,2,222,63,11,0,4,198,179,
+  2,63,192,211,0,3,64,0,222,64,2,1,222,65,2,1,222,66,2,1,222,67,2,1,
+  222,68,2,1,222,69,2,1,222,70,2,1,222,71,2,1,222,72,2,1,222,73,2,1,
+  222,74,0,3,64,0,222,75,2,1,222,76,2,1,222,77,2,1,222,78,2,1,222,79,
+  2,1,222,80,2,1,222,81,2,1,222,82,2,1,222,83,2,1,222,84,2,1,222,85,
+  2,1,222,86,2,1,222,87,2,1,222,88,2,1,222,89,2,1,222,90,0,3,64,0,
+  222,91,2,1,222,92,2,1,222,93,2,1,222,94,2,1,222,95,2,1,222,96,2,1,
+  222,97,2,1,222,98,2,1,222,99,2,1,222,100,2,1,222,101,2,1,222,102,2,1,
+  222,103,2,1,222,104,2,1,222,105,2,1,222,106,0,3,64,0,222,107,2,1,222,108,
+  2,1,222,109,2,1,222,110,2,1,222,111,2,1,222,112,2,1,222,113,2,1,222,114,
+  2,1,222,115,2,1,222,116,2,1,222,117,2,1,222,118,2,1,222,119,2,1,222,120,
+  2,1,222,121,2,1,222,122,0,3,64,0,222,123,2,1,222,124,2,1,222,125,2,1,
+  222,126,2,1,222,127,2,1,222,128,2,1,222,129,2,1,222,130,2,1,222,131,2,1,
+  222,132,2,1,222,133,2,1,222,134,2,1,222,135,2,1,222,136,2,1,222,137,2,1,
+  222,138,0,3,64,0,222,139,2,1,222,140,2,1,222,141,2,1,222,142,2,1,222,143,
+  2,1,222,144,2,1,222,145,2,1,222,146,2,1,222,147,2,1,222,148,2,1,222,149,
+  2,1,222,150,2,1,222,151,2,1,222,152,2,1,222,153,2,1,222,154,0,3,64,0,
+  222,155,2,1,222,156,2,1,222,157,2,1,222,158,2,1,222,159,2,1,222,160,2,1,
+  222,161,2,1,222,162,2,1,222,163,2,1,222,164,2,1,222,165,2,1,222,166,2,1,
+  222,167,2,1,222,168,2,1,222,169,2,1,222,170,0,3,64,0,222,171,2,1,222,172,
+  2,1,222,173,2,1,222,174,2,1,222,175,2,1,222,176,2,1,222,177,2,1,222,178,
+  2,1,222,179,2,1,205,14,2,1,222,180,2,1,222,181,2,1,222,182,2,1,222,183,
+  2,1,222,184,2,1,222,185,0,3,64,0,222,186,2,1,222,187,2,1,205,15,2,1,
+  222,188,2,1,222,189,2,1,222,190,2,1,222,191,2,1,222,192,2,1,222,193,2,1,
+  222,194,2,1,222,195,2,1,222,196,2,1,222,197,2,1,222,198,2,1,222,199,2,1,
+  222,200,0,3,64,0,222,201,2,1,222,202,2,1,222,203,2,1,222,204,2,1,222,205,
+  2,1,222,206,2,1,222,207,2,1,222,208,2,1,222,209,2,1,222,210,2,1,222,211,
+  2,1,222,212,2,1,205,16,2,1,222,213,2,1,222,214,2,1,222,215,0,3,64,0,
+  222,216,2,1,222,217,2,1,222,218,2,1,222,219,2,1,222,220,2,1,222,221,2,1,
+  222,222,2,1,222,223,2,1,222,224,2,1,222,225,2,1,222,226,2,1,222,227,2,1,
+  222,228,2,1,222,229,2,1,222,230,2,1,222,231,0,3,64,0,222,232,2,1,222,233,
+  2,1,222,234,2,1,222,235,2,1,222,236,2,1,222,237,2,1,222,238,2,1,205,17,
+  2,1,222,239,2,1,222,240,2,1,222,241,2,1,222,242,2,1,222,243,2,1,222,244,
+  2,1,222,245,2,1,222,246,0,3,64,0,222,247,2,1,222,248,2,1,222,249,2,1,
+  222,250,2,1,222,251,2,1,222,252,2,1,222,253,2,1,222,254,2,1,222,255,2,1,
+  223,0,2,1,223,1,2,1,223,2,2,1,223,3,2,1,223,4,2,1,223,5,2,1,
+  223,6,0,3,64,0,223,7,2,1,223,8,2,1,223,9,2,1,223,10,2,1,223,11,
+  2,1,223,12,2,1,223,13,2,1,223,14,2,1,223,15,2,1,205,18,2,1,223,16,
+  2,1,223,17,2,1,223,18,2,1,205,19,2,1,223,19,2,1,223,20,0,3,64,0,
+  223,21,2,1,223,22,2,1,223,23,2,1,223,24,2,1,223,25,2,1,223,26,2,1,
+  223,27,2,1,223,28,2,1,223,29,2,1,223,30,2,1,223,31,2,1,223,32,2,1,
+  223,33,2,1,223,34,2,1,223,35,2,1,223,36,0,3,64,0,223,37,2,1,223,38,
+  2,1,223,39,2,1,223,40,2,1,223,41,2,1,223,42,2,1,223,43,2,1,223,44,
+  2,1,223,45,2,1,223,46,2,1,223,47,2,1,223,48,2,1,223,49,2,1,223,50,
+  2,1,223,51,2,1,223,52,0,3,64,0,223,53,2,1,223,54,2,1,223,55,2,1,
+  223,56,2,1,223,57,2,1,223,58,2,1,223,59,2,1,223,60,2,1,223,61,2,1,
+  223,62,2,1,223,63,2,1,223,64,2,1,223,65,2,1,223,66,2,1,223,67,2,1,
+  223,68,0,3,64,0,223,69,2,1,223,70,2,1,223,71,2,1,223,72,2,1,223,73,
+  2,1,223,74,2,1,223,75,2,1,204,244,2,1,223,76,2,1,223,77,2,1,223,78,
+  2,1,223,79,2,1,223,80,2,1,223,81,2,1,223,82,2,1,223,83,0,3,64,0,
+  223,84,2,1,223,85,0,1,223,86,0,3,223,87,223,88,223,89,0,3,192,154,40,223,
+  90,2,2,223,91,200,170,2,1,223,92,2,2,223,93,200,170,2,2,202,171,194,136,2,
+  1,223,94,2,3,223,95,66,205,20,2,1,223,96,2,1,223,97,2,4,205,21,74,193,
+  1,122,2,1,203,255,2,1,223,98,0,3,192,154,40,223,99,2,4,223,100,193,160,193,
+  1,223,101,2,1,223,102,2,1,223,103,2,1,223,104,2,1,223,105,2,1,205,22,2,
+  2,200,171,198,180,2,1,200,172,2,2,196,221,205,23,3,1,196,222,3,1,205,24,3,
+  1,205,25,2,2,196,208,198,180,2,1,200,173,2,1,223,106,0,4,192,154,40,205,26,
+  223,107,2,1,223,108,2,1,223,109,2,1,223,110,2,2,192,228,196,223,2,1,223,111,
+  2,1,200,174,2,1,223,112,2,1,200,94,2,1,223,113,2,2,223,114,203,150,2,1,
+  223,115,2,1,197,155,2,1,223,116,2,2,3,205,24,3,1,205,25,0,4,192,154,40,
+  223,117,223,118,2,1,223,119,2,3,193,1,223,120,194,146,3,1,223,121,3,2,223,122,
+  200,175,3,1,205,27,3,2,223,123,195,1,3,2,223,124,198,114,3,1,204,147,3,2,
+  223,125,195,20,3,2,223,126,205,28,3,3,205,29,223,127,195,247,3,2,223,128,223,129,
+  3,2,223,130,194,84,3,1,223,131,3,1,223,132,0,3,192,154,40,223,133,2,1,205,
+  30,2,4,200,176,192,135,193,1,223,134,2,2,223,135,223,136,0,1,223,137,0,3,139,
+  205,31,11,1,2,223,138,1,0,2,223,139,196,21,0,2,205,32,200,177,2,3,2,194,
+  154,195,32,0,2,223,140,205,33,0,2,223,141,223,142,0,1,223,143,0,3,192,30,193,
+  109,223,144,1,2,195,156,42,1,2,0,20,0,4,192,30,0,193,30,195,16,3,1,194,
+  91,2,1,192,32,2,1,194,113,2,1,194,33,2,1,194,250,2,1,193,176,2,1,191,
+  2,1,193,227,2,1,194,24,2,1,194,5,2,1,194,25,2,1,56,2,1,192,3,2,
+  1,195,51,2,1,193,210,0,3,192,30,0,194,155,2,1,194,65,2,1,129,2,1,193,
+  19,2,1,193,57,2,1,193,158,2,1,194,158,2,1,58,2,1,90,2,1,193,250,2,
+  1,193,203,2,1,193,196,2,1,193,230,2,1,167,2,1,193,80,2,1,193,119,0,3,
+  192,30,0,193,231,2,1,193,31,2,1,152,2,1,173,2,1,193,71,2,1,193,72,2,
+  1,193,28,2,1,193,92,2,1,53,2,1,150,2,1,192,238,2,1,192,210,2,1,194,
+  41,2,1,194,181,2,1,154,2,1,194,39,0,3,192,30,0,194,86,2,1,193,179,2,
+  1,193,217,2,1,182,2,1,193,228,2,1,193,218,2,2,3,20,3,1,56,3,1,58,
+  3,1,90,3,1,193,250,3,1,53,3,1,193,190,3,1,46,3,1,192,109,3,1,193,
+  178,0,4,192,30,0,3,193,234,3,1,193,208,3,1,176,3,1,193,94,3,1,193,27,
+  2,1,193,180,2,1,193,235,2,1,180,2,1,193,54,2,1,194,22,2,1,66,2,1,
+  193,190,2,1,46,2,1,196,34,2,1,192,109,2,1,193,178,0,3,192,30,0,193,234,
+  2,1,193,208,2,1,176,2,1,193,94,2,1,193,27,2,1,192,221,2,1,193,229,2,
+  1,195,13,2,1,194,220,2,1,194,230,1,3,195,65,195,156,42,0,2,223,145,223,146,
+  0,1,223,147,0,1,204,155,0,4,205,34,198,181,43,192,150,4,3,192,158,55,43,0,
+  1,203,154,0,2,223,148,197,216,0,1,223,149,0,1,82,0,2,172,119,1,2,55,199,
+  129,2,1,202,180,1,1,195,236,1,2,192,124,195,231,1,4,195,60,2,71,1,1,3,
+  49,193,46,223,150,3,1,205,35,3,1,205,36,3,1,205,37,3,1,205,38,3,1,205,
+  39,0,4,172,49,193,46,205,40,1,2,198,182,223,151,2,1,223,152,2,1,223,153,2,
+  1,223,154,1,2,195,71,195,110,1,2,197,5,122,0,1,195,109,1,1,104,1,1,200,
+  178,0,1,223,155,0,2,197,156,202,169,1,1,196,158,1,1,202,165,1,1,223,156,0,
+  1,205,41,0,1,198,16,1,3,2,223,157,223,158,0,1,196,126,1,1,197,64,1,1,
+  205,42,1,2,2,223,159,0,2,223,160,1,0,2,205,43,104,0,3,134,223,161,11,0,
+  2,223,162,104,0,1,223,163,0,1,223,164,0,1,194,212,1,1,194,154,1,2,2,192,
+  96,0,1,198,138,0,2,205,44,193,162,0,1,223,165,0,2,223,166,11,0,5,58,200,
+  179,223,167,193,105,1,0,2,195,248,205,45,1,1,199,56,1,4,204,152,195,243,24,223,
+  168,1,1,205,46,0,2,198,183,66,2,3,24,193,151,195,61,1,3,2,59,38,0,2,
+  205,47,192,53,0,4,158,194,36,193,51,42,2,2,194,84,42,2,2,195,106,42,2,2,
+  78,42,0,4,158,194,36,197,209,42,2,2,198,114,42,2,2,223,169,42,2,2,193,233,
+  42,2,2,76,42,2,2,49,42,2,2,193,251,42,2,2,195,107,42,2,2,194,174,42,
+  2,2,65,42,2,2,192,240,42,2,2,54,42,1,2,197,157,42,1,1,192,168,1,3,
+  200,180,136,42,1,5,194,252,192,28,38,66,57,0,8,158,194,252,192,28,38,66,76,24,
+  57,3,2,192,209,196,81,3,5,39,66,76,24,37,5,1,37,3,1,199,238,3,3,196,
+  81,193,66,38,5,1,57,5,1,39,5,2,107,39,5,2,113,39,6,1,37,1,3,223,
+  170,136,42,1,2,192,209,192,104,1,3,110,194,46,193,242,1,2,195,156,42,1,3,205,
+  48,136,42,0,3,158,29,192,33,1,3,194,134,136,42,1,1,193,242,1,3,196,82,42,
+  85,3,1,78,3,1,49,3,1,65,3,1,54,1,5,192,130,192,124,200,181,193,171,11,
+  2,3,11,40,223,171,4,1,223,172,4,2,193,100,115,5,1,195,131,5,1,194,237,5,
+  1,195,10,5,1,85,0,6,158,192,130,11,40,193,100,78,5,1,195,218,5,1,133,5,
+  1,195,219,5,1,49,5,1,128,5,1,195,220,5,1,117,5,1,195,54,5,1,192,66,
+  5,1,195,221,5,1,193,117,5,1,223,173,5,1,65,5,1,194,124,5,1,192,224,0,
+  6,158,192,130,11,40,193,100,223,174,5,1,198,10,5,1,205,49,5,1,223,175,5,1,
+  205,50,5,1,223,176,5,1,223,177,5,1,205,51,5,1,200,182,5,1,54,4,1,223,
+  178,4,1,223,179,4,2,193,172,115,5,1,195,131,5,1,194,237,5,1,195,10,0,6,
+  158,192,130,11,40,193,172,85,5,1,78,5,1,195,218,5,1,133,5,1,195,219,5,1,
+  49,5,1,128,5,1,195,220,5,1,117,5,1,195,54,5,1,192,66,5,1,195,221,5,
+  1,65,5,1,194,124,5,1,192,224,5,1,205,49,0,6,158,192,130,11,40,193,172,205,
+  50,5,1,205,51,5,1,200,182,5,1,54,5,1,192,33,4,1,223,180,4,1,223,181,
+  4,1,223,182,4,1,223,183,4,1,203,29,4,1,223,184,4,1,223,185,4,1,223,186,
+  1,2,67,193,88,0,2,195,112,74,2,4,192,26,196,109,164,66,0,1,223,187,0,4,
+  193,110,193,111,0,194,68,3,1,194,235,3,1,194,69,3,1,195,58,3,1,194,95,3,
+  1,193,19,3,1,194,121,3,1,194,96,3,1,194,122,3,1,194,26,3,1,192,177,3,
+  1,192,238,3,1,195,240,3,1,194,192,3,1,194,103,0,4,193,110,193,111,0,194,97,
+  3,1,193,86,3,1,194,70,3,1,195,28,3,1,193,11,3,1,194,123,3,1,194,159,
+  2,2,29,49,4,1,134,4,1,169,3,1,192,66,4,1,169,3,1,65,3,1,192,224,
+  3,1,54,2,2,193,42,1,0,2,223,188,205,52,0,2,223,189,195,118,0,2,223,190,
+  196,165,0,4,200,173,204,0,204,1,11,0,2,223,191,194,151,0,1,223,192,0,5,106,
+  192,89,193,160,193,1,223,193,0,3,223,194,195,186,1,0,5,192,91,146,193,24,200,183,
+  42,2,3,192,14,49,110,4,1,193,49,3,2,65,194,135,2,2,200,183,42,2,3,29,
+  193,24,49,4,2,192,66,169,4,1,54,0,4,192,91,146,29,115,4,1,134,4,1,169,
+  3,1,194,110,4,1,169,3,1,193,68,4,1,169,3,1,85,4,1,134,4,1,169,3,
+  1,193,153,4,1,169,3,1,78,4,1,134,4,1,169,3,1,223,195,0,4,192,91,146,
+  29,223,196,3,1,200,183,3,1,223,197,3,1,133,4,1,134,4,1,169,3,1,193,41,
+  4,1,169,3,1,49,4,1,134,4,1,169,3,2,195,76,115,4,1,85,4,1,78,4,
+  1,133,4,1,49,0,5,192,91,146,29,195,76,128,4,1,117,4,1,65,4,1,54,3,
+  1,128,4,1,134,4,1,169,3,1,193,77,4,1,169,3,1,117,4,1,134,4,1,169,
+  3,1,194,61,4,1,169,3,1,192,66,4,1,169,0,4,192,91,146,29,193,117,4,1,
+  169,3,1,65,4,1,134,4,1,169,3,1,192,224,4,1,169,3,1,54,4,1,134,4,
+  1,169,2,1,200,184,2,2,195,186,42,0,1,196,165,1,4,205,53,2,83,119,0,3,
+  199,245,223,198,193,232,1,1,199,246,0,4,205,54,8,15,201,88,1,2,201,89,201,90,
+  0,6,197,158,11,40,7,5,200,185,4,1,200,185,4,2,3,200,185,3,1,223,199,3,
+  1,200,186,0,4,192,183,192,192,0,194,68,3,1,194,69,3,1,195,58,3,1,194,95,
+  3,1,193,19,3,1,194,121,3,1,194,96,3,1,194,122,3,1,205,55,0,4,192,183,
+  192,192,0,192,177,3,1,192,238,3,1,194,103,3,1,194,97,3,1,193,86,3,1,194,
+  70,3,1,195,28,3,1,205,56,3,1,194,123,3,1,194,159,2,2,29,78,3,1,49,
+  4,1,134,4,1,169,3,1,192,66,3,1,65,0,4,192,183,192,192,29,192,224,3,1,
+  54,1,3,193,126,0,194,68,3,1,194,235,3,1,194,69,3,1,195,58,3,1,194,95,
+  3,1,193,19,3,1,194,121,3,1,194,96,3,1,194,122,3,1,194,26,3,1,192,177,
+  3,1,192,238,3,1,195,240,3,1,194,192,0,4,192,183,193,126,0,194,103,3,1,194,
+  97,3,1,193,86,3,1,194,70,3,1,195,28,3,1,193,11,3,1,194,123,3,1,194,
+  159,2,2,29,78,3,1,49,4,1,134,4,1,169,3,1,192,66,3,1,65,3,1,192,
+  224,3,1,54,0,2,199,218,11,0,1,193,193,1,4,200,187,20,193,162,192,242,1,3,
+  223,200,2,194,87,1,1,195,231,1,3,2,51,71,2,1,194,48,2,4,108,27,2,82,
+  2,1,194,175,2,2,22,1,2,1,193,192,2,1,194,12,0,1,223,201,0,2,205,57,
+  194,194,0,3,200,188,194,36,202,21,2,1,193,171,0,3,200,188,194,36,223,202,0,5,
+  223,203,196,154,24,195,60,1,0,1,197,153,0,1,194,48,1,4,38,119,38,194,12,2,
+  1,194,12,1,5,195,27,24,197,159,2,194,48,1,2,2,59,2,2,193,133,24,2,1,
+  194,175,0,2,195,33,194,154,1,2,194,145,42,1,3,198,63,197,93,194,46,1,5,183,
+  27,2,193,255,108,1,2,185,194,130,1,2,63,120,0,3,192,143,193,170,42,1,1,197,
+  153,1,2,200,189,99,1,2,135,195,134,3,3,2,195,134,38,1,2,198,184,1,1,1,
+  198,185,1,2,193,127,42,1,1,205,58,0,2,200,190,97,1,1,193,171,1,1,22,0,
+  2,223,204,223,205,0,1,223,206,0,3,195,249,199,115,11,1,1,199,224,0,2,195,249,
+  205,59,1,1,223,207,1,3,223,208,205,60,11,1,1,223,209,1,2,200,115,200,116,1,
+  3,11,40,223,210,0,1,205,61,0,4,192,38,192,49,1,205,62,3,1,223,211,3,1,
+  223,212,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,0,3,192,
+  38,14,117,2,1,65,2,1,54,2,1,192,33,1,2,39,205,63,1,2,0,20,2,1,
+  192,74,2,1,192,32,3,1,194,217,2,1,192,107,3,1,194,217,2,1,191,3,1,195,
+  183,2,1,192,220,3,1,195,183,2,1,56,0,3,192,38,0,192,3,3,1,194,217,2,
+  1,129,2,1,58,3,1,223,213,2,1,192,80,2,1,192,102,3,1,195,183,2,1,90,
+  3,1,194,217,3,1,195,182,2,1,170,2,1,167,2,1,173,3,1,194,217,2,1,192,
+  95,0,4,192,38,0,192,95,205,64,4,1,223,214,2,1,192,145,3,1,194,217,2,1,
+  53,2,1,150,3,1,223,215,3,1,194,217,2,1,154,3,1,223,216,2,1,182,3,1,
+  195,183,3,1,194,217,2,1,180,3,1,194,217,2,1,192,214,0,4,192,38,0,192,214,
+  195,183,2,1,46,2,1,192,109,2,1,176,1,2,194,202,197,39,3,1,197,39,2,1,
+  223,217,2,1,223,218,2,1,223,219,2,1,223,220,2,1,223,221,2,1,223,222,2,1,
+  223,223,2,1,205,65,2,2,223,224,223,225,2,1,202,80,0,2,192,38,223,226,1,1,
+  223,227,1,2,37,205,63,1,2,1,205,66,3,1,223,228,2,1,223,229,2,1,223,230,
+  2,1,223,231,1,3,160,194,202,205,65,1,4,16,1,223,232,223,233,3,1,199,76,3,
+  1,197,236,4,1,223,234,3,1,197,41,3,1,223,235,3,1,223,236,0,4,192,38,16,
+  1,205,67,4,1,223,237,0,1,223,238,0,3,223,239,223,240,195,188,0,1,198,137,0,
+  1,223,241,0,1,223,242,0,1,223,243,0,1,223,244,0,1,223,245,0,3,192,137,194,
+  21,1,1,1,193,121,1,2,51,193,121,2,2,193,42,42,1,2,223,246,1,1,2,0,
+  20,0,3,192,137,0,192,45,2,1,192,74,2,1,192,98,2,1,192,32,2,1,193,2,
+  2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,204,6,2,1,193,25,2,
+  1,192,232,2,1,56,2,1,192,3,2,1,192,239,2,1,129,0,3,192,137,0,58,2,
+  1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,167,
+  2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,2,1,53,2,1,150,2,1,192,
+  195,2,1,154,0,3,192,137,0,195,122,2,1,182,2,1,192,101,2,1,193,33,2,1,
+  180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,2,1,192,194,
+  2,1,176,1,2,29,1,3,1,38,1,2,193,42,42,1,2,1,192,203,0,3,192,137,
+  1,193,82,2,1,193,191,2,1,193,20,2,1,193,47,1,3,16,1,192,45,3,1,192,
+  74,3,1,192,98,3,1,56,3,1,58,3,1,192,80,3,1,53,3,1,46,3,1,192,
+  103,3,2,123,98,0,1,223,247,0,3,79,47,223,248,0,3,79,47,24,2,1,223,249,
+  2,1,27,2,1,199,69,2,1,202,63,2,1,199,249,2,1,223,250,2,1,194,117,2,
+  1,198,7,2,1,223,251,2,1,55,2,1,204,28,2,1,195,189,2,1,205,68,2,1,
+  205,69,2,3,199,250,74,199,251,0,3,79,47,198,19,2,1,196,139,2,1,200,191,2,
+  1,223,252,2,1,196,155,2,1,203,128,2,1,205,27,2,1,223,253,2,1,199,235,2,
+  1,203,131,2,1,194,14,2,1,223,254,2,1,200,0,2,1,200,1,2,1,223,255,2,
+  1,224,0,0,3,79,47,224,1,2,1,199,114,2,1,197,97,2,1,203,132,2,1,200,
+  79,2,1,224,2,2,1,193,221,2,1,224,3,2,1,203,133,2,2,194,5,192,146,2,
+  1,196,158,2,1,204,20,2,1,59,2,2,193,14,200,0,3,1,199,248,2,2,51,192,
+  57,0,4,79,47,116,100,2,1,195,222,2,1,196,204,2,1,199,34,2,1,196,73,2,
+  1,194,84,2,1,196,156,2,1,115,2,1,224,4,2,1,200,192,2,1,204,100,2,1,
+  196,157,2,1,224,5,2,1,195,63,2,1,104,2,1,224,6,0,3,79,47,204,148,2,
+  1,198,130,2,1,204,151,2,1,224,7,2,1,195,1,2,1,195,62,2,1,205,70,2,
+  1,199,252,2,1,198,67,2,1,224,8,2,1,199,253,2,1,205,71,2,1,203,129,2,
+  1,200,2,2,1,194,155,3,1,224,9,0,3,79,47,197,212,2,1,224,10,2,1,198,
+  68,2,1,196,77,2,1,224,11,2,3,110,195,59,203,139,2,1,193,105,2,1,193,146,
+  2,1,193,118,2,1,224,12,2,2,224,13,200,192,2,1,82,2,1,193,83,2,1,195,
+  109,2,1,195,248,2,1,224,14,0,3,79,47,224,15,2,1,203,135,2,1,205,61,2,
+  1,196,159,2,1,224,16,2,1,197,98,2,1,193,238,2,1,199,255,2,1,224,17,2,
+  1,224,18,2,1,205,72,2,1,224,19,2,1,192,124,2,1,171,3,1,224,20,2,1,
+  193,233,0,3,79,47,198,70,2,1,205,73,2,1,224,21,2,1,224,22,2,1,193,128,
+  2,1,224,23,2,1,203,137,2,1,200,3,2,1,195,247,2,1,192,228,2,1,196,160,
+  2,1,195,32,2,1,192,146,2,1,36,2,1,49,2,1,224,24,0,4,79,47,177,100,
+  2,1,224,25,2,1,198,186,2,1,224,26,2,1,196,222,2,1,224,27,2,1,224,28,
+  2,1,196,53,2,1,200,5,2,1,198,61,2,1,194,34,2,1,196,170,2,3,37,177,
+  100,2,1,224,29,2,1,224,30,2,1,224,31,0,4,79,47,224,32,198,187,2,1,195,
+  45,2,1,203,49,2,1,224,33,2,1,157,2,1,200,6,2,1,195,107,2,1,196,29,
+  2,1,205,74,2,1,200,7,2,1,193,93,2,1,224,34,2,3,192,114,194,89,198,7,
+  3,1,200,11,2,1,224,35,2,1,199,254,0,3,79,47,224,36,2,1,194,87,2,1,
+  224,37,2,1,205,75,2,1,3,2,1,200,9,2,1,194,66,2,1,205,76,2,1,196,
+  52,2,1,197,218,2,1,199,141,2,1,224,38,2,1,43,2,1,224,39,2,1,205,77,
+  2,1,200,193,0,3,79,47,200,72,2,1,192,104,2,1,224,40,2,1,194,94,2,1,
+  205,78,2,1,200,10,2,1,196,200,2,2,203,130,199,255,2,1,192,66,2,1,198,73,
+  2,1,125,2,1,194,79,2,1,198,66,2,1,205,79,2,1,195,59,2,1,224,41,0,
+  3,79,47,205,80,2,1,197,96,2,1,54,3,1,195,133,2,1,224,42,2,1,224,43,
+  2,1,224,44,2,1,197,100,3,1,200,192,2,1,194,146,2,1,224,45,2,1,192,196,
+  2,1,200,8,2,1,63,2,1,195,20,2,1,198,187,0,3,79,47,195,250,2,1,200,
+  176,2,1,224,46,2,1,224,47,2,1,197,101,0,4,192,43,192,74,194,116,42,1,2,
+  14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,
+  1,54,2,1,192,33,0,3,192,43,194,116,42,1,2,0,20,2,1,192,45,2,1,192,
+  74,2,1,192,98,2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,
+  2,1,192,220,2,1,193,25,2,1,192,232,2,1,56,2,1,193,13,2,1,193,18,0,
+  3,192,43,0,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,2,1,192,102,
+  2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,193,154,2,1,167,2,1,173,
+  2,2,205,81,205,82,2,1,192,95,2,1,192,251,0,3,192,43,0,192,145,2,1,53,
+  2,1,192,233,2,1,150,2,1,192,195,2,1,154,2,1,194,6,2,1,182,2,1,192,
+  101,2,1,193,33,2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,
+  1,192,103,0,3,192,43,0,192,194,2,2,123,112,3,1,193,73,3,1,98,3,1,193,
+  34,2,1,176,1,2,1,192,203,2,1,194,92,2,1,193,82,2,1,196,142,2,1,193,
+  191,2,1,192,16,2,2,200,85,193,82,2,1,196,143,2,1,193,20,2,1,193,47,0,
+  4,192,43,16,1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,193,13,3,1,
+  58,3,1,192,80,3,1,53,3,1,192,233,3,1,46,3,1,192,103,3,2,123,112,4,
+  1,193,73,4,1,98,4,1,193,34,0,3,72,193,109,203,117,0,3,72,195,156,42,1,
+  2,0,20,2,2,193,30,56,3,1,195,16,3,1,194,91,3,1,9,2,1,192,32,2,
+  1,194,113,2,1,194,33,2,1,194,250,2,1,193,176,2,1,191,2,1,193,227,2,1,
+  194,24,2,1,194,5,2,1,194,25,0,3,72,0,56,2,1,192,3,2,1,195,51,2,
+  1,193,210,2,1,194,155,2,1,194,65,2,1,129,2,1,193,19,2,1,193,57,2,1,
+  193,158,2,1,194,158,2,1,58,2,1,90,2,1,193,250,2,1,193,203,2,1,193,196,
+  0,3,72,0,193,230,2,1,167,2,1,193,80,2,1,193,119,2,3,194,203,196,83,197,
+  160,4,1,195,85,4,1,195,157,4,1,196,84,4,1,195,86,4,1,200,194,4,1,198,
+  188,3,1,195,85,3,1,195,157,3,1,196,84,3,1,195,86,3,1,200,194,0,4,72,
+  0,194,203,198,188,2,1,193,231,2,1,193,31,2,1,152,2,1,173,2,1,193,71,2,
+  1,193,72,2,1,193,28,2,1,193,92,2,1,53,2,1,150,2,1,192,238,2,1,192,
+  210,2,1,194,41,2,1,194,181,2,1,154,0,3,72,0,194,39,2,1,194,86,2,1,
+  193,179,2,1,193,217,2,1,182,2,1,193,228,2,1,193,218,2,2,3,20,3,1,56,
+  3,1,129,3,1,193,19,3,1,193,57,3,1,193,158,3,1,194,158,3,1,58,3,1,
+  90,0,4,72,0,3,193,250,3,1,193,230,3,1,193,31,3,1,152,3,1,193,92,3,
+  1,53,3,1,154,3,1,194,39,3,1,194,86,3,1,193,179,3,1,193,217,3,1,193,
+  218,3,1,193,235,3,1,66,3,1,193,190,3,1,46,0,4,72,0,3,192,109,3,1,
+  193,178,3,1,193,234,3,1,193,208,3,1,176,3,1,193,94,3,1,193,27,2,1,193,
+  180,2,1,193,235,2,1,180,2,1,193,54,2,1,194,22,2,1,66,2,1,193,190,2,
+  1,46,2,1,192,194,0,3,72,0,194,63,2,1,195,108,2,1,195,50,2,1,196,34,
+  2,1,192,109,2,1,193,178,2,1,193,234,2,1,193,208,2,1,176,2,1,193,94,2,
+  1,193,27,2,1,192,221,2,1,193,229,2,1,195,13,2,1,194,220,2,1,194,230,0,
+  3,72,76,59,1,3,195,65,195,156,42,0,3,196,57,51,194,212,1,3,204,203,194,66,
+  42,1,3,200,41,194,66,42,1,3,195,65,194,66,42,0,4,192,217,192,149,14,115,3,
+  1,85,3,1,78,3,1,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,
+  1,192,33,0,4,192,217,192,149,0,20,3,1,192,32,3,1,192,107,3,1,191,3,1,
+  192,3,3,1,129,3,1,205,83,3,1,58,3,1,90,3,1,192,144,3,1,170,3,1,
+  167,3,1,173,3,1,192,95,3,1,192,145,3,1,193,4,0,4,192,217,192,149,0,192,
+  233,3,1,150,3,1,192,195,3,1,154,3,1,182,3,1,192,101,3,1,180,3,1,192,
+  167,3,1,192,194,3,1,192,109,3,1,176,3,1,192,221,2,2,1,199,187,3,1,224,
+  48,2,2,136,205,84,4,1,205,85,0,4,192,217,192,149,136,205,85,2,2,16,56,3,
+  1,193,13,3,1,53,3,1,46,3,1,193,219,0,2,224,49,1,0,1,195,110,0,1,
+  197,161,1,2,24,196,85,0,2,203,149,192,66,0,3,192,138,14,78,2,1,49,2,1,
+  65,2,1,54,1,3,192,14,49,110,0,3,192,138,0,20,2,1,192,32,2,1,193,2,
+  2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,232,2,
+  1,192,3,2,1,192,239,2,1,129,2,1,192,102,2,1,90,2,1,192,144,2,1,199,
+  173,0,3,192,138,0,170,2,1,167,2,1,173,2,1,192,251,2,1,192,145,2,1,150,
+  2,1,192,195,2,1,154,2,1,182,2,1,192,101,2,1,193,33,2,1,180,2,1,192,
+  167,2,1,192,214,2,1,193,12,2,1,205,86,0,3,192,138,0,224,50,2,1,192,194,
+  2,1,224,51,2,1,176,2,1,192,221,1,3,29,49,134,3,1,169,2,1,192,66,2,
+  1,192,224,1,2,192,4,120,2,2,196,141,119,2,1,193,121,2,1,59,2,2,51,193,
+  121,2,1,200,195,2,1,198,21,0,3,192,138,192,4,224,52,2,2,3,120,1,2,1,
+  192,203,2,2,119,38,2,1,224,53,2,2,59,57,2,3,51,159,57,2,1,193,47,1,
+  1,193,20,1,3,16,194,116,42,2,2,1,56,3,1,58,3,1,53,3,1,46,3,2,
+  123,98,0,4,224,54,3,157,195,146,0,4,124,195,53,11,224,55,1,2,14,115,2,1,
+  85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,
+  192,33,1,3,193,214,16,200,196,3,1,224,56,3,1,199,207,3,1,203,43,3,1,224,
+  57,0,4,124,193,214,16,224,58,3,1,198,123,3,1,197,83,3,1,203,44,3,3,199,
+  208,198,189,49,5,1,54,3,1,197,139,3,1,224,59,3,1,199,233,3,1,224,60,3,
+  1,205,87,3,1,224,61,1,2,0,192,32,2,1,192,107,2,1,192,142,2,1,195,15,
+  0,3,124,0,194,211,2,1,191,2,1,194,5,2,1,129,2,1,90,2,1,192,144,2,
+  1,194,229,2,1,193,196,2,1,170,2,1,194,10,2,1,193,231,2,1,196,48,2,1,
+  224,62,2,1,193,28,2,1,195,154,2,1,192,195,0,3,124,0,195,29,2,1,194,41,
+  2,1,194,11,2,1,193,179,2,1,182,2,1,192,101,2,1,200,109,2,1,180,2,1,
+  192,167,2,1,193,253,2,1,66,2,1,193,12,2,1,198,57,2,1,195,50,2,1,193,
+  94,1,2,1,224,63,0,3,124,1,224,64,2,1,224,65,2,1,224,66,2,1,224,67,
+  2,1,224,68,2,1,224,69,2,3,224,70,197,80,224,71,2,1,224,72,2,1,224,73,
+  2,1,224,74,2,1,224,75,2,2,195,34,196,128,2,1,224,76,2,1,224,77,2,2,
+  224,78,205,88,2,1,224,79,0,3,124,1,224,80,2,2,224,81,224,82,2,1,224,83,
+  2,1,224,84,2,1,224,85,2,1,224,86,1,3,11,200,197,194,137,3,1,194,138,2,
+  2,200,198,194,137,3,1,194,138,2,2,200,199,194,137,3,1,194,138,2,2,205,89,194,
+  137,3,1,194,138,2,2,205,90,194,137,3,1,194,138,0,4,124,11,205,91,194,137,3,
+  1,194,138,2,2,205,92,194,137,3,1,194,138,2,2,205,93,194,137,3,1,194,138,2,
+  3,195,34,195,87,200,197,4,1,200,198,4,1,200,200,4,1,197,80,4,1,200,201,4,
+  1,200,202,4,1,200,203,4,1,200,204,4,1,200,205,4,1,224,87,0,4,124,11,200,
+  200,194,137,3,1,194,138,2,1,224,88,2,2,197,80,194,137,3,1,194,138,2,2,200,
+  201,194,137,3,1,194,138,2,2,200,202,194,137,3,1,194,138,2,2,200,203,194,137,3,
+  1,194,138,2,2,200,204,194,137,3,1,194,138,2,2,200,205,194,137,3,1,194,138,2,
+  1,224,89,0,4,124,16,205,94,192,45,3,1,197,162,2,2,1,192,45,3,1,193,85,
+  3,1,192,74,3,1,192,98,3,1,56,3,1,58,3,1,194,71,3,1,192,80,3,1,
+  193,4,3,1,192,233,3,1,46,3,1,196,175,3,1,192,103,3,1,192,35,0,4,124,
+  16,1,176,3,1,200,206,0,3,192,163,194,21,1,1,1,193,121,1,2,51,193,121,2,
+  2,193,42,42,1,2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,
+  2,1,196,50,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,0,3,192,163,0,
+  192,220,2,1,198,112,2,1,193,25,2,1,192,232,2,1,56,2,1,192,3,2,1,196,
+  203,2,1,192,239,2,1,129,2,1,58,2,1,192,102,2,1,197,72,2,1,90,2,1,
+  192,144,2,1,170,2,1,193,154,0,3,192,163,0,167,2,1,173,2,1,192,95,2,1,
+  192,251,2,1,192,145,2,1,53,2,1,150,2,1,192,195,2,1,154,2,1,182,2,1,
+  180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,194,0,3,192,163,
+  0,176,1,2,193,42,42,1,2,1,192,203,2,1,193,191,2,1,194,152,2,1,195,180,
+  2,1,193,20,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,58,
+  3,1,192,80,3,1,53,3,1,46,1,2,193,215,193,171,0,3,192,131,14,115,2,1,
+  85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,
+  192,33,1,2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,2,1,
+  196,50,0,3,192,131,0,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,
+  2,1,198,112,2,1,193,25,2,1,192,232,2,1,56,2,1,192,3,2,1,196,203,2,
+  1,192,239,2,1,129,2,1,58,2,1,192,80,2,1,192,102,0,3,192,131,0,193,60,
+  2,1,197,72,2,1,90,2,1,192,144,2,1,170,2,1,167,2,1,173,2,1,192,95,
+  2,1,192,251,2,1,192,145,2,1,53,2,1,150,2,1,192,195,2,1,154,2,1,194,
+  6,2,1,182,0,3,192,131,0,192,101,2,1,180,2,1,192,167,2,1,192,214,2,1,
+  193,12,2,1,46,2,1,192,103,2,1,192,194,2,1,176,1,2,1,192,203,2,1,193,
+  191,2,1,193,20,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,1,56,0,4,
+  192,131,16,1,58,3,1,192,80,3,1,53,3,1,46,3,1,192,103,0,1,224,90,0,
+  2,205,95,1,0,1,196,210,1,1,42,0,6,198,190,194,191,104,2,193,3,193,184,1,
+  1,104,2,3,2,193,3,193,184,3,2,193,207,193,184,0,1,224,91,0,1,224,92,0,
+  2,224,93,193,232,0,1,224,94,0,1,224,95,0,3,197,95,205,60,11,0,1,224,96,
+  0,4,112,62,119,11,0,2,224,97,203,145,0,1,224,98,0,4,224,99,195,243,24,194,
+  218,0,1,224,100,0,2,224,101,202,164,0,2,224,102,190,0,3,192,71,198,4,42,1,
+  2,14,115,2,1,85,2,1,78,2,1,133,0,3,192,71,14,49,2,1,128,2,1,117,
+  2,1,65,2,1,54,2,1,192,33,1,1,195,236,1,2,193,158,193,231,2,1,193,28,
+  1,2,193,196,170,1,2,0,194,250,2,1,194,211,2,1,194,5,2,2,195,18,196,224,
+  3,1,196,31,2,2,193,158,196,224,0,4,192,71,0,193,158,196,31,2,2,205,96,194,
+  155,3,1,195,154,2,2,194,229,196,224,3,1,196,31,2,1,193,196,2,2,194,10,205,
+  97,3,1,202,138,2,1,193,231,2,1,196,48,2,1,193,28,2,1,195,154,2,1,53,
+  2,2,194,204,193,2,3,1,192,142,3,1,192,220,0,4,192,71,0,194,204,193,25,3,
+  1,192,232,3,1,192,239,3,1,193,60,3,1,193,154,3,1,192,251,3,1,192,145,3,
+  1,192,214,3,1,193,12,2,2,195,29,196,224,3,1,196,31,2,1,194,41,2,2,205,
+  98,192,101,3,1,193,33,2,2,193,180,196,224,3,1,196,31,0,4,192,71,0,193,253,
+  196,224,3,1,196,31,2,1,66,2,1,193,208,2,1,193,94,1,1,224,103,1,3,205,
+  99,1,194,10,3,1,195,154,1,3,1,194,204,193,20,1,3,136,193,243,224,104,3,1,
+  196,219,3,1,193,253,3,1,194,22,1,3,16,1,20,3,1,192,45,3,1,192,74,0,
+  4,192,71,16,1,195,44,3,1,194,228,3,1,56,3,1,195,127,3,1,58,3,1,192,
+  80,3,2,193,243,196,213,4,1,205,100,3,1,53,3,1,46,3,1,192,103,3,1,192,
+  35,3,1,200,206,0,3,192,34,195,189,120,2,1,192,241,2,1,43,0,3,192,34,199,
+  142,120,2,1,43,1,1,120,1,2,116,193,69,1,2,195,245,120,2,1,43,1,3,39,
+  174,192,242,1,6,49,59,145,54,140,192,4,2,5,159,145,54,205,101,192,4,1,2,196,
+  225,120,2,1,192,241,2,1,43,1,2,200,207,120,2,1,43,1,2,194,34,120,2,1,
+  43,0,5,192,34,192,174,83,119,192,242,1,6,54,140,145,49,59,192,4,2,5,205,101,
+  145,49,159,192,4,1,2,96,193,69,1,2,197,101,120,2,1,43,0,2,205,102,196,131,
+  2,3,192,26,164,66,0,2,224,105,1,0,3,200,208,193,49,193,128,3,1,11,3,2,
+  2,104,0,4,7,5,0,20,4,2,2,192,31,5,1,192,182,6,2,24,192,31,0,9,
+  7,5,0,20,2,192,182,24,59,57,7,1,192,127,7,2,82,38,7,1,184,5,1,192,
+  254,5,1,192,75,6,2,24,192,31,7,2,59,57,7,1,192,127,7,2,82,38,7,1,
+  184,5,1,192,96,6,2,24,192,136,5,2,59,38,7,2,24,192,136,6,1,57,0,7,
+  7,5,0,20,2,51,192,127,5,1,192,127,5,2,82,38,5,2,192,143,192,182,5,1,
+  192,136,5,1,194,125,5,2,159,38,7,2,24,192,31,6,1,57,5,1,71,5,1,184,
+  3,1,192,45,3,1,193,85,4,2,2,192,31,5,1,192,136,3,2,197,12,192,20,0,
+  4,7,5,0,192,112,3,2,205,103,192,77,3,1,197,230,3,1,192,98,3,1,196,167,
+  4,3,2,172,119,3,1,194,228,3,1,62,4,3,2,59,38,6,1,57,5,1,197,163,
+  5,1,82,5,2,192,124,57,5,1,71,5,1,198,191,3,1,194,28,0,5,7,5,0,
+  196,145,112,3,1,192,52,4,2,2,192,31,5,1,119,5,1,192,254,5,1,193,129,6,
+  2,24,192,31,5,1,192,75,5,2,59,38,5,1,82,5,2,193,135,82,5,1,71,3,
+  1,193,169,3,3,193,3,194,13,192,2,3,1,205,104,3,1,198,192,0,6,7,5,0,
+  198,192,2,192,168,3,1,192,20,4,2,2,192,254,5,1,193,129,5,2,192,75,57,5,
+  2,59,38,6,1,57,5,1,82,5,2,192,124,57,5,3,192,114,71,193,220,5,3,3,
+  0,192,27,8,2,2,192,254,5,1,71,5,1,198,191,3,1,195,88,4,2,2,192,254,
+  0,4,7,5,0,56,4,2,2,192,31,5,1,192,182,5,1,192,254,5,1,193,129,6,
+  2,24,192,182,5,1,192,75,6,2,24,192,31,7,2,59,57,7,1,192,127,7,2,82,
+  38,7,1,184,6,1,57,5,1,192,96,5,2,59,38,6,1,57,0,7,7,5,0,56,
+  2,51,192,127,5,1,192,127,5,2,82,38,5,2,192,143,192,182,5,1,192,136,6,2,
+  24,192,31,7,1,192,127,5,1,194,125,5,1,71,5,1,184,6,1,57,3,2,198,193,
+  192,252,4,1,118,3,1,194,227,3,1,194,29,3,1,194,177,0,4,7,5,0,195,223,
+  3,1,194,253,4,1,192,56,4,2,2,192,254,3,1,192,113,4,3,2,59,38,5,1,
+  82,5,1,71,3,1,192,2,4,2,2,192,31,5,1,192,182,5,1,192,254,5,1,193,
+  129,5,1,192,75,5,2,59,38,5,1,82,0,6,7,5,0,192,2,2,192,136,5,2,
+  194,77,71,5,1,71,3,1,193,239,3,2,193,74,20,4,1,58,4,1,192,104,4,1,
+  46,3,1,192,18,4,3,2,192,182,57,5,1,192,254,5,1,193,129,5,1,192,75,5,
+  1,193,35,5,1,192,96,5,2,59,38,0,7,7,5,0,192,18,2,59,57,5,1,82,
+  5,1,71,3,2,110,192,18,3,1,197,164,3,1,204,174,3,1,58,4,2,2,192,31,
+  5,1,192,182,5,1,192,254,5,1,192,75,5,1,192,96,6,2,24,192,31,5,2,59,
+  38,6,1,57,5,2,51,192,127,0,6,7,5,0,58,2,192,127,5,2,82,38,5,2,
+  192,143,192,182,5,1,192,136,5,1,194,125,5,1,71,5,1,184,6,1,57,3,2,194,
+  13,192,20,4,1,192,113,4,1,192,2,4,1,98,4,1,99,4,1,192,5,3,1,192,
+  199,3,1,196,166,0,4,7,5,0,192,83,4,2,2,192,75,5,1,195,158,5,1,71,
+  3,1,192,6,4,2,2,192,31,5,1,192,254,5,1,193,129,5,1,193,35,5,2,189,
+  71,5,2,59,57,5,1,82,5,2,192,124,57,5,2,194,77,71,5,1,71,6,3,24,
+  189,71,0,4,7,5,0,112,4,2,2,192,31,5,1,119,5,1,195,35,5,1,192,254,
+  5,1,193,129,5,2,192,75,57,5,2,59,57,7,2,24,192,136,5,2,51,119,5,2,
+  139,71,5,2,192,124,57,5,2,76,59,6,1,184,5,3,3,0,192,83,5,1,71,0,
+  4,7,5,0,205,105,3,1,178,4,2,2,192,31,5,2,59,38,6,1,57,5,1,82,
+  3,3,76,205,106,99,3,2,198,194,193,73,4,1,192,9,3,1,152,4,2,2,192,31,
+  5,1,192,254,5,1,193,129,5,2,192,75,57,5,1,193,35,5,2,59,38,0,7,7,
+  5,0,152,2,59,57,5,1,192,127,5,2,39,82,5,2,192,124,57,5,3,171,37,194,
+  15,5,2,194,77,71,5,3,3,0,192,83,5,1,184,3,1,205,107,3,1,53,4,2,
+  2,192,31,5,1,192,182,5,1,192,254,5,1,192,75,6,2,24,192,31,7,2,59,57,
+  0,8,7,5,0,53,2,192,75,24,192,127,7,2,82,38,7,1,184,5,1,192,96,6,
+  2,24,192,136,5,2,59,38,7,2,24,192,136,6,1,57,5,2,51,192,31,6,1,192,
+  127,5,1,192,127,5,2,82,38,5,1,193,83,6,2,24,192,31,7,2,59,57,7,1,
+  192,127,0,9,7,5,0,53,2,193,83,24,82,38,7,1,184,5,2,192,143,192,182,5,
+  3,171,71,193,220,5,1,193,156,5,1,192,136,6,2,24,192,31,7,1,192,127,5,2,
+  76,184,5,1,194,125,6,2,24,192,136,5,1,71,6,2,24,192,31,5,1,184,6,2,
+  24,192,31,7,1,192,96,0,8,7,5,0,53,2,184,24,192,136,3,1,197,92,3,3,
+  36,200,209,53,3,1,192,108,3,1,192,233,3,2,177,56,4,1,53,3,1,195,191,3,
+  1,192,58,4,2,2,192,31,5,2,59,38,5,1,197,163,5,1,82,5,2,205,108,192,
+  169,5,1,71,6,2,194,136,193,35,0,4,7,5,0,192,175,4,3,2,189,71,5,3,
+  71,194,136,193,35,3,1,98,4,1,197,109,4,2,2,192,31,5,1,192,254,5,1,193,
+  129,5,2,59,38,6,1,57,7,2,24,192,136,5,2,51,192,127,5,2,192,143,192,182,
+  5,2,192,124,57,5,2,194,77,71,5,1,71,0,6,7,5,0,98,2,192,169,3,4,
+  192,56,192,52,2,59,4,1,56,4,2,110,192,18,4,2,177,56,3,2,198,195,197,109,
+  3,1,99,4,2,2,192,31,6,3,24,59,38,5,1,192,254,6,3,24,59,38,5,1,
+  193,129,5,1,192,75,5,2,192,168,57,5,2,59,38,6,1,57,0,10,7,5,0,99,
+  2,59,57,24,59,38,5,1,82,5,2,194,77,71,5,3,192,114,71,193,220,5,2,196,
+  110,192,169,3,1,205,109,3,1,195,23,3,2,157,192,2,3,2,196,86,99,3,2,205,
+  110,99,3,3,3,5,58,4,4,192,175,2,82,192,169,3,1,192,5,4,2,2,192,254,
+  5,1,193,129,5,2,192,75,57,0,7,7,5,0,192,5,2,192,168,57,5,2,189,71,
+  5,2,59,38,6,1,57,5,1,82,5,2,192,124,57,5,2,193,15,82,5,1,71,3,
+  1,195,251,4,2,2,71,6,2,194,136,193,35,3,2,136,85,4,1,117,4,1,54,3,
+  1,205,111,3,2,160,20,0,5,7,5,0,160,192,112,4,1,192,18,4,2,194,13,192,
+  2,4,1,192,6,4,1,112,4,1,178,4,1,192,5,4,1,192,9,3,1,205,112,3,
+  1,46,4,1,119,4,2,2,192,31,5,1,192,182,5,1,192,254,5,1,192,75,6,1,
+  57,0,6,7,5,0,46,2,192,96,6,2,24,192,31,7,1,192,254,7,1,192,127,7,
+  1,192,136,6,1,57,5,2,59,57,5,2,51,192,31,6,1,192,127,5,1,192,127,5,
+  2,82,38,5,1,193,83,6,2,24,192,31,7,2,59,57,7,1,192,127,7,2,82,38,
+  0,8,7,5,0,46,2,193,83,24,184,5,2,192,143,192,182,5,1,192,136,6,2,24,
+  192,96,5,1,194,125,5,2,159,38,5,1,71,5,1,184,6,2,24,192,31,6,1,57,
+  3,1,192,235,3,1,192,9,4,3,2,189,71,5,2,59,57,5,1,82,5,1,184,0,
+  4,7,5,0,205,113,3,2,205,114,192,27,3,2,196,226,193,85,4,1,193,4,4,1,
+  193,219,3,1,200,210,3,1,192,77,4,2,2,192,31,5,1,192,75,5,1,192,96,5,
+  2,59,38,6,1,57,5,1,192,127,5,1,82,3,1,198,196,3,1,192,57,0,6,7,
+  5,0,192,57,2,192,96,5,2,59,38,3,1,192,35,4,2,2,192,31,5,1,192,75,
+  5,1,192,96,5,2,59,38,6,1,57,5,1,192,127,5,1,82,6,1,38,5,1,193,
+  156,5,1,192,136,5,1,71,5,1,184,3,1,205,115,0,4,7,5,0,192,27,4,2,
+  2,192,31,5,1,192,254,5,1,192,75,5,1,193,35,5,2,59,38,6,1,57,5,1,
+  82,5,2,192,124,57,5,2,193,135,82,5,1,71,5,2,196,110,192,169,2,2,32,205,
+  116,3,1,193,4,1,1,192,211,1,4,196,227,0,193,30,178,0,5,7,196,227,0,58,
+  198,197,3,2,192,143,178,3,2,192,56,192,113,4,1,192,58,3,2,194,20,58,1,2,
+  0,192,252,2,2,205,117,195,36,2,2,224,106,205,118,2,2,200,211,195,36,3,1,205,
+  118,2,2,199,170,195,36,2,2,193,74,192,104,4,2,2,71,2,3,192,143,193,74,192,
+  104,5,2,2,193,244,6,1,71,0,4,7,0,205,119,195,36,2,3,195,241,195,65,224,
+  107,2,2,193,15,195,36,4,3,2,193,15,82,2,3,192,56,194,29,193,156,3,4,193,
+  74,192,104,2,71,2,2,224,108,59,2,3,3,5,20,4,1,193,85,4,1,62,4,2,
+  195,74,62,4,1,192,52,4,1,192,20,4,1,56,4,1,195,223,4,1,194,253,0,5,
+  7,0,3,5,192,113,4,1,192,2,5,2,2,82,4,1,192,18,4,1,58,4,2,192,
+  143,98,4,1,192,83,4,1,192,6,4,1,112,5,2,2,195,35,6,1,71,4,1,178,
+  4,1,152,4,1,53,4,1,193,4,4,2,177,53,0,5,7,0,3,5,195,191,4,1,
+  192,58,4,1,192,175,4,1,98,5,3,2,37,194,15,4,2,192,56,152,5,1,98,4,
+  1,198,195,4,1,99,4,1,192,5,4,2,160,56,5,1,192,2,5,1,192,6,5,1,
+  178,5,1,98,4,1,46,0,5,7,0,3,5,192,9,4,1,192,77,4,1,192,35,4,
+  1,192,27,2,2,193,195,192,52,4,2,2,193,244,2,3,54,2,71,2,3,195,65,224,
+  109,224,110,2,1,198,196,2,1,205,120,1,6,3,5,0,58,2,71,4,3,46,2,71,
+  2,2,0,20,4,1,224,111,4,2,2,192,31,5,1,192,182,0,8,7,3,0,20,2,
+  192,182,24,192,31,7,2,59,57,7,1,192,127,7,2,82,38,7,1,184,5,1,192,254,
+  5,1,192,75,6,2,24,192,31,7,2,59,57,7,1,192,127,7,2,82,38,7,1,184,
+  5,1,192,96,6,2,24,192,136,5,2,59,38,7,2,24,192,136,0,7,7,3,0,20,
+  2,59,57,5,2,51,192,127,5,1,192,127,5,2,82,38,5,2,192,143,192,182,5,1,
+  192,136,5,1,194,125,5,2,193,15,82,5,3,37,110,159,5,2,159,38,7,2,24,192,
+  31,6,1,57,5,1,71,5,1,184,3,1,192,45,3,1,193,85,0,6,7,3,0,193,
+  85,2,192,31,5,1,192,136,3,1,192,112,4,3,2,193,15,82,3,2,205,103,192,77,
+  3,1,197,230,3,1,192,98,3,1,196,167,4,3,2,172,119,3,1,194,228,3,1,62,
+  4,3,2,59,38,6,1,57,5,1,197,163,5,1,82,5,2,192,124,57,0,7,7,3,
+  0,62,2,76,184,5,2,193,135,82,5,1,71,5,1,198,191,3,2,195,74,192,112,4,
+  1,56,4,1,53,3,2,202,26,194,29,3,1,194,28,3,2,200,212,56,4,1,53,5,
+  2,2,71,3,3,193,51,110,53,3,2,196,145,112,3,1,192,52,4,2,2,192,31,0,
+  6,7,3,0,192,52,2,119,5,1,192,254,5,1,193,129,6,2,24,192,31,5,1,192,
+  75,5,1,193,244,5,2,59,38,5,1,82,5,2,193,135,82,5,2,193,15,82,5,1,
+  71,3,1,193,169,4,4,2,135,39,205,121,6,2,37,159,3,3,193,3,194,13,192,2,
+  4,1,192,108,0,6,7,3,0,193,3,177,56,4,3,192,56,177,56,3,1,205,104,3,
+  1,198,192,4,2,2,192,168,3,1,192,20,4,2,2,192,254,5,1,193,129,5,2,192,
+  75,57,5,1,193,244,5,2,59,38,6,1,57,5,1,82,6,2,24,192,169,5,2,192,
+  124,57,5,2,76,184,0,7,7,3,0,192,20,2,193,135,82,5,3,192,114,71,193,220,
+  5,1,71,5,1,192,169,5,1,198,191,3,2,205,122,193,109,3,1,194,2,3,2,198,
+  198,193,109,5,3,2,193,135,82,6,2,193,15,82,3,2,193,249,58,4,1,192,83,5,
+  2,2,71,7,2,24,82,3,2,51,98,5,2,2,195,158,0,5,7,3,0,51,195,251,
+  4,1,198,196,3,1,224,112,3,1,195,88,4,1,193,109,5,2,2,193,244,6,2,193,
+  15,82,4,2,2,192,254,3,1,56,4,2,2,192,31,5,1,192,182,5,1,192,254,5,
+  1,193,129,6,2,24,192,182,5,1,192,75,6,2,24,192,31,0,9,7,3,0,56,2,
+  192,75,24,59,57,7,1,192,127,7,2,82,38,7,1,184,6,1,57,5,1,192,96,5,
+  2,59,38,6,1,57,5,2,51,192,127,5,1,197,163,5,1,192,127,5,2,82,38,5,
+  2,192,143,192,182,5,1,192,136,6,2,24,192,31,7,1,192,127,0,6,7,3,0,56,
+  2,203,111,5,1,194,125,5,2,193,15,82,5,1,71,5,1,184,6,1,57,3,2,198,
+  193,192,252,4,1,118,3,1,194,227,4,2,2,195,158,5,2,193,135,82,3,1,194,29,
+  4,2,2,193,244,5,2,51,119,7,2,24,193,244,5,2,193,135,82,0,7,7,3,0,
+  194,29,2,193,15,82,3,1,194,177,3,1,195,223,3,1,194,253,4,1,192,56,4,2,
+  2,192,254,5,1,193,244,5,2,193,135,82,5,2,193,15,82,5,1,192,169,3,1,192,
+  113,4,3,2,59,38,5,1,82,5,2,76,184,5,2,193,135,82,5,1,71,0,5,7,
+  3,0,200,213,193,109,5,2,2,224,113,3,1,192,2,4,2,2,192,31,5,1,192,182,
+  5,1,192,254,5,1,193,129,5,1,192,75,5,2,59,38,5,1,82,5,1,192,136,5,
+  2,194,77,71,5,2,193,135,82,5,1,71,3,1,193,239,3,2,193,74,20,0,5,7,
+  3,0,193,74,58,4,1,192,104,4,1,46,3,1,192,18,4,3,2,192,182,57,5,1,
+  192,254,5,1,193,129,5,1,192,75,5,1,193,35,5,1,192,96,5,2,59,38,6,1,
+  57,5,1,82,5,2,192,124,57,5,2,193,135,82,5,1,71,0,5,7,3,0,110,192,
+  18,3,1,197,164,4,2,2,82,3,1,198,64,3,1,58,4,2,2,192,31,5,1,192,
+  182,5,1,192,254,5,1,192,75,5,1,192,96,6,2,24,192,31,5,2,59,57,5,2,
+  51,192,127,5,1,192,127,5,2,82,38,5,2,192,143,192,182,0,6,7,3,0,58,2,
+  192,136,5,1,194,125,5,2,193,15,82,5,1,71,6,3,24,193,15,82,5,1,184,6,
+  1,57,3,2,194,13,192,20,4,1,192,113,4,1,192,2,4,1,98,4,1,99,4,1,
+  192,5,3,2,192,143,192,112,4,1,193,4,3,1,192,199,0,6,7,3,0,192,199,2,
+  71,3,2,194,99,56,3,1,196,166,3,1,192,83,4,2,2,192,254,5,1,192,75,5,
+  1,195,158,5,1,71,3,1,192,6,4,2,2,192,31,5,1,192,254,5,1,193,129,5,
+  1,193,35,5,2,189,71,5,2,59,57,5,1,82,0,7,7,3,0,192,6,2,192,124,
+  57,5,2,194,77,71,5,2,193,135,82,5,1,71,6,3,24,189,71,3,1,224,114,3,
+  1,112,4,2,2,192,31,5,1,119,5,1,195,35,6,3,24,193,135,82,5,1,192,254,
+  5,1,193,129,5,2,192,75,57,5,1,193,244,5,2,59,57,0,9,7,3,0,112,2,
+  59,57,24,192,136,5,2,51,119,6,2,76,184,5,1,195,252,5,2,139,71,5,3,192,
+  143,200,189,99,5,2,192,124,57,5,2,76,59,6,1,159,6,1,184,5,2,193,135,82,
+  5,2,193,15,82,7,2,24,195,35,5,1,71,3,3,224,115,2,71,3,2,203,178,192,
+  113,0,4,7,3,0,198,199,4,3,2,193,15,82,3,1,205,105,3,2,171,99,5,3,
+  2,189,71,6,2,59,38,6,2,139,71,3,2,205,123,193,109,3,1,194,219,3,2,205,
+  124,193,109,3,1,178,4,2,2,192,31,5,1,195,158,5,2,59,38,6,1,57,5,1,
+  82,0,7,7,3,0,178,2,76,184,5,2,193,135,82,3,3,76,205,106,99,3,2,198,
+  194,193,73,4,1,192,9,3,1,224,116,3,1,152,4,3,224,117,194,236,195,111,4,2,
+  2,192,31,5,1,192,254,5,1,193,129,5,2,192,75,57,5,1,195,158,5,1,193,244,
+  5,1,193,35,5,2,59,38,0,7,7,3,0,152,2,59,57,5,1,192,127,5,2,39,
+  82,5,2,192,124,57,5,3,171,37,194,15,5,2,76,184,5,2,194,77,71,5,2,193,
+  135,82,5,2,193,15,82,5,1,184,3,1,205,107,3,1,224,118,3,1,53,4,2,2,
+  192,31,5,1,192,182,5,1,192,254,0,6,7,3,0,53,2,192,75,6,2,24,192,31,
+  7,2,59,57,7,1,192,127,7,2,82,38,7,1,184,5,1,192,96,6,2,24,192,136,
+  5,2,59,38,7,2,24,192,136,6,1,57,5,2,51,192,31,6,1,192,127,5,1,192,
+  127,5,2,82,38,5,1,193,83,0,8,7,3,0,53,2,193,83,24,192,31,7,2,59,
+  57,7,1,192,127,7,2,82,38,7,1,184,5,2,192,143,192,182,5,3,171,71,193,220,
+  5,1,193,156,5,3,135,159,194,18,5,1,192,136,6,2,24,192,31,7,1,192,127,5,
+  1,194,125,6,2,24,192,136,5,2,193,15,82,5,1,71,0,8,7,3,0,53,2,71,
+  24,192,31,5,1,184,6,2,24,192,31,7,1,192,96,7,1,192,136,3,1,197,92,3,
+  3,36,200,209,53,3,1,192,108,3,1,192,233,3,2,177,56,5,3,2,193,15,82,4,
+  1,53,5,3,2,193,15,82,6,1,71,4,1,193,4,3,1,195,191,0,4,7,3,0,
+  192,58,4,2,2,192,31,5,2,59,38,5,1,197,163,5,1,82,5,2,76,184,5,2,
+  193,135,82,5,2,205,108,192,169,5,1,71,6,2,194,136,193,35,3,1,193,197,3,1,
+  192,175,4,3,2,189,71,5,1,82,6,1,192,169,5,3,71,194,136,193,35,0,5,7,
+  3,0,224,119,193,109,3,1,98,4,1,197,109,4,2,2,192,31,5,1,192,254,5,1,
+  193,129,5,1,195,158,5,2,59,38,6,1,57,7,2,24,192,136,5,2,51,192,127,5,
+  1,195,252,6,3,24,76,184,7,2,193,135,82,5,2,192,143,192,182,5,2,192,124,57,
+  0,7,7,3,0,98,2,171,194,15,5,2,76,184,5,2,194,77,71,5,2,193,135,82,
+  5,1,71,5,1,192,169,4,2,197,140,205,125,3,2,205,126,193,83,3,2,192,56,192,
+  52,5,2,2,59,4,1,56,4,1,194,227,4,2,110,192,18,4,1,192,6,4,2,177,
+  56,6,2,2,82,0,9,7,3,0,192,56,177,56,2,193,15,82,4,3,98,2,195,252,
+  4,2,157,192,2,3,1,198,195,4,1,197,109,3,1,99,4,2,2,192,31,6,3,24,
+  59,38,5,1,192,254,6,3,24,59,38,5,1,193,129,5,1,192,75,5,2,192,168,57,
+  5,1,193,244,5,2,59,38,6,1,57,0,10,7,3,0,99,2,59,57,24,59,38,5,
+  1,82,5,2,76,184,5,2,194,77,71,5,2,193,135,82,5,3,192,114,71,193,220,5,
+  2,196,110,192,169,3,2,224,120,195,135,3,1,205,109,3,1,195,23,4,2,2,82,5,
+  2,193,15,82,3,2,157,192,2,5,2,2,195,158,4,1,98,5,2,2,159,0,5,7,
+  3,0,196,86,99,3,3,194,20,224,121,46,4,1,53,5,2,2,71,4,2,177,53,4,
+  2,160,178,4,1,46,3,2,205,110,99,3,3,205,127,192,56,194,29,3,2,224,122,98,
+  3,1,192,5,4,2,2,192,254,5,1,193,129,5,2,192,75,57,5,2,192,168,57,5,
+  1,193,244,0,6,7,3,0,192,5,2,192,96,5,2,189,71,5,2,59,38,6,1,57,
+  5,1,82,6,3,24,193,15,82,5,2,192,124,57,5,2,76,184,5,2,193,135,82,5,
+  2,193,15,82,5,1,71,3,2,224,123,193,197,3,4,205,128,193,109,2,193,244,3,2,
+  198,200,193,109,5,3,2,193,135,82,6,2,193,15,82,0,6,7,3,0,195,199,2,224,
+  124,3,1,195,251,4,2,2,71,6,2,194,136,193,35,3,2,136,85,4,1,117,4,1,
+  54,3,3,192,240,110,53,3,1,205,111,3,2,198,201,193,109,5,3,2,193,15,82,3,
+  1,197,50,3,2,160,20,4,1,193,85,4,1,192,112,4,1,194,2,0,5,7,3,0,
+  160,56,4,1,192,2,4,1,192,18,5,2,2,195,252,7,2,24,192,169,4,1,58,4,
+  2,194,13,192,2,4,1,192,6,4,1,112,4,1,178,5,3,2,171,194,15,4,2,53,
+  205,129,6,2,2,71,4,1,193,4,5,3,2,172,71,6,1,71,0,6,7,3,0,160,
+  177,56,4,1,98,5,2,2,82,6,2,171,194,15,8,3,24,193,15,82,6,2,76,184,
+  6,2,193,135,82,6,1,192,169,4,1,192,5,5,2,2,193,244,4,1,198,119,4,1,
+  192,9,4,1,192,77,4,1,192,35,5,2,2,195,35,3,1,205,112,0,4,7,3,0,
+  46,4,1,119,5,4,2,192,114,37,194,15,4,2,2,192,31,5,1,192,182,5,1,192,
+  254,5,1,192,75,6,1,57,5,1,192,96,6,2,24,192,31,7,1,192,254,7,1,192,
+  127,7,1,192,136,6,1,57,5,2,59,57,5,2,51,192,31,0,7,7,3,0,46,2,
+  51,192,127,5,1,192,127,5,2,82,38,5,1,193,83,6,2,24,192,31,7,2,59,57,
+  7,1,192,127,7,2,82,38,7,1,184,5,2,192,143,192,182,5,2,39,82,5,1,192,
+  136,6,2,24,192,96,5,1,194,125,5,2,193,15,82,5,2,159,38,0,8,7,3,0,
+  46,2,192,114,37,194,15,5,1,71,5,1,184,6,2,24,192,31,6,1,57,3,1,193,
+  219,3,1,198,119,3,1,195,145,3,1,205,130,3,1,192,235,4,2,2,71,3,1,192,
+  9,4,2,2,193,244,5,2,189,71,5,2,59,57,5,1,82,0,7,7,3,0,192,9,
+  2,193,135,82,5,2,37,82,5,1,184,3,1,205,113,3,2,205,114,192,27,3,2,196,
+  226,193,85,4,1,193,4,4,1,193,219,3,1,200,210,3,1,192,77,4,2,2,192,31,
+  5,1,192,75,5,1,192,96,5,2,59,38,6,1,57,5,1,192,127,0,6,7,3,0,
+  192,77,2,82,5,2,159,38,3,1,192,57,4,2,2,192,96,5,2,59,38,5,3,171,
+  39,194,15,8,4,24,135,37,159,8,2,2,205,121,5,3,135,37,159,5,2,193,135,82,
+  3,1,192,35,4,2,2,192,31,5,1,192,75,5,1,192,96,5,2,59,38,6,1,57,
+  0,6,7,3,0,192,35,2,192,127,5,1,82,6,1,38,5,1,193,156,5,1,192,136,
+  5,2,159,38,5,3,192,114,37,194,15,5,1,71,5,1,184,3,1,205,115,3,1,192,
+  27,4,2,2,192,31,5,1,192,254,5,1,192,75,5,1,193,244,5,1,193,35,0,7,
+  7,3,0,192,27,2,59,38,6,1,57,5,1,82,5,2,192,124,57,5,2,76,184,5,
+  2,193,135,82,5,2,193,15,82,5,1,71,5,2,196,110,192,169,2,2,32,224,125,3,
+  1,224,126,3,1,224,127,3,1,195,17,3,1,224,128,3,1,205,116,3,3,171,99,192,
+  5,0,4,7,3,32,193,4,3,1,199,221,1,4,193,29,3,0,20,4,1,56,4,1,
+  192,18,4,1,58,4,1,192,83,4,1,192,6,4,1,112,4,1,178,4,1,152,4,1,
+  53,4,1,192,58,4,1,98,4,1,99,4,1,195,23,0,5,7,193,29,3,0,192,5,
+  4,1,46,4,1,192,9,4,1,192,57,0,4,193,238,205,131,192,158,195,20,0,2,224,
+  129,195,245,0,1,224,130,0,9,39,24,107,24,37,193,245,65,194,135,114,3,3,49,193,
+  46,114,2,3,37,51,195,235,3,1,193,69,3,3,193,245,110,114,2,7,113,24,37,193,
+  245,65,194,135,114,3,3,49,193,46,114,1,2,199,45,195,128,1,2,192,156,130,0,5,
+  39,192,156,130,2,59,1,3,194,4,192,173,130,1,4,27,2,45,97,3,2,3,120,1,
+  6,186,116,37,186,116,192,153,5,2,96,192,153,2,5,96,37,186,116,192,153,5,2,96,
+  192,153,1,3,55,195,253,130,2,3,193,177,193,93,130,1,1,194,80,1,2,193,3,200,
+  214,1,2,193,56,130,1,2,193,61,130,3,2,107,82,3,2,76,195,188,0,5,39,193,
+  61,130,113,82,1,3,193,14,196,228,130,1,3,51,192,156,130,2,1,192,247,2,2,193,
+  124,42,2,2,196,168,197,129,1,2,195,62,192,169,1,3,85,194,139,114,1,1,194,55,
+  1,3,110,55,120,3,1,192,171,2,1,114,2,1,120,3,2,2,59,4,2,78,140,4,
+  2,65,140,0,6,39,110,120,2,54,140,2,1,196,36,2,7,195,33,185,194,130,24,37,
+  110,114,2,2,185,194,130,2,2,200,215,193,233,1,3,193,105,194,225,198,202,1,3,135,
+  205,132,130,1,1,205,133,1,1,200,93,1,4,195,66,200,216,197,165,194,194,1,3,49,
+  193,46,114,2,2,193,49,114,1,2,200,128,198,137,1,1,192,247,2,1,195,231,2,2,
+  107,82,0,4,39,192,247,113,82,1,3,193,79,205,134,130,1,2,37,27,3,3,194,136,
+  3,120,3,4,2,51,83,71,4,1,71,4,2,83,71,2,2,55,27,2,2,51,27,4,
+  2,2,71,5,2,83,71,2,2,200,217,27,2,2,48,27,2,2,192,92,27,2,2,193,
+  87,27,2,2,63,27,0,4,39,205,135,198,203,198,204,1,2,197,165,194,194,1,3,128,
+  194,139,114,1,3,194,20,46,130,1,3,192,76,193,124,42,1,2,196,52,195,128,1,2,
+  43,130,3,1,195,231,3,2,107,193,56,3,2,113,193,56,3,3,2,51,71,4,1,198,
+  205,4,1,71,4,4,195,75,192,158,193,51,193,56,6,2,192,240,193,56,4,1,193,192,
+  0,3,39,196,228,130,1,1,193,69,1,5,194,174,63,37,192,89,106,1,2,200,218,195,
+  128,1,3,65,194,139,114,2,2,194,135,114,1,3,193,177,193,93,130,1,2,200,92,130,
+  1,4,174,195,27,83,119,1,4,193,245,49,193,49,114,1,4,83,119,2,198,205,2,2,
+  100,192,124,1,3,63,193,56,130,2,2,193,61,130,2,2,195,253,130,2,1,192,247,0,
+  4,39,63,43,130,2,3,193,177,193,93,130,1,2,196,168,197,129,1,2,205,136,193,105,
+  0,4,198,206,192,22,200,219,1,1,1,200,220,1,2,198,207,1,3,2,2,140,0,3,
+  224,131,205,137,198,185,0,3,194,8,192,156,130,1,3,194,7,192,156,130,1,4,51,192,
+  156,193,124,42,1,2,205,138,196,161,0,4,200,221,63,91,27,0,4,224,132,194,4,193,
+  247,27,0,2,197,134,205,139,0,2,197,134,198,132,1,1,42,1,1,205,140,0,2,108,
+  27,2,4,38,194,85,164,66,3,4,193,251,194,85,164,66,4,2,184,192,242,3,3,192,
+  114,91,27,3,2,184,192,242,2,7,24,113,24,107,49,193,46,114,2,2,193,66,119,4,
+  3,66,55,192,241,2,3,145,91,27,2,2,194,136,192,173,3,1,193,181,3,1,192,57,
+  0,4,108,27,66,119,4,5,145,91,27,66,119,3,2,55,192,241,2,3,2,193,14,195,
+  26,3,3,51,83,71,3,2,193,205,192,97,3,1,82,3,3,192,34,174,192,97,3,1,
+  193,156,3,3,185,174,192,97,3,2,195,78,192,169,3,2,97,57,3,3,3,193,205,192,
+  97,4,2,174,192,97,3,1,71,3,1,192,169,0,8,108,27,2,192,169,2,51,83,71,
+  5,2,83,71,3,2,193,255,183,4,1,187,3,2,83,71,1,1,198,208,1,4,199,71,
+  194,178,63,27,1,2,55,27,2,3,45,63,27,1,3,224,133,63,27,1,2,195,237,27,
+  1,2,194,197,27,1,2,51,27,3,2,193,66,119,3,2,2,71,4,2,83,71,0,3,
+  108,51,198,208,2,2,193,21,27,1,2,198,116,27,1,4,200,127,194,178,63,27,1,1,
+  193,105,1,4,192,153,145,91,192,153,2,9,2,186,116,38,91,192,153,2,186,116,5,3,
+  57,171,193,21,5,2,193,66,119,5,2,66,119,4,1,183,4,7,96,38,108,192,153,2,
+  186,116,6,2,171,193,21,6,5,91,192,153,2,186,96,5,2,193,66,119,5,2,66,119,
+  0,5,108,192,153,2,186,187,1,2,75,27,2,2,195,237,27,1,3,200,221,63,27,1,
+  2,200,217,27,1,2,195,238,194,62,1,2,195,14,27,1,3,200,222,63,27,1,1,197,
+  133,1,2,48,27,1,2,101,27,1,2,198,209,27,1,4,192,240,200,223,63,27,1,2,
+  174,192,97,1,2,192,92,27,3,4,145,91,192,92,27,0,5,108,192,92,27,66,119,3,
+  3,2,25,193,183,4,3,51,172,71,4,2,75,193,183,4,3,171,193,255,183,6,1,187,
+  4,2,185,193,183,4,2,196,199,193,183,4,3,193,104,75,193,183,2,2,194,197,27,2,
+  2,195,238,194,62,1,2,192,174,27,2,2,193,21,27,1,3,54,198,117,27,1,4,194,
+  35,27,193,66,119,3,4,2,51,83,71,0,5,108,194,35,27,2,192,169,5,4,2,51,
+  83,71,6,2,83,71,4,2,174,198,118,4,2,83,71,2,3,192,174,193,21,27,1,2,
+  193,87,27,1,2,63,27,3,3,196,24,174,192,97,0,1,194,15,0,1,224,134,0,1,
+  224,135,0,1,224,136,0,4,192,106,192,49,1,192,6,3,1,198,210,3,1,112,0,4,
+  192,106,192,49,1,178,3,1,152,3,1,224,137,3,1,192,58,3,1,98,3,1,192,5,
+  1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,
+  65,2,1,54,2,1,192,33,0,3,192,106,0,20,2,1,192,32,2,1,224,138,2,1,
+  192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,194,189,2,1,193,18,2,1,224,
+  139,2,1,192,3,2,1,224,140,2,1,129,2,1,205,141,2,1,192,102,2,1,90,0,
+  3,192,106,0,192,144,2,1,224,141,2,1,170,2,1,167,2,1,205,142,2,1,173,2,
+  1,192,95,2,1,192,145,2,1,150,2,1,192,195,2,1,198,211,2,1,154,2,1,182,
+  2,1,192,101,2,1,180,2,1,192,167,0,3,192,106,0,193,123,2,1,194,140,2,1,
+  192,214,2,1,193,12,2,1,192,194,2,1,192,109,2,1,176,1,2,192,4,205,143,2,
+  3,199,90,224,142,205,144,2,1,205,144,2,1,205,145,3,1,205,143,1,2,1,193,191,
+  2,1,224,143,1,3,192,61,0,154,3,1,176,0,4,192,106,16,1,192,45,3,1,56,
+  3,1,58,3,1,53,3,1,192,233,3,1,46,3,1,192,103,0,6,192,173,38,195,77,
+  164,38,192,172,2,4,192,172,38,195,77,164,2,2,108,27,2,3,195,81,38,192,172,3,
+  2,192,26,164,2,7,193,151,164,38,192,172,38,193,151,164,1,3,24,192,146,198,156,2,
+  4,196,215,192,146,164,66,1,4,195,47,192,146,164,66,0,5,192,173,195,47,192,146,194,
+  132,66,1,3,193,3,194,236,193,39,4,3,38,193,151,164,1,4,164,66,192,26,192,172,
+  1,2,192,26,198,156,2,2,164,66,2,2,194,132,66,2,1,192,172,2,3,193,151,164,
+  66,5,3,2,59,38,8,1,37,7,1,194,18,1,3,145,164,66,1,1,1,1,3,2,
+  120,194,18,2,1,59,0,5,192,173,2,193,127,42,38,0,2,205,48,224,144,0,1,224,
+  145,0,4,32,177,194,177,192,150,0,3,122,194,145,42,1,3,115,194,43,192,245,1,4,
+  85,193,52,55,192,171,2,2,194,43,192,245,1,4,78,193,52,55,198,212,4,1,192,171,
+  1,2,33,192,211,1,5,39,193,177,193,93,130,192,150,1,1,224,146,1,5,37,193,177,
+  193,93,130,192,150,1,1,195,12,1,1,194,130,0,4,122,117,194,43,192,245,1,4,65,
+  193,52,55,192,171,1,4,194,124,193,52,55,192,171,1,2,83,119,1,2,63,43,0,1,
+  197,104,1,1,200,224,2,1,195,128,0,3,192,139,14,115,2,1,85,2,1,78,2,1,
+  133,2,1,49,2,1,128,2,1,117,2,1,65,0,3,192,139,14,54,2,1,192,33,1,
+  2,193,170,42,1,2,0,192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,
+  2,1,192,232,2,1,192,3,2,1,192,239,2,1,224,147,2,1,129,2,1,192,102,2,
+  1,193,60,2,1,90,0,3,192,139,0,192,144,2,1,170,2,1,167,2,1,173,2,1,
+  192,95,2,1,150,2,1,192,195,2,1,154,2,1,182,2,1,192,101,2,1,193,33,2,
+  1,180,2,1,192,167,2,1,200,225,2,1,192,109,2,1,176,0,3,192,139,0,205,146,
+  1,2,193,127,42,1,2,1,224,148,2,1,196,152,2,1,224,149,2,1,224,150,1,3,
+  3,0,192,203,3,1,90,3,1,170,3,1,167,3,1,173,3,1,192,95,3,1,150,3,
+  1,154,3,1,180,1,3,192,61,0,154,0,4,192,139,192,61,0,192,109,3,1,176,1,
+  3,16,1,20,3,1,192,74,3,1,192,98,3,1,56,3,1,193,13,3,1,58,3,1,
+  53,3,1,192,233,3,1,46,1,2,224,151,0,0,3,224,152,224,153,1,0,6,192,124,
+  197,219,192,146,224,154,193,1,197,53,2,5,2,202,42,197,166,200,187,197,53,3,4,200,
+  226,197,166,200,187,197,53,0,2,192,124,193,171,0,4,30,20,1,224,155,3,1,224,156,
+  3,1,224,157,3,1,224,158,3,1,201,184,3,1,201,185,3,1,201,186,3,1,201,187,
+  3,1,201,188,3,1,201,189,3,1,201,190,3,1,201,191,3,1,201,192,3,1,224,159,
+  3,1,224,160,0,4,30,20,1,201,193,3,1,201,194,3,1,201,195,3,1,224,161,3,
+  1,224,162,3,1,224,163,3,1,201,196,3,1,201,197,3,1,201,198,3,1,201,199,3,
+  1,201,200,3,1,201,201,3,1,201,202,3,1,201,203,3,1,201,204,3,1,201,205,0,
+  4,30,20,1,201,206,3,1,201,207,3,1,201,208,3,1,201,209,3,1,201,210,3,1,
+  201,211,3,1,201,212,3,1,201,213,3,1,224,164,3,1,201,214,3,1,201,215,3,1,
+  201,216,3,1,201,217,3,1,201,218,3,1,201,219,3,1,201,220,0,4,30,20,1,201,
+  221,3,1,201,222,3,1,201,223,3,1,201,224,3,1,201,225,3,1,201,226,3,1,201,
+  227,3,1,201,228,3,1,201,229,3,1,201,230,3,1,201,231,3,1,201,232,3,1,201,
+  233,3,1,201,234,3,1,201,235,3,1,201,236,0,4,30,20,1,201,237,3,1,201,238,
+  3,1,201,239,3,1,201,240,3,1,201,241,3,1,201,242,3,1,201,243,3,1,201,244,
+  3,1,201,245,3,1,201,246,3,1,201,247,3,1,201,248,3,1,201,249,3,1,201,250,
+  3,1,201,251,3,1,201,252,0,4,30,20,1,224,165,3,1,224,166,3,1,224,167,3,
+  1,224,168,3,1,224,169,3,1,224,170,3,1,224,171,3,1,224,172,3,1,224,173,3,
+  1,224,174,3,1,224,175,3,1,224,176,3,1,224,177,3,1,224,178,3,1,224,179,3,
+  1,224,180,0,4,30,20,1,224,181,3,1,224,182,3,1,224,183,3,1,201,253,3,1,
+  201,254,3,1,201,255,3,1,202,0,3,1,202,1,3,1,202,2,3,1,202,3,3,1,
+  202,4,3,1,202,5,3,1,202,6,3,1,202,7,3,1,202,8,3,1,202,9,0,4,
+  30,20,1,202,10,3,1,202,11,3,1,202,12,3,1,202,13,3,1,202,14,3,1,202,
+  15,3,1,202,16,3,1,202,17,3,1,202,18,3,1,202,19,3,1,202,20,3,1,224,
+  184,3,1,224,185,3,1,224,186,3,1,224,187,3,1,224,188,0,4,30,20,1,224,189,
+  3,1,224,190,3,1,224,191,3,1,224,192,3,1,224,193,3,1,224,194,3,1,224,195,
+  3,1,224,196,3,1,224,197,3,1,224,198,3,1,224,199,3,1,224,200,3,1,224,201,
+  3,1,224,202,3,1,224,203,3,1,224,204,0,4,30,20,1,224,205,3,1,224,206,3,
+  1,224,207,3,1,224,208,3,1,224,209,3,1,224,210,3,1,224,211,3,1,224,212,3,
+  1,224,213,3,1,224,214,3,1,224,215,3,1,224,216,3,1,224,217,3,1,224,218,3,
+  1,224,219,3,1,224,220,0,4,30,20,1,224,221,3,1,224,222,3,1,224,223,3,1,
+  224,224,3,1,224,225,3,1,224,226,3,1,224,227,3,1,224,228,3,1,224,229,3,1,
+  224,230,3,1,224,231,3,1,224,232,3,1,224,233,3,1,224,234,3,1,224,235,3,1,
+  224,236,0,4,30,20,1,224,237,3,1,224,238,3,1,224,239,3,1,224,240,3,1,224,
+  241,3,1,224,242,3,1,224,243,3,1,224,244,3,1,224,245,3,1,224,246,3,1,224,
+  247,3,1,224,248,3,1,224,249,3,1,224,250,3,1,224,251,3,1,224,252,0,4,30,
+  20,1,224,253,3,1,224,254,3,1,224,255,3,1,225,0,3,1,225,1,3,1,225,2,
+  3,1,225,3,3,1,225,4,3,1,225,5,3,1,225,6,3,1,225,7,3,1,225,8,
+  3,1,225,9,3,1,225,10,3,1,225,11,3,1,225,12,0,4,30,20,1,225,13,3,
+  1,225,14,3,1,225,15,3,1,225,16,3,1,225,17,3,1,225,18,3,1,225,19,3,
+  1,225,20,3,1,225,21,3,1,225,22,3,1,225,23,3,1,225,24,3,1,225,25,3,
+  1,225,26,3,1,225,27,3,1,225,28,0,4,30,20,1,225,29,3,1,225,30,3,1,
+  225,31,3,1,225,32,3,1,225,33,3,1,225,34,3,1,225,35,3,2,225,36,20,3,
+  2,225,37,62,3,2,225,38,192,20,3,2,225,39,56,3,2,225,40,192,113,3,2,225,
+  41,192,18,3,2,225,42,192,83,3,2,225,43,192,6,3,2,225,44,112,0,5,30,20,
+  1,225,45,225,46,3,2,225,47,225,48,3,2,225,49,225,50,3,2,225,51,225,52,3,
+  2,225,53,192,77,3,2,225,54,192,57,3,2,225,55,192,35,3,2,225,56,192,108,3,
+  2,225,57,225,58,3,2,225,59,225,60,3,2,225,61,225,62,3,2,225,63,225,64,3,
+  2,225,65,194,214,3,1,225,66,3,1,225,67,3,1,225,68,0,4,30,20,1,225,69,
+  3,1,225,70,3,1,225,71,3,1,225,72,3,1,225,73,3,1,225,74,3,1,225,75,
+  3,1,225,76,3,1,225,77,3,1,225,78,3,1,225,79,3,1,225,80,3,1,225,81,
+  3,1,225,82,3,1,225,83,3,1,225,84,0,4,30,20,1,225,85,3,1,225,86,3,
+  1,225,87,3,1,225,88,3,1,225,89,3,1,225,90,3,1,225,91,3,1,225,92,3,
+  1,225,93,3,1,225,94,3,1,225,95,3,1,225,96,3,1,225,97,3,1,225,98,3,
+  1,225,99,3,1,225,100,0,4,30,20,1,225,101,3,1,225,102,3,1,225,103,3,1,
+  225,104,3,1,225,105,3,1,225,106,3,1,225,107,3,1,225,108,3,1,225,109,3,1,
+  225,110,3,1,225,111,3,1,225,112,3,1,225,113,3,1,225,114,3,1,225,115,3,1,
+  225,116,0,4,30,20,1,225,117,3,1,225,118,3,1,225,119,3,1,225,120,3,1,225,
+  121,3,1,225,122,3,1,225,123,3,1,225,124,3,1,225,125,3,1,225,126,3,1,225,
+  127,3,1,225,128,3,1,225,129,3,1,225,130,3,1,225,131,3,1,225,132,0,4,30,
+  20,1,225,133,3,1,225,134,3,1,225,135,3,1,225,136,3,1,225,137,3,1,225,138,
+  3,1,225,139,3,1,225,140,3,1,225,141,3,1,225,142,3,1,225,143,3,1,225,144,
+  3,1,225,145,3,1,225,146,3,1,225,147,3,1,225,148,0,4,30,20,1,225,149,3,
+  1,225,150,3,1,225,151,3,1,225,152,3,1,225,153,3,1,225,154,1,4,62,162,225,
+  155,193,233,3,2,225,156,195,250,3,2,225,157,200,79,3,2,225,158,225,159,3,2,225,
+  160,225,161,3,2,225,162,225,163,3,2,225,164,203,134,3,2,225,165,198,71,3,2,225,
+  166,225,167,3,2,225,168,225,169,0,5,30,62,162,225,170,225,171,3,2,225,172,202,190,
+  3,2,225,173,197,97,3,2,225,174,225,175,3,2,225,176,200,8,3,2,225,177,225,178,
+  3,2,225,179,205,147,3,2,225,180,225,181,3,2,225,182,225,183,3,2,225,184,197,215,
+  3,2,225,185,198,187,3,1,225,186,3,2,225,187,225,188,3,2,225,189,197,212,3,1,
+  225,190,3,2,225,191,205,148,0,4,30,62,162,225,192,3,1,225,193,3,2,225,194,193,
+  83,3,1,225,195,3,1,225,196,3,1,225,197,3,1,225,198,3,1,225,199,3,2,225,
+  200,199,251,3,1,225,201,3,1,225,202,3,2,225,203,225,204,3,2,225,205,225,206,3,
+  1,225,207,3,1,225,208,3,1,225,209,0,4,30,62,162,225,210,3,1,225,211,3,1,
+  225,212,3,1,225,213,3,1,225,214,3,1,225,215,3,2,225,216,199,41,3,1,225,217,
+  3,2,225,218,195,59,3,1,225,219,3,1,225,220,3,1,225,221,3,1,225,222,3,1,
+  225,223,3,1,225,224,3,1,225,225,0,4,30,62,162,225,226,3,1,225,227,3,1,225,
+  228,3,1,225,229,3,2,225,230,198,179,3,2,225,231,225,232,3,2,225,233,202,160,3,
+  2,225,234,205,76,3,2,225,235,27,3,1,225,236,3,2,225,237,225,238,3,1,225,239,
+  3,1,225,240,3,3,225,241,225,242,197,167,3,2,225,243,197,167,3,3,225,244,197,167,
+  198,134,0,5,30,62,162,225,245,198,131,3,1,225,246,3,1,225,247,3,1,225,248,3,
+  1,225,249,3,1,225,250,3,1,225,251,3,1,225,252,3,2,225,253,225,254,3,1,225,
+  255,3,1,226,0,3,1,226,1,3,1,226,2,3,1,226,3,3,2,193,136,226,4,4,
+  1,226,5,0,5,30,62,162,193,136,226,6,4,1,226,7,4,1,226,8,4,1,226,9,
+  4,1,226,10,4,1,226,11,4,1,226,12,4,1,226,13,4,1,226,14,4,1,226,15,
+  4,1,226,16,4,1,226,17,4,1,226,18,4,1,226,19,4,1,226,20,4,1,226,21,
+  0,5,30,62,162,193,136,226,22,4,1,226,23,4,1,226,24,4,1,226,25,4,1,226,
+  26,4,1,226,27,4,1,226,28,4,1,226,29,4,1,226,30,4,1,226,31,4,1,226,
+  32,2,3,195,159,226,33,226,34,3,2,226,35,226,36,3,2,226,37,226,38,3,2,226,
+  39,226,40,3,2,226,41,226,42,0,5,30,62,195,159,226,43,226,44,2,3,4,204,37,
+  191,3,2,204,38,193,179,3,2,204,39,150,3,2,204,40,193,54,3,2,204,41,66,3,
+  2,204,42,173,3,2,204,43,194,24,3,2,204,44,20,3,2,204,45,193,228,3,2,226,
+  45,46,3,2,226,46,194,41,3,2,226,47,193,180,3,2,226,48,193,80,3,2,226,49,
+  194,5,3,2,226,50,193,231,0,5,30,62,4,226,51,194,11,3,2,226,52,192,221,3,
+  2,226,53,194,220,3,2,226,54,197,83,3,2,226,55,193,31,3,2,226,56,193,71,3,
+  2,226,57,199,219,3,2,226,58,193,217,3,2,226,59,194,39,3,2,226,60,58,3,2,
+  226,61,226,62,3,2,226,63,193,72,3,2,226,64,182,3,2,226,65,198,55,3,2,226,
+  66,226,67,3,2,226,68,195,8,0,5,30,62,4,226,69,194,22,3,2,226,70,56,3,
+  2,226,71,192,210,3,2,226,72,193,234,3,2,226,73,193,218,3,2,226,74,193,208,3,
+  2,226,75,226,76,3,2,226,77,193,250,3,2,226,78,193,227,3,2,226,79,194,214,3,
+  2,226,80,198,53,3,2,226,81,194,181,3,2,226,82,194,25,3,2,226,83,193,28,3,
+  2,226,84,194,86,3,2,226,85,192,109,0,5,30,62,4,226,86,193,92,3,2,226,87,
+  192,102,3,2,226,88,193,235,3,2,226,89,180,3,2,226,90,154,3,2,226,91,53,3,
+  2,226,92,226,93,3,2,226,94,196,45,3,2,226,95,226,96,3,2,226,97,193,203,3,
+  2,226,98,226,99,3,2,226,100,193,190,3,2,226,101,193,196,3,2,226,102,200,75,3,
+  2,226,103,192,238,3,2,226,104,193,119,0,5,30,62,4,226,105,193,229,3,2,226,106,
+  193,178,3,2,226,107,226,108,3,2,226,109,90,3,2,226,110,198,123,3,2,226,111,167,
+  3,2,226,112,193,230,3,2,226,113,192,98,3,2,226,114,197,88,3,2,226,115,226,116,
+  3,2,226,117,54,2,2,11,226,118,3,1,226,119,3,1,226,120,3,1,226,121,3,1,
+  226,122,0,4,30,62,11,226,123,3,1,226,124,3,1,226,125,3,1,226,126,3,1,226,
+  127,3,1,226,128,3,1,226,129,3,1,226,130,3,1,226,131,0,2,205,149,11,0,2,
+  226,132,226,133,0,2,226,134,104,0,1,195,242,0,1,226,135,0,2,205,150,1,0,3,
+  192,230,0,20,0,3,192,230,0,193,85,2,1,192,32,2,1,192,107,2,1,192,142,2,
+  1,191,2,1,194,189,2,1,56,2,1,195,149,2,1,193,18,2,1,192,3,2,1,192,
+  239,2,1,129,2,1,195,153,2,1,58,2,1,192,102,2,1,90,0,3,192,230,0,192,
+  144,2,1,170,2,1,167,2,1,173,2,1,192,95,2,1,53,2,1,193,4,2,1,150,
+  2,1,192,195,2,1,182,2,1,192,101,2,1,180,2,1,192,167,2,3,136,196,206,194,
+  250,4,1,205,151,4,1,226,136,0,5,192,230,0,136,196,206,173,4,1,194,22,3,2,
+  173,194,41,2,1,193,123,2,1,194,140,2,1,46,2,1,193,219,2,1,200,97,2,1,
+  192,109,2,1,194,129,2,1,176,2,1,226,137,2,1,192,221,2,1,193,236,1,2,192,
+  4,192,168,2,2,192,209,192,104,0,3,226,138,226,139,1,0,1,226,140,0,1,226,141,
+  0,1,226,142,0,1,198,77,1,3,2,226,143,196,124,0,2,193,133,24,2,3,2,59,
+  38,3,2,51,194,175,4,1,193,192,3,2,172,193,21,3,2,76,195,26,3,1,193,192,
+  1,1,192,26,2,3,197,148,193,133,24,2,3,2,59,38,0,5,193,133,192,26,2,51,
+  194,175,4,1,193,192,3,2,172,193,21,3,2,76,195,26,0,1,226,144,0,8,171,193,
+  21,193,66,39,198,84,74,51,83,1,1,195,203,1,1,196,204,1,3,39,37,27,3,2,
+  51,27,2,1,193,69,1,2,108,27,3,2,193,66,119,2,2,51,27,4,2,193,66,119,
+  2,2,198,209,27,0,3,171,37,193,69,1,2,91,27,3,2,193,66,119,2,2,51,27,
+  4,2,193,66,119,2,2,198,209,27,0,2,226,145,197,231,0,1,198,21,0,3,226,146,
+  200,48,104,0,2,200,179,205,41,1,1,0,0,2,135,192,245,1,1,202,161,1,2,205,
+  31,11,1,4,51,194,249,193,124,42,1,1,195,134,0,4,135,195,134,2,59,1,1,192,
+  124,0,3,107,205,152,196,135,1,3,85,194,139,114,1,2,110,114,2,1,120,2,3,195,
+  33,63,120,2,2,185,194,130,1,3,39,226,147,196,124,2,8,114,189,107,76,39,66,107,
+  192,147,9,1,37,4,6,113,192,147,66,107,76,37,8,1,37,7,3,113,76,37,5,4,
+  39,66,107,192,147,8,2,76,37,0,10,107,39,114,189,113,39,66,113,76,37,5,5,76,
+  39,66,107,192,147,9,2,76,37,9,1,37,2,1,226,148,2,2,204,158,196,124,2,1,
+  226,149,2,1,198,213,2,3,193,211,197,168,194,4,2,3,200,226,193,247,27,2,1,174,
+  2,3,193,245,185,194,130,1,3,49,193,46,114,2,2,193,49,114,1,9,37,114,189,107,
+  192,147,66,107,76,37,7,3,113,76,37,0,9,107,37,114,189,107,192,147,66,113,37,5,
+  5,39,66,107,76,37,7,2,113,192,147,8,2,76,37,5,5,76,39,66,113,192,147,9,
+  2,76,37,9,1,37,4,6,113,76,39,66,113,192,147,9,1,37,2,3,193,56,2,59,
+  2,3,205,153,63,43,2,1,198,213,2,3,193,211,197,168,194,4,2,3,200,226,194,98,
+  27,2,3,194,178,63,120,4,1,43,0,3,107,37,174,2,3,193,245,185,194,130,1,3,
+  128,194,139,114,1,3,65,194,139,114,2,2,194,135,114,1,4,193,245,49,193,49,114,0,
+  1,194,184,1,4,199,237,194,236,172,226,150,0,1,205,133,0,1,226,151,0,3,193,137,
+  0,20,2,1,193,53,2,1,62,2,1,226,152,2,1,192,20,2,1,56,0,3,193,137,
+  0,192,188,2,1,192,2,2,1,192,18,2,1,58,2,1,192,83,2,1,192,6,2,1,
+  198,39,2,1,112,2,1,178,2,1,198,214,2,1,152,2,1,197,62,2,1,192,58,2,
+  1,192,175,2,1,98,2,1,99,0,3,193,137,0,192,5,2,1,195,199,2,1,199,222,
+  2,1,46,2,1,192,77,2,1,192,57,2,1,192,27,0,3,193,167,0,20,2,1,193,
+  53,2,1,62,2,1,192,52,2,1,192,20,2,1,56,2,1,192,188,2,1,192,113,2,
+  1,192,2,0,3,193,167,0,58,2,1,192,6,2,1,112,2,1,200,196,2,1,178,2,
+  1,152,2,1,197,62,2,1,53,2,1,192,175,2,1,98,2,1,99,2,1,198,60,2,
+  1,192,5,2,1,199,222,2,1,46,2,1,192,9,0,3,193,167,0,192,35,1,2,193,
+  245,42,0,2,226,153,104,0,1,192,136,0,1,226,154,0,2,226,155,226,156,0,1,226,
+  157,0,3,193,40,194,21,1,1,2,0,20,2,1,192,32,2,1,193,2,2,1,192,107,
+  2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,0,3,193,40,0,192,232,2,1,
+  56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,102,2,1,193,60,2,
+  1,90,2,1,192,144,2,1,170,2,1,167,2,1,173,2,1,192,251,2,1,192,145,2,
+  1,53,0,3,193,40,0,150,2,1,192,195,2,1,154,2,1,194,6,2,1,182,2,1,
+  180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,194,1,2,32,203,
+  34,1,2,193,42,42,1,2,1,193,191,0,3,193,6,125,226,158,2,1,194,215,0,3,
+  193,6,125,199,249,2,1,226,159,2,2,192,157,195,20,2,3,115,74,195,160,4,1,195,
+  161,4,1,194,81,2,3,85,74,195,160,4,1,195,161,4,1,194,81,2,3,78,74,195,
+  160,4,1,195,161,4,1,194,81,2,2,195,245,195,222,2,1,198,215,2,3,133,74,195,
+  160,4,1,195,161,0,5,193,6,125,133,74,194,81,2,2,188,195,20,2,3,49,74,195,
+  160,4,1,195,161,4,1,194,81,2,1,226,160,2,1,226,161,2,2,194,34,195,222,2,
+  3,128,74,195,160,4,1,195,161,4,1,194,81,2,3,117,74,195,160,4,1,195,161,4,
+  1,194,81,2,2,192,50,195,20,2,1,226,162,0,3,193,6,125,226,163,2,3,65,74,
+  195,160,4,1,195,161,4,1,194,81,2,3,54,74,195,160,4,1,195,161,4,1,194,81,
+  2,2,192,196,195,20,2,2,63,195,222,2,1,226,164,0,2,193,199,226,165,1,3,193,
+  103,74,193,42,1,2,0,20,2,1,192,32,2,1,192,107,2,1,191,0,3,193,199,0,
+  192,3,2,1,192,102,2,1,90,2,1,170,2,1,167,2,1,173,2,1,192,95,2,1,
+  192,145,2,1,150,2,1,154,2,1,182,2,1,180,2,1,192,194,2,1,176,1,1,226,
+  166,1,3,16,1,56,0,4,193,199,16,1,58,3,1,53,3,1,46,0,4,147,192,98,
+  194,116,42,1,2,202,27,42,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,
+  2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,3,192,14,49,193,46,0,
+  4,147,192,14,49,200,227,3,1,205,154,3,1,110,3,1,205,155,3,1,193,49,3,1,
+  196,129,3,1,200,228,3,1,205,156,2,2,65,205,157,3,1,194,135,3,1,198,216,3,
+  1,205,158,1,2,0,20,2,1,192,45,2,1,192,74,2,2,193,30,192,80,0,3,147,
+  0,192,98,2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,2,195,162,192,
+  6,3,1,112,3,1,193,73,3,1,226,167,3,1,178,3,1,152,3,1,197,62,3,1,
+  193,34,3,1,192,35,2,1,191,2,1,192,220,0,3,147,0,193,25,2,1,192,232,2,
+  2,59,226,168,2,1,56,2,1,193,13,2,1,192,3,2,1,192,239,2,1,129,2,1,
+  58,2,1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,
+  1,193,154,0,3,147,0,196,140,2,1,167,2,1,173,2,1,192,95,2,1,192,251,2,
+  1,197,63,2,1,192,145,2,1,53,2,1,192,233,2,1,150,2,1,192,195,2,1,154,
+  2,1,194,6,2,1,182,2,1,192,101,2,1,193,33,0,3,147,0,180,2,1,192,167,
+  2,1,192,214,2,1,193,12,2,1,205,86,2,1,46,2,1,192,103,2,1,192,194,2,
+  2,192,234,192,203,2,2,123,112,3,1,193,73,3,1,98,3,1,193,34,2,1,176,1,
+  3,29,49,134,3,1,169,0,3,147,29,192,66,1,2,1,192,203,2,1,194,92,2,1,
+  193,82,2,2,197,168,193,20,2,3,31,192,203,38,2,1,205,7,2,3,83,119,193,20,
+  2,1,193,20,2,1,193,47,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,1,
+  56,3,1,193,13,3,1,58,0,4,147,16,1,192,80,3,1,53,3,1,192,233,3,1,
+  46,3,1,192,103,3,2,123,112,4,1,193,73,4,1,98,4,1,193,34,0,4,195,60,
+  24,196,154,1,1,1,1,1,7,2,71,24,195,60,24,196,154,1,3,1,1,0,2,226,
+  169,192,211,0,1,226,170,0,1,193,233,0,5,193,233,24,195,250,196,208,195,133,1,1,
+  226,171,1,4,192,158,226,172,195,124,226,173,2,1,226,174,1,4,2,226,175,192,210,226,
+  176,2,1,205,80,0,2,226,177,1,0,3,193,138,226,178,42,1,2,197,0,42,1,2,
+  0,193,254,2,1,196,62,2,1,198,217,2,1,194,226,2,1,192,252,2,1,196,179,2,
+  1,226,179,0,3,193,138,0,194,75,2,1,195,44,2,1,193,53,2,1,205,159,2,1,
+  197,162,2,1,200,229,2,1,194,151,2,1,192,189,2,1,226,180,2,1,193,160,2,1,
+  226,181,2,1,205,160,2,1,226,182,2,1,226,183,2,1,192,158,2,1,200,230,0,3,
+  193,138,0,226,184,2,1,226,185,1,1,192,4,1,2,226,186,42,0,1,226,187,0,4,
+  192,218,194,21,42,38,3,1,57,1,2,0,226,188,2,1,194,68,2,1,194,235,2,1,
+  194,69,2,1,205,161,2,1,195,58,2,1,226,189,2,1,194,213,2,1,226,190,0,3,
+  192,218,0,194,95,2,1,193,19,2,1,194,121,2,1,226,191,2,1,226,192,2,1,194,
+  96,2,1,205,162,2,1,194,122,2,1,194,26,2,1,192,177,2,1,192,238,2,1,226,
+  193,2,1,195,240,2,1,194,192,2,1,194,103,2,1,194,97,0,3,192,218,0,193,86,
+  2,1,226,194,2,1,194,70,2,1,195,28,2,1,226,195,2,1,193,11,2,1,226,196,
+  2,1,226,197,2,1,194,123,2,1,194,159,2,1,226,198,1,2,29,85,2,1,49,3,
+  1,134,2,1,192,66,2,1,192,224,0,3,192,218,192,4,59,3,2,196,24,59,2,4,
+  51,59,196,24,59,2,1,200,231,2,2,192,124,195,146,2,1,192,171,2,2,54,140,1,
+  2,1,193,150,0,2,226,199,196,21,0,2,226,200,193,155,0,2,226,201,200,232,0,4,
+  197,45,11,40,226,202,0,2,226,203,193,238,0,3,192,140,193,146,42,1,2,0,196,229,
+  2,1,20,0,3,192,140,0,192,32,2,1,192,107,2,1,192,142,2,1,191,2,1,194,
+  189,2,1,192,3,2,1,129,2,1,192,102,2,1,90,2,1,192,144,2,1,170,2,1,
+  167,2,1,173,2,1,192,95,2,1,192,145,2,1,150,0,3,192,140,0,192,195,2,1,
+  154,2,1,182,2,1,192,101,2,1,180,2,1,192,167,2,1,193,123,2,1,194,140,2,
+  1,192,109,2,1,176,2,1,192,221,2,1,193,236,1,2,42,194,104,1,2,1,192,203,
+  2,1,193,82,1,3,192,61,0,20,0,4,192,140,192,61,0,192,32,3,1,192,107,3,
+  1,192,142,3,1,191,3,1,194,189,3,1,192,3,3,1,129,3,1,192,102,3,1,90,
+  3,1,192,144,3,1,170,3,1,167,3,1,173,3,1,192,95,3,1,192,145,3,1,150,
+  0,4,192,140,192,61,0,192,195,3,1,154,3,1,182,3,1,192,101,3,1,180,3,1,
+  192,167,3,1,193,123,3,1,194,140,3,1,192,109,3,1,176,3,1,192,221,3,1,193,
+  236,1,3,16,1,192,45,3,1,56,3,1,58,3,1,53,0,4,192,140,16,1,46,0,
+  2,226,204,11,0,3,226,205,205,163,226,206,0,4,192,100,137,14,115,3,1,85,3,1,
+  78,3,1,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,2,
+  2,0,20,3,1,192,45,3,1,192,74,0,4,192,100,137,0,192,98,3,1,192,32,3,
+  1,193,2,3,1,192,107,3,1,192,142,3,1,191,3,1,192,220,3,1,193,25,3,1,
+  192,232,3,1,56,3,1,192,3,3,1,192,239,3,1,129,3,1,58,3,1,192,80,3,
+  1,192,102,0,4,192,100,137,0,193,60,3,1,202,67,3,1,90,3,1,192,144,3,1,
+  197,169,3,1,170,3,1,193,154,3,1,167,3,1,173,3,1,192,95,3,1,192,251,3,
+  1,192,145,3,1,53,3,1,150,3,1,192,195,3,1,154,0,4,192,100,137,0,182,3,
+  1,192,101,3,1,193,33,3,1,180,3,1,192,167,3,1,200,225,3,1,192,214,3,1,
+  193,12,3,1,46,3,1,192,103,3,1,192,194,3,1,176,2,1,226,207,2,1,226,208,
+  2,2,1,192,203,3,1,194,114,0,4,192,100,137,1,200,88,3,1,193,191,3,1,193,
+  47,2,1,193,20,2,3,16,1,192,45,4,1,192,74,4,1,192,98,4,1,56,4,1,
+  58,4,1,192,80,4,1,53,4,1,46,4,1,192,103,4,2,123,98,0,3,226,209,204,
+  150,193,88,0,3,200,89,200,176,11,0,2,226,210,42,0,2,226,211,205,164,0,4,12,
+  25,5,20,3,1,192,112,3,1,62,3,1,194,28,3,1,192,52,3,1,193,169,3,1,
+  192,20,3,1,194,2,3,1,196,218,3,1,56,3,1,193,43,3,1,192,191,3,1,192,
+  113,3,1,192,2,0,4,12,25,5,193,239,3,1,192,18,3,1,58,3,1,192,199,3,
+  1,192,83,3,1,192,6,3,1,194,54,3,1,112,3,1,194,164,3,1,178,3,1,193,
+  31,3,1,152,3,1,193,92,3,1,53,3,1,192,108,3,1,193,125,0,4,12,25,5,
+  192,58,3,1,193,197,3,1,192,210,3,1,194,73,3,1,192,175,3,1,98,3,1,193,
+  144,3,1,99,3,1,193,185,3,1,192,5,3,1,194,50,3,1,193,198,4,1,11,3,
+  1,46,3,1,192,235,3,1,192,9,0,4,12,25,5,192,77,3,1,192,57,3,1,194,
+  133,3,1,192,35,3,1,192,27,3,1,194,201,2,2,14,115,3,1,85,3,1,78,3,
+  1,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,0,4,12,
+  25,193,43,11,2,3,192,11,5,20,4,1,62,4,1,192,52,4,1,192,20,4,1,56,
+  4,1,192,113,4,1,192,2,4,1,192,18,4,1,58,4,1,192,83,4,1,192,6,4,
+  1,112,4,1,178,4,1,152,4,1,53,0,5,12,25,192,11,5,192,58,4,1,192,175,
+  4,1,98,4,1,99,4,1,192,5,4,1,46,4,1,192,9,4,1,192,77,4,1,192,
+  57,4,1,192,35,4,1,192,27,3,2,3,20,4,1,62,4,1,192,52,4,1,192,20,
+  4,1,56,0,5,12,25,192,11,3,192,113,4,1,192,2,4,1,192,18,4,1,58,4,
+  1,192,83,4,1,192,6,4,1,112,4,1,178,4,1,152,4,1,53,4,1,192,58,4,
+  1,192,175,4,1,98,4,1,99,4,1,192,5,4,1,46,0,5,12,25,192,11,3,192,
+  9,4,1,192,77,4,1,192,57,4,1,192,35,4,1,192,27,2,3,44,5,20,4,1,
+  192,112,4,1,62,4,1,194,28,4,1,192,52,4,1,193,169,4,1,192,20,4,1,194,
+  2,4,1,56,4,1,193,43,4,1,192,191,0,5,12,25,44,5,192,113,4,1,192,2,
+  4,1,193,239,4,1,192,18,4,1,58,4,1,192,199,4,1,192,83,4,1,192,6,4,
+  1,194,54,4,1,112,4,1,194,164,4,1,178,4,1,193,31,4,1,152,4,1,193,92,
+  4,1,53,0,5,12,25,44,5,192,108,4,1,193,125,4,1,192,58,4,1,193,197,4,
+  1,192,210,4,1,194,73,4,1,192,175,4,1,98,4,1,193,144,4,1,99,4,1,193,
+  185,4,1,192,5,4,1,194,50,4,1,193,198,5,1,11,4,1,46,0,5,12,25,44,
+  5,192,235,4,1,192,9,4,1,192,77,4,1,192,57,4,1,194,133,4,1,192,35,4,
+  1,192,27,4,1,194,201,3,2,193,43,11,3,2,194,54,11,3,1,196,230,3,2,196,
+  231,196,232,3,2,193,197,11,3,2,192,210,11,3,2,193,144,11,3,2,3,20,0,5,
+  12,25,44,3,192,112,4,1,62,4,1,194,28,4,1,192,52,4,1,193,169,4,1,192,
+  20,4,1,194,2,4,1,56,4,1,193,43,4,1,192,191,4,1,192,113,4,2,50,193,
+  185,4,1,192,2,4,1,193,239,4,1,192,18,4,1,58,0,5,12,25,44,3,192,199,
+  4,1,192,83,4,1,192,6,4,1,194,54,4,1,112,4,1,194,164,4,1,178,4,1,
+  193,31,4,1,152,4,1,193,92,4,1,53,4,1,192,108,4,1,193,125,4,1,192,58,
+  4,1,193,197,4,1,192,210,0,5,12,25,44,3,194,73,4,1,192,175,4,1,98,4,
+  1,193,144,4,1,99,4,1,193,185,4,1,192,5,4,1,194,50,4,1,193,198,4,1,
+  46,4,1,192,235,4,1,192,9,4,1,192,77,4,1,192,57,4,1,194,133,4,1,192,
+  35,0,5,12,25,44,3,192,27,4,1,194,201,3,2,193,198,11,2,2,194,54,11,2,
+  1,196,230,2,2,196,231,196,232,2,2,193,197,11,2,2,192,210,11,2,2,193,144,11,
+  2,3,157,5,20,4,1,62,4,1,192,52,4,1,192,20,4,1,56,4,1,192,113,4,
+  1,192,2,0,5,12,25,157,5,192,18,4,1,58,4,1,192,83,4,1,192,6,4,1,
+  112,4,1,178,4,1,152,4,1,53,4,1,192,58,4,1,192,175,4,1,98,4,1,99,
+  4,1,192,5,4,1,46,4,1,192,9,4,1,192,77,0,5,12,25,157,5,192,57,4,
+  1,192,35,4,1,192,27,3,2,3,20,4,1,62,4,1,192,52,4,1,192,20,4,1,
+  56,4,1,192,113,4,1,192,2,4,1,192,18,4,1,58,4,1,192,83,4,1,192,6,
+  4,1,112,4,1,178,0,5,12,25,157,3,152,4,1,53,4,1,192,58,4,1,192,175,
+  4,1,98,4,1,99,4,1,192,5,4,1,46,4,1,192,9,4,1,192,77,4,1,192,
+  57,4,1,192,35,4,1,192,27,2,2,3,20,3,1,192,112,3,1,62,0,4,12,25,
+  3,194,28,3,1,192,52,3,1,193,169,3,1,192,20,3,1,194,2,3,1,196,218,3,
+  1,56,3,1,193,43,3,1,192,191,3,1,192,113,3,2,50,193,185,3,1,192,2,3,
+  1,193,239,3,1,192,18,3,1,58,3,1,192,199,0,4,12,25,3,192,83,3,1,192,
+  6,3,1,194,54,3,1,112,3,1,194,164,3,1,178,3,1,193,31,3,1,152,3,1,
+  193,92,3,1,53,3,1,192,108,3,1,193,125,3,1,192,58,3,1,193,197,3,1,192,
+  210,3,1,194,73,0,4,12,25,3,192,175,3,1,98,3,1,193,144,3,1,99,3,1,
+  193,185,3,1,192,5,3,1,194,50,3,1,193,198,3,1,46,3,1,192,235,3,1,192,
+  9,3,1,192,77,3,1,192,57,3,1,194,133,3,1,192,35,3,1,192,27,0,4,12,
+  25,3,194,201,2,2,193,198,11,1,3,192,17,5,20,3,1,62,3,1,192,20,3,1,
+  56,3,1,192,113,3,1,192,2,3,1,58,3,1,192,83,3,1,192,6,3,1,112,3,
+  1,178,3,1,53,3,1,99,3,1,192,5,0,4,12,192,17,5,46,3,1,192,9,3,
+  1,192,77,3,1,192,57,3,1,192,35,2,2,14,115,3,1,85,3,1,78,3,1,133,
+  3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,2,2,3,20,0,
+  4,12,192,17,3,62,3,1,192,52,3,1,192,20,3,1,56,3,1,192,113,3,1,192,
+  2,3,1,192,18,3,1,58,3,1,192,83,3,1,192,6,3,1,112,3,1,178,3,1,
+  152,3,1,53,3,1,192,58,3,1,192,175,0,4,12,192,17,3,98,3,1,99,3,1,
+  192,5,3,1,46,3,1,192,9,3,1,192,77,3,1,192,57,3,1,192,35,3,1,192,
+  27,1,2,196,78,189,1,3,192,11,5,20,3,1,62,3,1,192,20,3,1,56,3,1,
+  192,113,3,1,192,2,0,4,12,192,11,5,192,83,3,1,192,6,3,1,112,3,1,178,
+  3,1,152,3,1,53,3,1,192,58,3,1,192,175,3,1,99,3,1,192,5,3,1,46,
+  3,1,192,9,3,1,192,77,3,1,192,57,3,1,192,35,2,2,3,20,0,4,12,192,
+  11,3,62,3,1,192,52,3,1,192,20,3,1,56,3,1,192,113,3,1,192,2,3,1,
+  192,18,3,1,58,3,1,192,83,3,1,192,6,3,1,112,3,1,178,3,1,152,3,1,
+  53,3,1,192,58,3,1,192,175,0,4,12,192,11,3,98,3,1,99,3,1,192,5,3,
+  1,46,3,1,192,9,3,1,192,77,3,1,192,57,3,1,192,35,3,1,192,27,1,3,
+  44,5,20,3,1,192,112,3,1,62,3,1,194,28,3,1,192,52,3,1,193,169,3,1,
+  192,20,0,4,12,44,5,194,2,3,1,56,3,1,193,43,3,1,192,191,3,1,192,113,
+  3,1,192,2,3,1,193,239,3,1,192,18,3,1,58,3,1,192,199,3,1,192,83,3,
+  1,192,6,3,1,194,54,3,1,112,3,1,194,164,3,1,178,0,4,12,44,5,193,31,
+  3,1,152,3,1,193,92,3,1,53,3,1,192,108,3,1,193,125,3,1,192,58,3,1,
+  193,197,3,1,192,210,3,1,194,73,3,1,192,175,3,1,98,3,1,193,144,3,1,99,
+  3,1,193,185,3,1,192,5,0,4,12,44,5,194,50,3,1,193,198,4,1,11,3,1,
+  46,3,1,192,235,3,1,192,9,3,1,192,77,3,1,192,57,3,1,194,133,3,1,192,
+  35,3,1,192,27,3,1,194,201,2,2,193,43,11,2,2,194,54,11,2,1,196,230,2,
+  2,196,231,196,232,0,4,12,44,193,197,11,2,2,192,210,11,2,2,193,144,11,2,2,
+  3,20,3,1,192,112,3,1,62,3,1,194,28,3,1,192,52,3,1,193,169,3,1,192,
+  20,3,1,194,2,3,2,193,249,58,4,1,192,83,3,1,56,3,1,193,43,3,1,192,
+  191,0,4,12,44,3,192,113,3,2,50,193,185,3,1,192,2,3,1,193,239,3,1,58,
+  3,1,192,199,3,1,192,83,3,1,192,6,3,1,194,54,3,1,112,3,1,194,164,3,
+  1,178,3,1,193,31,3,1,152,3,1,193,92,3,1,53,0,4,12,44,3,192,108,3,
+  1,193,125,3,1,192,58,3,1,193,197,3,1,192,210,3,1,194,73,3,1,192,175,3,
+  1,98,3,1,193,144,3,1,99,3,1,193,185,3,1,192,5,3,1,194,50,3,1,193,
+  198,3,1,46,3,1,192,235,0,4,12,44,3,192,9,3,1,192,77,3,1,192,57,3,
+  1,194,133,3,1,192,35,3,1,192,27,3,1,194,201,2,2,193,198,11,1,3,39,192,
+  156,130,2,3,51,192,156,130,2,2,197,108,192,247,2,3,63,43,130,3,3,193,177,193,
+  93,130,1,3,192,164,5,20,3,1,62,3,1,192,52,0,4,12,192,164,5,192,20,3,
+  1,56,3,1,192,113,3,1,192,2,3,1,192,18,3,1,58,3,1,192,83,3,1,192,
+  6,3,1,112,3,1,178,3,1,152,3,1,53,3,1,192,58,3,1,192,175,3,1,98,
+  3,1,99,0,4,12,192,164,5,192,5,3,1,46,3,1,192,9,3,1,192,77,3,1,
+  192,57,3,1,192,35,3,1,192,27,2,2,14,115,3,1,85,3,1,78,3,1,133,3,
+  1,49,3,1,128,3,1,117,3,1,65,3,1,54,0,4,12,192,164,14,192,33,2,2,
+  3,20,3,1,62,3,1,192,52,3,1,192,20,3,1,56,3,1,192,113,3,1,192,2,
+  3,1,192,18,3,1,58,3,1,192,83,3,1,192,6,3,1,112,3,1,178,3,1,152,
+  3,1,53,0,4,12,192,164,3,192,58,3,1,192,175,3,1,98,3,1,99,3,1,192,
+  5,3,1,46,3,1,192,9,3,1,192,77,3,1,192,57,3,1,192,35,3,1,192,27,
+  1,3,37,192,156,130,2,3,51,192,156,130,2,2,197,108,192,247,2,3,63,43,130,3,
+  3,193,177,193,93,130,0,3,12,194,134,189,1,4,48,25,5,20,4,1,192,112,4,1,
+  62,4,1,194,28,4,1,192,52,4,1,193,169,4,1,192,20,4,1,194,2,4,1,56,
+  4,1,193,43,4,1,192,191,4,1,192,113,4,1,192,2,4,1,193,239,4,1,192,18,
+  0,5,12,48,25,5,58,4,1,192,199,4,1,192,83,4,1,192,6,4,1,194,54,4,
+  1,112,4,1,194,164,4,1,178,4,1,193,31,4,1,152,4,1,193,92,4,1,53,4,
+  1,192,108,4,1,193,125,4,1,192,58,4,1,193,197,0,5,12,48,25,5,192,210,4,
+  1,194,73,4,1,192,175,4,1,98,4,1,193,144,4,1,99,4,1,193,185,4,1,192,
+  5,4,1,194,50,4,1,193,198,5,1,11,4,1,46,4,1,192,235,4,1,192,9,4,
+  1,192,77,4,1,192,57,0,5,12,48,25,5,194,133,4,1,192,35,4,1,192,27,4,
+  1,194,201,3,2,14,115,4,1,85,4,1,78,4,1,133,4,1,49,4,1,128,4,1,
+  117,4,1,65,4,1,54,4,1,192,33,3,2,193,43,11,3,3,44,5,20,0,6,12,
+  48,25,44,5,192,112,5,1,62,5,1,194,28,5,1,192,52,5,1,193,169,5,1,192,
+  20,5,1,194,2,5,1,56,5,1,193,43,5,1,192,191,5,1,192,113,5,1,192,2,
+  5,1,193,239,5,1,192,18,5,1,58,5,1,192,199,0,6,12,48,25,44,5,192,83,
+  5,1,192,6,5,1,194,54,5,1,112,5,1,194,164,5,1,178,5,1,193,31,5,1,
+  152,5,1,193,92,5,1,53,5,1,192,108,5,1,193,125,5,1,192,58,5,1,193,197,
+  5,1,192,210,5,1,194,73,0,6,12,48,25,44,5,192,175,5,1,98,5,1,193,144,
+  5,1,99,5,1,193,185,5,1,192,5,5,1,194,50,5,1,193,198,6,1,11,5,1,
+  46,5,1,192,235,5,1,192,9,5,1,192,77,5,1,192,57,5,1,194,133,5,1,192,
+  35,0,6,12,48,25,44,5,192,27,5,1,194,201,4,2,193,43,11,4,2,194,54,11,
+  4,1,196,230,4,2,196,231,196,232,4,2,193,197,11,4,2,192,210,11,4,2,193,144,
+  11,4,2,3,20,5,1,192,112,5,1,62,5,1,194,28,5,1,192,52,5,1,193,169,
+  5,1,192,20,0,6,12,48,25,44,3,194,2,5,1,56,5,1,193,43,5,1,192,191,
+  5,1,192,113,5,2,50,193,185,5,1,192,2,5,1,193,239,5,1,192,18,5,1,58,
+  5,1,192,199,5,1,192,83,5,1,192,6,5,1,194,54,5,1,112,5,1,194,164,0,
+  6,12,48,25,44,3,178,5,1,193,31,5,1,152,5,1,193,92,5,1,53,5,1,192,
+  108,5,1,193,125,5,1,192,58,5,1,193,197,5,1,192,210,5,1,194,73,5,1,192,
+  175,5,1,98,5,1,193,144,5,1,99,5,1,193,185,0,6,12,48,25,44,3,192,5,
+  5,1,194,50,5,1,193,198,5,1,46,5,1,192,235,5,1,192,9,5,1,192,77,5,
+  1,192,57,5,1,194,133,5,1,192,35,5,1,192,27,5,1,194,201,4,2,193,198,11,
+  3,2,194,54,11,3,1,196,230,3,2,196,231,196,232,0,5,12,48,25,193,197,11,3,
+  2,192,210,11,3,2,193,144,11,3,2,3,20,4,1,192,112,4,1,62,4,1,194,28,
+  4,1,192,52,4,1,193,169,4,1,192,20,4,1,194,2,4,1,56,4,1,193,43,4,
+  1,192,191,4,1,192,113,4,2,50,193,185,0,5,12,48,25,3,192,2,4,1,193,239,
+  4,1,192,18,4,1,58,4,1,192,199,4,1,192,83,4,1,192,6,4,1,194,54,4,
+  1,112,4,1,194,164,4,1,178,4,1,193,31,4,1,152,4,1,193,92,4,1,53,4,
+  1,192,108,0,5,12,48,25,3,193,125,4,1,192,58,4,1,193,197,4,1,192,210,4,
+  1,194,73,4,1,192,175,4,1,98,4,1,193,144,4,1,99,4,1,193,185,4,1,192,
+  5,4,1,194,50,4,1,193,198,4,1,46,4,1,192,235,4,1,192,9,0,5,12,48,
+  25,3,192,77,4,1,192,57,4,1,194,133,4,1,192,35,4,1,192,27,4,1,194,201,
+  3,2,193,198,11,2,2,5,20,3,1,62,3,1,192,52,3,1,192,20,3,1,56,3,
+  1,192,113,3,1,192,2,3,1,192,18,3,1,58,0,4,12,48,5,192,83,3,1,192,
+  6,3,1,112,3,1,178,3,1,152,3,1,53,3,1,192,58,3,1,192,175,3,1,98,
+  3,1,99,3,1,192,5,3,1,46,3,1,192,9,3,1,192,77,3,1,192,57,3,1,
+  192,35,0,4,12,48,5,192,27,2,2,14,115,3,1,85,3,1,78,3,1,133,3,1,
+  49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,2,3,44,5,20,4,1,
+  62,4,1,192,52,4,1,192,20,4,1,56,0,5,12,48,44,5,192,113,4,1,192,2,
+  4,1,192,18,4,1,58,4,1,192,83,4,1,192,6,4,1,112,4,1,178,4,1,152,
+  4,1,53,4,1,192,58,4,1,192,175,4,1,98,4,1,99,4,1,192,5,4,1,46,
+  0,5,12,48,44,5,192,9,4,1,192,77,4,1,192,57,4,1,192,35,4,1,192,27,
+  3,2,3,20,4,1,62,4,1,192,52,4,1,192,20,4,1,56,4,1,192,113,4,1,
+  192,2,4,1,192,18,4,1,58,4,1,192,83,4,1,192,6,0,5,12,48,44,3,112,
+  4,1,178,4,1,152,4,1,53,4,1,192,58,4,1,192,175,4,1,98,4,1,99,4,
+  1,192,5,4,1,46,4,1,192,9,4,1,192,77,4,1,192,57,4,1,192,35,4,1,
+  192,27,2,2,3,20,0,4,12,48,3,62,3,1,192,52,3,1,192,20,3,1,56,3,
+  1,192,113,3,1,192,2,3,1,192,18,3,1,58,3,1,192,83,3,1,192,6,3,1,
+  112,3,1,178,3,1,152,3,1,53,3,1,192,58,3,1,192,175,0,4,12,48,3,98,
+  3,1,99,3,1,192,5,3,1,46,3,1,192,9,3,1,192,77,3,1,192,57,3,1,
+  192,35,3,1,192,27,1,3,157,5,20,3,1,192,52,3,1,192,20,3,1,192,2,3,
+  1,192,83,3,1,192,6,3,1,152,0,4,12,157,5,53,3,1,192,58,3,1,192,175,
+  3,1,99,3,1,192,5,3,1,46,3,1,192,9,3,1,192,77,3,1,192,57,3,1,
+  192,35,3,1,192,27,2,2,3,20,3,1,62,3,1,192,52,3,1,192,20,3,1,192,
+  113,0,4,12,157,3,192,18,3,1,58,3,1,192,83,3,1,192,6,3,1,112,3,1,
+  178,3,1,152,3,1,192,58,3,1,192,175,3,1,98,3,1,99,3,1,192,5,3,1,
+  46,3,1,192,9,3,1,192,77,3,1,192,57,0,4,12,157,3,192,35,3,1,192,27,
+  0,1,226,212,0,3,194,16,192,90,115,2,1,195,131,2,1,194,237,2,1,195,10,2,
+  1,85,2,1,78,2,1,195,218,2,1,133,2,1,195,219,2,1,49,2,1,128,2,1,
+  195,220,2,1,117,0,3,194,16,192,90,195,54,2,1,192,66,2,1,195,221,2,1,65,
+  2,1,194,124,2,1,54,2,1,192,33,0,2,194,254,192,156,2,2,196,76,39,2,10,
+  2,177,193,246,195,254,192,158,27,192,89,116,24,39,11,1,37,9,3,39,24,116,11,1,
+  96,9,3,37,24,116,11,1,96,9,3,96,24,39,0,12,194,254,192,156,2,177,193,246,
+  195,254,192,158,27,192,89,96,24,37,1,1,194,236,1,4,37,192,156,2,59,0,3,198,
+  70,192,135,198,19,0,2,205,165,193,246,1,1,194,15,0,4,192,39,5,0,20,3,1,
+  192,74,3,1,205,166,3,1,62,3,1,192,52,3,1,192,20,3,1,56,3,1,192,113,
+  3,1,192,2,3,1,198,74,0,4,192,39,5,0,58,3,1,192,83,3,1,192,6,3,
+  1,205,167,3,1,112,3,1,178,3,1,152,3,1,205,168,3,1,53,3,1,193,4,3,
+  1,192,58,3,1,192,175,3,1,98,3,1,99,3,1,192,5,3,1,46,0,4,192,39,
+  5,0,192,9,3,1,192,77,3,1,192,57,3,1,192,35,3,1,193,27,3,1,192,27,
+  1,1,192,168,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,3,2,193,24,
+  15,2,1,128,2,1,117,2,1,65,0,5,192,39,14,65,193,24,15,2,1,54,3,2,
+  193,24,15,2,1,192,33,1,2,193,170,197,34,1,2,192,209,192,104,1,2,29,195,131,
+  2,1,194,237,2,1,195,10,2,1,195,218,2,1,195,219,2,1,195,220,2,1,195,54,
+  2,1,192,66,2,1,195,221,2,1,194,124,0,4,192,39,3,0,20,3,1,192,74,3,
+  1,205,166,3,1,62,3,1,192,52,3,1,192,20,3,1,56,3,1,192,113,3,1,192,
+  2,3,1,198,74,3,1,58,3,1,192,83,3,1,192,6,3,1,205,167,3,1,112,3,
+  1,178,0,4,192,39,3,0,152,3,1,205,168,3,1,53,3,1,193,4,3,1,192,58,
+  3,1,192,175,3,1,98,3,1,99,3,1,192,5,3,1,46,3,1,192,9,3,1,192,
+  77,3,1,192,57,3,1,192,35,3,1,193,27,3,1,192,27,0,3,192,39,11,226,213,
+  0,2,200,233,192,168,1,2,193,170,42,1,2,193,127,42,0,3,185,55,120,1,3,25,
+  63,120,1,4,115,193,52,55,192,171,2,2,194,43,192,245,1,3,85,194,43,192,245,1,
+  4,197,108,39,192,247,192,150,2,3,37,192,247,192,150,1,4,78,193,52,55,192,171,3,
+  2,195,151,192,171,1,2,33,192,211,1,4,39,193,61,130,192,150,2,2,192,247,192,150,
+  0,5,185,194,8,192,156,130,192,150,1,2,12,193,242,1,4,37,193,61,130,192,150,2,
+  2,192,247,192,150,1,4,193,206,192,156,130,192,150,1,1,195,12,1,1,194,130,1,4,
+  117,193,52,55,192,171,2,2,194,43,192,245,1,3,3,63,120,1,4,65,193,52,55,192,
+  171,3,2,195,151,192,171,1,2,83,119,1,2,63,120,2,1,43,0,4,192,86,192,87,
+  226,214,226,215,0,3,192,86,192,87,199,122,2,2,226,216,205,169,2,1,226,217,2,1,
+  226,218,2,2,14,115,3,1,85,3,1,78,3,1,133,3,1,49,3,1,128,3,1,117,
+  3,1,65,3,1,54,3,1,192,33,2,2,0,226,219,3,1,192,32,0,4,192,86,192,
+  87,0,226,220,3,1,192,142,3,1,226,221,3,1,192,220,3,1,193,25,3,1,226,222,
+  3,1,226,223,3,1,56,3,1,226,224,3,1,226,225,3,1,226,226,3,1,58,4,1,
+  195,255,3,1,226,227,3,1,197,145,3,1,226,228,0,4,192,86,192,87,0,205,170,4,
+  1,195,255,3,1,198,218,4,1,195,255,3,1,200,234,4,1,195,255,3,1,173,4,1,
+  195,255,3,1,205,171,4,1,195,255,3,1,192,251,3,1,192,145,3,1,53,3,1,150,
+  4,1,195,255,3,1,226,229,0,4,192,86,192,87,0,226,230,3,1,200,235,3,1,192,
+  101,3,1,193,33,3,1,226,231,3,1,200,70,4,1,195,255,3,1,192,214,3,1,193,
+  12,3,1,195,143,3,1,226,232,3,1,194,247,2,2,194,219,205,169,2,3,4,197,170,
+  42,2,1,193,20,2,3,16,1,202,250,0,5,192,86,192,87,16,1,226,233,4,1,226,
+  234,4,1,192,98,4,1,226,235,4,1,192,80,4,1,226,236,4,1,200,236,4,1,226,
+  237,4,1,226,238,4,1,226,239,4,1,192,103,4,1,193,47,4,1,226,240,2,3,193,
+  215,197,170,42,0,1,205,73,0,2,226,241,104,0,1,226,242,0,6,80,81,31,29,134,
+  195,181,4,1,199,123,4,1,196,54,4,1,226,243,4,2,192,66,195,181,4,1,195,24,
+  4,1,195,181,2,2,14,115,3,1,85,3,1,78,3,1,133,3,1,49,3,1,128,3,
+  1,117,3,1,65,0,4,80,81,14,54,2,3,4,204,46,193,203,3,2,204,47,90,3,
+  2,204,48,193,230,3,2,204,49,193,234,3,2,204,50,192,109,3,2,204,51,195,16,3,
+  2,204,52,198,91,3,2,204,53,193,233,3,2,204,54,226,244,3,2,204,55,194,33,3,
+  2,204,56,192,32,3,2,204,57,193,176,3,2,204,58,58,3,2,204,59,20,3,2,204,
+  60,46,0,5,80,81,4,204,61,194,24,3,2,204,62,191,3,2,204,63,194,25,3,2,
+  204,64,193,218,3,2,204,65,182,3,2,204,66,193,235,3,2,204,67,194,22,3,2,204,
+  68,180,3,2,204,69,193,190,3,2,204,70,192,149,3,2,204,71,170,3,2,204,72,193,
+  174,3,2,204,73,195,190,3,2,204,74,192,102,3,2,204,75,196,45,3,2,204,76,9,
+  0,5,80,81,4,204,77,176,3,2,204,78,193,27,3,2,204,79,195,17,3,2,204,80,
+  193,18,3,2,204,81,195,119,3,2,204,82,200,68,3,2,204,83,226,245,3,2,204,84,
+  192,177,3,2,204,85,198,37,3,2,204,86,129,3,2,204,87,197,79,3,2,204,88,197,
+  43,3,2,204,89,205,172,3,2,226,246,193,208,3,2,226,247,226,248,3,2,226,249,197,
+  252,0,5,80,81,4,226,250,193,196,3,2,226,251,226,252,3,2,226,253,194,181,3,2,
+  226,254,192,238,3,2,226,255,205,173,3,2,227,0,205,174,3,2,227,1,196,152,3,2,
+  227,2,193,54,3,2,227,3,200,237,3,2,227,4,205,175,3,2,227,5,227,6,3,2,
+  227,7,195,6,3,2,227,8,227,9,3,2,227,10,227,11,3,2,227,12,197,47,3,2,
+  227,13,195,8,0,5,80,81,4,227,14,200,238,3,2,227,15,200,103,3,2,227,16,194,
+  41,3,2,227,17,205,176,3,2,227,18,192,210,3,2,227,19,66,3,2,227,20,205,177,
+  3,2,227,21,205,178,3,2,227,22,198,1,3,2,227,23,192,226,3,2,227,24,205,179,
+  3,2,227,25,194,213,3,2,227,26,197,75,3,2,227,27,195,50,3,2,227,28,196,26,
+  3,2,227,29,193,180,0,5,80,81,4,227,30,194,91,3,2,227,31,195,120,3,2,227,
+  32,199,105,3,2,227,33,227,34,3,2,227,35,198,40,3,2,227,36,194,63,3,3,227,
+  37,171,200,239,3,2,227,38,205,180,3,2,227,39,195,18,3,2,227,40,196,148,3,2,
+  227,41,205,181,3,2,227,42,196,202,3,2,227,43,197,42,3,2,227,44,205,182,3,2,
+  227,45,194,180,3,2,227,46,193,250,0,5,80,81,4,227,47,193,19,3,2,227,48,194,
+  113,3,2,227,49,227,50,3,2,227,51,150,3,2,227,52,56,3,2,227,53,205,183,3,
+  2,227,54,197,81,3,2,227,55,205,184,3,2,227,56,196,128,3,3,227,57,171,200,240,
+  3,3,227,58,171,200,241,3,2,227,59,197,205,3,2,227,60,205,185,3,2,227,61,196,
+  151,3,3,227,62,171,192,226,3,2,227,63,192,3,0,5,80,81,4,227,64,205,186,3,
+  2,227,65,194,214,3,2,227,66,197,78,3,2,227,67,205,187,3,2,227,68,193,228,3,
+  2,227,69,199,88,3,2,227,70,193,178,3,2,227,71,198,122,3,2,227,72,200,242,3,
+  2,227,73,193,94,3,2,227,74,199,99,3,2,227,75,200,243,3,2,227,76,205,188,3,
+  2,227,77,197,245,3,2,227,78,198,43,3,2,227,79,227,80,0,5,80,81,4,227,81,
+  227,82,3,2,227,83,196,122,3,2,227,84,205,189,3,2,227,85,192,158,3,2,227,86,
+  205,190,3,2,227,87,199,189,3,2,227,88,205,191,3,2,227,89,192,158,3,2,227,90,
+  197,86,3,2,227,91,195,127,3,2,227,92,194,250,3,2,227,93,227,94,3,2,227,95,
+  193,158,3,2,227,96,198,58,3,3,227,97,171,200,244,3,2,227,98,204,33,0,5,80,
+  81,4,227,99,205,192,3,2,227,100,199,103,3,2,227,101,200,239,3,2,227,102,53,3,
+  2,227,103,199,116,3,2,227,104,197,44,3,2,227,105,196,201,3,2,227,106,196,34,3,
+  2,227,107,205,193,3,2,227,108,194,10,3,2,227,109,205,88,3,2,227,110,193,210,3,
+  2,227,111,200,241,3,2,227,112,196,149,3,2,227,113,197,206,3,2,227,114,227,115,0,
+  5,80,81,4,227,116,205,194,3,3,227,117,171,198,1,3,2,227,118,196,29,3,2,227,
+  119,193,13,3,2,227,120,227,121,3,2,227,122,192,233,3,2,227,123,227,124,3,2,227,
+  125,227,126,3,2,227,127,194,65,3,2,227,128,227,129,3,2,227,130,227,131,3,2,227,
+  132,154,3,2,227,133,200,240,3,2,227,134,195,185,3,2,227,135,200,244,3,3,227,136,
+  171,195,8,0,5,80,81,4,227,137,193,57,3,2,227,138,227,139,3,2,227,140,192,188,
+  3,2,227,141,227,142,3,2,227,143,205,195,3,2,227,144,194,5,3,2,227,145,195,108,
+  3,3,227,146,171,200,242,3,2,227,147,205,196,3,2,227,148,192,194,3,2,227,149,194,
+  158,3,2,227,150,227,151,3,2,227,152,197,252,3,2,227,153,227,154,3,2,227,155,197,
+  70,3,2,227,156,199,107,0,5,80,81,4,227,157,200,245,3,2,227,158,200,246,3,2,
+  227,159,227,160,3,2,227,161,193,53,3,2,227,162,227,163,3,2,227,164,227,165,0,4,
+  227,166,2,133,227,167,0,2,227,168,11,0,1,197,213,0,5,156,192,44,192,14,115,195,
+  89,3,2,194,237,195,89,3,2,85,195,89,3,2,78,195,89,3,2,133,195,89,3,2,
+  49,110,4,1,227,169,0,5,156,192,44,192,14,128,195,89,3,2,117,195,89,3,2,192,
+  66,195,89,3,2,65,195,89,3,2,54,195,89,2,2,0,20,3,2,193,30,182,3,1,
+  192,32,3,1,191,3,1,56,3,1,195,153,3,1,58,3,1,90,3,1,192,144,3,1,
+  170,3,1,167,0,4,156,192,44,0,173,3,1,193,71,3,1,53,3,1,150,3,1,194,
+  11,3,1,154,3,1,182,3,1,193,228,3,1,180,3,1,193,54,3,1,66,3,1,192,
+  109,3,1,176,2,2,195,174,227,170,3,1,227,171,2,2,29,115,0,5,156,192,44,29,
+  115,134,5,1,169,4,1,169,3,2,194,110,169,3,1,193,68,4,1,169,3,1,85,4,
+  1,134,5,1,169,4,1,169,3,1,193,153,4,1,169,3,1,78,4,1,134,5,1,169,
+  4,1,169,0,4,156,192,44,29,133,4,1,134,5,1,169,4,1,169,3,2,193,41,169,
+  3,1,49,4,1,134,5,1,169,4,1,169,3,1,128,4,1,134,5,1,169,4,1,169,
+  3,1,193,77,4,1,169,3,1,117,0,5,156,192,44,29,117,134,5,1,169,4,1,169,
+  3,1,194,61,4,1,169,3,1,192,66,4,1,169,3,1,193,117,4,1,169,3,1,65,
+  4,1,134,5,1,169,4,1,169,3,1,192,224,4,1,169,3,1,54,0,5,156,192,44,
+  29,54,134,5,1,169,4,1,169,1,3,193,101,0,20,3,1,192,32,3,1,227,172,3,
+  1,191,3,1,56,3,1,195,153,3,1,58,3,1,90,3,1,192,144,3,1,170,3,1,
+  167,3,1,173,3,1,205,14,0,4,156,193,101,0,193,71,3,1,205,15,3,1,53,3,
+  1,150,3,1,194,11,3,1,154,3,1,205,16,3,1,182,3,1,205,17,3,1,193,228,
+  3,1,180,3,1,205,18,3,1,193,54,3,1,205,19,3,1,66,3,1,192,109,0,4,
+  156,193,101,0,176,2,2,11,227,173,3,1,227,174,0,1,227,175,0,2,195,163,192,182,
+  1,3,171,145,192,114,3,2,54,198,219,1,1,203,151,1,3,192,114,145,171,1,1,203,
+  152,1,1,203,153,1,3,54,198,219,197,159,3,2,145,171,0,1,227,176,0,3,121,0,
+  194,226,2,2,193,30,167,0,4,121,0,193,30,173,3,1,192,95,3,1,198,127,2,1,
+  192,32,2,1,227,177,2,1,191,2,1,192,220,2,1,227,178,2,1,227,179,2,1,194,
+  189,2,1,197,171,2,1,227,180,2,1,227,181,2,1,193,18,2,1,192,3,2,1,192,
+  239,0,3,121,0,200,83,2,1,129,2,1,195,153,2,1,90,2,1,170,2,1,195,197,
+  2,1,227,182,2,1,227,183,2,1,167,2,1,205,197,2,1,173,2,1,199,33,2,1,
+  192,95,2,1,205,198,2,1,196,103,2,1,192,251,0,3,121,0,227,184,2,1,192,145,
+  2,1,205,199,2,1,150,2,1,198,211,2,1,194,11,2,1,227,185,2,2,195,164,197,
+  160,3,1,195,85,3,1,196,84,3,1,195,86,3,1,198,220,3,1,198,188,3,1,194,
+  140,2,1,227,186,2,1,182,0,3,121,0,192,101,2,1,193,33,2,1,227,187,2,1,
+  180,2,1,193,54,2,1,199,179,2,1,227,188,2,1,195,85,2,1,195,157,2,1,196,
+  84,2,1,195,86,2,1,198,220,2,1,200,194,2,1,198,188,2,1,193,123,2,1,194,
+  156,0,3,121,0,194,140,2,1,227,189,2,1,192,214,2,1,192,194,2,1,227,190,2,
+  1,192,109,2,1,194,129,2,2,9,197,171,3,1,90,3,1,192,251,3,1,150,3,1,
+  180,3,1,193,123,3,1,194,140,3,1,192,214,2,1,192,221,0,3,121,0,193,236,2,
+  1,227,191,2,1,227,192,2,1,198,127,2,1,227,193,2,1,227,194,2,1,227,195,1,
+  2,1,205,200,2,3,192,49,61,119,2,2,195,164,205,200,3,1,205,201,1,2,136,38,
+  2,1,57,2,1,37,2,2,192,240,37,1,3,16,1,20,0,4,121,16,1,192,45,3,
+  1,193,85,3,1,202,59,3,1,227,196,3,1,192,74,3,1,193,53,3,1,194,185,3,
+  1,192,98,3,1,56,3,1,200,247,3,1,195,127,3,1,192,188,3,1,194,227,3,1,
+  194,118,3,1,198,221,3,1,58,0,4,121,16,1,198,222,3,1,205,202,3,1,227,197,
+  3,1,194,71,3,1,203,201,3,1,192,80,3,1,200,248,3,1,200,78,3,1,227,198,
+  3,1,197,61,3,1,152,3,1,194,3,3,1,53,3,1,227,199,3,1,227,200,3,1,
+  227,201,0,4,121,16,1,192,233,3,1,195,191,3,2,194,112,194,118,4,1,198,221,3,
+  1,46,3,1,196,175,3,1,227,202,3,1,227,203,3,1,227,204,3,1,198,119,3,1,
+  227,205,3,1,227,206,3,1,192,103,3,1,227,207,3,1,192,77,3,1,193,208,0,4,
+  121,16,1,192,35,3,1,9,3,1,227,208,0,2,227,209,1,0,1,227,210,0,1,205,
+  203,0,1,227,211,0,2,76,59,1,5,194,174,63,37,192,89,106,0,3,205,204,172,195,
+  236,0,2,200,249,198,179,1,1,197,141,0,2,227,212,197,4,0,2,227,213,1,0,1,
+  227,214,0,1,227,215,0,1,227,216,0,2,193,252,1,2,2,192,158,174,2,3,2,192,
+  168,38,3,2,59,57,3,2,196,78,140,3,2,194,134,140,1,1,184,0,2,227,217,1,
+  0,1,227,218,0,1,205,205,1,1,194,218,0,2,197,102,198,75,2,1,227,219,2,5,
+  2,91,27,193,160,39,0,1,227,220,0,2,227,221,227,222,0,3,192,88,194,21,1,1,
+  1,193,121,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,
+  117,2,1,65,2,1,54,2,1,192,33,1,2,51,193,121,1,2,0,20,2,1,192,45,
+  0,3,192,88,0,192,74,2,1,192,98,2,1,192,32,2,1,193,2,2,1,192,107,2,
+  1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,232,2,1,56,2,1,192,
+  3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,0,3,192,88,0,192,102,2,1,
+  193,60,2,1,90,2,1,192,144,2,1,170,2,1,193,154,2,1,167,2,1,173,2,1,
+  192,95,2,1,192,251,2,1,192,145,2,1,53,2,1,150,2,1,192,195,2,1,154,2,
+  1,182,0,3,192,88,0,192,101,2,1,193,33,2,1,180,2,1,192,167,2,1,192,214,
+  2,1,193,12,2,1,46,2,1,192,103,2,1,192,194,2,2,123,112,3,1,193,73,3,
+  1,98,3,1,193,34,2,1,176,1,2,1,192,203,2,1,227,223,0,3,192,88,1,227,
+  224,2,1,193,20,2,1,193,47,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,
+  1,56,3,1,58,3,1,192,80,3,1,53,3,1,46,3,1,192,103,3,2,123,112,4,
+  1,193,73,4,1,98,4,1,193,34,0,5,61,192,182,2,192,143,192,182,1,3,0,192,
+  31,192,132,2,2,205,117,195,36,2,1,195,111,2,3,195,173,139,136,3,2,135,136,2,
+  2,200,211,195,36,2,2,5,20,3,1,193,85,3,1,62,3,2,195,74,62,3,1,192,
+  52,3,1,192,20,3,1,56,3,1,192,113,3,1,192,2,0,4,61,0,5,192,18,4,
+  2,2,71,3,1,58,3,1,192,83,3,1,192,6,3,1,112,3,1,178,3,1,152,3,
+  1,53,3,1,195,191,3,1,192,58,3,1,192,175,3,1,98,3,2,192,56,56,4,1,
+  152,3,1,192,5,0,4,61,0,5,46,3,1,192,9,3,1,192,77,2,4,195,125,39,
+  110,159,3,3,37,110,159,2,4,195,90,136,194,247,199,75,5,1,197,139,5,1,193,217,
+  5,1,205,206,4,2,195,148,199,75,5,1,197,139,5,1,193,217,5,1,205,206,2,2,
+  192,75,192,132,2,1,193,90,2,2,192,211,192,132,0,4,61,0,41,192,188,3,2,195,
+  55,1,3,2,194,160,1,2,2,199,170,195,36,2,3,59,172,119,3,1,194,87,3,2,
+  83,119,2,2,51,195,111,3,1,194,249,2,2,116,192,97,3,1,193,69,2,3,193,103,
+  139,136,3,2,135,136,2,5,198,223,193,14,195,91,136,119,4,2,136,119,3,3,195,91,
+  136,119,0,5,61,0,198,223,136,119,2,5,198,224,193,14,195,91,136,119,4,2,136,119,
+  3,3,195,91,136,119,3,2,136,119,2,2,102,197,146,2,2,193,74,192,104,4,2,2,
+  71,2,2,192,127,192,132,2,3,110,193,245,193,90,2,5,139,193,14,195,91,136,119,4,
+  2,136,119,3,3,195,91,136,119,3,2,136,119,2,2,205,119,195,36,2,2,39,192,97,
+  0,5,61,0,39,110,159,3,1,193,69,2,3,135,192,31,192,132,3,2,192,75,192,132,
+  3,4,193,14,195,91,136,119,4,2,136,119,3,2,116,192,97,3,2,192,127,192,132,3,
+  3,192,143,193,170,42,3,2,39,27,4,1,192,97,3,3,195,91,136,119,3,1,192,136,
+  3,2,37,192,97,3,1,159,3,1,184,0,5,61,0,135,136,119,3,2,96,192,97,3,
+  2,83,192,124,2,4,107,37,193,56,192,156,2,1,192,136,2,5,196,33,193,14,195,91,
+  136,119,4,2,136,119,3,3,195,91,136,119,3,2,136,119,2,4,76,51,192,31,192,132,
+  4,2,192,127,192,132,3,2,192,127,192,132,2,2,193,252,1,2,2,177,205,207,2,2,
+  97,1,2,1,194,249,0,4,61,0,193,79,193,90,3,2,116,27,3,2,193,170,42,3,
+  3,192,143,193,170,42,3,2,96,27,2,5,193,15,195,36,2,193,15,82,2,2,192,56,
+  192,168,3,2,193,74,192,104,5,2,2,71,2,2,227,225,82,2,2,37,192,97,3,2,
+  110,159,3,1,193,69,2,1,205,207,2,3,192,114,193,64,1,2,2,3,20,0,4,61,
+  0,3,193,85,3,1,192,252,3,1,192,112,3,1,62,4,2,2,82,3,2,195,74,53,
+  3,1,194,28,3,3,193,51,110,53,3,1,192,52,4,2,2,193,244,3,2,5,192,45,
+  4,1,62,4,1,192,2,5,2,2,82,4,1,192,18,4,1,58,0,7,61,0,3,5,
+  58,2,71,4,2,192,143,98,4,1,112,5,2,2,195,35,4,1,152,4,1,193,4,4,
+  1,98,4,1,46,4,1,192,35,3,1,193,169,3,2,193,3,192,108,4,3,192,56,177,
+  56,3,1,192,20,4,2,2,82,6,2,24,192,169,5,1,192,169,0,4,61,0,3,194,
+  2,3,2,198,198,193,109,3,4,193,249,192,83,2,71,7,2,24,82,3,2,195,88,193,
+  109,5,2,2,193,244,6,2,193,15,82,3,1,56,3,1,194,227,3,1,194,29,3,1,
+  195,223,3,1,194,253,3,1,192,113,3,2,200,213,193,109,3,1,192,2,4,2,2,82,
+  0,4,61,0,3,193,239,3,2,33,193,239,4,1,193,197,3,1,192,18,4,2,2,82,
+  5,1,71,3,1,197,164,4,2,2,82,3,3,58,2,71,3,1,192,199,3,1,192,83,
+  4,2,2,195,158,3,1,192,6,3,1,112,4,2,2,195,35,5,3,192,143,200,189,99,
+  0,7,61,0,3,112,2,76,184,5,2,193,135,82,5,2,193,15,82,7,2,24,195,35,
+  3,1,198,199,4,3,2,193,15,82,3,2,32,193,4,3,2,205,123,193,109,3,2,205,
+  124,193,109,3,1,178,4,2,2,82,3,4,152,2,39,82,5,2,193,15,82,3,1,53,
+  4,2,2,71,3,2,177,56,0,5,61,0,3,177,53,3,1,192,58,3,1,193,197,3,
+  1,192,175,3,1,98,4,2,2,195,252,5,1,192,169,3,2,205,126,193,83,3,2,192,
+  56,56,4,2,193,74,192,104,4,2,177,56,3,1,99,4,2,2,193,244,5,1,82,3,
+  1,195,23,3,2,157,192,2,0,5,61,0,3,194,20,46,3,1,192,5,4,3,2,193,
+  135,82,5,2,193,15,82,3,4,205,128,193,109,2,193,244,3,2,198,200,193,109,3,1,
+  193,198,3,3,192,240,110,53,3,2,198,201,193,109,5,3,2,193,15,82,3,2,160,20,
+  4,1,193,85,4,1,192,112,4,1,192,18,4,1,58,4,1,178,0,8,61,0,3,160,
+  178,2,171,194,15,4,2,177,56,4,1,98,5,2,2,82,6,2,171,194,15,8,3,24,
+  193,15,82,4,1,192,9,4,1,192,77,4,1,192,35,5,2,2,195,35,3,1,46,4,
+  1,119,4,3,2,39,82,3,1,192,235,3,1,192,9,4,2,2,82,0,7,61,0,3,
+  192,9,2,37,82,3,1,192,77,3,1,192,57,3,1,192,35,3,1,192,27,4,2,2,
+  193,244,5,2,193,15,82,2,4,197,125,24,139,136,4,2,135,136,2,4,193,145,110,193,
+  245,193,90,3,2,193,245,193,90,2,2,193,245,193,90,2,2,160,192,168,2,1,227,226,
+  2,2,96,192,97,3,1,193,69,0,3,61,0,198,83,2,2,83,192,124,2,1,205,201,
+  2,4,194,247,200,180,136,42,2,4,195,148,200,180,136,42,0,3,227,227,54,196,188,0,
+  2,205,208,198,203,1,2,2,227,228,0,2,227,229,104,0,2,105,194,165,2,3,2,51,
+  192,150,3,1,192,150,1,1,193,90,1,1,192,168,1,2,14,115,2,1,85,0,3,105,
+  14,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,
+  1,4,51,194,165,2,192,150,1,1,195,236,1,2,78,140,1,4,197,172,67,197,136,78,
+  4,1,49,4,1,65,4,1,54,1,2,192,209,192,104,0,3,105,192,143,194,165,3,3,
+  2,51,192,150,1,2,0,20,2,3,193,8,193,9,20,4,1,194,226,4,2,192,203,49,
+  4,1,205,209,4,1,192,107,4,1,191,4,1,227,230,4,1,227,231,4,1,192,220,4,
+  2,110,46,5,1,176,4,1,58,4,2,192,143,205,210,0,5,105,0,193,8,193,9,90,
+  4,1,192,95,4,1,192,251,4,1,150,4,1,192,195,4,1,193,33,4,1,180,4,2,
+  65,205,209,4,1,192,214,4,1,193,12,4,1,205,210,4,2,193,47,49,4,1,192,221,
+  4,1,193,236,2,1,194,185,2,1,192,32,0,3,105,0,192,142,3,3,2,54,140,2,
+  1,193,169,2,1,191,2,1,56,2,1,193,13,2,1,193,18,2,1,192,3,2,1,195,
+  19,2,1,58,2,1,192,102,2,1,90,2,1,192,144,2,1,170,2,1,195,197,2,1,
+  167,0,6,105,0,194,1,193,8,193,9,193,2,5,1,192,107,5,1,205,151,5,1,193,
+  25,5,1,192,232,5,1,192,239,5,1,193,60,5,1,195,197,5,1,192,95,5,1,193,
+  33,5,1,180,5,1,192,214,5,1,192,221,5,1,193,236,3,1,193,18,3,1,58,0,
+  4,105,0,194,1,90,3,1,154,3,1,193,236,2,1,173,2,1,53,2,1,193,4,2,
+  1,150,2,1,194,11,2,1,154,2,1,182,2,1,192,101,2,2,193,223,194,185,3,1,
+  192,142,3,1,191,3,1,56,3,1,193,18,0,4,105,0,193,223,192,3,3,1,197,71,
+  3,1,129,3,1,195,19,3,1,58,3,1,200,250,3,1,192,102,3,1,90,3,1,150,
+  3,1,197,84,3,1,192,101,3,1,180,3,1,193,123,3,1,46,3,1,193,219,3,1,
+  192,221,0,4,105,0,193,223,193,236,2,1,180,2,4,193,139,193,8,193,9,180,5,1,
+  193,236,3,1,194,185,3,1,192,32,3,1,192,142,3,1,191,3,1,194,189,3,1,56,
+  3,1,192,3,3,1,197,71,3,1,195,19,3,1,58,3,1,192,102,3,1,227,232,0,
+  4,105,0,193,139,90,3,3,171,16,1,3,1,167,3,1,227,233,3,1,53,3,1,193,
+  4,3,1,150,3,1,194,11,3,1,180,3,1,193,123,3,1,46,3,1,193,219,3,1,
+  192,109,3,1,176,2,1,193,123,2,1,46,0,3,105,0,193,219,2,1,192,109,2,1,
+  176,2,1,192,221,2,1,200,111,2,1,227,234,1,2,194,1,192,168,2,2,192,209,192,
+  104,1,1,227,235,1,2,192,152,194,165,3,3,2,51,192,150,4,1,192,150,1,4,193,
+  223,4,227,236,195,176,1,2,197,142,194,165,3,3,2,51,192,150,4,1,192,150,0,4,
+  105,193,139,194,160,194,212,1,4,192,174,194,165,2,192,150,1,6,160,197,142,194,165,2,
+  51,192,150,1,2,16,193,171,0,1,197,152,1,1,104,0,3,195,159,40,194,84,2,1,
+  194,247,2,1,195,148,0,1,227,237,0,2,227,238,11,0,2,200,224,195,128,0,2,193,
+  128,199,124,1,2,227,239,227,240,0,1,227,241,0,1,227,242,0,2,203,138,199,236,0,
+  2,205,211,205,68,1,1,205,212,0,2,227,243,200,232,0,1,227,244,0,2,227,245,227,
+  246,0,1,195,247,1,1,202,170,1,1,227,247,1,1,198,225,0,1,196,85,1,1,104,
+  1,1,227,248,0,1,192,228,0,2,227,249,198,33,0,1,227,250,0,2,193,10,193,121,
+  1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,
+  65,2,1,54,2,1,192,33,1,2,51,193,121,1,2,0,20,2,1,192,32,2,1,198,
+  35,2,1,191,0,3,193,10,0,227,251,2,1,56,2,1,200,247,2,1,227,252,2,1,
+  227,253,2,1,227,254,2,1,205,213,2,1,193,196,2,1,170,2,1,203,82,2,1,199,
+  86,2,1,198,226,2,1,198,52,2,1,200,68,2,1,53,2,1,192,231,0,3,193,10,
+  0,192,233,2,1,150,2,1,193,197,2,1,194,86,2,1,193,179,2,1,196,150,2,1,
+  180,2,1,227,255,2,1,228,0,2,1,192,109,2,1,193,94,0,2,197,48,192,172,1,
+  1,192,173,0,3,193,50,0,20,2,1,192,32,2,1,193,2,0,3,193,50,0,192,107,
+  2,1,192,142,2,1,191,2,1,192,220,2,1,198,112,2,1,193,25,2,1,192,232,2,
+  1,56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,102,2,1,197,72,
+  2,1,90,2,1,192,144,0,3,193,50,0,170,2,1,167,2,1,173,2,1,192,251,2,
+  1,192,145,2,1,150,2,1,192,195,2,1,154,2,1,195,122,2,1,194,6,2,1,182,
+  2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,0,3,193,50,0,192,
+  194,2,1,176,1,2,193,42,42,0,1,200,93,0,3,194,205,35,197,55,0,2,194,193,
+  1,2,3,192,158,51,120,3,3,39,110,120,3,3,37,110,120,3,1,174,2,3,2,59,
+  38,3,1,193,192,1,1,192,57,0,1,200,251,1,1,194,193,1,1,194,12,0,1,228,
+  1,0,3,198,227,196,79,1,1,2,200,252,1,1,2,196,86,1,0,2,35,197,161,2,
+  2,2,228,2,1,1,193,165,1,1,228,3,1,3,11,205,214,116,3,1,96,2,2,195,
+  173,205,215,3,1,205,216,3,1,205,217,3,1,196,153,2,1,228,4,2,1,130,0,4,
+  35,11,200,253,42,2,1,192,182,2,1,205,218,3,1,194,47,2,2,192,52,195,92,2,
+  1,228,5,2,3,120,192,57,193,200,2,1,228,6,2,1,228,7,2,3,205,219,193,200,
+  55,4,1,63,2,1,228,8,2,2,31,192,132,3,1,228,9,3,2,228,10,59,3,1,
+  196,233,0,4,35,11,31,228,11,3,2,51,194,79,3,2,116,196,139,3,1,228,12,3,
+  1,228,13,3,1,228,14,3,1,228,15,3,1,228,16,3,1,205,220,3,1,228,17,3,
+  1,228,18,3,1,228,19,3,1,228,20,3,1,228,21,3,1,228,22,3,2,228,23,228,
+  24,0,5,35,11,31,228,25,195,26,3,1,228,26,3,1,228,27,3,1,195,26,3,1,
+  228,28,3,1,205,221,3,1,205,222,3,1,205,223,3,2,192,174,194,79,3,2,96,196,
+  139,2,2,228,29,200,254,2,1,228,30,2,1,228,31,2,2,200,73,200,254,2,2,191,
+  228,32,2,2,194,19,205,224,0,3,35,11,205,225,3,1,197,3,2,2,194,197,196,234,
+  2,1,228,33,2,2,198,110,194,87,2,2,51,196,234,3,1,196,79,3,1,196,86,2,
+  2,196,204,228,34,3,1,228,35,2,2,193,46,193,165,3,1,194,47,2,2,193,103,205,
+  215,3,2,74,228,36,3,1,205,216,3,1,205,217,0,4,35,11,193,103,196,153,2,2,
+  192,113,195,92,4,2,196,235,198,228,5,1,193,32,2,1,200,18,3,1,57,2,2,50,
+  196,234,2,2,200,255,205,221,3,1,205,222,3,1,205,223,2,2,228,37,196,0,2,2,
+  196,79,116,3,1,96,2,1,228,38,2,2,228,39,196,0,2,2,228,40,205,226,0,4,
+  35,11,205,227,55,3,1,63,2,2,192,2,195,92,4,2,196,235,198,228,5,1,193,32,
+  2,2,205,228,116,3,1,96,2,4,200,172,193,165,193,28,194,87,4,1,194,87,2,3,
+  205,229,192,52,195,92,3,2,192,113,195,92,2,2,110,193,165,3,2,201,0,42,3,1,
+  194,47,2,1,228,41,2,2,192,143,198,229,0,5,35,11,195,37,192,52,195,92,3,4,
+  193,46,193,165,195,26,116,6,1,96,3,3,193,103,74,195,188,3,2,50,193,165,3,2,
+  196,79,1,3,2,110,193,165,3,4,193,49,193,165,195,26,116,6,1,96,3,2,228,42,
+  42,3,2,201,1,193,165,2,1,228,43,2,3,39,195,132,1,2,1,198,197,3,2,196,
+  236,194,47,3,2,198,230,194,47,0,3,35,11,228,44,2,1,228,45,2,1,201,2,3,
+  1,55,3,1,194,47,2,3,193,128,193,200,55,4,1,63,2,2,228,46,194,47,2,3,
+  194,205,196,18,194,47,2,2,200,252,116,3,1,96,2,1,228,47,2,2,193,200,55,2,
+  2,205,230,193,200,2,4,49,134,205,231,193,165,5,1,194,47,0,4,35,11,228,48,196,
+  0,2,2,192,150,228,49,3,1,228,50,3,1,228,51,3,1,228,52,3,1,228,53,3,
+  1,228,54,3,1,228,55,3,1,228,56,3,1,228,57,3,1,228,58,3,1,228,59,2,
+  2,196,235,198,228,3,1,193,32,2,2,192,247,193,200,2,2,201,0,42,0,5,35,11,
+  201,0,96,42,2,2,228,60,228,61,2,1,228,62,2,2,97,193,200,2,1,228,63,2,
+  1,205,232,3,1,205,233,2,2,193,49,193,165,3,1,194,47,3,2,136,196,79,4,1,
+  196,86,2,2,205,234,198,228,3,1,193,32,2,2,195,132,140,2,2,201,3,228,64,3,
+  1,228,65,0,4,35,11,201,3,228,66,2,3,193,251,50,196,234,2,3,37,195,132,1,
+  2,1,228,67,2,1,205,235,3,1,205,233,2,1,205,224,2,2,201,4,55,3,1,194,
+  47,3,1,63,2,2,201,5,55,3,1,194,47,3,1,63,2,2,196,86,116,3,1,96,
+  2,2,192,114,196,234,0,4,35,11,192,76,196,234,2,2,228,68,196,0,2,2,228,69,
+  205,226,2,2,196,129,193,165,3,1,194,47,2,2,201,6,193,165,3,1,194,47,2,1,
+  228,70,2,2,43,62,3,2,193,200,55,4,1,63,2,1,228,71,2,5,196,1,197,173,
+  196,2,196,3,196,236,7,1,205,236,7,1,228,72,7,1,228,73,0,7,35,11,196,1,
+  197,173,196,2,196,3,198,230,3,4,201,7,196,2,196,3,196,236,6,1,198,230,7,1,
+  205,236,2,2,201,8,193,165,3,1,194,47,2,2,228,74,196,0,2,1,205,237,3,1,
+  228,75,2,1,228,76,2,4,174,193,200,116,55,5,1,63,4,2,39,55,5,1,63,4,
+  2,37,55,5,1,63,0,6,35,11,174,193,200,96,55,5,2,37,55,6,1,63,5,1,
+  63,2,4,205,238,193,200,116,55,5,1,63,2,1,198,229,3,1,194,87,3,1,96,2,
+  2,228,77,196,0,2,1,228,78,2,2,228,79,193,200,2,2,201,1,193,165,3,1,194,
+  47,2,2,2,228,80,2,2,192,57,193,200,0,3,35,11,192,27,0,5,77,192,49,1,
+  192,12,129,4,1,154,4,1,192,109,4,1,176,3,3,194,180,192,12,170,5,1,167,5,
+  1,173,3,3,192,249,192,12,192,109,1,2,14,115,2,1,85,2,1,78,2,1,133,2,
+  1,49,2,1,128,2,1,117,0,3,77,14,65,2,1,54,2,1,192,33,1,2,0,20,
+  2,2,196,237,154,2,1,192,98,2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,
+  142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,232,2,1,56,2,4,198,45,194,
+  157,194,56,228,81,0,6,77,0,198,45,194,157,194,56,192,251,5,1,199,217,2,1,192,
+  3,2,1,192,239,2,2,196,221,182,2,1,129,2,1,58,2,1,192,80,2,1,192,102,
+  2,1,193,60,2,1,90,2,1,192,144,2,2,193,201,192,107,3,1,192,142,3,1,192,
+  220,3,1,193,25,0,4,77,0,193,201,192,232,3,1,193,18,3,1,192,3,3,1,129,
+  3,1,195,153,3,1,192,102,3,1,193,60,3,1,173,3,1,192,145,3,1,154,3,1,
+  182,3,1,192,214,3,1,193,12,3,1,194,129,3,1,192,221,2,1,170,0,3,77,0,
+  193,154,2,1,167,2,2,194,180,196,50,3,1,197,138,3,1,56,3,1,193,60,3,1,
+  192,95,2,1,173,2,1,192,95,2,1,192,251,2,1,228,82,2,1,192,145,2,1,53,
+  2,1,150,2,1,192,195,2,1,154,0,5,77,0,205,239,198,231,193,18,2,1,182,2,
+  3,198,232,194,56,192,101,2,1,192,101,2,2,192,249,20,3,1,192,32,3,1,193,2,
+  3,1,192,107,3,1,192,142,3,1,191,3,1,193,18,3,1,192,3,3,1,192,239,3,
+  1,129,3,1,193,60,3,1,90,0,4,77,0,192,249,192,144,3,1,173,3,1,192,251,
+  3,1,192,145,3,1,192,195,3,1,192,167,3,1,192,221,2,3,196,49,198,231,192,142,
+  4,1,192,101,2,1,193,33,2,1,180,2,3,52,193,187,192,32,4,1,193,2,4,1,
+  191,4,1,192,220,4,1,193,25,0,5,77,0,52,193,187,192,232,4,1,193,18,4,1,
+  192,3,4,1,192,239,4,1,192,102,4,1,193,60,4,1,193,154,4,1,192,251,4,1,
+  192,145,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,2,2,123,
+  112,3,1,193,73,0,4,77,0,123,98,3,1,193,34,2,1,192,109,2,4,195,57,194,
+  157,194,56,197,82,5,1,192,167,2,1,176,1,3,195,174,193,201,228,83,3,1,205,240,
+  3,1,228,84,1,4,61,0,193,201,205,241,3,2,192,249,205,241,1,3,192,249,14,115,
+  3,1,85,3,1,78,3,1,133,3,1,49,0,4,77,192,249,14,128,3,1,117,3,1,
+  65,3,1,54,3,1,192,33,1,2,1,192,203,2,1,228,85,2,2,59,57,2,2,193,
+  201,197,160,3,1,195,157,2,2,192,121,193,42,2,3,228,86,194,56,136,2,3,205,239,
+  198,231,195,86,2,1,193,42,2,4,192,249,201,9,228,87,136,4,1,195,85,0,5,77,
+  1,192,249,201,9,195,157,3,1,199,223,3,1,195,85,3,1,195,157,3,1,195,86,3,
+  1,198,220,2,3,52,193,187,195,85,4,1,195,86,2,1,193,20,2,1,193,47,2,4,
+  195,57,194,157,194,56,197,160,5,1,195,85,5,1,195,157,5,1,196,84,5,1,195,86,
+  1,2,11,228,88,0,4,77,11,196,237,193,170,3,1,49,3,1,54,2,1,228,89,2,
+  1,228,90,2,1,228,91,2,2,192,249,193,170,3,1,49,1,4,52,193,187,14,115,4,
+  1,85,4,1,78,4,1,133,4,1,49,4,1,128,4,1,117,4,1,65,0,5,77,52,
+  193,187,14,54,4,1,192,33,1,5,136,42,198,232,194,56,228,92,5,2,193,250,195,29,
+  1,3,16,1,192,45,3,1,192,74,3,2,196,237,20,4,1,192,74,3,1,56,4,1,
+  38,3,3,228,93,194,56,58,3,1,58,3,1,192,80,3,2,192,217,193,13,4,1,193,
+  4,4,1,46,0,5,77,16,1,194,180,192,80,4,1,53,3,3,198,232,194,56,195,149,
+  3,2,192,249,192,45,4,1,56,5,1,38,4,2,50,192,35,3,2,196,200,192,45,3,
+  1,46,3,1,192,103,3,2,123,112,4,1,193,73,4,1,98,4,1,193,34,3,4,195,
+  57,194,157,194,56,195,149,6,1,193,219,0,4,194,78,45,59,192,242,2,2,97,192,242,
+  2,2,22,192,242,1,1,201,111,1,1,194,48,1,2,193,133,24,2,1,192,26,1,1,
+  194,194,1,3,43,194,48,192,242,2,2,194,12,192,242,1,1,197,131,1,2,22,192,242,
+  1,1,194,12,2,3,192,242,2,59,4,1,97,1,3,63,83,119,0,4,193,37,228,94,
+  29,78,1,2,0,194,68,2,1,194,235,2,1,194,69,2,1,195,58,2,2,50,194,68,
+  3,1,194,69,3,1,193,19,3,1,194,96,3,1,194,122,3,1,194,26,3,1,192,177,
+  3,1,193,86,3,1,194,123,2,1,194,95,2,1,193,19,0,3,193,37,0,194,121,2,
+  1,194,96,2,1,194,122,2,1,194,26,2,1,192,177,2,1,192,238,2,1,195,240,2,
+  1,194,192,2,1,194,103,2,1,194,97,2,1,193,86,2,1,194,70,2,1,195,28,2,
+  1,193,11,2,1,194,123,2,1,194,159,0,3,193,37,29,85,2,1,78,2,1,49,3,
+  1,134,2,1,192,66,2,1,65,2,1,192,224,2,1,54,0,1,196,230,0,2,228,95,
+  200,209,0,2,228,96,1,0,2,195,217,228,97,0,1,228,98,0,2,192,151,200,82,1,
+  2,0,20,2,1,192,45,0,3,192,151,0,192,74,2,1,192,98,2,1,192,32,2,1,
+  193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,
+  232,2,1,56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,0,3,
+  192,151,0,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,193,154,2,
+  1,167,2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,2,1,53,2,1,150,2,
+  1,192,195,2,1,154,2,1,194,6,0,3,192,151,0,182,2,1,192,101,2,1,193,33,
+  2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,2,1,
+  192,194,2,2,123,98,3,1,193,34,2,1,176,1,2,1,192,203,2,1,194,92,2,1,
+  192,16,0,3,192,151,1,193,20,2,1,193,47,1,3,16,1,192,45,3,1,192,74,3,
+  1,192,98,3,1,56,3,1,58,3,1,192,80,3,1,53,3,2,200,86,56,3,1,46,
+  3,1,192,103,3,2,123,98,4,1,193,34,0,3,196,199,201,10,193,242,0,3,205,242,
+  14,205,243,0,2,205,242,228,99,0,2,228,100,104,0,2,228,101,228,102,0,1,228,103,
+  0,7,205,53,51,83,119,51,37,195,235,0,4,192,15,45,14,192,33,2,4,7,5,0,
+  20,5,1,62,5,1,192,52,5,1,192,20,5,1,56,5,1,192,113,5,1,192,2,5,
+  1,192,18,5,1,58,5,1,192,83,0,6,192,15,45,7,5,0,192,6,5,1,112,5,
+  1,178,5,1,152,5,1,53,5,1,192,58,5,1,192,175,5,1,98,5,1,99,5,1,
+  192,5,5,1,46,5,1,192,9,5,1,192,77,5,1,192,57,5,1,192,35,5,1,192,
+  27,0,4,192,15,45,29,195,131,3,1,194,237,3,1,195,10,3,1,195,218,3,1,195,
+  219,3,1,195,220,3,1,195,54,3,1,195,221,3,1,194,124,3,1,192,224,2,1,43,
+  2,1,174,1,2,189,192,211,2,1,192,241,2,5,76,37,66,107,192,147,1,2,101,193,
+  254,0,4,192,15,101,192,211,42,2,1,201,11,2,4,7,5,0,20,5,1,62,5,1,
+  192,52,5,1,192,20,5,1,56,5,1,192,113,5,1,192,2,5,1,192,18,5,1,58,
+  5,1,192,83,5,1,192,6,5,1,112,5,1,178,5,1,152,0,6,192,15,101,7,5,
+  0,53,5,1,192,58,5,1,192,175,5,1,98,5,1,99,5,1,192,5,5,1,46,5,
+  1,192,9,5,1,192,77,5,1,192,57,5,1,192,35,5,1,192,27,2,1,150,2,2,
+  193,127,42,2,1,182,2,1,205,244,0,7,195,165,20,193,181,74,194,166,164,66,2,5,
+  193,182,74,194,166,164,66,1,5,196,109,194,166,202,25,164,66,1,4,192,172,194,166,164,
+  66,3,2,194,132,66,3,1,192,173,1,4,192,173,194,166,164,66,3,2,194,132,66,3,
+  1,192,172,0,1,205,245,1,2,15,54,0,2,228,104,104,0,1,228,105,0,3,204,98,
+  2,228,106,0,2,228,107,205,59,0,1,228,108,0,3,193,16,192,24,194,221,3,3,192,
+  152,193,41,192,204,4,4,54,134,193,77,192,204,2,1,196,134,3,3,192,152,193,41,192,
+  204,2,1,194,42,3,3,192,152,193,41,192,204,4,4,54,134,193,77,192,204,2,1,193,
+  147,3,3,192,152,199,125,192,204,4,2,193,41,192,204,4,4,49,134,199,126,192,204,4,
+  4,65,134,195,10,192,204,4,4,54,134,193,77,192,204,6,2,198,10,192,204,2,1,194,
+  222,0,6,193,16,192,24,194,222,192,152,193,41,192,204,4,4,54,134,193,77,192,204,2,
+  1,194,93,3,3,192,152,193,41,192,204,4,4,54,134,193,77,192,204,2,1,194,223,3,
+  3,192,152,193,41,192,204,4,4,54,134,193,77,192,204,2,2,160,194,221,3,1,194,42,
+  3,1,193,147,3,1,194,222,3,1,194,93,3,1,194,223,1,1,104,0,3,192,54,193,
+  128,11,0,4,192,54,193,128,2,104,1,2,228,109,1,1,4,52,192,62,14,115,4,1,
+  85,4,1,78,4,1,133,4,1,49,4,1,128,4,1,117,4,1,65,4,1,54,4,1,
+  192,33,3,3,0,50,62,5,1,192,20,5,1,192,6,5,1,178,0,6,192,54,52,192,
+  62,0,50,152,5,1,194,3,5,1,192,9,4,2,139,192,32,5,1,191,5,1,193,18,
+  5,1,129,5,1,90,5,1,205,246,5,1,170,5,1,167,5,1,173,5,1,192,95,5,
+  1,150,5,1,192,195,5,1,194,11,0,6,192,54,52,192,62,0,139,182,5,1,201,12,
+  5,1,180,5,1,192,167,5,1,193,123,5,1,192,194,5,1,194,129,5,1,205,247,5,
+  1,176,4,2,135,192,32,5,1,191,5,1,193,18,5,1,129,5,1,90,5,1,205,246,
+  5,1,170,0,6,192,54,52,192,62,0,135,167,5,1,173,5,1,192,95,5,1,150,5,
+  1,192,195,5,1,194,11,5,1,182,5,1,201,12,5,1,180,5,1,192,167,5,1,193,
+  123,5,1,192,194,5,1,194,129,5,1,205,247,5,1,176,3,2,1,205,248,0,5,192,
+  54,52,192,62,1,228,110,3,3,131,14,49,3,2,136,197,174,4,1,197,175,3,3,16,
+  1,192,45,5,1,202,251,5,1,193,85,5,1,194,228,5,1,56,5,1,192,80,5,1,
+  200,250,5,1,53,5,1,197,135,5,1,205,240,5,1,199,204,5,1,46,0,6,192,54,
+  52,192,62,16,1,193,219,5,1,228,111,5,1,192,103,5,1,205,249,5,2,16,228,112,
+  0,3,192,21,194,21,1,1,1,192,168,1,1,193,121,1,2,14,115,2,1,85,2,1,
+  78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,0,3,192,21,14,54,2,1,
+  192,33,1,2,51,192,168,2,1,193,121,1,2,196,133,195,146,1,2,199,218,1,1,2,
+  0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,2,1,193,2,2,1,
+  192,107,2,1,192,142,2,1,191,2,1,192,220,0,3,192,21,0,193,25,2,1,192,232,
+  2,1,56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,2,1,192,
+  102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,195,197,2,1,167,2,1,
+  205,197,0,3,192,21,0,173,2,1,192,95,2,1,205,198,2,1,196,103,2,1,192,251,
+  2,1,192,145,2,1,205,199,2,1,53,2,1,150,2,1,192,195,2,1,154,2,1,195,
+  122,2,1,182,2,1,192,101,2,1,193,33,2,1,180,0,3,192,21,0,192,167,2,1,
+  192,214,2,1,193,12,2,1,46,2,1,192,103,2,2,192,234,192,203,2,2,123,112,3,
+  1,193,73,3,1,98,3,1,193,34,2,1,192,109,2,1,176,1,1,194,186,1,2,200,
+  184,42,1,2,195,123,42,1,1,228,113,0,3,192,21,1,192,203,2,1,194,92,2,1,
+  193,82,2,2,50,192,203,2,1,196,142,2,1,193,191,2,1,196,143,2,1,193,20,2,
+  1,193,47,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,58,3,
+  1,192,80,3,1,53,0,4,192,21,16,1,46,3,1,192,103,3,2,123,112,4,1,193,
+  73,4,1,98,4,1,193,34,0,2,201,13,39,1,1,37,0,1,205,250,0,2,228,114,
+  195,79,0,3,197,214,2,228,115,0,1,228,116,0,5,192,165,31,51,59,38,2,3,171,
+  199,120,136,3,2,139,136,3,2,135,136,0,5,192,165,31,171,194,134,136,2,2,199,33,
+  42,2,3,192,114,139,136,3,2,135,136,3,2,194,134,136,1,1,192,168,1,1,228,117,
+  1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,
+  65,2,1,54,0,3,192,165,14,192,33,1,2,228,118,1,1,2,193,170,42,1,3,139,
+  136,195,111,1,1,228,119,1,2,0,20,2,1,192,32,2,1,192,142,2,1,191,2,1,
+  228,120,2,1,56,2,1,193,13,2,1,193,18,2,1,200,237,2,1,129,2,1,58,0,
+  3,192,165,0,192,102,2,2,201,14,192,142,3,1,192,102,3,1,154,2,1,90,2,1,
+  170,2,1,167,2,1,152,2,1,173,3,1,205,251,2,1,192,145,3,1,205,251,2,1,
+  53,2,1,192,233,2,1,150,2,1,154,0,3,192,165,0,194,6,2,1,182,2,1,180,
+  2,1,46,2,1,192,109,2,1,176,1,3,135,136,195,111,1,2,11,228,121,2,2,192,
+  233,228,122,1,2,228,123,1,0,2,193,28,228,124,1,1,200,214,2,1,1,1,2,197,
+  102,228,125,1,4,49,195,93,195,131,11,1,1,228,126,0,2,193,28,228,127,1,2,205,
+  252,11,0,2,201,10,193,242,0,3,228,128,14,205,243,0,2,228,129,1,0,2,228,130,
+  194,212,0,3,228,131,194,146,11,0,1,228,132,0,1,194,166,0,3,228,133,42,1,0,
+  3,195,66,195,224,74,3,3,192,26,164,66,0,6,188,192,157,24,192,50,192,196,27,2,
+  1,27,3,4,24,192,50,192,157,27,3,4,193,95,188,192,196,27,0,7,188,192,157,27,
+  193,95,192,50,192,157,27,3,2,2,82,2,2,55,27,2,2,51,27,2,2,192,89,195,
+  246,3,1,193,238,3,2,195,155,193,238,2,2,48,27,2,2,192,92,27,4,2,66,119,
+  2,2,63,27,1,4,192,91,192,14,49,193,46,4,1,110,4,1,193,49,4,1,196,129,
+  3,2,65,194,135,0,5,188,192,91,192,14,65,198,216,2,2,200,184,42,2,2,228,134,
+  42,2,2,193,49,42,2,2,195,186,42,1,5,192,196,24,192,50,192,157,27,2,1,27,
+  3,4,24,188,192,157,27,3,4,193,95,188,192,157,27,3,2,66,193,56,4,2,171,119,
+  3,2,2,82,2,2,55,27,2,2,51,27,2,2,192,89,195,246,3,1,193,238,0,5,
+  188,192,196,192,89,195,155,193,238,2,2,48,27,2,2,192,92,27,4,2,66,119,2,2,
+  63,27,0,2,228,135,195,171,0,1,195,32,0,4,192,146,20,193,181,74,2,2,193,182,
+  74,1,3,194,85,164,66,1,3,193,53,194,200,74,1,3,202,56,164,66,1,2,194,145,
+  42,1,2,164,66,1,2,194,132,66,1,1,192,172,0,3,192,146,198,183,66,1,1,192,
+  173,1,3,195,66,195,224,74,4,3,192,26,164,66,1,2,195,61,66,1,1,1,1,6,
+  43,195,112,74,192,26,164,66,2,5,197,176,74,192,26,164,66,1,1,184,1,1,201,15,
+  0,6,195,78,39,197,7,2,65,140,1,5,107,198,172,63,91,27,1,5,37,197,7,2,
+  65,140,1,5,113,198,172,63,91,27,0,1,193,165,1,1,197,119,0,2,193,165,195,79,
+  0,1,205,253,1,3,2,228,136,199,114,0,4,29,195,131,192,209,192,104,1,3,194,237,
+  192,209,192,104,1,3,195,10,192,209,192,104,1,3,195,218,192,209,192,104,1,3,195,219,
+  192,209,192,104,1,3,195,220,192,209,192,104,1,1,1,1,3,195,54,192,209,192,104,1,
+  3,192,66,192,209,192,104,1,3,195,221,192,209,192,104,1,3,194,124,192,209,192,104,1,
+  3,192,224,192,209,192,104,0,2,228,137,1,0,3,228,138,195,156,42,0,3,205,254,24,
+  199,250,0,5,192,122,192,123,89,45,192,107,3,2,14,115,4,1,85,4,1,78,4,1,
+  133,4,1,49,4,1,128,4,1,117,4,1,65,4,1,54,4,1,192,33,3,2,0,20,
+  4,1,192,45,4,1,192,107,0,5,192,122,192,123,89,0,191,4,1,198,36,4,1,56,
+  4,1,193,13,4,1,193,18,4,1,192,3,4,1,129,4,1,165,4,1,58,4,1,90,
+  4,1,170,4,1,167,4,1,205,142,4,1,173,4,1,228,139,4,1,228,140,0,5,192,
+  122,192,123,89,0,228,141,4,1,228,142,4,1,228,143,4,1,199,144,4,1,228,144,4,
+  1,228,145,4,1,228,146,4,1,192,145,4,1,53,4,1,192,233,4,1,150,4,1,198,
+  211,4,1,194,11,4,1,154,4,1,194,6,4,1,182,0,5,192,122,192,123,89,0,180,
+  4,1,193,123,4,1,228,147,4,1,46,4,1,192,194,4,1,192,77,4,1,194,129,4,
+  1,204,134,4,1,176,4,1,192,221,3,2,195,174,228,148,3,3,1,40,228,149,5,1,
+  228,150,5,1,196,4,5,1,193,232,5,1,228,151,0,6,192,122,192,123,89,1,200,98,
+  200,98,3,2,4,197,203,3,1,228,152,3,1,228,153,3,1,228,154,3,1,228,155,3,
+  1,228,156,3,1,228,157,3,1,228,158,0,3,228,159,205,255,192,28,0,4,194,77,192,
+  156,196,76,116,3,1,96,1,1,194,212,0,3,228,160,195,63,11,0,4,195,38,228,161,
+  74,194,145,1,2,195,35,228,162,0,3,195,38,196,139,196,153,1,3,200,191,199,115,205,
+  47,1,1,203,85,1,3,228,163,201,86,29,1,1,193,21,1,2,51,196,20,1,1,198,
+  133,1,1,82,1,2,192,143,198,133,0,2,228,164,1,0,1,228,165,0,1,228,166,0,
+  2,200,116,197,64,0,3,193,140,198,130,42,1,2,0,228,167,2,1,228,168,0,3,193,
+  140,0,228,169,2,1,228,170,2,1,228,171,2,1,228,172,2,1,228,173,2,1,228,174,
+  2,1,228,175,2,1,228,176,2,1,228,177,2,1,228,178,2,1,228,179,2,1,228,180,
+  2,1,228,181,2,1,228,182,2,1,202,195,2,1,192,26,0,3,193,140,0,228,183,2,
+  1,228,184,2,1,228,185,2,1,228,186,2,1,228,187,2,1,228,188,2,1,228,189,2,
+  1,195,136,1,3,192,56,198,130,42,1,2,193,242,42,0,1,194,125,0,2,198,184,1,
+  0,2,197,215,196,204,0,3,198,129,193,105,1,0,3,192,231,192,236,228,190,2,2,14,
+  115,0,4,192,231,192,236,14,85,3,1,78,3,1,133,3,1,49,3,1,128,3,1,117,
+  3,1,65,3,1,54,3,1,192,33,2,2,228,191,206,0,2,2,0,228,192,3,1,228,
+  193,3,1,228,194,3,1,228,195,3,1,198,217,3,1,194,75,0,4,192,231,192,236,0,
+  194,185,3,1,193,160,3,1,228,196,3,1,192,188,3,1,198,233,3,1,198,221,3,1,
+  199,137,3,1,228,197,3,1,197,60,3,1,196,166,3,1,170,3,1,197,76,3,1,192,
+  226,3,1,192,149,3,1,194,10,3,1,193,174,0,4,192,231,192,236,0,228,198,3,1,
+  197,34,3,1,228,199,3,1,206,1,3,1,198,234,3,1,193,150,3,1,202,196,3,1,
+  205,249,2,2,193,31,228,200,2,2,228,201,206,0,2,1,228,202,2,3,192,4,51,206,
+  2,3,1,206,2,2,1,228,203,0,4,36,195,90,82,42,2,2,195,156,42,0,5,36,
+  181,5,0,20,4,1,192,45,4,1,196,179,4,1,206,3,4,1,24,4,2,200,12,56,
+  4,1,56,4,1,199,227,4,1,197,177,4,1,196,114,4,1,206,4,4,1,206,5,4,
+  1,193,13,4,1,195,52,4,1,206,6,4,1,206,7,0,5,36,181,5,0,195,49,4,
+  1,206,8,4,1,196,219,4,1,193,216,4,1,206,9,4,1,194,49,4,1,206,10,4,
+  1,192,188,4,1,198,235,4,1,198,236,4,2,206,11,1,4,1,196,238,4,1,198,233,
+  4,1,194,118,4,1,195,21,4,1,206,12,0,5,36,181,5,0,194,177,4,1,206,13,
+  4,1,201,16,4,1,197,178,4,1,206,14,4,1,58,4,1,192,80,4,2,198,237,193,
+  4,5,1,193,219,4,1,53,4,1,206,15,4,1,192,233,4,2,198,238,193,4,5,1,
+  193,219,4,2,192,114,194,118,4,1,46,0,5,36,181,5,0,206,16,4,1,198,83,4,
+  1,192,103,2,2,29,193,68,3,1,85,3,1,49,4,1,134,4,1,169,3,1,192,66,
+  2,3,3,0,20,4,1,192,45,4,1,196,179,4,1,206,3,4,1,24,4,2,200,12,
+  56,4,1,56,0,5,36,181,3,0,199,227,4,1,197,177,4,1,196,114,4,1,206,4,
+  4,1,206,5,4,1,193,13,4,1,195,52,4,1,206,6,4,1,206,7,4,1,195,49,
+  4,1,206,8,4,1,196,219,4,1,193,216,4,1,206,9,4,1,194,49,4,1,206,10,
+  0,5,36,181,3,0,192,188,4,1,198,235,4,1,198,236,4,2,206,11,1,4,1,196,
+  238,4,1,198,233,4,1,194,118,4,1,195,21,4,1,206,12,4,1,194,177,4,1,206,
+  13,4,1,201,16,4,1,197,178,4,1,206,14,4,1,58,4,1,192,80,0,6,36,181,
+  3,0,198,237,193,4,5,1,193,219,4,1,53,4,1,206,15,4,1,192,233,4,2,198,
+  238,193,4,5,1,193,219,4,2,192,114,194,118,4,1,46,4,1,206,16,4,1,198,83,
+  4,1,192,103,1,3,44,0,20,3,1,194,113,3,1,193,209,3,1,193,227,0,4,36,
+  44,0,56,3,1,195,52,3,1,228,204,3,1,193,216,3,1,194,49,3,1,192,188,3,
+  1,194,118,3,1,228,205,3,1,195,21,3,1,194,29,3,1,228,206,3,1,193,19,3,
+  1,58,3,1,192,80,3,1,90,3,1,193,250,0,4,36,44,0,199,172,3,1,193,230,
+  3,2,202,156,194,156,3,1,53,3,1,192,238,3,1,200,107,3,1,192,246,3,2,202,
+  158,194,156,3,1,193,54,3,1,193,1,3,1,46,3,1,192,103,3,1,194,63,3,1,
+  194,91,3,1,193,229,2,2,192,90,193,68,0,4,36,44,192,90,85,3,1,49,3,1,
+  192,66,1,1,195,110,1,4,188,192,155,0,192,252,4,1,118,4,1,192,253,4,1,193,
+  91,4,1,194,19,4,1,228,207,4,1,228,208,4,1,228,209,4,1,193,44,4,1,228,
+  210,4,1,193,173,4,1,165,0,5,36,188,192,155,0,192,225,4,1,192,219,4,1,192,
+  134,4,1,192,105,4,1,88,4,1,192,133,4,1,193,62,4,1,193,45,4,1,193,78,
+  4,1,193,26,4,1,192,202,4,1,195,179,4,1,193,202,4,1,193,11,4,1,92,4,
+  1,194,150,0,5,36,188,192,155,0,194,88,3,2,29,49,4,1,192,66,4,1,192,224,
+  1,3,193,7,0,193,53,3,1,195,144,3,1,228,211,3,1,203,156,3,1,228,212,3,
+  1,228,213,3,1,56,3,1,195,52,3,1,228,214,3,1,129,3,1,58,3,1,198,222,
+  0,4,36,193,7,0,194,71,3,1,228,215,3,1,228,216,3,1,228,217,3,1,203,157,
+  3,1,53,3,1,192,233,3,1,228,218,3,1,228,219,3,1,228,220,3,1,228,221,3,
+  1,197,85,3,1,52,3,1,228,222,3,1,46,3,1,228,223,0,4,36,193,7,0,228,
+  224,3,1,176,3,1,195,135,3,1,197,122,3,1,198,80,3,1,195,22,3,1,228,225,
+  3,1,193,27,3,1,198,82,3,1,228,226,1,3,192,208,29,134,3,1,49,3,1,192,
+  66,3,1,192,224,3,1,54,2,2,1,20,0,4,36,192,208,1,228,227,3,1,228,228,
+  3,1,228,229,3,1,192,32,3,1,228,230,3,1,228,231,3,1,192,107,3,1,191,3,
+  1,228,232,3,1,228,233,3,1,194,24,3,1,194,25,3,1,193,18,3,1,192,3,3,
+  1,194,65,3,1,129,0,4,36,192,208,1,58,3,1,192,102,3,1,195,190,3,1,90,
+  3,1,193,230,3,1,170,3,1,167,3,1,193,119,3,1,193,31,3,1,173,3,1,193,
+  92,3,1,150,3,1,154,3,1,193,217,3,1,182,3,1,192,101,0,4,36,192,208,1,
+  193,33,3,1,180,3,1,192,167,3,1,193,190,3,1,46,3,1,192,194,3,1,195,108,
+  3,1,194,129,3,1,228,234,3,1,176,3,1,192,221,2,2,193,215,196,176,1,2,206,
+  17,200,81,1,4,192,60,192,14,49,110,2,2,0,194,68,3,2,193,24,194,235,0,4,
+  36,192,60,0,194,235,3,1,194,69,3,2,50,194,68,4,1,194,69,4,1,193,19,4,
+  1,192,177,5,3,2,83,192,169,4,1,194,103,5,3,2,83,192,169,4,1,194,70,5,
+  3,2,83,192,169,3,1,194,95,3,1,193,19,3,1,194,121,3,1,194,96,3,1,194,
+  122,0,4,36,192,60,0,194,26,3,1,192,177,3,1,192,238,3,1,228,235,3,1,194,
+  103,3,1,194,97,3,1,193,86,3,1,194,70,3,1,193,11,3,1,194,123,3,1,194,
+  159,2,2,32,228,236,2,2,29,85,3,1,78,3,1,49,4,1,134,0,4,36,192,60,
+  29,192,66,3,1,193,117,3,1,65,3,1,192,224,3,1,54,1,4,192,50,192,155,0,
+  118,4,1,204,254,4,1,194,69,4,1,195,58,4,1,228,237,4,1,228,238,4,1,194,
+  213,4,1,228,239,4,1,194,95,4,1,193,19,4,1,194,121,0,5,36,192,50,192,155,
+  0,194,96,4,1,228,240,4,1,194,122,4,1,194,26,4,1,192,177,4,1,195,240,4,
+  1,194,192,4,1,194,103,4,1,194,97,4,1,201,17,4,1,193,86,4,1,194,70,4,
+  1,195,28,4,1,228,241,4,1,228,242,4,1,193,11,0,5,36,192,50,192,155,0,194,
+  123,4,1,204,255,3,2,29,193,68,4,1,49,3,2,175,193,88,1,4,192,110,0,193,
+  17,20,4,1,193,254,4,1,196,62,4,1,206,18,4,1,228,243,4,1,206,19,4,1,
+  206,20,4,1,228,244,4,1,196,211,4,1,228,245,4,1,228,246,0,5,36,192,110,0,
+  193,17,206,21,4,1,206,22,4,1,198,217,4,1,194,75,4,1,193,53,4,1,197,162,
+  4,1,200,229,4,1,194,151,4,1,192,189,4,1,193,160,4,1,194,228,4,1,228,247,
+  4,1,197,177,4,1,228,248,4,1,194,49,4,1,198,235,0,5,36,192,110,0,193,17,
+  194,227,4,1,198,236,4,1,196,238,4,1,198,233,4,1,194,29,4,1,197,178,4,1,
+  58,4,1,201,11,4,1,201,18,4,1,53,4,1,193,4,4,1,206,23,4,1,201,19,
+  4,1,201,20,4,1,198,107,3,2,193,112,20,0,5,36,192,110,0,193,112,193,254,4,
+  1,196,62,4,1,193,85,4,1,206,18,4,1,206,19,4,1,206,20,4,1,196,211,4,
+  1,228,249,4,1,206,21,4,1,206,22,4,1,198,217,4,1,194,75,4,1,194,185,4,
+  1,197,162,4,1,200,229,4,1,192,189,0,5,36,192,110,0,193,112,193,160,4,1,194,
+  228,4,1,56,4,1,197,177,4,1,198,235,4,1,198,236,4,1,196,238,4,1,194,29,
+  4,1,197,178,4,1,58,4,1,201,18,4,1,193,4,4,1,206,23,4,1,201,20,1,
+  4,193,188,31,59,38,4,1,57,0,6,36,193,188,31,54,140,38,5,1,57,2,2,0,
+  194,68,3,1,194,69,3,2,50,194,121,3,1,228,250,3,1,194,96,3,1,194,122,3,
+  1,206,24,3,1,194,26,3,1,192,177,3,1,192,238,3,1,194,192,3,1,194,103,3,
+  1,194,97,3,1,193,86,0,4,36,193,188,0,194,70,3,1,193,11,3,1,194,123,3,
+  1,194,159,2,2,192,4,119,3,2,78,140,3,2,54,197,6,4,1,140,0,2,201,21,
+  201,96,1,1,193,233,1,1,195,250,0,1,205,147,0,2,194,186,11,0,9,192,135,2,
+  193,170,42,2,39,37,27,38,0,2,197,179,202,57,1,1,199,147,0,3,197,179,195,1,
+  204,154,1,2,198,239,195,201,1,1,206,25,0,3,49,196,136,196,85,1,2,59,201,22,
+  2,4,145,54,140,192,4,0,2,228,251,228,252,0,1,228,253,0,2,177,196,138,1,1,
+  100,1,2,192,147,192,245,2,2,55,192,171,2,1,192,211,2,2,196,75,192,245,1,2,
+  197,89,196,36,1,1,196,36,0,3,177,195,133,1,1,1,198,77,1,4,198,78,2,203,
+  143,194,224,3,2,193,79,194,224,1,1,193,181,1,1,193,182,0,3,206,26,228,254,11,
+  1,2,228,255,11,0,3,229,0,91,27,0,1,229,1,0,1,200,174,0,2,206,27,192,
+  229,2,1,200,122,0,2,229,2,195,110,0,4,192,26,2,59,194,18,0,2,196,225,196,
+  138,0,2,196,225,193,118,0,1,229,3,0,2,197,176,74,0,4,192,40,192,74,194,116,
+  42,1,3,192,98,194,116,42,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,
+  2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,3,192,14,49,193,46,0,
+  4,192,40,192,14,49,110,3,1,193,49,3,1,196,129,2,2,65,194,135,3,1,198,216,
+  1,1,202,167,1,2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,
+  2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,0,3,192,40,0,
+  193,25,2,1,192,232,2,1,56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,
+  1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,193,
+  154,2,1,167,2,1,173,0,3,192,40,0,192,95,2,1,192,251,2,1,192,145,2,1,
+  53,2,1,150,2,1,192,195,2,1,154,2,1,195,122,2,1,194,6,2,1,182,2,1,
+  192,101,2,1,193,33,2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,0,3,192,
+  40,0,46,2,1,192,103,2,1,192,194,2,2,123,112,3,1,193,73,3,1,98,3,1,
+  193,34,2,1,192,109,2,1,176,2,1,198,5,1,2,1,192,203,2,1,194,92,2,1,
+  193,82,2,1,193,191,2,1,195,202,2,1,193,20,0,3,192,40,1,193,47,1,3,16,
+  1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,58,3,1,192,80,3,1,53,
+  3,1,46,3,1,192,103,3,2,123,112,4,1,193,73,4,1,98,4,1,193,34,0,3,
+  206,28,39,192,247,1,2,37,192,247,0,2,229,4,192,211,0,4,192,117,5,0,20,3,
+  1,194,226,3,1,192,74,3,1,192,252,3,1,206,29,3,1,192,142,3,1,192,232,3,
+  1,56,3,1,206,30,3,1,206,31,3,1,206,32,3,1,206,33,3,1,206,34,3,1,
+  206,35,3,1,192,239,0,4,192,117,5,0,129,3,1,206,36,3,1,58,3,1,90,3,
+  1,192,144,3,1,200,105,3,1,170,3,1,167,3,1,173,3,1,53,3,1,206,37,3,
+  1,150,3,1,182,3,1,192,101,3,1,180,3,1,193,123,0,4,192,117,5,0,194,140,
+  3,1,46,3,1,192,109,3,1,192,221,3,1,193,236,1,3,3,0,20,3,1,194,226,
+  3,1,192,74,3,1,192,252,3,1,206,29,3,1,192,142,3,1,192,232,3,1,56,3,
+  1,206,30,3,1,206,31,3,1,206,32,0,4,192,117,3,0,206,33,3,1,206,34,3,
+  1,206,35,3,1,192,239,3,1,129,3,1,206,36,3,1,58,3,1,90,3,1,192,144,
+  3,1,200,105,3,1,170,3,1,167,3,1,173,3,1,53,3,1,206,37,3,1,150,0,
+  4,192,117,3,0,182,3,1,192,101,3,1,180,3,1,193,123,3,1,194,140,3,1,46,
+  3,1,192,109,3,1,192,221,3,1,193,236,0,3,193,38,14,115,2,1,85,2,1,78,
+  2,1,133,2,1,49,2,1,128,2,1,117,0,3,193,38,14,65,2,1,54,2,1,192,
+  33,1,2,0,20,2,1,192,45,2,1,118,2,1,192,32,2,1,203,78,2,1,229,5,
+  2,1,192,232,2,1,56,2,1,193,13,2,1,193,18,2,1,192,3,2,1,129,2,1,
+  58,0,3,193,38,0,192,102,2,1,206,38,2,1,192,144,2,1,229,6,2,1,229,7,
+  2,1,229,8,2,1,53,2,1,192,233,2,1,199,32,2,1,154,2,1,182,2,1,229,
+  9,2,1,180,2,1,46,2,1,193,11,2,1,194,129,0,3,193,38,0,176,0,1,229,
+  10,0,5,192,170,146,193,24,29,115,4,1,85,4,1,78,5,1,134,4,1,133,4,1,
+  128,4,1,117,5,1,134,4,1,192,66,5,1,169,4,1,65,4,1,54,5,1,169,2,
+  3,192,14,49,110,0,5,192,170,146,192,14,49,200,51,2,1,229,11,2,2,29,115,4,
+  1,134,4,1,169,3,1,194,110,4,1,169,3,1,193,68,4,1,169,3,1,85,4,1,
+  134,4,1,169,3,1,193,153,4,1,169,3,1,78,4,1,134,0,5,192,170,146,29,78,
+  169,3,1,133,4,1,134,4,1,169,3,1,193,41,4,1,169,3,1,49,4,1,134,4,
+  1,169,3,1,128,4,1,134,4,1,169,3,1,193,77,4,1,169,3,1,117,4,1,134,
+  0,5,192,170,146,29,117,169,3,1,194,61,4,1,169,3,1,192,66,4,1,169,3,1,
+  193,117,4,1,169,3,1,65,4,1,134,4,1,169,3,1,192,224,4,1,169,3,1,54,
+  4,1,134,4,1,169,0,2,201,104,1,0,2,229,12,205,52,0,3,196,74,55,192,171,
+  1,2,33,192,211,1,2,7,192,211,1,2,63,192,171,0,2,229,13,104,0,1,201,23,
+  0,3,197,148,55,198,240,1,4,63,24,55,198,240,2,1,198,240,0,1,195,202,0,1,
+  229,14,0,1,198,241,0,1,229,15,0,1,229,16,0,1,195,79,0,3,195,79,197,132,
+  96,1,3,2,45,195,113,2,1,193,244,0,1,229,17,0,1,204,99,0,1,229,18,0,
+  5,148,89,194,14,1,229,19,4,1,229,20,4,1,229,21,4,1,229,22,4,1,197,75,
+  4,1,229,23,4,1,229,24,4,1,229,25,4,1,229,26,4,1,229,27,0,5,148,89,
+  194,14,1,229,28,4,1,229,29,4,1,229,30,4,1,229,31,4,1,229,32,4,1,229,
+  33,4,1,229,34,4,1,201,24,4,1,229,35,2,2,192,49,192,98,3,1,229,36,3,
+  1,229,37,3,1,192,180,3,1,229,38,3,1,229,39,3,1,229,40,0,4,148,89,192,
+  49,229,41,3,1,229,42,3,1,229,43,3,1,229,44,3,1,229,45,3,1,229,46,3,
+  1,229,47,3,1,229,48,3,1,229,49,3,1,229,50,3,1,229,51,3,1,229,52,3,
+  1,229,53,2,2,14,115,3,1,85,3,1,78,0,4,148,89,14,133,3,1,49,3,1,
+  128,3,1,117,3,1,65,3,1,54,3,1,192,33,2,3,42,194,105,229,54,4,1,229,
+  55,4,1,229,56,4,1,193,180,4,1,229,57,4,1,229,58,4,1,229,59,2,3,29,
+  134,196,54,3,1,199,123,0,4,148,89,29,196,54,3,2,192,66,229,60,4,1,195,181,
+  3,1,195,24,3,1,229,61,2,2,1,196,167,3,2,194,105,229,62,4,2,229,63,229,
+  64,4,4,229,65,229,66,206,39,206,39,4,2,229,67,229,68,4,2,229,69,229,70,4,
+  2,229,71,201,25,4,1,206,40,5,1,229,72,3,1,201,26,3,1,229,73,0,5,148,
+  89,1,200,63,206,41,3,1,229,74,3,2,206,42,229,75,4,1,229,76,3,1,229,77,
+  3,1,229,78,3,1,229,79,3,1,194,50,3,2,229,80,201,26,3,2,229,81,229,82,
+  3,2,196,87,229,83,4,1,229,84,4,1,229,85,4,1,229,86,4,1,229,87,4,1,
+  229,88,0,6,148,89,1,196,87,229,89,229,90,3,1,229,91,3,1,229,92,3,2,198,
+  242,229,93,4,1,229,94,4,1,193,144,4,1,229,95,3,1,229,96,3,2,229,97,229,
+  98,2,2,16,229,99,3,1,229,100,3,1,203,205,3,1,229,101,3,1,229,102,3,1,
+  229,103,3,1,229,104,0,4,148,89,16,229,105,3,1,229,106,3,1,229,107,3,1,229,
+  108,3,1,229,109,3,1,229,110,3,1,229,111,3,1,229,112,3,1,229,113,3,1,229,
+  114,3,1,229,115,3,1,229,116,3,1,229,117,3,1,229,118,3,1,229,119,3,1,229,
+  120,0,4,148,89,16,229,121,3,1,229,122,3,1,229,123,3,1,229,124,3,1,229,125,
+  0,1,229,126,0,2,196,209,200,191,1,2,116,193,105,1,1,195,59,1,2,96,193,105,
+  0,3,229,127,96,198,180,0,3,193,102,194,8,200,231,1,2,0,194,68,2,1,194,235,
+  2,1,194,69,2,1,195,58,0,4,193,102,0,50,192,177,2,1,194,95,2,1,193,19,
+  2,1,194,121,2,1,194,96,2,1,194,122,2,1,194,26,2,1,192,177,2,1,192,238,
+  2,1,195,240,2,1,194,192,2,1,194,103,2,1,194,97,2,1,193,86,2,1,194,70,
+  2,1,195,28,0,3,193,102,0,193,11,2,1,194,123,2,1,194,159,1,2,29,85,2,
+  1,78,2,1,49,2,1,192,66,2,1,65,2,1,192,224,2,1,54,1,2,193,206,200,
+  231,0,1,229,128,0,2,229,129,104,0,1,229,130,0,1,229,131,0,2,197,121,193,171,
+  0,1,200,126,0,2,229,132,42,0,2,195,61,66,1,3,2,172,71,2,2,184,192,242,
+  0,3,132,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,
+  1,65,2,1,54,1,2,28,195,204,3,1,20,0,3,132,28,195,129,3,1,20,3,1,
+  46,2,1,195,205,3,1,20,2,1,195,130,3,1,20,2,1,195,206,3,1,20,2,1,
+  195,207,3,1,20,2,1,195,208,3,1,20,2,1,195,209,3,1,20,2,1,195,210,0,
+  4,132,28,195,210,20,2,1,195,211,3,1,20,2,1,195,212,3,1,20,2,1,195,213,
+  3,1,20,2,1,195,214,3,1,20,2,1,195,215,3,1,20,1,2,192,36,203,112,2,
+  1,199,109,2,1,203,113,2,1,194,84,2,1,115,0,3,132,192,36,203,114,2,1,229,
+  133,2,1,203,115,2,1,195,1,2,1,85,2,1,78,2,1,203,116,2,1,203,118,2,
+  1,203,119,2,1,193,128,2,1,195,217,2,1,133,2,1,49,2,1,206,43,2,1,229,
+  134,2,1,203,121,0,3,132,192,36,194,47,2,1,205,74,2,1,128,2,1,117,2,1,
+  203,122,2,1,203,123,2,1,199,243,2,1,203,124,2,1,194,94,2,1,203,125,2,1,
+  192,66,2,1,65,2,1,54,2,1,194,146,2,1,199,244,1,4,197,95,192,28,53,194,
+  158,0,4,132,197,95,192,28,229,135,1,4,7,5,0,20,4,1,62,4,1,192,52,4,
+  1,192,20,4,1,56,4,1,192,113,4,1,192,2,4,1,192,18,4,1,58,4,1,192,
+  83,4,1,192,6,4,1,112,4,1,178,4,1,152,4,1,53,0,5,132,7,5,0,192,
+  58,4,1,192,175,4,1,98,4,1,99,4,1,192,5,4,1,46,4,1,192,9,4,1,
+  192,77,4,1,192,57,4,1,192,35,4,1,192,27,2,3,3,0,20,4,1,62,4,1,
+  192,52,4,1,192,20,4,1,56,0,5,132,7,3,0,192,113,4,1,192,2,4,1,192,
+  18,4,1,58,4,1,192,83,4,1,192,6,4,1,112,4,1,178,4,1,152,4,1,53,
+  4,1,192,58,4,1,192,175,4,1,98,4,1,99,4,1,192,5,4,1,46,0,5,132,
+  7,3,0,192,9,4,1,192,77,4,1,192,57,4,1,192,35,4,1,192,27,1,2,29,
+  195,131,2,1,194,237,2,1,195,10,2,1,195,218,2,1,195,219,2,1,195,220,2,1,
+  195,54,2,1,192,66,2,1,195,221,2,1,194,124,2,1,192,224,0,1,229,136,0,3,
+  200,123,229,137,42,0,2,196,231,196,232,0,3,229,138,198,243,11,0,2,206,44,1,0,
+  2,200,119,229,139,0,2,229,140,11,0,2,229,141,201,27,0,2,229,142,11,0,2,229,
+  143,11,0,2,229,144,196,169,0,5,192,184,192,185,192,180,193,74,192,104,5,1,50,5,
+  1,193,96,3,2,0,20,4,1,192,32,0,5,192,184,192,185,192,180,0,192,107,4,1,
+  192,142,4,1,191,4,1,56,4,1,193,18,4,2,50,192,6,5,1,112,5,1,178,5,
+  1,152,5,1,194,3,5,1,192,58,5,1,192,5,5,1,192,77,5,1,192,35,4,1,
+  192,3,4,1,129,0,5,192,184,192,185,192,180,0,58,4,1,198,222,4,1,90,4,1,
+  192,144,4,1,170,4,1,167,4,1,173,4,1,192,95,4,1,53,4,1,150,4,1,192,
+  195,4,1,154,4,1,182,4,1,180,4,1,192,167,4,1,46,0,5,192,184,192,185,192,
+  180,0,196,175,4,1,192,194,4,1,192,221,3,2,198,244,136,5,1,50,5,1,171,6,
+  1,50,3,2,201,28,136,5,1,50,5,2,171,50,3,2,194,134,136,5,1,50,5,1,
+  171,6,1,50,3,3,195,123,193,74,192,104,6,1,50,0,5,192,184,192,185,192,180,195,
+  123,136,5,1,50,5,1,171,6,1,50,0,2,200,4,229,145,0,2,200,94,11,0,1,
+  229,146,0,1,229,147,0,1,229,148,0,1,229,149,0,1,206,45,0,4,196,124,145,206,
+  46,195,118,0,1,198,213,0,1,229,150,0,2,229,151,104,0,1,198,185,0,2,202,146,
+  205,43,0,3,197,33,202,45,1,1,1,1,1,3,192,66,169,1,0,2,197,30,1,0,
+  2,229,152,205,163,0,3,229,153,198,243,1,0,1,199,247,1,2,2,99,0,2,229,154,
+  104,0,3,193,232,229,155,229,156,1,1,229,157,1,2,229,158,229,159,1,1,198,136,1,
+  3,192,158,198,21,196,239,2,2,229,160,229,161,0,6,193,232,204,253,206,47,195,133,192,
+  158,229,162,1,2,2,194,218,2,2,229,163,196,77,2,1,203,184,2,2,229,164,195,133,
+  2,1,229,165,2,2,201,29,104,0,2,206,17,200,81,0,1,229,166,0,2,229,167,1,
+  0,2,206,48,1,0,2,229,168,193,221,0,4,192,193,51,193,146,42,1,2,0,20,2,
+  2,193,24,176,2,2,229,169,193,18,0,3,192,193,0,192,32,2,1,192,107,2,1,193,
+  82,2,1,192,142,2,1,191,2,1,192,220,2,1,194,189,2,1,56,2,1,193,13,2,
+  1,193,18,2,1,192,3,2,1,196,203,2,1,129,2,1,58,2,1,192,102,2,1,90,
+  0,3,192,193,0,192,144,2,1,170,2,1,167,2,1,173,2,1,192,95,2,1,192,251,
+  2,1,192,145,2,1,53,2,1,150,2,1,192,195,2,1,194,11,2,1,154,2,1,182,
+  2,1,192,101,2,2,3,20,2,1,180,0,3,192,193,0,192,167,2,1,193,123,2,1,
+  194,140,2,1,192,214,2,1,193,12,2,1,46,2,2,195,65,129,2,2,229,170,192,101,
+  2,1,192,109,2,1,194,129,2,1,176,2,1,192,221,2,1,193,236,1,3,42,51,194,
+  104,2,1,194,104,1,3,192,76,193,146,42,0,4,192,193,192,61,0,154,3,1,192,109,
+  3,1,176,1,3,229,171,0,154,0,4,192,250,192,229,1,27,3,1,196,201,3,1,229,
+  172,3,1,202,192,3,1,196,139,3,2,229,173,194,15,3,1,229,174,3,2,203,77,206,
+  49,3,1,194,191,3,1,199,235,3,1,199,127,3,1,229,175,0,4,192,250,192,229,1,
+  229,176,3,3,31,194,77,71,3,1,229,177,3,1,204,23,3,1,204,34,3,1,205,70,
+  3,1,229,178,3,1,229,179,3,1,198,179,3,1,229,180,3,1,193,83,3,1,205,72,
+  3,1,229,181,3,1,229,182,3,1,229,183,3,2,198,241,194,215,0,4,192,250,192,229,
+  1,229,184,3,1,206,45,3,2,206,49,195,59,3,2,229,185,193,146,3,1,198,71,3,
+  1,199,131,3,1,199,223,3,1,199,128,3,1,201,27,3,1,229,186,3,2,3,199,69,
+  3,1,229,187,3,2,229,188,193,146,3,1,229,189,3,1,229,190,3,1,195,155,0,5,
+  192,250,192,229,1,195,4,229,191,3,1,195,250,0,3,206,50,51,192,4,1,2,192,76,
+  192,4,0,3,193,141,0,192,252,2,1,229,192,2,1,196,132,2,1,229,193,2,1,229,
+  194,2,1,193,19,2,1,205,11,2,1,192,219,2,1,229,195,2,1,194,26,2,1,192,
+  177,2,1,192,238,0,3,193,141,0,200,166,2,1,229,196,2,1,206,51,2,1,229,197,
+  2,1,193,86,2,1,194,50,2,1,196,28,2,1,200,44,2,1,195,84,2,1,229,198,
+  1,2,29,49,3,1,134,2,1,192,66,2,1,65,2,1,192,224,2,1,54,0,3,193,
+  141,193,215,193,171,0,1,229,199,0,1,204,204,0,2,229,200,199,135,0,1,206,52,0,
+  1,198,186,1,1,104,1,1,195,32,0,2,206,53,1,0,3,229,201,74,197,81,0,1,
+  229,202,0,1,229,203,0,2,229,204,193,108,0,2,229,205,193,105,0,2,229,206,205,1,
+  0,1,229,207,0,2,195,151,192,171,0,1,229,208,0,1,229,209,0,1,206,54,1,3,
+  2,196,202,192,240,0,1,229,210,0,4,196,25,74,229,211,1,2,1,229,212,0,2,206,
+  55,200,114,2,3,145,54,192,210,0,2,229,213,229,214,0,5,192,69,192,53,198,245,74,
+  194,167,4,1,194,168,4,1,194,82,4,1,194,169,2,1,194,215,0,4,192,69,192,53,
+  55,198,215,2,3,115,74,194,167,4,1,194,168,4,1,194,82,4,1,194,169,2,3,85,
+  74,194,167,4,1,194,168,4,1,194,82,4,1,194,169,2,1,229,215,2,3,78,74,194,
+  167,4,1,194,168,4,1,194,82,4,1,194,169,2,3,198,246,74,194,167,4,1,194,168,
+  0,5,192,69,192,53,198,246,74,194,82,4,1,194,169,2,3,194,42,74,194,167,4,1,
+  194,168,4,1,194,82,4,1,194,169,2,3,193,147,74,194,167,4,1,194,168,4,1,194,
+  82,4,1,194,169,2,3,133,74,194,167,4,1,194,168,4,1,194,82,4,1,194,169,2,
+  3,194,93,74,194,167,4,1,194,168,0,5,192,69,192,53,194,93,74,194,82,4,1,194,
+  169,2,2,194,34,198,215,2,3,128,74,194,167,4,1,194,168,4,1,194,82,4,1,194,
+  169,2,3,117,74,194,167,4,1,194,168,4,1,194,82,4,1,194,169,2,3,192,66,74,
+  194,167,4,1,194,168,4,1,194,82,4,1,194,169,2,3,65,74,194,167,0,5,192,69,
+  192,53,65,74,194,168,4,1,194,82,4,1,194,169,2,1,229,216,2,1,229,217,2,1,
+  229,218,2,1,229,219,2,1,229,220,2,1,229,221,2,1,229,222,2,1,229,223,2,1,
+  229,224,2,1,229,225,2,1,229,226,2,1,229,227,2,1,229,228,0,3,192,69,192,53,
+  229,229,2,1,229,230,2,1,229,231,2,1,229,232,2,1,229,233,2,1,229,234,2,1,
+  229,235,2,1,229,236,2,3,54,74,194,167,4,1,194,168,4,1,194,82,4,1,194,169,
+  2,2,63,198,215,0,1,229,237,0,2,97,1,2,3,38,193,64,1,0,6,97,1,192,
+  158,39,110,120,3,3,37,110,120,3,1,174,2,3,2,55,174,3,3,192,75,192,132,38,
+  3,2,59,57,3,3,3,120,38,3,2,193,29,54,3,2,184,38,4,1,57,0,2,229,
+  238,1,0,1,197,180,1,2,15,85,2,1,78,2,1,65,2,1,54,0,2,229,239,229,
+  240,0,2,198,239,195,201,1,3,229,241,206,56,122,1,1,229,242,0,1,229,243,0,3,
+  201,30,206,57,229,244,2,1,198,132,0,1,229,245,0,2,229,246,229,247,0,1,229,248,
+  0,2,196,239,193,88,0,2,198,65,193,83,1,1,42,2,1,104,0,1,229,249,0,3,
+  197,216,74,198,59,0,3,229,250,194,146,11,0,1,206,58,0,2,229,251,229,252,0,1,
+  229,253,0,2,229,254,194,15,0,2,197,227,1,0,2,229,255,201,97,0,3,201,29,194,
+  191,104,1,1,104,0,3,196,222,192,135,11,1,2,230,0,11,1,2,230,1,11,1,1,
+  11,0,2,230,2,230,3,0,1,194,198,1,4,38,194,85,164,66,0,4,194,198,38,193,
+  64,1,2,4,192,146,194,85,164,66,3,2,164,66,2,3,196,215,193,64,1,3,3,192,
+  146,164,66,1,4,195,47,192,146,194,132,66,1,3,192,26,164,66,2,2,194,132,66,1,
+  2,195,93,198,247,0,2,201,31,193,233,1,1,193,232,1,1,195,250,0,2,230,4,230,
+  5,0,5,193,89,15,40,83,193,90,4,1,192,168,4,2,194,49,193,21,0,6,193,89,
+  15,40,83,192,188,193,21,4,2,193,170,42,4,2,172,195,236,4,2,158,192,168,5,2,
+  192,209,192,104,4,3,39,192,156,130,5,3,55,195,253,130,5,2,193,56,130,5,2,193,
+  61,130,5,3,51,192,156,130,5,1,192,247,5,2,43,130,5,3,193,177,193,93,130,5,
+  3,63,193,56,130,6,2,195,253,130,4,2,135,192,124,0,6,193,89,15,40,83,193,127,
+  42,4,3,37,192,156,130,5,3,55,195,253,130,5,2,193,56,130,5,2,193,61,130,5,
+  3,51,192,156,130,5,1,192,247,5,2,43,130,5,3,193,177,193,93,130,5,3,63,193,
+  56,130,6,2,195,253,230,6,4,1,194,209,4,3,54,59,201,22,4,3,195,4,135,192,
+  124,0,1,230,7,0,2,230,8,195,79,0,1,194,249,0,1,230,9,0,1,230,10,0,
+  3,203,120,197,103,11,0,1,206,59,1,1,200,122,0,2,230,11,230,12,0,2,230,13,
+  1,0,1,230,14,0,2,230,15,192,124,0,1,204,164,0,2,230,16,66,0,1,230,17,
+  0,6,193,142,192,192,78,140,2,192,211,5,1,59,2,2,0,194,68,0,4,193,142,192,
+  192,0,194,69,3,1,195,58,3,1,194,95,3,1,193,19,3,1,194,121,3,1,194,96,
+  3,1,194,122,3,1,205,55,3,1,192,177,3,1,192,238,3,1,194,103,3,1,194,97,
+  3,1,193,86,3,1,194,70,3,1,205,56,3,1,194,123,0,4,193,142,192,192,0,194,
+  159,2,2,29,78,3,1,49,4,1,134,3,1,192,66,3,1,65,3,1,192,224,3,1,
+  54,2,2,193,42,42,2,3,160,193,42,42,0,3,230,18,230,19,230,20,0,2,192,4,
+  193,242,0,3,230,21,230,22,42,0,2,200,207,193,118,0,1,230,23,0,1,199,130,0,
+  6,201,32,204,17,192,158,230,24,196,25,11,0,3,193,211,107,39,2,1,37,1,2,113,
+  39,3,6,24,107,39,24,107,37,5,1,37,4,5,113,37,24,107,39,8,1,37,2,1,
+  37,3,3,24,107,39,6,3,24,107,37,0,3,195,14,193,193,192,242,1,1,194,249,0,
+  2,193,49,193,165,0,3,230,25,193,193,192,242,0,3,193,127,193,170,42,0,2,193,127,
+  42,0,3,230,26,164,66,0,1,230,27,0,2,193,124,42,0,1,206,60,1,1,104,0,
+  1,230,28,0,2,200,178,195,201,1,1,230,29,0,3,47,11,193,51,0,1,206,61,1,
+  1,196,136,0,2,230,30,1,0,2,198,225,195,201,1,1,205,79,0,1,196,53,0,1,
+  230,31,0,4,193,79,194,215,74,193,105,1,1,192,168,1,1,59,1,3,193,14,206,62,
+  195,176,1,1,200,220,1,1,193,105,2,3,2,193,108,206,63,3,6,200,123,193,175,76,
+  24,159,193,108,1,2,206,62,195,176,1,2,206,64,1,1,2,230,32,1,1,2,230,33,
+  1,1,1,43,0,1,198,71,0,1,198,61,0,1,230,34,0,1,230,35,0,1,230,36,
+  0,2,230,37,230,38,0,3,230,39,198,243,11,0,5,195,56,11,40,230,40,230,41,3,
+  2,230,42,196,88,3,2,230,43,196,88,3,2,204,94,196,88,3,2,204,95,196,88,3,
+  2,204,96,196,88,3,2,204,97,196,88,3,2,230,44,196,88,0,2,194,34,204,200,1,
+  2,230,45,195,118,0,2,230,46,42,0,5,193,189,193,88,11,0,20,4,1,62,4,1,
+  192,52,4,1,192,20,4,1,56,4,1,192,113,4,1,192,2,4,1,192,18,4,1,58,
+  4,1,192,83,4,1,192,6,4,1,112,4,1,178,4,1,152,4,1,53,4,1,192,58,
+  0,5,193,189,193,88,11,0,192,175,4,1,98,4,1,99,4,1,192,5,4,1,46,4,
+  1,192,9,4,1,192,77,4,1,192,57,4,1,192,35,4,1,192,27,0,2,230,47,1,
+  0,4,193,59,192,49,1,192,18,3,1,152,3,1,194,3,3,1,98,1,2,0,20,0,
+  3,193,59,0,192,32,2,1,192,107,2,1,191,2,1,192,3,2,1,129,2,1,192,102,
+  2,1,90,2,1,170,2,1,167,2,1,197,47,2,1,173,2,1,196,122,2,1,192,95,
+  2,1,197,43,2,1,192,145,2,1,230,48,0,3,193,59,0,150,2,1,154,2,1,182,
+  2,1,180,2,1,192,109,2,1,176,1,2,193,42,42,1,1,193,20,1,3,16,1,192,
+  74,3,1,192,98,3,1,56,3,1,200,247,3,1,195,149,3,1,58,3,1,53,3,1,
+  46,0,2,204,15,104,0,2,230,49,195,30,0,2,205,255,192,28,0,1,206,65,0,3,
+  206,66,39,230,50,2,1,230,51,0,1,230,52,0,2,197,155,39,1,1,37,1,1,11,
+  0,3,193,251,198,63,197,93,1,5,122,78,193,52,195,151,192,171,1,1,193,204,2,1,
+  192,242,2,2,206,67,193,181,2,3,2,172,71,0,6,193,251,184,192,242,38,108,27,4,
+  2,91,27,0,2,192,56,192,156,2,2,2,193,192,1,1,192,168,1,2,51,194,249,3,
+  2,193,124,42,2,3,71,192,146,1,1,2,194,111,195,121,1,2,204,157,200,126,1,5,
+  193,105,2,76,195,80,193,226,1,2,192,146,1,1,2,206,53,1,1,1,194,249,1,2,
+  193,127,42,1,5,193,79,193,105,2,193,108,206,63,0,3,192,56,37,192,156,1,4,192,
+  152,200,124,193,118,194,154,1,3,48,5,112,1,1,194,209,1,3,198,248,116,1,2,2,
+  96,1,1,1,184,2,1,193,64,1,2,192,174,194,249,1,2,206,68,193,105,0,2,206,
+  56,194,82,0,1,230,53,0,2,230,54,1,0,1,195,30,1,3,27,116,39,3,1,37,
+  0,4,195,30,27,39,116,3,1,96,2,2,37,116,3,1,96,2,2,96,39,3,1,37,
+  0,2,196,170,194,218,1,1,230,55,0,1,230,56,0,6,37,24,107,49,193,46,114,2,
+  4,113,49,193,46,114,1,2,199,45,195,128,1,1,192,156,2,1,130,3,2,2,59,2,
+  3,193,14,196,228,195,176,0,4,37,192,156,196,228,195,176,2,3,193,96,2,43,2,2,
+  2,194,4,3,3,183,194,240,27,1,3,194,4,192,172,130,1,4,27,2,45,97,3,2,
+  3,120,1,3,55,195,253,130,2,3,193,177,193,93,130,1,1,194,80,1,2,193,56,130,
+  1,2,193,61,130,3,2,107,82,3,2,76,195,188,3,2,113,82,1,3,193,14,196,228,
+  130,0,4,37,51,192,156,130,2,4,27,2,194,112,193,146,2,1,192,247,2,2,193,124,
+  42,2,2,196,168,197,129,1,2,195,62,192,169,1,3,85,194,139,114,1,1,194,55,1,
+  3,110,55,120,3,1,192,171,2,1,114,2,1,196,36,2,2,185,194,130,2,2,200,215,
+  193,233,1,3,193,105,194,225,198,202,1,3,135,205,132,130,0,5,37,195,66,200,216,197,
+  165,194,194,1,3,49,193,46,114,2,2,193,49,114,1,3,177,101,59,1,2,200,128,198,
+  137,1,1,192,247,2,1,195,231,2,2,107,82,2,2,113,82,1,3,193,79,205,134,130,
+  1,3,205,135,198,203,198,204,1,2,197,165,194,194,1,3,128,194,139,114,1,3,194,20,
+  46,130,1,3,192,76,193,124,42,1,1,196,89,0,6,37,196,89,2,49,194,66,193,87,
+  3,3,65,194,66,199,146,1,2,196,52,195,128,1,2,43,130,3,1,195,231,3,2,107,
+  193,56,3,2,113,193,56,3,3,2,51,71,4,1,198,205,4,1,71,4,4,195,75,192,
+  158,193,51,193,56,6,2,192,240,193,56,4,1,193,192,1,2,196,228,130,1,1,193,69,
+  1,5,194,174,63,37,192,89,106,0,3,37,200,218,195,128,1,3,65,194,139,114,2,2,
+  194,135,114,1,3,193,177,193,93,130,1,2,200,92,130,1,1,174,2,3,38,39,174,1,
+  4,193,245,49,193,49,114,1,4,83,119,2,198,205,2,2,100,192,124,1,3,63,193,56,
+  130,2,2,193,61,130,2,2,195,253,130,2,1,192,247,2,2,43,130,2,3,193,177,193,
+  93,130,0,3,37,196,168,197,129,0,4,198,249,192,22,200,219,1,1,1,200,220,1,2,
+  198,207,1,3,2,2,140,0,3,230,57,205,137,198,185,0,3,193,206,192,156,130,1,3,
+  194,7,192,156,130,1,4,51,192,156,193,124,42,1,2,205,138,196,161,0,4,200,222,63,
+  91,27,0,4,230,58,194,4,194,98,27,0,2,198,250,205,139,1,1,198,132,1,1,42,
+  1,1,205,140,0,3,230,59,205,57,194,194,0,2,91,27,2,4,38,194,85,164,66,3,
+  4,193,251,194,85,164,66,4,2,184,192,242,3,3,192,114,108,27,3,2,184,192,242,2,
+  7,24,113,24,107,49,193,46,114,2,2,193,66,119,4,3,66,55,192,241,2,3,145,108,
+  27,2,2,194,136,192,172,3,1,193,182,3,1,192,57,2,2,66,119,3,2,55,192,241,
+  0,5,91,27,2,193,56,183,3,2,193,14,195,26,3,3,51,83,71,3,2,193,205,192,
+  97,3,1,82,3,3,192,34,174,192,97,3,1,193,156,3,3,185,174,192,97,3,2,195,
+  78,192,169,3,2,97,57,3,3,3,193,205,192,97,4,2,174,192,97,3,1,71,3,1,
+  192,169,4,4,2,51,83,71,5,2,83,71,0,5,91,27,2,193,255,183,4,1,187,3,
+  2,83,71,1,1,198,208,1,4,199,71,194,178,63,27,1,2,55,27,2,3,45,63,27,
+  1,4,193,51,200,223,63,27,1,2,195,237,27,1,2,194,197,27,1,2,51,27,3,2,
+  193,66,119,3,2,2,71,4,2,83,71,2,1,198,208,2,2,193,21,27,0,3,91,198,
+  116,27,1,4,200,127,194,178,63,27,1,1,193,105,1,4,192,153,145,108,192,153,2,9,
+  2,186,116,38,108,192,153,2,186,116,5,3,57,171,193,21,5,2,193,66,119,5,2,66,
+  119,4,1,183,4,7,96,38,108,192,153,2,186,96,6,2,171,193,21,6,5,91,192,153,
+  2,186,116,5,2,193,66,119,5,2,66,119,4,1,187,1,2,75,27,0,4,91,75,195,
+  237,27,1,3,200,221,63,27,1,2,200,217,27,1,2,195,238,194,62,1,2,195,14,27,
+  1,3,200,222,63,27,1,1,197,133,1,2,48,27,1,2,101,27,1,2,198,209,27,1,
+  4,192,240,200,223,63,27,1,2,174,192,97,1,2,192,92,27,3,4,145,108,192,92,27,
+  3,2,66,119,3,3,2,25,193,183,0,7,91,192,92,27,2,51,172,71,4,2,75,193,
+  183,4,3,171,193,255,183,6,1,187,4,2,185,193,183,4,2,196,199,193,183,4,3,193,
+  104,75,193,183,2,2,194,197,27,2,2,195,238,194,62,1,2,192,174,27,2,2,193,21,
+  27,1,3,54,198,117,27,1,4,194,35,27,193,66,119,3,4,2,51,83,71,4,1,192,
+  169,5,4,2,51,83,71,0,8,91,194,35,27,2,192,169,2,83,71,4,2,174,198,118,
+  4,2,83,71,2,3,192,174,193,21,27,1,2,193,87,27,1,2,63,27,3,2,193,66,
+  194,57,3,3,196,24,174,192,97,0,1,159,1,1,38,1,1,230,60,1,2,164,66,1,
+  3,192,158,164,66,1,1,192,242,1,1,193,162,0,2,230,61,230,62,0,2,230,63,196,
+  35,0,5,194,134,189,193,95,196,78,189,3,3,192,50,192,157,27,0,3,230,64,205,78,
+  206,58,0,2,230,65,104,0,1,199,42,0,1,197,133,0,3,230,66,74,198,243,0,2,
+  230,67,205,250,0,2,206,69,230,68,1,1,205,46,0,5,204,143,192,135,193,1,194,55,
+  230,69,0,3,192,212,194,151,1,1,2,230,70,1,1,2,230,71,1,1,3,230,72,206,
+  70,1,0,3,192,212,230,73,1,1,2,192,90,115,2,1,194,237,2,1,193,68,3,2,
+  230,74,15,3,1,169,2,1,85,3,1,134,3,1,169,2,1,78,2,1,133,2,1,49,
+  3,1,134,4,1,169,3,1,169,4,2,192,52,192,20,0,5,192,212,192,90,192,56,49,
+  134,2,1,128,2,1,117,3,2,230,75,15,2,1,192,66,3,1,169,2,1,65,2,1,
+  194,124,2,1,54,1,2,230,76,1,1,2,230,77,1,1,2,230,78,1,1,2,230,79,
+  1,1,2,206,70,1,1,2,230,80,1,1,2,230,81,1,0,1,230,82,0,1,230,83,
+  0,1,199,131,0,3,192,152,5,192,175,1,3,200,124,193,118,194,154,1,4,75,55,193,
+  118,194,154,1,5,122,78,193,52,55,198,212,1,4,63,78,193,52,198,212,0,2,194,176,
+  199,130,1,1,200,87,0,4,194,112,11,40,230,84,3,1,195,119,3,1,193,174,3,1,
+  230,85,3,1,230,86,3,1,194,133,0,1,230,87,0,2,230,88,1,0,2,230,89,201,
+  112,0,1,230,90,0,3,193,113,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,
+  1,128,2,1,117,2,1,65,2,1,54,1,3,192,14,49,110,3,1,193,49,3,1,194,
+  174,0,4,193,113,192,14,54,195,140,1,3,29,115,134,2,1,194,110,2,1,193,68,2,
+  2,85,134,2,1,193,153,2,2,78,134,2,2,133,134,2,1,193,41,2,2,49,134,2,
+  2,128,134,2,1,193,77,2,2,117,134,2,1,194,61,2,1,192,66,2,1,193,117,0,
+  4,193,113,29,65,134,2,1,192,224,2,2,54,134,0,3,192,46,230,91,11,1,2,230,
+  92,11,1,2,192,211,192,4,1,3,0,197,202,20,2,1,206,71,2,2,230,93,230,94,
+  2,2,230,95,20,2,4,230,96,230,97,230,98,62,2,1,192,52,2,1,230,99,2,1,
+  230,100,2,1,230,101,2,1,230,102,0,3,192,46,0,192,20,2,3,230,103,230,104,192,
+  20,2,1,230,105,2,1,230,106,2,1,230,107,2,1,56,2,1,196,73,2,3,230,108,
+  195,49,56,2,1,194,227,2,1,195,223,2,4,230,109,230,110,194,213,192,113,2,3,197,
+  181,197,182,197,202,4,1,206,71,4,1,195,49,4,1,196,166,4,1,206,72,0,3,192,
+  46,0,192,2,2,1,193,131,2,3,230,111,230,112,192,2,2,1,230,113,2,2,230,114,
+  192,18,2,2,230,115,192,18,2,1,230,116,2,1,200,248,2,1,230,117,2,1,230,118,
+  2,4,230,119,196,166,230,120,58,2,2,230,121,230,122,2,2,230,123,192,83,2,1,192,
+  6,2,2,230,124,192,6,2,1,230,125,0,6,192,46,0,230,126,230,127,230,128,112,2,
+  2,230,129,193,85,2,2,230,130,192,18,2,2,230,131,178,2,2,230,132,53,2,1,230,
+  133,2,3,230,134,193,233,178,2,4,230,135,230,136,230,137,152,2,1,53,2,1,193,4,
+  2,1,192,135,2,1,192,233,2,1,230,138,2,2,206,72,53,2,3,230,139,230,140,53,
+  2,3,230,141,230,142,192,58,0,3,192,46,0,192,175,2,4,230,143,198,251,230,144,98,
+  2,1,196,37,2,2,230,145,20,2,2,230,146,62,2,2,230,147,192,18,2,2,230,148,
+  178,2,2,230,149,152,2,2,230,150,53,2,2,230,151,99,2,2,230,152,192,5,2,1,
+  230,153,2,3,230,154,230,155,99,2,2,230,156,99,2,1,230,157,2,3,230,158,230,159,
+  195,251,0,6,192,46,0,230,160,196,71,230,161,192,5,2,3,230,162,195,136,46,2,1,
+  192,9,2,1,192,77,2,3,230,163,198,196,192,77,2,1,192,57,2,1,192,35,2,1,
+  205,120,2,1,192,27,1,2,194,205,192,4,1,2,192,76,192,4,1,2,230,164,11,0,
+  1,230,165,0,4,200,215,230,166,2,230,167,0,2,195,186,1,0,4,196,240,195,166,11,
+  230,168,0,4,196,240,195,166,11,230,169,3,1,230,170,3,1,230,171,3,1,230,172,3,
+  1,230,173,0,3,99,192,158,174,0,2,199,132,202,125,1,1,230,174,0,1,230,175,0,
+  1,230,176,0,4,230,177,197,231,24,197,120,0,2,195,45,230,178,0,1,195,12,0,2,
+  230,179,104,0,3,192,166,194,21,42,1,2,0,230,180,0,3,192,166,0,198,62,2,1,
+  206,73,2,1,230,181,2,1,195,17,2,1,230,182,2,1,192,158,2,1,200,230,2,1,
+  200,250,2,1,206,38,2,1,230,183,2,1,198,226,2,1,192,177,2,1,230,184,2,1,
+  201,33,2,1,192,249,2,1,230,185,0,3,192,166,0,230,186,2,1,206,74,2,1,230,
+  187,2,1,198,252,2,1,197,147,1,2,42,193,213,2,2,206,75,198,252,2,1,192,158,
+  2,1,230,188,2,1,206,76,2,1,230,189,1,4,61,0,206,75,198,252,3,1,58,3,
+  2,192,114,20,1,2,192,4,230,190,2,1,230,191,0,3,192,166,192,4,230,192,2,1,
+  230,193,2,1,230,194,2,1,230,195,2,2,230,196,206,77,2,1,206,76,2,1,206,77,
+  2,1,230,197,2,2,205,13,230,198,2,1,230,199,2,1,230,200,2,1,230,201,1,3,
+  16,1,20,3,1,192,45,3,1,56,3,1,58,0,5,192,166,16,1,171,20,4,1,192,
+  45,4,1,56,4,1,58,4,1,46,3,1,53,3,2,206,78,20,4,1,192,45,3,2,
+  192,114,20,3,1,195,180,3,1,46,0,1,230,202,0,7,48,75,51,192,168,193,124,42,
+  192,150,3,5,160,192,168,193,124,42,192,150,2,6,135,51,192,168,193,124,42,192,150,1,
+  2,197,153,192,150,0,1,202,79,0,1,206,79,1,1,202,22,0,1,230,203,0,4,192,
+  72,192,49,1,230,204,1,1,193,121,1,2,14,115,2,1,85,2,1,78,2,1,133,2,
+  1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,0,3,192,72,51,193,
+  121,1,2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,2,1,193,
+  2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,232,
+  2,1,56,2,1,193,13,2,1,192,3,0,3,192,72,0,192,239,2,1,129,2,1,58,
+  2,1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,
+  193,154,2,1,167,2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,2,1,53,0,
+  3,192,72,0,192,233,2,1,150,2,1,192,195,2,1,154,2,1,182,2,1,192,101,2,
+  1,193,33,2,1,180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,
+  103,2,1,192,194,2,2,123,112,3,1,193,73,0,4,192,72,0,123,98,3,1,193,34,
+  2,1,176,1,2,1,192,203,2,1,193,82,2,1,193,20,2,1,193,47,1,3,16,1,
+  192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,193,13,3,1,58,3,1,192,80,
+  3,1,53,3,1,192,233,0,4,192,72,16,1,46,3,1,192,103,3,2,123,112,4,1,
+  193,73,4,1,98,4,1,193,34,0,1,230,205,0,1,230,206,0,1,230,207,0,1,230,
+  208,0,1,199,242,1,1,230,209,0,1,205,212,0,1,230,210,0,1,230,211,0,1,197,
+  103,0,1,230,212,0,3,157,5,62,2,1,56,2,1,192,113,2,1,192,18,2,1,58,
+  2,1,112,2,1,178,2,1,192,58,2,1,98,1,3,32,194,177,192,150,1,2,3,56,
+  2,1,192,2,2,1,112,2,1,53,0,1,230,213,0,1,230,214,0,1,200,6,0,1,
+  230,215,0,3,195,107,196,25,197,141,0,2,193,42,1,0,1,230,216,0,1,230,217,0,
+  2,230,218,197,152,0,1,230,219,0,1,200,99,0,3,195,94,14,115,2,1,85,2,1,
+  78,2,1,133,2,1,49,2,1,128,0,3,195,94,14,117,2,1,65,2,1,54,2,1,
+  192,33,0,1,230,220,0,1,194,209,0,5,197,165,194,194,2,193,51,193,3,0,1,230,
+  221,0,2,230,222,11,0,6,230,223,104,2,200,186,200,118,192,228,0,2,230,224,42,0,
+  2,206,80,59,0,1,230,225,0,2,195,121,193,252,0,2,230,226,230,227,0,1,230,228,
+  0,3,194,178,63,120,2,2,7,192,211,2,1,192,171,0,4,230,229,200,69,74,198,59,
+  0,1,230,230,0,3,192,25,194,21,1,1,2,230,231,1,1,1,193,121,1,2,14,115,
+  2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,0,3,192,
+  25,14,54,2,1,192,33,1,2,51,193,121,1,1,230,232,1,4,230,233,192,114,16,42,
+  1,1,200,82,1,2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,2,1,192,32,
+  2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,0,3,192,25,0,
+  193,25,2,1,192,232,2,1,56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,
+  1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,170,2,1,193,
+  154,2,1,167,2,1,173,0,3,192,25,0,192,95,2,1,192,251,2,1,192,145,2,1,
+  53,2,1,150,2,1,192,195,2,1,154,2,1,182,2,1,192,101,2,1,193,33,2,1,
+  180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,0,3,192,25,
+  0,192,194,2,2,123,112,3,1,193,73,3,1,98,3,1,193,34,2,1,176,1,1,194,
+  186,1,2,195,123,42,1,2,193,42,197,174,2,1,197,175,1,1,193,171,1,2,1,192,
+  203,2,1,194,92,2,1,193,82,2,2,192,143,193,82,2,1,196,142,0,3,192,25,1,
+  193,191,2,1,192,16,2,1,196,143,2,1,193,20,2,1,193,47,1,2,230,234,42,1,
+  3,16,61,42,2,2,1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,58,3,
+  1,192,80,3,1,53,3,2,200,86,56,3,1,46,0,4,192,25,16,1,192,103,3,2,
+  123,112,4,1,193,73,4,1,98,4,1,193,34,0,1,230,235,0,2,230,236,195,248,0,
+  3,192,237,0,230,237,2,1,230,238,2,1,194,226,2,1,196,105,2,1,230,239,2,1,
+  230,240,2,1,192,189,2,1,230,241,2,1,230,242,0,3,192,237,0,203,107,2,1,230,
+  243,2,1,196,73,2,1,196,156,2,1,204,36,2,1,198,221,2,1,196,26,2,1,230,
+  244,2,1,230,245,2,1,230,246,2,1,205,202,2,1,195,248,2,1,230,247,2,1,230,
+  248,2,1,230,249,2,1,230,250,0,3,192,237,0,196,18,2,1,230,251,2,1,192,177,
+  2,1,230,252,2,1,197,215,2,1,192,135,2,1,230,253,2,1,192,26,2,1,194,106,
+  2,1,230,254,2,1,230,255,2,1,193,180,2,1,231,0,2,1,231,1,2,1,231,2,
+  2,1,206,81,0,3,192,237,0,96,2,1,231,3,2,1,231,4,2,1,205,148,2,1,
+  231,5,2,1,231,6,2,1,206,82,0,1,200,7,0,1,199,128,0,2,231,7,231,8,
+  0,1,201,27,0,5,231,9,104,2,231,10,193,146,0,2,231,11,192,171,0,2,206,83,
+  231,12,1,1,231,13,0,4,192,114,199,72,192,50,27,0,8,192,114,193,120,27,192,89,
+  183,195,116,188,192,157,1,2,116,193,69,3,2,2,194,175,1,2,39,193,69,1,5,91,
+  27,38,108,27,1,3,193,151,188,27,1,2,96,193,69,3,4,38,192,114,116,193,69,3,
+  2,2,193,192,0,1,231,14,0,4,198,253,198,254,231,15,201,23,2,2,116,200,193,2,
+  2,0,201,23,2,2,96,200,193,0,1,198,219,0,3,231,16,177,100,0,1,231,17,0,
+  1,204,162,0,1,231,18,0,2,231,19,194,194,0,2,192,16,193,121,1,2,51,193,121,
+  1,4,193,103,74,195,113,42,1,2,0,20,2,1,192,45,2,1,192,74,2,2,193,24,
+  46,2,1,192,98,2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,142,0,3,192,
+  16,0,191,2,1,192,220,2,1,193,25,2,1,192,232,2,1,56,2,1,192,3,2,1,
+  192,239,2,1,129,2,1,58,2,1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,
+  1,192,144,2,1,170,2,1,167,0,3,192,16,0,173,2,1,192,95,2,1,192,251,2,
+  1,192,145,2,1,53,2,1,150,2,1,192,195,2,1,154,2,1,182,2,1,192,101,2,
+  1,193,33,2,1,180,2,1,192,167,2,3,231,20,193,24,58,2,1,192,214,2,1,193,
+  12,0,5,192,16,0,200,134,193,24,58,4,1,192,80,2,1,46,2,1,192,103,2,1,
+  192,194,2,2,123,112,3,1,193,73,3,1,98,3,1,193,34,2,1,176,1,2,197,170,
+  197,174,2,1,197,175,2,1,206,84,1,4,193,42,42,51,159,5,2,2,195,11,3,5,
+  2,194,81,24,78,206,85,0,7,192,16,193,42,42,2,194,81,24,195,11,6,2,54,206,
+  85,4,2,51,196,5,4,2,195,14,196,5,4,4,195,11,24,193,14,196,5,7,2,51,
+  196,5,7,2,192,174,196,5,4,2,231,21,196,5,4,4,197,2,24,193,14,196,5,6,
+  2,197,8,231,22,4,2,192,174,196,5,1,2,193,171,119,2,1,59,1,2,1,192,203,
+  2,1,193,82,2,1,193,191,0,3,192,16,1,192,16,2,1,193,20,2,1,193,47,1,
+  3,16,1,192,45,3,1,192,74,3,2,193,24,46,4,1,192,103,3,1,192,98,3,1,
+  56,3,1,58,3,1,192,80,3,1,53,3,1,46,3,1,192,103,3,2,123,98,4,1,
+  193,34,0,5,194,20,55,116,192,89,106,2,3,39,192,89,106,2,3,37,192,89,106,2,
+  3,96,192,89,106,1,4,63,116,192,89,106,2,3,39,192,89,106,2,3,37,192,89,106,
+  2,3,96,192,89,106,0,4,1,74,193,1,206,86,0,5,21,196,105,231,23,3,206,87,
+  2,2,206,88,194,106,2,3,231,24,3,206,87,2,2,231,25,192,158,1,2,200,253,231,
+  26,2,1,231,27,1,2,196,155,193,175,0,3,21,196,155,194,205,2,1,192,76,1,2,
+  196,241,193,16,2,1,231,28,2,1,206,89,1,1,193,90,1,1,192,168,1,4,198,255,
+  196,90,116,193,16,3,2,193,16,116,4,1,96,3,2,96,193,16,1,3,195,95,192,97,
+  192,34,3,1,3,2,3,231,29,231,30,200,254,2,1,231,31,2,1,231,32,0,3,21,
+  195,95,206,90,2,1,206,91,3,1,193,224,2,1,204,27,2,1,196,91,1,1,206,92,
+  1,1,231,33,1,3,195,63,206,93,194,205,3,1,192,76,2,1,231,34,1,3,196,90,
+  193,63,116,3,1,193,16,3,1,96,1,2,199,0,194,7,2,1,193,63,3,1,193,224,
+  0,4,21,199,0,193,63,51,1,2,197,183,204,159,2,1,194,7,2,1,193,63,3,1,
+  193,224,3,1,51,1,2,201,34,116,2,1,205,131,2,1,96,1,2,193,184,193,3,2,
+  2,110,193,3,3,1,177,2,1,177,2,1,231,35,2,2,194,239,177,2,2,231,36,196,
+  6,0,7,21,104,199,1,196,239,195,32,194,58,199,2,5,3,96,192,26,116,8,1,199,
+  2,1,2,194,46,206,94,2,1,206,95,2,1,206,96,2,1,206,97,2,1,206,98,1,
+  1,195,80,1,3,196,242,192,34,194,205,3,1,192,76,2,1,199,3,2,2,3,194,205,
+  3,1,192,76,1,4,231,37,197,184,196,243,206,99,1,2,201,35,196,244,0,3,21,201,
+  35,193,16,2,1,196,92,1,2,192,209,192,104,1,2,201,36,193,175,2,1,194,205,2,
+  1,192,76,1,1,196,77,1,1,194,59,2,1,106,3,2,76,192,121,4,1,159,3,2,
+  159,192,121,5,1,194,106,3,1,144,4,1,192,158,4,1,194,106,0,4,21,194,59,192,
+  121,106,4,3,144,106,144,7,1,194,106,3,1,96,2,3,76,159,192,121,5,1,192,158,
+  5,1,194,106,2,6,159,116,76,144,106,192,211,3,1,192,121,1,1,194,83,2,1,106,
+  3,1,193,120,3,1,206,100,3,1,76,4,2,192,211,192,121,4,1,194,195,0,5,21,
+  194,83,106,76,192,121,4,1,159,4,1,144,3,2,159,192,121,2,2,192,121,106,3,1,
+  96,2,3,76,159,192,121,5,1,193,120,3,1,96,2,2,159,192,121,1,1,196,7,2,
+  3,78,193,108,193,143,2,5,106,144,193,39,144,194,18,2,4,76,159,192,121,193,143,6,
+  1,193,67,2,2,193,28,144,0,4,21,196,7,144,194,58,3,1,193,67,1,1,194,141,
+  2,3,85,193,108,194,107,5,1,177,2,1,106,3,2,159,192,121,3,1,144,4,1,177,
+  2,3,76,159,192,121,2,2,193,28,144,2,1,177,3,2,193,28,144,3,2,144,194,58,
+  4,1,193,67,2,2,144,194,58,0,4,21,194,141,144,193,67,1,1,199,4,2,4,106,
+  159,192,121,192,135,2,4,76,159,192,121,192,135,2,1,177,1,1,153,2,4,78,193,108,
+  193,143,193,120,2,1,196,93,2,1,106,3,1,193,120,4,2,145,76,3,1,196,245,3,
+  1,194,17,4,1,135,4,2,76,96,6,2,144,193,67,0,4,21,153,106,76,4,1,193,
+  120,5,2,144,193,63,4,1,193,143,5,1,196,245,6,2,144,194,58,5,1,194,17,6,
+  2,144,193,67,5,2,106,193,120,5,2,76,193,120,5,2,144,194,58,6,1,193,67,7,
+  1,193,120,7,1,193,143,4,2,192,211,192,121,4,1,194,195,0,7,21,153,106,76,194,
+  195,144,193,67,4,1,194,17,5,3,194,107,144,193,67,4,1,192,121,4,2,193,79,201,
+  37,4,1,159,5,1,193,120,5,1,193,143,4,3,193,63,144,193,120,4,1,144,5,1,
+  196,94,6,1,194,106,5,1,193,120,5,1,45,5,2,193,143,194,17,5,1,196,245,0,
+  6,21,153,106,76,144,194,17,5,1,196,118,4,4,96,194,107,144,194,58,3,2,193,79,
+  199,5,3,2,159,192,121,3,5,144,196,94,192,158,76,96,5,3,194,106,76,96,4,1,
+  120,4,3,45,76,96,4,3,196,245,76,96,4,1,206,101,4,3,193,39,144,194,18,6,
+  1,195,93,4,3,194,58,106,193,120,6,1,193,63,4,1,82,0,7,21,153,106,144,196,
+  118,76,194,17,6,1,96,4,1,193,67,5,2,206,47,193,120,5,2,106,193,120,6,1,
+  206,100,5,2,144,193,120,6,1,193,143,6,1,189,3,3,96,76,194,17,6,2,144,193,
+  143,7,1,193,67,2,2,192,121,193,120,3,1,116,4,2,231,38,45,4,2,206,102,194,
+  7,0,6,21,153,192,121,116,206,102,193,63,3,1,106,4,1,144,3,2,193,79,199,5,
+  3,1,144,3,2,231,39,144,3,1,96,2,4,76,193,120,145,106,3,1,116,3,1,192,
+  121,3,2,193,79,199,5,3,2,159,192,121,3,4,144,196,94,106,96,5,3,194,106,106,
+  194,195,7,1,96,4,3,45,106,194,17,0,7,21,153,76,144,45,106,96,4,3,196,245,
+  106,96,4,3,196,118,106,96,4,1,192,121,3,1,96,4,2,144,193,67,2,2,159,116,
+  3,1,106,3,1,192,121,3,1,76,4,1,193,143,4,2,193,79,201,37,3,2,193,79,
+  199,5,3,1,144,3,1,96,2,1,144,0,6,21,153,144,193,175,106,76,6,1,193,63,
+  4,2,76,159,4,2,159,192,121,3,1,194,58,3,1,196,93,3,4,145,78,193,79,201,
+  37,4,2,54,193,108,3,2,193,67,193,120,4,1,193,143,4,1,189,3,3,195,93,78,
+  193,108,4,2,106,193,120,4,2,192,121,96,4,2,65,193,108,4,2,54,193,108,0,2,
+  21,193,168,2,3,193,175,196,209,231,40,2,3,85,193,108,194,107,5,1,193,120,5,2,
+  78,193,120,5,1,194,17,6,2,193,28,144,6,2,144,193,67,5,2,144,194,58,2,2,
+  78,193,108,4,1,193,120,4,1,193,143,5,1,196,246,4,1,194,17,2,1,196,93,3,
+  3,85,193,108,194,107,0,7,21,193,168,196,93,85,193,108,194,107,193,120,6,2,78,193,
+  120,3,2,144,193,67,2,2,196,246,192,147,4,2,144,193,67,6,1,193,120,3,3,106,
+  144,193,67,3,1,192,121,2,2,144,193,120,3,1,194,58,3,1,193,67,1,1,193,114,
+  2,4,85,193,108,194,107,177,2,3,78,193,108,193,143,2,1,106,3,1,194,17,0,5,
+  21,193,114,106,76,192,121,4,1,159,5,1,193,143,3,2,159,192,121,3,1,144,4,1,
+  192,34,4,1,177,4,1,193,67,4,1,3,2,1,192,121,3,1,106,4,1,144,3,1,
+  144,2,1,76,3,2,159,192,121,2,2,193,28,144,0,3,21,193,114,177,3,2,193,28,
+  144,3,2,144,194,58,4,1,193,67,2,1,159,3,5,116,106,144,82,76,2,1,3,2,
+  4,144,193,175,76,159,3,1,193,67,4,2,206,103,106,1,1,195,96,2,1,206,101,2,
+  4,106,159,192,121,192,158,5,1,194,106,5,1,195,93,2,4,76,159,192,121,193,143,0,
+  7,21,195,96,76,159,192,121,193,143,192,158,6,1,194,106,3,1,144,2,2,159,144,1,
+  1,196,8,2,3,85,193,108,194,107,2,1,106,2,2,192,121,96,2,2,193,28,144,2,
+  2,159,192,121,2,2,144,194,58,3,1,193,67,1,1,193,146,2,2,196,6,120,2,2,
+  192,94,193,39,3,1,193,63,0,4,21,193,146,192,63,193,39,3,1,193,63,3,1,231,
+  41,2,1,231,42,1,2,196,9,231,43,2,1,231,44,2,1,231,45,2,1,231,46,2,
+  1,231,47,2,1,231,48,2,1,231,49,2,1,231,50,1,4,198,8,107,145,113,2,3,
+  113,145,107,1,3,195,242,231,51,198,180,1,2,196,4,231,52,0,4,21,196,4,193,146,
+  206,104,2,1,231,53,2,2,231,54,231,55,2,1,231,56,2,1,195,31,1,2,231,57,
+  193,242,1,2,231,58,193,242,1,3,192,228,193,3,196,244,3,1,194,58,3,1,193,16,
+  2,1,196,223,2,1,198,135,3,1,177,3,1,196,92,2,1,196,210,3,1,194,58,0,
+  4,21,192,228,196,210,196,92,2,2,177,120,3,1,194,58,3,1,197,154,4,1,196,92,
+  4,1,206,105,3,1,195,126,4,1,196,92,4,1,206,105,3,1,196,92,2,1,197,90,
+  3,1,177,3,1,196,92,2,1,196,91,3,1,194,58,3,1,206,89,0,4,21,192,228,
+  201,38,51,3,1,192,76,1,3,194,108,196,10,192,34,3,1,195,167,3,1,185,3,1,
+  3,2,3,193,175,196,10,192,34,4,1,195,167,4,1,185,4,1,3,3,2,196,11,192,
+  34,4,1,195,167,4,1,185,4,1,3,2,2,196,11,192,34,3,1,195,167,0,4,21,
+  194,108,196,11,185,3,1,3,1,7,192,94,193,246,120,192,201,194,57,192,34,51,7,1,
+  192,76,6,2,185,51,7,1,192,76,6,2,3,51,7,1,192,76,2,1,196,233,2,2,
+  100,192,34,3,1,185,3,1,3,2,1,194,145,2,2,193,56,192,34,3,1,185,3,1,
+  3,0,3,21,192,94,192,211,2,2,193,39,231,59,3,3,192,201,194,80,192,34,5,1,
+  3,4,2,194,55,192,34,5,1,3,3,1,192,34,3,1,195,167,3,1,185,3,1,3,
+  2,2,51,193,224,4,2,194,170,195,97,3,1,193,63,3,2,194,170,195,97,2,5,195,
+  80,194,81,192,201,194,57,51,6,1,192,76,0,4,21,192,94,195,80,196,244,2,5,194,
+  171,192,201,194,80,192,34,51,6,1,192,174,5,2,3,51,6,1,192,174,4,3,194,55,
+  192,34,51,5,2,3,51,5,3,192,174,192,34,192,174,6,2,3,192,174,3,1,3,2,
+  1,206,106,2,5,193,156,192,201,194,80,192,34,51,6,1,192,76,5,2,3,51,6,1,
+  192,76,4,3,194,55,192,34,51,0,7,21,192,94,193,156,192,201,194,55,192,34,192,76,
+  5,2,3,51,6,1,192,76,3,1,3,2,2,196,247,192,34,3,1,185,3,1,3,2,
+  2,199,6,195,61,2,3,192,76,193,63,192,34,4,1,195,167,4,1,185,4,1,3,3,
+  2,194,170,195,97,2,3,192,174,193,224,196,6,4,2,194,170,195,97,3,2,193,63,196,
+  6,0,5,21,192,94,192,174,194,170,195,97,2,4,193,87,192,201,194,80,192,34,5,1,
+  3,4,2,194,55,192,34,5,1,3,3,1,192,34,3,1,3,3,1,198,72,2,5,194,
+  170,120,192,201,194,57,51,6,1,192,76,2,2,194,240,192,34,3,1,185,3,1,3,1,
+  3,196,95,116,199,3,2,4,193,67,66,193,67,196,135,2,4,96,116,193,224,192,34,0,
+  6,21,196,95,96,116,193,224,3,4,1,192,34,4,1,3,3,1,199,3,1,5,192,63,
+  193,246,120,185,51,5,1,192,76,4,2,3,51,5,1,192,76,2,2,196,233,192,34,3,
+  1,185,3,1,3,2,2,100,192,34,3,1,185,3,1,3,2,2,194,145,192,34,3,1,
+  185,0,4,21,192,63,194,145,3,2,2,193,56,192,34,3,1,185,3,1,194,109,3,1,
+  3,2,1,192,211,2,3,193,39,197,111,192,34,4,1,195,167,4,1,185,4,1,3,3,
+  2,192,201,196,96,4,2,195,168,194,57,3,2,193,49,192,34,4,1,195,167,4,1,185,
+  4,1,3,0,5,21,192,63,193,39,195,116,193,63,3,3,206,107,120,185,5,1,3,2,
+  3,194,7,192,211,185,4,1,3,2,2,51,193,224,4,2,194,170,195,97,3,1,193,63,
+  3,2,194,170,195,97,2,3,195,80,194,81,51,4,1,192,76,3,1,196,244,2,3,194,
+  171,192,201,196,96,4,2,195,168,194,57,3,1,192,34,3,1,185,0,4,21,192,63,194,
+  171,3,2,1,206,106,2,3,193,156,192,201,196,96,4,2,195,168,194,57,3,1,192,34,
+  3,1,185,3,1,3,4,1,51,2,2,196,247,192,34,3,1,185,3,1,3,2,1,199,
+  6,2,3,192,76,193,63,192,34,4,1,195,167,4,1,185,4,1,3,0,5,21,192,63,
+  192,76,194,170,195,97,2,2,192,174,193,224,4,2,194,170,195,97,3,2,193,63,196,6,
+  3,2,194,170,195,97,2,4,193,87,193,39,51,192,34,5,1,185,5,1,3,4,2,192,
+  174,192,34,5,1,185,5,1,3,3,3,189,197,166,192,34,5,1,185,5,1,3,3,2,
+  192,201,196,96,4,2,195,168,194,57,0,6,21,192,63,194,170,120,195,168,51,5,1,192,
+  76,2,2,194,240,192,34,3,1,185,3,1,3,1,1,206,104,1,2,195,32,196,244,2,
+  1,193,16,2,1,231,60,2,1,201,38,1,1,192,247,1,2,194,109,231,61,2,1,231,
+  62,2,1,231,63,2,1,231,64,2,1,231,65,0,3,21,194,109,231,66,2,1,231,67,
+  2,1,206,94,2,1,206,95,2,1,206,96,2,1,206,97,2,1,206,98,2,1,231,68,
+  2,1,231,69,2,1,231,70,1,2,194,142,193,224,3,2,192,201,194,80,4,1,194,55,
+  2,1,51,3,2,192,201,194,80,4,1,194,55,0,3,21,194,142,192,76,3,2,192,201,
+  194,80,4,1,194,55,1,2,194,143,193,24,2,3,193,224,192,201,196,96,4,2,195,168,
+  194,57,2,1,51,3,2,192,201,196,96,4,2,195,168,194,57,2,1,192,76,3,2,192,
+  201,196,96,4,2,195,168,194,57,1,2,197,228,193,175,2,1,194,205,2,1,192,76,1,
+  1,194,209,0,4,21,197,184,196,243,231,71,3,1,231,72,2,3,199,2,193,66,231,73,
+  1,3,196,248,196,242,193,224,2,2,192,34,194,205,3,1,192,76,2,1,199,3,2,2,
+  3,194,205,3,1,192,76,1,2,201,39,193,175,2,1,194,205,2,1,192,76,1,2,201,
+  40,193,175,2,1,200,186,1,1,196,97,2,2,231,74,195,242,0,3,21,196,97,196,6,
+  2,2,192,135,195,242,4,1,196,6,3,1,194,79,4,1,196,6,1,3,196,91,196,241,
+  139,3,1,135,3,1,76,1,4,194,79,192,147,194,18,192,228,3,2,206,108,194,106,2,
+  3,194,18,192,228,206,90,2,2,231,75,195,242,2,3,231,76,231,77,231,78,2,3,206,
+  108,194,106,231,79,2,3,193,255,193,175,195,242,3,3,206,103,194,18,192,228,0,3,21,
+  231,80,231,81,1,3,206,109,194,7,196,233,2,2,193,63,231,82,1,2,201,41,193,175,
+  2,1,194,205,2,1,192,76,1,3,196,98,194,142,193,224,3,1,51,3,1,192,76,2,
+  2,194,143,193,224,3,1,51,3,1,192,76,2,1,199,6,1,4,195,98,193,246,196,51,
+  51,4,1,192,76,4,1,192,174,0,4,21,195,98,194,142,193,224,3,1,51,3,1,192,
+  76,2,2,194,143,193,224,3,1,51,3,1,192,76,2,1,199,6,1,6,113,205,69,199,
+  2,193,66,196,243,231,83,1,4,231,84,197,184,196,243,206,99,0,3,198,22,74,231,85,
+  0,6,195,81,38,192,172,38,193,64,1,2,4,192,173,38,193,64,1,1,2,193,252,195,
+  81,1,2,192,26,192,172,2,1,192,173,0,2,231,86,193,87,0,4,192,76,204,21,193,
+  124,42,1,4,194,8,192,156,193,124,42,1,3,204,22,193,124,42,1,4,193,206,192,156,
+  193,124,42,0,4,179,193,30,14,115,3,1,85,3,1,78,3,1,133,3,1,49,3,1,
+  128,3,1,117,3,1,65,3,1,54,2,2,29,194,110,3,1,193,68,3,1,193,153,0,
+  4,179,193,30,29,193,41,3,2,49,134,4,1,169,3,1,193,77,3,1,194,61,3,1,
+  192,66,3,1,193,117,3,1,192,224,1,2,0,231,87,2,1,231,88,2,1,231,89,2,
+  1,231,90,2,2,195,99,201,42,3,1,206,110,3,1,201,43,3,1,201,44,0,4,179,
+  0,195,99,201,45,3,1,201,46,3,1,206,111,3,1,206,112,3,1,206,113,3,1,206,
+  114,2,2,231,91,201,42,2,1,231,92,2,1,231,93,2,2,201,47,206,115,3,1,206,
+  116,3,1,201,48,2,1,231,94,2,1,231,95,2,1,231,96,2,1,231,97,0,3,179,
+  0,231,98,2,1,231,99,2,1,231,100,2,1,231,101,2,1,231,102,2,1,231,103,2,
+  2,231,104,206,117,2,2,195,100,201,42,3,1,206,110,3,1,201,43,3,1,201,44,3,
+  1,201,45,3,1,201,46,3,1,206,111,3,1,206,112,3,1,206,113,0,4,179,0,195,
+  100,206,114,2,1,231,105,2,2,201,49,206,115,3,1,206,116,3,1,201,48,2,1,231,
+  106,2,1,231,107,2,1,231,108,2,2,199,7,201,43,3,1,201,44,3,1,201,45,3,
+  1,201,46,2,2,201,50,206,117,3,2,231,109,231,110,3,1,201,48,2,1,231,111,0,
+  3,179,0,231,112,2,1,231,113,2,1,231,114,1,3,195,101,14,115,3,1,85,3,1,
+  78,3,1,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,1,
+  2,192,4,231,115,1,2,1,231,116,2,1,231,117,0,3,179,1,193,82,2,1,231,118,
+  1,3,16,1,201,51,3,2,196,99,206,118,4,1,206,119,4,1,201,52,4,1,206,120,
+  4,1,197,185,4,1,206,121,3,1,206,119,3,1,201,52,3,2,201,53,206,118,4,1,
+  206,120,4,1,206,121,3,2,231,119,231,120,3,1,197,185,0,6,179,16,1,197,185,195,
+  19,201,51,5,2,196,99,201,51,5,1,201,52,0,6,117,204,90,55,24,63,198,13,1,
+  3,193,52,55,192,171,2,2,195,151,192,171,2,4,192,171,2,76,59,0,2,231,121,193,
+  242,0,3,195,54,193,52,192,245,0,1,231,122,0,4,206,122,24,206,122,205,33,0,1,
+  231,123,0,1,199,133,1,2,24,202,183,0,1,231,124,0,5,193,151,164,66,192,26,192,
+  172,0,8,193,151,164,66,192,26,192,172,2,59,194,18,4,1,192,173,5,3,2,59,194,
+  18,1,5,188,27,2,196,118,193,146,4,2,172,192,169,0,2,231,125,192,245,0,1,231,
+  126,0,2,201,54,231,127,1,1,104,1,1,11,0,2,231,128,104,0,3,231,129,192,26,
+  231,130,0,3,205,75,74,231,131,0,3,198,18,198,136,104,1,2,193,207,104,0,1,231,
+  132,0,3,206,123,192,34,24,2,1,192,26,0,2,231,133,199,66,0,1,231,134,0,2,
+  3,195,171,1,1,195,172,1,1,192,245,1,2,195,189,192,241,1,1,193,90,1,1,192,
+  168,1,2,197,110,193,160,1,3,195,137,194,151,198,84,2,2,2,194,175,3,7,83,119,
+  193,160,193,103,74,172,71,1,2,196,32,1,1,2,194,200,74,0,5,3,194,200,74,2,
+  194,175,4,7,83,119,193,160,193,103,74,172,71,1,2,194,49,193,21,1,2,193,64,1,
+  1,2,193,170,42,1,2,192,209,192,104,1,2,192,172,1,1,1,198,138,1,2,158,192,
+  168,1,3,39,193,61,130,2,1,192,247,2,3,193,177,193,93,130,1,2,192,173,1,1,
+  2,29,1,1,2,196,225,192,241,1,2,197,30,1,0,3,3,97,1,1,2,193,127,42,
+  1,2,193,251,193,204,1,3,37,193,61,130,2,1,192,247,2,3,193,177,193,93,130,1,
+  3,192,212,192,90,115,3,1,194,237,3,1,193,68,3,1,85,4,1,134,3,1,78,3,
+  1,133,3,1,49,4,1,134,4,1,169,0,4,3,192,212,192,90,128,3,1,117,3,1,
+  192,66,3,1,65,3,1,194,124,3,1,54,1,1,194,209,1,1,184,1,6,54,140,145,
+  49,59,192,4,1,3,195,185,2,193,192,0,2,206,124,196,131,2,3,192,26,164,66,0,
+  2,203,144,194,194,0,1,197,90,0,6,193,207,194,191,104,2,206,125,193,184,4,2,177,
+  192,228,0,4,193,207,104,2,231,135,3,2,206,125,193,184,3,1,206,86,3,2,177,192,
+  228,5,3,24,200,117,198,128,6,2,193,207,193,184,6,2,204,144,193,184,3,2,193,207,
+  193,184,5,4,24,193,105,200,118,192,228,6,2,65,194,82,3,1,203,254,3,1,231,136,
+  0,2,231,137,104,0,2,205,252,11,0,1,231,138,0,1,198,72,0,2,231,139,104,0,
+  3,200,13,231,140,195,247,0,1,231,141,0,1,200,161,0,1,199,134,1,2,197,140,200,
+  13,0,2,231,142,194,218,0,1,231,143,0,2,194,160,194,212,1,2,195,248,205,45,1,
+  3,193,93,198,14,197,56,0,1,231,144,0,2,231,145,11,0,4,192,60,31,193,39,38,
+  3,1,57,2,2,59,38,0,4,192,60,31,59,57,2,2,82,38,3,1,57,2,3,171,
+  82,57,2,2,194,192,57,2,2,71,57,2,3,54,140,38,4,1,57,1,2,193,214,193,
+  86,1,2,0,194,68,2,1,194,235,2,1,194,69,2,1,231,146,2,1,194,95,2,1,
+  193,19,2,1,194,121,0,3,192,60,0,194,96,2,1,194,122,2,1,206,24,2,1,194,
+  26,2,1,192,177,2,1,192,238,2,1,231,147,2,1,194,103,2,1,194,97,2,1,193,
+  86,2,1,194,70,2,1,193,11,2,1,194,123,2,1,194,159,1,2,29,49,3,1,134,
+  0,3,192,60,29,192,66,2,1,192,224,1,4,192,4,120,2,59,2,4,110,120,2,59,
+  2,4,54,194,81,2,140,3,2,83,197,6,5,2,2,140,0,4,206,126,198,181,43,192,
+  150,4,3,192,158,55,43,0,1,193,204,1,2,2,194,175,0,2,202,148,1,0,5,231,
+  148,2,91,27,38,0,4,193,75,193,76,14,115,3,1,85,3,1,78,0,4,193,75,193,
+  76,14,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,33,2,2,
+  0,194,226,3,1,231,149,3,1,231,150,3,1,231,151,3,1,231,152,3,1,195,49,3,
+  1,202,154,3,1,165,3,1,199,137,0,4,193,75,193,76,0,231,153,3,1,203,57,3,
+  1,231,154,3,1,202,139,3,1,203,214,3,1,199,230,3,1,231,155,3,1,231,156,3,
+  1,197,34,3,1,231,157,3,1,231,158,3,1,202,43,3,1,193,26,3,1,200,97,3,
+  1,193,55,3,1,199,8,0,3,194,66,231,159,203,179,0,3,192,50,192,157,27,3,4,
+  24,192,50,192,196,27,3,4,193,95,188,192,157,27,3,2,66,193,56,3,2,2,82,2,
+  2,55,27,2,2,51,27,2,2,192,89,195,246,3,1,193,238,3,2,195,155,193,238,2,
+  2,48,27,2,2,192,92,27,4,2,66,119,2,2,63,27,1,2,192,196,27,0,7,192,
+  50,192,196,27,24,188,192,196,27,3,2,2,82,2,2,55,27,2,2,51,27,2,2,192,
+  89,195,246,3,1,193,238,3,2,195,155,193,238,2,2,48,27,2,2,192,92,27,4,2,
+  66,119,2,2,63,27,0,4,192,70,197,186,0,170,3,1,154,3,1,182,3,1,192,101,
+  1,4,50,192,49,1,196,229,0,5,192,70,50,192,49,1,62,4,1,192,20,4,1,192,
+  2,4,1,192,6,4,1,112,4,1,178,4,1,152,4,1,194,3,4,1,98,4,1,99,
+  4,1,196,37,1,2,197,0,42,1,6,193,146,42,2,193,128,24,194,94,7,2,24,206,
+  127,8,2,192,174,206,127,1,2,0,196,229,0,3,192,70,0,20,2,1,192,32,2,1,
+  193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,192,
+  232,2,1,194,189,2,1,192,3,2,1,192,239,2,1,129,2,1,192,102,2,1,193,60,
+  2,1,90,0,3,192,70,0,192,144,2,1,197,169,2,1,170,2,1,167,2,1,173,2,
+  1,192,95,2,1,192,251,2,1,192,145,2,1,150,2,1,192,195,2,1,154,2,1,182,
+  2,1,192,101,2,1,193,33,2,1,180,2,1,192,167,0,3,192,70,0,193,123,2,1,
+  194,140,2,1,192,214,2,1,193,12,2,1,192,194,2,1,176,2,1,192,221,2,1,193,
+  236,1,3,42,51,194,104,2,1,204,175,2,1,194,104,2,1,195,39,1,2,1,192,203,
+  2,1,196,142,2,1,196,143,2,1,193,47,0,2,192,70,206,128,1,2,206,129,197,174,
+  2,1,197,175,1,3,16,194,116,42,2,2,1,192,74,3,1,192,98,3,1,56,3,1,
+  58,3,1,53,3,1,193,4,3,1,46,3,1,193,219,3,2,123,112,4,1,98,0,1,
+  193,242,0,1,231,160,0,1,205,3,0,1,231,161,0,2,231,162,193,118,0,2,231,163,
+  197,152,0,1,196,89,1,3,2,198,4,71,2,3,49,194,66,193,87,2,3,65,194,66,
+  199,146,0,4,231,164,193,146,192,158,198,22,0,2,196,52,199,77,0,1,231,165,0,2,
+  231,166,1,0,2,201,55,192,156,2,2,196,76,39,3,1,96,0,1,206,130,0,2,206,
+  130,231,167,0,3,196,51,199,167,197,119,1,2,193,165,197,119,1,1,193,93,0,3,231,
+  168,198,128,11,0,1,231,169,0,3,231,170,74,200,11,0,1,199,141,0,2,231,171,197,
+  141,0,2,231,172,206,131,0,4,43,20,145,178,1,1,231,173,1,1,195,44,1,1,231,
+  174,1,1,231,175,1,1,231,176,0,2,43,192,98,1,1,231,177,1,1,119,1,1,231,
+  178,1,1,231,179,1,1,231,180,1,1,231,181,1,1,231,182,1,3,192,52,145,206,132,
+  1,1,231,183,1,1,198,6,1,1,203,108,1,1,203,109,1,1,201,56,2,1,197,187,
+  2,1,101,0,2,43,194,211,1,1,231,184,1,1,197,120,1,1,191,1,1,231,185,1,
+  1,205,122,1,1,231,186,1,1,231,187,1,1,231,188,1,1,201,57,2,1,197,187,2,
+  1,101,1,1,231,189,1,1,231,190,1,3,197,188,195,217,231,191,3,1,231,192,0,4,
+  43,197,188,195,217,231,193,3,1,231,194,3,1,231,195,1,1,231,196,1,1,231,197,1,
+  1,201,16,1,1,231,198,1,1,198,67,1,2,78,196,223,1,1,195,141,1,1,231,199,
+  1,1,231,200,1,1,231,201,1,1,231,202,1,1,231,203,1,1,231,204,0,2,43,231,
+  205,1,1,231,206,1,1,231,207,1,1,231,208,1,1,231,209,1,1,129,1,1,231,210,
+  1,1,231,211,1,1,231,212,1,1,203,140,1,2,192,30,231,213,1,1,200,246,1,1,
+  231,214,1,1,231,215,1,1,198,74,1,1,231,216,0,2,43,231,217,1,1,231,218,1,
+  1,231,219,1,1,203,141,1,2,195,112,74,3,3,192,26,164,66,4,3,192,146,164,66,
+  1,1,192,158,1,1,231,220,1,1,231,221,1,1,197,61,1,2,192,6,198,184,1,1,
+  90,1,1,231,222,1,1,231,223,1,1,231,224,0,2,43,231,225,1,1,231,226,1,1,
+  231,227,1,1,206,132,1,1,231,228,1,1,231,229,1,1,231,230,1,1,231,231,1,1,
+  231,232,1,1,198,39,1,1,231,233,1,1,199,9,2,1,5,2,1,197,187,2,1,101,
+  1,1,231,234,0,2,43,231,235,1,1,197,42,1,1,231,236,1,1,231,237,1,1,231,
+  238,1,1,231,239,1,1,199,138,1,1,231,240,1,4,39,177,100,192,242,1,1,231,241,
+  1,1,231,242,1,1,231,243,1,1,194,184,1,1,231,244,1,2,178,197,187,2,1,198,
+  184,0,4,43,178,145,99,4,1,101,2,1,101,1,1,167,1,1,231,245,1,1,231,246,
+  1,1,231,247,1,1,231,248,1,1,231,249,1,1,199,220,2,1,3,1,1,231,250,1,
+  1,201,58,1,1,231,251,1,1,231,252,1,1,231,253,0,2,43,231,254,1,1,231,255,
+  1,1,232,0,1,1,232,1,1,1,232,2,1,1,198,214,2,1,197,187,2,1,101,1,
+  1,232,3,1,1,202,199,1,1,232,4,1,2,193,31,20,2,1,192,113,2,1,192,2,
+  2,1,112,2,1,178,0,3,43,193,31,99,2,1,192,9,2,1,192,77,1,1,197,94,
+  2,1,201,58,1,1,206,133,2,1,201,58,1,1,173,1,1,232,5,1,1,232,6,1,
+  1,232,7,1,1,232,8,1,1,232,9,1,1,199,231,1,1,232,10,1,1,232,11,0,
+  2,43,232,12,1,2,197,176,74,3,3,192,26,164,66,4,3,192,146,164,66,1,1,206,
+  1,1,1,150,2,1,232,13,1,1,232,14,1,1,232,15,1,1,232,16,1,1,232,17,
+  1,1,232,18,1,1,232,19,1,1,206,48,1,1,232,20,1,1,232,21,0,2,43,232,
+  22,1,1,232,23,1,1,232,24,1,1,232,25,1,1,232,26,1,1,232,27,1,2,196,
+  239,193,88,1,1,232,28,1,1,232,29,1,1,232,30,1,1,232,31,1,1,232,32,1,
+  1,198,251,2,2,145,99,4,1,101,1,1,232,33,0,2,43,232,34,1,4,37,177,100,
+  192,242,1,1,232,35,1,1,232,36,1,1,197,32,1,1,232,37,1,1,232,38,1,1,
+  232,39,1,1,232,40,1,1,232,41,1,1,232,42,1,1,232,43,1,1,232,44,1,1,
+  199,234,1,1,200,87,1,1,232,45,0,2,43,232,46,1,1,232,47,1,3,192,9,145,
+  178,1,1,232,48,1,1,232,49,1,4,2,193,51,110,55,2,2,232,50,232,51,2,3,
+  189,206,134,194,46,2,2,172,194,46,2,3,39,110,55,2,5,107,39,189,110,55,3,4,
+  37,189,110,55,2,3,232,52,206,134,194,46,2,3,37,110,55,2,3,192,240,110,55,2,
+  5,113,39,189,110,55,0,8,43,2,113,39,66,107,37,194,46,3,4,37,189,110,55,4,
+  4,66,107,39,194,46,2,2,83,194,46,1,1,232,53,1,1,232,54,1,1,232,55,0,
+  2,101,192,245,1,3,87,192,213,232,56,3,1,206,135,3,1,232,57,3,1,206,136,3,
+  1,232,58,3,1,232,59,3,1,232,60,3,1,232,61,0,4,101,87,192,213,232,62,3,
+  1,232,63,3,1,232,64,3,1,232,65,3,1,232,66,3,1,232,67,3,1,232,68,3,
+  1,232,69,3,1,232,70,3,1,232,71,3,1,232,72,3,1,232,73,3,1,232,74,3,
+  1,206,137,3,1,232,75,3,1,232,76,0,4,101,87,192,213,232,77,3,1,232,78,3,
+  1,232,79,3,1,232,80,3,1,232,81,3,1,232,82,3,1,232,83,3,1,232,84,3,
+  1,232,85,3,1,232,86,3,1,232,87,3,1,232,88,3,1,232,89,3,1,232,90,3,
+  1,232,91,3,1,232,92,0,4,101,87,192,213,232,93,3,1,232,94,3,1,232,95,1,
+  1,232,96,1,1,232,97,1,2,59,192,242,1,2,115,192,6,1,3,196,78,189,194,87,
+  1,3,85,193,162,49,1,3,78,59,192,4,2,1,192,6,1,1,197,172,1,1,232,98,
+  1,1,232,99,1,1,232,100,1,1,198,64,0,2,101,232,101,1,2,72,193,227,2,1,
+  232,102,2,1,182,1,1,195,110,1,4,7,5,0,20,4,1,62,4,1,192,52,4,1,
+  192,20,4,1,56,4,1,192,113,4,1,192,2,4,1,192,18,4,1,58,4,1,192,83,
+  4,1,192,6,0,5,101,7,5,0,112,4,1,178,4,1,152,4,1,53,4,1,192,58,
+  4,1,192,175,4,1,98,4,1,99,4,1,192,5,4,1,46,4,1,192,9,4,1,192,
+  77,4,1,192,57,4,1,192,35,4,1,192,27,2,3,3,0,192,20,0,3,101,193,133,
+  24,2,1,192,26,1,1,232,103,1,1,193,252,1,1,197,94,1,1,192,54,1,1,194,
+  3,1,1,198,129,1,4,49,134,192,224,192,58,1,1,97,1,1,232,104,1,3,194,134,
+  189,194,87,1,1,195,12,1,1,232,105,1,2,195,107,197,103,1,3,128,193,162,49,0,
+  2,101,232,106,1,2,194,61,192,58,1,2,3,120,1,1,232,107,1,1,43,1,1,198,
+  60,1,2,65,192,20,1,1,22,1,3,200,182,193,162,54,1,2,54,192,6,1,1,232,
+  108,1,4,96,2,193,170,42,1,1,232,109,1,1,232,110,1,1,205,244,0,4,205,127,
+  55,91,27,0,1,232,111,0,1,232,112,0,3,196,0,74,232,113,2,1,232,114,0,2,
+  206,46,195,118,0,2,232,115,193,232,0,3,192,171,24,196,141,1,1,193,64,1,2,74,
+  232,116,1,1,192,242,1,4,2,39,110,55,2,3,37,110,55,0,1,232,117,0,3,232,
+  118,74,232,119,0,2,205,77,204,9,0,2,232,120,199,140,0,3,232,121,192,209,192,104,
+  0,1,232,122,0,2,195,243,195,216,2,2,206,138,39,3,1,37,2,3,2,232,123,193,
+  79,3,1,204,25,0,2,199,243,197,52,0,1,232,124,0,2,193,63,206,139,0,1,232,
+  125,0,1,232,126,0,4,197,125,196,74,63,192,171,0,3,232,127,194,132,66,0,2,232,
+  128,205,203,0,2,232,129,204,156,0,1,232,130,0,2,193,29,115,1,2,193,64,1,1,
+  1,85,1,1,78,1,2,39,192,247,1,1,193,252,1,1,133,1,1,49,1,2,97,1,
+  1,2,37,192,247,1,1,128,1,1,117,1,1,65,1,1,54,1,1,192,33,0,4,193,
+  181,38,91,27,2,1,193,181,2,1,193,182,1,1,74,2,4,38,194,85,164,66,3,2,
+  193,64,1,3,3,192,146,164,66,3,2,184,192,242,2,3,192,26,164,66,5,3,2,59,
+  38,2,4,2,192,146,164,66,1,2,2,59,2,3,194,193,1,57,2,3,97,1,57,0,
+  1,194,199,1,4,38,194,85,164,66,0,4,194,199,38,193,64,1,2,4,192,146,194,85,
+  164,66,3,2,164,66,2,3,196,215,193,64,1,3,3,192,146,164,66,1,4,195,47,192,
+  146,194,132,66,1,3,192,26,164,66,2,2,194,132,66,1,2,195,93,198,247,0,2,197,
+  131,193,51,1,1,192,240,1,2,2,193,193,0,1,194,94,1,2,201,59,195,64,1,2,
+  2,104,0,2,192,118,194,92,0,4,192,118,192,49,1,232,131,3,1,232,132,3,1,232,
+  133,3,2,206,140,167,4,1,192,109,1,2,14,115,2,1,85,2,1,78,2,1,133,2,
+  1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,2,0,20,0,3,
+  192,118,0,193,85,2,1,192,32,2,1,193,2,2,1,192,107,2,1,191,2,1,56,2,
+  1,195,149,2,1,193,18,2,2,50,192,6,3,1,178,2,1,192,3,2,1,129,2,1,
+  58,2,1,192,102,2,1,90,2,1,192,144,0,3,192,118,0,170,2,1,206,141,2,1,
+  167,2,1,173,2,1,192,95,2,1,192,145,2,1,53,2,1,150,2,1,194,11,2,1,
+  154,2,1,232,134,2,1,182,2,1,232,135,2,1,180,2,1,46,2,1,192,194,0,3,
+  192,118,0,192,109,2,1,194,129,2,1,176,2,1,192,221,1,4,192,4,194,182,192,32,
+  199,10,3,1,205,62,3,2,191,199,10,3,2,90,199,10,3,2,206,141,199,10,3,1,
+  232,136,3,1,232,137,3,1,232,138,1,2,1,232,139,2,1,232,140,2,1,232,141,2,
+  1,232,142,0,3,192,118,1,193,20,1,3,16,1,232,143,3,1,232,144,3,1,232,145,
+  3,1,232,146,3,1,232,147,3,1,232,148,0,1,232,149,0,1,206,142,1,2,145,232,
+  150,0,3,232,151,145,205,42,0,1,232,152,0,2,193,145,115,1,2,193,64,1,1,1,
+  85,1,1,78,0,5,193,145,7,3,0,58,4,1,152,1,2,39,192,247,1,1,193,252,
+  1,1,133,1,1,49,1,2,97,1,1,2,37,192,247,1,1,128,1,1,117,1,1,65,
+  1,1,54,1,1,192,33,0,4,193,182,38,108,27,2,1,193,181,2,1,193,182,0,8,
+  193,182,195,27,24,197,159,194,236,193,21,2,193,181,2,1,193,181,1,1,74,2,4,38,
+  194,85,164,66,3,2,193,64,1,3,3,192,146,164,66,3,2,184,192,242,2,3,192,26,
+  164,66,5,3,2,59,38,2,4,2,192,146,164,66,1,2,206,67,193,204,1,2,2,59,
+  2,3,194,193,1,57,2,3,97,1,57,0,1,232,153,0,2,201,40,193,193,0,1,232,
+  154,0,1,232,155,0,2,200,42,198,225,0,1,232,156,0,3,196,110,195,172,192,150,0,
+  1,232,157,0,2,232,158,193,21,0,4,192,255,193,0,0,20,3,1,206,143,3,1,194,
+  250,3,1,195,15,3,1,194,211,3,1,204,111,3,1,200,102,3,1,206,144,3,1,194,
+  5,0,4,192,255,193,0,0,56,3,1,203,1,3,1,194,155,3,1,193,158,3,1,58,
+  3,1,232,159,3,1,195,8,3,1,194,229,3,1,193,196,3,1,194,10,3,1,193,231,
+  3,1,193,28,3,1,53,3,1,195,29,3,1,194,41,3,1,193,179,0,4,192,255,193,
+  0,0,206,145,3,1,193,180,3,1,193,253,3,1,66,3,1,198,57,3,1,199,183,3,
+  1,46,2,2,199,11,197,174,3,1,197,175,3,1,206,84,3,1,232,160,2,3,1,193,
+  24,206,146,3,1,192,203,3,1,232,161,3,1,206,146,2,3,16,1,20,0,5,192,255,
+  193,0,16,1,56,4,1,58,4,1,192,233,4,1,46,0,3,11,40,206,147,2,1,232,
+  162,2,1,196,35,2,1,203,76,2,2,232,163,197,155,2,3,232,164,205,149,206,148,2,
+  1,206,149,3,2,15,54,2,3,199,12,196,169,78,4,1,49,4,1,65,4,1,54,0,
+  5,11,40,193,103,74,185,4,1,195,113,4,1,206,150,5,1,114,2,1,232,165,2,1,
+  206,148,2,2,197,89,193,171,2,2,15,200,181,2,2,204,201,193,171,2,2,172,206,151,
+  2,2,192,124,200,181,2,2,232,166,232,167,2,2,192,15,206,147,2,1,201,13,2,1,
+  205,230,2,2,202,175,193,171,0,4,11,40,192,166,199,246,2,2,206,152,192,158,3,1,
+  194,106,2,1,193,242,2,3,197,31,74,232,168,4,1,195,113,2,1,206,153,3,2,15,
+  54,2,2,232,169,232,170,2,3,198,189,20,232,171,2,2,194,208,193,171,2,2,83,206,
+  151,0,1,232,172,0,1,232,173,0,3,192,42,194,21,42,1,1,232,174,0,4,192,42,
+  193,90,199,13,39,3,1,37,1,1,232,175,1,3,193,14,206,154,232,176,3,1,172,1,
+  3,193,103,74,197,121,1,2,206,155,38,2,1,57,1,2,204,149,59,1,2,201,60,232,
+  177,2,1,232,178,2,1,232,179,1,2,206,156,38,2,1,57,1,2,232,180,193,14,1,
+  2,172,193,90,0,3,192,42,0,206,157,2,1,194,69,2,1,206,158,2,3,193,249,206,
+  158,201,33,2,1,56,2,2,50,206,159,2,1,206,160,3,1,206,161,2,1,193,19,2,
+  1,194,121,2,1,194,96,2,1,232,181,2,2,147,193,2,3,1,192,102,3,1,193,154,
+  3,1,196,140,0,4,192,42,0,147,192,95,3,1,192,251,3,1,197,63,3,1,192,145,
+  3,1,154,3,1,193,33,3,1,192,214,2,1,198,226,2,1,192,177,2,1,192,238,2,
+  2,192,208,205,161,3,1,232,182,3,1,232,183,2,1,232,184,2,2,192,56,192,238,2,
+  1,201,33,0,3,192,42,0,194,103,2,1,206,159,2,1,193,86,2,2,192,60,194,213,
+  3,1,205,162,3,1,232,185,2,2,193,145,206,157,2,1,194,70,2,1,195,28,3,1,
+  206,161,2,1,193,11,2,1,206,162,3,1,193,19,2,1,194,88,1,1,198,227,1,3,
+  194,77,192,124,38,0,4,192,42,194,77,192,124,57,1,2,201,61,38,2,1,57,2,1,
+  193,14,1,1,232,186,1,2,206,163,38,2,1,57,1,1,232,187,1,1,232,188,1,2,
+  201,62,193,90,3,2,199,13,37,2,2,192,209,192,104,1,2,201,63,193,90,3,2,199,
+  13,39,2,2,192,209,192,104,1,3,65,140,38,0,4,192,42,65,140,57,1,4,54,83,
+  140,38,4,1,57,1,2,201,64,38,2,1,57,2,1,193,14,0,1,232,189,0,1,232,
+  190,0,1,232,191,0,5,200,10,206,164,232,192,24,194,218,0,1,232,193,0,2,190,195,
+  172,1,1,195,111,1,1,192,245,1,2,192,75,192,132,1,1,193,90,0,2,190,192,168,
+  1,2,197,110,193,160,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,
+  128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,2,196,32,1,1,2,193,64,1,
+  1,2,193,170,42,1,2,192,209,192,104,0,3,190,192,127,192,132,1,2,192,172,1,1,
+  1,198,138,1,4,7,5,0,20,4,1,62,4,1,192,52,4,1,192,20,4,1,56,4,
+  1,192,113,4,1,192,2,4,1,192,18,4,1,58,4,1,192,83,4,1,192,6,4,1,
+  112,4,1,178,0,5,190,7,5,0,152,4,1,53,4,1,192,58,4,1,192,175,4,1,
+  98,4,1,99,4,1,192,5,4,1,46,4,1,192,9,4,1,192,77,4,1,192,57,4,
+  1,192,35,4,1,192,27,2,3,3,0,20,4,1,62,4,1,192,52,0,5,190,7,3,
+  0,192,20,4,1,56,4,1,192,113,4,1,192,2,4,1,192,18,4,1,58,4,1,192,
+  83,4,1,192,6,4,1,112,4,1,178,4,1,152,4,1,53,4,1,192,58,4,1,192,
+  175,4,1,98,4,1,99,0,5,190,7,3,0,192,5,4,1,46,4,1,192,9,4,1,
+  192,77,4,1,192,57,4,1,192,35,4,1,192,27,1,3,39,193,61,130,2,1,192,247,
+  2,2,43,130,1,2,192,173,1,1,2,135,192,124,1,2,29,1,1,2,197,30,1,1,
+  2,97,1,1,2,193,127,42,0,3,190,193,124,42,1,2,193,251,193,204,1,3,37,193,
+  61,130,2,1,192,247,2,2,43,130,1,1,194,209,1,1,193,204,1,1,193,242,1,1,
+  184,1,2,83,192,124,0,3,193,225,0,20,2,2,193,30,154,2,1,192,32,2,1,191,
+  2,1,192,3,2,1,129,0,3,193,225,0,58,2,1,90,2,1,170,2,1,167,2,1,
+  173,2,1,192,95,2,1,150,2,1,154,2,1,182,2,1,180,2,1,46,2,1,192,109,
+  2,1,176,1,2,1,204,252,2,1,193,20,1,3,16,1,58,0,4,193,225,16,1,46,
+  0,3,194,60,0,20,2,1,192,32,2,1,191,2,1,192,3,2,1,58,2,1,90,2,
+  1,170,2,1,167,2,1,173,2,1,192,95,2,1,150,2,1,182,2,1,180,2,1,46,
+  2,1,192,109,0,3,194,60,0,176,1,3,16,1,58,3,1,46,0,4,52,192,226,0,
+  20,3,1,192,74,3,1,206,165,3,1,56,3,1,193,13,3,1,195,49,3,1,193,18,
+  3,1,129,3,1,58,3,1,90,3,1,192,144,3,1,170,3,1,167,0,4,52,192,226,
+  0,173,3,1,192,95,3,1,53,3,1,192,233,3,1,150,3,1,192,195,3,1,194,11,
+  3,1,182,3,1,180,3,1,192,167,3,1,195,85,3,1,195,157,3,1,196,84,3,1,
+  195,86,3,1,198,220,3,1,193,123,0,4,52,192,226,0,194,140,3,1,46,3,1,193,
+  219,3,1,192,194,3,1,194,129,3,1,176,1,4,131,31,195,138,59,2,3,192,49,1,
+  192,32,4,2,50,192,95,4,5,139,201,65,192,26,135,150,4,3,170,232,194,198,218,4,
+  2,135,150,4,1,167,4,2,192,12,170,5,1,154,4,1,182,0,5,52,131,195,102,14,
+  115,4,1,85,4,1,78,4,1,133,4,1,49,4,1,128,4,1,117,4,1,65,4,1,
+  54,4,1,192,33,2,2,0,20,3,1,192,32,3,1,191,3,1,193,13,3,2,196,221,
+  182,3,2,139,192,107,0,5,52,131,0,139,192,142,4,1,193,18,4,1,129,4,1,90,
+  4,1,192,144,4,1,200,104,4,1,150,4,1,192,195,4,1,201,65,4,1,182,4,1,
+  192,101,4,1,193,33,4,1,180,4,1,192,167,4,1,176,3,1,58,0,4,52,131,0,
+  192,80,3,1,170,3,1,205,248,3,1,193,154,3,2,135,192,107,4,1,192,142,4,1,
+  193,18,4,1,129,4,1,90,4,1,192,144,4,1,200,104,4,1,150,4,1,192,195,4,
+  1,201,65,4,1,182,4,1,180,0,5,52,131,0,135,192,167,4,1,176,3,1,192,62,
+  3,1,167,3,1,173,3,1,192,95,3,1,192,145,3,1,192,233,3,1,154,3,1,206,
+  166,3,1,232,195,3,1,232,196,3,1,46,3,1,192,103,3,1,192,109,2,2,1,232,
+  197,0,4,52,131,1,232,198,3,1,232,199,3,1,232,200,3,1,232,201,3,1,232,202,
+  3,1,232,203,3,2,201,66,195,157,4,1,196,84,4,1,195,86,3,2,232,204,232,205,
+  3,2,193,243,198,210,5,1,198,218,4,1,200,235,4,1,232,206,3,2,154,232,207,3,
+  3,192,56,192,152,206,166,0,4,52,131,1,232,208,3,1,232,209,3,1,232,210,3,1,
+  232,211,3,1,197,160,3,1,195,85,3,1,232,212,3,1,232,213,2,3,131,14,115,4,
+  1,85,4,1,78,4,1,133,4,1,49,4,1,128,4,1,117,4,1,65,0,5,52,131,
+  131,14,54,4,1,192,33,2,3,16,1,20,4,1,192,45,4,1,193,85,4,1,192,74,
+  4,1,56,4,1,58,4,1,192,80,4,2,193,243,201,17,4,1,53,4,2,197,135,38,
+  5,1,57,4,1,192,233,4,1,199,204,4,2,196,200,192,45,0,6,52,131,16,1,131,
+  192,74,4,1,46,4,1,193,219,4,1,192,103,4,1,200,84,1,4,192,111,0,139,194,
+  250,4,1,195,15,4,1,194,211,4,1,194,5,4,1,195,18,4,1,194,155,4,1,193,
+  158,4,1,206,167,4,1,194,229,4,1,193,196,4,1,194,10,0,5,52,192,111,0,139,
+  193,231,4,1,196,48,4,1,193,28,4,1,195,154,4,1,53,4,1,195,29,4,1,194,
+  41,4,1,193,179,4,1,193,180,4,1,193,253,4,1,66,4,1,195,50,4,1,193,94,
+  3,2,135,194,250,4,1,195,15,4,1,194,211,0,5,52,192,111,0,135,194,5,4,1,
+  195,18,4,1,194,155,4,1,193,158,4,1,206,167,4,1,194,229,4,1,193,196,4,1,
+  194,10,4,1,193,231,4,1,196,48,4,1,193,28,4,1,195,154,4,1,53,4,1,195,
+  29,4,1,194,41,4,1,193,179,0,5,52,192,111,0,135,193,180,4,1,193,253,4,1,
+  66,4,1,195,50,4,1,193,94,2,2,193,243,198,210,3,1,232,214,2,3,11,193,158,
+  232,215,3,2,201,67,201,67,3,1,205,100,3,1,206,168,3,1,200,235,2,3,136,193,
+  243,196,219,4,1,206,168,4,1,232,216,4,1,193,253,0,4,52,192,111,16,192,45,3,
+  1,195,44,3,1,193,53,3,1,206,165,3,1,194,228,3,1,56,3,1,58,3,1,198,
+  222,3,1,53,3,1,46,3,1,196,175,3,1,193,219,3,1,232,217,0,2,232,218,100,
+  0,3,192,141,194,21,1,1,2,14,115,0,3,192,141,14,85,2,1,78,2,1,133,2,
+  1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,2,0,20,2,1,
+  192,45,2,1,192,74,2,2,193,30,192,144,2,1,192,98,2,1,192,32,2,1,193,2,
+  0,3,192,141,0,192,107,2,1,192,142,2,1,191,2,1,192,220,2,1,193,25,2,1,
+  192,232,2,1,56,2,1,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,2,
+  1,192,102,2,1,193,60,2,1,90,2,1,192,144,0,3,192,141,0,170,2,1,167,2,
+  1,173,2,1,192,95,2,1,192,251,2,1,192,145,2,1,53,2,1,150,2,1,192,195,
+  2,1,154,2,1,194,6,2,1,182,2,1,192,101,2,1,180,2,1,192,167,2,1,192,
+  214,0,3,192,141,0,193,12,2,1,46,2,1,192,103,2,1,192,194,2,1,176,1,2,
+  1,192,203,2,1,193,191,2,1,193,20,2,1,193,47,1,3,16,1,192,45,3,1,192,
+  74,3,1,192,98,3,1,56,3,1,58,3,1,192,80,3,1,53,0,4,192,141,16,1,
+  46,3,1,192,103,0,3,196,82,42,85,2,1,49,0,1,232,219,0,4,143,24,196,100,
+  1,1,3,194,151,38,1,1,3,192,98,194,116,42,1,2,200,47,1,1,2,199,29,1,
+  1,2,193,100,1,1,2,232,220,1,1,2,14,115,2,1,85,2,1,78,2,1,133,0,
+  3,143,14,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,3,199,34,
+  206,169,1,1,4,192,14,232,221,200,216,232,222,2,2,49,193,46,3,1,232,223,3,1,
+  200,227,3,1,205,154,3,1,232,224,3,1,232,225,3,1,205,155,3,1,193,49,0,4,
+  143,192,14,49,232,226,3,1,232,227,3,1,201,6,3,1,200,228,3,1,201,8,3,1,
+  232,228,3,1,205,156,2,2,65,205,157,3,1,194,135,3,1,198,216,3,1,232,229,3,
+  1,205,158,1,3,192,158,205,23,1,1,2,232,230,1,1,2,0,20,2,1,192,45,0,
+  3,143,0,192,74,2,1,192,98,2,1,192,107,2,1,56,2,1,193,13,2,1,129,2,
+  1,58,2,1,192,80,2,1,192,102,2,1,90,2,1,170,2,1,193,154,2,1,196,140,
+  2,1,167,2,1,173,2,1,192,95,0,3,143,0,192,251,2,1,197,63,2,1,192,145,
+  2,1,53,2,1,192,233,2,1,150,2,1,154,2,1,194,6,2,1,182,2,1,192,101,
+  2,1,193,33,2,1,180,2,1,192,214,2,1,46,2,1,192,103,2,1,192,194,0,3,
+  143,0,176,1,2,199,41,1,1,3,29,49,134,3,1,169,2,1,1,2,1,192,66,1,
+  1,194,186,1,4,192,4,193,103,74,195,113,1,2,195,186,1,1,3,195,45,200,69,1,
+  1,2,1,232,231,2,1,192,203,2,1,232,232,2,1,232,233,2,1,232,234,2,1,232,
+  235,0,3,143,1,232,236,2,1,232,237,2,1,232,238,2,1,232,239,2,1,232,240,2,
+  1,232,241,2,1,232,242,2,1,197,46,2,1,232,243,2,1,232,244,2,1,232,245,2,
+  1,232,246,2,1,193,20,2,1,193,47,1,2,232,247,1,1,3,232,248,193,66,1,0,
+  3,143,206,170,1,1,3,206,171,200,47,1,2,2,29,1,1,3,16,1,192,45,3,1,
+  192,74,3,1,192,98,3,1,56,3,1,193,13,3,1,58,3,1,192,80,3,1,53,3,
+  1,192,233,3,1,46,3,1,192,103,1,3,232,249,206,169,1,1,2,204,199,1,0,2,
+  232,250,195,59,0,1,232,251,0,3,192,47,14,115,2,1,85,2,1,78,2,1,133,2,
+  1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,2,0,197,202,2,
+  1,197,162,2,1,232,252,2,1,232,253,0,3,192,47,0,206,172,2,1,232,254,2,1,
+  206,173,2,1,205,160,2,1,192,32,2,1,192,107,2,1,192,142,2,1,191,2,1,192,
+  232,2,1,197,177,2,1,232,255,2,1,198,26,2,1,197,178,2,1,193,18,2,2,50,
+  194,3,2,1,192,3,0,3,192,47,0,192,239,2,1,129,2,1,205,83,2,1,233,0,
+  2,1,201,11,2,1,201,18,2,1,206,174,2,1,233,1,2,1,90,2,1,192,144,2,
+  1,170,2,2,171,206,175,2,1,167,2,1,206,64,2,1,233,2,2,1,233,3,0,3,
+  192,47,0,233,4,2,1,173,2,1,192,95,2,1,196,103,2,1,192,145,2,1,233,5,
+  2,1,201,20,2,1,198,241,2,1,233,6,2,1,150,2,1,192,195,2,1,154,2,1,
+  182,2,1,192,101,2,2,192,114,206,172,3,1,206,176,0,3,192,47,0,180,2,1,192,
+  167,2,1,193,123,2,1,198,234,2,1,233,7,2,1,233,8,2,1,206,175,2,1,206,
+  176,2,1,233,9,2,1,233,10,2,1,233,11,2,1,233,12,2,1,233,13,2,1,233,
+  14,2,1,233,15,2,1,233,16,0,3,192,47,0,233,17,2,1,233,18,2,1,233,19,
+  2,1,233,20,2,1,233,21,2,1,233,22,2,1,233,23,2,1,192,109,2,1,194,129,
+  2,1,176,2,1,192,221,0,2,17,233,24,1,1,233,25,1,1,233,26,1,1,233,27,
+  1,1,233,28,0,2,17,233,29,1,1,233,30,1,1,233,31,1,1,233,32,1,1,233,
+  33,1,1,233,34,1,1,233,35,1,1,233,36,1,1,233,37,1,1,233,38,1,1,233,
+  39,1,1,233,40,1,1,233,41,1,1,233,42,1,1,233,43,1,1,233,44,0,2,17,
+  233,45,1,1,233,46,1,1,233,47,1,1,233,48,1,1,233,49,1,1,233,50,1,1,
+  233,51,1,1,233,52,1,1,233,53,1,1,233,54,1,1,233,55,1,1,233,56,1,1,
+  233,57,1,1,233,58,1,1,233,59,1,1,233,60,0,2,17,233,61,1,1,233,62,1,
+  1,233,63,1,1,233,64,1,1,233,65,1,1,233,66,1,1,233,67,1,1,233,68,1,
+  1,233,69,1,1,233,70,1,1,233,71,1,1,233,72,1,1,233,73,1,1,233,74,1,
+  1,233,75,1,1,233,76,0,2,17,233,77,1,1,233,78,1,1,233,79,1,1,233,80,
+  1,1,233,81,1,1,233,82,1,1,233,83,1,1,233,84,1,1,233,85,1,1,233,86,
+  1,1,233,87,1,1,233,88,1,1,233,89,1,1,233,90,1,1,233,91,1,1,233,92,
+  0,2,17,233,93,1,1,233,94,1,1,233,95,1,1,233,96,1,1,233,97,1,1,233,
+  98,1,1,233,99,1,1,233,100,1,1,233,101,1,1,233,102,1,1,233,103,1,1,233,
+  104,1,1,233,105,1,1,233,106,1,1,233,107,1,1,233,108,0,2,17,233,109,1,1,
+  233,110,1,1,233,111,1,1,233,112,1,1,233,113,1,1,233,114,1,1,233,115,1,1,
+  233,116,1,1,233,117,1,1,233,118,1,1,233,119,1,1,233,120,1,1,233,121,1,1,
+  233,122,1,1,233,123,1,1,233,124,0,2,17,233,125,1,1,233,126,1,1,233,127,1,
+  1,233,128,1,1,233,129,1,1,233,130,1,1,233,131,1,1,233,132,1,1,233,133,1,
+  1,233,134,1,1,233,135,1,1,233,136,1,1,233,137,1,1,233,138,1,1,233,139,1,
+  1,233,140,0,2,17,233,141,1,1,233,142,1,1,233,143,1,1,233,144,1,1,233,145,
+  1,1,233,146,1,1,233,147,1,1,233,148,1,1,233,149,1,1,233,150,1,1,233,151,
+  1,1,233,152,1,1,233,153,1,1,233,154,1,1,233,155,1,1,233,156,0,2,17,233,
+  157,1,1,233,158,1,1,233,159,1,1,233,160,1,1,233,161,1,1,233,162,1,1,233,
+  163,1,1,233,164,1,1,233,165,1,1,233,166,1,1,233,167,1,1,233,168,1,1,233,
+  169,1,1,233,170,1,1,233,171,1,1,233,172,0,2,17,233,173,1,1,233,174,1,1,
+  233,175,1,1,233,176,1,1,233,177,1,1,233,178,1,1,233,179,1,1,233,180,1,1,
+  233,181,1,1,233,182,1,1,233,183,1,1,233,184,1,1,233,185,1,1,233,186,1,1,
+  233,187,1,1,233,188,0,2,17,233,189,1,1,233,190,1,1,233,191,1,1,233,192,1,
+  1,233,193,1,1,233,194,1,1,233,195,1,1,233,196,1,1,233,197,1,1,233,198,1,
+  1,233,199,1,1,233,200,1,1,233,201,1,1,233,202,1,1,233,203,1,1,233,204,0,
+  2,17,233,205,1,1,233,206,1,1,233,207,1,1,233,208,1,1,233,209,1,1,233,210,
+  1,1,233,211,1,1,233,212,1,1,233,213,1,1,233,214,1,1,233,215,1,1,233,216,
+  1,1,233,217,1,1,233,218,1,1,233,219,1,1,233,220,0,2,17,233,221,1,1,233,
+  222,1,1,233,223,1,1,233,224,1,1,233,225,1,1,233,226,1,1,233,227,1,1,233,
+  228,1,1,233,229,1,1,233,230,1,1,233,231,1,1,233,232,1,1,233,233,1,1,233,
+  234,1,1,233,235,1,1,233,236,0,2,17,233,237,1,1,233,238,1,1,233,239,1,1,
+  233,240,1,1,233,241,1,1,233,242,1,1,233,243,1,1,233,244,1,1,233,245,1,1,
+  233,246,1,1,233,247,1,1,233,248,1,1,233,249,1,1,233,250,1,1,233,251,1,1,
+  233,252,0,2,17,233,253,1,1,233,254,1,1,233,255,1,1,234,0,1,1,234,1,1,
+  1,234,2,1,1,234,3,1,1,234,4,1,1,234,5,1,1,234,6,1,1,234,7,1,
+  1,234,8,1,1,234,9,1,1,234,10,1,1,234,11,1,1,234,12,0,2,17,234,13,
+  1,1,234,14,1,1,234,15,1,1,234,16,1,1,234,17,1,1,234,18,1,1,234,19,
+  1,1,234,20,1,1,234,21,1,1,234,22,1,1,234,23,1,1,234,24,1,1,234,25,
+  1,1,234,26,1,1,234,27,1,1,234,28,0,2,17,234,29,1,1,234,30,1,1,234,
+  31,1,1,234,32,1,1,234,33,1,1,234,34,1,1,234,35,1,1,234,36,1,1,234,
+  37,1,1,234,38,1,1,234,39,1,1,234,40,1,1,234,41,1,1,234,42,1,1,234,
+  43,1,1,234,44,0,2,17,234,45,1,1,234,46,1,1,234,47,1,1,234,48,1,1,
+  234,49,1,1,234,50,1,1,234,51,1,1,234,52,1,1,234,53,1,1,234,54,1,1,
+  234,55,1,1,234,56,1,1,234,57,1,1,234,58,1,1,234,59,1,1,234,60,0,2,
+  17,234,61,1,1,234,62,1,1,234,63,1,1,234,64,1,1,234,65,1,1,234,66,1,
+  1,234,67,1,1,234,68,1,1,234,69,1,1,234,70,1,1,234,71,1,1,234,72,1,
+  1,234,73,1,1,234,74,1,1,234,75,1,1,234,76,0,2,17,234,77,1,1,234,78,
+  1,1,234,79,1,1,234,80,1,1,234,81,1,1,234,82,1,1,234,83,1,1,234,84,
+  1,1,234,85,1,1,234,86,1,1,234,87,1,1,234,88,1,1,234,89,1,1,234,90,
+  1,1,234,91,1,1,234,92,0,2,17,234,93,1,1,234,94,1,1,234,95,1,1,234,
+  96,1,1,234,97,1,1,234,98,1,1,234,99,1,1,234,100,1,1,234,101,1,1,234,
+  102,1,1,234,103,1,1,234,104,1,1,234,105,1,1,234,106,1,1,234,107,1,1,234,
+  108,0,2,17,234,109,1,1,234,110,1,1,234,111,1,1,234,112,1,1,234,113,1,1,
+  234,114,1,1,234,115,1,1,234,116,1,1,234,117,1,1,234,118,1,1,234,119,1,1,
+  234,120,1,1,234,121,1,1,234,122,1,1,234,123,1,1,234,124,0,2,17,234,125,1,
+  1,234,126,1,1,234,127,1,1,234,128,1,1,234,129,1,1,234,130,1,1,234,131,1,
+  1,234,132,1,1,234,133,1,1,234,134,1,1,234,135,1,1,234,136,1,1,234,137,1,
+  1,234,138,1,1,234,139,1,1,234,140,0,2,17,234,141,1,1,234,142,1,1,234,143,
+  1,1,234,144,1,1,234,145,1,1,234,146,1,1,234,147,1,1,234,148,1,1,234,149,
+  1,1,234,150,1,1,234,151,1,1,234,152,1,1,234,153,1,1,234,154,1,1,234,155,
+  1,1,234,156,0,2,17,234,157,1,1,234,158,1,1,234,159,1,1,234,160,1,1,234,
+  161,1,1,234,162,1,1,234,163,1,1,234,164,1,1,234,165,1,1,234,166,1,1,234,
+  167,1,1,234,168,1,1,234,169,1,1,234,170,1,1,234,171,1,1,234,172,0,2,17,
+  234,173,1,1,234,174,1,1,234,175,1,1,234,176,1,1,234,177,1,1,234,178,1,1,
+  234,179,1,1,234,180,1,1,234,181,1,1,234,182,1,1,234,183,1,1,234,184,1,1,
+  234,185,1,1,234,186,1,1,234,187,1,1,234,188,0,2,17,234,189,1,1,234,190,1,
+  1,234,191,1,1,234,192,1,1,234,193,1,1,234,194,1,1,234,195,1,1,234,196,1,
+  1,234,197,1,1,234,198,1,1,234,199,1,1,234,200,1,1,234,201,1,1,234,202,1,
+  1,234,203,1,1,234,204,0,2,17,234,205,1,1,234,206,1,1,234,207,1,1,234,208,
+  1,1,234,209,1,1,234,210,1,1,234,211,1,1,234,212,1,1,234,213,1,1,234,214,
+  1,1,234,215,1,1,234,216,1,1,234,217,1,1,234,218,1,1,234,219,1,1,234,220,
+  0,2,17,234,221,1,1,234,222,1,1,234,223,1,1,234,224,1,1,234,225,1,1,234,
+  226,1,1,234,227,1,1,234,228,1,1,234,229,1,1,234,230,1,1,234,231,1,1,234,
+  232,1,1,234,233,1,1,234,234,1,1,234,235,1,1,234,236,0,2,17,234,237,1,1,
+  234,238,1,1,234,239,1,1,234,240,1,1,234,241,1,1,234,242,1,1,234,243,1,1,
+  234,244,1,1,234,245,1,1,234,246,1,1,234,247,1,1,234,248,1,1,234,249,1,1,
+  234,250,1,1,234,251,1,1,234,252,0,2,17,234,253,1,1,234,254,1,1,234,255,1,
+  1,235,0,1,1,235,1,1,1,235,2,1,1,235,3,1,1,235,4,1,1,235,5,1,
+  1,235,6,1,1,235,7,1,1,235,8,1,1,235,9,1,1,235,10,1,1,235,11,1,
+  1,235,12,0,2,17,235,13,1,1,235,14,1,1,235,15,1,1,235,16,1,1,235,17,
+  1,1,235,18,1,1,235,19,1,1,235,20,1,1,235,21,1,1,235,22,1,1,235,23,
+  1,1,235,24,1,1,235,25,1,1,235,26,1,1,235,27,1,1,235,28,0,2,17,235,
+  29,1,1,235,30,1,1,235,31,1,1,235,32,1,1,235,33,1,1,235,34,1,1,235,
+  35,1,1,235,36,1,1,235,37,1,1,235,38,1,1,235,39,1,1,235,40,1,1,235,
+  41,1,1,235,42,1,1,235,43,1,1,235,44,0,2,17,235,45,1,1,235,46,1,1,
+  235,47,1,1,235,48,1,1,235,49,1,1,235,50,1,1,235,51,1,1,235,52,1,1,
+  235,53,1,1,235,54,1,1,235,55,1,1,235,56,1,1,235,57,1,1,235,58,1,1,
+  235,59,1,1,235,60,0,2,17,235,61,1,1,235,62,1,1,235,63,1,1,235,64,1,
+  1,235,65,1,1,235,66,1,1,235,67,1,1,235,68,1,1,235,69,1,1,235,70,1,
+  1,235,71,1,1,235,72,1,1,235,73,1,1,235,74,1,1,235,75,1,1,235,76,0,
+  2,17,235,77,1,1,235,78,1,1,235,79,1,1,235,80,1,1,235,81,1,1,235,82,
+  1,1,235,83,1,1,235,84,1,1,235,85,1,1,235,86,1,1,235,87,1,1,235,88,
+  1,1,235,89,1,1,235,90,1,1,235,91,1,1,235,92,0,2,17,235,93,1,1,235,
+  94,1,1,235,95,1,1,235,96,1,1,235,97,1,1,235,98,1,1,235,99,1,1,235,
+  100,1,1,235,101,1,1,235,102,1,1,235,103,1,1,235,104,1,1,235,105,1,1,235,
+  106,1,1,235,107,1,1,235,108,0,2,17,235,109,1,1,235,110,1,1,235,111,1,1,
+  235,112,1,1,235,113,1,1,235,114,1,1,235,115,1,1,235,116,1,1,235,117,1,1,
+  235,118,1,1,235,119,1,1,235,120,1,1,235,121,1,1,235,122,1,1,235,123,1,1,
+  235,124,0,2,17,235,125,1,1,235,126,1,1,235,127,1,1,235,128,1,1,235,129,1,
+  1,235,130,1,1,235,131,1,1,235,132,1,1,235,133,1,1,235,134,1,1,235,135,1,
+  1,235,136,1,1,235,137,1,1,235,138,1,1,235,139,1,1,235,140,0,2,17,235,141,
+  1,1,235,142,1,1,235,143,1,1,235,144,1,1,235,145,1,1,235,146,1,1,235,147,
+  1,1,235,148,1,1,235,149,1,1,235,150,1,1,235,151,1,1,235,152,1,1,235,153,
+  1,1,235,154,1,1,235,155,1,1,235,156,0,2,17,235,157,1,1,235,158,1,1,235,
+  159,1,1,235,160,1,1,235,161,1,1,235,162,1,1,235,163,1,1,235,164,1,1,235,
+  165,1,1,235,166,1,1,235,167,1,1,235,168,1,1,235,169,1,1,235,170,1,1,235,
+  171,1,1,235,172,0,2,17,235,173,1,1,235,174,1,1,235,175,1,1,235,176,1,1,
+  235,177,1,1,235,178,1,1,235,179,1,1,235,180,1,1,235,181,1,1,235,182,1,1,
+  235,183,1,1,235,184,1,1,235,185,1,1,235,186,1,1,235,187,1,1,235,188,0,2,
+  17,235,189,1,1,235,190,1,1,235,191,1,1,235,192,1,1,235,193,1,1,235,194,1,
+  1,235,195,1,1,235,196,1,1,235,197,1,1,235,198,1,1,235,199,1,1,235,200,1,
+  1,235,201,1,1,235,202,1,1,235,203,1,1,235,204,0,2,17,235,205,1,1,235,206,
+  1,1,235,207,1,1,235,208,1,1,235,209,1,1,235,210,1,1,235,211,1,1,235,212,
+  1,1,235,213,1,1,235,214,1,1,235,215,1,1,235,216,1,1,235,217,1,1,235,218,
+  1,1,235,219,1,1,235,220,0,2,17,235,221,1,1,235,222,1,1,235,223,1,1,235,
+  224,1,1,235,225,1,1,235,226,1,1,235,227,1,1,235,228,1,1,235,229,1,1,235,
+  230,1,1,235,231,1,1,235,232,1,1,235,233,1,1,235,234,1,1,235,235,1,1,235,
+  236,0,2,17,235,237,1,1,235,238,1,1,235,239,1,1,235,240,1,1,235,241,1,1,
+  235,242,1,1,235,243,1,1,235,244,1,1,235,245,1,1,235,246,1,1,235,247,1,1,
+  235,248,1,1,235,249,1,1,235,250,1,1,235,251,1,1,235,252,0,2,17,235,253,1,
+  1,235,254,1,1,235,255,1,1,236,0,1,1,236,1,1,1,236,2,1,1,236,3,1,
+  1,236,4,1,1,236,5,1,1,236,6,1,1,236,7,1,1,236,8,1,1,236,9,1,
+  1,236,10,1,1,236,11,1,1,236,12,0,2,17,236,13,1,1,236,14,1,1,236,15,
+  1,1,236,16,1,1,236,17,1,1,236,18,1,1,236,19,1,1,236,20,1,1,236,21,
+  1,1,236,22,1,1,236,23,1,2,195,156,42,0,2,206,177,236,24,1,1,204,26,0,
+  1,236,25,0,1,206,25,0,3,236,26,197,140,205,125,0,1,236,27,0,2,236,28,199,
+  167,0,3,236,29,91,27,0,2,196,75,192,245,0,2,236,30,202,162,0,3,194,225,196,
+  4,1,1,4,192,135,192,240,74,236,31,1,1,198,202,2,2,2,195,79,1,1,236,32,
+  1,1,1,0,1,236,33,0,1,236,34,0,4,192,8,192,74,194,116,42,1,2,14,115,
+  0,3,192,8,14,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,
+  2,1,54,2,1,192,33,1,8,192,14,14,49,40,196,157,196,101,74,78,5,4,196,100,
+  196,101,74,78,3,6,65,40,196,157,196,101,74,78,5,4,196,100,196,101,74,78,3,6,
+  54,40,196,157,196,101,74,78,5,4,196,100,196,101,74,78,3,6,192,33,40,196,100,196,
+  101,74,78,0,3,192,8,194,116,42,1,2,0,20,2,1,192,45,2,1,192,74,2,1,
+  192,98,2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,
+  220,2,1,193,25,2,1,192,232,2,1,194,189,2,1,56,2,1,193,13,0,3,192,8,
+  0,192,3,2,1,192,239,2,1,129,2,1,58,2,1,192,80,2,1,192,102,2,1,193,
+  60,2,1,90,2,1,192,144,2,1,170,2,1,193,154,2,1,196,140,2,1,167,2,1,
+  173,2,2,205,81,205,82,2,1,192,95,0,3,192,8,0,192,251,2,1,192,145,2,1,
+  53,2,1,192,233,2,1,150,2,1,192,195,2,1,154,2,1,194,6,2,1,236,35,2,
+  1,182,2,1,192,101,2,1,193,33,2,1,180,2,1,192,167,2,1,193,123,2,1,192,
+  214,0,3,192,8,0,193,12,2,1,46,2,1,192,103,2,1,192,194,2,2,123,112,3,
+  1,193,73,3,1,98,3,1,193,34,2,1,176,1,2,1,192,203,2,1,194,92,2,1,
+  193,82,2,3,31,192,203,38,3,2,193,82,38,2,1,193,191,2,1,192,16,0,3,192,
+  8,1,236,36,2,1,193,20,2,1,193,47,1,3,16,1,192,45,3,1,192,74,3,1,
+  192,98,3,1,56,3,1,193,13,3,1,58,3,1,192,80,3,1,53,3,1,192,233,3,
+  1,46,3,1,192,103,3,2,123,112,4,1,193,73,0,5,192,8,16,1,123,98,4,1,
+  193,34,0,2,236,37,1,0,4,206,164,202,64,24,194,218,0,1,199,248,0,2,236,38,
+  236,39,0,3,192,78,40,236,40,2,1,236,41,2,1,236,42,2,1,236,43,2,1,236,
+  44,2,2,25,236,45,2,2,236,46,194,106,2,1,192,147,2,1,236,47,2,2,193,3,
+  192,228,0,3,192,78,40,236,48,2,1,236,49,2,1,200,170,2,1,236,50,2,1,236,
+  51,2,1,196,244,2,1,236,52,2,1,236,53,2,1,205,21,2,1,236,54,2,3,236,
+  55,192,26,236,56,2,1,201,98,2,1,236,57,2,1,236,58,2,1,236,59,2,1,236,
+  60,0,3,192,78,40,236,61,2,1,236,62,2,1,236,63,2,1,236,64,2,1,236,65,
+  2,1,236,66,2,1,236,67,2,1,200,219,2,1,236,68,2,1,236,69,2,1,236,70,
+  2,1,205,22,2,1,236,71,2,2,192,209,120,2,1,236,72,2,1,200,171,0,4,192,
+  78,40,200,171,192,158,2,3,236,73,66,205,20,2,1,236,74,2,1,236,75,2,1,236,
+  76,2,2,196,208,194,215,2,1,200,173,2,1,205,26,2,1,199,226,2,2,205,29,3,
+  2,1,236,77,2,1,236,78,2,3,202,116,192,26,236,79,2,1,236,80,2,1,236,81,
+  2,1,196,18,0,3,192,78,40,236,82,2,3,192,135,193,1,236,83,2,1,200,174,2,
+  1,236,84,2,1,68,2,1,236,85,2,1,236,86,2,1,206,43,2,1,236,87,2,1,
+  236,88,2,1,236,89,2,1,206,65,2,1,236,90,2,1,236,91,2,1,236,92,2,1,
+  236,93,0,3,192,78,40,236,94,2,1,236,95,2,1,236,96,2,3,236,97,192,26,236,
+  98,2,1,205,30,2,1,206,178,2,1,236,99,0,2,192,223,236,100,1,1,236,101,1,
+  1,236,102,1,1,236,103,1,1,236,104,1,1,236,105,1,2,0,236,106,2,1,236,107,
+  2,1,198,62,0,3,192,223,0,236,108,2,1,236,109,2,1,236,110,2,1,236,111,2,
+  1,236,112,2,1,236,113,2,1,236,114,2,1,236,115,2,1,195,19,2,1,204,130,2,
+  1,236,116,2,1,236,117,2,1,203,91,2,1,236,118,2,1,236,119,2,1,236,120,0,
+  3,192,223,0,196,121,2,1,236,121,2,1,236,122,2,1,236,123,2,1,197,84,2,1,
+  236,124,2,1,236,125,2,1,236,126,2,1,236,127,2,1,236,128,2,1,197,87,2,1,
+  236,129,2,1,66,2,1,203,94,2,1,236,130,2,1,236,131,0,3,192,223,0,196,125,
+  2,1,204,135,2,1,236,132,2,1,194,220,1,1,236,133,1,1,236,134,1,1,236,135,
+  1,1,195,180,1,1,236,136,0,3,192,55,192,28,236,137,2,2,194,250,236,138,2,2,
+  195,15,236,139,3,1,236,140,3,1,236,141,3,1,236,142,2,2,194,5,236,143,0,4,
+  192,55,192,28,194,5,236,144,2,2,195,18,193,18,3,1,205,183,2,1,236,145,2,2,
+  193,158,196,243,3,1,236,146,2,2,194,229,205,213,3,1,236,147,3,1,236,148,3,1,
+  236,149,3,1,236,150,2,1,236,151,2,2,193,196,196,146,2,1,236,152,2,2,194,10,
+  236,153,3,1,205,97,0,3,192,55,192,28,193,174,2,2,193,243,236,154,3,1,196,219,
+  3,1,236,155,3,1,193,253,3,1,236,156,2,1,236,157,2,1,236,158,2,2,193,231,
+  167,2,2,196,48,236,159,2,1,236,160,2,2,193,28,199,88,3,1,193,92,2,2,53,
+  194,185,2,1,236,161,2,1,236,162,0,4,192,55,192,28,195,29,236,163,3,1,236,164,
+  3,1,236,165,2,2,194,41,198,211,2,2,193,179,236,166,2,1,193,217,2,2,194,172,
+  20,3,1,192,45,3,1,193,85,3,2,192,74,236,167,4,1,236,168,3,1,195,44,3,
+  1,56,3,1,58,3,1,192,80,3,1,53,0,4,192,55,192,28,194,172,46,3,1,193,
+  219,3,1,236,169,3,1,192,103,2,2,193,180,236,170,3,1,236,171,3,1,193,180,3,
+  1,201,12,2,1,236,172,2,2,193,253,236,173,3,1,236,174,3,1,236,175,3,1,196,
+  131,3,1,206,179,3,1,236,176,2,2,66,236,177,0,4,192,55,192,28,66,236,178,2,
+  2,193,208,236,179,2,1,236,180,2,2,193,94,201,68,3,1,236,181,1,3,195,53,11,
+  236,182,1,2,14,115,2,1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,
+  2,1,65,2,1,54,2,1,192,33,0,4,206,180,194,248,192,146,236,183,1,1,236,184,
+  0,1,236,185,0,1,236,186,0,1,204,146,0,3,197,224,33,192,211,1,1,195,12,1,
+  1,193,242,0,2,236,187,104,0,3,194,174,196,25,197,141,0,2,206,179,206,181,0,2,
+  200,218,199,77,0,3,65,196,136,196,85,1,3,206,182,193,64,206,183,1,2,236,188,192,
+  156,1,2,59,192,4,0,3,65,108,194,62,1,3,200,195,206,184,39,3,1,37,1,2,
+  236,189,236,190,1,3,193,52,55,192,171,1,2,195,11,38,2,1,57,2,1,39,2,1,
+  37,1,2,91,194,62,1,2,196,52,199,143,0,4,196,249,236,191,91,192,97,1,4,236,
+  192,183,193,205,192,97,1,4,236,193,187,193,205,192,97,1,4,201,69,108,193,205,192,97,
+  2,2,91,192,97,0,5,196,249,201,69,91,193,205,192,97,0,2,236,194,193,21,0,2,
+  236,195,193,242,0,3,198,248,116,1,1,2,96,1,0,4,200,175,195,64,24,196,53,0,
+  1,236,196,0,5,84,195,166,1,236,197,150,3,2,236,198,236,199,3,4,236,200,236,201,
+  236,202,194,206,1,4,199,14,1,236,203,236,204,3,2,75,206,185,3,2,122,206,185,3,
+  2,236,205,236,206,1,2,14,115,2,1,85,0,3,84,14,78,2,2,110,115,3,1,85,
+  3,1,78,3,1,133,3,1,49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,
+  33,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,0,3,84,14,54,2,1,192,
+  33,1,3,193,230,193,217,192,144,4,3,201,70,206,186,194,163,1,2,0,196,229,2,1,
+  20,2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,
+  2,1,193,25,2,1,192,232,2,1,194,189,2,1,197,171,0,4,84,0,199,15,154,2,
+  1,192,3,2,1,192,239,2,1,129,2,1,192,102,2,1,90,2,1,192,144,2,1,199,
+  173,2,1,197,169,2,1,170,2,1,167,2,1,173,2,1,192,95,2,1,192,251,2,1,
+  192,145,2,1,150,0,3,84,0,192,195,2,1,154,2,1,194,6,2,1,182,2,1,192,
+  101,2,1,193,33,2,1,180,2,1,192,167,2,1,193,123,2,1,194,140,2,1,192,214,
+  2,1,193,12,2,1,192,109,2,1,176,2,1,192,221,2,1,193,236,0,5,84,206,187,
+  1,236,207,194,206,3,2,236,208,194,206,1,4,42,194,185,206,188,206,189,4,1,206,190,
+  2,4,236,209,206,191,194,255,194,144,2,2,236,210,194,206,2,5,236,211,206,191,193,210,
+  194,144,206,192,2,3,236,212,194,255,194,144,2,6,195,46,206,193,194,206,201,70,206,186,
+  194,163,5,3,193,80,171,194,163,3,5,194,255,194,144,206,194,194,104,167,2,2,193,209,
+  194,144,2,7,197,157,206,195,206,196,194,255,194,144,206,197,167,3,4,194,255,194,144,206,
+  197,167,2,3,198,204,195,39,236,213,2,2,197,189,195,39,0,9,84,42,197,189,194,255,
+  194,144,206,198,197,189,195,39,167,6,3,206,199,206,200,167,5,2,236,214,20,2,3,206,
+  201,194,206,206,189,4,1,206,190,2,1,200,88,2,7,86,206,195,206,196,194,255,194,144,
+  206,202,167,3,4,194,255,194,144,206,202,167,2,2,236,215,195,39,2,3,236,216,206,203,
+  194,206,2,5,236,217,194,255,193,210,194,144,206,192,2,4,206,204,206,205,194,153,206,206,
+  4,2,236,218,194,206,2,2,199,16,194,104,3,1,195,39,4,1,194,104,0,3,84,42,
+  236,219,2,3,206,207,206,208,194,104,2,4,236,220,236,221,236,222,194,104,2,2,236,223,
+  194,104,2,1,194,104,2,3,236,224,206,203,194,206,2,2,193,123,236,225,2,2,195,39,
+  194,104,2,5,194,255,194,144,195,39,194,104,167,1,4,1,206,209,194,163,206,210,3,2,
+  236,226,206,210,2,3,192,143,199,17,194,163,2,3,206,211,193,123,194,163,2,2,236,227,
+  194,206,2,2,203,215,206,212,2,2,199,17,194,163,0,6,84,1,194,153,206,206,196,121,
+  191,2,3,195,103,197,190,206,213,4,1,206,214,4,1,201,71,4,2,195,103,197,191,3,
+  2,197,191,206,213,4,1,206,214,4,1,201,71,4,2,195,103,197,190,2,4,236,228,193,
+  235,192,95,193,179,2,2,206,199,206,200,2,2,236,229,236,230,2,2,194,247,194,206,2,
+  2,206,215,206,212,1,3,192,61,0,196,229,3,1,20,0,4,84,192,61,0,192,32,3,
+  1,193,2,3,1,192,107,3,1,192,142,3,1,191,3,1,192,220,3,1,193,25,3,1,
+  192,232,3,1,194,189,3,1,197,171,3,2,199,15,154,4,1,192,109,4,1,176,3,1,
+  192,3,3,1,192,239,3,1,129,0,4,84,192,61,0,192,102,3,1,90,3,1,192,144,
+  3,1,197,169,3,1,170,3,1,167,3,1,173,3,1,192,95,3,1,192,251,3,1,192,
+  145,3,1,150,3,1,192,195,3,1,154,3,1,182,3,1,192,101,3,1,193,33,0,4,
+  84,192,61,0,180,3,1,192,167,3,1,193,123,3,1,194,140,3,1,192,214,3,1,193,
+  12,3,1,192,109,3,1,176,3,1,192,221,3,1,193,236,2,4,1,192,143,199,17,194,
+  163,3,3,206,211,193,123,194,163,3,2,199,17,194,163,1,2,4,194,186,1,3,11,236,
+  231,193,176,2,2,194,166,193,176,0,6,84,11,194,166,193,176,201,70,201,72,4,2,201,
+  71,201,72,4,2,199,16,201,72,2,2,236,232,236,233,2,2,206,194,150,2,2,206,216,
+  206,217,4,2,206,207,206,208,1,3,16,1,192,45,3,1,56,3,1,193,13,3,1,58,
+  3,1,192,80,3,1,53,3,1,192,233,3,2,192,56,58,4,1,192,80,0,4,84,16,
+  1,46,3,1,192,103,3,2,123,112,4,1,193,73,4,1,98,4,1,193,34,0,1,236,
+  234,0,3,196,153,145,196,165,0,3,192,178,192,49,196,38,1,3,0,236,235,201,73,2,
+  2,236,236,201,74,2,3,206,218,206,219,199,8,4,1,201,24,2,2,236,237,206,220,2,
+  2,196,12,201,74,3,1,236,238,0,4,192,178,0,196,12,199,8,3,1,201,68,3,1,
+  206,221,3,1,194,247,3,1,206,222,3,1,201,73,2,1,176,2,1,196,125,2,1,236,
+  239,2,1,236,240,2,1,236,241,2,1,236,242,2,1,236,243,2,1,236,244,2,1,236,
+  245,2,1,236,246,0,3,192,178,0,236,247,2,1,201,74,2,1,236,248,2,1,199,8,
+  2,1,236,249,2,1,201,24,2,1,201,68,2,1,206,221,2,1,236,250,2,1,236,251,
+  2,1,206,41,2,1,205,146,2,1,202,150,2,1,206,222,2,1,206,215,2,1,236,252,
+  0,3,192,178,0,236,253,2,1,236,254,2,1,236,255,2,1,195,135,2,1,237,0,2,
+  1,237,1,2,1,237,2,2,1,237,3,2,1,203,75,2,1,206,220,2,1,201,73,2,
+  1,237,4,2,1,194,91,2,1,237,5,2,1,9,2,1,193,94,0,3,192,178,0,193,
+  27,1,4,61,0,237,6,42,1,2,193,171,42,0,1,198,73,1,1,104,0,3,200,96,
+  237,7,200,161,0,1,184,1,1,192,242,2,3,38,108,27,3,2,91,27,2,3,2,59,
+  38,3,2,194,134,140,1,3,2,59,38,3,1,57,2,2,159,38,0,2,237,8,193,155,
+  0,5,22,2,39,110,55,2,3,37,110,55,0,1,197,58,1,6,54,140,145,49,59,192,
+  4,0,2,237,9,104,0,3,192,73,194,21,1,1,1,199,122,1,2,14,115,2,1,85,
+  2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,0,3,192,
+  73,14,192,33,1,1,237,10,1,2,0,20,2,1,192,45,2,1,192,74,2,1,192,98,
+  2,1,192,32,2,1,193,2,2,1,192,107,2,1,192,142,2,1,191,2,1,192,220,2,
+  1,193,25,2,1,192,232,2,1,56,2,1,192,3,0,3,192,73,0,192,239,2,1,129,
+  2,1,58,2,1,192,80,2,1,192,102,2,1,193,60,2,1,90,2,1,192,144,2,1,
+  170,2,1,167,2,1,173,2,1,192,95,2,1,192,251,2,1,192,145,2,1,53,2,1,
+  150,0,3,192,73,0,192,195,2,1,154,2,1,182,2,1,192,101,2,1,193,33,2,1,
+  180,2,1,192,167,2,1,192,214,2,1,193,12,2,1,46,2,1,192,103,2,1,192,194,
+  2,2,123,112,3,1,193,73,3,1,98,3,1,193,34,0,3,192,73,0,176,1,1,194,
+  186,1,2,1,192,203,2,1,194,92,2,1,193,82,2,1,193,191,2,1,193,20,2,1,
+  193,47,1,3,16,1,192,45,3,1,192,74,3,1,192,98,3,1,56,3,1,58,3,1,
+  192,80,3,1,53,3,2,192,114,56,0,5,192,73,16,1,192,114,53,3,1,46,3,1,
+  192,103,3,2,123,112,4,1,193,73,4,1,98,4,1,193,34,0,4,206,223,1,5,194,
+  177,2,1,194,177,0,1,237,11,0,2,237,12,237,13,0,1,237,14,0,1,194,79,0,
+  1,237,15,0,1,198,66,0,1,237,16,0,4,192,240,194,4,193,247,27,4,2,2,97,
+  2,4,194,98,27,2,193,252,1,2,193,61,130,1,3,110,55,120,2,1,193,193,2,2,
+  39,192,247,2,2,37,192,247,2,2,193,42,1,1,1,196,58,1,2,39,193,56,2,1,
+  198,20,2,2,110,130,1,1,192,247,1,2,37,193,56,2,1,198,20,0,4,192,240,37,
+  110,130,1,2,43,130,1,3,193,177,193,93,130,1,4,2,187,27,38,0,6,193,177,193,
+  93,195,104,87,192,213,206,135,5,1,206,136,5,1,237,17,5,1,237,18,5,1,206,137,
+  5,1,237,19,5,1,237,20,5,1,237,21,5,1,237,22,3,4,7,5,0,99,0,2,
+  206,170,237,23,0,3,193,115,0,20,0,3,193,115,0,193,85,2,1,192,32,2,2,197,
+  192,193,85,3,1,56,3,1,197,151,3,1,58,3,1,197,61,2,1,192,142,2,1,191,
+  2,1,56,2,1,197,151,2,1,192,3,2,1,129,2,1,58,2,1,197,61,2,1,192,
+  102,0,3,193,115,0,90,2,1,170,2,1,167,2,1,173,2,1,192,95,2,1,53,2,
+  1,150,2,1,154,2,1,182,2,1,180,2,1,46,2,1,192,109,2,1,176,1,3,1,
+  194,134,136,0,1,237,24,0,1,237,25,0,3,237,26,42,1,0,1,200,177,0,1,206,
+  224,1,1,195,201,0,1,237,27,0,2,237,28,194,48,0,4,174,2,59,38,2,2,194,
+  112,196,223,2,3,198,76,193,160,193,51,2,1,193,192,0,3,192,92,91,27,0,2,193,
+  245,194,154,1,3,194,224,192,135,200,115,1,1,206,139,0,1,203,188,0,2,197,2,237,
+  29,0,3,196,13,40,194,84,2,1,195,1,2,1,198,114,2,1,205,28,2,1,195,247,
+  2,1,200,175,2,1,194,146,2,1,195,20,0,3,192,174,193,90,192,242,1,1,196,72,
+  1,6,172,119,2,51,83,71,4,3,192,174,83,71,1,1,193,193,1,2,197,130,192,172,
+  2,1,192,173,1,1,97,0,2,192,174,194,249,1,3,193,204,206,225,198,247,1,1,184,
+  1,4,83,119,206,225,198,247,3,1,198,204,3,2,37,195,235,3,3,2,172,71,0,1,
+  237,30,0,1,237,31,0,1,237,32,0,2,206,226,205,164,1,1,195,62,0,1,201,15,
+  1,3,122,193,128,237,33,0,1,237,34,0,2,237,35,1,0,1,237,36,0,2,237,37,
+  196,161,0,1,237,38,0,3,237,39,205,150,1,0,2,160,195,172,1,1,192,156,1,2,
+  55,197,57,2,2,198,17,195,188,1,2,5,192,113,1,1,192,168,1,1,196,72,1,2,
+  14,65,2,1,54,1,4,33,3,0,192,199,1,4,188,192,157,192,89,193,238,2,3,192,
+  196,192,89,193,238,0,3,160,192,146,1,1,3,198,129,193,105,1,1,3,48,5,192,2,
+  3,1,112,3,1,192,35,1,1,194,209,1,2,3,192,113,1,4,192,50,192,157,192,89,
+  193,238,2,3,192,196,192,89,193,238,1,3,63,198,17,195,188,0,1,197,96,0,4,194,
+  124,193,52,55,192,171,0,3,237,40,91,194,62,0,4,54,237,41,237,42,195,177,1,2,
+  196,136,196,85,1,3,206,182,193,64,206,183,0,3,54,59,201,22,2,1,192,4,1,5,
+  140,145,49,59,192,4,1,1,194,82,1,3,206,227,193,133,24,3,1,192,26,1,2,197,
+  159,198,240,1,3,193,133,24,192,242,2,2,192,26,192,242,1,3,195,6,196,208,195,133,
+  1,2,196,52,199,143,1,3,237,43,196,208,195,133,0,2,237,44,193,21,0,3,193,116,
+  0,192,252,2,1,237,45,2,1,194,28,0,3,193,116,0,194,2,2,1,237,46,2,1,
+  237,47,2,1,193,173,2,1,193,158,2,1,237,48,2,1,58,2,1,192,219,2,1,192,
+  144,2,1,194,164,2,1,194,26,2,1,192,177,2,1,194,181,2,1,237,49,2,1,237,
+  50,2,1,206,51,0,3,193,116,0,237,51,2,1,193,86,2,1,200,110,2,1,196,28,
+  2,1,237,52,2,1,66,2,1,46,2,1,193,208,2,1,195,84,2,1,194,201,2,1,
+  194,230,1,2,193,215,196,176,0,1,197,54,1,2,192,135,204,35,1,3,2,196,53,237,
+  53,0,2,237,54,104,0,2,237,55,1,0,1,205,58,0,2,237,56,11,0,2,237,57,
+  104,0,1,194,12,1,4,38,119,38,194,48,2,1,194,48,1,5,195,27,24,197,159,2,
+  194,12,1,3,2,193,133,192,26,2,2,193,252,1,2,1,194,175,0,2,237,58,11,0,
+  3,202,187,195,56,11,0,3,237,59,206,44,11,0,4,96,27,194,136,120,1,1,192,97,
+  0,6,96,192,97,193,175,54,172,197,6,2,4,192,158,20,195,126,100,1,6,186,39,116,
+  186,39,192,153,5,2,37,192,153,2,5,37,116,186,39,192,153,5,2,37,192,153,1,2,
+  116,27,3,2,2,197,208,2,2,55,27,2,2,51,27,2,2,48,27,2,2,192,92,27,
+  2,2,63,27,1,2,195,62,192,169,1,3,37,189,195,236,1,1,193,69,0,5,96,193,
+  69,2,120,38,0,2,194,64,195,171,1,2,200,249,195,171,1,2,194,34,174,1,2,3,
+  195,171,2,2,194,34,174,1,5,174,2,39,110,55,3,3,37,110,55,0,9,113,24,39,
+  24,107,193,245,65,194,135,114,2,4,107,49,193,46,114,3,3,193,245,110,114,2,7,37,
+  24,107,193,245,65,194,135,114,1,2,205,152,196,135,1,3,85,194,139,114,1,2,110,114,
+  3,6,24,107,110,195,33,185,194,130,0,3,113,110,120,2,7,195,33,185,194,130,24,107,
+  110,114,3,2,63,120,2,2,185,194,130,1,9,39,114,189,107,192,147,66,107,76,37,7,
+  3,113,76,37,8,1,37,5,5,39,66,107,76,37,7,2,113,192,147,8,2,76,37,5,
+  5,76,39,66,113,192,147,9,2,76,37,9,1,37,4,6,113,76,39,66,113,192,147,9,
+  1,37,2,3,193,56,2,59,0,8,113,39,192,26,107,37,193,61,130,193,42,2,3,193,
+  211,197,168,194,4,2,4,66,107,37,194,46,2,1,174,2,3,193,245,185,194,130,1,3,
+  49,193,46,114,2,2,193,49,114,1,9,37,114,189,107,76,39,66,107,192,147,9,1,37,
+  4,6,113,192,147,66,107,76,37,8,1,37,7,3,113,76,37,5,4,39,66,107,192,147,
+  8,2,76,37,7,3,113,76,37,5,5,76,39,66,107,192,147,0,11,113,37,114,189,113,
+  76,39,66,107,76,37,9,1,37,2,3,205,153,63,43,2,6,192,26,107,39,193,61,130,
+  193,42,2,1,198,213,2,3,193,211,197,168,194,4,2,3,194,178,63,120,4,1,43,2,
+  4,66,107,39,194,46,2,1,174,2,3,193,245,185,194,130,1,3,128,194,139,114,1,3,
+  65,194,139,114,2,2,194,135,114,1,4,193,245,49,193,49,114,0,2,237,60,104,0,2,
+  187,204,24,1,1,27,2,5,24,37,49,193,46,114,2,2,193,66,119,2,4,108,74,183,
+  27,2,2,66,119,2,3,2,51,71,3,2,193,205,192,97,3,2,172,71,3,3,192,34,
+  174,192,97,3,3,185,174,192,97,3,2,195,78,192,169,3,3,3,193,205,192,97,4,2,
+  174,192,97,3,2,193,255,108,4,1,91,0,3,187,55,27,2,3,45,63,27,1,2,195,
+  237,27,1,2,194,197,27,1,2,51,27,1,2,198,116,27,1,10,192,153,2,186,39,195,
+  27,183,192,153,2,186,37,6,5,187,192,153,2,186,37,5,2,193,66,119,5,2,66,119,
+  4,1,108,4,3,37,193,66,119,5,2,66,119,4,1,91,1,2,75,27,2,2,195,237,
+  27,0,3,187,195,238,194,62,1,2,195,14,27,1,1,197,133,1,2,48,27,1,2,101,
+  27,1,2,174,192,97,1,2,192,92,27,3,5,108,74,183,192,92,27,3,2,66,119,3,
+  3,2,25,193,183,4,3,51,172,71,4,2,75,193,183,4,3,171,193,255,108,6,1,91,
+  4,2,185,193,183,4,2,196,199,193,183,0,7,187,192,92,27,2,193,104,75,193,183,2,
+  2,194,197,27,2,2,195,238,194,62,1,2,192,174,27,1,3,54,198,117,27,1,5,194,
+  35,27,193,66,3,120,3,3,2,174,198,118,1,2,63,27,3,2,193,66,119,5,3,2,
+  172,119,3,2,192,135,199,18,5,3,2,172,119,6,2,83,119,3,3,196,24,174,192,97,
+  2,2,51,27,4,2,192,135,199,18,0,1,202,55,0,2,60,192,168,1,2,14,115,2,
+  1,85,2,1,78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,
+  1,192,33,1,2,192,209,192,104,1,2,193,127,42,1,2,4,20,2,1,193,53,0,3,
+  60,4,192,32,2,1,194,113,2,1,196,201,2,1,193,2,2,1,197,204,2,1,237,61,
+  2,1,237,62,2,1,206,143,2,1,237,63,2,1,237,64,2,1,194,33,2,1,194,250,
+  2,1,205,184,2,1,193,176,2,1,192,107,2,1,195,117,0,3,60,4,204,109,2,1,
+  198,44,2,1,194,211,2,1,199,184,2,1,200,101,2,1,191,2,1,193,227,2,1,196,
+  148,2,1,192,232,2,1,197,37,2,1,237,65,2,1,237,66,2,1,237,67,2,1,237,
+  68,2,1,237,69,2,1,237,70,0,3,60,4,237,71,2,1,237,72,2,1,237,73,2,
+  1,206,144,2,1,237,74,2,1,237,75,2,1,194,24,2,1,194,5,2,1,205,195,2,
+  1,194,25,2,1,56,2,1,193,13,2,1,237,76,2,1,192,188,2,1,193,18,2,1,
+  194,213,0,3,60,4,196,26,2,1,195,17,2,1,195,18,2,1,199,189,2,1,195,119,
+  2,1,192,3,2,1,200,237,2,1,197,205,2,1,205,182,2,1,237,77,2,1,205,188,
+  2,1,205,177,2,1,237,78,2,1,205,178,2,1,199,116,2,1,195,51,0,3,60,4,
+  197,70,2,1,237,79,2,1,193,210,2,1,194,155,2,1,237,80,2,1,194,65,2,1,
+  129,2,1,205,189,2,1,193,19,2,1,198,37,2,1,205,173,2,1,193,57,2,1,205,
+  174,2,1,193,158,2,1,200,246,2,1,197,79,0,3,60,4,194,158,2,1,205,180,2,
+  1,58,2,1,192,158,2,1,192,102,2,1,194,214,2,1,196,149,2,1,195,190,2,1,
+  195,8,2,1,205,194,2,1,196,45,2,1,90,2,1,196,213,2,1,193,250,2,1,200,
+  103,2,1,193,203,0,3,60,4,193,196,2,1,197,75,2,1,197,42,2,1,237,81,2,
+  1,205,185,2,1,205,172,2,1,237,82,2,1,205,190,2,1,197,206,2,1,205,186,2,
+  1,205,179,2,1,193,230,2,1,170,2,1,192,226,2,1,198,40,2,1,197,203,0,3,
+  60,4,192,149,2,1,194,10,2,1,196,152,2,1,193,174,2,1,167,2,1,197,47,2,
+  1,198,1,2,1,197,252,2,1,199,103,2,1,200,244,2,1,200,240,2,1,199,99,2,
+  1,193,80,2,1,199,174,2,1,202,141,2,1,237,83,0,3,60,4,237,84,2,1,237,
+  85,2,1,237,86,2,1,237,87,2,1,237,88,2,1,193,119,2,1,193,231,2,1,199,
+  194,2,1,193,31,2,1,173,2,1,196,122,2,1,198,122,2,1,199,107,2,1,200,243,
+  2,1,200,238,2,2,197,193,194,5,0,4,60,4,197,193,193,18,3,1,90,3,1,167,
+  3,1,197,86,2,1,205,176,2,1,197,245,2,1,193,71,2,1,199,175,2,1,194,3,
+  2,1,237,89,2,1,205,196,2,1,197,43,2,1,200,239,2,1,205,187,2,1,199,89,
+  2,1,205,181,0,3,60,4,200,242,2,1,200,241,2,1,199,105,2,1,205,175,2,1,
+  193,72,2,1,205,193,2,1,195,233,2,1,197,44,2,1,196,123,2,1,206,228,2,1,
+  205,191,2,1,200,245,2,1,193,28,2,1,199,203,2,1,193,92,2,1,192,145,0,3,
+  60,4,199,68,2,1,204,131,2,1,194,153,2,1,195,154,2,1,237,90,2,1,200,106,
+  2,1,53,2,1,192,135,2,1,192,233,2,1,237,91,2,1,150,2,1,192,238,2,1,
+  195,120,2,1,192,210,2,1,194,41,2,1,197,81,0,3,60,4,194,181,2,1,154,2,
+  1,194,39,2,1,197,51,2,1,194,86,2,1,193,179,2,1,203,46,2,1,193,217,2,
+  1,182,2,1,193,228,2,1,196,29,2,1,192,101,2,1,192,246,2,1,197,250,2,1,
+  196,150,2,1,195,7,0,3,60,4,199,209,2,1,194,115,2,1,193,218,2,1,193,180,
+  2,1,197,86,2,1,193,235,2,1,180,2,1,193,54,2,1,196,202,2,1,192,167,2,
+  1,193,1,2,1,197,73,2,1,196,46,2,1,193,253,2,1,199,212,2,1,199,176,0,
+  3,60,4,194,22,2,1,66,2,1,196,128,2,1,193,190,2,1,46,2,1,195,143,2,
+  1,192,194,2,1,194,63,2,1,195,185,2,1,195,108,2,1,195,50,2,1,205,192,2,
+  1,196,34,2,1,192,109,2,1,237,92,2,1,193,178,0,3,60,4,198,43,2,1,237,
+  93,2,1,237,94,2,1,193,234,2,1,237,95,2,1,193,208,2,1,200,129,2,1,197,
+  78,2,1,237,96,2,1,195,16,2,1,237,97,2,1,176,2,1,194,91,2,1,196,151,
+  2,1,9,2,1,193,94,0,3,60,4,198,58,2,1,193,27,2,1,192,221,2,1,193,
+  229,2,1,197,74,2,1,193,236,2,1,194,90,2,1,198,111,2,1,200,111,2,1,200,
+  112,2,1,237,98,2,1,200,113,2,1,195,13,2,1,194,220,2,1,206,82,2,1,194,
+  230,0,3,60,11,237,99,2,1,197,233,2,1,237,100,2,1,237,101,2,1,197,247,2,
+  1,237,102,2,1,237,103,2,1,237,104,2,1,237,105,2,1,203,35,2,1,196,30,2,
+  1,237,106,2,1,237,107,0,1,237,108,0,2,67,237,109,1,1,237,110,0,2,67,237,
+  111,1,1,237,112,1,1,237,113,1,1,237,114,1,1,237,115,1,1,237,116,1,1,237,
+  117,1,1,237,118,1,1,237,119,1,1,237,120,1,1,237,121,1,1,237,122,1,1,237,
+  123,1,1,237,124,1,1,237,125,1,1,237,126,0,2,67,237,127,1,1,237,128,1,1,
+  237,129,1,1,237,130,1,1,237,131,1,1,237,132,1,1,237,133,1,1,237,134,1,1,
+  237,135,1,1,237,136,1,1,237,137,1,1,237,138,1,1,237,139,1,1,237,140,1,1,
+  237,141,1,1,237,142,0,2,67,237,143,1,1,237,144,1,1,237,145,1,1,237,146,1,
+  1,237,147,1,1,237,148,1,1,237,149,1,1,237,150,1,1,237,151,1,1,237,152,1,
+  1,237,153,1,1,237,154,1,1,237,155,1,1,237,156,1,1,237,157,1,1,237,158,0,
+  2,67,237,159,1,1,237,160,1,1,237,161,1,1,237,162,1,1,237,163,1,1,237,164,
+  1,1,237,165,1,1,237,166,1,1,237,167,1,1,237,168,1,1,237,169,1,1,237,170,
+  1,1,237,171,1,1,237,172,1,1,237,173,1,1,237,174,0,2,67,237,175,1,1,237,
+  176,1,1,237,177,1,1,237,178,1,1,237,179,1,1,237,180,1,1,237,181,1,1,237,
+  182,1,1,237,183,1,1,237,184,1,1,237,185,1,1,237,186,1,1,237,187,1,1,237,
+  188,1,1,237,189,1,1,237,190,0,2,67,237,191,1,1,237,192,1,1,237,193,1,1,
+  237,194,1,1,237,195,1,1,237,196,1,1,237,197,1,1,237,198,1,1,237,199,1,1,
+  237,200,1,1,237,201,1,1,237,202,1,1,237,203,1,1,237,204,1,1,237,205,1,1,
+  237,206,0,2,67,237,207,1,1,237,208,1,1,237,209,1,1,237,210,1,1,237,211,1,
+  1,237,212,1,1,237,213,1,1,237,214,1,1,237,215,1,1,237,216,1,1,237,217,1,
+  1,237,218,1,1,237,219,1,1,237,220,1,1,237,221,1,1,237,222,0,2,67,237,223,
+  1,1,237,224,1,1,237,225,1,1,237,226,1,1,237,227,1,1,237,228,1,1,237,229,
+  1,1,237,230,1,1,237,231,1,1,237,232,1,1,237,233,1,1,237,234,1,1,237,235,
+  1,1,237,236,1,1,237,237,1,1,237,238,0,2,67,237,239,1,1,237,240,1,1,237,
+  241,1,1,237,242,1,1,237,243,1,1,237,244,1,1,237,245,1,1,237,246,1,1,237,
+  247,1,1,237,248,1,1,237,249,1,1,237,250,1,1,237,251,1,1,237,252,1,1,237,
+  253,1,1,237,254,0,2,67,237,255,1,1,238,0,1,1,238,1,1,1,238,2,1,1,
+  238,3,1,1,238,4,1,1,238,5,1,1,238,6,1,1,238,7,1,1,238,8,1,1,
+  238,9,1,1,238,10,1,1,238,11,1,1,238,12,1,1,238,13,1,1,238,14,0,2,
+  67,238,15,1,1,238,16,1,1,238,17,1,1,238,18,1,1,238,19,1,1,238,20,1,
+  1,238,21,1,1,238,22,1,1,238,23,1,1,238,24,1,1,238,25,1,1,238,26,1,
+  1,238,27,1,1,238,28,1,1,238,29,1,1,238,30,0,2,67,238,31,1,1,238,32,
+  1,1,238,33,1,1,238,34,1,1,238,35,1,1,238,36,1,1,238,37,1,1,238,38,
+  1,1,238,39,1,1,238,40,1,1,238,41,1,1,238,42,1,1,238,43,1,1,238,44,
+  1,1,238,45,1,1,238,46,0,2,67,238,47,1,1,238,48,1,1,238,49,1,1,238,
+  50,1,1,238,51,1,1,238,52,1,1,238,53,1,1,238,54,1,1,238,55,1,1,238,
+  56,1,1,238,57,1,1,238,58,1,1,238,59,1,1,238,60,1,1,238,61,1,1,238,
+  62,0,2,67,238,63,1,1,238,64,1,1,238,65,1,1,238,66,1,1,238,67,1,1,
+  238,68,1,1,238,69,1,1,238,70,1,1,238,71,1,1,238,72,1,1,238,73,1,1,
+  238,74,1,1,238,75,1,1,238,76,1,1,238,77,1,1,238,78,0,2,67,238,79,1,
+  1,238,80,1,1,238,81,1,1,238,82,1,1,238,83,1,1,238,84,1,1,238,85,1,
+  1,238,86,1,1,238,87,1,1,238,88,1,1,238,89,1,1,238,90,1,1,238,91,1,
+  1,238,92,1,1,238,93,1,1,238,94,0,2,67,238,95,1,1,238,96,1,1,238,97,
+  1,1,238,98,1,1,238,99,1,1,238,100,1,1,238,101,1,1,238,102,1,1,238,103,
+  1,1,238,104,1,1,238,105,1,1,238,106,1,1,238,107,1,1,238,108,0,4,238,109,
+  192,26,192,211,194,194,0,4,192,234,1,192,203,206,229,0,4,192,234,1,192,203,238,110,
+  3,2,238,111,238,112,3,1,206,230,4,2,2,192,169,2,1,206,231,2,1,238,113,2,
+  3,51,192,203,206,229,2,3,238,114,171,192,203,2,1,196,142,2,2,171,192,203,2,1,
+  238,115,2,3,192,56,193,47,197,126,4,1,198,113,2,2,192,152,206,231,2,3,238,116,
+  171,192,203,2,1,238,117,0,3,192,234,1,196,143,2,2,193,47,197,126,4,2,2,192,
+  169,3,1,195,105,3,1,198,113,4,2,2,192,169,2,3,197,194,205,204,195,105,1,4,
+  136,238,118,193,214,195,105,2,2,194,114,38,3,1,57,2,2,59,57,2,3,51,159,38,
+  3,1,195,105,2,1,238,119,2,2,201,75,197,126,2,1,238,120,0,6,192,234,136,238,
+  121,202,30,193,214,195,105,2,2,159,38,2,1,238,122,2,3,65,140,57,2,2,192,174,
+  195,105,2,3,54,140,57,2,4,197,194,238,123,193,214,195,105,3,2,193,214,195,105,3,
+  3,201,75,193,214,195,105,6,1,238,124,0,1,238,125,0,5,83,119,195,27,37,174,2,
+  3,51,39,195,235,2,3,192,174,37,195,235,2,3,2,172,71,1,1,195,236,0,3,83,
+  78,140,1,3,158,195,156,42,1,3,197,195,195,132,42,4,2,107,110,4,2,113,110,3,
+  4,2,195,65,194,66,42,7,2,113,110,1,1,192,124,2,1,195,231,2,3,2,120,38,
+  4,1,57,3,2,76,59,1,4,195,60,2,71,1,1,3,49,193,46,205,35,3,1,205,
+  36,3,1,205,37,0,4,83,49,193,46,205,38,3,1,205,39,3,1,205,40,1,2,117,
+  140,1,2,195,71,195,110,1,1,184,1,2,197,5,122,1,2,194,240,192,124,0,4,193,
+  104,25,33,192,211,1,5,75,115,193,52,55,192,171,3,2,194,43,192,245,2,3,85,194,
+  43,192,245,2,2,33,192,211,2,2,193,251,193,204,2,1,195,12,2,3,117,194,43,192,
+  245,0,3,193,104,75,193,204,2,2,63,120,3,1,43,1,2,197,48,192,172,2,1,192,
+  173,0,1,238,126,0,2,238,127,238,128,0,2,206,68,193,105,0,2,206,232,198,33,1,
+  1,204,163,0,1,238,129,0,5,206,233,193,24,206,234,42,192,107,4,1,238,130,0,2,
+  238,131,43,0,1,238,132,0,1,238,133,0,4,192,128,5,0,20,3,1,197,138,3,1,
+  194,113,3,1,195,117,3,1,193,209,3,1,193,227,3,1,197,37,3,1,56,3,1,195,
+  127,3,1,194,213,3,1,192,3,3,1,129,3,1,195,153,3,1,58,3,1,206,235,3,
+  1,194,214,0,4,192,128,5,0,90,3,1,170,3,1,193,154,3,1,193,80,3,1,193,
+  71,3,1,195,233,3,1,53,3,1,192,238,3,1,194,11,3,1,194,39,3,1,193,228,
+  3,1,192,246,3,1,193,54,3,1,193,1,3,1,46,3,1,194,63,0,4,192,128,5,
+  0,196,116,3,1,192,35,3,1,193,229,1,3,3,0,20,3,1,197,138,3,1,194,113,
+  3,1,195,117,3,1,193,209,3,1,193,227,3,1,197,37,3,1,56,3,1,195,127,3,
+  1,194,213,3,1,192,3,3,1,129,3,1,195,153,0,4,192,128,3,0,58,3,1,206,
+  235,3,1,194,214,3,1,90,3,1,170,3,1,193,154,3,1,193,80,3,1,193,71,3,
+  1,195,233,3,1,53,3,1,192,238,3,1,194,11,3,1,194,39,3,1,193,228,3,1,
+  192,246,3,1,193,54,0,4,192,128,3,0,193,1,3,1,46,3,1,194,63,3,1,196,
+  116,3,1,192,35,3,1,193,229,0,3,238,134,33,192,211,0,1,238,135,0,1,238,136,
+  0,2,238,137,193,193,0,1,238,138,0,4,194,37,192,14,85,194,139,3,1,203,185,2,
+  2,78,201,76,2,2,49,193,46,3,1,200,227,0,4,194,37,192,14,49,110,3,1,238,
+  139,3,1,193,49,3,1,238,140,3,1,200,51,3,1,200,228,3,1,194,174,2,2,128,
+  194,139,2,2,65,194,139,3,1,201,76,3,1,194,135,2,2,54,201,76,3,1,195,140,
+  2,2,192,33,195,140,0,1,238,141,0,3,192,179,14,115,0,3,192,179,14,85,2,1,
+  78,2,1,133,2,1,49,2,1,128,2,1,117,2,1,65,2,1,54,2,1,192,33,1,
+  2,0,20,2,1,192,45,2,1,202,58,2,1,238,142,2,1,194,185,2,1,192,98,2,
+  1,192,32,0,3,192,179,0,192,107,2,1,191,2,1,56,2,1,192,188,2,1,193,18,
+  2,1,192,3,2,1,129,2,1,58,2,1,200,248,2,1,192,102,2,1,90,2,1,192,
+  144,2,1,170,2,1,238,143,2,1,167,2,1,173,0,3,192,179,0,192,95,2,1,192,
+  145,2,1,53,2,1,192,135,2,1,202,194,2,1,150,2,1,192,195,2,1,154,2,1,
+  182,2,1,192,101,2,1,180,2,1,192,167,2,1,200,225,2,1,193,123,2,1,46,2,
+  1,238,144,0,3,192,179,0,192,194,2,1,192,109,2,1,176,2,1,238,145,2,1,192,
+  221,1,2,238,146,1,1,2,136,201,67,2,1,238,147,2,1,206,236,2,1,238,148,0,
+  4,206,237,196,141,193,128,11,1,3,206,238,193,128,11,0,5,192,64,192,65,5,0,20,
+  4,1,195,44,4,1,194,185,4,1,193,160,0,5,192,64,192,65,5,0,193,176,4,1,
+  191,4,1,56,4,1,199,136,4,1,196,238,4,1,192,3,4,1,196,212,4,1,206,239,
+  4,1,206,240,4,1,206,241,4,1,192,80,4,1,193,196,4,1,198,51,4,1,200,236,
+  4,1,53,4,1,196,100,0,5,192,64,192,65,5,0,194,181,4,1,197,85,4,1,206,
+  242,4,1,197,38,4,1,198,234,4,1,192,103,4,1,206,243,4,1,193,234,4,1,176,
+  4,1,193,94,4,1,193,27,4,1,206,244,2,2,14,115,3,1,85,3,1,78,3,1,
+  133,0,4,192,64,192,65,14,49,3,1,128,3,1,117,3,1,65,3,1,54,3,1,192,
+  33,2,2,29,194,110,3,1,193,68,3,1,193,153,3,1,193,41,3,1,193,77,3,1,
+  194,61,3,1,192,66,3,1,193,117,3,1,192,224,2,1,194,186,0,5,192,64,192,65,
+  3,0,20,4,1,195,44,4,1,194,185,4,1,193,160,4,1,193,176,4,1,191,4,1,
+  56,4,1,199,136,4,1,196,238,4,1,192,3,4,1,196,212,4,1,206,239,4,1,206,
+  240,4,1,206,241,4,1,192,80,4,1,193,196,0,5,192,64,192,65,3,0,198,51,4,
+  1,200,236,4,1,53,4,1,196,100,4,1,194,181,4,1,197,85,4,1,206,242,4,1,
+  197,38,4,1,198,234,4,1,192,103,4,1,206,243,4,1,193,234,4,1,176,4,1,193,
+  94,4,1,193,27,4,1,206,244,0,2,238,149,1,0,1,238,150,0,1,206,178,0,2,
+  194,146,238,151,1,1,238,152,1,1,238,153,1,1,193,87,0,1,238,154,0,5,193,87,
+  27,192,89,206,245,39,4,1,37,1,1,193,21,0,3,201,77,55,194,224,1,2,193,105,
+  1,1,2,63,194,224,0,2,195,4,193,21,1,1,192,124,0,3,195,4,135,192,124,1,
+  1,195,202,0,4,206,246,196,141,193,128,11,1,3,206,238,193,128,11,0,3,206,247,194,
+  191,104,1,1,104,0,1,238,155,0,3,205,4,91,27,0,2,196,104,238,156,0,3,192,
+  196,192,42,192,211,0,1,206,131,0,1,198,131,1,2,74,238,157,0,2,200,232,11,0,
+  5,63,27,193,183,195,31,49,4,2,54,195,140,0,2,63,194,154,1,2,192,24,194,221,
+  3,3,192,152,193,41,192,204,4,4,54,134,193,77,192,204,2,1,196,134,3,3,192,152,
+  193,41,192,204,2,1,194,42,3,3,192,152,193,41,192,204,4,4,54,134,193,77,192,204,
+  2,1,193,147,3,3,192,152,199,125,192,204,4,2,193,41,192,204,4,4,49,134,199,126,
+  192,204,4,4,65,134,195,10,192,204,4,4,54,134,193,77,192,204,6,2,198,10,192,204,
+  0,3,63,192,24,202,172,2,1,202,173,2,1,202,174,2,1,194,222,3,3,192,152,193,
+  41,192,204,4,4,54,134,193,77,192,204,2,1,194,93,3,3,192,152,193,41,192,204,4,
+  4,54,134,193,77,192,204,2,1,194,223,3,3,192,152,193,41,192,204,4,4,54,134,193,
+  77,192,204,2,2,160,194,221,3,1,194,42,3,1,193,147,3,1,194,222,0,4,63,192,
+  24,160,194,93,3,1,194,223,1,1,120,2,4,195,169,55,3,120,2,3,2,59,37,3,
+  2,116,27,3,3,107,39,193,211,4,2,37,193,211,3,2,54,140,3,3,113,39,193,211,
+  4,2,37,193,211,1,2,199,127,195,124,1,2,201,78,192,241,3,3,2,108,195,75,4,
+  2,91,195,75,1,1,192,241,0,6,63,192,241,195,169,55,185,192,241,4,2,3,192,241,
+  4,3,193,104,3,192,241,2,2,192,158,43,2,1,195,124,2,3,2,195,125,59,1,4,
+  116,192,89,195,187,106,3,1,106,3,3,39,193,105,106,1,3,194,183,3,174,2,1,174,
+  1,2,198,12,194,42,2,1,193,233,1,3,193,170,42,192,150,1,1,194,224,2,5,2,
+  172,76,55,238,158,0,2,63,198,13,1,1,197,143,1,3,78,193,52,198,212,3,1,192,
+  171,1,2,198,136,104,1,4,195,55,193,93,198,14,197,56,1,1,193,118,2,1,195,124,
+  1,3,75,194,145,42,2,4,195,12,2,194,112,196,223,1,1,199,129,1,2,172,198,15,
+  1,1,198,16,1,2,192,34,43,1,2,7,192,211,1,3,39,202,177,202,178,0,5,63,
+  39,192,89,195,187,106,3,1,106,1,2,194,8,197,36,2,2,3,174,2,1,174,1,5,
+  194,184,195,169,55,3,194,184,1,2,185,192,241,2,1,194,184,2,2,3,43,2,1,43,
+  2,1,192,171,1,2,193,128,238,159,1,1,202,179,1,1,202,181,1,1,202,182,1,1,
+  197,57,0,4,63,193,127,42,192,150,1,1,195,126,1,4,37,192,89,195,187,106,3,1,
+  106,1,2,193,206,197,57,2,1,197,36,2,2,3,174,2,1,174,1,1,196,135,1,2,
+  206,80,59,1,2,198,17,195,188,1,2,3,194,184,2,1,43,2,1,192,171,1,2,193,
+  207,104,1,2,202,184,195,124,0,2,63,43,2,1,196,136,2,4,195,169,55,185,43,4,
+  2,3,43,4,3,193,104,3,43,2,4,2,192,147,83,192,124,3,2,108,195,75,3,3,
+  107,39,193,211,4,2,37,193,211,3,2,91,195,75,3,2,194,112,196,223,3,3,113,39,
+  193,211,4,2,37,193,211,3,3,83,238,160,192,124,1,1,192,171,1,1,194,94,0,4,
+  63,194,94,201,59,195,64,4,2,2,196,53,2,2,2,195,11,3,2,3,195,64,1,1,
+  194,225,1,2,202,185,194,225,1,1,238,161,1,5,174,195,169,3,63,174,1,4,202,186,
+  39,197,4,197,5,1,4,96,192,89,195,187,106,3,1,106,1,2,194,64,205,2,2,2,
+  3,174,2,1,174,3,2,2,59,1,2,83,119,0,3,63,83,198,15,2,1,195,126,1,
+  3,193,104,3,43,0,3,238,162,91,27,0,4,193,23,183,186,27,2,3,75,186,27,2,
+  3,122,186,27,2,3,185,186,27,2,4,193,104,75,186,27,1,3,108,186,27,2,3,75,
+  186,27,2,3,122,186,27,2,3,185,186,27,2,4,193,104,75,186,27,1,4,188,192,157,
+  186,27,3,3,75,186,27,0,6,193,23,188,192,157,122,186,27,3,3,185,186,27,3,4,
+  193,104,75,186,27,2,3,192,196,186,27,3,3,75,186,27,3,3,122,186,27,3,3,185,
+  186,27,3,4,193,104,75,186,27,1,3,91,186,27,2,3,75,186,27,2,3,122,186,27,
+  2,3,185,186,27,2,4,193,104,75,186,27,1,4,192,50,192,157,186,27,3,3,75,186,
+  27,3,3,122,186,27,0,6,193,23,192,50,192,157,185,186,27,3,4,193,104,75,186,27,
+  2,3,192,196,186,27,3,3,75,186,27,3,3,122,186,27,3,3,185,186,27,3,4,193,
+  104,75,186,27,1,3,187,186,27,2,3,75,186,27,2,3,122,186,27,2,3,185,186,27,
+  2,4,193,104,75,186,27,0,3,196,168,83,192,124,0,2,238,163,197,143,0,3,195,20,
+  206,88,104,1,1,238,164,0,1,204,5,0,2,198,187,196,161,0,2,204,145,104,0,2,
+  238,165,197,161,0,2,238,166,104,0,1,195,250,1,3,2,238,167,206,92,0,2,199,19,
+  238,168,1,1,200,1,1,1,196,58,1,1,206,181,0,2,238,169,11,0,2,200,129,1,
+  0,1,199,244,0,2,193,215,196,38,1,3,193,171,76,59,0,2,238,170,197,45,0,1,
+  238,171,0,2,238,172,104,0,2,238,173,238,174,0,2,238,175,194,194,0,1,204,205,0,
+  1,238,176,0,2,205,136,193,105,0,5,192,57,192,158,20,195,126,100,0,1,238,177,0,
+  3,194,173,55,206,248,2,1,197,167,2,1,200,100,2,1,206,249,2,1,195,109,2,1,
+  206,250,0,3,194,173,55,206,251,1,2,194,34,206,248,2,1,197,167,2,1,200,100,2,
+  1,206,249,2,1,195,109,2,1,206,250,2,1,206,251,0,1,238,178,0,2,238,179,104,
+  0,2,197,101,193,118,0,2,197,49,1,0,4,192,244,31,192,79,42,2,2,195,3,42,
+  1,2,205,44,42,1,2,0,194,113,0,3,192,244,0,238,180,2,1,238,181,2,1,194,
+  105,2,1,193,91,2,1,194,19,2,1,238,182,2,1,194,177,2,1,200,80,2,1,203,
+  81,2,1,193,18,2,1,195,48,2,1,238,183,2,1,195,153,2,1,192,102,2,1,192,
+  219,2,1,238,184,0,3,192,244,0,192,105,3,3,2,59,38,2,1,198,226,2,1,192,
+  177,2,1,197,124,2,1,192,238,2,1,200,107,2,1,193,62,2,1,154,2,1,195,122,
+  2,1,193,78,2,1,193,228,2,1,193,86,2,1,198,177,2,1,180,2,1,193,1,0,
+  3,192,244,0,195,145,2,1,192,194,3,2,193,24,15,2,1,193,11,2,1,194,129,2,
+  1,238,185,2,1,197,149,3,3,2,192,75,38,2,1,192,221,2,1,197,207,2,1,193,
+  229,0,3,9,47,206,252,2,1,195,144,2,1,193,209,2,1,206,253,2,1,206,254,0,
+  3,9,47,206,255,2,1,207,0,2,1,207,1,2,1,207,2,2,1,194,25,2,1,192,
+  3,2,1,207,3,2,1,207,4,2,1,207,5,2,1,207,6,2,1,207,7,2,1,207,
+  8,2,1,207,9,2,1,207,10,2,1,207,11,2,1,207,12,0,3,9,47,207,13,2,
+  1,195,8,2,1,193,250,2,1,207,14,2,1,192,149,2,1,207,15,2,1,207,16,2,
+  1,193,119,2,1,207,17,2,1,207,18,2,1,207,19,2,1,207,20,2,1,207,21,2,
+  1,201,19,2,1,201,32,2,1,207,22,0,3,9,47,207,23,2,1,207,24,2,1,207,
+  25,2,1,207,26,2,1,207,27,2,1,200,108,2,1,207,28,2,1,193,190,2,1,207,
+  29,2,1,207,30,2,1,193,208,2,1,199,113,2,1,193,94,2,1,192,221,2,1,207,
+  31,2,1,207,32,0,3,9,47,207,33,2,1,207,34,1,2,4,20,2,1,205,159,2,
+  1,193,160,2,1,206,173,2,1,192,32,2,1,238,186,2,1,199,117,2,1,238,187,2,
+  1,196,50,2,1,238,188,2,1,238,189,2,1,238,190,2,1,197,138,2,1,238,191,0,
+  3,9,4,238,192,2,1,204,103,2,1,238,193,2,1,238,194,2,1,238,195,2,1,238,
+  196,2,1,238,197,2,1,238,198,2,1,238,199,2,1,204,104,2,1,238,200,2,1,238,
+  201,2,1,238,202,2,1,204,105,2,1,238,203,2,1,238,204,0,3,9,4,238,205,2,
+  1,238,206,2,1,238,207,2,1,238,208,2,1,206,252,2,1,238,209,2,1,238,210,2,
+  1,238,211,2,1,238,212,2,1,238,213,2,1,194,113,2,1,238,214,2,1,238,215,2,
+  1,194,33,2,1,238,216,2,1,238,217,0,3,9,4,238,218,2,1,238,219,2,1,238,
+  220,2,1,206,73,2,1,238,221,2,1,194,250,2,1,238,222,2,1,238,223,2,1,100,
+  2,1,193,176,2,1,238,224,2,1,238,225,2,1,238,226,2,1,238,227,2,1,195,144,
+  2,1,238,228,0,3,9,4,195,47,2,1,238,229,2,1,194,236,2,1,238,230,2,1,
+  238,231,2,1,238,232,2,1,238,233,2,1,238,234,2,1,192,107,2,1,198,6,2,1,
+  194,191,2,1,238,235,2,1,195,117,2,1,238,236,2,1,238,237,2,1,192,142,0,3,
+  9,4,238,238,2,1,203,79,2,1,238,239,2,1,193,209,2,1,238,240,2,1,238,241,
+  2,1,238,242,2,1,195,15,2,1,238,243,2,1,238,244,2,1,238,245,2,1,198,35,
+  2,1,238,246,2,1,238,247,2,1,238,248,2,1,238,249,0,3,9,4,238,250,2,1,
+  238,251,2,1,238,252,2,1,238,253,2,1,238,254,2,1,238,255,2,1,239,0,2,1,
+  239,1,2,1,239,2,2,1,239,3,2,1,198,44,2,1,239,4,2,1,239,5,2,1,
+  239,6,2,1,239,7,2,1,206,253,0,3,9,4,239,8,2,1,239,9,2,1,194,211,
+  2,1,239,10,2,1,239,11,2,1,239,12,2,1,200,101,2,1,239,13,2,1,206,254,
+  2,1,239,14,2,1,197,120,2,1,239,15,2,1,239,16,2,1,200,73,2,1,239,17,
+  2,1,206,255,0,3,9,4,207,0,2,1,239,18,2,1,239,19,2,1,207,1,2,1,
+  239,20,2,1,191,2,1,200,199,2,1,203,80,2,1,239,21,2,1,192,220,2,1,239,
+  22,2,1,239,23,2,1,239,24,2,1,204,110,2,1,239,25,2,1,239,26,0,3,9,
+  4,204,112,2,1,239,27,2,1,239,28,2,1,239,29,2,1,239,30,2,1,239,31,2,
+  1,239,32,2,1,200,102,2,1,239,33,2,1,239,34,2,1,239,35,2,1,204,113,2,
+  1,239,36,2,1,239,37,2,1,239,38,2,1,239,39,0,3,9,4,207,2,2,1,239,
+  40,2,1,239,41,2,1,239,42,2,1,193,227,2,1,239,43,2,1,239,44,2,1,194,
+  24,2,1,195,234,2,1,239,45,2,1,239,46,2,1,239,47,2,1,239,48,2,1,239,
+  49,2,1,194,5,2,1,239,50,0,3,9,4,59,2,1,239,51,2,1,194,25,2,1,
+  239,52,2,1,239,53,2,1,239,54,2,1,239,55,2,1,239,56,2,1,239,57,2,1,
+  239,58,2,1,56,2,1,198,26,2,1,193,18,2,1,239,59,2,1,239,60,2,1,200,
+  121,0,3,9,4,195,17,2,1,239,61,2,1,239,62,2,1,239,63,2,1,195,18,2,
+  1,239,64,2,1,204,160,2,1,195,119,2,1,239,65,2,1,205,71,2,1,239,66,2,
+  1,239,67,2,1,239,68,2,1,239,69,2,1,239,70,2,1,239,71,0,3,9,4,239,
+  72,2,1,192,3,2,1,196,133,2,1,239,73,2,1,239,74,2,1,195,51,2,1,207,
+  3,2,1,239,75,2,1,239,76,2,1,196,203,2,1,239,77,2,1,239,78,2,1,239,
+  79,2,1,199,67,2,1,239,80,2,1,239,81,0,3,9,4,239,82,2,1,204,117,2,
+  1,239,83,2,1,239,84,2,1,239,85,2,1,239,86,2,1,239,87,2,1,204,118,2,
+  1,207,4,2,1,239,88,2,1,239,89,2,1,204,119,2,1,207,5,2,1,239,90,2,
+  1,239,91,2,1,239,92,0,3,9,4,239,93,2,1,239,94,2,1,239,95,2,1,239,
+  96,2,1,239,97,2,1,193,210,2,1,239,98,2,1,239,99,2,1,239,100,2,1,239,
+  101,2,1,239,102,2,1,239,103,2,1,239,104,2,1,194,155,2,1,239,105,2,1,207,
+  6,0,3,9,4,239,106,2,1,194,65,2,1,239,107,2,1,239,108,2,1,239,109,2,
+  1,239,110,2,1,239,111,2,1,198,89,2,1,239,112,2,1,239,113,2,1,239,114,2,
+  1,129,2,1,239,115,2,1,196,58,2,1,239,116,2,1,193,19,0,3,9,4,239,117,
+  2,1,239,118,2,1,197,144,2,1,239,119,2,1,204,13,2,1,205,141,2,1,239,120,
+  2,1,239,121,2,1,239,122,2,1,239,123,2,1,239,124,2,1,239,125,2,1,201,26,
+  2,1,239,126,2,1,239,127,2,1,239,128,0,3,9,4,239,129,2,1,239,130,2,1,
+  239,131,2,1,239,132,2,1,239,133,2,1,239,134,2,1,239,135,2,1,239,136,2,1,
+  239,137,2,1,239,138,2,1,239,139,2,1,239,140,2,1,239,141,2,1,239,142,2,1,
+  239,143,2,1,239,144,0,3,9,4,239,145,2,1,239,146,2,1,239,147,2,1,239,148,
+  2,1,239,149,2,1,239,150,2,1,239,151,2,1,239,152,2,1,239,153,2,1,239,154,
+  2,1,239,155,2,1,239,156,2,1,239,157,2,1,239,158,2,1,239,159,2,1,239,160,
+  0,3,9,4,207,7,2,1,239,161,2,1,239,162,2,1,239,163,2,1,239,164,2,1,
+  239,165,2,1,239,166,2,1,239,167,2,1,239,168,2,1,239,169,2,1,239,170,2,1,
+  239,171,2,1,239,172,2,1,239,173,2,1,239,174,2,1,239,175,0,3,9,4,239,176,
+  2,1,239,177,2,1,199,229,2,1,239,178,2,1,239,179,2,1,239,180,2,1,239,181,
+  2,1,239,182,2,1,239,183,2,1,239,184,2,1,239,185,2,1,239,186,2,1,239,187,
+  2,1,239,188,2,1,239,189,2,1,239,190,0,3,9,4,239,191,2,1,239,192,2,1,
+  239,193,2,1,239,194,2,1,239,195,2,1,239,196,2,1,239,197,2,1,193,158,2,1,
+  239,198,2,1,197,156,2,1,239,199,2,1,239,200,2,1,239,201,2,1,239,202,2,1,
+  239,203,2,1,239,204,0,3,9,4,239,205,2,1,239,206,2,1,239,207,2,1,239,208,
+  2,1,239,209,2,1,239,210,2,1,239,211,2,1,239,212,2,1,239,213,2,1,239,214,
+  2,1,239,215,2,1,239,216,2,1,207,8,2,1,239,217,2,1,239,218,2,1,207,9,
+  0,3,9,4,239,219,2,1,239,220,2,1,207,10,2,1,239,221,2,1,239,222,2,1,
+  239,223,2,1,58,2,1,194,71,2,1,239,224,2,1,239,225,2,1,239,226,2,1,239,
+  227,2,1,200,230,2,1,206,174,2,1,195,190,2,1,239,228,0,3,9,4,239,229,2,
+  1,239,230,2,1,239,231,2,1,239,232,2,1,239,233,2,1,239,234,2,1,203,3,2,
+  1,207,11,2,1,239,235,2,1,239,236,2,1,239,237,2,1,239,238,2,1,239,239,2,
+  1,239,240,2,1,203,4,2,1,239,241,0,3,9,4,239,242,2,1,239,243,2,1,203,
+  5,2,1,239,244,2,1,239,245,2,1,239,246,2,1,239,247,2,1,239,248,2,1,239,
+  249,2,1,207,12,2,1,239,250,2,1,207,13,2,1,239,251,2,1,239,252,2,1,239,
+  253,2,1,195,8,0,3,9,4,239,254,2,1,195,175,2,1,239,255,2,1,196,45,2,
+  1,240,0,2,1,240,1,2,1,240,2,2,1,240,3,2,1,240,4,2,1,240,5,2,
+  1,240,6,2,1,240,7,2,1,240,8,2,1,240,9,2,1,240,10,2,1,240,11,0,
+  3,9,4,240,12,2,1,240,13,2,1,240,14,2,1,90,2,1,203,207,2,1,240,15,
+  2,1,240,16,2,1,193,250,2,1,240,17,2,1,196,27,2,1,240,18,2,1,193,203,
+  2,1,240,19,2,1,240,20,2,1,240,21,2,1,205,95,0,3,9,4,207,14,2,1,
+  240,22,2,1,193,196,2,1,240,23,2,1,240,24,2,1,240,25,2,1,193,230,2,1,
+  240,26,2,1,199,101,2,1,240,27,2,1,240,28,2,1,194,32,2,1,240,29,2,1,
+  197,240,2,1,240,30,2,1,170,0,3,9,4,199,102,2,1,240,31,2,1,240,32,2,
+  1,192,226,2,1,240,33,2,1,240,34,2,1,192,149,2,1,207,15,2,1,240,35,2,
+  1,240,36,2,1,240,37,2,1,198,8,2,1,240,38,2,1,240,39,2,1,194,10,2,
+  1,240,40,0,3,9,4,240,41,2,1,240,42,2,1,193,174,2,1,240,43,2,1,240,
+  44,2,1,240,45,2,1,240,46,2,1,240,47,2,1,240,48,2,1,240,49,2,1,240,
+  50,2,1,240,51,2,1,200,196,2,1,240,52,2,1,207,16,2,1,240,53,0,3,9,
+  4,240,54,2,1,240,55,2,1,167,2,1,197,45,2,1,240,56,2,1,240,57,2,1,
+  193,80,2,1,240,58,2,1,240,59,2,1,240,60,2,1,240,61,2,1,240,62,2,1,
+  240,63,2,1,240,64,2,1,240,65,2,1,240,66,0,3,9,4,240,67,2,1,194,144,
+  2,1,240,68,2,1,240,69,2,1,240,70,2,1,240,71,2,1,240,72,2,1,240,73,
+  2,1,240,74,2,1,240,75,2,1,240,76,2,1,240,77,2,1,240,78,2,1,240,79,
+  2,1,193,119,2,1,240,80,0,3,9,4,240,81,2,1,240,82,2,1,240,83,2,1,
+  200,234,2,1,240,84,2,1,193,231,2,1,207,17,2,1,240,85,2,1,240,86,2,1,
+  193,31,2,1,240,87,2,1,240,88,2,1,240,89,2,1,240,90,2,1,240,91,2,1,
+  240,92,0,3,9,4,240,93,2,1,240,94,2,1,240,95,2,1,202,142,2,1,240,96,
+  2,1,240,97,2,1,240,98,2,1,173,2,1,240,99,2,1,240,100,2,1,240,101,2,
+  1,240,102,2,1,240,103,2,1,240,104,2,1,240,105,2,1,207,18,0,3,9,4,240,
+  106,2,1,240,107,2,1,240,108,2,1,240,109,2,1,240,110,2,1,240,111,2,1,240,
+  112,2,1,240,113,2,1,240,114,2,1,240,115,2,1,240,116,2,1,240,117,2,1,240,
+  118,2,1,240,119,2,1,240,120,2,1,240,121,0,3,9,4,240,122,2,1,240,123,2,
+  1,240,124,2,1,240,125,2,1,240,126,2,1,196,122,2,1,199,104,2,1,240,127,2,
+  1,240,128,2,1,198,122,2,1,240,129,2,1,240,130,2,1,200,243,2,1,240,131,2,
+  1,240,132,2,1,240,133,0,3,9,4,240,134,2,1,240,135,2,1,200,238,2,1,240,
+  136,2,1,240,137,2,1,240,138,2,1,197,245,2,1,240,139,2,1,240,140,2,1,240,
+  141,2,1,240,142,2,1,240,143,2,1,193,71,2,1,240,144,2,1,240,145,2,1,192,
+  95,0,3,9,4,240,146,2,1,240,147,2,1,240,148,2,1,202,60,2,1,240,149,2,
+  1,240,150,2,1,240,151,2,1,240,152,2,1,240,153,2,1,196,48,2,1,202,144,2,
+  1,240,154,2,1,240,155,2,1,240,156,2,1,240,157,2,1,240,158,0,3,9,4,193,
+  72,2,1,240,159,2,1,240,160,2,1,240,161,2,1,240,162,2,1,240,163,2,1,240,
+  164,2,1,196,123,2,1,240,165,2,1,240,166,2,1,240,167,2,1,240,168,2,1,240,
+  169,2,1,240,170,2,1,240,171,2,1,206,228,0,3,9,4,240,172,2,1,240,173,2,
+  1,240,174,2,1,200,245,2,1,240,175,2,1,240,176,2,1,240,177,2,1,240,178,2,
+  1,240,179,2,1,240,180,2,1,240,181,2,1,240,182,2,1,240,183,2,1,240,184,2,
+  1,240,185,2,1,240,186,0,3,9,4,193,28,2,1,240,187,2,1,192,146,2,1,240,
+  188,2,1,199,144,2,1,240,189,2,1,240,190,2,1,240,191,2,1,240,192,2,1,240,
+  193,2,1,240,194,2,1,240,195,2,1,240,196,2,1,240,197,2,1,240,198,2,1,240,
+  199,0,3,9,4,240,200,2,1,240,201,2,1,240,202,2,1,240,203,2,1,240,204,2,
+  1,240,205,2,1,240,206,2,1,240,207,2,1,240,208,2,1,240,209,2,1,240,210,2,
+  1,193,92,2,1,240,211,2,1,240,212,2,1,240,213,2,1,240,214,0,3,9,4,240,
+  215,2,1,240,216,2,1,205,254,2,1,240,217,2,1,194,153,2,1,240,218,2,1,240,
+  219,2,1,240,220,2,1,240,221,2,1,207,19,2,1,202,97,2,1,240,222,2,1,195,
+  154,2,1,207,20,2,1,240,223,2,1,240,224,0,3,9,4,200,106,2,1,240,225,2,
+  1,240,226,2,1,240,227,2,1,240,228,2,1,240,229,2,1,240,230,2,1,199,91,2,
+  1,240,231,2,1,240,232,2,1,240,233,2,1,240,234,2,1,240,235,2,1,240,236,2,
+  1,240,237,2,1,240,238,0,3,9,4,240,239,2,1,240,240,2,1,240,241,2,1,240,
+  242,2,1,240,243,2,1,240,244,2,1,240,245,2,1,240,246,2,1,240,247,2,1,207,
+  21,2,1,240,248,2,1,240,249,2,1,240,250,2,1,240,251,2,1,240,252,2,1,240,
+  253,0,3,9,4,240,254,2,1,240,255,2,1,241,0,2,1,53,2,1,201,19,2,1,
+  198,107,2,1,198,241,2,1,150,2,1,194,40,2,1,241,1,2,1,241,2,2,1,192,
+  210,2,1,206,52,2,1,241,3,2,1,241,4,2,1,202,131,0,3,9,4,202,111,2,
+  1,241,5,2,1,194,41,2,1,201,30,2,1,197,216,2,1,241,6,2,1,194,181,2,
+  1,241,7,2,1,241,8,2,1,241,9,2,1,202,101,2,1,241,10,2,1,241,11,2,
+  1,201,32,2,1,241,12,2,1,241,13,0,3,9,4,241,14,2,1,241,15,2,1,241,
+  16,2,1,207,22,2,1,241,17,2,1,197,83,2,1,241,18,2,1,241,19,2,1,241,
+  20,2,1,241,21,2,1,241,22,2,1,241,23,2,1,241,24,2,1,198,55,2,1,241,
+  25,2,1,207,23,0,3,9,4,241,26,2,1,197,139,2,1,199,232,2,1,241,27,2,
+  1,241,28,2,1,241,29,2,1,241,30,2,1,241,31,2,1,241,32,2,1,241,33,2,
+  1,241,34,2,1,241,35,2,1,241,36,2,1,241,37,2,1,241,38,2,1,241,39,0,
+  3,9,4,241,40,2,1,154,2,1,200,5,2,1,198,61,2,1,241,41,2,1,194,39,
+  2,1,241,42,2,1,241,43,2,1,193,179,2,1,241,44,2,1,241,45,2,1,241,46,
+  2,1,194,6,2,1,241,47,2,1,204,93,2,1,241,48,0,3,9,4,241,49,2,1,
+  241,50,2,1,206,145,2,1,241,51,2,1,241,52,2,1,241,53,2,1,241,54,2,1,
+  241,55,2,1,241,56,2,1,241,57,2,1,241,58,2,1,241,59,2,1,241,60,2,1,
+  241,61,2,1,241,62,2,1,241,63,0,3,9,4,241,64,2,1,241,65,2,1,241,66,
+  2,1,241,67,2,1,193,217,2,1,241,68,2,1,241,69,2,1,241,70,2,1,241,71,
+  2,1,241,72,2,1,241,73,2,1,241,74,2,1,241,75,2,1,205,87,2,1,241,76,
+  2,1,241,77,0,3,9,4,241,78,2,1,241,79,2,1,241,80,2,1,182,2,1,202,
+  132,2,1,201,17,2,1,241,81,2,1,193,228,2,1,241,82,2,1,241,83,2,1,192,
+  101,2,1,241,84,2,1,207,24,2,1,241,85,2,1,192,246,2,1,241,86,0,3,9,
+  4,202,112,2,1,241,87,2,1,195,7,2,1,207,25,2,1,241,88,2,1,241,89,2,
+  1,194,115,2,1,241,90,2,1,241,91,2,1,241,92,2,1,241,93,2,1,207,26,2,
+  1,241,94,2,1,241,95,2,1,241,96,2,1,207,27,0,3,9,4,241,97,2,1,241,
+  98,2,1,241,99,2,1,241,100,2,1,241,101,2,1,193,218,2,1,241,102,2,1,241,
+  103,2,1,241,104,2,1,241,105,2,1,241,106,2,1,117,2,1,193,180,2,1,241,107,
+  2,1,199,95,2,1,241,108,0,3,9,4,193,33,2,1,241,109,2,1,241,110,2,1,
+  241,111,2,1,204,132,2,1,241,112,2,1,241,113,2,1,200,108,2,1,241,114,2,1,
+  241,115,2,1,241,116,2,1,241,117,2,1,241,118,2,1,241,119,2,1,200,109,2,1,
+  241,120,0,3,9,4,241,121,2,1,241,122,2,1,200,110,2,1,241,123,2,1,241,124,
+  2,1,241,125,2,1,241,126,2,1,241,127,2,1,241,128,2,1,241,129,2,1,241,130,
+  2,1,241,131,2,1,193,235,2,1,241,132,2,1,241,133,2,1,241,134,0,3,9,4,
+  241,135,2,1,198,102,2,1,241,136,2,1,241,137,2,1,241,138,2,1,241,139,2,1,
+  241,140,2,1,241,141,2,1,241,142,2,1,241,143,2,1,241,144,2,1,180,2,1,241,
+  145,2,1,207,28,2,1,241,146,2,1,193,54,0,3,9,4,241,147,2,1,241,148,2,
+  1,194,22,2,1,196,153,2,1,241,149,2,1,241,150,2,1,193,255,2,1,206,74,2,
+  1,241,151,2,1,66,2,1,192,240,2,1,206,81,2,1,241,152,2,1,193,190,2,1,
+  241,153,2,1,241,154,0,3,9,4,202,135,2,1,241,155,2,1,206,236,2,1,196,186,
+  2,1,241,156,2,1,241,157,2,1,241,158,2,1,205,130,2,1,241,159,2,1,241,160,
+  2,1,192,194,2,1,241,161,2,1,241,162,2,1,241,163,2,1,207,29,2,1,241,164,
+  0,3,9,4,195,108,2,1,241,165,2,1,241,166,2,1,192,111,2,1,241,167,2,1,
+  241,168,2,1,241,169,2,1,241,170,2,1,195,50,2,1,241,171,2,1,241,172,2,1,
+  241,173,2,1,196,34,2,1,241,174,2,1,207,30,2,1,241,175,0,3,9,4,241,176,
+  2,1,241,177,2,1,200,210,2,1,241,178,2,1,241,179,2,1,241,180,2,1,241,181,
+  2,1,241,182,2,1,192,109,2,1,202,136,2,1,241,183,2,1,201,109,2,1,193,178,
+  2,1,241,184,2,1,241,185,2,1,193,208,0,3,9,4,241,186,2,1,241,187,2,1,
+  195,16,2,1,202,149,2,1,241,188,2,1,241,189,2,1,194,133,2,1,241,190,2,1,
+  241,191,2,1,241,192,2,1,241,193,2,1,241,194,2,1,241,195,2,1,241,196,2,1,
+  204,133,2,1,241,197,0,3,9,4,241,198,2,1,241,199,2,1,241,200,2,1,241,201,
+  2,1,241,202,2,1,241,203,2,1,241,204,2,1,241,205,2,1,241,206,2,1,241,207,
+  2,1,9,2,1,202,155,2,1,241,208,2,1,241,209,2,1,241,210,2,1,241,211,0,
+  3,9,4,199,113,2,1,241,212,2,1,193,94,2,1,241,213,2,1,197,149,2,1,241,
+  214,2,1,193,27,2,1,241,215,2,1,202,137,2,1,241,216,2,1,241,217,2,1,241,
+  218,2,1,241,219,2,1,241,220,2,1,198,252,2,1,241,221,0,3,9,4,200,206,2,
+  1,241,222,2,1,241,223,2,1,241,224,2,1,241,225,2,1,241,226,2,1,192,221,2,
+  1,241,227,2,1,241,228,2,1,241,229,2,1,193,229,2,1,241,230,2,1,241,231,2,
+  1,193,236,2,1,241,232,2,1,241,233,0,3,9,4,241,234,2,1,194,90,2,1,241,
+  235,2,1,241,236,2,1,241,237,2,1,200,112,2,1,241,238,2,1,241,239,2,1,241,
+  240,2,1,200,113,2,1,241,241,2,1,241,242,2,1,241,243,2,1,241,244,2,1,241,
+  245,2,1,241,246,0,3,9,4,241,247,2,1,241,248,2,1,241,249,2,1,241,250,2,
+  1,241,251,2,1,241,252,2,1,241,253,2,1,241,254,2,1,195,13,2,1,241,255,2,
+  1,242,0,2,1,242,1,2,1,242,2,2,1,242,3,2,1,242,4,2,1,194,220,0,
+  3,9,4,242,5,2,1,207,31,2,1,242,6,2,1,194,230,2,1,242,7,2,1,242,
+  8,2,1,242,9,2,1,207,32,2,1,207,33,2,1,242,10,2,1,242,11,2,1,242,
+  12,2,1,202,197,2,1,242,13,2,1,242,14,2,1,242,15,0,3,9,4,242,16,2,
+  1,242,17,2,1,198,127,2,1,242,18,2,1,242,19,2,1,242,20,2,1,204,136,2,
+  1,242,21,2,1,242,22,2,1,204,137,2,1,242,23,2,1,242,24,2,1,207,34,2,
+  1,242,25,2,1,242,26,2,1,242,27,0,3,9,4,242,28,2,1,204,138,2,1,242,
+  29,2,1,242,30,2,1,204,139,2,1,242,31,2,1,242,32,2,1,242,33,2,1,242,
+  34,2,1,242,35,2,1,242,36,2,1,242,37,2,1,242,38,2,1,242,39,2,1,242,
+  40,0,2,195,148,194,247,0,1,242,41,0,4,192,27,192,85,198,203,242,42,2,2,242,
+  43,207,35,2,3,39,207,36,130,3,2,195,112,130,2,2,197,196,207,35,2,2,242,44,
+  200,43,2,3,37,207,36,130,3,2,195,112,130,2,2,201,79,200,43,3,1,242,45,3,
+  1,242,46,2,1,242,47,2,2,198,189,193,90,0,6,192,119,43,197,157,207,37,193,146,
+  42,3,2,193,146,42,0,5,192,119,43,199,20,0,170,4,1,154,4,1,192,194,4,1,
+  176,2,3,197,186,0,154,2,3,50,192,49,42,2,4,86,207,37,193,146,42,3,2,193,
+  146,42,2,2,0,196,229,3,1,20,3,1,192,32,3,1,193,2,3,1,192,107,3,1,
+  192,142,3,1,191,3,1,192,220,0,4,192,119,43,0,193,25,3,1,192,232,3,1,194,
+  189,3,1,197,171,3,1,192,3,3,1,192,239,3,1,129,3,1,192,102,3,1,90,3,
+  1,192,144,3,1,197,169,3,1,170,3,1,167,3,1,173,3,1,192,95,3,1,192,251,
+  0,4,192,119,43,0,192,145,3,1,150,3,1,192,195,3,1,154,3,1,182,3,1,192,
+  101,3,1,193,33,3,1,180,3,1,192,167,3,1,193,123,3,1,194,140,3,1,192,214,
+  3,1,193,12,3,1,192,194,3,1,176,3,1,192,221,0,4,192,119,43,0,193,236,2,
+  3,42,51,194,104,3,2,171,195,39,3,1,194,104,3,1,195,39,2,2,1,192,203,3,
+  3,194,114,2,192,150,3,1,193,82,4,2,2,192,150,3,1,193,20,3,1,193,47,2,
+  1,206,128,2,3,16,194,116,42,3,2,1,192,74,4,1,192,98,4,1,56,0,5,192,
+  119,43,16,1,58,4,1,53,4,1,193,4,4,2,192,56,58,4,1,46,4,1,193,219,
+  0,2,242,48,104,0,3,192,33,195,31,196,38,2,2,201,10,193,242,2,1,242,49,2,
+  1,193,242,0,1,242,50,0,2,242,51,104,0,5,94,31,242,52,83,207,38,2,4,107,
+  194,162,197,196,193,88,2,2,42,242,53,0,4,94,31,42,201,80,4,1,242,54,3,2,
+  194,7,207,38,3,2,207,39,207,40,3,1,242,55,3,4,197,197,196,14,192,135,39,6,
+  1,37,5,4,99,195,0,192,135,39,8,1,37,4,1,196,250,3,1,242,56,3,1,199,
+  21,4,2,192,135,39,3,1,242,57,3,1,242,58,3,4,196,102,194,207,192,135,39,0,
+  7,94,31,42,196,102,194,207,192,135,37,5,4,99,196,251,192,135,39,8,1,37,6,1,
+  195,0,5,1,201,81,3,3,196,14,192,135,39,5,1,37,4,4,99,195,0,192,135,39,
+  7,1,37,3,1,242,59,3,1,192,135,3,1,242,60,3,1,201,82,4,3,2,83,71,
+  3,1,242,61,3,3,194,207,192,135,39,0,6,94,31,42,194,207,192,135,37,4,4,99,
+  196,251,192,135,39,7,1,37,5,1,195,0,4,1,201,81,3,1,242,62,3,1,242,63,
+  3,1,242,64,3,2,207,41,207,42,3,3,207,43,192,135,39,5,1,37,3,3,201,81,
+  196,102,194,207,3,1,199,22,3,1,242,65,3,3,201,83,192,135,39,5,1,37,0,6,
+  94,31,42,201,83,99,195,0,3,1,242,66,3,3,196,250,192,135,39,5,1,37,4,4,
+  99,196,251,192,135,39,7,1,37,5,1,195,0,3,1,207,40,3,1,242,67,3,1,242,
+  68,2,4,194,162,197,196,42,242,69,5,1,242,70,5,1,242,71,1,2,166,201,80,2,
+  1,207,44,2,2,207,39,207,45,0,3,94,166,242,72,2,2,51,196,15,2,1,242,73,
+  2,3,242,74,192,9,242,75,2,1,196,55,2,2,197,198,242,76,3,1,242,77,3,1,
+  242,78,3,1,207,46,3,1,242,79,2,1,242,80,2,1,207,45,2,1,242,81,2,1,
+  207,47,3,1,207,46,2,1,199,21,0,3,94,166,242,82,2,1,197,199,3,1,242,83,
+  3,1,242,84,3,1,242,85,3,1,242,86,2,1,242,87,2,1,242,88,2,1,196,252,
+  3,2,195,40,197,200,4,1,196,16,3,2,195,41,196,16,3,1,196,16,3,1,199,23,
+  2,1,242,89,2,1,242,90,0,3,94,166,242,91,2,1,207,48,3,1,197,200,2,1,
+  201,82,2,1,242,92,2,2,192,56,207,44,2,1,201,25,2,3,195,42,196,253,195,40,
+  4,1,197,200,4,1,199,24,4,1,196,16,3,1,207,49,3,2,195,40,196,16,4,1,
+  199,22,3,1,201,84,3,1,196,16,0,4,94,166,195,42,199,22,3,1,199,23,2,1,
+  199,25,3,2,99,195,0,4,1,196,254,3,1,242,93,2,1,195,43,3,1,197,200,3,
+  3,99,242,94,242,95,4,1,195,0,5,2,58,196,254,4,1,242,96,4,1,196,254,5,
+  2,58,195,0,6,1,242,97,3,1,207,50,0,6,94,166,195,43,207,50,99,196,254,2,
+  1,201,85,3,2,99,242,98,3,3,2,207,41,207,42,2,2,193,84,196,253,4,1,195,
+  40,3,1,242,99,3,1,207,51,4,1,195,40,3,1,199,26,4,3,2,192,76,196,15,
+  3,1,199,27,4,1,199,28,3,1,196,255,4,3,2,51,196,15,5,2,192,76,196,15,
+  0,4,94,166,193,84,207,49,3,1,242,100,3,1,195,41,4,1,199,26,5,3,2,192,
+  76,196,15,4,1,199,27,5,1,199,28,4,1,196,255,5,3,2,51,196,15,6,2,192,
+  76,196,15,4,1,199,28,4,1,242,101,3,1,242,102,3,1,242,103,3,1,197,200,3,
+  1,242,104,0,4,94,166,193,84,199,28,3,1,199,24,3,2,199,22,242,105,3,1,242,
+  106,3,1,242,107,3,1,242,108,2,3,196,17,195,40,201,84,4,1,199,24,4,1,196,
+  16,4,1,199,23,3,1,201,84,3,1,199,24,3,1,196,16,3,1,199,23,2,1,242,
+  109,2,1,196,15,0,3,94,166,242,110,1,4,197,201,61,199,1,205,220,3,1,199,21,
+  3,1,242,111,3,1,242,112,3,1,201,25,0,1,242,113,
+};
+static const unsigned char uname_codes[47126] = {
+  1,249,238,143,216,14,226,218,14,173,230,14,165,2,3,237,126,214,163,1,187,34,240,229,
+  14,153,209,14,176,140,14,135,1,8,6,28,1,233,1,24,7,2,28,12,15,21,18,5,
+  24,6,59,2,48,21,1,233,25,25,11,34,29,50,55,42,13,18,25,6,7,34,82,32,
+  1,233,85,1,10,15,12,1,5,1,3,13,5,2,46,2,39,1,1,233,34,8,6,28,
+  39,24,7,2,28,12,15,21,18,5,24,6,1,233,36,2,48,21,18,25,11,34,29,50,
+  55,42,13,18,25,6,1,233,48,34,8,191,245,13,244,158,14,228,24,157,227,7,116,2,
+  2,2,97,36,18,35,54,1,1,20,54,71,36,18,37,54,71,36,18,43,36,18,35,54,
+  87,1,1,25,18,41,36,18,35,54,73,36,18,35,54,63,54,49,54,1,1,9,36,18,
+  37,54,71,36,18,40,2,6,3,2,113,1,194,214,7,0,6,11,164,196,8,4,1,52,
+  5,1,10,15,12,1,5,1,3,59,16,1,23,22,33,6,32,80,105,16,96,2,95,2,
+  4,11,13,30,49,1,23,1,26,112,121,11,1,134,1,105,19,2,12,4,21,16,106,2,
+  1,23,58,2,31,38,1,1,6,61,2,16,2,5,1,7,2,10,1,23,36,2,185,192,
+  7,200,191,14,1,187,214,14,198,10,162,204,14,210,1,103,2,28,44,95,73,2,1,247,
+  8,2,7,106,58,51,92,2,91,93,102,2,2,42,17,7,1,247,78,117,36,9,6,2,
+  11,142,1,2,2,2,2,14,29,2,3,1,247,3,1,48,94,82,2,57,48,163,1,2,
+  8,18,82,53,79,2,1,247,18,190,1,3,179,1,98,111,148,1,25,30,10,8,2,69,
+  129,1,118,2,1,247,50,3,2,35,40,2,2,112,169,1,2,64,73,50,13,82,103,1,
+  247,84,25,22,20,2,97,19,24,13,110,161,1,100,2,45,62,18,1,247,77,16,89,59,
+  74,71,2,20,2,37,140,1,169,216,14,196,21,206,183,14,159,197,14,195,3,0,34,74,
+  3,206,32,179,14,155,13,240,26,164,177,14,145,11,195,206,15,168,207,15,243,191,5,2,
+  2,2,2,2,1,68,6,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,68,
+  22,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,68,38,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,68,54,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,68,70,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,68,
+  86,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,68,102,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,68,118,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,68,134,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,68,
+  150,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,68,166,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,68,182,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,68,198,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,68,
+  214,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,68,230,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,68,246,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,69,6,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,69,
+  22,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,69,38,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,69,54,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,69,70,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,69,
+  86,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,69,102,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,69,118,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,69,134,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,69,
+  150,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,69,166,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,69,182,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,69,198,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,69,
+  214,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,69,230,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,69,246,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,70,6,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,70,
+  22,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,70,38,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,70,54,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,70,70,244,209,5,217,208,14,252,4,162,179,14,131,202,14,252,29,12,
+  248,177,14,233,211,14,248,211,14,131,192,14,238,183,14,180,3,235,174,14,153,28,1,245,
+  4,163,180,14,190,8,173,33,7,174,39,2,61,58,6,169,32,7,107,18,56,77,0,35,
+  95,67,62,28,15,31,50,63,28,2,46,21,47,7,24,66,0,35,105,101,122,10,39,17,
+  24,67,96,8,56,165,1,11,72,23,13,0,35,58,1,38,22,61,24,17,24,7,88,2,
+  79,13,36,5,28,0,35,88,56,91,80,93,15,88,20,9,20,41,8,23,7,3,58,0,
+  43,228,249,174,1,210,136,1,19,212,32,213,32,26,128,16,149,119,245,9,178,11,6,7,
+  6,1,6,0,6,79,210,224,7,2,245,213,7,227,10,204,224,7,201,225,7,188,1,238,
+  9,50,2,187,1,229,6,1,25,255,2,0,6,78,208,224,7,2,131,214,7,1,171,10,
+  37,202,224,7,133,224,7,213,1,164,3,150,7,149,9,2,4,13,0,254,122,2,137,214,
+  7,209,10,206,224,7,197,214,7,5,2,6,74,4,199,8,204,7,4,1,16,0,6,57,
+  162,226,7,2,3,6,215,224,7,166,8,169,5,1,4,239,4,206,225,7,1,135,225,7,
+  206,226,7,1,0,6,113,192,211,7,1,181,203,7,16,6,31,8,28,19,18,19,1,6,
+  15,20,0,8,126,7,139,4,1,159,5,194,225,7,1,187,225,7,198,225,7,1,167,216,
+  7,161,9,192,225,7,1,157,216,7,20,0,8,127,153,8,2,16,176,211,7,2,3,6,
+  217,212,7,208,225,7,2,3,6,129,221,7,160,5,151,5,0,8,182,191,5,148,5,159,
+  5,4,2,2,167,3,182,211,7,2,3,6,205,212,7,144,226,7,2,3,0,254,192,137,
+  223,7,221,1,242,211,7,1,169,213,7,246,225,7,1,189,224,7,2,10,148,3,215,1,
+  201,1,12,190,8,0,7,89,151,3,236,211,7,1,243,211,7,130,212,7,1,179,212,7,
+  102,99,62,242,211,7,1,131,212,7,222,211,7,2,0,251,114,6,201,210,7,170,212,7,
+  2,3,6,181,212,7,226,212,7,2,3,6,143,210,7,1,1,239,4,0,6,63,1,6,
+  162,226,7,2,3,6,225,224,7,130,8,131,8,6,248,2,1,225,2,200,211,7,2,0,
+  251,146,6,201,203,7,255,7,8,3,239,1,168,226,7,2,3,6,167,223,7,142,7,10,
+  169,8,200,211,7,0,251,152,3,6,215,213,7,234,225,7,2,3,6,207,220,7,245,3,
+  146,8,175,4,5,1,209,3,166,3,0,7,87,169,3,193,1,190,225,7,241,224,7,238,
+  1,218,211,7,2,3,6,250,12,209,224,7,204,211,7,2,3,6,0,6,194,210,224,7,
+  3,6,217,223,7,125,202,211,7,1,223,212,7,2,2,4,151,1,228,225,7,2,3,0,
+  254,160,181,215,7,2,71,147,8,230,211,7,1,141,213,7,174,226,7,2,3,6,223,224,
+  7,144,8,145,8,6,0,7,127,189,5,146,2,204,211,7,2,3,6,221,208,7,192,5,
+  189,5,205,4,208,4,209,4,164,9,189,9,240,225,7,0,254,167,3,6,197,223,7,184,
+  212,7,1,173,212,7,180,212,7,1,187,214,7,180,226,7,2,3,6,235,221,7,231,2,
+  0,8,166,66,163,8,4,2,234,7,161,10,82,186,226,7,2,3,6,253,221,7,2,130,
+  5,243,7,0,251,212,2,3,6,201,212,7,212,211,7,2,3,6,173,213,7,192,226,7,
+  215,224,7,202,211,7,1,146,13,3,0,254,232,221,224,7,160,7,153,7,216,2,2,215,
+  2,212,2,199,3,232,211,7,2,3,6,229,210,7,168,212,7,1,0,6,126,178,211,7,
+  2,3,6,195,202,7,14,175,8,146,211,7,2,3,6,221,212,7,168,226,7,2,3,0,
+  254,216,225,224,7,252,7,32,153,8,237,1,250,225,7,1,177,224,7,4,6,166,3,249,
+  1,246,6,173,8,188,3,0,8,185,205,8,6,140,3,135,3,168,3,223,2,204,211,7,
+  2,3,6,237,203,7,181,8,248,211,7,1,173,213,7,0,254,186,2,3,6,187,224,7,
+  162,8,163,8,211,1,254,225,7,2,3,6,179,224,7,198,3,65,68,0,7,112,169,3,
+  2,162,3,241,4,132,226,7,2,3,6,251,222,7,238,6,129,9,116,229,1,150,226,7,
+  2,0,254,193,6,241,216,7,215,7,218,7,46,185,8,234,211,7,2,3,6,251,210,7,
+  132,8,243,8,240,211,7,2,0,251,126,6,173,213,7,216,225,7,2,3,215,225,7,214,
+  225,7,161,223,7,160,223,7,10,183,224,7,248,8,14,131,9,4,0,251,99,2,3,6,
+  233,212,7,248,225,7,1,255,225,7,222,225,7,2,3,6,171,216,7,153,8,220,211,7,
+  2,0,251,102,6,209,202,7,139,9,202,211,7,2,3,6,179,210,7,162,212,7,1,191,
+  213,7,204,213,7,22,2,187,212,7,0,251,223,1,243,212,7,142,211,7,2,3,6,201,
+  212,7,204,226,7,1,187,224,7,184,7,227,4,1,167,5,196,225,7,0,254,133,129,223,
+  7,12,255,1,144,2,186,211,7,1,229,208,7,1,205,2,188,211,7,1,132,13,2,3,
+  6,0,6,38,200,225,7,2,3,6,251,222,7,1,8,176,7,1,36,227,7,168,212,7,
+  1,197,214,7,156,226,7,0,254,199,3,6,171,226,7,252,225,7,1,249,215,7,194,209,
+  7,55,121,161,2,152,5,158,1,145,4,161,2,156,5,0,253,118,2,126,195,2,55,246,
+  3,203,2,212,2,223,2,6,3,2,241,2,101,190,3,2,0,253,242,26,161,6,201,1,
+  168,2,173,2,248,6,195,4,132,1,139,1,173,2,178,2,173,2,174,6,227,4,102,0,
+  252,8,178,3,231,1,5,10,201,1,194,1,164,6,179,3,55,163,1,163,2,150,5,122,
+  237,3,163,2,0,252,182,163,2,150,5,2,241,2,163,2,142,4,55,40,55,151,2,149,
+  1,156,2,161,2,160,2,161,2,0,252,192,161,2,154,5,2,247,2,161,2,162,6,135,
+  5,149,1,198,3,55,121,161,2,164,2,161,2,158,5,0,253,121,2,199,1,55,66,55,
+  171,1,163,2,208,6,169,4,163,2,134,5,1,123,55,217,2,0,252,215,139,2,142,2,
+  139,2,130,5,2,245,2,137,2,206,6,187,3,55,179,1,163,2,162,6,48,171,4,0,
+  252,22,162,6,157,1,2,152,1,141,2,55,131,2,145,1,152,1,139,1,144,2,151,2,
+  150,2,151,2,156,2,0,252,58,142,1,140,1,151,2,224,2,209,1,140,1,151,2,224,
+  2,158,3,16,23,229,4,139,1,194,3,55,0,252,26,162,2,163,2,166,2,161,2,138,
+  4,55,240,7,1,233,9,133,1,234,10,1,6,1,5,0,254,245,213,8,147,2,132,5,
+  3,106,103,231,2,7,147,2,138,5,1,114,3,27,193,3,0,252,65,136,5,2,129,4,
+  142,1,147,2,214,2,180,2,2,74,203,4,133,1,136,1,125,140,2,145,2,0,253,137,
+  2,2,249,2,145,2,142,5,12,9,102,223,3,145,2,142,5,2,84,223,4,144,1,0,
+  252,72,210,5,205,5,212,6,203,5,125,136,2,141,2,148,5,1,60,185,3,50,57,141,
+  2,156,5,0,253,189,9,65,2,94,229,3,141,2,126,146,1,141,2,192,2,218,2,1,
+  153,4,5,10,0,252,80,118,25,145,1,154,2,157,2,160,2,157,2,148,5,108,105,102,
+  229,4,145,1,246,6,203,2,0,253,65,2,2,2,2,9,30,206,2,179,6,138,3,55,
+  167,1,161,2,136,5,2,136,1,0,252,178,2,163,2,138,5,190,1,179,2,55,38,55,
+  146,3,76,8,17,211,2,232,2,219,2,0,253,23,55,153,1,161,2,176,4,78,85,145,
+  1,117,161,2,176,4,84,1,219,2,161,2,176,4,0,253,168,60,171,4,161,2,144,3,
+  240,1,2,2,2,2,113,55,20,55,181,2,164,2,0,252,94,4,164,2,159,2,164,2,
+  169,2,8,236,2,55,82,16,71,92,94,2,132,1,0,253,50,143,1,118,16,71,92,100,
+  131,1,16,71,92,33,16,71,69,130,2,0,253,107,2,2,135,1,55,26,55,128,4,223,
+  2,121,55,121,163,2,154,4,151,4,166,4,0,253,113,2,2,2,195,1,55,131,2,201,
+  1,166,2,171,2,138,5,2,2,219,2,126,133,1,0,252,11,170,6,159,1,158,1,247,
+  3,171,2,170,6,155,1,154,1,221,4,100,171,2,170,3,130,3,155,1,1,0,253,87,
+  152,1,223,4,5,10,201,1,194,1,43,62,205,1,166,3,169,3,206,1,92,167,2,166,
+  3,0,252,121,5,10,205,1,198,1,249,1,2,3,254,7,197,5,119,132,2,137,2,176,
+  5,129,7,1,0,251,235,1,252,1,201,1,23,2,3,196,2,173,2,180,2,138,1,145,
+  1,173,2,178,2,101,104,0,252,2,186,3,239,1,231,1,1,228,1,229,1,1,1,1,
+  246,1,201,1,29,1,226,1,242,1,0,252,241,45,137,2,180,5,165,3,137,2,120,148,
+  1,137,2,176,2,216,2,2,38,183,4,5,10,0,252,90,112,78,161,2,166,4,189,210,
+  7,145,9,10,206,10,160,148,15,29,2,48,43,50,4,1,238,29,4,160,2,27,48,43,
+  26,22,39,9,42,23,2,2,10,2,1,238,177,5,12,23,26,6,3,33,8,34,39,171,
+  2,22,39,80,27,1,238,57,17,22,39,5,3,16,26,23,2,2,10,1,5,12,2,1,
+  238,54,25,77,16,26,23,136,2,29,2,48,43,26,22,39,5,3,1,238,151,23,2,2,
+  10,2,3,5,12,23,26,6,3,33,8,34,1,238,134,243,1,2,200,3,1,187,3,2,
+  3,5,12,182,1,27,48,6,4,27,1,238,123,39,5,3,16,26,21,2,10,1,5,12,
+  23,26,2,25,1,238,122,227,1,142,1,20,8,4,7,39,9,42,23,4,10,1,5,12,
+  1,238,73,103,6,3,33,8,34,39,129,160,15,9,226,11,1,4,143,10,206,8,207,6,
+  0,6,14,132,10,225,9,210,9,255,9,170,1,182,10,10,5,155,8,161,3,108,214,224,
+  7,2,215,225,7,3,0,6,19,1,29,26,23,5,248,3,2,211,3,10,224,10,225,10,
+  252,10,233,7,210,7,44,0,6,218,1,133,3,130,3,1,28,23,20,12,224,7,1,239,
+  7,236,7,241,7,138,8,151,11,0,6,219,10,166,8,181,1,136,1,15,14,1,8,35,
+  34,4,239,7,200,7,4,235,10,0,6,26,166,3,216,7,235,7,224,7,113,1,4,235,
+  6,2,15,143,2,7,252,9,220,214,7,2,0,8,157,170,204,7,2,18,3,2,8,2,
+  2,21,2,2,2,9,2,16,0,251,190,8,226,10,229,224,7,226,224,7,219,215,7,2,
+  2,177,8,128,10,6,9,6,3,6,159,11,0,8,227,169,1,227,8,1,1,10,11,165,
+  1,196,1,5,1,10,15,12,1,5,0,6,98,3,177,1,4,2,144,116,236,12,209,131,
+  1,9,81,2,24,22,11,28,57,0,5,53,4,2,60,39,29,26,9,12,20,18,41,5,
+  16,4,30,0,5,74,18,13,8,5,11,16,43,42,11,21,16,26,55,8,70,0,5,143,
+  103,2,90,2,97,10,6,2,24,22,11,28,57,2,4,0,5,104,60,39,29,26,9,12,
+  20,18,41,5,16,4,30,21,18,0,5,124,8,5,11,16,43,17,60,11,21,16,38,11,
+  55,8,58,0,251,20,2,3,8,1,191,199,6,2,3,248,189,14,249,189,14,248,189,14,
+  128,12,169,20,229,11,187,182,14,164,238,6,0,34,166,247,137,1,218,135,1,169,7,224,
+  215,14,177,169,14,237,19,189,18,184,200,14,135,183,14,214,178,14,165,202,14,142,217,14,
+  165,12,224,10,187,173,7,1,11,0,2,8,3,6,2,5,3,60,2,19,8,2,39,2,
+  44,1,11,20,2,2,62,23,57,2,22,15,60,11,5,5,4,1,8,1,11,38,55,2,
+  38,30,4,4,4,2,53,2,6,29,2,58,53,1,11,19,1,50,1,12,4,190,184,7,
+  132,5,185,24,12,255,3,208,2,176,10,243,4,209,1,219,181,14,0,43,91,4,236,183,
+  14,207,20,236,21,209,22,238,21,213,10,164,10,163,248,14,50,4,1,11,5,1,0,27,
+  89,15,12,1,5,1,3,127,21,2,140,1,1,67,2,35,2,0,27,36,2,11,2,80,
+  113,12,2,58,87,2,36,2,15,2,98,0,27,70,47,65,2,58,9,9,19,10,21,2,
+  42,2,10,67,2,0,27,50,3,2,29,9,2,10,72,123,2,126,51,5,60,80,11,0,
+  27,115,7,1,6,7,6,9,7,4,9,12,9,5,12,3,9,0,27,99,46,2,5,8,
+  5,3,1,1,1,49,70,59,11,70,241,1,0,27,2,100,97,3,1,120,2,10,2,17,
+  2,5,2,10,2,4,0,27,64,21,2,2,74,180,250,14,244,1,207,27,253,176,14,218,
+  186,14,203,191,14,198,191,14,12,3,203,191,14,216,22,1,245,245,197,191,14,196,191,14,
+  185,187,14,186,255,3,7,2,8,3,165,1,8,146,1,67,28,1,93,0,166,161,98,45,
+  18,66,11,32,1,9,139,1,46,31,8,92,4,33,0,166,179,96,8,13,97,102,39,48,
+  97,76,83,72,1,1,7,57,0,166,198,15,10,8,72,91,1,39,1,8,62,9,232,133,
+  6,111,64,9,1,104,39,82,57,63,80,11,59,2,64,54,71,41,104,133,1,64,57,1,
+  104,50,40,109,92,22,28,97,1,11,48,31,43,23,162,1,87,22,1,104,84,141,1,112,
+  137,1,44,44,54,7,93,122,7,27,75,18,31,110,1,104,79,27,115,48,18,72,19,73,
+  3,30,77,1,16,1,72,26,1,104,17,17,108,4,117,100,39,26,24,30,107,106,49,85,
+  12,68,1,104,32,72,28,102,3,39,17,11,76,47,4,37,96,55,27,76,1,104,91,98,
+  9,2,87,6,62,35,48,21,18,11,33,40,51,74,1,104,117,10,2,13,52,5,103,26,
+  56,37,10,33,12,52,19,57,1,104,105,2,33,72,9,63,32,22,6,39,7,196,1,7,
+  71,16,19,1,104,169,130,1,1,63,79,130,1,3,129,1,18,90,13,17,29,110,63,51,
+  1,104,216,12,37,89,138,1,7,143,1,86,77,140,1,7,75,33,76,79,40,1,104,230,
+  2,105,116,41,6,139,1,82,35,27,156,1,175,1,110,51,68,45,1,104,181,63,11,130,
+  1,23,22,13,58,111,34,49,52,40,6,29,37,1,104,212,53,61,1,17,38,152,1,1,
+  163,1,78,50,99,124,25,87,5,1,104,240,107,23,48,9,31,61,126,16,99,9,33,166,
+  1,130,2,161,1,3,1,105,72,135,1,9,78,45,58,58,29,103,114,59,106,13,61,49,
+  90,1,104,246,210,1,129,1,102,29,111,44,134,1,227,1,190,1,35,101,62,67,84,41,
+  1,104,244,76,4,11,6,116,22,77,67,23,30,50,111,148,1,15,20,1,105,51,105,86,
+  49,88,127,46,144,1,177,1,24,45,7,4,164,1,157,1,156,1,1,105,31,24,42,50,
+  65,84,21,185,1,80,86,59,12,74,87,1,96,1,105,27,24,114,43,8,141,1,186,1,
+  175,1,29,8,168,1,1,16,7,103,42,1,105,3,158,1,13,69,9,60,129,1,194,1,
+  41,117,88,149,1,18,20,16,78,1,105,54,33,224,2,51,140,1,43,47,1,19,90,129,
+  1,32,53,24,37,48,1,105,199,99,25,244,1,83,65,57,152,1,48,9,137,2,110,97,
+  164,1,89,107,1,105,217,75,111,31,66,216,1,21,28,133,1,115,26,226,1,171,1,123,
+  164,2,149,1,1,105,135,60,146,1,85,120,113,6,90,97,48,149,1,87,148,1,67,59,
+  132,2,1,105,163,43,100,143,1,56,122,147,1,37,140,1,95,19,152,1,41,113,6,192,
+  1,1,105,241,205,1,148,1,40,201,1,74,87,10,35,190,1,35,8,37,11,52,44,1,
+  105,209,18,219,1,24,24,114,84,32,139,1,56,105,84,67,93,178,1,62,1,105,145,190,
+  1,131,2,130,2,217,1,6,29,52,40,116,42,2,141,2,92,128,1,115,1,105,143,57,
+  212,1,72,5,193,1,69,35,222,1,127,40,33,166,1,157,1,101,104,1,105,234,233,1,
+  110,41,112,33,66,149,1,52,106,1,1,93,102,1,68,1,106,43,79,70,29,48,14,97,
+  34,23,70,2,57,66,4,7,69,1,106,51,71,50,1,5,39,20,8,4,13,1,29,50,
+  5,22,69,1,106,49,23,49,1,48,40,67,3,44,25,15,3,7,11,90,97,1,106,56,
+  23,21,7,3,251,140,6,11,29,18,87,120,33,69,1,64,64,0,166,185,1,3,64,43,
+  17,5,7,19,136,1,3,7,131,1,112,33,13,0,166,191,4,98,10,1,172,177,10,146,
+  29,221,26,158,3,2,2,5,44,228,20,231,21,147,183,14,1,249,250,243,24,159,163,4,
+  8,5,4,1,6,27,9,5,15,14,28,1,53,1,106,211,6,14,5,38,39,15,14,7,
+  40,2,7,37,30,18,19,1,106,227,15,22,3,29,14,214,186,4,171,246,14,1,95,10,
+  56,31,5,23,68,0,27,208,19,48,19,31,12,32,18,51,50,9,11,18,49,12,10,0,
+  27,216,45,28,23,56,19,25,22,12,25,32,11,30,51,32,46,0,27,243,25,48,3,6,
+  3,43,4,2,2,4,1,7,12,2,162,235,14,1,246,193,235,6,233,4,115,2,227,180,
+  14,2,216,209,14,185,26,178,22,129,21,176,20,235,221,14,180,210,14,169,13,240,28,1,
+  245,20,250,22,165,221,14,174,198,14,242,6,161,179,15,249,1,174,1,68,3,5,8,3,
+  1,13,5,0,9,234,10,15,12,1,5,1,3,42,1,233,1,2,20,8,48,2,0,9,
+  154,2,22,9,2,10,47,16,2,66,99,2,40,2,15,2,0,9,206,55,7,11,29,20,
+  9,21,46,2,10,130,1,1,37,1,71,0,9,182,2,37,2,11,2,45,2,228,1,223,
+  1,170,1,171,1,170,1,97,96,38,0,9,243,22,247,1,118,119,118,34,147,1,118,20,
+  8,9,15,2,22,19,0,9,194,64,2,63,2,180,134,1,166,160,14,137,193,14,238,2,
+  217,10,236,4,174,221,14,131,246,6,46,5,1,1,28,89,15,12,1,5,1,3,27,4,
+  2,78,215,1,2,20,4,46,1,28,37,35,2,22,9,2,10,43,12,2,58,87,2,36,
+  2,15,1,28,15,52,5,9,29,20,9,21,44,2,10,10,3,2,29,2,1,28,24,2,
+  41,2,74,67,3,2,64,116,18,5,17,16,17,10,1,28,107,33,12,18,19,18,9,4,
+  17,16,17,59,6,7,6,1,1,28,47,20,4,5,15,2,18,15,2,6,3,2,28,222,
+  233,6,4,245,178,14,0,41,248,194,169,14,146,22,225,24,155,182,14,134,184,14,199,2,
+  212,24,217,227,14,206,232,14,165,196,14,205,10,157,3,234,206,14,84,26,1,250,76,227,
+  207,14,234,206,14,84,181,207,14,210,206,14,24,18,84,17,23,68,3,2,229,207,14,234,
+  206,14,1,250,62,197,207,14,234,206,14,84,187,207,14,234,206,14,84,39,5,8,2,7,
+  2,173,209,14,169,7,230,23,0,38,137,1,73,138,2,128,19,2,10,3,6,3,5,2,
+  201,23,246,23,213,17,144,18,0,38,102,136,14,242,174,14,237,198,14,174,206,14,137,199,
+  14,3,198,23,183,19,1,192,177,14,161,178,14,220,2,128,186,14,177,186,14,136,186,14,
+  1,245,164,253,188,14,250,18,20,169,5,154,5,17,133,17,136,187,14,131,190,14,223,8,
+  8,164,206,14,247,198,14,3,3,0,32,76,160,45,241,22,1,146,16,244,4,219,28,158,
+  31,163,31,166,31,191,2,227,28,166,31,162,175,14,12,193,198,14,0,37,252,139,8,158,
+  31,153,20,180,1,228,18,167,24,132,185,14,165,163,14,210,169,14,233,184,14,205,6,226,
+  191,14,131,190,14,227,8,8,1,247,130,221,176,14,177,22,3,3,141,7,228,14,6,173,
+  29,162,45,176,161,14,235,179,14,4,213,3,180,189,14,166,8,1,247,141,199,177,14,2,
+  255,21,206,22,171,20,152,2,205,1,255,2,164,190,14,227,165,14,141,31,152,8,9,28,
+  146,198,14,1,247,157,33,153,8,191,186,14,17,181,1,206,188,14,237,198,14,172,206,14,
+  153,199,14,3,100,2,240,22,221,1,255,21,1,247,152,12,129,178,14,205,13,1,1,141,
+  26,65,10,22,24,244,11,188,219,14,4,8,16,1,251,29,30,45,62,29,53,30,62,31,
+  43,60,29,57,16,30,62,1,251,42,16,29,53,30,62,29,45,60,29,59,8,16,30,62,
+  31,1,251,20,62,29,53,30,62,75,60,29,57,16,30,62,31,43,60,1,251,34,53,30,
+  62,29,45,60,29,195,31,202,3,238,2,125,238,24,241,26,204,14,23,1,247,164,14,24,
+  97,20,217,11,162,20,139,17,175,1,137,1,18,210,22,143,163,14,7,1,3,0,49,181,
+  181,2,202,2,193,2,160,2,4,155,2,4,138,2,145,2,158,2,211,2,182,2,143,2,
+  7,21,0,49,28,144,2,141,2,4,8,4,128,2,253,1,59,10,214,2,151,2,238,1,
+  50,217,2,48,0,49,45,254,1,3,18,21,253,1,49,164,2,167,2,222,2,225,2,218,
+  2,227,2,8,64,132,2,0,49,47,39,38,160,2,25,2,21,1,137,2,53,22,10,6,
+  7,21,60,0,49,171,129,2,47,10,7,156,2,50,136,135,14,133,169,14,183,21,216,31,
+  211,34,244,44,2,251,44,33,0,46,36,141,41,251,2,37,178,44,223,41,2,86,222,194,
+  14,245,3,200,1,172,5,168,16,223,22,213,195,14,146,28,0,41,210,215,17,29,5,7,
+  50,23,5,17,54,17,5,10,29,5,69,0,37,18,42,49,34,68,35,59,48,55,40,76,
+  58,29,5,9,4,0,37,123,143,1,63,7,27,238,1,12,233,1,4,222,1,233,1,4,
+  228,1,123,63,200,1,0,37,23,39,144,1,63,15,68,47,16,16,21,16,32,13,86,1,
+  4,0,37,112,6,246,216,14,23,8,2,10,17,20,25,16,7,14,19,16,7,1,251,170,
+  239,216,14,1,73,4,82,149,1,55,7,23,222,218,14,245,216,14,16,231,1,4,216,1,
+  0,37,4,4,222,1,16,145,1,55,7,35,116,47,15,84,47,16,16,25,0,37,57,32,
+  9,72,23,5,49,15,35,23,8,15,100,33,25,33,0,37,34,25,164,1,23,5,38,17,
+  5,57,51,15,62,51,15,154,1,17,0,37,94,216,207,14,199,19,198,9,131,154,7,78,
+  5,1,10,15,12,1,5,1,3,59,1,16,5,2,20,4,46,2,35,2,22,9,2,10,
+  43,12,2,58,1,16,7,2,36,2,15,2,52,12,17,9,29,20,9,21,200,1,127,1,
+  16,55,1,118,2,149,1,2,10,10,3,2,29,2,11,2,41,2,1,16,47,67,2,5,
+  2,64,90,18,5,17,16,17,84,73,18,33,1,16,100,2,25,18,19,18,9,4,17,16,
+  17,13,5,2,2,4,1,16,1,1,6,218,1,215,1,3,136,1,27,22,4,23,18,15,
+  2,18,94,1,16,116,111,2,6,2,5,2,253,160,7,2,4,8,16,32,64,128,1,128,
+  2,0,40,191,191,1,128,2,127,223,1,128,1,128,2,127,191,1,128,2,127,239,1,64,
+  128,1,128,2,127,0,40,87,128,2,127,223,1,128,1,128,2,127,191,1,128,2,127,247,
+  1,32,64,128,1,128,2,127,0,40,91,128,2,127,223,1,128,1,128,2,127,191,1,128,
+  2,127,239,1,64,128,1,128,2,127,191,1,0,40,211,127,223,1,128,1,128,2,127,191,
+  1,128,2,127,251,1,16,32,64,128,1,128,2,127,0,40,93,128,2,127,223,1,128,1,
+  128,2,127,191,1,128,2,127,239,1,64,128,1,128,2,127,191,1,0,40,213,127,223,1,
+  128,1,128,2,127,191,1,128,2,127,247,1,32,64,128,1,128,2,127,191,1,0,40,217,
+  127,223,1,128,1,128,2,127,191,1,128,2,127,239,1,64,128,1,128,2,127,191,1,128,
+  2,0,40,145,223,1,128,1,128,2,127,191,1,128,2,127,253,1,8,16,32,64,128,1,
+  128,2,127,0,40,94,128,2,127,223,1,128,1,128,2,127,191,1,128,2,127,239,1,64,
+  128,1,128,2,127,191,1,0,40,214,127,223,1,128,1,128,2,127,191,1,128,2,127,247,
+  1,32,64,128,1,128,2,127,191,1,0,40,218,127,223,1,128,1,128,2,127,191,1,128,
+  2,127,239,1,64,128,1,128,2,127,191,1,128,2,0,40,146,223,1,128,1,128,2,127,
+  191,1,128,2,127,251,1,16,32,64,128,1,128,2,127,191,1,0,40,220,127,223,1,128,
+  1,128,2,127,191,1,128,2,127,239,1,64,128,1,128,2,127,191,1,128,2,0,40,148,
+  223,1,128,1,128,2,127,191,1,128,2,127,247,1,32,64,128,1,128,2,127,191,1,128,
+  2,0,40,152,223,1,128,1,128,2,127,191,1,128,2,127,239,1,64,128,1,128,2,127,
+  191,1,128,2,127,0,40,32,128,1,128,2,127,191,1,128,2,127,192,197,14,131,26,166,
+  23,177,217,15,178,220,15,129,22,205,5,230,6,236,22,1,249,102,255,226,15,202,139,1,
+  146,196,14,202,21,213,3,250,2,184,4,135,1,143,26,247,231,14,19,31,14,5,15,0,
+  26,22,17,25,36,23,2,6,15,2,16,6,2,21,26,6,23,0,26,19,5,28,5,3,
+  3,6,3,175,11,20,5,5,26,31,4,22,0,23,75,5,5,8,8,6,19,7,26,5,
+  12,2,136,242,14,233,206,14,238,7,164,205,14,1,245,108,187,190,14,194,181,14,186,13,
+  6,213,8,2,198,21,121,221,163,1,1,8,2,3,1,5,1,208,161,241,1,116,11,157,
+  1,76,164,1,197,1,196,1,99,182,1,183,2,2,126,91,232,1,1,208,115,242,1,1,
+  4,4,11,2,8,175,2,123,70,88,196,1,2,3,141,3,1,208,153,132,1,1,4,2,
+  25,4,1,3,8,9,50,169,1,4,1,4,1,208,230,191,1,11,161,1,106,29,194,1,
+  117,37,24,39,163,1,196,2,1,1,46,1,208,52,138,2,8,4,7,14,1,13,12,24,
+  1,15,2,15,22,1,1,208,190,52,2,133,3,242,1,204,1,201,1,2,61,132,1,2,
+  223,1,11,178,1,62,131,2,1,208,184,23,163,2,88,29,134,1,229,1,40,104,200,2,
+  3,193,3,24,100,200,2,3,1,208,36,182,1,234,1,243,2,16,142,1,125,112,1,4,
+  161,1,52,16,143,1,170,1,84,1,208,138,8,1,1,187,1,94,144,1,3,2,12,2,
+  16,33,32,19,2,1,208,167,1,22,179,1,45,85,100,40,173,1,1,138,1,79,24,146,
+  1,111,68,1,208,9,106,64,127,52,42,149,1,126,16,4,73,102,38,101,66,42,1,208,
+  113,225,1,46,74,45,15,24,128,1,242,1,2,4,1,11,2,4,1,1,208,126,189,1,
+  146,3,199,2,51,2,116,163,1,166,1,187,1,14,68,174,1,181,1,150,1,3,1,208,
+  119,4,201,1,38,18,204,1,29,51,83,25,90,22,5,10,211,1,1,1,208,88,109,15,
+  162,1,38,1,176,1,4,1,4,19,133,3,2,144,1,5,202,139,1,0,33,6,188,20,
+  194,186,14,168,17,195,16,2,197,4,149,255,14,2,17,224,18,171,18,166,6,129,6,160,
+  2,144,1,0,24,177,132,1,2,233,14,232,1,5,2,28,5,2,2,5,5,2,2,15,
+  0,21,8,238,5,143,3,5,2,2,169,4,33,2,13,184,7,5,2,2,5,1,0,20,
+  83,182,18,14,193,18,178,7,5,2,2,5,1,74,5,2,2,5,1,0,20,8,216,7,
+  246,11,251,11,2,81,5,2,2,5,1,94,5,1,130,12,5,0,20,75,41,2,200,6,
+  5,2,2,5,1,153,7,252,8,87,7,2,2,16,0,22,30,2,2,5,1,11,3,188,
+  11,239,11,5,2,2,5,1,24,1,0,21,253,2,2,5,1,88,5,2,28,5,2,2,
+  5,1,15,5,0,22,34,41,5,2,2,5,1,1,5,2,231,4,234,4,5,1,39,1,
+  0,21,234,2,2,5,1,49,5,2,2,5,1,146,2,5,2,18,1,0,22,86,2,2,
+  5,1,3,5,1,217,1,5,2,2,5,1,198,1,5,0,22,61,7,5,2,2,5,1,
+  20,5,1,76,5,2,2,5,1,0,21,231,5,2,2,5,146,2,5,2,2,5,1,137,
+  2,25,5,2,2,0,21,209,1,134,1,5,2,2,5,1,112,1,5,2,2,5,1,237,
+  6,0,22,109,195,7,2,2,2,28,4,23,4,4,4,4,177,2,182,19,225,18,228,4,
+  0,21,89,2,11,1,4,2,237,4,4,8,2,8,19,14,4,236,18,247,18,0,20,36,
+  8,236,18,247,18,234,4,2,172,4,165,4,249,4,190,5,249,5,6,2,80,174,1,33,
+  0,20,115,13,152,17,153,17,4,2,2,2,40,11,4,242,16,137,17,4,4,4,0,20,
+  124,220,1,31,2,13,210,15,211,15,166,3,3,2,9,2,2,2,155,3,2,0,20,215,
+  2,28,4,23,4,4,4,4,81,33,2,13,172,16,173,16,146,1,0,21,82,169,2,47,
+  2,2,2,194,1,165,1,4,23,4,4,4,4,56,158,2,0,21,97,4,183,2,2,13,
+  65,59,112,42,120,8,9,8,3,2,17,0,20,101,147,1,9,206,4,238,149,8,2,9,
+  2,2,2,14,2,9,2,2,2,0,24,188,247,15,170,3,3,2,11,196,3,193,3,2,
+  2,2,255,2,31,2,166,3,190,3,0,22,118,9,2,2,2,223,6,2,236,15,255,12,
+  3,2,11,2,2,2,2,0,21,124,225,2,4,7,250,15,4,4,4,141,19,164,19,1,
+  4,2,35,4,4,0,24,205,14,12,2,11,207,18,77,212,18,205,17,33,2,17,138,18,
+  139,18,4,2,0,20,51,2,128,18,223,17,4,23,4,4,4,4,232,17,225,12,3,2,
+  11,226,3,0,21,127,2,2,2,99,25,186,14,169,14,2,13,128,14,133,14,8,2,2,
+  2,0,24,211,137,14,128,14,2,2,2,2,153,15,33,2,13,162,15,247,11,5,2,2,
+  0,24,236,163,11,9,184,11,227,16,182,3,5,2,2,164,13,1,143,17,190,2,167,1,
+  112,31,0,21,22,214,14,225,14,2,2,2,2,216,14,189,14,4,23,4,4,4,4,198,
+  14,0,20,239,2,2,2,211,1,5,2,2,238,16,130,136,8,5,2,2,237,150,8,13,
+  4,0,20,246,4,4,4,4,175,2,33,2,17,212,17,213,17,188,4,136,1,3,2,11,
+  0,21,168,2,2,2,137,1,2,17,4,4,4,2,254,13,247,13,246,13,169,18,2,0,
+  21,137,5,2,2,194,13,1,175,18,2,50,5,144,4,1,242,13,247,13,2,2,0,24,
+  230,1,249,17,2,15,4,23,4,4,4,4,168,4,5,2,2,181,5,0,20,25,180,18,
+  205,18,162,2,4,23,4,4,4,4,130,3,185,3,4,23,4,4,0,20,123,4,220,1,
+  196,1,170,14,187,14,12,174,14,243,15,4,23,4,4,4,4,81,0,20,183,4,23,4,
+  4,4,4,46,4,7,255,1,9,4,23,4,4,0,20,65,4,156,4,120,5,2,2,121,
+  89,4,23,4,4,4,4,61,0,21,3,23,4,4,4,4,212,1,141,4,4,23,4,4,
+  4,4,143,1,4,0,20,13,4,4,4,4,214,4,11,4,23,4,4,4,4,202,14,157,
+  19,4,0,20,18,4,212,9,189,3,1,5,2,2,190,3,2,11,2,2,2,2,249,4,
+  0,20,143,59,208,1,95,58,253,2,92,38,214,2,193,2,105,158,4,2,2,13,186,14,
+  0,21,38,4,2,2,2,176,14,147,14,4,23,4,4,4,4,144,173,111,203,170,96,155,
+  190,14,1,245,111,133,8,254,23,233,9,237,162,14,219,31,254,1,230,187,14,247,3,246,
+  3,249,210,14,153,3,18,190,137,7,14,4,1,2,177,42,71,20,28,42,29,2,15,24,
+  17,2,51,6,80,71,1,2,202,2,2,2,47,18,12,33,15,24,43,14,5,72,49,3,
+  1,2,175,18,20,2,43,52,33,7,26,53,72,16,41,13,217,255,7,178,195,15,1,243,
+  143,150,28,137,5,211,201,14,186,180,14,82,144,8,6,153,195,7,125,48,45,34,60,77,
+  58,1,5,74,1,44,39,47,28,40,11,53,4,60,8,75,40,13,5,1,5,94,25,27,
+  2,62,73,14,14,4,8,10,22,41,11,36,2,1,5,61,38,26,73,72,17,16,53,66,
+  77,9,12,7,171,252,6,215,21,249,127,1,245,72,203,210,15,196,129,1,148,245,6,7,
+  173,222,6,64,252,206,14,189,165,7,30,5,5,1,10,15,12,1,17,60,5,1,3,24,
+  125,52,2,35,2,22,9,2,10,37,6,1,17,10,56,67,20,2,15,2,54,66,73,9,
+  29,20,9,22,2,1,17,34,6,29,2,11,2,25,132,1,69,5,1,40,5,36,5,125,
+  1,17,0,4,98,23,60,47,4,5,52,59,2,10,4,11,2,187,155,3,0,170,76,17,
+  27,1,4,5,74,5,1,10,15,12,1,5,1,3,0,170,0,8,50,8,5,35,2,16,
+  8,5,37,130,1,5,1,20,7,0,170,66,10,4,4,11,6,127,2,62,77,26,2,17,
+  2,58,7,0,170,31,13,25,1,14,2,3,14,35,42,4,1,16,8,1,37,0,170,20,
+  35,70,5,118,2,3,6,107,14,2,9,3,2,8,1,0,170,45,10,227,167,4,146,210,
+  14,1,29,203,182,14,214,189,14,174,20,227,26,186,19,253,23,193,128,15,102,4,4,0,
+  19,220,5,2,2,115,10,4,2,2,2,2,2,2,2,32,29,0,19,177,2,31,10,24,
+  2,2,2,2,2,2,2,2,2,2,112,0,19,190,4,2,2,2,2,2,67,70,2,2,
+  2,2,2,4,1,0,19,206,2,2,2,2,4,4,4,10,2,2,2,2,2,2,2,0,
+  19,229,2,2,2,135,1,2,136,1,2,2,2,2,2,2,2,2,2,0,19,243,2,248,
+  221,4,102,4,4,10,5,2,2,115,10,4,2,2,2,0,171,124,2,2,2,32,29,2,
+  2,31,10,24,2,2,2,2,2,0,171,137,2,2,2,2,159,222,4,162,222,4,4,2,
+  2,2,2,2,67,70,2,0,171,152,2,2,2,4,1,4,2,2,2,2,4,4,4,10,
+  2,0,171,175,2,2,2,2,2,2,2,2,2,135,1,2,136,1,2,2,2,0,171,189,
+  2,2,141,223,4,2,2,2,2,172,253,14,51,15,145,180,14,218,183,14,252,22,179,12,
+  241,9,0,38,183,232,178,14,238,23,227,166,7,32,27,10,5,1,4,8,4,2,2,2,
+  6,1,15,194,5,8,35,38,27,8,3,32,5,12,3,3,6,7,252,142,7,0,38,234,
+  248,178,14,215,167,14,201,15,192,15,201,15,4,1,226,15,13,16,223,15,2,13,130,173,
+  14,163,157,14,0,34,155,200,36,255,7,222,158,14,1,127,170,31,3,2,129,15,219,185,
+  14,233,16,148,7,5,1,10,0,36,96,12,1,5,1,146,2,156,21,191,30,238,185,14,
+  235,185,14,6,202,28,208,34,28,29,28,0,50,109,28,39,28,18,39,28,47,28,19,28,
+  33,28,5,28,41,0,50,115,31,28,21,28,17,28,45,28,251,42,209,16,204,183,14,196,
+  3,1,193,254,13,31,0,50,165,27,22,2,39,15,76,31,3,9,21,13,1,30,36,7,
+  0,50,69,4,162,1,30,1,23,30,53,7,20,56,79,15,60,179,1,204,1,0,50,174,
+  25,14,195,1,166,1,37,1,28,4,7,52,29,23,56,69,13,0,50,129,22,2,246,144,
+  14,185,22,2,183,249,13,6,44,6,3,6,3,51,8,6,0,50,214,6,3,46,6,3,
+  6,3,23,6,3,6,3,35,68,6,0,50,247,6,3,59,6,3,6,3,6,6,3,6,
+  3,29,82,4,0,50,252,4,21,4,1,239,1,2,141,55,2,2,2,2,2,2,2,2,
+  0,36,191,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,36,207,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,0,36,223,2,2,2,2,2,2,2,2,2,
+  2,174,19,211,28,192,30,137,23,188,55,0,36,106,8,162,57,229,1,210,1,16,5,1,
+  10,229,1,214,1,12,1,5,1,147,57,0,36,114,3,188,55,189,55,188,55,199,55,190,
+  55,183,55,220,55,178,1,167,1,1,172,1,211,1,34,174,1,0,50,177,167,1,1,225,
+  55,16,202,55,5,1,10,31,16,12,1,5,1,159,44,0,41,183,4,199,28,194,54,251,
+  25,187,28,250,212,14,255,212,14,252,212,14,149,209,14,216,24,16,167,10,136,168,14,223,
+  149,14,158,149,14,0,42,16,227,166,1,152,205,15,94,165,3,175,145,14,84,91,114,185,
+  1,104,2,86,53,74,31,0,46,236,13,17,28,43,7,36,15,13,40,67,8,49,48,34,
+  42,0,46,243,47,127,104,93,61,130,1,53,17,39,60,106,4,1,75,25,0,46,163,78,
+  52,75,4,1,77,146,1,149,1,2,96,80,7,4,10,145,1,0,46,136,2,16,5,4,
+  1,132,1,2,43,13,47,64,59,108,2,67,0,46,177,4,1,14,41,2,63,164,1,63,
+  59,49,22,17,4,1,102,0,46,175,17,64,12,56,2,185,1,2,10,4,2,46,2,33,
+  41,24,0,46,193,96,71,2,89,2,66,2,254,11,34,7,12,29,10,40,21,0,49,198,
+  8,6,9,5,12,6,38,35,6,18,14,11,14,35,18,0,49,211,12,41,54,13,1,27,
+  42,59,58,55,2,254,142,14,169,7,198,2,231,1,0,35,154,194,191,14,142,23,237,17,
+  152,2,24,17,24,35,24,25,24,13,24,39,24,1,245,86,24,25,24,15,24,37,24,5,
+  24,43,24,183,176,14,157,28,162,203,14,159,180,14,0,34,49,235,1,186,208,14,173,3,
+  2,149,205,14,238,38,187,44,138,210,14,143,170,14,134,171,14,75,2,183,168,14,4,1,
+  0,42,210,224,160,14,235,162,14,8,157,17,208,180,14,3,2,4,238,23,136,3,156,3,
+  245,28,218,23,233,202,14,210,207,14,1,244,165,213,209,15,180,136,1,229,6,191,118,44,
+  84,144,106,3,245,105,226,106,212,11,37,12,44,173,118,1,19,59,233,192,8,80,186,106,
+  137,106,55,51,7,64,9,73,86,208,118,8,139,119,4,0,3,38,128,236,7,14,207,230,
+  7,216,135,5,209,135,5,232,135,5,139,226,3,43,60,25,27,42,204,226,3,237,226,3,
+  2,0,45,233,6,2,16,1,35,26,146,226,3,5,251,225,3,10,6,192,226,3,241,226,
+  3,46,7,0,45,234,162,226,3,159,226,3,14,2,142,226,3,151,226,3,4,142,226,3,
+  5,165,226,3,50,254,225,3,5,245,225,3,43,0,45,228,181,165,1,9,242,135,5,235,
+  135,5,1,212,135,5,4,221,135,5,214,230,7,2,255,222,2,231,161,4,218,171,4,5,
+  1,0,168,233,15,12,1,5,1,3,20,4,2,2,2,7,10,2,209,151,5,0,3,36,
+  154,94,211,94,226,107,191,106,105,174,107,113,1,233,106,164,1,1,226,105,251,106,164,1,
+  182,106,0,3,51,86,2,178,93,241,93,250,93,26,2,207,93,15,12,132,235,7,2,169,
+  236,7,116,188,118,0,26,176,163,94,170,94,212,24,6,1,8,1,7,12,185,118,22,148,
+  118,200,252,13,80,77,1,224,29,33,15,76,37,39,42,25,1,62,3,59,8,2,2,2,
+  1,224,17,2,2,22,5,13,32,15,13,2,39,62,1,1,51,66,1,224,35,53,3,181,
+  178,6,1,5,10,5,1,3,20,2,2,4,1,199,192,8,0,3,0,44,84,144,106,5,
+  129,106,1,130,188,14,1,1,255,187,14,6,12,131,1,36,174,94,0,3,17,60,22,154,
+  94,183,94,202,106,148,75,1,195,74,1,53,6,2,4,2,253,105,0,29,242,59,38,35,
+  2,36,2,129,106,222,105,219,105,9,150,106,43,36,47,14,0,3,106,9,230,105,151,12,
+  2,2,156,12,2,30,13,243,105,234,105,243,105,154,106,11,2,0,3,108,188,105,50,2,
+  12,249,105,166,93,177,93,154,106,7,131,106,134,106,227,12,159,93,238,105,151,107,0,3,
+  73,154,118,48,223,11,211,106,5,105,232,118,157,24,4,188,24,167,118,105,164,119,6,230,
+  244,6,0,254,39,11,14,221,141,7,228,24,229,118,3,184,118,191,118,91,90,230,235,7,
+  14,11,14,207,129,7,0,29,204,11,203,106,84,248,93,187,94,204,106,208,150,7,2,4,
+  2,3,129,163,7,227,94,56,180,94,0,26,189,2,20,209,94,6,134,119,161,119,134,119,
+  48,189,118,222,106,209,106,1,4,59,176,118,0,26,194,4,213,94,166,119,195,119,54,230,
+  118,183,118,9,3,188,118,161,12,141,106,148,94,21,146,12,0,32,219,175,119,90,242,235,
+  7,233,235,7,236,235,7,189,141,7,45,232,24,171,119,198,107,175,107,98,134,106,2,137,
+  107,0,3,41,42,214,118,223,11,133,13,241,93,44,196,93,179,93,232,105,234,32,175,151,
+  1,40,164,128,1,182,230,14,215,223,14,0,35,132,176,201,14,163,9,152,10,1,207,174,
+  14,245,28,180,11,182,194,14,223,8,215,201,14,208,2,4,138,1,6,3,0,35,129,165,
+  5,218,197,14,158,1,159,2,32,18,213,154,14,143,1,228,1,95,23,110,97,94,201,1,
+  0,3,238,136,163,1,48,35,4,99,199,162,1,140,163,1,75,179,162,1,200,162,1,203,
+  162,1,212,162,1,4,219,162,1,140,163,1,0,44,156,104,115,4,4,8,44,72,35,32,
+  15,12,3,11,27,12,0,44,218,8,4,7,12,99,31,28,23,60,187,163,1,20,240,162,
+  1,51,56,43,0,44,168,75,20,198,1,2,2,238,215,6,5,1,10,15,12,1,5,1,
+  48,1,2,241,5,18,19,18,10,17,2,12,17,16,17,9,4,18,19,1,2,244,39,197,
+  215,6,2,2,9,1,4,2,101,143,1,228,1,95,23,110,97,0,44,236,201,1,175,162,
+  1,136,163,1,48,35,4,99,199,162,1,140,163,1,75,179,162,1,200,162,1,203,162,1,
+  212,162,1,4,0,3,231,140,163,1,31,104,115,4,4,8,44,72,35,32,15,12,3,11,
+  0,44,191,12,44,8,4,7,12,99,31,28,23,60,187,163,1,20,240,162,1,51,0,44,
+  167,43,48,75,20,174,1,10,7,2,8,5,2,142,145,14,139,194,15,158,232,15,209,177,
+  14,0,34,88,230,209,14,173,206,14,2,246,192,13,5,1,10,15,12,1,5,1,5,5,
+  1,1,211,104,15,12,1,5,1,224,132,1,153,2,84,164,21,153,19,179,6,252,25,143,
+  23,118,140,21,0,39,76,197,4,1,210,32,1,228,155,14,1,233,6,131,8,235,171,14,
+  112,138,182,14,214,24,179,231,14,186,214,14,57,1,245,46,165,204,14,238,220,14,151,213,
+  6,14,30,28,45,180,1,81,2,70,1,3,2,197,1,1,36,77,14,2,55,93,30,18,
+  10,20,86,151,1,180,1,207,1,148,1,12,2,1,36,56,93,30,18,10,20,65,180,1,
+  89,4,2,3,52,1,157,1,14,1,36,29,28,45,180,1,79,6,3,2,52,1,35,53,
+  86,13,133,1,18,1,36,100,7,6,109,92,6,175,1,14,30,28,45,180,1,83,2,3,
+  29,1,36,51,93,148,1,133,1,30,28,45,180,1,85,125,148,1,12,53,2,93,30,1,
+  36,32,8,2,18,2,22,2,117,148,1,12,53,72,133,1,18,8,20,1,36,91,6,40,
+  4,1,5,2,225,17,2,2,2,2,2,2,2,2,1,32,9,2,22,19,2,2,2,2,
+  2,2,2,188,13,160,4,217,17,220,17,217,17,1,32,22,182,13,179,13,2,2,2,2,
+  2,204,17,201,17,2,2,2,2,2,2,1,32,36,2,2,2,2,2,2,2,142,13,139,
+  13,2,2,4,2,3,6,1,32,51,2,2,2,2,2,4,4,2,3,3,10,2,2,2,
+  132,17,1,32,66,2,130,17,2,2,131,17,2,2,2,2,2,2,2,2,2,6,1,32,
+  78,242,16,239,16,4,2,2,2,2,230,16,227,16,2,2,2,2,2,2,1,32,93,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,35,115,139,12,184,16,169,4,139,
+  12,2,2,2,2,2,2,172,16,169,16,172,16,169,16,172,16,1,32,119,2,2,248,11,
+  245,11,4,1,4,2,2,238,11,235,11,2,152,16,2,2,1,36,144,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,36,160,2,2,2,2,2,2,2,2,203,16,2,
+  2,2,2,2,2,1,32,137,2,4,1,4,2,2,180,16,177,16,180,16,177,16,2,2,
+  2,2,2,1,32,151,8,2,2,9,2,2,8,2,152,16,149,16,152,16,149,16,152,16,
+  2,2,1,36,176,2,2,2,2,163,16,2,2,2,2,2,2,158,11,155,11,2,2,1,
+  32,172,2,2,2,2,2,2,140,11,250,4,131,16,2,2,2,2,108,105,1,32,185,2,
+  2,2,250,10,247,10,250,10,247,10,2,238,15,235,15,2,2,2,2,230,15,1,32,197,
+  2,228,15,2,227,15,2,2,2,224,15,2,223,15,2,224,15,2,223,15,2,1,32,207,
+  2,220,15,217,15,2,2,2,2,2,2,2,2,2,2,2,198,15,1,32,221,198,15,2,
+  2,199,15,2,200,15,2,2,2,203,15,2,2,2,2,2,1,32,230,2,192,15,189,15,
+  2,2,2,2,184,15,179,15,2,180,15,177,15,2,2,2,1,32,244,2,2,2,6,1,
+  1,6,2,2,252,9,249,9,2,150,15,147,15,6,1,33,1,2,4,4,1,4,234,9,
+  231,9,2,2,2,2,2,2,2,2,1,33,17,2,6,3,240,14,237,14,4,2,2,10,
+  222,14,229,14,2,2,2,4,1,33,33,216,14,219,14,2,4,2,2,2,2,2,2,2,
+  4,1,200,14,195,14,1,33,45,2,194,14,191,14,2,2,2,2,2,2,2,2,2,2,
+  2,2,1,33,60,2,2,254,8,251,8,2,2,2,2,2,2,2,2,6,1,1,1,33,
+  75,2,2,2,4,2,2,5,8,2,2,2,2,2,2,2,1,35,126,197,8,200,8,197,
+  8,2,2,2,226,13,223,13,2,2,2,2,2,2,2,1,33,104,176,8,171,8,1,4,
+  172,8,169,8,172,8,169,8,2,198,13,195,13,2,2,2,2,1,35,131,157,8,2,2,
+  2,2,2,2,2,146,8,143,8,2,2,2,2,2,1,33,130,2,132,8,129,8,2,2,
+  128,8,253,7,150,13,147,13,2,2,146,13,151,5,247,7,2,1,33,141,2,2,2,2,
+  2,2,2,2,2,2,4,1,4,2,168,7,1,33,156,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,1,33,172,2,2,2,2,2,2,2,2,2,2,2,2,102,99,2,
+  1,33,187,2,2,2,2,2,2,2,2,2,2,134,7,131,7,2,2,2,1,33,202,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,33,218,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,1,33,234,212,11,207,11,6,2,5,2,6,200,11,2,2,
+  2,2,2,2,2,1,36,221,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+  36,237,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,36,253,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,1,37,13,2,2,2,2,2,2,2,2,2,2,
+  2,203,12,2,2,2,1,33,246,2,2,2,2,2,2,2,42,142,12,139,12,4,232,5,
+  233,5,5,37,1,33,255,182,12,179,12,148,6,145,6,2,178,12,175,12,2,2,2,2,
+  2,2,2,2,1,34,12,2,158,12,2,163,6,249,5,2,158,12,155,12,12,2,4,1,
+  4,2,2,1,34,29,2,2,2,4,1,4,2,2,2,2,2,2,198,5,195,5,234,11,
+  1,34,43,2,2,2,2,2,2,2,12,3,2,210,11,2,219,11,2,2,1,34,57,8,
+  5,2,2,162,5,157,5,2,158,5,155,5,2,4,1,4,4,1,1,34,71,2,6,3,
+  2,4,2,2,2,2,2,252,4,2,251,4,2,2,1,34,85,248,4,162,6,159,6,162,
+  6,153,11,156,11,2,2,2,2,161,11,2,2,160,11,157,11,1,34,91,2,2,154,11,
+  2,153,11,156,11,153,11,2,2,2,226,4,223,4,16,2,15,1,34,101,2,2,2,4,
+  1,8,2,2,2,2,2,2,2,2,2,1,34,119,2,2,2,2,2,2,2,172,4,169,
+  4,20,17,2,2,2,2,1,34,133,2,2,2,154,4,149,4,8,5,2,2,4,2,2,
+  2,2,4,1,34,168,138,10,177,10,38,33,2,2,172,10,169,10,250,3,247,3,2,2,
+  2,2,2,1,37,47,157,10,2,158,10,155,10,2,2,2,2,6,2,2,2,2,2,2,
+  1,34,176,2,2,2,2,2,2,2,244,9,241,9,2,2,2,238,9,235,9,2,1,37,
+  51,2,2,237,9,2,2,2,2,2,2,2,2,2,2,2,2,1,34,203,2,2,2,2,
+  2,2,2,2,4,1,4,2,2,2,186,9,1,37,55,185,9,2,2,184,9,181,9,2,
+  2,2,2,2,2,2,2,2,2,1,34,232,2,2,2,2,6,3,2,4,2,2,2,2,
+  2,2,2,1,34,248,2,2,254,8,251,8,2,2,2,2,176,2,173,2,2,4,2,3,
+  6,1,35,6,2,2,228,8,2,227,8,2,2,2,4,2,2,146,2,151,2,8,2,1,
+  35,19,12,9,12,2,11,2,2,2,8,2,2,244,1,241,1,2,2,1,35,34,2,2,
+  2,2,2,2,2,2,2,162,8,159,8,2,2,2,2,1,35,49,2,2,148,8,145,8,
+  2,2,2,2,2,2,136,8,133,8,2,2,2,1,35,63,2,2,2,2,2,2,244,7,
+  2,243,7,2,2,2,2,2,2,1,35,77,2,2,2,2,2,2,2,2,4,2,3,6,
+  2,2,2,1,35,93,4,1,198,7,193,7,2,2,2,2,2,2,2,2,2,2,176,7,
+  1,35,107,2,174,7,171,7,2,223,241,7,204,201,14,186,1,193,183,14,216,181,14,195,
+  214,14,181,3,1,196,19,130,180,14,153,208,15,1,243,91,243,175,14,154,176,14,170,13,
+  204,10,209,25,165,191,14,166,147,7,2,2,6,6,4,2,2,2,1,8,14,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,1,8,3,54,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,1,8,45,2,2,2,2,89,92,2,2,2,4,2,8,6,162,157,
+  1,2,1,47,146,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,47,162,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,47,178,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,1,47,194,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,1,47,210,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,47,226,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,47,242,195,175,9,128,3,4,43,
+  4,68,111,236,1,107,4,147,1,157,2,178,1,128,136,5,31,0,166,76,139,137,5,128,
+  138,5,189,137,5,158,2,124,119,192,134,5,132,1,219,133,5,175,4,35,140,137,5,72,
+  88,47,0,4,5,250,136,5,229,136,5,230,137,5,12,187,133,5,249,3,254,2,143,3,
+  17,166,4,55,28,181,1,209,2,226,2,0,4,29,138,2,74,194,1,11,177,1,209,2,
+  220,1,217,1,146,2,111,189,1,198,3,195,1,3,208,1,0,4,144,153,2,68,154,2,
+  148,1,4,167,3,212,137,5,247,137,5,152,3,173,3,170,3,153,3,130,3,171,3,2,
+  0,166,70,32,211,135,5,224,135,5,239,135,5,8,212,135,5,187,135,5,4,219,1,36,
+  128,2,82,73,3,94,0,4,12,232,3,4,8,4,4,4,4,19,135,2,35,204,2,219,
+  2,185,1,190,137,5,59,0,166,78,135,137,5,40,144,3,139,2,56,4,189,1,138,4,
+  251,1,107,212,2,212,132,5,56,23,135,133,5,0,5,22,183,2,188,1,4,155,1,199,
+  1,2,162,2,216,1,153,4,226,1,247,1,144,138,5,103,4,4,0,4,44,132,2,4,
+  196,135,5,223,137,5,148,2,188,135,5,199,137,5,53,138,138,5,3,3,209,137,5,154,
+  3,4,7,0,4,120,231,1,28,148,4,217,3,210,3,235,2,109,202,136,5,175,133,5,
+  225,3,174,137,5,223,136,5,45,130,2,140,1,0,166,64,211,136,5,214,2,85,140,1,
+  208,134,5,223,134,5,95,32,148,135,5,31,219,134,5,214,97,168,165,4,157,137,5,194,
+  2,0,4,211,43,4,68,111,236,1,107,4,147,1,223,1,116,128,136,5,31,27,237,135,
+  5,226,136,5,0,4,71,224,1,124,119,192,134,5,132,1,219,133,5,241,3,60,238,135,
+  5,72,88,47,215,136,5,220,135,5,199,135,5,0,166,131,12,187,133,5,187,3,192,2,
+  209,2,17,232,3,55,28,181,1,147,2,164,2,161,2,204,1,74,0,5,41,11,177,1,
+  147,2,158,1,155,1,212,1,111,127,136,3,195,1,3,208,1,211,1,123,27,0,4,179,
+  148,1,4,233,2,150,137,5,185,137,5,218,2,143,2,140,2,219,2,196,2,141,2,2,
+  236,135,5,32,211,135,5,0,166,93,239,135,5,8,212,135,5,187,135,5,4,61,59,194,
+  1,82,73,3,94,223,1,202,2,4,0,5,7,4,4,4,4,19,135,2,35,204,2,219,
+  2,27,208,96,208,167,4,59,145,167,4,154,167,4,0,4,90,55,210,2,139,2,56,4,
+  160,1,159,2,204,3,251,1,107,212,2,212,132,5,56,23,135,133,5,0,5,23,183,2,
+  138,96,205,94,4,155,1,137,1,2,228,1,216,1,219,3,164,1,89,242,136,5,103,4,
+  0,166,103,181,136,5,198,1,4,170,95,3,6,152,168,4,161,137,5,214,1,188,135,5,
+  139,168,4,253,96,42,236,136,5,3,0,166,141,147,137,5,220,2,4,7,235,1,73,232,
+  96,171,97,214,3,204,93,231,96,148,3,235,2,47,140,136,5,0,4,249,195,2,144,136,
+  5,161,136,5,45,196,1,140,1,196,133,5,149,136,5,152,2,85,140,1,208,134,5,223,
+  134,5,95,32,0,4,130,188,110,130,215,14,213,158,14,2,253,51,150,205,14,195,4,155,
+  183,14,198,191,14,155,3,201,153,14,148,192,6,7,211,218,6,224,200,14,1,243,51,149,
+  189,14,163,1,138,201,14,226,14,145,226,14,12,177,129,1,212,215,15,251,208,14,218,5,
+  15,6,6,6,15,0,35,197,6,8,25,24,25,16,11,6,210,192,14,35,157,183,14,130,
+  248,6,12,6,1,1,4,25,18,2,2,2,7,7,4,7,24,29,15,12,2,41,2,1,
+  4,1,1,8,2,66,49,8,17,2,3,1,8,2,16,18,3,1,4,14,2,30,4,40,
+  12,6,1,10,18,2,2,2,7,7,4,1,4,67,24,29,15,12,2,41,2,3,1,8,
+  2,66,49,8,17,1,4,49,3,1,8,2,16,18,3,23,2,30,4,168,190,7,2,144,
+  7,94,0,9,112,55,204,254,4,171,254,4,20,5,1,10,15,12,1,5,1,3,1,168,
+  254,4,0,9,83,208,254,4,4,239,255,4,2,20,8,194,1,146,254,4,163,255,4,166,
+  1,163,1,37,176,1,201,1,8,0,9,27,22,9,186,1,67,115,10,47,158,1,141,1,
+  200,1,197,1,132,1,70,135,1,130,1,0,9,7,2,40,2,190,1,205,1,2,134,1,
+  77,2,2,11,148,1,159,1,29,20,0,9,41,21,21,192,1,2,147,1,2,90,79,90,
+  87,14,3,99,20,8,0,9,55,37,2,11,2,45,218,1,215,1,218,1,131,1,81,170,
+  1,171,1,170,1,97,96,0,9,91,60,81,155,1,118,119,236,255,4,1,1,3,2,133,
+  254,4,225,1,120,248,254,4,8,0,168,242,201,254,4,147,1,158,1,1,37,20,8,6,
+  224,254,4,243,254,4,32,23,3,15,2,0,9,75,33,2,38,15,8,17,42,39,42,22,
+  2,63,2,183,34,176,137,1,0,34,196,184,199,14,248,11,133,178,14,5,2,2,175,18,
+  2,2,2,2,2,218,193,14,197,210,14,173,136,1,1,241,9,243,177,14,179,145,1,162,
+  195,15,243,177,14,175,145,1,162,195,15,243,177,14,163,145,1,162,195,15,243,177,14,189,
+  145,1,162,195,15,243,177,14,161,145,1,162,195,15,0,36,142,175,145,1,162,195,15,243,
+  177,14,179,145,1,162,195,15,243,177,14,175,145,1,162,195,15,243,177,14,177,145,1,162,
+  195,15,1,245,119,3,2,0,38,140,6,228,177,13,2,231,177,13,1,183,13,172,17,5,
+  1,10,15,12,1,5,1,1,241,11,131,166,14,23,5,1,10,15,12,1,5,1,16,36,
+  5,1,10,0,39,138,12,1,5,1,130,166,14,241,165,14,255,15,184,192,14,195,179,14,
+  176,189,14,13,183,202,14,236,215,14,233,165,14,170,165,7,1,25,85,1,10,15,12,1,
+  5,1,3,23,4,1,7,129,1,2,66,1,25,35,35,2,22,9,2,10,47,16,2,60,
+  85,2,32,13,2,1,25,40,12,19,9,29,20,9,23,46,2,12,10,3,2,31,2,1,
+  25,22,35,2,72,7,2,18,38,3,1,7,2,2,12,9,27,1,25,55,3,7,2,12,
+  9,2,161,220,7,184,220,14,143,225,15,188,132,1,228,2,206,15,204,207,14,189,17,147,
+  6,1,249,236,249,12,193,3,37,3,2,212,15,175,222,14,190,3,4,145,3,148,35,255,
+  32,91,192,1,103,0,34,129,192,1,232,196,14,66,245,239,6,117,2,12,4,46,2,35,
+  2,22,9,2,1,24,28,43,12,2,58,79,2,28,2,15,2,52,5,9,29,20,1,24,
+  19,21,44,2,10,14,3,3,2,29,2,11,2,33,2,66,1,24,35,40,6,1,1,23,
+  16,4,5,11,2,14,11,2,2,2,0,0,36,144,208,15,247,15,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,1,240,62,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,240,78,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,240,94,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,1,240,110,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,1,240,126,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,240,142,2,2,2,2,2,207,191,14,254,215,14,161,207,15,190,125,154,2,225,2,
+  240,14,223,21,250,36,152,197,14,0,46,19,6,104,223,12,220,11,213,172,1,190,136,1,
+  5,1,10,15,12,1,5,1,16,0,42,116,233,10,187,30,146,43,219,42,57,194,56,167,
+  48,204,2,134,27,252,2,2,249,40,14,200,56,191,14,0,42,161,4,232,13,185,16,130,
+  3,143,42,214,63,173,63,158,37,206,5,221,2,2,244,15,185,13,183,32,216,31,0,34,
+  209,230,45,225,45,176,32,229,27,218,27,243,32,240,32,153,43,236,248,6,217,209,6,246,
+  2,1,6,1,190,1,0,42,249,237,39,120,97,16,8,76,73,6,14,66,2,2,2,2,
+  17,0,33,61,1,204,21,2,178,21,218,157,14,194,7,139,201,14,246,25,155,26,153,1,
+  154,33,148,169,14,4,169,173,14,2,1,249,8,4,1,4,237,171,14,129,50,200,232,14,
+  159,232,14,156,1,188,28,187,29,84,240,216,14,157,188,14,134,188,14,7,1,248,155,143,
+  2,31,161,217,14,2,168,37,136,2,232,178,14,183,217,14,31,200,217,14,163,187,14,20,
+  27,15,171,30,0,41,93,15,165,30,138,218,14,7,241,217,14,206,24,252,185,14,200,7,
+  47,176,1,223,180,14,64,31,240,178,14,219,178,14,1,248,47,157,178,14,2,140,178,14,
+  7,32,139,179,14,52,115,131,9,211,29,156,41,139,40,220,218,14,207,219,14,255,3,0,
+  39,155,220,177,14,82,74,249,181,14,160,181,14,244,19,168,5,161,23,180,18,138,1,77,
+  201,243,1,2,7,1,1,188,121,1,8,8,10,1,3,8,5,3,14,37,36,45,64,18,
+  1,188,149,1,3,8,5,3,14,73,72,75,6,3,88,185,1,8,123,1,188,8,10,12,
+  104,8,14,155,1,20,7,104,123,44,96,4,89,8,1,188,45,6,2,15,12,23,2,61,
+  20,92,81,27,34,112,12,119,1,188,29,28,7,11,13,8,28,7,11,132,1,1,1,1,
+  57,1,44,1,188,91,1,175,1,20,180,1,1,179,1,10,16,106,18,115,8,28,34,2,
+  1,188,60,1,13,2,21,16,2,27,2,70,62,171,1,120,3,54,163,1,1,188,105,77,
+  44,169,1,104,1,73,128,1,6,6,25,129,1,194,1,99,4,68,1,188,95,75,74,1,
+  6,189,1,164,1,5,158,1,5,2,198,224,1,78,188,18,133,21,137,4,1,243,62,250,
+  25,243,205,14,154,179,14,2,3,229,188,14,174,10,186,30,152,173,14,179,165,6,2,2,
+  2,2,2,1,48,6,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,48,22,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,48,38,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,48,54,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,48,70,2,2,2,2,2,2,2,2,2,252,14,2,2,2,2,2,1,52,
+  19,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,52,35,2,2,2,2,2,
+  2,2,2,2,2,2,187,15,2,2,2,1,48,84,2,2,2,2,2,188,15,185,15,2,
+  2,2,2,2,2,2,2,1,48,99,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,48,115,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,48,131,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,1,48,147,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,1,48,163,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,48,179,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,48,195,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,1,48,211,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,1,48,227,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,48,243,2,2,2,2,2,2,2,2,2,2,246,12,243,12,2,2,2,1,49,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,49,18,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,49,34,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,49,50,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,49,66,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,49,82,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,49,98,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,49,114,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,49,130,
+  2,2,2,2,2,212,10,209,10,2,2,2,2,2,2,2,2,1,49,145,2,2,2,2,
+  2,2,2,2,2,182,10,3,2,3,173,10,2,1,49,157,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,1,49,173,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,49,189,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,49,205,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,1,49,221,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,1,49,237,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,49,253,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,50,13,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,1,50,29,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,1,50,45,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,50,61,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,50,77,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,1,50,93,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,1,50,109,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,1,50,125,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,50,141,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,184,6,181,6,1,50,156,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,50,172,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,50,188,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,50,204,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,50,220,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,50,236,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,50,252,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,51,12,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,51,28,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,51,44,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,51,60,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,51,76,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,51,92,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,51,108,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,51,124,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,51,140,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,51,156,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,51,172,2,2,132,2,129,2,2,2,2,2,2,2,
+  2,2,2,2,2,1,51,187,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+  51,203,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,51,219,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,1,51,235,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,1,51,251,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+  52,11,2,149,179,8,25,2,4,7,46,191,3,181,10,226,132,7,2,2,2,2,4,1,
+  5,8,1,4,2,56,1,51,2,2,2,2,48,45,2,2,4,1,5,5,28,4,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,1,5,35,2,197,136,7,192,198,14,214,1,52,
+  253,196,14,189,7,162,35,141,12,185,19,5,8,6,1,9,1,244,24,254,10,140,12,249,
+  167,7,30,27,4,1,4,6,6,2,2,2,6,4,1,15,243,3,5,12,2,25,5,8,
+  5,32,195,191,7,37,4,222,230,14,1,1,1,249,179,239,22,2,2,2,2,247,193,14,
+  144,201,14,220,19,231,19,4,1,12,2,143,207,14,222,30,0,41,177,4,1,189,38,37,
+  4,152,8,152,204,14,167,198,14,134,14,192,183,14,182,2,221,202,14,239,1,128,2,1,
+  0,34,222,2,147,2,175,136,1,134,172,1,157,3,255,3,132,4,159,2,2,148,3,143,
+  1,166,6,131,6,17,167,32,0,34,77,214,32,153,29,9,148,35,2,251,7,3,3,6,
+  3,3,255,34,214,4,231,59,15,0,19,95,1,10,26,5,1,10,15,12,1,5,1,15,
+  46,5,1,0,19,123,1,3,1,9,20,15,1,21,3,2,13,8,135,4,6,138,227,4,
+  0,171,43,4,1,3,8,9,135,227,4,1,3,8,190,108,199,108,12,192,4,1,1,0,
+  18,120,6,218,108,6,4,1,24,6,4,1,200,245,3,6,4,1,3,8,0,171,33,205,
+  245,3,8,9,29,8,9,215,108,1,216,2,6,4,1,3,8,196,105,0,19,41,12,233,
+  2,8,146,108,155,108,12,226,1,6,10,6,4,1,158,224,4,4,1,0,171,10,8,9,
+  157,224,4,8,158,106,167,106,12,19,1,3,8,172,106,181,106,12,184,224,4,0,171,21,
+  1,3,8,9,145,223,4,6,4,1,3,8,9,12,120,1,1,0,19,90,163,1,6,4,
+  1,24,6,4,1,3,8,9,244,105,231,105,238,105,1,0,45,148,147,106,211,1,6,4,
+  1,3,8,200,107,209,107,12,206,1,2,11,214,211,14,1,1,231,252,1,1,1,1,31,
+  30,1,1,13,1,34,1,21,1,1,0,19,16,6,4,1,3,140,107,6,4,1,3,8,
+  9,177,111,6,4,1,0,18,16,6,4,1,3,8,9,12,168,215,14,1,1,17,6,4,
+  1,3,1,231,230,9,189,215,14,8,2,11,254,3,6,4,1,3,8,144,106,153,106,12,
+  189,1,0,18,171,4,1,3,8,2,11,14,6,4,1,3,12,6,4,1,0,18,186,8,
+  9,14,6,4,1,3,140,108,6,4,1,3,8,9,129,111,0,18,11,4,1,3,8,228,
+  109,237,109,12,18,6,4,1,3,8,198,109,207,109,0,18,31,200,5,1,1,79,145,3,
+  6,4,1,3,8,228,107,237,107,12,2,6,0,18,157,1,3,8,214,107,223,107,12,226,
+  2,6,4,1,71,6,197,1,6,4,0,18,212,3,8,9,200,1,1,3,8,182,105,191,
+  105,12,54,8,248,104,129,105,12,0,19,143,1,1,153,5,6,4,1,24,6,4,1,3,
+  8,9,14,6,0,18,93,1,3,47,8,2,11,14,6,4,1,3,236,109,6,4,1,0,
+  45,194,8,9,177,110,6,4,1,3,8,168,109,177,109,12,210,4,207,4,6,4,0,19,
+  132,8,15,24,175,5,8,6,4,1,3,8,140,109,149,109,12,25,8,0,45,131,58,6,
+  4,1,3,8,9,223,109,12,45,6,4,1,3,8,0,18,33,12,146,1,6,4,1,216,
+  2,6,4,1,3,8,210,105,219,105,12,233,2,0,18,118,160,108,155,105,6,4,1,3,
+  8,9,12,136,223,4,4,1,3,8,9,0,18,113,12,146,3,6,4,1,3,8,2,11,
+  177,3,6,4,1,3,8,0,18,105,12,178,1,6,4,1,3,8,2,11,145,1,6,4,
+  1,3,8,0,18,135,11,14,6,4,1,3,140,109,6,4,1,3,8,9,209,107,6,0,
+  18,237,1,3,8,2,11,33,6,4,1,8,6,4,1,3,8,0,18,225,12,25,8,218,
+  106,227,106,12,162,107,6,4,1,3,8,9,181,104,9,0,19,152,7,6,3,8,13,2,
+  5,93,204,54,181,1,23,160,205,14,23,227,2,241,195,14,0,0,33,208,128,1,144,215,
+  14,177,188,15,5,1,10,15,12,1,5,1,3,154,182,15,238,12,25,1,247,174,24,97,
+  20,163,13,36,37,242,20,229,19,192,18,181,12,76,49,9,154,12,136,7,1,249,43,43,
+  225,11,38,178,14,149,14,2,196,11,244,6,231,18,4,252,11,138,1,224,5,209,5,235,
+  12,1,246,27,4,1,51,160,12,196,1,251,12,245,211,14,228,202,14,218,23,39,135,26,
+  165,168,14,5,155,9,152,182,14,0,38,43,180,181,14,228,8,173,3,144,5,156,18,235,
+  209,14,171,150,1,160,226,15,177,22,217,178,14,186,179,14,253,206,14,21,250,214,14,133,
+  4,1,243,158,190,5,223,171,14,176,172,14,218,5,186,13,13,193,25,1,130,23,147,204,
+  14,172,179,14,16,229,202,14,238,206,14,243,2,0,37,201,180,183,14,206,2,185,152,14,
+  167,55,180,26,236,202,14,83,168,5,219,219,14,238,10,156,184,14,40,175,181,14,155,3,
+  184,180,14,0,32,85,188,215,14,250,17,193,5,147,15,230,5,153,15,83,254,10,170,20,
+  189,4,165,21,197,201,14,210,2,150,195,14,18,0,46,16,231,12,136,186,14,219,201,14,
+  98,4,222,17,241,44,5,208,203,14,140,18,199,194,14,185,28,174,8,220,221,14,213,224,
+  14,0,32,68,244,213,14,3,2,242,14,165,227,14,248,202,14,10,168,3,37,241,177,14,
+  147,18,136,204,14,209,188,14,233,5,154,182,14,1,243,29,139,173,14,209,158,1,176,251,
+  7,2,6,180,3,7,195,2,71,27,40,15,5,1,10,0,255,17,12,1,5,1,3,23,
+  50,55,26,100,67,33,40,2,2,0,255,36,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,0,255,52,2,2,2,2,2,2,14,2,2,2,2,2,2,2,2,0,255,74,
+  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,255,90,2,165,1,102,72,133,
+  1,70,200,2,1,189,3,4,12,172,3,131,3,57,116,0,255,93,167,1,104,70,137,1,
+  23,158,1,3,148,2,1,135,254,6,160,25,171,11,174,191,14,164,24,213,204,14,0,38,
+  238,1,194,182,14,135,185,14,168,206,14,199,222,14,46,5,129,70,89,2,50,6,7,6,
+  49,0,16,164,3,40,20,8,5,2,6,57,46,7,35,24,21,2,2,0,16,173,2,12,
+  6,13,2,14,33,22,2,27,60,9,18,65,18,0,16,253,5,83,2,50,6,7,6,49,
+  74,71,68,71,40,20,8,0,16,254,25,2,6,57,46,7,35,24,52,73,2,2,2,2,
+  12,0,16,231,13,2,14,33,22,46,43,27,60,9,18,65,18,188,47,5,0,28,144,2,
+  50,6,7,6,49,74,71,68,71,40,20,8,20,25,0,28,178,6,57,46,7,35,24,52,
+  73,2,2,2,2,12,6,13,0,28,161,14,33,22,46,43,27,60,9,18,65,18,199,46,
+  228,112,89,2,0,45,26,6,7,6,49,2,3,40,20,8,5,2,6,57,46,7,0,45,
+  9,24,21,2,2,2,2,12,6,13,2,14,33,22,2,27,0,45,35,9,18,65,18,189,
+  49,198,61,208,145,14,135,205,14,182,225,14,213,20,198,9,147,171,14,80,77,92,0,44,
+  29,33,15,6,70,37,39,42,25,1,62,3,59,68,59,66,0,44,14,2,2,2,16,2,
+  15,2,22,5,34,47,32,2,5,22,0,44,28,13,2,39,62,1,1,51,66,5,53,3,
+  84,80,77,92,0,44,77,33,15,6,70,37,39,42,25,1,62,3,59,68,59,66,0,44,
+  62,2,2,2,16,2,15,2,22,5,34,47,32,2,5,22,0,44,76,13,2,39,62,1,
+  1,51,66,5,53,3,202,180,14,233,189,14,212,164,14,168,27,1,243,31,204,24,233,20,
+  218,21,225,22,130,23,185,217,7,8,5,4,12,26,39,10,34,1,1,3,54,16,7,2,
+  2,2,26,17,16,17,21,26,2,2,23,14,1,3,69,156,193,7,247,128,7,163,1,2,
+  20,8,48,2,37,2,22,9,2,10,47,1,19,23,2,66,99,2,40,2,15,2,56,2,
+  9,11,29,20,9,1,19,19,46,2,10,16,3,2,37,2,11,2,45,2,86,82,2,1,
+  19,12,170,1,171,1,170,1,97,66,155,1,118,119,1,120,66,31,147,1,118,20,1,19,
+  76,9,15,2,22,19,2,64,2,63,2,134,128,7,205,203,15,216,168,1,12,179,4,0,
+  42,144,3,12,19,3,58,247,32,252,1,128,31,4,155,31,214,30,193,32,28,8,142,32,
+  0,42,130,4,7,177,32,250,32,203,169,1,248,168,1,197,30,202,30,144,219,6,26,13,
+  5,30,37,4,1,1,83,13,6,13,3,16,23,1,34,13,21,40,13,20,13,13,1,1,
+  85,52,35,44,13,33,6,11,32,27,16,2,26,8,21,10,1,1,114,49,34,14,25,2,
+  12,29,20,2,15,28,25,2,179,247,7,128,248,7,1,1,134,235,246,7,92,93,123,240,
+  109,8,128,2,251,1,128,2,11,251,1,128,2,92,4,2,0,31,8,8,128,2,251,1,
+  128,2,11,251,1,128,2,135,112,232,112,3,139,113,64,42,37,2,0,31,25,8,3,220,
+  2,225,2,8,3,163,110,128,113,225,112,164,110,8,224,1,219,1,224,1,11,0,31,43,
+  224,1,96,2,199,2,8,224,1,219,1,224,1,11,219,1,224,1,161,112,130,113,237,112,
+  69,0,3,153,192,110,8,4,7,161,110,222,112,4,197,2,8,4,7,223,110,160,113,3,
+  251,112,0,3,155,2,2,24,128,111,8,128,1,123,128,1,11,123,128,1,160,1,2,167,
+  2,8,0,31,172,123,128,1,11,123,128,1,181,112,214,113,181,113,212,110,8,3,220,2,
+  225,2,8,3,0,3,140,216,113,131,114,96,11,16,13,150,113,227,111,5,167,1,2,23,
+  26,232,110,8,0,31,95,7,223,110,252,112,4,185,113,184,113,3,147,113,61,46,198,1,
+  12,3,17,148,112,0,31,222,2,3,34,89,88,207,113,236,247,7,10,1,18,10,160,194,
+  6,12,2,2,1,210,38,2,2,2,21,24,2,2,2,2,2,2,2,2,2,2,1,210,
+  53,43,46,2,2,2,2,2,2,55,58,2,2,2,2,63,1,210,34,149,185,14,50,154,
+  111,138,135,7,211,246,7,8,4,4,140,101,2,252,184,4,249,184,4,4,1,157,101,0,
+  3,243,160,246,7,155,248,7,128,2,5,158,246,7,136,195,6,161,187,14,144,248,7,13,
+  2,42,13,141,134,7,121,213,111,0,3,214,208,111,2,30,2,3,157,113,240,1,9,22,
+  160,246,7,159,248,7,106,160,109,8,128,2,0,31,7,128,2,135,2,128,2,3,96,127,
+  134,1,4,2,237,2,8,128,2,251,1,128,2,135,2,0,31,130,3,167,111,136,111,132,
+  1,3,6,179,111,203,1,126,42,37,82,79,184,109,8,0,31,19,192,1,197,1,8,3,
+  201,109,138,111,245,110,212,109,8,224,1,219,1,224,1,231,1,224,1,3,0,31,117,158,
+  1,4,2,205,2,8,224,1,219,1,224,1,231,1,224,1,3,195,111,140,111,156,1,2,
+  0,3,194,29,131,1,144,1,240,109,8,4,7,209,109,146,112,8,141,113,132,113,1,179,
+  1,190,1,0,31,48,8,4,7,133,110,142,111,180,1,171,112,74,71,2,2,24,176,110,
+  8,128,1,0,31,103,128,1,135,1,128,1,3,71,238,1,4,2,173,2,8,128,1,123,
+  128,1,135,1,128,1,0,31,160,163,111,220,110,236,1,2,231,112,132,110,8,3,108,113,
+  8,3,235,109,216,110,129,112,0,3,198,11,16,13,200,112,1,133,112,52,5,105,48,45,
+  23,26,152,110,8,0,31,87,7,143,110,176,112,8,237,112,228,112,1,203,1,214,1,171,
+  2,8,4,7,137,110,218,110,0,31,224,195,112,15,113,3,214,103,8,5,4,1,240,144,
+  7,75,209,246,7,218,246,7,11,231,247,7,1,1,137,23,11,199,246,7,2,3,186,112,
+  162,200,13,18,2,2,2,2,2,2,2,1,210,17,2,33,36,2,2,2,2,41,2,2,
+  40,2,2,2,2,1,210,5,2,2,2,133,194,6,23,253,247,7,160,248,7,138,199,7,
+  144,6,121,250,18,213,12,24,111,212,12,1,246,1,208,12,173,181,14,138,163,14,201,207,
+  14,160,207,14,216,20,235,23,143,163,15,3,5,1,10,15,12,1,0,10,233,1,3,193,
+  1,2,20,8,48,2,37,2,22,9,2,10,47,0,10,151,2,66,99,2,40,2,15,2,
+  56,2,9,11,29,20,9,0,10,147,46,2,10,16,3,2,37,2,11,2,45,2,86,81,
+  170,1,0,10,139,170,1,97,148,1,81,66,221,1,118,119,250,1,3,127,126,1,6,4,
+  0,10,205,147,1,20,8,90,20,8,13,8,3,15,2,22,19,2,64,0,10,227,63,2,
+  200,203,8,5,1,10,15,12,1,5,1,3,127,2,14,1,29,107,6,2,24,2,7,20,
+  2,19,35,30,2,32,73,2,58,1,29,129,31,2,6,20,29,20,20,51,54,2,4,2,
+  43,2,18,1,29,126,51,2,16,1,88,5,2,2,25,14,6,7,9,2,14,1,29,141,
+  2,175,204,8,9,5,5,1,10,15,12,1,5,1,3,28,3,0,10,5,2,20,8,48,
+  2,37,2,22,9,2,10,47,158,1,141,1,2,0,10,90,65,99,2,40,2,15,2,134,
+  1,77,2,9,11,29,20,9,0,10,19,46,2,10,88,71,3,35,2,11,2,45,2,86,
+  11,88,0,10,1,2,116,42,7,147,1,228,1,9,6,105,20,8,9,15,2,22,0,10,
+  65,2,190,134,1,173,47,250,209,14,179,210,7,1,7,143,1,68,2,17,3,30,1,40,
+  0,255,190,60,73,8,51,4,28,25,2,2,76,6,35,21,4,21,0,255,176,11,2,8,
+  5,2,2,14,8,45,34,6,27,40,41,88,0,255,205,2,14,1,4,35,2,12,1,34,
+  17,10,229,1,5,32,6,0,255,138,6,3,6,3,51,8,6,3,6,3,46,6,3,6,
+  3,0,255,157,47,6,3,6,3,35,68,6,3,6,3,59,6,3,41,0,255,106,3,6,
+  8,11,6,4,1,36,3,6,6,3,6,3,29,0,255,156,107,92,4,1,95,116,1,91,
+  27,142,2,139,2,144,2,1,8,204,205,7,1,245,40,171,186,14,201,1,230,194,14,152,
+  15,229,25,202,19,164,7,167,26,196,19,65,143,159,15,9,35,38,35,0,17,14,138,1,
+  1,4,11,35,38,35,97,130,1,36,153,1,210,225,4,223,225,4,124,1,0,169,119,235,
+  224,4,4,6,10,13,228,224,4,225,224,4,10,15,73,116,87,31,34,57,0,17,0,180,
+  1,167,1,210,225,4,165,225,4,170,225,4,1,219,225,4,180,1,2,147,1,6,138,1,
+  139,1,86,93,0,169,122,199,224,4,157,1,66,1,154,225,4,1,169,225,4,2,22,17,
+  10,7,4,156,225,4,157,225,4,0,17,37,8,17,53,208,225,4,165,225,4,162,225,4,
+  6,19,8,159,225,4,162,225,4,6,13,10,5,0,169,102,185,225,4,92,1,10,11,6,
+  21,8,5,24,15,2,5,8,10,0,17,47,67,214,225,4,191,224,4,33,139,1,38,23,
+  34,29,214,225,4,8,233,225,4,240,225,4,215,225,4,25,0,169,99,151,225,4,146,225,
+  4,2,133,224,4,136,224,4,145,224,4,25,198,123,234,4,203,126,1,244,152,6,2,235,
+  152,6,106,0,17,245,6,3,115,102,5,2,21,36,27,238,151,6,187,152,6,45,168,1,
+  4,1,0,17,250,2,111,49,52,25,82,132,152,6,129,152,6,13,136,152,6,253,151,6,
+  5,138,152,6,139,152,6,4,0,215,223,129,152,6,101,194,152,6,191,152,6,2,48,6,
+  134,152,6,135,152,6,4,5,74,146,152,6,1,227,152,6,0,17,243,142,152,6,2,133,
+  153,6,226,152,6,1,133,152,6,128,152,6,129,152,6,1,130,152,6,213,152,6,220,152,
+  6,7,231,152,6,14,0,17,213,6,79,204,152,6,147,152,6,53,206,152,6,141,152,6,
+  2,9,20,67,5,68,140,152,6,141,152,6,0,215,217,203,152,6,196,152,6,253,151,6,
+  67,52,2,20,134,152,6,1,193,152,6,236,152,6,1,6,13,135,152,6,0,215,234,8,
+  135,152,6,1,144,152,6,145,152,6,162,152,6,149,152,6,137,1,238,152,6,193,151,6,
+  206,151,6,171,152,6,142,152,6,183,152,6,226,152,6,0,215,237,63,2,155,152,6,35,
+  202,152,6,1,143,152,6,138,152,6,135,152,6,138,152,6,2,6,181,151,6,17,140,152,
+  6,0,215,245,133,152,6,1,159,2,132,1,89,2,41,120,206,152,6,2,205,152,6,4,
+  1,115,1,0,17,124,3,2,15,140,153,6,4,1,199,152,6,204,152,6,205,152,6,105,
+  42,70,10,1,208,152,6,0,17,154,206,152,6,203,152,6,3,200,152,6,2,4,1,6,
+  2,179,153,6,46,1,6,222,152,6,219,152,6,0,17,166,2,75,222,152,6,135,153,6,
+  108,103,54,2,2,214,152,6,209,152,6,1,210,152,6,149,153,6,2,0,17,112,1,4,
+  27,42,88,85,41,8,1,44,2,78,97,70,83,0,215,178,2,2,215,152,6,1,5,2,
+  2,39,56,210,152,6,205,152,6,1,10,200,152,6,201,152,6,0,17,146,1,252,126,2,
+  122,2,135,1,3,24,1,28,37,42,55,84,38,0,49,120,2,91,51,4,28,94,3,2,
+  117,2,2,100,1,1,29,0,49,90,74,99,21,104,7,91,96,2,4,7,115,14,11,94,
+  91,0,49,108,89,5,94,91,2,88,6,79,114,7,2,4,1,101,120,0,49,128,155,1,
+  102,67,6,27,40,41,74,7,2,10,1,4,27,2,0,49,86,1,98,9,4,1,63,13,
+  92,3,2,79,88,1,1,183,5,0,48,40,5,1,10,15,12,1,36,4,45,44,45,172,
+  244,6,5,1,10,1,13,49,12,1,5,1,3,95,2,10,8,2,3,18,21,3,24,1,
+  13,8,30,4,11,2,2,10,2,49,20,2,4,2,25,2,48,1,13,22,4,19,42,1,
+  4,2,2,2,19,6,3,6,3,253,215,7,20,0,23,39,5,26,31,4,22,5,5,5,
+  8,8,6,19,7,26,5,0,23,52,3,2,176,252,14,173,2,161,6,133,173,7,30,27,
+  4,1,4,6,6,2,2,1,8,237,6,4,1,5,12,2,25,5,8,5,44,1,8,3,
+  2,1,243,167,254,27,211,206,14,154,189,14,211,6,174,25,187,25,10,145,4,192,11,208,
+  8,4,2,3,215,197,14,49,0,39,165,2,131,1,170,1,1,1,197,2,100,164,16,1,
+  231,17,236,17,225,14,15,17,182,180,14,0,39,94,1,252,194,14,8,159,1,4,177,194,
+  14,140,194,14,229,193,14,202,194,14,155,194,14,21,230,193,14,47,155,194,14,19,0,39,
+  99,232,208,14,187,20,199,172,14,228,167,14,173,183,14,3,212,194,14,8,209,6,165,188,
+  14,1,156,1,45,255,1,136,2,1,246,102,15,12,15,255,188,14,36,208,16,129,15,71,
+  3,84,130,194,14,8,131,194,14,160,192,14,225,4,1,246,113,169,188,14,1,226,193,14,
+  39,191,192,14,158,187,14,15,12,15,169,188,14,230,1,251,1,12,182,1,234,192,14,1,
+  247,212,203,192,14,214,193,14,8,133,195,14,198,1,148,191,14,215,194,14,236,194,14,249,
+  191,14,227,135,1,10,12,55,22,2,0,5,158,28,15,2,2,5,16,35,16,14,17,15,
+  9,2,26,18,0,5,155,9,40,31,9,1,8,44,68,192,213,7,3,2,29,18,141,213,
+  7,33,0,251,49,54,241,213,7,192,213,7,177,213,7,192,213,7,185,213,7,4,8,192,
+  213,7,187,213,7,37,192,213,7,187,213,7,192,213,7,185,213,7,0,5,219,192,213,7,
+  36,225,213,7,192,213,7,187,213,7,192,213,7,187,213,7,192,213,7,183,213,7,192,213,
+  7,20,205,213,7,192,213,7,189,213,7,192,213,7,0,5,225,192,213,7,175,213,7,192,
+  213,7,57,2,5,2,129,213,7,192,213,7,227,213,7,192,213,7,163,213,7,192,213,7,
+  225,213,7,192,213,7,0,251,75,83,2,8,5,2,2,4,2,157,213,7,192,213,7,55,
+  141,213,7,192,213,7,50,189,213,7,0,5,242,1,220,212,7,179,213,7,43,42,15,19,
+  2,3,6,10,2,200,213,7,193,213,7,11,0,5,184,30,23,8,17,11,34,2,25,124,
+  2,107,16,11,6,88,1,249,148,165,12,131,170,14,237,33,146,13,226,164,12,2,2,2,
+  20,2,2,2,2,150,2,18,1,176,168,17,2,2,2,2,2,2,2,26,2,2,2,2,
+  2,2,1,176,169,2,2,2,2,2,2,22,2,2,2,2,2,2,2,33,1,176,177,2,
+  215,2,2,2,2,28,18,2,17,2,2,2,2,2,2,1,176,31,6,32,2,2,2,2,
+  2,39,2,2,2,2,2,2,2,1,176,56,2,2,2,31,2,2,2,2,2,2,162,2,
+  2,2,2,2,1,176,199,2,24,2,2,25,2,2,2,2,2,2,16,2,2,2,1,176,
+  219,2,23,2,2,2,148,1,2,191,2,2,2,2,2,2,2,2,1,176,134,24,2,2,
+  2,2,2,2,33,2,2,2,2,2,2,2,1,176,153,2,2,2,2,27,2,2,249,1,
+  2,2,174,3,2,2,2,28,1,176,255,2,2,31,2,2,2,2,2,2,22,2,2,2,
+  2,2,1,176,248,2,2,2,2,2,129,3,2,2,2,2,2,2,2,30,2,1,176,84,
+  2,2,35,2,2,2,2,2,28,2,2,2,2,2,2,1,176,74,2,2,2,2,2,2,
+  2,26,2,2,2,26,2,2,2,1,176,114,2,2,2,2,39,2,2,2,2,2,2,30,
+  2,2,2,1,176,123,2,2,39,2,2,2,2,197,1,2,2,2,2,244,3,2,2,1,
+  177,11,2,12,2,2,2,15,2,2,2,2,10,2,2,2,2,1,177,27,2,125,2,2,
+  2,2,2,10,2,2,2,2,2,17,2,1,176,229,2,178,137,2,139,194,14,250,172,1,
+  16,87,90,85,44,2,75,28,32,10,1,0,77,244,99,112,53,31,5,8,56,45,15,40,
+  11,3,35,68,21,0,77,252,71,70,89,24,24,1,18,71,48,22,25,17,50,26,105,0,
+  77,214,21,34,43,88,1,39,57,72,40,2,11,4,103,108,15,0,77,201,9,26,27,238,
+  149,13,152,7,201,185,14,254,182,14,200,8,2,242,11,209,10,140,11,247,163,14,3,181,
+  1,1,177,31,187,4,161,254,11,18,11,18,11,43,14,9,14,7,57,8,12,7,0,48,
+  84,7,62,18,11,18,11,97,14,12,7,12,7,94,6,3,0,48,130,3,38,81,6,3,
+  6,3,67,78,18,11,18,11,36,6,0,48,138,6,3,107,12,7,43,12,7,164,1,2,
+  153,1,52,59,146,1,134,131,12,1,177,80,4,157,131,12,8,3,79,7,12,14,9,14,
+  7,59,156,1,9,4,0,48,144,4,27,8,3,95,12,7,12,7,136,1,227,38,252,184,
+  14,146,1,234,3,2,0,34,59,232,196,14,220,2,128,26,143,234,14,156,44,192,2,185,
+  46,146,14,244,11,176,211,14,21,2,2,2,2,1,251,123,129,223,14,2,2,2,130,31,
+  206,172,14,173,10,76,217,1,60,159,183,14,176,180,14,18,155,179,14,128,182,14,0,35,
+  27,176,3,225,3,188,195,14,15,18,217,204,14,198,225,14,207,17,128,6,206,2,247,171,
+  14,147,47,102,174,55,217,183,1,0,32,39,214,55,135,42,162,214,14,237,22,196,25,239,
+  23,179,179,14,173,18,136,30,132,2,134,193,14,163,164,14,12,9,7,0,49,156,2,25,
+  30,15,9,1,18,2,13,4,5,153,6,9,86,117,0,47,243,2,3,3,22,11,2,2,
+  6,3,2,104,85,122,115,74,0,48,7,72,85,236,141,13,1,5,4,1,247,140,13,152,
+  10,8,192,4,20,13,8,19,0,51,227,20,9,20,35,12,20,21,20,11,6,34,2,55,
+  18,16,0,51,251,5,1,10,15,12,1,5,1,39,171,4,19,190,2,20,13,8,0,51,
+  93,1,20,9,20,35,12,20,21,20,11,6,19,18,16,8,0,51,109,4,1,39,3,175,
+  2,12,1,5,4,12,1,1,147,10,141,54,199,1,1,244,127,253,176,7,30,27,4,1,
+  4,6,6,2,2,2,6,4,2,3,1,8,78,12,2,25,5,8,5,36,10,2,5,8,
+  9,4,5,3,1,244,229,6,151,172,14,252,175,14,241,175,14,181,31,222,227,14,247,232,
+  14,246,175,14,11,1,4,29,34,4,1,1,236,120,36,18,35,54,59,54,71,36,18,37,
+  54,71,36,18,36,1,236,162,7,2,75,36,18,35,54,87,36,18,60,5,1,10,15,1,
+  236,169,1,5,1,89,36,18,35,54,73,36,18,35,54,63,54,1,236,124,54,71,36,18,
+  37,54,71,36,18,62,8,163,170,14,128,31,198,170,14,143,205,14,0,32,108,3,236,210,
+  14,8,5,2,2,133,167,7,2,4,1,4,6,6,2,2,1,11,109,4,2,3,6,2,
+  19,5,8,5,42,5,12,2,5,3,1,11,125,7,113,30,27,4,1,4,6,6,2,2,
+  2,6,4,2,1,11,81,5,12,2,25,5,8,5,42,5,12,2,5,3,6,7,0,35,
+  128,169,5,212,31,11,193,25,192,25,22,3,8,5,8,3,191,29,132,30,250,214,6,2,
+  0,255,251,173,229,6,205,25,216,7,192,32,3,8,21,8,1,213,17,178,215,14,53,60,
+  71,237,214,14,0,0,161,238,181,1,179,47,142,48,2,189,52,128,23,207,152,1,170,126,
+  32,1,1,152,206,14,213,1,143,178,14,232,179,14,1,243,142,216,3,235,145,14,234,145,
+  14,171,2,154,5,210,22,179,196,10,3,2,52,5,1,10,15,12,0,169,214,5,1,3,
+  29,121,18,52,2,37,2,24,2,11,2,35,0,169,146,2,62,87,1,4,32,4,19,4,
+  1,58,7,9,9,21,0,169,138,2,30,3,19,46,55,58,10,2,10,1,1,29,2,11,
+  0,169,156,39,76,7,64,2,15,56,45,5,8,9,6,10,36,47,0,169,192,30,25,129,
+  1,100,97,3,6,148,1,35,2,7,2,2,11,2,0,169,182,2,190,170,10,166,22,151,
+  191,14,184,173,14,128,15,135,202,14,227,1,144,188,14,159,146,7,10,2,3,5,113,1,
+  16,132,12,4,50,2,39,2,26,13,2,2,12,47,12,2,62,1,16,133,2,28,2,15,
+  2,56,5,9,33,24,13,21,48,2,10,1,16,156,36,3,2,29,2,15,2,33,2,70,
+  5,42,32,29,121,1,16,128,116,1,109,92,12,4,5,7,2,10,7,2,28,172,163,7,
+  247,169,14,0,47,125,14,43,83,168,1,69,66,227,1,190,2,71,86,119,62,73,42,109,
+  0,47,187,133,2,16,11,140,1,60,68,153,1,153,1,248,1,159,1,8,119,236,1,11,
+  115,0,47,43,59,158,1,29,240,1,131,2,80,114,151,2,110,28,61,119,100,104,31,0,
+  47,12,142,3,9,183,2,154,1,191,1,176,2,215,2,128,3,217,2,39,142,3,219,2,
+  146,1,134,1,167,1,0,47,87,72,43,178,1,209,1,218,1,38,61,51,58,38,245,1,
+  174,1,50,191,2,2,0,47,166,103,50,100,255,1,56,51,242,1,247,1,150,2,225,2,
+  33,156,2,78,215,2,52,0,47,141,91,50,205,1,116,65,148,2,7,4,209,2,3,184,
+  1,195,1,204,2,227,1,89,0,47,129,65,210,1,141,1,113,174,1,53,72,247,1,31,
+  184,1,174,1,147,2,108,247,1,96,0,47,16,238,1,32,49,215,1,18,134,1,156,1,
+  213,1,156,2,105,71,193,1,50,13,232,1,0,47,191,10,247,1,79,68,81,41,156,2,
+  29,17,62,195,1,232,1,239,1,104,32,0,47,106,205,1,206,2,159,1,97,32,244,1,
+  139,1,78,71,183,1,48,50,94,65,47,0,47,111,69,122,131,1,54,165,1,218,2,21,
+  179,2,234,1,85,74,152,1,193,1,77,134,2,0,47,49,198,2,155,3,96,92,98,32,
+  7,35,117,11,134,1,106,185,1,152,1,35,0,47,37,20,55,182,2,52,227,139,1,48,
+  5,1,10,15,12,1,5,1,3,0,12,213,159,1,2,20,8,48,2,37,2,22,9,2,
+  10,49,2,158,1,0,12,151,2,66,99,2,40,2,15,2,56,2,9,11,106,135,1,20,
+  0,12,158,23,2,46,2,10,2,14,3,2,37,2,11,2,45,2,0,12,181,81,170,1,
+  171,1,170,1,97,89,118,119,224,1,105,111,7,228,1,73,147,1,0,12,190,20,8,11,
+  2,15,2,20,2,19,2,64,2,63,2,246,144,1,0,48,253,181,1,188,253,11,196,4,
+  1,1,159,129,12,18,11,18,11,43,14,9,14,7,0,48,168,8,12,7,12,7,62,18,
+  11,18,11,97,14,12,7,12,0,48,175,94,6,3,176,252,11,2,2,2,2,4,2,27,
+  2,2,2,4,1,175,246,167,252,11,3,38,81,6,3,6,3,67,78,18,11,18,11,36,
+  0,48,236,3,6,3,107,12,7,43,12,156,5,6,3,6,3,167,5,164,1,0,48,246,
+  244,3,20,218,253,11,229,253,11,149,5,164,5,6,3,6,3,23,2,2,223,4,59,0,
+  48,238,238,129,12,1,4,133,130,12,8,3,79,7,12,14,9,14,7,59,162,1,0,48,
+  249,1,4,11,9,4,1,4,27,8,3,95,12,7,12,7,0,48,251,6,187,1,184,1,
+  191,1,1,218,225,3,5,1,10,15,12,1,5,1,3,0,169,34,17,16,17,23,38,23,
+  34,51,2,34,9,5,13,8,36,0,169,37,31,2,8,23,2,6,24,4,5,3,21,60,
+  2,5,2,0,169,43,7,4,2,3,3,247,159,4,206,207,14,209,199,14,252,201,14,141,
+  2,183,171,7,5,4,1,14,1,10,0,76,2,35,2,22,9,2,10,31,2,60,51,13,
+  2,66,1,10,43,5,9,9,9,22,2,10,10,3,2,29,2,11,2,50,1,10,51,13,
+  18,23,14,44,2,5,2,26,2,6,11,14,2,5,1,10,84,5,133,1,84,2,2,89,
+  4,96,101,13,7,10,7,2,194,151,3,0,23,219,26,5,1,10,15,12,1,5,1,3,
+  101,2,19,24,25,0,23,179,7,19,2,22,2,21,2,2,2,2,2,47,29,2,4,0,
+  23,135,6,4,40,63,2,4,1,62,11,5,39,20,10,19,24,0,23,151,1,24,15,10,
+  3,2,29,2,4,1,11,4,30,5,108,0,23,221,1,33,20,3,10,3,7,7,12,12,
+  5,27,5,38,35,0,23,204,8,5,5,14,17,182,8,32,29,32,19,32,25,32,29,32,
+  0,25,235,32,29,32,25,32,151,8,2,5,2,6,6,2,5,2,13,0,25,225,32,33,
+  4,32,25,32,25,32,29,32,37,32,29,32,13,0,23,181,1,4,24,2,4,7,19,18,
+  15,12,12,17,4,1,5,0,23,191,9,134,234,7,9,2,6,119,2,8,4,52,2,2,
+  41,2,24,1,18,22,12,9,12,49,12,2,2,60,79,28,2,17,2,60,8,1,18,36,
+  11,33,22,9,25,50,2,12,6,31,2,11,2,35,74,1,18,37,44,13,4,2,14,17,
+  17,10,4,5,5,2,8,5,22,1,18,248,5,1,10,15,12,1,5,1,3,127,2,12,
+  4,54,2,1,18,214,43,2,28,13,2,4,10,51,12,2,2,64,87,2,30,1,18,196,
+  1,17,2,62,5,11,35,26,13,25,52,2,12,29,38,1,18,220,29,2,15,2,37,2,
+  76,5,14,20,2,19,12,4,5,1,18,225,2,10,7,2,232,133,7,213,206,14,196,207,
+  14,7,228,6,75,6,1,208,17,199,4,226,1,1,250,162,243,25,209,134,14,183,26,157,
+  43,208,225,14,137,22,172,21,158,5,251,25,198,175,96,233,196,111,24,5,1,10,0,14,
+  209,12,1,5,1,3,65,92,1,43,87,35,24,22,3,28,0,14,174,96,2,185,1,4,
+  5,68,4,7,51,36,23,64,25,45,16,0,14,146,12,35,12,64,49,9,2,2,24,4,
+  5,26,2,2,63,0,14,150,2,3,36,9,86,33,2,5,34,5,2,2,51,4,36,0,
+  14,179,32,5,2,25,2,7,20,14,19,2,5,2,252,153,15,4,222,10,1,247,228,14,
+  247,199,14,212,7,146,192,14,14,149,183,14,190,132,7,4,194,178,7,211,10,226,10,7,
+  14,235,10,226,10,0,42,252,128,129,7,4,203,141,7,146,192,14,14,249,180,14,4,221,
+  39,128,22,178,179,14,10,181,203,15,128,2,130,1,216,118,0,30,182,11,4,4,205,115,
+  149,4,196,119,16,11,4,4,203,119,180,4,144,1,139,1,128,115,0,2,0,255,4,196,
+  119,191,114,131,4,8,125,234,4,140,112,139,111,237,5,222,153,5,215,153,5,236,4,51,
+  177,1,0,44,109,170,237,3,155,2,4,4,4,4,243,155,5,128,119,4,164,166,4,169,
+  152,5,138,114,133,111,129,3,228,152,5,0,167,70,133,156,5,134,3,152,154,5,139,154,
+  5,137,1,130,117,255,115,4,250,1,250,152,5,145,150,5,240,149,5,58,195,1,131,1,
+  0,167,46,211,155,5,148,3,132,116,4,15,4,131,114,136,114,242,166,4,169,151,5,89,
+  233,2,246,1,204,1,89,0,0,69,136,2,150,1,12,156,4,232,111,163,117,232,119,16,
+  11,4,4,215,2,153,117,150,1,196,118,0,2,4,247,4,228,119,231,114,231,3,136,116,
+  3,247,115,220,4,236,113,195,2,148,164,4,3,175,151,5,190,1,130,151,5,0,0,208,
+  206,3,2,108,207,6,176,119,153,114,142,152,5,161,157,5,218,6,171,3,144,3,135,3,
+  11,8,230,1,0,30,32,128,166,4,247,150,5,159,1,204,152,5,4,245,149,5,250,149,
+  5,235,157,5,196,119,151,112,148,112,135,116,134,173,1,129,57,7,0,30,36,140,166,4,
+  135,154,5,158,173,1,226,234,3,223,148,5,217,6,136,2,190,1,198,2,129,4,2,190,
+  117,251,115,180,118,131,115,0,0,204,248,119,251,114,191,3,8,210,1,221,1,136,116,154,
+  165,4,4,4,10,4,4,223,151,5,172,151,5,0,0,74,212,3,252,153,5,211,149,5,
+  249,7,202,119,143,113,227,2,230,172,1,178,235,3,159,164,4,179,114,184,114,220,165,4,
+  195,1,8,0,0,76,218,3,136,4,224,149,5,223,153,5,3,130,116,11,4,208,56,208,
+  235,3,155,164,4,245,115,198,172,1,179,170,1,141,2,0,1,199,243,5,226,119,4,4,
+  216,56,208,237,3,183,163,4,4,219,122,234,3,8,3,138,116,140,165,4,151,165,4,0,
+  30,70,155,113,181,1,214,114,207,112,136,150,5,177,151,5,243,3,242,3,245,5,136,2,
+  246,1,134,2,249,3,248,119,16,0,30,210,4,4,255,119,168,5,8,4,184,114,247,117,
+  248,2,243,4,248,119,219,116,244,116,16,11,0,30,222,4,163,115,248,148,5,4,255,151,
+  5,140,116,3,225,114,150,1,4,167,4,204,4,209,4,238,117,4,0,2,44,147,2,188,
+  152,5,19,207,1,251,150,5,19,184,2,163,7,136,120,4,248,163,4,219,150,5,224,150,
+  5,225,235,3,218,235,3,0,0,81,142,156,5,3,135,156,5,144,156,5,139,152,5,8,
+  3,132,116,4,4,151,113,4,152,113,144,165,4,179,149,5,0,44,100,180,235,3,223,150,
+  5,206,153,5,147,1,157,1,145,156,5,142,4,148,116,135,116,140,116,143,116,3,248,2,
+  144,113,4,0,30,104,186,165,4,57,66,149,237,3,154,236,3,247,151,5,186,152,5,155,
+  164,4,244,164,4,83,199,149,5,235,7,160,4,3,156,116,0,2,26,72,216,112,4,255,
+  114,132,115,255,114,143,1,143,2,140,154,5,4,211,150,5,111,70,134,150,5,245,234,3,
+  0,44,112,186,236,3,29,100,95,199,151,5,170,152,5,215,149,5,198,147,5,165,155,5,
+  222,7,211,5,164,2,206,1,239,3,182,118,0,0,220,246,3,4,4,11,186,114,228,1,
+  231,117,200,2,245,4,154,120,237,116,242,116,16,11,4,0,30,238,175,115,215,2,160,116,
+  143,116,7,148,153,5,159,153,5,160,116,7,133,115,181,5,144,156,5,191,163,4,151,115,
+  148,115,0,167,104,11,112,4,4,123,145,156,5,214,120,155,116,160,116,4,4,15,228,55,
+  245,169,1,189,6,0,30,140,3,225,120,136,2,178,2,4,172,116,204,1,3,253,116,134,
+  117,16,151,115,56,212,114,183,115,0,0,90,190,4,8,166,116,182,55,223,171,1,174,116,
+  219,113,224,113,228,164,4,161,152,5,148,171,1,153,173,1,64,150,151,1,196,131,4,0,
+  167,254,1,3,2,9,163,171,4,197,109,214,3,41,40,215,3,168,3,26,21,240,241,14,
+  159,245,14,0,1,193,168,3,163,3,142,245,14,191,245,14,240,3,218,147,5,157,170,4,
+  2,207,105,212,105,2,2,4,1,58,0,167,48,155,147,5,114,2,99,46,146,106,2,215,
+  105,202,241,14,239,135,14,2,177,106,182,106,177,106,180,106,0,29,21,6,174,170,4,221,
+  148,5,140,163,5,239,184,4,22,186,169,4,137,1,171,168,4,192,61,142,202,13,28,171,
+  220,9,191,171,4,4,0,29,32,2,163,106,166,106,149,106,240,241,14,167,245,14,210,109,
+  201,109,49,170,111,6,185,116,160,171,5,159,169,5,68,0,30,175,16,11,4,4,205,115,
+  215,3,134,119,16,11,4,4,141,119,246,3,144,1,139,1,0,30,161,191,114,193,4,134,
+  119,191,114,131,4,8,148,114,150,4,233,118,172,4,140,112,200,57,131,174,1,160,153,5,
+  153,153,5,0,1,253,51,220,1,254,108,230,168,4,155,2,4,4,4,4,181,155,5,194,
+  118,4,164,166,4,135,149,5,232,110,0,29,108,40,255,111,6,218,166,5,6,251,162,5,
+  176,163,5,175,14,250,13,22,2,205,184,4,224,168,4,199,155,5,200,2,0,167,147,139,
+  154,5,75,196,116,255,115,152,5,147,5,250,1,152,152,5,146,222,9,193,243,14,174,164,
+  5,4,1,133,14,179,149,5,0,2,154,119,162,148,5,131,1,4,149,155,5,214,2,132,
+  116,4,227,111,212,111,4,235,110,244,108,252,1,195,2,0,29,129,142,169,4,237,154,5,
+  138,5,147,3,216,2,206,113,245,111,220,241,14,14,207,247,14,140,4,80,74,136,163,5,
+  4,0,167,211,4,199,1,251,149,5,224,2,4,130,163,5,191,166,5,193,5,136,2,88,
+  12,156,4,232,111,229,116,170,119,0,30,199,11,4,4,215,2,219,116,88,196,118,231,114,
+  222,164,5,151,169,5,166,119,231,114,231,3,136,116,3,0,44,120,189,173,1,242,113,149,
+  109,236,113,195,2,148,164,4,3,175,151,5,226,167,5,176,207,9,161,242,14,6,138,242,
+  14,2,129,134,14,0,29,152,166,167,4,245,153,5,196,6,177,3,108,200,2,138,242,14,
+  251,133,14,191,111,167,5,242,118,153,114,184,111,40,174,168,4,0,2,169,174,241,14,177,
+  250,14,156,6,171,3,144,3,135,3,11,8,254,4,130,111,128,166,4,187,168,4,187,110,
+  252,1,176,149,5,0,167,189,245,149,5,250,149,5,173,157,5,134,119,151,112,148,112,135,
+  116,134,173,1,129,57,7,4,253,110,224,112,254,163,4,219,153,5,0,44,118,226,234,3,
+  255,146,5,163,3,215,4,136,2,128,1,198,2,195,3,2,128,117,184,2,131,115,185,4,
+  186,119,251,114,0,1,43,8,206,113,219,108,228,242,14,225,247,14,136,116,154,165,4,4,
+  133,168,4,148,168,4,4,4,186,15,71,173,163,5,0,29,124,202,183,4,231,15,133,156,
+  5,140,6,245,2,208,5,167,1,187,7,140,119,143,113,227,2,230,172,1,178,235,3,159,
+  164,4,179,114,0,30,53,220,165,4,189,168,4,250,166,4,8,153,152,5,151,3,156,3,
+  192,1,164,3,206,242,14,169,247,14,3,130,116,145,112,134,112,0,30,57,208,56,174,251,
+  3,178,207,9,143,223,9,220,15,247,179,4,245,115,242,167,5,155,163,5,180,108,175,108,
+  194,148,5,151,153,5,178,1,180,166,5,0,2,110,174,242,14,247,244,14,147,1,186,116,
+  1,4,229,111,144,147,5,141,147,5,251,8,164,119,246,179,4,241,179,4,4,163,111,0,
+  29,111,46,162,169,4,183,163,4,4,236,161,4,137,156,5,182,3,9,8,3,138,116,224,
+  179,4,139,164,5,184,149,5,151,165,4,0,30,71,155,113,242,1,174,111,213,114,164,111,
+  234,168,4,187,168,4,167,108,131,6,182,3,208,150,5,137,156,5,136,2,184,1,134,2,
+  0,0,244,186,119,16,11,4,4,193,119,234,4,8,4,184,114,247,117,248,2,181,4,186,
+  119,219,116,0,30,219,16,11,4,4,163,115,248,148,5,4,165,235,3,217,172,1,140,116,
+  3,203,113,4,220,244,14,197,248,14,0,1,255,147,4,176,117,4,195,112,147,2,188,152,
+  5,19,207,1,231,147,5,240,108,253,108,134,109,208,182,4,70,253,164,5,0,0,112,202,
+  119,4,248,163,4,219,150,5,152,111,46,154,167,4,175,167,4,168,167,4,177,147,5,141,
+  8,208,155,5,241,146,5,169,1,152,148,5,0,2,57,141,7,210,155,5,139,152,5,8,
+  3,228,167,5,223,179,4,4,4,151,113,218,1,234,107,198,134,14,133,244,14,152,113,0,
+  2,124,236,107,234,168,4,187,168,4,247,108,96,148,163,5,197,163,5,192,124,246,150,4,
+  205,147,5,222,242,14,161,220,9,154,220,9,205,242,14,2,0,29,148,169,108,132,242,14,
+  151,222,9,47,211,155,5,208,3,148,116,135,116,140,116,143,116,3,248,2,138,244,14,249,
+  130,14,4,0,30,105,205,111,228,107,234,168,4,189,168,4,128,169,4,149,150,5,194,164,
+  5,167,15,229,148,5,2,246,108,231,108,170,163,5,42,2,0,0,223,254,112,25,4,1,
+  26,3,248,170,4,167,149,5,128,163,5,161,171,5,226,3,3,156,116,171,113,54,0,30,
+  151,158,55,245,55,4,255,114,184,245,14,179,130,14,243,3,147,111,186,3,193,4,160,172,
+  1,157,167,1,1,224,241,14,10,0,29,122,247,113,206,153,5,4,211,150,5,111,70,220,
+  109,170,168,4,137,146,5,130,163,5,223,15,205,148,5,228,106,223,106,137,3,0,1,221,
+  180,110,163,108,146,1,2,180,105,236,169,4,193,147,5,198,147,5,163,148,5,2,166,163,
+  5,2,223,184,4,220,184,4,1,0,29,8,157,106,4,1,156,242,14,191,206,9,218,206,
+  9,183,202,13,227,167,1,140,242,14,247,206,9,137,163,5,2,2,240,241,14,185,223,9,
+  0,0,117,168,8,140,163,5,169,169,5,230,1,206,1,177,3,248,117,245,117,184,3,4,
+  4,11,186,114,228,1,231,117,0,2,21,183,4,220,119,237,116,242,116,16,11,4,4,175,
+  115,246,164,5,205,167,5,160,116,143,116,204,112,211,112,0,171,78,169,14,159,153,5,160,
+  116,7,147,4,202,183,4,175,15,214,15,177,163,5,234,107,145,116,252,175,1,214,235,3,
+  191,163,4,231,111,0,29,140,202,59,231,55,216,163,4,11,112,4,4,123,211,155,5,152,
+  120,155,116,160,116,4,4,15,0,44,115,181,55,191,120,170,120,3,152,179,4,2,2,5,
+  145,183,4,167,116,136,2,244,1,239,1,160,118,204,1,0,30,243,253,116,134,117,16,151,
+  115,204,113,130,179,4,149,164,5,212,114,183,115,197,6,128,4,8,166,116,255,111,182,167,
+  1,0,1,124,174,116,219,113,224,113,189,4,48,251,107,179,3,148,2,128,227,7,6,2,
+  5,2,157,231,7,164,231,7,0,1,83,230,230,7,235,233,6,2,8,229,12,180,60,203,
+  47,2,2,2,13,16,237,12,240,12,13,0,32,156,239,12,2,220,12,224,202,14,210,24,
+  179,18,174,26,38,195,206,14,2,128,207,14,95,36,157,22,203,151,14,0,41,145,4,190,
+  6,3,191,7,9,1,8,132,27,241,25,157,26,168,15,224,36,161,190,1,220,140,1,1,
+  0,35,167,186,41,140,8,195,7,151,56,252,38,187,1,225,15,129,10,152,11,164,24,183,
+  25,246,205,14,1,5,2,1,249,5,232,10,73,15,76,237,24,189,157,14,210,162,14,209,
+  187,14,165,20,140,11,1,142,9,217,158,1,232,141,1,2,0,35,155,226,41,239,49,232,
+  30,151,29,155,1,150,1,166,36,239,36,11,236,28,137,28,178,217,14,231,179,14,237,38,
+  174,37,0,39,197,243,19,252,10,186,34,155,56,160,215,14,153,214,15,142,141,1,2,3,
+  236,42,163,56,160,56,139,19,3,3,0,46,2,189,45,188,228,14,169,23,189,193,14,5,
+  148,42,149,8,243,16,186,198,14,151,181,14,207,41,172,49,149,26,166,26,161,26,0,48,
+  26,3,255,24,236,174,14,255,191,15,154,206,15,137,165,15,4,156,92,249,14,166,27,161,
+  165,1,196,209,15,197,181,14,158,6,157,36,0,32,102,175,1,62,198,5,244,38,15,18,
+  143,8,96,132,201,14,161,232,14,246,29,177,29,226,30,6,136,7,0,33,228,85,200,29,
+  182,8,251,36,180,216,14,213,217,14,190,217,14,185,217,14,178,217,14,168,2,163,189,14,
+  148,187,14,31,203,217,14,16,0,43,58,1,81,2,179,36,196,28,158,190,14,197,182,14,
+  134,2,176,180,14,199,1,183,217,14,31,236,28,241,28,234,28,0,41,27,29,208,188,14,
+  236,1,144,9,205,228,14,184,30,8,25,15,177,30,202,30,16,7,23,15,0,33,188,144,
+  218,14,7,200,1,205,218,14,107,252,37,194,181,14,243,8,200,7,47,183,217,14,140,219,
+  14,35,223,180,14,64,0,43,112,240,178,14,219,178,14,228,178,14,139,178,14,3,128,178,
+  14,7,32,139,179,14,52,211,38,232,28,223,29,176,38,1,0,43,59,4,1,224,2,239,
+  2,6,181,38,148,1,220,218,14,194,4,211,25,253,179,14,244,182,14,177,223,14,16,11,
+  0,28,46,4,8,5,2,2,42,5,1,10,15,12,1,5,1,3,0,28,35,31,2,27,
+  2,10,134,1,107,15,2,29,2,50,2,43,15,0,28,2,1,54,13,2,17,15,8,10,
+  4,1,24,10,2,45,2,0,28,23,2,106,2,93,6,15,70,1,1,8,1,13,1,33,
+  1,0,28,38,12,9,2,2,2,2,192,57,12,181,4,178,4,3,12,19,3,189,32,0,
+  34,230,128,31,4,155,31,214,30,193,32,28,8,142,32,8,4,7,177,32,211,136,1,250,
+  168,1,197,30,0,42,123,190,164,14,151,181,14,200,192,14,243,1,134,7,28,51,197,175,
+  14,240,175,14,67,223,192,14,172,188,14,169,188,14,236,192,14,175,200,14,1,247,181,22,
+  36,243,193,14,236,192,14,141,198,14,214,191,14,1,197,242,14,5,1,10,15,12,1,5,
+  0,25,72,3,3,99,2,25,2,12,2,21,2,50,1,39,2,15,0,25,2,42,5,9,
+  19,22,2,10,10,3,2,29,2,36,11,5,0,25,10,118,21,12,13,4,17,3,16,3,
+  3,5,8,4,7,17,0,25,43,3,17,8,4,2,7,3,14,5,5,67,158,103,245,34,
+  3,2,0,32,40,230,151,7,88,6,10,12,2,2,2,2,2,2,2,2,2,2,1,6,
+  96,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,6,112,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,6,128,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,6,144,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,6,
+  160,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,6,176,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,6,192,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,6,208,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,6,
+  224,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,6,240,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,7,0,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,7,16,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,7,
+  32,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,7,48,2,2,2,2,2,
+  2,20,2,2,2,2,2,2,2,2,1,7,73,2,2,2,2,2,2,2,2,2,2,2,
+  2,22,2,2,1,7,99,2,2,2,2,205,5,2,2,2,2,2,2,2,2,2,2,1,
+  6,11,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,6,28,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,1,6,44,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,1,6,60,2,2,2,2,2,2,2,2,2,2,4,2,4,2,2,1,
+  6,78,4,2,2,2,2,167,23,2,2,2,2,2,2,2,2,2,1,0,138,2,2,2,
+  2,2,2,2,2,6,2,2,6,2,2,2,1,0,158,2,2,2,2,2,4,2,2,2,
+  2,2,2,2,2,2,1,0,175,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  1,0,191,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,0,207,2,2,4,
+  2,2,2,2,2,2,2,2,2,2,2,2,1,0,224,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,1,0,240,2,2,2,2,2,2,2,2,2,2,205,1,2,8,2,
+  22,1,0,210,153,3,76,25,42,4,55,35,13,92,83,58,30,53,25,30,1,0,35,50,
+  6,51,25,4,76,39,5,77,136,1,85,36,13,70,119,1,0,52,101,62,50,19,22,14,
+  97,19,10,116,69,49,38,28,26,1,0,29,37,78,2,19,73,136,1,113,122,115,114,39,
+  71,98,71,17,1,0,61,9,32,113,42,31,1,94,20,15,18,6,2,2,2,2,1,0,
+  85,2,2,2,2,2,2,2,2,244,210,7,224,1,244,15,189,14,187,5,191,207,14,148,
+  145,4,0,164,239,61,20,2,15,18,40,2,15,37,46,13,4,20,49,3,0,164,216,18,
+  3,2,10,28,8,75,2,32,18,45,2,76,1,6,0,164,252,7,2,55,2,44,2,2,
+  23,5,10,136,235,3,151,235,3,1,54,2,0,32,182,176,227,14,22,10,151,18,5,207,
+  203,14,212,32,26,4,7,3,10,237,32,226,32,13,0,42,98,2,11,3,164,164,14,141,
+  162,14,179,12,152,203,14,193,202,14,6,55,46,12,5,10,236,12,0,39,221,50,12,5,
+  10,2,234,199,14,134,3,147,18,135,9,198,2,251,208,14,186,233,14,203,22,203,147,14,
+  175,7,0,46,72,209,183,1,200,154,1,251,5,1,186,1,11,232,214,14,137,24,228,22,
+  2,34,4,7,23,30,1,251,77,29,38,35,227,22,3,2,5,211,190,14,192,13,137,13,
+  202,214,14,187,216,14,2,138,215,14,4,1,251,75,5,5,10,13,6,3,5,2,221,205,
+  14,135,2,129,1,223,4,192,13,128,176,14,217,183,14,0,37,255,190,214,14,173,216,14,
+  7,6,210,215,14,201,214,14,172,8,166,200,14,156,3,129,225,7,50,45,2,4,7,1,
+  2,154,43,46,41,8,2,18,13,2,4,1,4,4,13,18,2,1,2,151,27,30,11,21,
+  42,39,176,26,42,39,48,43,2,36,9,29,1,9,38,4,2,28,25,2,26,23,12,9,
+  12,9,2,10,7,21,1,9,39,48,204,191,7,235,225,15,212,228,15,214,2,163,2,251,
+  161,7,71,52,2,35,2,22,9,2,1,17,102,37,8,2,50,63,20,2,13,2,48,3,
+  9,9,9,17,1,17,104,2,8,10,3,25,2,11,2,25,58,14,1,3,234,250,6,6,
+  1,240,36,2,73,46,17,36,23,17,36,19,17,36,45,74,35,17,1,240,33,59,26,17,
+  36,20,1,59,36,17,36,19,17,36,57,74,1,240,39,41,17,36,19,17,36,47,8,70,
+  237,196,6,12,13,25,10,3,1,30,225,18,19,28,17,6,11,18,15,20,6,19,18,5,
+  22,3,1,30,243,6,3,185,198,8,68,21,5,1,10,15,12,1,5,1,3,34,0,13,
+  94,9,54,55,54,6,51,1,1,54,6,53,175,1,2,20,158,1,0,13,20,48,2,37,
+  2,200,1,3,2,79,3,78,1,4,77,93,9,0,13,34,10,78,127,2,16,2,66,99,
+  2,40,2,15,2,56,2,0,13,52,11,11,29,20,12,21,23,2,46,2,10,2,14,3,
+  2,0,13,36,2,11,2,52,97,2,86,97,16,170,1,171,1,170,1,97,132,1,2,0,
+  13,112,219,1,118,119,118,119,158,1,39,36,147,1,118,20,8,11,2,15,0,13,64,20,
+  2,19,2,64,2,63,2,194,101,197,1,202,1,1,244,1,134,202,14,245,20,1,244,107,
+  158,4,11,130,15,133,19,2,237,206,14,197,97,4,51,4,1,4,40,27,1,0,8,75,
+  2,2,6,4,2,9,12,5,8,25,3,32,43,30,15,0,8,87,35,50,7,166,196,15,
+  143,186,7,2,23,51,50,47,2,6,30,16,47,1,10,195,6,14,3,2,8,4,2,6,
+  2,8,10,3,6,7,9,1,10,226,2,2,43,14,27,20,28,31,11,2,68,1,8,3,
+  2,1,10,244,1,1,1,10,11,10,89,172,166,7,164,4,154,17,155,203,14,164,177,14,
+  161,219,6,48,14,1,28,128,19,2,10,16,31,52,43,11,2,48,19,7,15,8,10,1,
+  28,127,22,6,1,35,2,14,2,4,8,3,1,41,136,1,2,13,1,28,160,19,2,10,
+  16,31,52,43,11,2,48,19,7,15,8,10,1,28,159,22,6,1,35,2,14,2,4,8,
+  3,1,20,6,3,6,1,28,178,137,216,7,188,202,14,229,239,6,5,1,10,15,12,1,
+  5,1,3,159,1,2,14,1,29,11,46,2,35,2,22,9,2,10,47,16,2,58,83,2,
+  32,1,29,20,54,69,2,66,13,12,17,9,29,20,9,23,46,2,10,1,29,43,3,2,
+  29,2,40,51,2,37,2,70,5,68,1,11,6,1,29,68,3,1,8,39,22,6,9,15,
+  2,20,17,2,2,247,241,8,230,195,15,0,48,60,154,166,14,145,151,1,208,10,205,10,
+  208,10,205,10,248,10,245,10,208,10,190,4,139,15,208,10,4,209,10,2,1,214,170,197,
+  10,2,208,10,205,10,2,206,10,203,10,206,10,203,10,206,10,203,10,206,10,203,10,228,
+  10,19,1,212,15,220,10,11,16,221,10,2,206,10,203,10,208,10,205,10,208,10,23,20,
+  201,10,208,10,205,10,1,212,22,2,188,10,185,10,2,168,10,210,4,5,1,10,15,12,
+  1,5,1,3,1,214,220,223,5,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+  213,123,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,213,139,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,1,213,155,2,2,2,2,237,4,232,10,229,10,
+  232,10,229,10,144,11,141,11,232,10,229,10,232,10,4,1,212,109,2,224,10,221,10,2,
+  232,10,229,10,2,230,10,227,10,230,10,227,10,230,10,227,10,230,10,227,10,1,215,52,
+  19,229,10,244,10,11,16,245,10,2,230,10,227,10,232,10,229,10,232,10,23,20,225,10,
+  1,215,48,229,10,2,2,212,10,209,10,2,192,10,94,4,57,52,8,4,1,163,11,1,
+  215,54,229,10,232,10,229,10,144,11,141,11,232,10,229,10,232,10,4,233,10,128,11,253,
+  10,224,10,221,10,2,1,215,62,229,10,2,230,10,227,10,230,10,227,10,230,10,227,10,
+  230,10,227,10,252,10,19,229,10,244,10,11,1,215,77,245,10,2,230,10,227,10,232,10,
+  229,10,232,10,23,205,10,232,10,229,10,2,2,212,10,209,10,1,212,155,192,10,44,229,
+  1,57,52,8,4,1,159,8,2,2,2,2,2,2,1,212,215,2,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,1,212,231,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,1,212,247,2,2,2,2,2,2,2,2,2,2,2,2,209,3,208,10,205,10,1,
+  214,195,205,10,248,10,245,10,208,10,140,4,217,14,208,10,4,209,10,232,10,229,10,200,
+  10,197,10,2,208,10,1,212,35,2,206,10,203,10,206,10,203,10,206,10,203,10,206,10,
+  203,10,228,10,19,205,10,220,10,11,16,1,212,42,2,206,10,203,10,208,10,205,10,208,
+  10,23,181,10,208,10,205,10,2,2,188,10,185,10,2,1,214,199,44,201,6,2,4,2,
+  2,2,4,2,2,2,2,4,8,2,1,213,76,2,2,2,2,160,10,5,1,10,15,12,
+  1,5,1,3,139,10,1,213,83,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  1,213,99,2,2,2,2,2,2,2,2,187,182,13,238,180,13,2,4,2,2,2,1,213,
+  13,2,2,2,2,2,2,2,4,2,2,2,2,2,2,4,1,213,31,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,213,47,2,2,2,2,2,2,2,2,133,4,220,
+  10,217,10,220,10,217,10,132,11,129,11,1,214,229,217,10,220,10,4,221,10,2,212,10,
+  209,10,2,220,10,217,10,2,218,10,215,10,218,10,215,10,1,214,237,215,10,218,10,215,
+  10,240,10,19,217,10,232,10,11,16,233,10,2,218,10,215,10,220,10,217,10,1,214,245,
+  23,20,213,10,220,10,217,10,2,2,200,10,197,10,2,180,10,94,4,57,52,1,215,25,
+  4,1,151,11,220,10,217,10,220,10,217,10,132,11,129,11,220,10,181,1,2,165,9,220,
+  10,4,1,212,83,244,10,241,10,212,10,207,10,220,10,217,10,2,218,10,215,10,218,10,
+  215,10,218,10,215,10,218,10,215,10,1,215,20,19,217,10,232,10,11,16,233,10,2,218,
+  10,215,10,220,10,217,10,220,10,23,193,10,220,10,1,212,99,2,2,200,10,197,10,2,
+  180,10,44,221,188,13,4,8,15,12,136,186,13,2,2,1,214,115,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,1,214,131,2,2,2,2,2,2,234,5,5,1,10,15,
+  12,1,5,1,1,215,246,215,5,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+  214,153,2,2,2,2,2,2,2,2,2,2,243,186,13,4,8,15,12,0,39,203,146,184,
+  13,132,6,129,6,132,6,129,6,172,6,169,6,132,6,129,6,132,6,4,133,6,2,252,
+  5,249,5,1,213,220,132,6,129,6,2,130,6,255,5,130,6,255,5,130,6,255,5,130,
+  6,255,5,152,6,19,129,6,144,6,1,215,101,16,145,6,2,130,6,255,5,132,6,129,
+  6,132,6,23,20,253,5,132,6,129,6,2,2,1,215,99,237,5,2,220,5,178,2,5,
+  1,10,15,12,1,5,1,3,195,1,155,5,1,215,144,165,5,168,5,165,5,208,5,205,
+  5,168,5,165,5,168,5,4,169,5,2,160,5,157,5,2,168,5,1,214,69,2,166,5,
+  163,5,166,5,163,5,166,5,163,5,166,5,163,5,188,5,19,165,5,180,5,11,16,1,
+  214,76,2,166,5,163,5,168,5,165,5,168,5,23,20,161,5,168,5,165,5,2,2,148,
+  5,145,5,1,214,85,128,5,94,4,57,52,8,4,1,227,5,168,5,165,5,168,5,165,
+  5,208,5,205,5,1,215,173,165,5,168,5,4,169,5,192,5,189,5,160,5,157,5,2,
+  168,5,165,5,2,166,5,163,5,166,5,1,214,98,166,5,163,5,166,5,163,5,188,5,
+  19,165,5,180,5,11,16,181,5,2,166,5,163,5,168,5,1,214,105,168,5,23,141,5,
+  168,5,165,5,2,2,148,5,145,5,2,128,5,44,113,57,52,1,215,141,4,1,191,6,
+  132,6,129,6,132,6,129,6,172,6,169,6,132,6,129,6,132,6,4,133,6,156,6,1,
+  213,244,252,5,249,5,2,132,6,129,6,2,130,6,255,5,130,6,255,5,130,6,255,5,
+  130,6,255,5,152,6,1,215,126,129,6,144,6,11,16,145,6,2,130,6,255,5,132,6,
+  129,6,132,6,23,233,5,132,6,129,6,1,214,4,2,240,5,237,5,2,220,5,44,213,
+  7,2,2,2,2,2,2,2,2,1,213,169,2,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,213,185,226,8,5,1,10,15,12,1,5,1,3,179,7,2,2,2,2,1,
+  214,13,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,214,29,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,2,1,214,45,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,129,2,1,213,187,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  1,213,203,2,2,2,2,2,2,2,2,237,4,4,2,6,6,2,6,1,212,170,2,2,
+  4,2,2,2,2,2,2,2,2,2,2,2,4,1,212,189,2,2,2,2,2,2,4,2,
+  2,2,2,2,2,2,2,1,212,206,2,142,132,1,219,139,1,20,13,8,19,1,20,9,
+  20,35,12,20,21,1,210,240,11,6,19,18,19,3,253,194,13,244,29,32,1,10,3,2,
+  3,5,0,41,168,147,29,254,28,242,166,14,208,25,2,227,173,4,34,51,24,2,16,19,
+  9,1,26,1,110,75,6,3,11,28,39,54,7,12,5,37,28,14,53,14,20,1,110,66,
+  2,42,14,23,27,164,1,29,5,1,10,15,38,25,1,5,1,110,150,39,38,41,52,3,
+  11,13,8,1,10,3,1,11,6,1,1,110,109,34,51,24,2,16,19,9,1,26,21,6,
+  3,11,28,39,1,110,123,7,12,5,37,28,14,53,14,20,31,2,42,14,23,27,1,110,
+  153,153,129,10,14,2,209,30,180,195,14,146,1,35,23,139,193,14,2,180,193,14,4,71,
+  221,192,14,23,0,39,108,153,28,172,28,23,8,250,192,14,175,200,14,242,200,14,41,147,
+  196,14,170,196,14,4,211,193,14,221,2,202,195,14,187,178,10,0,170,242,246,3,249,3,
+  246,3,26,5,1,10,15,12,1,5,1,3,61,8,0,171,218,239,3,200,3,191,3,2,
+  228,3,3,237,3,240,3,11,9,4,38,29,6,27,0,171,192,54,49,52,49,52,47,52,
+  43,48,241,3,9,3,198,3,52,27,0,171,212,37,175,3,2,192,3,5,50,247,3,2,
+  210,3,5,2,64,241,3,6,17,0,170,239,236,3,237,3,246,3,251,3,242,3,12,13,
+  8,2,247,3,18,226,3,227,3,168,161,10,176,30,1,244,221,143,48,5,8,11,8,5,
+  4,9,5,1,10,15,12,1,5,1,232,200,143,3,2,2,12,2,2,20,2,2,10,2,
+  2,10,2,2,1,232,62,2,2,35,2,2,40,2,2,31,2,2,38,2,2,12,1,232,
+  84,2,10,2,2,14,2,2,12,3,8,22,84,167,2,208,1,64,1,232,6,24,248,1,
+  4,55,5,107,26,190,1,57,110,211,2,218,2,229,2,134,2,133,1,1,232,180,225,2,
+  158,2,66,77,131,1,196,1,1,37,187,1,206,1,133,1,177,1,244,2,195,1,81,1,
+  232,87,112,43,19,107,136,2,121,25,37,61,108,95,178,1,18,161,2,39,1,232,108,153,
+  1,200,2,107,205,1,120,94,225,1,82,168,1,55,82,13,153,1,49,142,1,1,232,164,
+  169,1,131,1,218,1,143,1,104,179,1,204,2,105,71,120,50,15,20,201,2,232,1,1,
+  232,112,126,121,143,1,234,1,127,178,1,153,2,16,19,15,27,182,1,43,140,1,155,2,
+  1,232,190,85,47,165,1,128,2,30,177,2,186,2,11,241,1,69,212,1,13,91,174,1,
+  77,1,232,80,152,1,213,1,23,182,2,177,2,192,1,2,5,59,182,1,41,39,70,67,
+  143,1,1,232,104,70,187,1,75,118,2,236,1,109,14,98,159,1,98,7,249,1,216,1,
+  86,1,232,182,129,1,203,1,58,18,88,218,51,214,5,243,193,14,252,142,7,129,1,124,
+  1,10,129,1,114,1,9,252,1,8,13,1,173,1,32,19,34,43,26,23,32,9,1,7,
+  1,9,169,2,13,8,24,15,8,4,6,2,2,33,1,54,1,18,1,9,217,54,35,18,
+  59,54,71,36,54,35,37,54,71,36,54,35,1,9,200,36,54,35,18,87,36,54,35,41,
+  36,54,35,35,54,73,1,9,215,54,35,35,54,63,54,49,54,71,36,54,35,37,54,71,
+  1,9,211,54,35,183,1,12,2,44,55,34,31,40,9,1,13,2,2,1,9,140,2,19,
+  10,30,17,2,8,2,2,6,2,2,2,2,45,1,9,132,52,2,250,192,7,149,216,14,
+  2,4,10,11,10,1,1,1,228,202,14,135,157,4,121,1,111,19,36,52,123,136,1,115,
+  8,24,4,54,17,48,55,71,48,18,1,111,41,5,60,75,15,4,2,3,37,2,22,128,
+  1,89,2,37,6,1,111,21,46,2,89,6,60,2,240,1,2,2,2,2,2,217,1,48,
+  31,1,111,51,2,36,119,124,91,4,238,1,2,2,2,2,2,2,195,1,36,1,111,46,
+  7,55,11,2,114,53,20,33,27,31,22,88,17,71,94,1,111,53,14,11,14,2,6,1,
+  34,3,8,1,126,2,5,2,119,1,111,85,60,2,59,70,67,2,70,59,80,21,55,2,
+  48,3,39,1,111,98,2,2,4,60,57,4,7,66,59,42,2,73,82,67,66,1,111,90,
+  68,7,3,23,2,2,2,4,48,45,30,33,42,77,1,1,111,113,2,28,149,187,11,214,
+  227,15,247,23,144,6,233,209,15,150,236,15,165,227,14,206,222,14,255,27,147,2,205,201,
+  14,214,215,14,165,7,1,245,213,133,207,14,208,32,33,2,2,2,211,31,93,216,31,190,
+  194,14,22,239,22,6,3,149,201,14,1,249,59,239,139,7,3,46,5,1,10,15,12,1,
+  5,1,3,27,131,1,2,1,22,11,4,46,2,35,2,22,9,2,10,43,12,2,58,87,
+  2,1,22,21,2,15,2,52,12,17,9,29,20,9,21,44,2,10,10,1,22,43,2,29,
+  2,11,2,41,2,74,67,2,5,2,64,44,6,1,22,68,9,1,27,20,4,5,15,2,
+  18,15,2,6,2,5,2,0,171,91,161,162,5,220,147,8,247,147,8,122,4,244,146,8,
+  145,170,7,2,2,2,134,171,4,131,171,4,2,132,171,4,255,170,4,0,29,52,136,171,
+  4,133,171,4,2,2,2,2,2,4,2,2,236,170,4,233,170,4,25,18,10,0,29,65,
+  248,60,245,60,221,105,1,222,144,5,8,4,7,5,8,4,7,247,144,5,134,147,5,211,
+  146,5,0,29,120,200,164,4,2,178,132,3,185,130,3,1,1,209,144,5,103,22,32,74,
+  4,162,144,5,9,20,0,2,229,216,144,5,9,20,217,144,5,166,56,247,56,230,147,8,
+  207,147,8,12,250,144,5,9,20,217,144,5,162,147,8,233,147,8,0,2,191,214,162,5,
+  181,162,5,242,146,5,239,1,9,183,144,5,65,162,145,5,191,144,5,27,200,144,5,143,
+  145,5,74,2,8,0,2,232,16,71,156,145,5,161,145,5,140,145,5,9,20,217,144,5,
+  30,1,1,57,78,79,57,0,2,248,200,144,5,2,2,5,188,130,3,247,147,8,8,230,
+  147,8,171,147,8,53,9,218,162,5,219,161,5,154,146,5,141,169,4,1,7,131,205,168,
+  7,45,4,252,168,7,167,167,7,167,1,15,142,1,2,198,167,7,8,28,4,4,223,167,
+  7,0,29,167,225,107,234,107,226,167,7,215,167,7,230,167,7,14,227,167,7,244,167,7,
+  161,169,7,134,169,7,41,141,169,7,136,169,7,2,3,0,29,95,214,168,7,209,167,7,
+  238,167,7,33,4,1,253,168,7,16,198,1,43,64,59,224,167,7,133,169,7,140,169,7,
+  0,2,224,252,105,4,223,106,2,200,147,8,241,240,2,246,240,2,229,167,7,2,229,107,
+  236,107,177,1,219,105,244,146,8,251,240,2,0,171,94,231,182,4,1,232,167,7,2,2,
+  203,254,2,192,254,2,2,147,169,7,184,1,4,2,185,1,160,169,7,173,169,7,0,29,
+  83,6,184,1,230,167,7,227,147,8,236,147,8,1,45,5,211,146,8,246,106,249,106,176,
+  147,8,141,168,7,209,1,176,1,0,29,89,3,188,1,244,167,7,7,6,221,167,7,213,
+  1,176,169,7,2,209,169,7,4,170,1,16,169,1,24,0,29,173,193,1,175,106,2,226,
+  147,8,2,217,167,7,222,182,4,238,240,2,2,145,169,7,188,1,210,182,4,207,182,4,
+  183,1,188,1,1,7,176,241,147,8,88,85,134,108,4,1,200,165,4,2,194,129,3,1,
+  225,146,8,41,100,81,32,0,167,112,207,146,5,72,1,1,192,156,1,204,170,14,16,178,
+  17,161,132,15,200,249,7,7,183,249,7,3,44,5,0,24,20,10,15,12,1,5,1,3,
+  164,249,7,193,249,7,8,20,7,4,1,17,1,22,103,2,143,249,7,206,1,32,45,10,
+  12,12,48,77,24,48,2,61,7,0,24,137,2,10,6,2,2,7,19,12,2,19,3,42,
+  1,215,1,2,0,24,52,136,1,107,29,35,12,36,23,34,55,38,10,2,23,34,35,0,
+  24,168,23,14,7,4,13,6,26,29,14,3,3,14,1,91,5,0,24,116,2,4,157,1,
+  9,4,12,2,22,13,2,98,30,15,23,28,0,24,100,16,13,16,29,2,22,13,6,20,
+  17,2,12,25,1,30,0,24,114,127,204,1,2,157,1,2,14,1,22,47,20,20,2,39,
+  28,14,0,24,87,39,24,24,41,4,8,2,6,8,25,4,26,1,49,47,0,24,38,36,
+  3,14,8,3,109,2,2,174,249,7,10,1,187,249,7,196,249,7,4,1,0,24,6,186,
+  249,7,18,187,249,7,136,240,14,70,233,132,1,235,177,13,2,164,192,14,159,204,14,198,
+  201,14,252,13,185,23,246,6,166,17,1,249,54,161,9,32,142,11,177,11,207,3,149,188,
+  14,138,191,14,41,3,185,10,88,238,25,191,25,189,2,180,9,1,106,110,11,5,1,10,
+  15,12,1,5,1,3,30,81,3,14,11,1,106,74,28,3,12,37,6,7,34,4,1,23,
+  21,3,28,6,9,1,106,81,1,17,44,19,2,39,60,17,4,41,173,159,10,1,172,192,
+  7,58,4,1,18,138,2,26,11,2,2,10,43,6,4,60,73,22,2,17,2,1,18,163,
+  5,11,9,11,24,2,12,12,1,3,29,2,13,2,29,1,18,164,5,16,225,191,7,252,
+  195,14,189,203,15,192,165,1,5,2,12,21,2,183,12,145,18,2,2,1,243,68,173,179,
+  14,2,2,148,181,14,65,58,14,239,136,1,1,31,12,3,3,193,1,2,1,209,18,148,
+  1,184,1,22,195,2,27,100,164,2,3,243,1,1,155,1,222,1,12,39,56,1,209,133,
+  10,64,119,2,2,2,2,42,74,83,5,2,12,4,74,1,209,102,48,3,45,48,43,2,
+  2,68,64,237,1,188,1,122,179,2,85,1,1,209,180,2,225,2,158,2,44,207,2,84,
+  1,9,2,116,67,108,104,91,3,1,209,118,167,1,2,2,39,2,29,208,1,2,2,163,
+  1,38,1,202,1,239,1,8,1,209,192,1,193,2,2,2,164,2,1,55,1,120,2,229,
+  1,164,1,231,1,212,1,27,1,209,222,16,2,15,2,16,9,2,2,7,2,16,199,3,
+  226,2,22,1,1,209,182,75,86,2,18,227,1,1,47,33,12,1,242,1,157,1,2,22,
+  67,1,209,22,138,2,18,2,17,2,2,2,2,2,2,2,217,1,2,62,176,1,1,209,
+  175,92,155,1,149,1,160,2,10,2,245,1,67,19,1,12,2,97,10,2,1,209,15,23,
+  8,138,2,148,1,10,159,3,222,2,20,21,10,16,17,151,2,1,85,1,209,0,54,2,
+  138,1,67,72,67,208,2,45,149,2,1,142,1,124,2,2,2,1,209,202,3,1,4,205,
+  1,67,79,128,3,8,139,1,141,1,1,5,1,6,1,1,209,73,16,1,15,26,1,134,
+  1,4,2,133,2,248,2,247,1,12,67,240,1,223,1,1,209,142,159,133,14,3,2,3,
+  74,1,1,72,115,5,1,10,15,12,1,0,16,67,1,3,61,178,233,4,159,233,4,37,
+  2,37,2,24,9,2,10,40,146,1,0,16,110,2,217,1,2,120,63,8,2,57,2,15,
+  2,192,233,4,2,12,2,0,170,106,10,29,26,2,21,2,14,11,28,13,11,2,20,2,
+  171,233,4,0,16,32,13,134,1,2,105,102,1,139,1,31,22,9,1,64,39,2,10,0,
+  16,142,223,1,134,1,33,91,186,1,202,229,4,215,229,4,210,229,4,203,229,4,6,13,
+  210,229,4,189,229,4,194,229,4,217,229,4,0,16,118,12,206,229,4,209,229,4,6,6,
+  13,138,232,4,2,219,232,4,129,1,218,231,4,2,5,27,2,0,169,252,39,2,2,2,
+  2,28,21,15,171,231,4,11,2,50,2,92,2,0,16,82,2,107,146,1,1,149,1,184,
+  233,4,3,2,9,147,2,155,229,4,5,1,10,15,0,16,151,1,5,1,3,179,1,8,
+  5,198,1,2,161,1,226,232,4,215,231,4,135,1,132,1,3,0,16,140,178,229,4,187,
+  229,4,2,2,2,228,231,4,2,135,233,4,1,98,2,2,2,2,61,0,170,119,2,2,
+  215,232,4,4,5,166,1,1,180,229,4,5,1,10,15,12,1,5,0,169,242,3,153,230,
+  4,2,111,12,212,1,2,215,1,8,120,135,1,2,140,1,3,2,0,16,51,2,92,66,
+  2,2,2,181,1,8,2,80,2,5,2,32,2,0,42,0,2,2,227,31,228,2,3,2,
+  227,2,236,31,2,233,31,240,31,139,29,128,29,2,246,3,1,8,171,83,44,39,4,9,
+  4,8,16,4,4,4,16,31,15,6,1,8,138,10,4,4,4,6,4,2,3,5,14,2,
+  37,5,10,7,1,8,172,3,5,16,3,7,10,11,193,154,7,252,201,14,189,207,14,234,
+  208,14,189,200,14,206,220,7,133,1,2,1,25,171,4,46,2,35,2,22,9,2,10,43,
+  12,2,58,87,2,1,25,181,2,15,2,52,12,17,9,29,20,9,21,44,2,10,16,1,
+  25,205,3,2,29,2,11,2,41,2,74,71,2,64,46,6,2,1,25,224,1,27,20,4,
+  5,15,2,18,16,31,2,2,2,207,230,7,126,1,243,222,136,21,186,3,213,22,201,198,
+  14,160,9,162,177,14,2,2,2,2,2,2,2,2,2,1,241,90,2,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,0,36,242,13,8,1,10,3,1,5,1,16,200,203,14,
+  3,206,15,4,1,223,40,0,39,78,250,168,14,53,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,1,241,126,2,2,2,2,2,2,2,2,2,2,2,6,240,40,237,40,4,0,
+  34,136,2,131,1,84,8,8,17,8,8,156,15,134,22,148,181,14,237,180,14,188,187,14,
+  103,167,207,14,1,250,3,42,84,16,6,153,1,42,84,117,8,34,8,84,7,33,89,1,
+  250,26,84,133,1,42,84,123,42,84,39,5,8,2,7,2,183,16,253,11,1,243,26,223,
+  201,14,163,27,5,1,10,15,12,1,5,1,3,17,1,1,1,0,25,195,1,1,61,1,
+  13,12,59,72,19,11,11,23,32,2,41,0,25,137,66,55,2,13,38,47,72,57,54,1,
+  13,12,59,70,17,0,25,153,11,23,32,2,45,22,62,51,2,13,38,47,70,55,162,1,
+  0,25,223,9,35,2,47,20,9,8,9,5,28,17,2,12,1,19,0,25,185,12,21,16,
+  23,190,234,7,3,3,26,5,1,10,15,12,1,5,1,20,82,3,20,27,4,30,185,1,
+  2,20,4,52,2,39,2,24,9,1,20,29,10,47,12,2,70,99,2,38,2,17,2,62,
+  2,11,2,1,20,35,33,2,34,11,11,2,25,50,2,12,2,12,3,2,37,1,20,32,
+  11,2,45,2,180,1,173,1,2,5,2,82,9,60,36,6,39,1,20,68,6,7,10,48,
+  51,54,61,6,31,20,4,5,15,2,18,1,20,56,2,6,2,5,2,209,162,7,2,186,
+  165,14,175,197,14,214,189,14,232,25,135,198,15,9,2,2,0,7,241,2,13,2,2,22,
+  10,105,5,1,10,15,12,1,5,1,0,7,192,124,9,9,12,95,18,8,2,13,7,3,
+  36,1,16,47,0,7,214,38,1,4,23,2,4,29,34,5,4,10,45,1,10,10,0,7,
+  218,2,11,13,46,2,30,4,1,18,232,186,15,189,191,14,174,191,14,235,6,82,178,6,
+  1,245,114,246,4,153,216,15,158,127,190,132,7,249,133,7,192,218,14,167,175,14,191,32,
+  131,8,238,7,4,220,25,149,30,162,30,18,0,41,46,19,200,7,225,36,150,210,14,31,
+  16,246,7,219,179,14,32,237,1,232,244,3,5,1,6,1,0,168,53,4,4,5,4,173,
+  252,3,149,30,162,30,22,129,29,113,214,29,204,7,229,36,148,210,14,31,1,246,88,248,
+  7,219,179,14,32,233,1,210,175,14,205,10,253,198,14,2,119,127,118,238,4,181,4,26,
+  4,0,34,98,24,248,1,4,139,3,243,133,1,236,136,1,2,195,2,216,1,172,202,14,
+  167,182,14,170,182,14,165,182,14,174,184,14,4,1,245,201,235,3,2,245,192,14,13,8,
+  1,10,3,233,145,1,232,145,1,11,6,1,16,137,14,1,111,225,144,149,4,179,79,13,
+  5,1,10,15,12,1,5,1,3,55,2,57,1,225,15,28,26,2,43,26,59,54,14,47,
+  9,17,64,53,14,9,1,225,28,4,9,15,29,22,12,5,48,2,29,14,19,1,26,49,
+  1,225,3,3,38,38,41,52,75,42,5,25,134,1,39,2,3,3,2,1,225,60,2,25,
+  12,1,5,1,6,1,237,132,7,169,217,6,1,238,18,187,41,144,1,5,0,36,69,2,
+  9,16,1,4,15,3,6,156,202,14,239,10,237,2,128,2,141,245,14,21,29,0,22,138,
+  1,3,28,3,12,43,18,24,7,35,18,4,15,24,10,0,22,154,21,21,20,11,3,34,
+  9,20,55,201,78,150,121,248,214,14,171,10,157,223,14,73,0,28,85,1,10,15,12,1,
+  5,1,3,82,47,1,4,2,13,4,0,28,93,3,42,2,3,6,23,2,2,5,21,10,
+  30,19,30,19,0,28,117,4,5,4,23,2,2,2,22,4,4,6,1,5,206,205,10,2,
+  1,12,128,2,38,33,10,4,1,13,4,74,69,2,8,2,2,2,1,12,143,6,2,6,
+  2,2,18,15,39,68,20,45,12,4,4,2,1,12,166,4,12,2,2,63,2,24,30,33,
+  8,5,4,30,19,14,1,12,149,58,13,164,1,3,1,8,2,5,119,2,38,33,10,4,
+  1,1,12,194,4,74,69,2,8,2,2,2,2,6,2,6,2,2,18,1,12,217,39,68,
+  20,45,12,4,4,2,2,4,12,2,2,63,2,1,12,221,30,33,8,5,4,30,19,14,
+  41,58,13,213,39,2,54,49,1,3,4,44,5,23,2,2,12,16,13,11,34,47,4,40,
+  37,15,1,3,25,13,56,61,2,16,13,60,51,25,28,16,49,80,77,58,1,3,33,1,
+  4,246,202,7,149,173,7,1,17,22,4,21,7,18,2,8,4,39,1,10,128,22,4,23,
+  4,18,15,6,14,18,27,32,4,43,42,4,1,10,152,10,2,2,157,29,2,38,33,6,
+  4,7,46,49,52,37,56,1,3,114,47,2,2,2,24,2,21,2,12,1,7,2,22,19,
+  22,1,3,94,44,5,3,2,15,1,24,55,3,128,2,7,4,2,3,99,1,3,200,2,
+  2,47,56,2,77,10,62,2,61,2,8,27,2,58,1,3,161,16,2,13,2,52,15,2,
+  2,7,2,7,22,2,4,4,1,3,194,45,10,7,19,48,2,39,72,35,14,32,198,199,
+  7,153,154,7,75,38,1,15,18,31,1,4,6,18,2,12,2,8,2,47,2,8,4,2,
+  1,15,13,2,12,8,5,7,16,2,37,6,3,62,11,1,5,16,1,15,34,4,9,8,
+  9,217,18,2,19,26,3,12,17,12,3,39,4,1,10,107,4,23,4,18,15,6,14,2,
+  9,7,6,28,8,2,45,1,10,122,3,12,1,4,130,6,18,16,11,16,7,22,12,8,
+  48,4,1,12,69,89,21,34,10,34,12,6,4,8,89,100,43,33,2,12,1,12,45,13,
+  8,10,36,89,33,92,10,95,2,42,40,16,30,139,1,1,12,10,16,31,20,8,22,20,
+  18,48,89,21,34,26,18,12,10,1,12,68,89,35,92,19,3,8,46,89,33,102,93,42,
+  56,146,13,2,1,15,132,2,41,2,8,5,10,2,18,15,2,4,4,1,3,8,1,15,
+  128,25,6,3,36,6,3,2,150,169,7,189,21,2,186,25,145,22,91,250,5,21,1,246,
+  241,185,1,4,205,3,149,214,14,142,56,140,177,14,215,2,221,19,229,194,14,158,12,13,
+  31,66,140,182,14,254,3,1,244,80,134,3,75,1,209,180,14,2,233,16,2,220,16,223,
+  3,129,3,228,186,14,242,3,165,202,14,196,18,164,180,14,1,249,225,115,225,219,14,191,
+  93,2,46,5,1,10,15,12,1,5,1,3,32,0,11,115,1,6,1,6,13,213,1,2,
+  20,8,48,2,37,2,22,9,0,11,34,10,47,16,2,66,99,2,40,2,15,2,56,2,
+  9,11,0,11,25,20,9,21,46,2,10,90,1,71,3,2,37,2,11,2,0,11,9,2,
+  86,81,170,1,171,1,170,1,34,131,1,96,185,1,118,119,118,50,15,0,11,3,118,20,
+  8,9,15,2,22,19,2,64,2,63,2,244,199,7,2,0,38,38,148,250,6,6,3,2,
+  4,2,48,43,1,14,16,8,4,37,50,1,4,185,2,2,2,40,35,2,2,2,2,2,
+  2,4,2,2,4,1,4,204,4,2,6,2,10,6,3,2,4,2,48,43,1,14,16,1,
+  4,241,4,37,50,47,2,2,2,40,35,2,2,2,2,2,2,1,4,238,2,2,4,4,
+  4,2,6,2,165,1,5,1,10,15,12,1,1,4,163,1,3,19,10,53,2,20,9,8,
+  26,10,29,1,16,8,1,4,131,24,19,22,2,2,14,8,29,13,2,2,13,48,13,29,
+  1,4,149,162,212,7,225,49,5,1,14,3,3,1,12,3,8,21,1,22,4,1,237,61,
+  29,75,36,18,35,54,59,54,71,36,18,37,54,71,36,1,237,31,43,36,18,35,54,87,
+  36,18,41,36,18,35,54,73,36,1,237,33,35,54,63,54,49,54,71,36,18,37,54,71,
+  36,18,239,175,14,1,244,228,237,182,14,39,12,131,2,176,203,14,187,14,181,168,14,1,
+  1,247,45,150,229,14,141,22,208,22,135,19,210,3,1,244,196,182,4,183,4,56,226,3,
+  136,4,145,173,4,3,11,10,11,24,27,1,10,6,1,107,133,2,17,32,5,10,27,22,
+  27,161,1,4,15,15,12,8,21,1,107,38,12,7,11,3,22,27,26,13,3,9,36,19,
+  104,5,1,1,107,89,15,12,1,5,1,3,53,5,2,3,6,4,11,94,5,1,107,94,
+  4,5,3,12,22,101,116,1,10,1,97,94,2,31,6,1,107,67,90,93,90,6,15,4,
+  8,17,14,99,80,65,3,11,5,1,107,56,24,76,85,5,2,2,76,6,153,1,2,9,
+  23,2,13,2,1,107,23,17,2,13,15,2,16,22,2,37,2,30,11,2,12,5,1,107,
+  17,21,2,34,2,201,145,10,202,29,180,179,14,253,30,128,31,131,7,245,194,7,45,32,
+  29,4,1,8,109,21,4,6,6,2,2,4,6,4,2,3,5,12,2,27,1,8,101,8,
+  5,46,1,5,10,5,8,9,3,204,195,7,195,20,164,2,232,22,177,233,14,0,46,15,
+  124,207,48,154,35,2,239,25,5,1,10,15,12,1,5,1,168,54,28,0,50,8,28,12,
+  29,28,39,28,21,28,47,28,19,28,33,28,5,0,50,26,41,28,31,28,21,28,17,28,
+  45,28,94,9,5,15,15,0,50,61,6,19,21,13,1,30,12,19,7,20,23,15,70,19,
+  10,0,50,65,2,55,1,28,4,7,20,21,24,37,13,1,22,2,29,0,50,29,230,251,
+  13,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,241,31,2,2,2,2,2,2,
+  2,2,2,2,153,178,14,2,2,2,2,0,36,161,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,2,0,36,177,2,2,2,2,95,13,8,1,10,3,1,11,6,1,16,1,
+  249,156,189,165,14,245,56,246,17,166,47,242,132,14,151,158,14,236,171,14,195,205,14,2,
+  224,204,14,153,239,6,6,15,53,17,1,26,205,14,31,36,5,20,8,3,2,6,13,4,
+  8,4,53,1,1,26,215,8,51,18,15,2,26,17,34,47,34,2,13,6,2,20,1,26,
+  218,39,1,94,6,7,6,13,6,1,21,6,7,6,1,6,1,26,236,4,5,4,162,229,
+  6,159,184,14,198,180,14,146,25,123,151,24,204,13,223,4,237,185,14,176,180,14,218,7,
+  223,188,14,1,250,194,163,234,14,184,4,181,4,151,128,1,144,206,15,221,180,14,136,5,
+  190,12,132,173,14,72,160,14,189,2,213,11,150,14,3,1,246,76,165,189,14,240,181,14,
+  168,25,235,17,140,14,141,14,165,6,233,198,14,189,9,20,244,228,14,235,197,10,47,32,
+  6,0,168,78,19,94,91,10,66,49,28,12,3,67,70,17,4,47,11,0,168,65,48,19,
+  7,15,82,73,52,41,2,42,19,6,1,7,27,0,168,73,14,2,48,2,21,32,1,53,
+  32,23,3,1,70,1,3,0,168,113,19,2,20,206,229,2,48,19,11,13,34,47,30,20,
+  47,16,20,1,1,228,50,51,24,1,20,65,68,69,40,1,17,44,49,2,50,1,1,244,
+  71,68,65,56,16,43,7,26,5,44,1,79,12,48,6,1,1,252,77,189,170,7,1,180,
+  199,7,29,2,4,1,4,6,6,2,2,2,6,1,9,18,2,3,5,12,2,25,5,8,
+  5,32,6,3,8,5,4,1,9,31,135,245,6,151,20,216,192,14,216,9,161,21,66,12,
+  141,206,15,230,207,15,61,246,23,241,5,6,131,22,127,0,39,47,183,3,176,187,14,173,
+  201,14,140,32,154,191,14,157,222,14,240,206,14,131,215,14,2,156,215,14,151,24,31,31,
+  31,1,1,240,207,18,31,31,31,90,31,31,31,118,23,31,31,31,110,31,1,240,187,31,
+  102,31,31,31,92,31,31,31,90,31,31,31,104,31,1,240,189,31,36,48,31,31,31,94,
+  31,31,31,104,31,31,31,82,1,240,195,31,31,124,18,2,2,2,2,2,2,2,2,2,
+  33,36,1,240,245,35,2,2,2,2,2,2,45,31,31,31,122,130,39,233,233,15,142,169,
+  1,0,42,45,2,22,33,9,4,5,10,5,4,233,165,1,172,150,1,158,22,1,1,1,
+  1,245,169,212,3,42,243,8,137,1,249,207,14,122,172,204,14,254,5,173,164,14,161,35,
+  178,199,14,185,147,14,28,156,147,14,247,5,1,246,176,200,10,192,5,173,25,139,4,231,
+  202,15,232,232,15,177,18,57,199,200,14,1,4,5,136,196,14,137,202,14,250,32,0,42,
+  179,12,7,11,4,145,31,215,1,4,100,166,224,14,2,167,6,163,224,14,234,243,6,5,
+  66,0,254,50,57,8,15,2,90,7,12,19,12,15,36,27,20,87,56,0,254,22,84,7,
+  12,19,12,15,36,27,20,87,7,56,8,232,236,7,161,215,14,0,32,50,132,228,14,247,
+  18,189,195,14,158,200,14,28,242,15,207,11,131,207,14,245,6,218,3,51,246,38,134,255,
+  6,2,55,1,11,129,4,1,4,6,4,2,2,2,4,2,3,6,2,23,6,1,11,134,
+  76,5,12,3,3,6,7,33,2,144,165,7,179,211,14,140,57,156,153,14,129,1,226,1,
+  1,246,174,175,196,14,2,2,2,2,2,2,2,2,2,218,17,233,38,164,24,218,14,155,
+  39,0,0,63,192,136,1,184,17,177,154,1,202,207,15,82,218,21,157,23,1,171,192,14,
+  136,197,14,58,235,187,14,194,193,14,194,1,187,192,14,1,243,8,164,24,203,171,14,1,
+  87,249,27,2,138,186,14,12,159,158,14,200,141,14,2,2,193,141,14,136,152,14,29,0,
+  34,54,184,225,14,167,2,201,13,185,192,14,3,13,2,2,2,2,2,2,170,179,14,178,
+  26,215,230,14,1,241,230,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,241,
+  246,2,2,2,2,2,2,2,2,2,161,197,15,200,162,5,3,1,4,21,0,169,55,4,
+  9,5,32,13,19,28,11,20,25,30,35,34,15,20,0,169,54,14,1,17,26,1,64,23,
+  17,4,5,10,1,11,8,5,1,246,12,233,9,179,206,7,187,251,6,130,23,2,180,191,
+  14,213,172,14,2,133,31,226,202,14,146,5,215,221,15,178,166,1,217,8,222,8,0,43,
+  65,12,199,6,4,184,18,149,56,206,63,223,20,249,4,194,17,136,158,14,137,202,14,137,
+  11,43,242,55,198,157,14,0,43,254,201,23,171,19,231,3,136,213,14,1,169,205,14,160,
+  2,171,10,186,213,14,235,3,226,19,165,238,7,136,214,7,159,159,14,2,0,43,182,3,
+  6,3,5,2,204,158,14,1,220,23,242,8,1,157,22,159,207,14,212,55,237,25,222,17,
+  0,46,0,199,17,187,27,252,2,176,24,191,6,255,23,186,56,241,25,157,26,136,52,159,
+  190,1,224,140,1,1,1,180,41,0,48,11,181,26,242,18,151,56,252,38,187,1,152,200,
+  14,251,225,14,152,11,164,24,177,25,212,216,14,89,76,235,24,191,157,14,0,34,202,150,
+  11,228,215,14,106,203,207,14,217,158,1,236,141,1,2,3,222,41,141,25,243,19,254,226,
+  14,199,181,14,155,56,158,213,14,1,245,105,2,254,1,151,214,15,144,141,1,2,3,232,
+  42,163,56,160,56,143,19,4,7,238,17,193,45,194,228,14,1,245,237,182,22,4,233,173,
+  14,149,8,149,45,158,28,192,198,14,153,181,14,207,41,172,49,149,26,166,26,161,26,170,
+  26,3,0,41,217,151,145,1,158,206,15,141,165,15,4,156,92,245,14,166,27,131,165,1,
+  166,209,15,201,181,14,158,6,153,36,120,175,1,62,0,42,61,213,34,198,31,166,7,8,
+  147,8,100,132,201,14,159,232,14,244,29,183,29,254,37,2,249,7,195,29,242,28,0,33,
+  180,186,29,171,28,182,216,14,215,217,14,192,217,14,187,217,14,180,217,14,168,2,169,189,
+  14,154,187,14,31,205,217,14,16,228,29,1,0,43,14,2,173,36,196,28,158,190,14,167,
+  180,14,21,174,180,14,197,1,183,217,14,31,234,28,239,28,232,28,50,29,1,248,54,234,
+  1,140,9,201,228,14,186,30,8,27,15,171,30,206,30,8,15,17,15,165,30,140,218,14,
+  1,248,66,202,1,209,218,14,105,250,37,190,181,14,237,8,200,7,47,185,217,14,140,219,
+  14,33,223,180,14,64,31,240,178,14,0,43,124,228,178,14,141,178,14,3,130,178,14,7,
+  32,139,179,14,52,213,38,232,28,221,29,202,29,7,42,4,0,41,23,174,11,219,11,32,
+  229,29,150,1,16,204,218,14,145,16,229,198,15,138,208,15,143,210,14,1,123,176,48,192,
+  177,14,1,245,109,131,177,14,10,224,168,14,236,22,164,6,207,16,246,13,185,16,247,8,
+  180,13,206,8,145,222,7,2,9,3,1,1,153,227,128,7,6,4,52,2,69,20,38,59,
+  10,15,26,54,49,34,0,33,131,57,1,64,55,50,63,18,19,236,128,7,9,12,15,6,
+  4,7,1,244,19,179,3,248,2,245,202,14,218,24,3,208,17,4,252,163,14,252,10,203,
+  20,9,2,2,4,1,1,246,163,203,215,14,152,204,14,169,167,14,230,145,7,5,1,10,
+  15,12,1,5,1,52,2,2,1,14,126,9,17,5,18,19,18,10,17,2,12,17,16,17,
+  9,4,1,14,116,19,18,137,222,7,4,5,133,1,2,60,65,84,9,44,2,97,94,0,
+  22,209,26,5,53,40,35,60,19,63,29,13,174,1,2,3,1,1,0,22,181,6,1,26,
+  17,1,92,21,1,10,63,12,7,92,121,3,0,22,218,41,17,56,87,116,29,49,31,2,
+  2,134,1,59,87,108,45,0,22,233,111,130,1,87,26,43,56,51,35,62,8,46,55,1,
+  54,125,0,22,207,89,1,8,40,98,139,1,1,86,60,1,8,168,243,14,11,169,204,14,
+  156,45,0,43,244,2,4,2,9,205,8,214,192,14,121,211,205,14,202,2,130,178,14,152,
+  25,221,206,14,156,211,14,213,202,15,107,0,8,5,7,4,26,27,26,15,5,12,2,2,
+  2,10,2,2,11,0,8,21,25,18,15,5,38,4,9,2,44,41,4,28,7,26,2,0,
+  8,62,3,15,1,8,13,18,7,16,3,1,3,41,5,5,26,0,8,34,5,5,26,5,
+  10,19,5,14,14,9,134,197,15,229,11,1,4,4,1,249,123,149,10,157,8,185,186,14,
+  224,137,4,52,20,5,1,10,15,12,1,5,1,3,0,168,207,153,1,2,22,6,46,2,
+  35,2,22,9,2,10,47,2,14,0,168,149,58,91,2,40,2,15,2,52,12,17,9,29,
+  20,9,23,0,168,144,44,2,10,10,3,2,29,2,11,2,45,2,78,71,2,0,168,136,
+  2,68,85,138,1,1,133,1,104,22,6,9,2,17,2,20,2,0,168,184,2,6,2,5,
+  2,180,195,10,187,23,193,180,14,154,205,14,239,23,177,1,196,13,156,10,229,204,14,204,
+  189,14,1,250,155,221,229,14,8,2,75,10,4,66,53,6,170,213,14,129,213,14,73,18,
+  66,208,206,14,0,33,8,202,226,14,229,19,156,18,193,226,15,218,137,1,188,35,172,169,
+  14,173,12,187,192,14,202,227,14,5,1,10,15,12,1,251,246,5,1,3,249,10,239,227,
+  15,238,167,1,239,13,130,21,226,180,14,151,224,14,202,244,6,145,222,6,203,18,150,226,
+  14,207,207,14,0,39,77,93,36,208,200,14,255,204,14,222,174,7,44,47,38,5,1,10,
+  15,12,1,5,1,17,210,3,19,40,27,32,177,1,2,20,4,46,2,35,2,22,9,1,
+  17,158,10,43,12,2,60,89,2,36,2,15,2,52,2,7,9,1,17,149,20,9,21,44,
+  2,10,12,3,2,31,2,11,2,41,2,1,17,174,69,2,5,2,64,52,10,42,2,45,
+  141,1,128,1,129,1,158,1,25,1,17,202,34,47,5,123,150,1,3,47,20,4,5,15,
+  2,18,32,47,1,17,183,6,2,5,2,158,159,7,193,24,251,187,7,16,7,26,3,8,
+  39,30,57,1,4,87,8,68,25,17,40,79,18,14,19,74,23,23,9,29,36,1,4,96,
+  10,20,10,4,23,22,8,25,55,60,49,2,16,19,5,1,4,115,43,10,18,37,78,63,
+  228,190,7,160,11,239,191,14,242,190,14,154,10,157,24,218,14,10,133,174,14,0,43,95,
+  255,1,16,17,179,6,148,8,219,1,18,1,144,162,14,157,219,1,2,3,6,160,247,1,
+  235,219,14,1,246,191,162,11,177,1,169,189,14,192,175,7,2,12,145,1,2,20,160,1,
+  155,1,46,2,35,2,1,21,159,9,2,10,43,12,2,58,87,2,36,2,15,2,52,5,
+  1,21,161,29,20,9,21,44,2,10,10,3,2,29,2,116,127,2,1,21,217,2,171,1,
+  2,74,67,2,5,2,64,62,2,2,14,2,14,1,21,213,2,9,4,13,2,2,12,17,
+  1,16,25,1,13,1,8,1,21,193,3,1,29,20,70,2,67,5,15,2,18,15,2,2,
+  2,1,245,161,13,2,10,1,13,2,10,244,13,193,123,3,6,3,8,1,209,4,1,217,
+  15,1,186,4,1,4,188,1,5,241,1,1,6,1,49,1,16,11,14,1,217,250,2,2,
+  7,2,110,120,167,1,1,12,33,1,1,60,7,4,1,218,37,8,3,11,4,1,5,2,
+  3,15,10,3,9,2,10,4,1,218,7,2,2,164,2,2,2,2,2,65,193,5,3,8,
+  1,3,168,5,187,1,1,218,17,4,234,1,251,5,1,1,198,5,203,7,255,1,198,2,
+  61,116,1,100,1,1,1,216,163,7,1,15,124,1,1,73,12,121,233,1,12,12,4,182,
+  2,157,2,1,216,165,59,207,1,184,2,51,25,116,14,27,43,149,1,57,192,2,37,2,
+  221,1,1,216,105,3,12,51,2,163,1,252,2,88,2,57,189,1,9,8,4,7,10,1,
+  216,111,12,142,1,38,181,1,158,2,241,2,244,2,135,4,12,46,37,2,2,16,36,1,
+  216,14,4,34,23,6,58,55,50,55,2,58,13,4,1,246,1,157,2,1,216,51,65,34,
+  130,2,165,2,234,1,10,2,215,1,3,66,1,55,14,40,41,1,216,43,1,5,59,226,
+  2,253,1,1,226,2,221,2,9,224,2,2,4,9,1,4,1,216,67,35,214,2,12,1,
+  4,5,1,1,149,3,36,1,232,1,19,6,1,1,216,143,34,7,9,6,1,13,235,1,
+  208,2,16,7,10,149,2,1,1,13,1,216,56,3,11,182,2,9,6,59,24,13,8,2,
+  2,13,18,19,142,1,1,216,251,157,3,160,3,2,5,7,24,5,11,1,1,20,241,3,
+  150,2,218,1,3,1,216,90,2,29,8,3,18,4,1,11,27,2,4,2,3,44,29,1,
+  216,81,3,30,8,2,2,5,8,11,2,5,64,79,19,141,1,174,3,1,216,166,59,10,
+  104,94,1,1,33,40,205,1,48,9,3,84,24,157,1,1,216,123,12,9,6,80,10,91,
+  12,7,6,47,1,168,1,1,4,54,1,216,217,1,27,33,131,1,65,165,1,164,2,55,
+  114,111,3,142,6,14,1,3,1,218,4,5,2,3,236,1,2,2,2,2,2,2,2,81,
+  2,3,96,1,218,132,5,10,1,5,3,1,131,1,1,1,54,41,4,1,22,2,1,218,
+  79,21,2,4,2,2,2,2,2,11,15,4,1,34,2,2,1,218,88,1,255,3,2,3,
+  1,20,2,3,1,12,2,3,1,11,2,1,217,90,1,166,2,5,4,5,4,5,231,1,
+  14,1,1,1,1,1,1,1,217,110,214,1,65,1,32,1,34,2,3,1,209,1,2,5,
+  2,146,2,1,1,217,41,162,2,4,5,4,28,1,6,1,32,158,2,209,2,3,2,3,
+  36,1,217,205,2,3,30,181,1,1,1,200,1,245,1,2,3,1,8,16,2,5,1,217,
+  112,164,1,1,32,1,28,1,1,40,1,227,1,1,1,173,1,6,3,1,217,38,9,2,
+  2,134,3,3,2,3,209,2,1,1,24,1,1,1,1,1,217,63,3,1,4,5,15,182,
+  1,2,3,1,66,13,55,2,3,1,1,217,159,27,1,34,1,221,1,2,5,2,132,3,
+  1,145,3,140,2,13,37,1,1,217,146,172,3,241,2,13,33,1,1,6,155,1,1,1,
+  186,1,241,1,2,3,1,1,217,46,16,2,5,2,204,1,1,1,10,1,1,52,1,1,
+  7,13,1,217,238,1,203,2,1,1,202,4,111,1,6,1,176,1,60,2,2,2,2,1,
+  218,174,2,27,2,2,2,2,2,2,2,141,3,55,30,24,55,30,1,217,223,55,30,91,
+  30,13,17,30,13,17,30,13,173,2,1,1,240,5,1,218,110,1,8,161,5,15,3,8,
+  1,3,19,1,1,20,1,154,5,12,1,218,98,6,2,5,2,109,4,1,100,1,3,5,
+  8,9,4,2,1,218,116,1,1,213,5,1,1,252,1,1,1,10,1,1,6,103,1,4,
+  1,217,80,1,1,1,1,1,12,200,4,11,158,110,187,173,14,1,101,100,1,187,33,0,
+  32,27,60,61,64,220,198,7,5,1,10,15,12,1,5,1,30,5,1,1,17,242,2,2,
+  7,1,9,4,1,201,145,8,4,1,24,70,43,30,11,0,13,156,12,15,52,13,11,36,
+  69,33,112,23,36,97,1,106,3,0,13,138,12,1,1,1,7,42,50,43,30,11,25,12,
+  15,52,13,0,13,168,32,26,51,46,89,1,78,15,13,25,14,3,2,56,105,0,13,139,
+  106,11,104,5,1,10,15,12,1,5,1,3,28,83,143,1,0,13,129,4,152,1,4,66,
+  2,63,14,7,4,14,29,4,4,14,3,0,13,220,2,2,192,101,15,174,194,14,187,10,
+  209,212,14,232,28,254,190,14,243,12,143,179,14,146,182,14,191,185,14,144,206,14,163,188,
+  14,0,42,152,5,4,134,3,4,174,236,3,136,194,10,85,175,2,159,6,140,6,233,2,
+  191,8,216,11,2,157,204,14,0,42,88,1,178,165,14,234,23,247,10,145,226,7,2,176,
+  219,7,199,219,7,9,54,187,241,6,226,3,3,218,237,6,189,241,6,0,34,247,5,200,
+  237,6,28,29,9,38,3,35,20,3,8,14,9,178,219,7,155,219,7,0,254,98,23,36,
+  23,3,8,205,243,6,6,4,15,20,21,10,15,26,4,0,33,118,1,8,13,18,19,198,
+  243,6,239,237,7,190,161,8,179,131,7,146,1,4,241,1,159,28,176,204,14,1,1,246,
+  7,12,9,9,4,1,4,8,198,12,134,1,195,13,200,13,197,13,186,2,191,10,2,1,
+  249,39,165,21,35,251,177,14,129,5,130,3,13,210,204,14,241,228,15,242,202,15,140,9,
+  196,14,243,214,14,236,174,7,2,5,1,15,70,12,2,2,2,2,13,3,3,41,26,23,
+  36,33,2,6,1,15,56,2,22,19,2,6,4,1,5,10,2,27,6,3,56,6,1,15,
+  82,2,8,4,1,5,2,168,156,7,2,247,216,15,142,167,1,235,36,184,209,14,199,144,
+  7,5,1,1,16,249,15,12,1,5,1,3,27,31,2,2,30,8,35,18,12,1,16,224,
+  1,13,32,35,6,3,20,10,21,4,25,2,40,21,4,0,33,23,130,2,162,30,8,245,
+  28,230,28,202,7,227,36,150,210,14,31,16,246,7,219,179,14,32,235,1,209,37,0,41,
+  42,7,202,7,227,36,144,210,14,31,16,252,7,219,179,14,32,235,1,136,190,7,1,6,
+  1,26,1,26,143,3,5,2,14,3,3,3,10,6,1,10,16,1,1,71,1,26,80,68,
+  2,35,2,22,9,2,10,18,49,2,70,61,2,15,1,26,93,76,11,17,9,29,20,9,
+  22,2,22,10,3,2,41,2,1,26,117,2,31,2,46,5,3,1,72,2,3,1,7,35,
+  2,36,1,26,153,16,2,141,1,7,2,7,5,8,2,5,1,16,1,241,232,8,250,204,
+  15,0,39,71,61,220,181,14,232,6,131,5,1,4,2,178,3,237,4,240,7,217,215,14,
+  214,5,252,29,2,172,175,14,1,245,120,182,1,1,239,6,152,2,174,21,15,225,2,253,
+  21,220,1,167,129,14,183,3,254,2,255,2,3,2,0,51,115,139,1,142,1,111,21,26,
+  138,2,157,2,164,2,123,233,67,226,68,2,79,14,7,0,51,199,143,1,213,67,188,67,
+  155,1,200,2,197,2,214,249,13,241,247,13,63,4,1,163,1,59,230,1,6,0,50,255,
+  250,1,2,223,2,116,113,150,3,151,63,210,12,146,52,223,3,1,242,1,24,133,2,2,
+  0,51,19,178,2,167,2,2,224,2,2,191,2,24,6,217,1,232,252,13,129,251,13,6,
+  1,148,2,179,1,0,51,50,2,4,182,1,129,68,4,166,1,208,67,143,3,2,234,1,
+  140,1,119,241,1,2,2,0,51,133,8,217,1,230,1,4,249,1,2,2,2,236,2,105,
+  12,96,79,7,135,2,0,51,29,154,2,74,231,2,1,188,2,12,215,2,137,33,134,36,
+  2,2,129,67,132,67,91,56,0,51,167,2,13,59,123,3,2,6,1,128,1,156,1,141,
+  2,3,2,132,1,8,0,51,72,154,2,151,2,2,152,1,12,14,7,110,85,16,97,20,
+  2,16,12,0,51,178,8,12,9,4,8,4,123,177,1,198,1,30,225,1,144,2,8,12,
+  227,2,0,51,10,243,65,4,166,1,160,66,104,81,169,1,2,148,1,117,5,4,5,166,
+  1,154,1,0,51,46,4,1,210,2,181,2,6,223,29,146,32,2,83,8,12,25,2,2,
+  179,1,0,51,86,143,34,136,34,1,237,68,242,68,2,105,2,4,2,3,244,2,2,244,
+  142,14,131,144,14,0,51,39,65,176,3,141,2,140,2,147,35,229,4,237,16,9,134,1,
+  220,20,213,20,135,1,132,1,212,20,209,20,0,37,167,218,21,215,21,5,210,54,2,2,
+  147,38,198,161,14,2,6,49,8,12,4,7,1,242,57,77,56,12,29,42,43,29,4,11,
+  54,29,25,66,19,16,1,242,40,25,8,11,60,1,1,29,23,16,44,11,2,35,21,26,
+  1,242,48,9,32,211,2,2,225,187,14,252,187,14,179,159,14,182,159,14,231,141,14,228,
+  141,14,21,38,2,2,187,1,1,241,148,254,1,35,2,133,173,14,226,169,14,2,2,2,
+  2,2,2,2,2,2,2,1,241,59,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  184,1,0,39,206,2,180,167,14,147,188,14,216,186,14,148,1,2,2,26,139,188,14,224,
+  186,14,147,158,14,205,11,222,169,14,160,1,10,1,241,170,13,183,159,14,162,159,14,159,
+  159,14,138,158,14,156,1,245,187,14,132,188,14,9,28,35,38,35,149,1,207,166,14,1,
+  249,145,227,22,147,181,14,10,210,187,14,148,17,197,206,14,157,15,140,19,181,17,200,36,
+  2,188,170,14,151,2,138,2,203,12,0,46,60,252,176,14,150,5,4,2,3,6,209,23,
+  221,199,14,188,195,14,213,195,14,222,189,14,211,176,14,139,19,236,196,14,128,23,1,246,
+  211,149,217,14,8,13,1,18,3,3,15,18,8,13,1,5,1,3,0,41,121,184,5,3,
+  161,33,142,33,7,12,7,129,33,250,32,241,32,230,32,8,3,135,33,250,32,0,42,180,
+  12,7,11,4,145,31,215,1,4,100,132,4,1,178,25,131,16,248,2,178,177,14,199,221,
+  14,0,27,161,2,2,18,2,22,5,1,10,15,12,1,5,1,3,89,0,27,134,36,74,
+  93,10,21,2,26,80,2,101,40,55,22,9,72,0,27,156,64,69,9,13,8,19,28,19,
+  32,64,57,34,57,25,36,0,27,157,4,9,19,238,4,7,6,1,1,5,2,3,171,4,
+  81,2,3,0,27,171,5,3,6,9,6,3,172,222,14,107,1,6,226,26,255,228,14,8,
+  13,1,0,32,113,28,3,3,3,255,126,130,127,8,13,1,133,127,1,252,126,150,36,178,
+  5,4,0,42,216,1,167,33,142,33,7,12,7,129,33,250,32,241,32,252,20,234,11,8,
+  3,242,187,14,147,222,14,1,243,196,193,1,248,12,134,12,217,12,213,10,237,205,14,218,
+  158,4,56,1,27,1,14,1,10,1,0,168,4,12,1,50,65,28,1,11,1,48,3,9,
+  37,42,1,10,0,168,32,2,23,1,5,1,25,74,2,2,2,2,65,17,8,58,0,168,
+  38,3,6,3,189,144,4,4,1,34,21,6,34,8,33,5,4,1,0,36,25,43,2,38,
+  35,44,2,31,34,39,2,246,196,14,223,196,14,30,71,60,0,33,79,128,11,1,36,61,
+  2,48,24,31,130,30,239,29,39,183,3,188,200,14,251,184,15,118,0,7,6,2,6,94,
+  1,111,122,2,4,101,1,1,94,2,2,109,0,7,16,4,6,2,30,1,33,2,6,6,
+  10,2,140,5,9,14,2,0,8,96,8,2,5,10,6,13,131,5,2,8,14,4,1,9,
+  3,6,0,7,40,9,16,72,1,1,119,54,33,2,7,10,2,9,96,3,0,7,72,47,
+  2,2,30,21,2,22,5,117,10,13,2,10,13,136,1,0,7,70,5,2,33,2,2,168,
+  181,15,154,20,129,21,131,2,201,2,240,179,96,2,6,104,71,14,0,44,40,15,5,1,
+  10,15,12,1,5,1,3,23,50,55,26,14,0,96,67,33,40,2,2,2,2,2,2,2,
+  2,2,2,2,2,14,0,78,2,2,2,2,2,2,2,2,2,2,2,2,14,2,2,14,
+  0,100,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,14,0,116,2,2,2,2,
+  2,2,2,165,1,102,61,70,119,4,12,40,14,0,34,116,66,167,1,104,67,23,29,188,
+  1,3,247,165,111,62,41,5,5,26,0,23,1,4,22,5,5,5,8,8,6,19,7,26,
+  5,18,1,3,0,23,19,154,1,20,5,5,5,4,22,5,5,5,8,14,19,7,26,0,
+  23,108,12,2,224,7,20,1,1,11,2,19,4,12,39,32,15,6,0,25,98,31,46,1,
+  29,2,10,21,4,2,50,2,2,2,2,65,0,25,97,12,6,25,23,8,212,4,67,7,
+  4,7,6,4,11,1,18,0,26,136,5,1,10,15,12,1,5,1,3,105,39,15,68,6,
+  89,0,26,40,36,30,81,2,2,44,2,21,52,3,2,41,2,26,26,0,26,78,21,32,
+  17,65,4,34,32,81,4,1,46,4,25,11,20,0,26,53,20,10,11,15,31,12,76,33,
+  31,7,42,26,2,21,208,1,0,26,165,14,15,8,2,11,87,2,2,6,15,55,70,88,
+  89,88,0,26,96,148,1,2,17,89,2,84,2,17,5,1,10,15,12,1,5,0,26,146,
+  3,93,4,24,4,5,17,2,7,18,16,13,8,5,17,0,26,114,17,3,6,3,230,192,
+  4,27,3,16,28,51,76,79,3,3,80,0,170,163,51,32,15,60,31,3,20,47,16,3,
+  44,11,21,27,3,0,170,146,28,51,76,79,3,3,80,11,51,32,15,60,31,3,20,0,
+  170,142,16,3,44,11,24,14,78,2,7,2,2,59,2,4,1,0,170,177,26,1,3,2,
+  13,5,12,3,3,12,13,12,208,186,10,207,138,7,30,1,22,197,1,10,15,12,1,5,
+  1,3,127,2,12,98,93,46,2,1,22,143,2,22,9,2,10,43,12,2,56,77,2,28,
+  2,15,2,1,22,165,5,9,29,20,9,21,44,2,10,12,3,1,27,2,11,1,22,149,
+  33,2,66,5,16,24,1,19,2,12,4,5,7,2,10,1,22,176,2,142,243,5,1,186,
+  157,1,209,235,6,229,207,8,65,64,230,207,8,237,207,8,6,15,5,1,10,0,11,231,
+  12,1,5,1,3,254,207,8,33,15,19,26,21,26,2,33,30,1,31,201,2,13,16,11,
+  9,16,3,26,9,13,12,66,15,193,209,8,2,0,11,144,8,12,23,2,84,99,2,40,
+  13,58,2,2,11,11,29,0,11,163,12,21,23,2,46,12,2,14,3,2,37,9,43,2,
+  86,0,11,175,138,1,5,2,16,19,63,222,208,8,139,208,8,220,207,8,31,169,209,8,
+  168,209,8,14,5,16,1,31,220,40,45,7,24,5,5,8,13,50,33,6,171,208,8,147,
+  1,210,209,8,6,1,31,237,9,2,213,208,8,20,8,11,2,15,2,20,2,19,2,196,
+  208,8,221,207,8,1,243,139,129,1,131,162,4,5,1,10,15,12,1,5,1,3,149,1,
+  2,38,2,1,106,139,5,33,5,108,22,16,23,22,125,2,2,5,126,85,36,1,106,183,
+  19,4,18,109,2,2,5,64,2,26,57,52,27,2,2,1,106,156,32,17,32,21,109,2,
+  2,5,110,4,18,27,32,65,1,1,106,176,18,5,97,30,4,2,3,15,2,22,2,2,
+  5,17,5,1,106,134,2,5,21,2,2,5,92,40,41,50,132,117,2,2,2,2,1,136,
+  5,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,136,21,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,136,37,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,136,53,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,136,
+  69,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,136,85,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,136,101,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,136,117,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,136,
+  133,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,136,149,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,136,165,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,136,181,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,136,
+  197,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,136,213,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,136,229,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,136,245,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,137,
+  5,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,137,21,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,137,37,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,137,53,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,137,
+  69,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,137,85,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,137,101,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,137,117,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,137,
+  133,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,137,149,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,137,165,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,137,181,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,137,
+  197,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,137,213,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,137,229,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,137,245,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,138,
+  5,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,138,21,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,138,37,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,138,53,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,138,
+  69,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,138,85,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,138,101,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,138,117,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,138,
+  133,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,138,149,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,138,165,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,138,181,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,138,
+  197,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,138,213,2,2,2,2,2,
+  2,2,2,2,2,2,2,2,2,2,1,138,229,2,2,2,2,2,2,2,2,2,2,2,
+  2,2,2,2,1,138,245,2,2,2,2,2,2,2,2,2,2,189,108,154,151,4,203,186,
+  14,251,2,152,193,14,1,243,117,194,29,159,24,151,180,14,253,1,250,202,14,227,203,14,
+  244,185,14,195,2,188,2,205,201,14,231,7,152,208,14,101,199,162,15,48,0,12,107,1,
+  10,15,12,1,5,1,3,44,5,10,5,4,5,3,0,12,85,159,1,2,20,8,48,2,
+  37,2,22,9,2,10,100,149,1,2,0,12,23,2,66,99,2,40,2,15,2,56,2,2,
+  11,11,106,135,1,0,12,35,9,23,2,46,2,10,2,82,67,3,2,37,2,102,113,0,
+  12,32,45,2,86,81,170,1,171,1,170,1,97,89,118,119,6,7,120,118,0,12,127,99,
+  147,1,118,20,8,11,2,15,2,20,2,19,2,64,2,0,12,67,2,232,81,140,204,14,
+  135,179,14,224,203,14,209,154,1,79,112,137,1,5,52,41,15,54,56,1,211,38,82,1,
+  8,51,69,18,37,122,75,37,112,26,47,26,113,1,211,67,69,7,76,35,33,40,14,32,
+  12,51,59,124,157,1,72,5,1,211,63,31,6,24,30,109,7,104,81,37,58,92,79,15,
+  54,13,1,211,8,150,1,139,1,46,32,65,46,43,12,36,33,38,14,44,11,14,1,211,
+  49,15,36,7,63,90,101,211,173,14,1,12,5,8,9,11,53,5,0,7,151,16,27,11,
+  1,8,42,39,29,50,5,31,40,25,15,8,0,7,177,93,38,30,65,54,27,29,56,19,
+  13,30,10,15,31,58,0,7,148,16,19,30,28,1,5,10,11,224,26,127,35,4,1,6,
+  4,0,14,20,18,4,96,71,6,87,6,3,2,4,170,1,179,1,136,1,49,13,0,14,
+  38,74,5,45,48,2,5,1,73,51,140,1,115,12,40,4,22,0,14,30,3,8,9,16,
+  2,24,4,30,6,1,31,26,23,2,26,0,14,56,3,2,4,31,1,57,62,68,117,2,
+  10,13,16,3,13,0,14,21,36,78,87,41,100,50,5,1,10,15,12,1,5,1,3,0,
+  34,4,1,98,230,30,244,164,14,128,18,14,189,222,14,150,228,14,106,214,4,141,23,136,
+  4,245,172,14,235,10,211,29,0,43,49,163,18,1,146,188,14,182,8,187,7,2,2,2,
+  225,207,14,234,207,14,143,185,14,240,15,3,1,235,15,0,43,154,194,10,237,56,148,209,
+  14,1,137,182,14,255,2,223,91,2,3,214,2,3,2,4,181,2,5,0,15,36,26,5,
+  1,10,15,12,1,5,1,16,19,15,12,1,5,0,15,34,3,188,2,2,189,1,16,35,
+  2,35,2,22,9,2,10,18,2,0,15,106,79,2,72,63,13,2,84,3,11,21,9,29,
+  20,9,22,0,15,85,26,20,11,3,2,43,2,18,2,31,2,36,8,3,1,0,15,21,
+  2,78,1,99,84,184,2,141,3,90,69,25,100,184,2,157,3,14,16,0,15,3,1,1,
+  116,1,148,1,158,1,157,3,14,156,3,15,183,2,4,81,136,3,131,3,0,15,133,229,
+  1,1,17,10,154,3,193,2,83,15,134,2,2,2,7,3,141,1,148,1,0,15,130,207,
+  1,2,2,6,3,2,226,2,1,159,1,2,8,8,145,1,228,1,16,0,15,166,2,35,
+  2,22,9,2,10,18,2,32,3,2,81,2,72,0,15,151,13,2,80,11,21,9,29,20,
+  9,22,2,26,8,3,2,0,15,159,2,18,2,31,2,36,8,3,1,61,3,2,155,2,
+  136,3,10,0,15,204,1,1,7,4,5,4,171,1,18,2,17,2,18,2,6,2,0,15,
+  116,2,6,2,5,2,232,144,15,155,167,14,196,14,103,26,45,23,94,25,13,0,45,66,
+  7,16,22,17,8,55,40,37,2,88,77,4,2,3,8,0,45,51,70,67,24,6,25,14,
+  16,11,28,2,2,6,21,26,2,0,45,89,4,1,4,2,4,2,2,2,2,49,54,2,
+  85,28,60,0,45,83,56,2,170,154,14,84,211,179,14,141,155,1,252,134,1,154,36,173,
+  7,240,3,2,230,14,2,7,209,40,0,41,212,2,82,248,132,7,226,171,7,201,133,7,
+  139,1,176,1,5,1,10,15,12,1,5,1,1,20,208,21,135,1,2,20,4,46,2,35,
+  2,22,9,2,10,43,12,1,20,146,58,87,2,36,2,15,2,52,5,9,29,20,9,21,
+  44,1,20,164,10,10,3,2,29,2,11,2,41,2,74,67,2,5,2,1,20,168,62,13,
+  8,9,8,1,1,33,22,6,9,15,2,20,3,1,20,189,19,2,6,2,5,2,199,153,
+  7,143,56,230,217,14,129,3,237,10,128,4,214,22,113,220,3,0,41,58,6,1,187,21,
+  216,31,211,34,242,44,2,65,224,149,14,153,194,14,25,166,44,139,41,253,2,29,0,46,
+  35,221,41,88,250,196,14,183,11,2,10,7,4,6,15,8,4,183,4,243,183,14,250,253,
+  13,1,226,171,51,54,9,4,13,4,19,13,38,4,37,18,6,4,11,1,226,148,24,19,
+  2,2,36,51,30,11,13,38,17,1,38,136,76,212,3,0,33,34,200,213,14,8,2,231,
+  170,14,247,3,161,4,248,179,14,241,179,14,3,219,8,243,29,140,218,14,177,7,229,209,
+  14,168,211,14,0,38,55,9,3,2,10,5,4,1,132,19,170,13,197,15,2,247,32,150,
+  35,1,247,3,0,32,52,142,43,223,34,210,34,231,5,171,27,150,33,174,187,14,251,12,
+  143,11,153,1,206,2,239,197,14,238,36,182,159,14,151,204,14,1,243,55,152,24,128,1,
+  145,227,14,162,2,174,33,192,8,239,19,175,22,128,52,12,217,50,1,193,1,218,212,14,
+  3,0,35,25,236,201,14,155,209,14,2,4,226,51,205,51,146,212,14,3,151,190,14,178,
+  181,14,209,179,14,142,183,14,221,210,14,190,213,14,245,172,14,0,32,37,106,160,55,214,
+  153,14,255,168,14,2,153,2,124,2,200,169,14,252,5,249,5,229,152,14,178,213,6,37,
+  2,1,3,132,22,25,46,39,6,38,31,15,20,2,4,8,4,2,3,1,3,146,11,34,
+  39,30,4,4,43,8,5,20,28,185,246,6,222,3,185,3,252,191,14,0,43,209,163,46,
+  154,13,240,215,14,179,221,14,188,32,3,8,9,7,2,240,6,143,22,122,156,12,243,26,
+  0,35,36,170,34,207,9,7,1,6,243,30,38,202,37,239,36,136,218,14,231,179,14,227,
+  37,150,30,155,26,149,1,0,39,223,144,188,14,1,215,6,220,6,215,6,157,189,14,2,
+  248,213,14,44,52,99,205,209,14,134,210,14,135,216,14,162,216,14,0,37,224,228,214,14,
+  239,214,14,232,214,14,97,4,4,5,5,10,13,6,3,5,2,135,206,14,0,35,176,216,
+  8,248,214,14,191,214,14,200,214,14,143,216,14,220,215,14,95,2,34,4,7,23,30,3,
+  29,1,251,103,35,137,208,14,189,14,190,13,229,4,196,189,14,217,183,14,142,209,14,191,
+  214,14,200,214,14,45,5,4,47,211,20,0,46,21,135,50,206,232,14,165,232,14,64,154,
+  29,231,28,238,216,14,151,188,14,128,188,14,7,168,2,143,2,31,161,217,14,2,0,43,
+  6,134,2,232,178,14,183,217,14,31,200,217,14,141,187,14,21,5,15,177,30,186,30,15,
+  171,30,142,218,14,7,0,33,200,208,24,250,185,14,200,7,47,176,1,223,180,14,64,31,
+  240,178,14,219,178,14,228,178,14,149,178,14,2,132,178,14,7,1,248,49,139,179,14,52,
+  245,9,213,29,212,30,200,10,139,40,6,156,39,153,39,2,2,208,218,14,205,218,14,2,
+  0,38,69,144,255,3,54,5,1,10,15,12,1,5,1,3,35,2,139,3,2,0,165,82,
+  176,2,197,3,148,1,176,2,197,3,74,174,2,149,1,74,223,1,174,2,149,1,74,109,
+  178,2,0,165,26,74,176,2,151,1,74,159,1,178,2,201,3,144,1,178,2,201,3,154,
+  1,178,2,201,3,74,176,2,0,165,130,74,227,1,176,2,151,1,74,217,1,176,2,151,
+  1,74,110,193,3,2,194,3,147,2,178,2,0,165,12,74,176,2,151,1,74,105,43,176,
+  2,199,3,202,3,255,2,174,2,2,151,1,74,202,1,0,165,32,206,3,131,3,176,2,
+  151,1,74,211,1,2,174,2,195,3,198,3,253,2,2,172,2,2,149,1,0,165,151,2,
+  231,1,2,132,1,178,2,201,3,74,176,2,151,1,74,141,1,2,176,2,201,3,74,0,
+  165,219,151,1,117,2,174,2,197,3,200,3,253,2,174,2,149,1,74,42,171,1,178,2,
+  201,3,244,3,0,165,55,176,2,151,1,74,115,53,176,2,197,3,74,174,2,149,1,74,
+  212,1,205,3,106,176,2,0,165,10,74,174,2,149,1,74,179,1,176,2,151,1,74,143,
+  1,27,178,2,201,3,74,176,2,178,1,0,166,16,2,50,47,151,2,74,188,1,205,3,
+  210,3,255,2,176,2,237,1,176,2,201,3,204,3,129,3,0,165,220,151,1,74,14,233,
+  1,66,178,2,201,3,74,176,2,151,1,74,90,151,1,74,143,1,0,166,10,205,3,74,
+  176,2,151,1,74,2,2,147,1,2,67,176,2,197,3,74,174,2,149,1,0,165,155,119,
+  178,2,201,3,74,176,2,151,1,74,141,1,178,2,201,3,154,1,178,2,201,3,74,176,
+  2,0,165,136,74,227,1,176,2,151,1,74,163,1,178,2,201,3,154,1,178,2,201,3,
+  74,176,2,151,1,74,0,165,51,176,2,151,1,74,29,2,121,178,2,201,3,74,176,2,
+  151,1,74,169,1,2,174,2,0,165,3,2,198,3,253,2,2,172,2,2,151,1,2,72,
+  2,97,178,2,201,3,74,176,2,0,165,142,74,157,1,178,2,201,3,154,1,178,2,201,
+  3,74,176,2,151,1,74,227,1,176,2,151,1,74,0,166,23,6,8,5,5,9,24,21,
+  16,11,6,7,16,252,206,10,181,239,7,18,14,1,83,2,2,2,2,2,2,2,2,2,
+  163,141,104,166,141,104,2,2,2,2,14,1,98,2,2,2,2,181,141,104,184,141,104,2,
+  2,2,2,2,2,2,2,2,0,254,12,202,141,104,2,2,2,2,2,2,2,2,2,217,
+  141,104,220,141,104,2,2,2,14,1,127,2,2,2,2,2,235,141,104,238,141,104,2,2,
+  2,2,2,2,2,2,14,1,142,253,141,104,128,142,104,2,2,2,2,2,2,2,2,2,
+  175,2,178,2,2,2,14,1,156,2,2,2,2,2,2,193,2,196,2,2,2,2,2,2,
+  2,2,14,1,171,2,211,2,214,2,2,2,2,2,2,2,2,2,2,233,142,104,132,140,
+  104,232,2,14,1,184,2,2,2,2,2,2,2,2,247,2,250,2,2,2,2,2,2,14,
+  1,199,2,2,2,137,3,140,3,2,2,2,2,2,2,2,2,2,155,3,14,1,213,2,
+  2,2,2,2,2,2,2,2,173,3,176,3,2,2,2,2,14,1,228,2,2,2,2,191,
+  3,194,3,2,2,2,2,2,2,203,3,2,2,14,1,12,147,140,104,150,140,104,2,2,
+  2,2,2,2,2,2,2,165,140,104,168,140,104,2,2,14,1,26,2,2,2,2,2,2,
+  183,140,104,186,140,104,2,2,2,2,2,2,2,14,1,41,2,201,140,104,204,140,104,2,
+  2,2,2,2,2,2,2,2,219,140,104,222,140,104,2,14,1,55,2,2,2,2,2,2,
+  2,237,140,104,240,140,104,2,2,2,2,2,2,14,1,70,2,2,255,140,104,130,141,104,
+  2,2,2,2,2,2,2,2,2,197,220,110,139,53,0,28,234,14,11,2,12,10,6,23,
+  14,11,55,38,3,30,5,5,0,28,246,33,6,11,2,8,37,26,38,55,10,56,61,19,
+  24,19,0,28,224,48,77,28,7,6,17,2,2,4,148,17,218,34,168,4,3,175,12,183,
+  19,0,32,94,186,63,19,8,3,1,4,239,190,1,168,141,1,190,28,2,225,29,210,12,
+  144,211,14,2,2,1,251,115,2,2,239,180,14,251,10,224,10,238,161,14,151,180,14,150,
+  184,14,86,33,23,25,209,4,224,4,24,1,246,124,152,4,20,241,210,14,1,188,15,250,
+  184,14,205,183,14,218,183,14,149,5,156,5,151,148,4,2,179,179,10,200,194,14,219,181,
+  14,1,5,112,2,2,2,2,2,2,4,1,4,2,4,2,2,2,2,1,5,129,2,2,
+  2,2,2,2,2,2,2,4,2,2,2,2,2,1,5,146,4,2,4,2,2,2,2,2,
+  2,4,1,4,2,4,2,1,5,165,2,2,2,2,2,2,2,2,2,2,2,2,4,2,
+  2,1,5,182,2,2,2,4,2,254,215,7,223,34,138,3,191,198,14,236,38,145,42,5,
+  3,6,11,0,0,189,168,130,1,169,130,1,168,130,1,18,13,2,22,3,9,177,130,1,
+  176,130,1,3,106,252,224,14,157,91,1,226,245,1,10,15,12,1,5,1,3,93,1,80,
+  9,2,27,39,1,226,195,2,46,24,51,15,42,4,18,41,8,10,33,46,13,29,1,226,
+  221,24,39,34,7,47,5,32,17,2,7,2,42,1,3,24,1,226,211,1,23,74,51,92,
+  33,2,5,2,214,64,3,233,233,6,42,23,22,1,24,183,5,23,16,5,3,34,5,2,
+  2,41,12,23,38,19,16,1,24,184,12,1,21,5,15,48,57,4,2,3,22,116,5,1,
+  10,1,24,225,12,1,5,1,3,34,5,1,10,3,1,9,4,1,40,1,24,193,42,23,
+  22,4,5,23,16,5,3,34,5,2,2,41,12,1,24,192,38,19,16,14,12,1,21,5,
+  15,48,57,4,2,3,22,0,38,160,226,188,14,237,202,14,210,195,14,246,10,254,9,229,
+  24,126,147,160,14,151,8,210,27,176,143,14,174,1,175,1,133,143,14,209,52,0,254,79,
+  7,142,211,7,4,216,12,45,173,6,171,179,14,158,176,14,181,181,14,182,182,14,166,11,
+  203,194,14,142,1,218,200,14,2,0,37,230,226,1,234,206,14,84,36,6,237,207,14,234,
+  206,14,84,181,207,14,220,206,14,14,28,84,27,13,1,250,80,3,2,235,207,14,234,206,
+  14,84,197,207,14,234,206,14,84,187,207,14,234,206,14,84,39,5,8,2,1,250,31,2,
+  169,209,14,254,198,14,135,196,14,204,13,237,15,2,162,2,165,2,6,224,1,244,5,2,
+  2,183,8,1,247,155,165,199,14,164,199,14,157,195,14,209,1,220,5,238,177,14,207,184,
+  14,240,189,14,175,191,14,3,136,4,1,170,2,137,3,222,1,0,39,64,220,181,14,191,
+  163,14,205,18,219,3,228,189,14,196,13,215,202,14,200,2,246,210,14,189,194,14,24,173,
+  5,140,5,212,168,14,217,185,14,1,244,72,215,184,14,173,1,3,3,190,199,14,243,177,
+  14,4,213,20,3,170,21,154,2,151,19,191,5,128,185,14,161,163,14,0,39,84,205,6,
+  184,186,14,213,184,14,236,20,177,22,3,3,154,5,132,221,6,223,224,6,170,20,255,21,
+  206,22,175,20,84,0,37,161,164,190,14,196,9,227,199,14,226,199,14,157,208,14,190,17,
+  229,7,2,230,7,133,9,156,1,6,15,54,186,180,14,1,243,37,2,211,179,14,208,179,
+  14,169,180,14,222,189,14,183,198,14,190,15,211,3,222,181,14,209,184,14,218,214,14,169,
+  216,14,3,114,164,20,0,43,47,255,21,222,21,213,13,240,194,14,32,47,32,32,53,32,
+  47,32,32,37,32,1,248,101,32,32,49,32,47,32,32,51,32,47,32,32,39,32,47,1,
+  248,118,32,45,32,47,32,32,59,32,47,32,32,133,169,14,132,172,14,167,24,200,1,1,
+  250,159,207,28,164,10,181,1,231,5,94,12,25,15,15,30,178,9,161,216,14,152,232,14,
+  169,233,14,162,55,1,245,250,238,18,163,18,187,10,129,197,14,206,203,14,170,16,221,200,
+  14,203,15,168,221,14,29,1,3,3,6,3,1,250,109,15,1,3,3,6,3,10,213,222,
+  14,236,218,14,171,19,235,207,15,140,184,8,2,2,87,1,14,136,1,1,28,17,21,82,
+  5,29,4,12,16,59,14,26,2,1,14,160,32,29,2,6,69,2,50,29,2,10,27,26,
+  1,8,33,1,14,163,17,2,18,51,28,32,18,67,5,20,245,167,3,20,60,9,1,0,
+  164,188,79,30,2,42,47,19,1,32,32,17,39,76,63,48,25,0,164,181,3,38,103,1,
+  84,65,3,8,82,99,40,26,21,21,28,0,164,144,96,4,15,19,53,22,16,18,3,18,
+  19,33,42,13,17,0,164,193,6,243,18,2,5,2,46,2,5,2,130,1,2,5,2,22,
+  2,0,160,105,33,8,2,5,2,3,5,2,32,2,5,2,16,21,2,0,160,98,26,4,
+  1,7,2,14,2,5,2,145,1,2,3,33,8,2,0,160,26,2,3,5,2,32,2,5,
+  2,16,21,2,3,26,4,1,0,160,44,2,14,2,4,1,7,2,138,10,2,5,2,22,
+  2,3,196,2,0,163,100,5,2,26,2,5,2,5,2,5,2,16,21,2,5,2,0,163,
+  115,4,1,5,14,2,4,1,7,2,141,3,8,2,5,2,3,0,162,174,2,32,2,5,
+  2,16,21,2,3,26,4,1,7,2,14,0,162,205,4,1,7,2,131,7,2,5,2,110,
+  2,5,2,22,2,3,0,161,56,6,2,3,1,5,2,30,2,5,2,16,21,2,3,26,
+  0,161,80,1,7,2,115,2,3,29,6,2,3,1,5,2,28,2,0,161,13,2,16,19,
+  1,24,4,1,7,2,129,4,1,128,3,2,5,2,0,160,207,2,5,2,16,2,3,10,
+  2,4,1,7,2,14,2,5,0,160,223,138,4,2,5,2,26,2,5,2,90,2,5,2,
+  26,2,5,0,162,39,33,4,2,3,5,2,30,2,5,2,18,23,2,5,2,0,162,45,
+  4,1,7,2,157,1,8,2,5,2,3,5,2,34,2,5,0,161,235,18,23,2,5,2,
+  28,4,1,7,2,128,2,2,5,2,24,0,162,127,3,25,1,1,155,3,2,5,2,20,
+  2,3,29,6,2,3,0,161,154,5,2,28,2,3,16,19,2,3,24,4,1,7,2,14,
+  0,161,180,4,1,7,2,175,4,2,5,2,11,6,2,3,1,5,2,0,160,161,2,5,
+  2,10,15,2,3,20,4,1,7,2,12,2,4,0,160,172,5,146,3,2,5,2,18,2,
+  3,29,8,2,5,2,3,5,0,161,105,30,3,2,3,1,16,254,3,2,5,2,5,2,
+  5,2,75,0,162,81,5,2,24,2,3,35,8,2,5,2,3,5,2,34,2,0,162,86,
+  2,5,2,5,2,161,9,8,2,5,2,3,5,2,194,15,8,0,163,231,5,2,3,5,
+  2,114,8,2,5,2,3,5,2,24,2,0,164,35,2,10,15,2,3,20,4,1,7,2,
+  14,2,5,2,127,0,163,239,5,2,10,15,2,5,2,20,4,1,7,2,14,2,4,0,
+  163,250,7,2,235,7,2,5,2,24,2,5,2,33,6,2,3,1,0,161,248,2,30,2,
+  5,2,18,23,2,3,28,4,1,7,2,155,1,0,161,194,5,2,24,2,3,35,8,2,
+  5,2,3,5,2,34,2,0,161,199,2,16,21,2,5,2,26,4,1,7,2,14,2,4,
+  1,0,161,212,2,187,4,2,5,2,24,1,230,5,2,5,2,22,2,3,23,0,162,48,
+  22,2,5,2,16,21,2,3,26,4,1,7,2,161,6,6,0,160,180,3,1,5,2,32,
+  2,5,2,14,19,2,5,2,24,4,0,160,199,7,2,14,2,5,2,246,2,2,3,137,
+  4,2,5,2,11,6,0,160,124,3,1,5,2,24,2,5,2,10,2,4,1,7,2,14,
+  0,160,142,4,1,7,2,154,3,2,5,2,16,2,3,23,6,1,1,0,161,81,2,22,
+  2,5,2,16,2,4,1,7,2,88,2,3,168,3,0,162,99,5,2,22,2,3,25,2,
+  3,24,2,5,2,3,3,2,0,161,127,6,2,3,1,5,2,234,10,8,2,5,2,3,
+  5,2,22,0,164,62,5,2,8,11,1,16,4,1,5,14,2,4,1,7,2,0,161,140,
+  2,5,2,150,8,2,5,2,16,2,5,2,5,2,3,18,0,163,162,4,1,7,2,14,
+  2,4,1,7,2,165,8,21,2,3,26,0,161,150,1,7,2,244,10,8,2,5,2,3,
+  5,2,24,2,5,2,0,164,91,15,2,3,20,5,2,199,5,2,5,2,16,1,25,6,
+  2,0,162,241,1,5,2,26,1,10,11,1,16,4,1,5,14,2,4,0,163,7,7,2,
+  229,11,2,5,2,98,2,5,2,11,6,2,3,1,0,160,56,2,30,2,5,2,10,15,
+  2,3,20,4,1,7,2,14,0,160,83,4,1,7,2,218,14,8,2,5,2,3,5,2,
+  26,2,5,0,164,9,10,15,2,5,2,20,4,1,7,2,14,2,4,1,7,0,164,19,
+  149,1,2,5,2,22,2,3,3,2,5,2,161,1,1,20,2,0,163,132,2,5,2,5,
+  2,18,21,1,26,4,1,7,2,14,2,0,163,147,1,7,2,142,1,21,2,3,26,4,
+  1,7,2,14,2,4,0,163,222,7,2,145,3,2,5,2,22,2,3,164,2,2,5,2,
+  24,2,0,163,182,2,5,2,5,2,18,23,2,3,28,4,1,7,2,14,0,163,195,4,
+  1,7,2,235,2,6,2,3,1,5,2,30,2,5,2,0,163,51,2,5,2,16,2,3,
+  25,6,2,3,1,5,2,24,2,0,163,53,2,16,2,5,2,10,2,4,1,7,2,65,
+  21,2,3,0,163,33,4,1,7,2,14,2,4,1,7,2,131,8,2,5,2,24,0,161,
+  47,3,33,6,2,3,1,5,2,32,2,5,2,16,21,2,0,161,37,2,26,4,1,7,
+  2,199,4,2,3,192,3,2,5,2,16,1,0,160,228,8,2,5,2,3,5,2,26,2,
+  5,2,14,2,4,1,0,160,244,2,14,2,4,1,7,2,142,6,2,5,2,20,2,3,
+  3,0,162,137,3,227,9,224,9,2,3,182,7,8,2,5,2,3,5,2,22,2,0,164,
+  103,2,3,1,16,2,4,1,7,2,14,8,2,5,2,3,0,164,113,2,26,2,5,2,
+  10,15,2,5,2,20,4,1,7,2,0,164,137,2,4,1,7,2,227,7,2,5,2,22,
+  2,3,210,2,2,5,0,163,71,24,2,5,2,5,2,5,2,18,23,2,3,28,4,1,
+  0,163,85,2,14,2,4,1,7,2,153,3,6,2,3,1,5,2,30,0,162,158,5,2,
+  16,21,2,3,26,4,1,7,2,14,2,4,1,0,162,168,2,98,2,5,2,14,2,3,
+  25,8,2,5,2,3,5,0,162,209,24,2,3,14,2,4,1,5,14,2,4,1,7,2,
+  241,242,3,1,250,128,129,222,14,202,29,181,3,3,188,3,77,231,2,3,174,2,2,2,
+  191,2,2,136,195,7,11,1,26,61,1,4,5,1,13,36,11,43,81,64,2,33,2,20,
+  9,1,26,23,10,18,2,49,2,70,61,13,2,76,11,19,9,27,18,1,26,19,22,2,
+  24,10,3,2,43,2,18,2,31,2,48,5,3,1,26,39,56,2,3,1,17,1,3,2,
+  3,10,28,121,5,2,7,1,26,1,10,1,8,11,1,162,254,6,139,230,14,228,251,6,
+  229,251,6,1,174,47,220,180,14,163,167,1,6,57,1,207,56,2,12,21,18,115,24,29,
+  24,38,20,46,37,9,1,65,1,207,18,17,24,8,10,51,24,29,24,90,49,40,2,2,
+  33,61,1,207,19,17,24,10,2,12,20,1,32,107,24,18,18,50,115,24,1,207,24,26,
+  57,24,17,24,12,44,37,20,12,2,2,122,39,52,1,207,109,3,172,1,219,1,96,73,
+  4,2,3,6,24,51,96,103,2,96,1,207,191,47,8,1,1,1,52,3,33,10,1,1,
+  3,2,169,1,19,1,207,195,213,1,2,46,64,71,44,11,1,3,2,5,1,4,13,2,
+  1,207,116,1,20,6,3,2,14,22,5,11,4,6,11,4,12,7,1,207,140,107,2,6,
+  130,1,6,3,2,4,6,3,10,2,5,2,5,1,207,153,1,58,8,3,10,2,5,2,
+  5,3,16,83,1,8,3,1,207,150,7,16,36,2,2,139,1,1,4,2,11,1,4,2,
+  33,16,1,207,133,129,1,2,5,2,6,178,170,1,
+};
+static const unsigned int uname_block_tokens[2041] = {
+  0,90,155,220,287,352,416,505,559,615,692,757,
+  822,882,950,1026,1101,1175,1253,1330,1406,1487,1559,1648,
+  1714,1780,1846,1912,1978,2044,2110,2176,2242,2308,2374,2440,
+  2506,2572,2638,2704,2770,2836,2902,2968,3034,3100,3166,3232,
+  3298,3364,3435,3502,3578,3644,3710,3776,3842,3908,3974,4040,
+  4124,4221,4306,4382,4457,4545,4634,4724,4803,4883,4954,5037,
+  5122,5208,5289,5367,5445,5524,5605,5680,5767,5838,5913,5985,
+  6063,6135,6208,6278,6354,6424,6508,6581,6665,6753,6827,6901,
+  6972,7055,7131,7210,7289,7378,7476,7567,7663,7749,7839,7935,
+  8028,8116,8202,8290,8382,8467,8557,8653,8742,8840,8932,9038,
+  9129,9221,9314,9399,9491,9582,9676,9776,9881,9966,10056,10143,
+  10231,10299,10366,10431,10497,10563,10642,10707,10778,10851,10940,11031,
+  11123,11199,11277,11349,11433,11509,11586,11654,11719,11795,11863,11932,
+  12028,12112,12177,12243,12308,12384,12471,12536,12605,12668,12742,12812,
+  12890,12962,13045,13119,13183,13246,13314,13384,13460,13530,13612,13691,
+  13768,13847,13925,14001,14074,14145,14215,14287,14361,14434,14503,14568,
+  14635,14702,14769,14837,14904,14972,15038,15104,15174,15243,15311,15379,
+  15446,15515,15586,15650,15718,15785,15852,15916,15994,16070,16133,16204,
+  16270,16329,16401,16487,16567,16628,16690,16752,16818,16885,16965,17032,
+  17094,17153,17214,17277,17346,17434,17539,17632,17722,17811,17886,17959,
+  18036,18117,18192,18280,18357,18422,18487,18552,18626,18698,18765,18830,
+  18894,18958,19040,19123,19196,19274,19338,19422,19533,19615,19689,19775,
+  19860,19927,19989,20051,20114,20174,20237,20309,20379,20445,20511,20577,
+  20643,20709,20775,20841,20907,20973,21039,21105,21171,21237,21303,21369,
+  21442,21518,21576,21637,21698,21782,21865,21937,22032,22119,22208,22292,
+  22373,22446,22547,22632,22701,22770,22843,22920,23013,23086,23152,23220,
+  23290,23357,23424,23491,23557,23621,23686,23753,23820,23887,23952,24020,
+  24095,24167,24233,24297,24362,24432,24501,24570,24636,24703,24770,24836,
+  24902,24968,25033,25099,25165,25233,25300,25368,25433,25498,25566,25631,
+  25699,25765,25832,25902,25971,26038,26106,26180,26243,26306,26374,26453,
+  26522,26591,26662,26733,26798,26864,26933,27003,27061,27124,27186,27247,
+  27317,27402,27466,27528,27590,27655,27718,27783,27846,27910,27974,28040,
+  28111,28181,28247,28358,28433,28501,28559,28631,28694,28757,28820,28887,
+  28949,29011,29079,29140,29202,29278,29339,29411,29475,29543,29621,29690,
+  29757,29824,29888,29951,30021,30088,30152,30229,30310,30398,30502,30582,
+  30654,30722,30797,30868,30935,31010,31067,31141,31211,31292,31364,31432,
+  31495,31566,31645,31716,31785,31855,31931,32008,32085,32166,32254,32331,
+  32410,32502,32588,32656,32724,32795,32861,32929,33027,33097,33165,33236,
+  33320,33386,33460,33546,33626,33701,33771,33848,33933,34012,34086,34171,
+  34246,34323,34400,34496,34567,34646,34723,34801,34877,34950,35027,35101,
+  35178,35253,35328,35409,35492,35588,35661,35753,35824,35901,35985,36063,
+  36134,36214,36287,36359,36432,36500,36569,36646,36742,36811,36886,36964,
+  37052,37136,37205,37281,37351,37429,37510,37591,37673,37744,37816,37887,
+  37962,38044,38132,38214,38287,38355,38425,38500,38585,38654,38736,38813,
+  38889,38968,39057,39128,39196,39267,39336,39406,39481,39562,39638,39702,
+  39765,39832,39899,39966,40033,40100,40167,40234,40315,40392,40460,40529,
+  40599,40678,40752,40825,40900,40971,41042,41122,41205,41279,41347,41418,
+  41490,41570,41649,41720,41797,41872,41948,42025,42107,42194,42278,42346,
+  42410,42480,42546,42615,42678,42746,42811,42874,42935,42997,43069,43140,
+  43206,43290,43361,43439,43512,43576,43663,43731,43795,43856,43929,44000,
+  44091,44161,44221,44282,44347,44416,44483,44550,44618,44685,44752,44821,
+  44887,44974,45056,45147,45223,45311,45395,45487,45570,45664,45750,45821,
+  45894,45955,46019,46076,46138,46202,46265,46345,46425,46491,46557,46623,
+  46689,46755,46821,46887,46955,47021,47087,47153,47219,47285,47351,47417,
+  47483,47549,47617,47683,47749,47815,47881,47947,48013,48079,48145,48212,
+  48286,48352,48418,48484,48550,48616,48682,48748,48814,48880,48946,49012,
+  49078,49144,49210,49276,49343,49409,49475,49541,49607,49673,49739,49805,
+  49871,49937,50003,50069,50135,50201,50267,50333,50399,50465,50532,50598,
+  50664,50730,50796,50862,50953,51017,51082,51165,51232,51310,51387,51476,
+  51561,51640,51704,51775,51841,51907,51973,52038,52104,52170,52236,52301,
+  52369,52434,52500,52565,52631,52696,52761,52826,52891,52956,53022,53088,
+  53152,53220,53286,53351,53416,53482,53548,53613,53678,53747,53827,53899,
+  53990,54099,54201,54289,54373,54460,54535,54629,54725,54800,54871,54932,
+  54998,55060,55141,55218,55297,55364,55431,55497,55565,55636,55706,55776,
+  55850,55917,55984,56065,56139,56210,56283,56357,56428,56503,56574,56641,
+  56714,56775,56840,56910,56988,57096,57175,57249,57344,57414,57494,57570,
+  57646,57724,57794,57867,57948,58023,58110,58192,58261,58330,58409,58491,
+  58577,58657,58738,58817,58894,58965,59039,59120,59199,59269,59344,59436,
+  59520,59589,59678,59753,59816,59877,59938,60014,60079,60142,60207,60267,
+  60335,60400,60465,60526,60587,60657,60729,60794,60860,60928,60991,61053,
+  61113,61194,61274,61340,61406,61472,61538,61604,61670,61736,61805,61871,
+  61937,62003,62069,62135,62201,62267,62333,62399,62465,62531,62597,62662,
+  62729,62794,62859,62925,62991,63055,63123,63183,63244,63307,63376,63430,
+  63511,63576,63659,63755,63869,63988,64097,64211,64304,64375,64451,64526,
+  64599,64676,64754,64844,64920,64994,65060,65126,65192,65258,65324,65390,
+  65456,65522,65588,65654,65720,65786,65852,65918,65984,66050,66116,66202,
+  66281,66355,66446,66540,66607,66670,66732,66793,66857,66935,67009,67083,
+  67157,67250,67333,67419,67494,67559,67630,67694,67770,67839,67904,68003,
+  68059,68117,68174,68242,68324,68389,68460,68524,68606,68702,68780,68853,
+  68916,68977,69041,69112,69187,69265,69329,69388,69452,69519,69585,69651,
+  69721,69785,69851,69921,69986,70050,70117,70188,70252,70319,70383,70446,
+  70511,70574,70635,70703,70769,70834,70896,70965,71028,71089,71151,71214,
+  71279,71355,71416,71482,71554,71617,71677,71745,71818,71881,71952,72014,
+  72078,72152,72231,72307,72387,72453,72523,72585,72644,72712,72770,72833,
+  72892,72958,73037,73116,73186,73262,73337,73415,73483,73561,73654,73726,
+  73799,73867,73939,74016,74082,74153,74220,74291,74361,74429,74498,74567,
+  74637,74712,74786,74863,74938,75013,75090,75177,75247,75313,75384,75455,
+  75525,75591,75665,75753,75838,75902,75967,76049,76122,76194,76268,76343,
+  76420,76494,76576,76649,76722,76795,76869,76941,77009,77081,77152,77222,
+  77297,77377,77449,77528,77602,77673,77752,77827,77901,77976,78053,78131,
+  78213,78291,78375,78451,78522,78595,78665,78739,78809,78883,78960,79030,
+  79105,79167,79270,79364,79443,79538,79614,79704,79799,79904,79992,80077,
+  80158,80256,80343,80435,80518,80576,80639,80699,80773,80871,80958,81061,
+  81133,81198,81257,81323,81415,81484,81551,81618,81685,81752,81819,81886,
+  81953,82020,82087,82154,82221,82288,82355,82436,82529,82596,82663,82730,
+  82797,82864,82953,83048,83123,83194,83282,83355,83424,83505,83600,83697,
+  83795,83891,83978,84052,84114,84177,84249,84328,84413,84494,84585,84683,
+  84778,84860,84921,84987,85046,85119,85178,85246,85325,85405,85483,85542,
+  85607,85677,85741,85803,85863,85927,86000,86075,86163,86230,86302,86369,
+  86434,86523,86583,86650,86712,86776,86843,86907,86968,87033,87106,87173,
+  87235,87298,87357,87419,87483,87544,87612,87675,87739,87814,87880,87944,
+  88009,88083,88143,88206,88268,88334,88397,88461,88524,88583,88644,88710,
+  88772,88833,88898,88961,89024,89093,89161,89224,89288,89367,89427,89486,
+  89547,89622,89688,89751,89815,89877,89943,90008,90073,90148,90215,90279,
+  90351,90420,90483,90548,90614,90674,90732,90792,90857,90918,90978,91042,
+  91105,91165,91229,91310,91400,91460,91522,91596,91658,91721,91824,91924,
+  91987,92054,92120,92195,92269,92333,92426,92520,92617,92716,92814,92914,
+  93014,93113,93213,93311,93411,93511,93606,93676,93738,93795,93850,93907,
+  93968,94030,94111,94177,94238,94304,94369,94433,94504,94569,94634,94702,
+  94782,94858,94920,94983,95042,95106,95170,95248,95309,95390,95474,95568,
+  95651,95742,95829,95898,95970,96048,96120,96200,96272,96354,96427,96513,
+  96597,96663,96735,96804,96865,96935,96996,97058,97127,97188,97270,97361,
+  97434,97492,97556,97625,97687,97746,97821,97894,97970,98041,98120,98198,
+  98278,98364,98457,98537,98612,98691,98766,98850,98934,99012,99080,99149,
+  99221,99284,99346,99417,99489,99557,99636,99717,99797,99860,99940,100019,
+  100098,100168,100235,100303,100366,100426,100490,100563,100642,100705,100777,100841,
+  100906,101005,101113,101210,101274,101338,101403,101469,101540,101608,101677,101738,
+  101799,101867,101934,102011,102076,102143,102203,102279,102378,102461,102550,102638,
+  102738,102852,102920,102981,103047,103118,103209,103293,103360,103441,103505,103573,
+  103653,103719,103788,103859,103924,103992,104060,104133,104197,104268,104336,104403,
+  104472,104537,104604,104670,104730,104806,104881,104947,105017,105087,105162,105232,
+  105301,105371,105441,105511,105594,105680,105769,105839,105907,105967,106029,106094,
+  106162,106230,106288,106355,106415,106476,106537,106599,106661,106721,106776,106835,
+  106914,106988,107059,107125,107191,107277,107354,107430,107497,107576,107644,107712,
+  107773,107831,107894,107957,108025,108089,108153,108213,108282,108371,108437,108497,
+  108567,108644,108733,108826,108888,108947,109020,109097,109170,109246,109325,109389,
+  109468,109554,109632,109714,109796,109866,109939,110011,110093,110178,110276,110367,
+  110459,110539,110608,110687,110780,110854,110940,111034,111096,111167,111228,111289,
+  111373,111470,111552,111631,111721,111808,111901,111993,112082,112180,112272,112356,
+  112436,112531,112618,112711,112795,112898,112959,113032,113122,113185,113255,113338,
+  113421,113507,113600,113690,113786,113871,113938,114014,114085,114173,114234,114299,
+  114359,114421,114487,114553,114614,114682,114768,114837,114907,114967,115028,115099,
+  115166,115238,115305,115372,115455,115555,115629,115689,115753,115831,115928,115994,
+  116099,116181,116256,116329,116420,116490,116565,116648,116721,116799,116873,116951,
+  117041,117121,117203,117275,117358,117438,117526,117590,117671,117752,117833,117911,
+  117979,118053,118129,118212,118305,118393,118487,118561,118635,118722,118795,118882,
+  118957,119029,119115,119201,119301,119385,119489,119567,119637,119709,119779,119855,
+  119918,119992,120097,120193,120281,120374,120443,120530,120618,120703,120774,120840,
+  120931,120994,121063,121149,121232,121308,121371,121431,121500,121566,121653,121737,
+  121803,121870,121940,122006,122077,122140,122209,122271,122334,122399,122468,122534,
+  122602,122694,122775,122843,122911,122988,123052,123115,123191,123267,123352,123441,
+  123501,123586,123680,123742,123804,123862,123939,124012,124078,124173,124249,124315,
+  124388,124463,124544,124628,124708,124780,124851,124925,125005,125083,125147,125212,
+  125275,125335,125408,125479,125537,125596,125659,125722,125801,125862,125923,125985,
+  126049,126127,126188,126257,126329,126397,126465,126543,126611,126672,126734,126793,
+  126858,126935,127006,127079,127138,127198,127273,127343,127414,127475,127542,127606,
+  127671,127737,127804,127869,127934,127999,128064,128129,128194,128259,128324,128389,
+  128454,128519,128584,128649,128714,128779,128844,128909,128974,129039,129104,129169,
+  129234,129299,129364,129429,129494,129559,129624,129689,129754,129819,129884,129949,
+  130014,130079,130144,130209,130274,130339,130404,130469,130534,130599,130664,130729,
+  130794,130859,130927,131016,131115,131180,131243,131305,131373,131438,131522,131593,
+  131661,131740,131810,131884,131951,132017,132094,132174,132250,132324,132398,132466,
+  132558,132653,132756,132808,132880,132941,133003,133144,133268,133382,133479,133545,
+  133606,133689,133772,133857,133925,133992,134058,134136,134205,134270,134329,134391,
+  134458,134531,134611,134698,134761,134819,134905,134983,135064,135149,135252,135347,
+  135413,135486,135576,135668,135778,135872,135977,136078,136163,136249,136331,136426,
+  136486,136552,136617,136682,136748,136813,136877,136942,137007,137074,137140,137206,
+  137270,137334,137399,137463,137527,137593,137660,137725,137790,137855,137920,137985,
+  138050,138115,138180,138245,138310,138375,138440,138505,138570,138635,138711,138799,
+  138882,138981,139061,139153,139235,139299,139363,139430,139494,139573,139648,139707,
+  139766,139827,139908,139975,140041,140106,140173,140241,140320,140413,140520,140612,
+  140696,140789,140877,140954,141032,141118,141205,141295,141390,141487,141568,141650,
+  141730,141797,141863,141935,142001,142067,142133,142199,142265,142331,142396,142462,
+  142528,142594,142660,142725,142791,142857,142921,142987,143053,143119,143185,143250,
+  143316,143382,143448,143514,143580,143646,143712,143777,143843,143909,143975,144040,
+  144105,144171,144237,144302,144368,144434,144499,144565,144631,144697,144763,144829,
+  144895,144961,145027,145093,145159,145225,145289,145355,145421,145487,145552,145618,
+  145684,145749,145815,145880,145946,146012,146077,146142,146208,146274,146340,146406,
+  146471,146537,146603,146669,146735,146801,146867,146935,147030,147105,147168,147231,
+  147309,147395,147479,147563,147646,147729,147802,147872,147946,148020,148104,148179,
+  148253,
+};
+static const unsigned int uname_block_codes[2041] = {
+  0,36,54,72,90,108,126,151,169,187,207,227,
+  245,264,282,310,328,347,366,388,407,426,453,484,
+  502,520,538,556,574,592,610,628,646,664,682,700,
+  718,736,754,772,790,808,826,844,862,880,898,916,
+  934,952,970,988,1006,1024,1042,1060,1078,1096,1114,1132,
+  1174,1198,1216,1235,1253,1271,1299,1331,1362,1389,1420,1442,
+  1475,1504,1532,1565,1598,1627,1655,1685,1714,1746,1775,1806,
+  1839,1872,1899,1930,1962,1991,2023,2055,2083,2113,2144,2178,
+  2209,2242,2275,2305,2335,2367,2392,2423,2452,2481,2511,2537,
+  2567,2598,2628,2655,2680,2709,2735,2763,2788,2816,2841,2867,
+  2894,2918,2942,2963,2988,3014,3045,3073,3100,3127,3154,3181,
+  3207,3226,3245,3263,3282,3300,3322,3340,3360,3384,3414,3439,
+  3465,3489,3516,3536,3564,3586,3609,3627,3645,3663,3681,3699,
+  3732,3775,3793,3811,3829,3858,3886,3905,3923,3941,3959,3977,
+  3996,4014,4047,4075,4094,4112,4132,4151,4170,4190,4208,4226,
+  4244,4262,4280,4299,4320,4341,4362,4381,4401,4422,4441,4464,
+  4483,4506,4525,4547,4569,4590,4612,4636,4658,4681,4703,4724,
+  4748,4771,4791,4809,4827,4845,4865,4885,4912,4933,4951,4973,
+  4991,5009,5029,5063,5091,5110,5128,5147,5170,5190,5221,5240,
+  5258,5276,5294,5312,5334,5372,5402,5432,5456,5496,5529,5562,
+  5600,5633,5667,5700,5725,5743,5761,5779,5803,5829,5858,5884,
+  5911,5931,5960,5992,6011,6029,6054,6073,6093,6120,6140,6158,
+  6178,6202,6220,6239,6258,6276,6294,6315,6337,6365,6392,6420,
+  6446,6474,6501,6529,6555,6583,6610,6638,6665,6693,6721,6749,
+  6783,6815,6833,6852,6877,6904,6930,6952,6972,6995,7014,7040,
+  7064,7089,7109,7131,7150,7171,7198,7219,7243,7275,7296,7318,
+  7339,7361,7382,7402,7420,7440,7459,7479,7497,7517,7537,7560,
+  7581,7608,7630,7653,7674,7696,7715,7737,7762,7783,7805,7828,
+  7851,7873,7896,7922,7945,7969,7992,8015,8038,8059,8082,8106,
+  8125,8144,8165,8186,8208,8232,8258,8292,8310,8328,8350,8377,
+  8395,8413,8435,8465,8483,8501,8520,8540,8558,8577,8595,8613,
+  8631,8663,8681,8699,8717,8735,8755,8775,8793,8815,8833,8853,
+  8882,8905,8925,8956,8984,9011,9029,9054,9072,9093,9113,9136,
+  9154,9172,9192,9210,9228,9251,9275,9305,9327,9365,9391,9409,
+  9428,9449,9468,9487,9506,9525,9543,9566,9589,9614,9648,9682,
+  9711,9735,9769,9795,9829,9865,9885,9914,9941,9966,9984,10002,
+  10024,10050,10074,10096,10121,10150,10178,10206,10234,10260,10288,10321,
+  10355,10388,10416,10452,10470,10492,10513,10531,10553,10588,10608,10630,
+  10657,10681,10708,10741,10767,10789,10809,10829,10849,10871,10891,10910,
+  10933,10955,10975,10994,11014,11036,11054,11081,11104,11122,11141,11163,
+  11186,11207,11228,11253,11277,11298,11320,11344,11366,11386,11408,11430,
+  11450,11470,11488,11511,11537,11558,11585,11604,11622,11640,11660,11678,
+  11696,11717,11735,11753,11771,11790,11812,11836,11859,11880,11900,11922,
+  11942,11969,11993,12011,12031,12051,12075,12096,12118,12137,12156,12177,
+  12195,12217,12239,12259,12279,12301,12321,12339,12360,12397,12426,12444,
+  12462,12482,12500,12518,12536,12554,12572,12590,12617,12650,12683,12712,
+  12744,12774,12799,12829,12858,12891,12925,12961,12988,13021,13050,13077,
+  13111,13138,13166,13195,13224,13258,13289,13324,13364,13397,13421,13439,
+  13457,13475,13493,13514,13538,13569,13595,13618,13638,13663,13689,13715,
+  13736,13766,13814,13855,13879,13899,13936,13955,13973,13991,14009,14041,
+  14069,14092,14110,14128,14146,14167,14185,14203,14221,14239,14257,14289,
+  14313,14343,14374,14406,14425,14458,14492,14524,14558,14591,14622,14640,
+  14659,14678,14696,14715,14736,14756,14778,14804,14835,14853,14871,14889,
+  14907,14926,14944,14963,14983,15001,15019,15037,15055,15073,15091,15109,
+  15127,15145,15165,15183,15201,15219,15237,15255,15273,15291,15309,15329,
+  15349,15367,15385,15403,15421,15439,15457,15475,15493,15511,15529,15547,
+  15565,15583,15601,15619,15639,15657,15675,15693,15711,15729,15747,15765,
+  15783,15801,15819,15837,15855,15873,15891,15909,15927,15945,15965,15983,
+  16001,16019,16037,16055,16079,16097,16115,16144,16166,16188,16216,16248,
+  16280,16305,16323,16344,16367,16388,16411,16435,16461,16481,16503,16528,
+  16546,16566,16586,16610,16628,16648,16670,16692,16714,16737,16756,16775,
+  16798,16819,16838,16861,16883,16903,16923,16943,16961,16983,17008,17035,
+  17060,17089,17121,17161,17197,17235,17269,17305,17341,17367,17385,17403,
+  17421,17439,17463,17494,17521,17539,17557,17575,17593,17612,17630,17648,
+  17668,17686,17704,17734,17752,17770,17788,17806,17824,17849,17874,17892,
+  17915,17933,17951,17974,17999,18024,18052,18070,18088,18110,18136,18162,
+  18189,18217,18242,18266,18292,18316,18341,18364,18382,18400,18431,18465,
+  18492,18519,18543,18572,18600,18627,18651,18678,18704,18725,18752,18780,
+  18803,18821,18851,18882,18901,18919,18938,18960,18979,18999,19017,19035,
+  19053,19073,19093,19112,19130,19150,19176,19194,19212,19231,19249,19267,
+  19285,19308,19339,19364,19388,19420,19449,19477,19497,19528,19563,19586,
+  19616,19648,19686,19716,19748,19791,19825,19851,19879,19909,19939,19957,
+  19985,20005,20023,20041,20059,20078,20097,20117,20135,20153,20173,20191,
+  20215,20233,20264,20291,20326,20361,20390,20423,20458,20476,20498,20538,
+  20582,20622,20650,20676,20694,20720,20738,20756,20775,20793,20812,20830,
+  20850,20868,20888,20906,20925,20943,20961,20979,20999,21017,21035,21059,
+  21077,21095,21113,21145,21166,21184,21202,21225,21246,21270,21301,21334,
+  21369,21403,21422,21440,21464,21482,21502,21520,21542,21562,21580,21611,
+  21629,21647,21665,21690,21712,21730,21748,21766,21792,21820,21854,21882,
+  21900,21918,21936,21954,21974,22007,22025,22043,22061,22083,22104,22129,
+  22151,22182,22206,22231,22256,22282,22308,22331,22355,22381,22404,22425,
+  22445,22464,22482,22506,22526,22550,22568,22588,22608,22629,22655,22678,
+  22696,22719,22737,22755,22784,22802,22820,22838,22859,22877,22895,22913,
+  22931,22949,22968,22987,23005,23023,23043,23061,23079,23097,23115,23133,
+  23151,23169,23197,23230,23248,23267,23285,23303,23324,23357,23392,23418,
+  23450,23483,23520,23551,23579,23613,23644,23682,23719,23749,23787,23823,
+  23855,23889,23916,23946,23983,24016,24051,24088,24120,24156,24183,24218,
+  24245,24273,24311,24339,24370,24400,24438,24471,24496,24531,24562,24596,
+  24632,24663,24697,24729,24759,24797,24833,24869,24906,24940,24974,25012,
+  25049,25091,25127,25163,25200,25227,25258,25292,25332,25367,25408,25443,
+  25480,25510,25545,25581,25617,25656,25688,25719,25757,25784,25815,25849,
+  25880,25907,25939,25968,25999,26032,26066,26098,26134,26172,26202,26240,
+  26273,26300,26334,26368,26400,26418,26437,26455,26473,26495,26524,26564,
+  26592,26610,26628,26646,26666,26686,26704,26722,26740,26758,26776,26794,
+  26812,26830,26848,26866,26884,26902,26920,26938,26956,26975,26993,27011,
+  27029,27047,27066,27084,27102,27120,27138,27156,27174,27193,27212,27231,
+  27249,27268,27286,27314,27332,27350,27372,27398,27426,27458,27486,27515,
+  27543,27575,27593,27612,27630,27658,27676,27696,27714,27732,27752,27770,
+  27790,27810,27829,27847,27865,27887,27908,27933,27957,27975,27997,28015,
+  28033,28061,28079,28098,28116,28134,28159,28177,28195,28213,28235,28268,
+  28298,28326,28348,28367,28385,28403,28431,28461,28488,28511,28542,28572,
+  28601,28622,28640,28658,28679,28710,28739,28767,28786,28806,28824,28846,
+  28864,28882,28907,28936,28965,28989,29018,29050,29078,29103,29121,29140,
+  29159,29179,29211,29242,29269,29292,29322,29351,29379,29405,29435,29464,
+  29489,29519,29550,29579,29601,29619,29639,29657,29675,29694,29712,29731,
+  29749,29767,29789,29810,29835,29853,29872,29890,29908,29926,29956,29993,
+  30014,30038,30058,30081,30110,30129,30148,30166,30186,30211,30239,30260,
+  30285,30311,30336,30361,30386,30409,30437,30456,30474,30492,30510,30528,
+  30547,30565,30591,30610,30629,30649,30669,30687,30705,30723,30741,30759,
+  30798,30826,30847,30865,30883,30901,30919,30955,30981,31010,31038,31074,
+  31109,31135,31171,31201,31239,31272,31308,31342,31377,31407,31444,31471,
+  31502,31524,31545,31564,31583,31601,31620,31638,31658,31676,31700,31738,
+  31769,31787,31805,31827,31845,31863,31891,31916,31941,31959,31980,32001,
+  32024,32048,32068,32089,32110,32132,32155,32177,32199,32223,32243,32266,
+  32287,32307,32327,32364,32393,32413,32438,32465,32491,32514,32538,32557,
+  32584,32602,32620,32651,32669,32687,32705,32725,32751,32769,32791,32811,
+  32831,32860,32879,32900,32921,32939,32957,32976,32994,33014,33033,33051,
+  33069,33089,33107,33136,33154,33172,33190,33216,33252,33280,33308,33337,
+  33373,33399,33420,33438,33456,33475,33500,33525,33543,33568,33586,33604,
+  33624,33642,33660,33678,33697,33715,33733,33752,33770,33788,33810,33828,
+  33847,33865,33884,33902,33920,33942,33960,33978,33997,34015,34034,34052,
+  34071,34089,34108,34126,34150,34183,34216,34237,34256,34274,34292,34315,
+  34335,34355,34373,34391,34409,34428,34446,34464,34485,34503,34521,34541,
+  34574,34598,34617,34635,34653,34671,34689,34708,34726,34754,34772,34797,
+  34819,34837,34855,34873,34891,34911,34931,34949,34967,35002,35020,35038,
+  35056,35091,35127,35161,35179,35197,35215,35235,35253,35271,35293,35311,
+  35343,35378,35396,35414,35432,35450,35473,35496,35532,35566,35593,35611,
+  35633,35667,35685,35712,35737,35775,35807,35836,35854,35876,35894,35912,
+  35950,35983,36020,36048,36081,36116,36153,36184,36218,36254,36286,36324,
+  36356,36384,36418,36448,36482,36514,36534,36554,36582,36608,36626,36647,
+  36666,36684,36703,36722,36746,36779,36797,36815,36833,36854,36878,36897,
+  36915,36933,36953,36986,37012,37046,37084,37108,37127,37145,37163,37185,
+  37204,37227,37245,37263,37293,37323,37350,37368,37386,37405,37423,37441,
+  37462,37483,37502,37520,37542,37566,37587,37610,37631,37655,37675,37697,
+  37720,37741,37762,37782,37805,37823,37843,37863,37882,37904,37923,37942,
+  37960,37979,37999,38020,38041,38062,38083,38103,38122,38144,38167,38186,
+  38207,38226,38246,38266,38284,38304,38327,38347,38367,38385,38403,38421,
+  38440,38459,38497,38528,38563,38587,38607,38638,38663,38698,38716,38734,
+  38763,38781,38799,38830,38858,38876,38894,38912,38930,38953,38984,39014,
+  39039,39069,39096,39125,39151,39174,39200,39222,39243,39266,39291,39314,
+  39341,39372,39396,39414,39432,39464,39487,39506,39541,39575,39610,39646,
+  39666,39693,39721,39739,39757,39775,39795,39818,39842,39871,39898,39916,
+  39934,39954,39976,40002,40020,40039,40058,40076,40095,40121,40139,40157,
+  40175,40193,40212,40234,40252,40271,40290,40308,40327,40345,40363,40381,
+  40400,40418,40437,40455,40475,40493,40511,40529,40551,40569,40587,40605,
+  40623,40653,40673,40693,40711,40729,40758,40781,40805,40827,40845,40863,
+  40881,40899,40918,40936,40954,40972,40990,41008,41026,41044,41062,41080,
+  41098,41116,41134,41152,41170,41188,41206,41224,41242,41260,41278,41296,
+  41314,41332,41350,41368,41386,41404,41422,41440,41458,41476,41494,41512,
+  41530,41548,41566,41584,41602,41620,41638,41656,41674,41692,41710,41728,
+  41746,41764,41790,41828,41846,41866,41885,41903,41924,41943,41971,41989,
+  42008,42026,42046,42066,42084,42102,42121,42142,42161,42179,42197,42215,
+  42248,42279,42307,42325,42345,42363,42381,42403,42428,42452,42475,42493,
+  42511,42531,42550,42573,42591,42609,42627,42658,42684,42703,42721,42739,
+  42757,42785,42814,42841,42859,42879,42916,42940,42977,43009,43049,43081,
+  43099,43123,43152,43183,43218,43244,43273,43307,43342,43374,43409,43440,
+  43461,43490,43520,43548,43575,43604,43631,43660,43687,43715,43744,43770,
+  43796,43825,43854,43880,43905,43934,43956,43978,44000,44024,44046,44070,
+  44090,44115,44135,44156,44176,44197,44223,44245,44271,44293,44318,44336,
+  44354,44377,44405,44435,44473,44491,44509,44527,44545,44571,44602,44620,
+  44638,44656,44677,44695,44713,44731,44749,44767,44805,44841,44870,44900,
+  44931,44969,45009,45043,45077,45111,45150,45173,45191,45215,45245,45276,
+  45303,45321,45339,45359,45377,45395,45413,45433,45451,45470,45488,45508,
+  45526,45545,45563,45582,45600,45618,45638,45656,45675,45693,45712,45731,
+  45750,45768,45787,45805,45824,45843,45861,45881,45899,45917,45935,45954,
+  45973,45991,46009,46029,46048,46066,46086,46104,46123,46142,46160,46179,
+  46197,46216,46235,46254,46273,46291,46310,46328,46347,46365,46385,46403,
+  46422,46442,46460,46479,46497,46515,46534,46552,46572,46590,46609,46630,
+  46648,46666,46686,46704,46723,46741,46759,46779,46807,46825,46843,46861,
+  46879,46910,46928,46946,46964,46982,47002,47021,47040,47058,47077,47095,
+  47114,
+};
+static const struct uname_range {
+  const char*   prefix;
+  unsigned int  first;
+  unsigned int  last;
+} uname_ranges[] = {
+  { "CJK UNIFIED IDEOGRAPH-", 0x3400, 0x4DBF },
+  { "CJK UNIFIED IDEOGRAPH-", 0x4E00, 0x9FFF },
+  { "CJK COMPATIBILITY IDEOGRAPH-", 0xF900, 0xFA6D },
+  { "CJK COMPATIBILITY IDEOGRAPH-", 0xFA70, 0xFAD9 },
+  { "KHITAN SMALL SCRIPT CHARACTER-", 0x18B00, 0x18CD5 },
+  { "NUSHU CHARACTER-", 0x1B170, 0x1B2FB },
+  { "CJK UNIFIED IDEOGRAPH-", 0x20000, 0x2A6DF },
+  { "CJK UNIFIED IDEOGRAPH-", 0x2A700, 0x2B738 },
+  { "CJK UNIFIED IDEOGRAPH-", 0x2B740, 0x2B81D },
+  { "CJK UNIFIED IDEOGRAPH-", 0x2B820, 0x2CEA1 },
+  { "CJK UNIFIED IDEOGRAPH-", 0x2CEB0, 0x2EBE0 },
+  { "CJK COMPATIBILITY IDEOGRAPH-", 0x2F800, 0x2FA1D },
+  { "CJK UNIFIED IDEOGRAPH-", 0x30000, 0x3134A },
+};
@@ -0,0 +1,253 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* The tables are generated by gen-unicode-names.py. They are read only and
+ * live in the text segment, so only the pages touched by a lookup (a few
+ * block heads and one block) ever become resident. */
+#include "unicode-names-data.h"
+
+#define UNAME_MAX_NAME 128
+#define UNAME_MAX_TOKENS 64
+
+/* Hangul syllables are named algorithmically (Unicode 3.12) */
+#define HANGUL_SBASE 0xAC00
+#define HANGUL_LCOUNT 19
+#define HANGUL_VCOUNT 21
+#define HANGUL_TCOUNT 28
+
+static const char *jamo_l[HANGUL_LCOUNT] = {
+  "G", "GG", "N", "D", "DD", "R", "M", "B", "BB", "S", "SS", "", "J", "JJ",
+  "C", "K", "T", "P", "H"
+};
+static const char *jamo_v[HANGUL_VCOUNT] = {
+  "A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O", "WA", "WAE", "OE",
+  "YO", "U", "WEO", "WE", "WI", "YU", "EU", "YI", "I"
+};
+static const char *jamo_t[HANGUL_TCOUNT] = {
+  "", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM", "LB", "LS",
+  "LT", "LP", "LH", "M", "B", "BS", "S", "SS", "NG", "J", "C", "K", "T",
+  "P", "H"
+};
+
+/* word -- returns the text of word token i {{{ */
+static const char *
+word(unsigned int i, unsigned int *len)
+{
+  const char *w = uname_words + uname_word_base[i >> 4];
+  unsigned int j;
+  for (j = i & ~15u; j < i; j++)
+    w += uname_word_len[j];
+  *len = uname_word_len[i];
+  return w;
+}
+
+/* }}} */
+
+/* read_token -- read the next word token from the token stream {{{ */
+static const unsigned char *
+read_token(const unsigned char *p, unsigned int *token)
+{
+  if (*p < UNAME_ONE_BYTE) {
+    *token = *p++;
+  } else {
+    *token = UNAME_ONE_BYTE + ((p[0] - UNAME_ONE_BYTE) << 8) + p[1];
+    p += 2;
+  }
+  return p;
+}
+
+/* }}} */
+
+/* spell -- build the name from a list of word tokens {{{ */
+static void
+spell(const unsigned int *tokens, int ntokens, char *name)
+{
+  int i;
+  for (i = 0; i < ntokens; i++) {
+    unsigned int len;
+    const char *w = word(tokens[i], &len);
+    if (i > 0)
+      *name++ = ' ';
+    memcpy(name, w, len);
+    name += len;
+  }
+  *name = '\0';
+}
+
+/* }}} */
+
+/* read_code -- read the next code point from the code stream {{{ */
+static const unsigned char *
+read_code(const unsigned char *p, int head, long *code)
+{
+  unsigned long v = 0;
+  int shift = 0;
+  if (head) {
+    *code = (p[0] << 16) | (p[1] << 8) | p[2];
+    return p + 3;
+  }
+  do {
+    v |= (unsigned long)(*p & 0x7f) << shift;
+    shift += 7;
+  } while (*p++ & 0x80);
+  *code += (v & 1) ? -(long)(v >> 1) - 1 : (long)(v >> 1);
+  return p;
+}
+
+/* }}} */
+
+/* block_head -- spell the first name of a block {{{ */
+static void
+block_head(int block, char *name)
+{
+  unsigned int tokens[UNAME_MAX_TOKENS];
+  const unsigned char *p = uname_tokens + uname_block_tokens[block];
+  int i, n = p[1];
+  p += 2;
+  for (i = 0; i < n; i++)
+    p = read_token(p, &tokens[i]);
+  spell(tokens, n, name);
+}
+
+/* }}} */
+
+/* find_in_block -- linear scan of a front coded block {{{ */
+static long
+find_in_block(int block, const char *key)
+{
+  unsigned int tokens[UNAME_MAX_TOKENS];
+  char name[UNAME_MAX_NAME];
+  const unsigned char *p = uname_tokens + uname_block_tokens[block];
+  const unsigned char *c = uname_codes + uname_block_codes[block];
+  long code = 0;
+  int i, n, ntokens = 0;
+
+  for (n = 0; n < UNAME_BLOCK && block * UNAME_BLOCK + n < UNAME_NAMES; n++) {
+    int shared = *p++, count = *p++, cmp;
+    for (i = 0; i < count; i++)
+      p = read_token(p, &tokens[shared + i]);
+    ntokens = shared + count;
+    c = read_code(c, n == 0, &code);
+    spell(tokens, ntokens, name);
+    cmp = strcmp(name, key);
+    if (cmp == 0)
+      return code;
+    if (cmp > 0)
+      break;
+  }
+  return -1;
+}
+
+/* }}} */
+
+/* find_algorithmic -- names derived from the code point {{{ */
+static long
+find_algorithmic(const char *key)
+{
+  int i;
+  if (!strncmp(key, "HANGUL SYLLABLE ", 16)) {
+    const char *s = key + 16;
+    int l, v, t;
+    for (l = 0; l < HANGUL_LCOUNT; l++)
+      for (v = 0; v < HANGUL_VCOUNT; v++)
+        for (t = 0; t < HANGUL_TCOUNT; t++) {
+          size_t ll = strlen(jamo_l[l]), vl = strlen(jamo_v[v]);
+          if (!strncmp(s, jamo_l[l], ll) && !strncmp(s + ll, jamo_v[v], vl) &&
+              !strcmp(s + ll + vl, jamo_t[t]))
+            return HANGUL_SBASE + (l * HANGUL_VCOUNT + v) * HANGUL_TCOUNT + t;
+        }
+    return -1;
+  }
+  for (i = 0; i < sizeof(uname_ranges) / sizeof(uname_ranges[0]); i++) {
+    size_t len = strlen(uname_ranges[i].prefix);
+    if (!strncmp(key, uname_ranges[i].prefix, len)) {
+      char *end;
+      long code = strtol(key + len, &end, 16);
+      if (*end == '\0' && end - (key + len) >= 4 &&
+          code >= uname_ranges[i].first && code <= uname_ranges[i].last)
+        return code;
+    }
+  }
+  return -1;
+}
+
+/* }}} */
+
+/* find_unicode -- find code point for a unicode character name {{{
+ *
+ * Names are matched ignoring case and '_' can be used in place of a space.
+ * Returns -1 when the name is unknown.
+ */
+long
+find_unicode(const char *name)
+{
+  char key[UNAME_MAX_NAME], head[UNAME_MAX_NAME];
+  int lo = 0, hi = (UNAME_NAMES + UNAME_BLOCK - 1) / UNAME_BLOCK - 1;
+  size_t i;
+  long code;
+
+  for (i = 0; name[i] && i < sizeof(key) - 1; i++)
+    key[i] = name[i] == '_' ? ' ' : toupper((unsigned char)name[i]);
+  if (name[i])
+    return -1;
+  key[i] = '\0';
+
+  if ((code = find_algorithmic(key)) != -1)
+    return code;
+
+  /* Binary search for the last block whose head is <= key */
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    block_head(mid, head);
+    if (strcmp(head, key) <= 0)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return find_in_block(lo, key);
+}
+
+/* }}} */
+
+#ifdef MAIN
+int
+main(int argc, char **argv)
+{
+  if(argc < 2) {
+    printf("Usage: %s charactername...\n", argv[0]);
+    exit(EXIT_SUCCESS);
+  }
+
+  for(int i = 1; i < argc; i++) {
+    long code = find_unicode(argv[i]);
+    if(code != -1)
+      printf("%s: U+%04lX\n", argv[i], code);
+    else
+      printf("%s: Unknown\n", argv[i]);
+  }
+}
+#endif
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
@@ -39,6 +39,9 @@ Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
 
 static inline unsigned char to_uchar(char ch) { return ch; }
 
+/* Resolves a glyph name to a code point, -1 if the name is unknown */
+typedef long (*glyph_lookup)(const char *name);
+
 int u8_uctomb(char *s, unsigned int uc, int n)
 {
   if (uc < 0x80)
@@ -94,26 +97,73 @@ int u8_uctomb(char *s, unsigned int uc, int n)
   return -2;
 }
 
+/* A text buffer is either caller supplied (fixed size) or grows on demand */
+struct text_buffer
+{
+  char*   data;
+  size_t  len;
+  size_t  size;
+  int     growable;
+};
+
+/* reserve -- make room for n more bytes and a terminating NUL {{{ */
+static int
+reserve(struct text_buffer *b, size_t n)
+{
+  size_t size;
+  char *data;
+  if (b->len + n < b->size)
+    return 0;
+  if (!b->growable)
+    return -1;
+  for (size = b->size ? b->size : 64; size <= b->len + n; size *= 2)
+    ;
+  if ((data = realloc(b->data, size)) == NULL)
+    return -1;
+  b->data = data;
+  b->size = size;
+  return 0;
+}
+
+/* }}} */
+
+/* append -- append n bytes to the buffer {{{ */
 static int
-print_unicode_char(unsigned int code, char **b)
+append(struct text_buffer *b, const char *s, size_t n)
+{
+  if (reserve(b, n) == -1)
+    return -1;
+  memcpy(b->data + b->len, s, n);
+  b->len += n;
+  return 0;
+}
+
+/* }}} */
+
+/* print_unicode_char -- append UTF-8 encoding of code {{{ */
+static int
+print_unicode_char(unsigned int code, struct text_buffer *b)
 {
   char inbuf[8];
-  memset(inbuf, 0, sizeof(inbuf));
   int count;
 
   count = u8_uctomb((char *)inbuf, code, sizeof(inbuf));
   if (count < 0)
     return -3;
-  memcpy(*b, inbuf, count);
-  *b += count;
+  if (append(b, inbuf, count) == -1)
+    return -4;
   return count;
 }
 
+/* }}} */
+
+/* print_esc -- decode an escape. Returns the number of bytes consumed after the '\' {{{ */
 static int
-print_esc(const char *escstart, char **b)
+print_esc(const char *escstart, struct text_buffer *b)
 {
   const char *p = escstart + 1;
   int esc_length; /* Length of \nnn escape. */
+  int ret;
 
   if (*p == 'u' || *p == 'U')
   {
@@ -138,35 +188,83 @@ print_esc(const char *escstart, char **b)
     if ((uni_value <= 0x9f && uni_value != 0x24 && uni_value != 0x40 && uni_value != 0x60) || (uni_value >= 0xd800 && uni_value <= 0xdfff))
       return -2;
 
-    print_unicode_char(uni_value, b);
+    /* -3 for a code point UTF-8 can not encode, -4 out of memory */
+    if ((ret = print_unicode_char(uni_value, b)) < 0)
+      return ret;
   }
   else
   {
-    char *c = *b;
-    int i = 1;
-    *c++ = '\\';
+    if (append(b, escstart, *p ? 2 : 1) == -1)
+      return -4;
     if (*p)
-    {
-      i++;
-      *c++ = *p++;
-    }
-    *b += i;
+      p++;
   }
   return p - escstart - 1;
 }
 
-#define UTF8_BUFFER_LENGTH 4096
+/* }}} */
 
-char *print_utf8(const char *s)
+#define GLYPH_NAME_LENGTH 128
+
+/* print_glyph -- resolve a :name: glyph. Returns the number of bytes consumed {{{ */
+static int
+print_glyph(const char *s, glyph_lookup lookup, struct text_buffer *b)
+{
+  const char *end = memchr(s + 1, ':', strnlen(s + 1, GLYPH_NAME_LENGTH));
+  char name[GLYPH_NAME_LENGTH];
+  long code;
+
+  if (end == NULL)
+  {
+    /* Not a glyph name - copy the ':' as is */
+    return append(b, s, 1) == -1 ? -4 : 1;
+  }
+  if (end == s + 1)
+  {
+    /* '::' stands for a single ':' */
+    return append(b, s, 1) == -1 ? -4 : 2;
+  }
+  memcpy(name, s + 1, end - s - 1);
+  name[end - s - 1] = '\0';
+  if ((code = lookup(name)) != -1)
+  {
+    int ret = print_unicode_char(code, b);
+    if (ret == -4)
+      return -4;
+    if (ret > 0)
+      return end - s + 1;
+  }
+  fprintf(stderr, "Unable to find code for %s\n", name);
+  if (append(b, s, end - s + 1) == -1)
+    return -4;
+  return end - s + 1;
+}
+
+/* }}} */
+
+/* transcode -- single pass over s resolving escapes and glyph names {{{ */
+static int
+transcode(const char *s, glyph_lookup lookup, struct text_buffer *b)
 {
-  char buffer[UTF8_BUFFER_LENGTH];
-  char *p = &buffer[0];
+  const char *specials = lookup ? ":\\" : "\\";
 
   while (*s)
   {
+    /* Bulk copy everything up to the next special character */
+    size_t n = strcspn(s, specials);
+    int ret;
+    if (n > 0)
+    {
+      if (append(b, s, n) == -1)
+        return -1;
+      s += n;
+      continue;
+    }
     if (*s == '\\')
     {
-      int ret = print_esc(s, &p);
+      ret = print_esc(s, b);
+      if (ret == -4)
+        return -1;
       if (ret < 0)
       {
         fprintf(stderr, "\nError: %d\n", ret);
@@ -179,13 +277,58 @@ char *print_utf8(const char *s)
     }
     else
     {
-      *p++ = *s++;
+      if ((ret = print_glyph(s, lookup, b)) < 0)
+        return -1;
+      s += ret;
     }
   }
-  *p = 0;
-  return strdup(buffer);
+  if (reserve(b, 0) == -1)
+    return -1;
+  b->data[b->len] = '\0';
+  return 0;
 }
 
+/* }}} */
+
+/* utf8_transcode -- transcode into a caller supplied buffer {{{
+ *
+ * Resolves \uXXXX and \UXXXXXXXX escapes and, when lookup is given, :name:
+ * glyph names. Returns the length of the result or -1 if it does not fit.
+ */
+int
+utf8_transcode(const char *s, glyph_lookup lookup, char *dest, size_t size)
+{
+  struct text_buffer b = { dest, 0, size, 0 };
+  if (size == 0 || transcode(s, lookup, &b) == -1)
+    return -1;
+  return b.len;
+}
+
+/* }}} */
+
+/* utf8_transcode_dup -- transcode into a newly allocated string {{{ */
+char *
+utf8_transcode_dup(const char *s, glyph_lookup lookup)
+{
+  struct text_buffer b = { NULL, 0, 0, 1 };
+  if (reserve(&b, strlen(s)) == -1 || transcode(s, lookup, &b) == -1)
+  {
+    free(b.data);
+    return NULL;
+  }
+  return b.data;
+}
+
+/* }}} */
+
+/* print_utf8 -- resolve unicode escapes {{{ */
+char *print_utf8(const char *s)
+{
+  return utf8_transcode_dup(s, NULL);
+}
+
+/* }}} */
+
 #ifdef MAIN
 int main(int argc, char **argv)
 {
@@ -0,0 +1,194 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#define _GNU_SOURCE           /* pipe2 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <time.h>
+#include <sys/wait.h>
+
+#include "osd-cat.h"
+
+extern char **environ;
+
+/* run -- start the command with its output going to a pipe {{{
+ *
+ * The command is spawned directly, without a shell. Returns the pid and
+ * sets fd to the read end of the pipe, or returns -1.
+ */
+static pid_t
+run(char **argv, int *fd)
+{
+  posix_spawn_file_actions_t actions;
+  int p[2], err;
+  pid_t pid;
+
+  if (pipe2(p, O_CLOEXEC) == -1)
+    return -1;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, p[1], STDOUT_FILENO);
+  err = posix_spawnp(&pid, argv[0], &actions, NULL, argv, environ);
+  posix_spawn_file_actions_destroy(&actions);
+  close(p[1]);
+  if (err != 0) {
+    close(p[0]);
+    errno = err;
+    return -1;
+  }
+  *fd = p[0];
+  return pid;
+}
+
+/* }}} */
+
+/* capture -- read the first lines of the output into frame {{{ */
+static int
+capture(struct line_reader *r, struct line_queue *frame, long long now)
+{
+  char *line;
+  size_t len;
+  int n = 0;
+
+  frame->head = frame->count = 0;
+  r->start = r->end = r->scanned = 0;
+  r->eof = 0;
+  while (!r->eof) {
+    if (reader_fill(r) == -1)
+      return -1;
+    while ((n = reader_next(r, &line, &len)) == 1) {
+      /* The rest of the output is read and dropped */
+      if (frame->count == frame->capacity || !filter_accept(&filter, line, len))
+        continue;
+      if (filter.npatterns[FILTER_HIGHLIGHT] > 0 &&
+          filter_highlight(&filter, &line, &len) == -1)
+        return -1;
+      if (queue_push(frame, line, len, now) == -1)
+        return -1;
+    }
+    if (n == -1)
+      return -1;
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* changed -- does line i differ between the frames {{{ */
+static int
+changed(struct line_queue *frame, struct line_queue *prev, int i)
+{
+  if (i >= frame->count || i >= prev->count)
+    return (i < frame->count) != (i < prev->count);
+  return frame->lines[i].len != prev->lines[i].len ||
+    memcmp(frame->lines[i].text, prev->lines[i].text, frame->lines[i].len);
+}
+
+/* }}} */
+
+/* update -- send the lines that changed since the previous frame {{{ */
+static int
+update(struct line_queue *frame, struct line_queue *prev)
+{
+  int n = frame->count > prev->count ? frame->count : prev->count;
+  int i;
+
+  for (i = 0; i < n; i++) {
+    if (!changed(frame, prev, i))
+      continue;
+    if (i < frame->count) {
+      if (osd_set_lines(osd, i, 1, frame->lines[i].text, frame->lines[i].len) == -1)
+        return -1;
+    } else if (osd_set_lines(osd, i, 1, "", 0) == -1)
+      return -1;
+  }
+  return 0;
+}
+
+/* }}} */
+
+/* watch_command -- run a command every interval ms and show its output {{{
+ *
+ * Like watch(1), but the command is spawned directly and only the lines
+ * that differ from the last run are redrawn. Runs start interval apart,
+ * whatever the command takes. Returns -1 if the command can't be run.
+ */
+int
+watch_command(char **argv, int interval)
+{
+  struct line_queue frames[2];
+  struct line_reader reader;
+  struct timespec next;
+  long long due = now_ms();
+  int current = 0, r = 0;
+
+  if (queue_init(&frames[0], nlines) == -1 || queue_init(&frames[1], nlines) == -1 ||
+      reader_init(&reader, -1) == -1) {
+    fprintf(stderr, "Could not allocate memory...\n");
+    return -1;
+  }
+  for (;;) {
+    struct line_queue *frame = &frames[current], *prev = &frames[!current];
+    pid_t pid = run(argv, &reader.fd);
+    int status, err;
+
+    if (pid == -1) {
+      fprintf(stderr, "Unable to run %s: %s\n", argv[0], strerror(errno));
+      r = -1;
+      break;
+    }
+    r = capture(&reader, frame, now_ms());
+    err = errno;
+    close(reader.fd);
+    while (waitpid(pid, &status, 0) == -1 && errno == EINTR)
+      ;
+    if (r == -1) {
+      fprintf(stderr, "Error reading the output of %s: %s\n", argv[0], strerror(err));
+      break;
+    }
+    if (update(frame, prev) == -1) {
+      fprintf(stderr, "Could not show the output of %s: %s\n", argv[0], osd_error);
+      r = -1;
+      break;
+    }
+    current = !current;
+
+    /* Absolute deadlines keep the runs from drifting */
+    due += interval;
+    if (due < now_ms())
+      due = now_ms();
+    next.tv_sec = due / 1000;
+    next.tv_nsec = due % 1000 * 1000000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+      ;
+  }
+  reader_free(&reader);
+  queue_free(&frames[0]);
+  queue_free(&frames[1]);
+  return r;
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
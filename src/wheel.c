@@ -0,0 +1,121 @@
+/*
+
+Copyright 2021 Dakshinamurthy Karra (dakshinamurthy.karra@jaliansystems.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "osd-status.h"
+
+/* wheel_init -- an empty wheel, tick 0 at the last wall clock second {{{
+ *
+ * Aligning the ticks to the wall clock makes the providers that update
+ * every second do so as the second changes.
+ */
+void
+wheel_init(struct wheel *w)
+{
+  struct timespec mono, real;
+
+  memset(w, 0, sizeof(*w));
+  clock_gettime(CLOCK_MONOTONIC, &mono);
+  clock_gettime(CLOCK_REALTIME, &real);
+  w->start = mono.tv_sec * 1000LL + mono.tv_nsec / 1000000 - real.tv_nsec / 1000000;
+}
+
+/* }}} */
+
+/* wheel_add -- schedule the next update of a provider {{{
+ *
+ * Updates fall on multiples of the interval, so providers with the same
+ * interval expire together.
+ */
+void
+wheel_add(struct wheel *w, struct provider *p)
+{
+  struct provider **slot;
+
+  p->due = (w->tick / p->interval + 1) * p->interval;
+  slot = &w->slots[p->due % WHEEL_SLOTS];
+  p->next = *slot;
+  *slot = p;
+}
+
+/* }}} */
+
+/* wheel_next -- the next tick with a provider to update {{{
+ *
+ * Looks one turn of the wheel ahead. Providers due later stay in their
+ * slot for another turn, so the wheel wakes up once per turn at most
+ * when nothing is due.
+ */
+long long
+wheel_next(struct wheel *w)
+{
+  long long t;
+
+  for (t = w->tick + 1; t <= w->tick + WHEEL_SLOTS; t++) {
+    struct provider *p;
+    for (p = w->slots[t % WHEEL_SLOTS]; p != NULL; p = p->next)
+      if (p->due == t)
+        return t;
+  }
+  return w->tick + WHEEL_SLOTS;
+}
+
+/* }}} */
+
+/* wheel_expire -- advance to tick and take out the providers due {{{ */
+struct provider *
+wheel_expire(struct wheel *w, long long tick)
+{
+  struct provider **p = &w->slots[tick % WHEEL_SLOTS], *expired = NULL;
+
+  w->tick = tick;
+  while (*p != NULL) {
+    struct provider *e = *p;
+    if (e->due <= tick) {
+      *p = e->next;
+      e->next = expired;
+      expired = e;
+    } else
+      p = &e->next;
+  }
+  return expired;
+}
+
+/* }}} */
+
+/* wheel_sleep -- sleep till the start of a tick {{{ */
+void
+wheel_sleep(struct wheel *w, long long tick)
+{
+  long long at = w->start + tick * WHEEL_TICK;
+  struct timespec ts;
+
+  ts.tv_sec = at / 1000;
+  ts.tv_nsec = at % 1000 * 1000000;
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    ;
+}
+
+/* }}} */
+
+/* vim: foldmethod=marker tabstop=2 shiftwidth=2 expandtab
+ */
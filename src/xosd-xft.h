@@ -116,6 +116,8 @@ void osd_set_geometry(xosd_xft *osd, const osd_geometry *geometry);
 
 /* osd_set_font -- Set the font for the OSD window
 *
+* Can be called after the window is displayed. The string is not copied.
+*
 * ARGUMENTS
 *    osd       A xosd_xft object
 *    font      The font
@@ -123,8 +125,99 @@ void osd_set_geometry(xosd_xft *osd, const osd_geometry *geometry);
 */
 void osd_set_font(xosd_xft *osd, const char *font);
 
+/* osd_set_font_autofit -- Size the font to fit the text in the window
+*
+* The text is drawn at the largest size in points, from min_pt to max_pt,
+* that it fits at in the window less the padding. The window keeps the size
+* its geometry gives it with the font as set. The size found is cached for
+* the text and window.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    min_pt    The smallest size
+*    max_pt    The largest size, 0 to turn off
+*
+*/
+void osd_set_font_autofit(xosd_xft *osd, int min_pt, int max_pt);
+
+/* osd_preload_glyphs -- Load glyphs before they are first drawn
+*
+* The glyphs are rendered and sent to the X server by the event thread, for
+* the font in use, so the first message that uses them is not held up. The
+* printable ASCII characters are preloaded when the window is created and
+* when the font changes.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    glyphs    UTF-8 text, or codepoint ranges U+XXXX[-YYYY] separated by
+*              commas
+*
+* RETURNS
+*     -1 on failure
+*/
+int osd_preload_glyphs(xosd_xft *osd, const char *glyphs);
+
+typedef struct _osd_preload_stats
+{
+  unsigned int  requests;         /* Preloads done */
+  unsigned int  glyphs;           /* Glyphs loaded, not counting loaded ones */
+  long long     usec;             /* Time spent loading */
+  long long     last_usec;        /* Time of the last preload */
+} osd_preload_stats;
+
+/* osd_get_preload_stats -- Get the glyph preloading statistics
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    stats     Filled with the statistics
+*
+*/
+void osd_get_preload_stats(xosd_xft *osd, osd_preload_stats *stats);
+
+/* osd_set_glyph_budget -- Bound the memory of the loaded glyphs
+*
+* Xft keeps the glyphs it renders, in the client and in the X server, for
+* as long as the font is open. With a budget the glyphs not drawn for the
+* longest time are unloaded, after a redraw, when those of all the fonts
+* take more. The glyphs drawn since the last redraw are kept.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    bytes     The budget, 0 for none
+*
+*/
+void osd_set_glyph_budget(xosd_xft *osd, unsigned long bytes);
+
+typedef struct _osd_font_stats
+{
+  char          name[128];        /* Family, style and size */
+  unsigned int  glyphs;           /* Glyphs loaded */
+  unsigned long client_bytes;     /* Held by Xft in the client, estimated */
+  unsigned long server_bytes;     /* Held in the X server glyph set */
+  unsigned int  evictions;        /* Glyphs unloaded for the budget */
+  unsigned int  reloads;          /* Glyphs drawn again after unloading */
+} osd_font_stats;
+
+/* osd_get_font_stats -- Get the glyph cache statistics of the fonts
+*
+* The glyphs are counted when they are drawn or preloaded, and measured
+* after the redraw.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    stats     Filled with the statistics of up to n fonts
+*    n         The size of stats
+*
+* RETURNS
+*     The number of fonts, which may be more than n
+*/
+int osd_get_font_stats(xosd_xft *osd, osd_font_stats *stats, int n);
+
 /* osd_set_monitor -- Set the monitor for the OSD window
 *
+* Can be called after the window is displayed to move it. With xrandr the
+* font is opened at the DPI of monitors denser than 96 DPI and Xft.dpi.
+*
 * ARGUMENTS
 *    osd       A xosd_xft object
 *    monitor   The monitor (starts with: 1)
@@ -178,6 +271,20 @@ void osd_set_shadowcolor(xosd_xft *osd, const char *shadowcolor);
 */
 void osd_set_shadowoffset(xosd_xft *osd, int offset);
 
+/* osd_set_ansi -- Enable/disable ANSI SGR escapes
+*
+* When enabled, SGR escape sequences (ESC [ ... m) in the messages set the
+* attributes of the text that follows them: 16, 256 and 24 bit (nearest of
+* the 256) foreground and background colors, bold and reverse. Other CSI
+* sequences are dropped.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    ansi      bool 0 for false
+*
+*/
+void osd_set_ansi(xosd_xft *osd, int ansi);
+
 /* osd_set_xinerama -- Enable/disable xinerama
 *
 * ARGUMENTS
@@ -205,6 +312,20 @@ void osd_set_xrandr(xosd_xft *osd, int xrandr);
 */
 void osd_set_number_of_lines(xosd_xft *osd, int nlines);
 
+/* osd_get_number_of_lines -- Gets the number of lines in display
+*
+* The geometry can fit fewer lines than were set, which are then dropped.
+* Creates the window if it is not yet created, so call it once the
+* settings are made.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*
+* RETURNS
+*     the number of lines, -1 on failure
+*/
+int osd_get_number_of_lines(xosd_xft *osd);
+
 /* osd_show -- Show OSD Window (previously hidden)
 *
 * ARGUMENTS
@@ -227,6 +348,9 @@ int osd_hide(xosd_xft *osda);
 
 /* osd_display -- Display a string in the OSD window
 *
+* The message is split on newlines and every line is added to the
+* display (older lines scroll out) with a single redraw.
+*
 * ARGUMENTS
 *    osd       A xosd_xft object
 *    message   The string to display
@@ -237,6 +361,59 @@ int osd_hide(xosd_xft *osda);
 */
 int osd_display(xosd_xft *osd, char *message, int len);
 
+/* osd_replace -- Replace the contents of the OSD window
+*
+* Like osd_display, but the lines of the message replace all the lines
+* currently displayed.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    message   The string to display
+*    len       The length of string
+*
+* RETURNS
+*     -1 on failure
+*/
+int osd_replace(xosd_xft *osd, char *message, int len);
+
+/* osd_set_lines -- Replace a range of lines in the OSD window
+*
+* The lines of the message replace count lines starting at line first
+* (counting from 0). If the message has more lines only the last count of
+* them are used; the rest of the range is cleared. Only the range is
+* redrawn, so a window can be split into regions that are updated
+* independently.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    first     The first line of the range
+*    count     The number of lines in the range
+*    message   The string to display
+*    len       The length of string
+*
+* RETURNS
+*     -1 on failure
+*/
+int osd_set_lines(xosd_xft *osd, int first, int count, char *message, int len);
+
+/* osd_scroll_lines -- Scroll a range of lines in the OSD window up
+*
+* The lines in the range move up by n, the first n of them are dropped and
+* the n lines at the bottom are cleared. The window is copied up and only
+* those n lines are drawn, unless it was drawn in between or the font is
+* autofitted, when the range is redrawn.
+*
+* ARGUMENTS
+*    osd       A xosd_xft object
+*    first     The first line of the range
+*    count     The number of lines in the range
+*    n         The number of lines to scroll by
+*
+* RETURNS
+*     -1 on failure
+*/
+int osd_scroll_lines(xosd_xft *osd, int first, int count, int n);
+
 /* osd_destroy -- Free all held resources of OSD window
 *
 * ARGUMENTS